@@ -0,0 +1,101 @@
+#!/usr/bin/env python
+
+#
+#    Copyright (c) 2021 Project CHIP Authors
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+#
+# Decodes the output of the "msgtrace dump" shell command: a header line
+# followed by one base64-encoded binary record per traced message (see
+# src/transport/TraceMessage.h for the record layout).
+#
+# Example usage:
+#
+#   ./scripts/tools/decode_message_trace.py < msgtrace.txt
+#
+
+import argparse
+import base64
+import struct
+import sys
+
+# Little-endian record layout, kBinaryEntrySize bytes per entry:
+#   timestamp_us:u64 duration_us:u32 counter:u32 size:u16 exchange:u16
+#   protocol:u16 session:u16 type:u8 direction:u8
+RECORD_FORMAT = '<QIIHHHHBB'
+RECORD_SIZE = struct.calcsize(RECORD_FORMAT)
+
+SUPPORTED_VERSION = 1
+
+DIRECTIONS = {0: 'out', 1: 'in'}
+
+
+def decode_record(data):
+    (timestamp_us, duration_us, counter, size, exchange, protocol, session,
+     msg_type, direction) = struct.unpack(RECORD_FORMAT, data)
+    return {
+        'timestamp_us': timestamp_us,
+        'duration_us': duration_us,
+        'counter': counter,
+        'size': size,
+        'exchange': exchange,
+        'protocol': protocol,
+        'session': session,
+        'type': msg_type,
+        'direction': DIRECTIONS.get(direction, '?%d' % direction),
+    }
+
+
+def decode_dump(lines, out):
+    records = []
+    for line in lines:
+        line = line.strip()
+        if not line:
+            continue
+        if line.startswith('msgtrace'):
+            fields = dict(f.split('=') for f in line.split()[2:])
+            version = int(line.split()[1].lstrip('v'))
+            if version != SUPPORTED_VERSION:
+                raise ValueError('unsupported trace format version %d' % version)
+            dropped = int(fields['total']) - int(fields['entries'])
+            if dropped > 0:
+                out.write('# %d older entries overwritten\n' % dropped)
+            continue
+        data = base64.b64decode(line)
+        if len(data) != RECORD_SIZE:
+            raise ValueError('record is %d bytes, expected %d' % (len(data), RECORD_SIZE))
+        records.append(decode_record(data))
+
+    out.write('%-16s %3s %8s %10s %4s %8s %8s %4s %6s\n' %
+              ('timestamp-us', 'dir', 'session', 'counter', 'size', 'exchange',
+               'protocol', 'type', 'dur-us'))
+    for r in records:
+        out.write('%-16d %3s %8d %10d %4d %8d 0x%06x 0x%02x %6d\n' %
+                  (r['timestamp_us'], r['direction'], r['session'], r['counter'],
+                   r['size'], r['exchange'], r['protocol'], r['type'],
+                   r['duration_us']))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Decode a "msgtrace dump" capture into a readable table.')
+    parser.add_argument('input', nargs='?', type=argparse.FileType('r'),
+                        default=sys.stdin, help='capture file (default: stdin)')
+    args = parser.parse_args()
+    decode_dump(args.input, sys.stdout)
+
+
+if __name__ == '__main__':
+    main()
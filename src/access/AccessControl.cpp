@@ -18,6 +18,8 @@
 
 #include "AccessControl.h"
 
+#include <cstring>
+
 namespace {
 
 using chip::CATValues;
@@ -73,6 +75,7 @@ AccessControl::Delegate AccessControl::mDefaultDelegate;
 CHIP_ERROR AccessControl::Init()
 {
     ChipLogDetail(DataManagement, "AccessControl::Init");
+    InvalidateDecisionCache();
     return mDelegate.Init();
 }
 
@@ -88,6 +91,24 @@ CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, con
     // During development, allow access if delegate is transitional
     ReturnErrorCodeIf(mDelegate.IsTransitional(), CHIP_NO_ERROR);
 
+    bool allowed = false;
+    if (FindCachedDecision(subjectDescriptor, requestPath, requestPrivilege, allowed))
+    {
+        return allowed ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+    }
+
+    CHIP_ERROR err = CheckAgainstEntries(subjectDescriptor, requestPath, requestPrivilege);
+    // Only actual decisions are cached; other errors must be re-evaluated.
+    if (err == CHIP_NO_ERROR || err == CHIP_ERROR_ACCESS_DENIED)
+    {
+        CacheDecision(subjectDescriptor, requestPath, requestPrivilege, err == CHIP_NO_ERROR);
+    }
+    return err;
+}
+
+CHIP_ERROR AccessControl::CheckAgainstEntries(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                              Privilege requestPrivilege)
+{
     EntryIterator iterator;
     ReturnErrorOnFailure(Entries(iterator, &subjectDescriptor.fabricIndex));
 
@@ -199,6 +220,64 @@ CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, con
     return CHIP_ERROR_ACCESS_DENIED;
 }
 
+bool AccessControl::FindCachedDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                       Privilege requestPrivilege, bool & allowed)
+{
+    for (auto & decision : mDecisionCache)
+    {
+        if (decision.lastUse == 0)
+        {
+            continue;
+        }
+        if (decision.subjectDescriptor.fabricIndex != subjectDescriptor.fabricIndex ||
+            decision.subjectDescriptor.authMode != subjectDescriptor.authMode ||
+            decision.subjectDescriptor.subject != subjectDescriptor.subject ||
+            memcmp(decision.subjectDescriptor.cats.values, subjectDescriptor.cats.values, sizeof(subjectDescriptor.cats.values)) !=
+                0)
+        {
+            continue;
+        }
+        if (decision.requestPath.cluster != requestPath.cluster || decision.requestPath.endpoint != requestPath.endpoint ||
+            decision.requestPrivilege != requestPrivilege)
+        {
+            continue;
+        }
+        decision.lastUse = ++mDecisionCacheUseCounter;
+        allowed          = decision.allowed;
+        return true;
+    }
+    return false;
+}
+
+void AccessControl::CacheDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                  Privilege requestPrivilege, bool allowed)
+{
+    // Replace the least recently used slot (unused slots have lastUse 0 and so sort first).
+    CachedDecision * lru = &mDecisionCache[0];
+    for (auto & decision : mDecisionCache)
+    {
+        if (decision.lastUse < lru->lastUse)
+        {
+            lru = &decision;
+        }
+    }
+    lru->subjectDescriptor = subjectDescriptor;
+    lru->requestPath       = requestPath;
+    lru->requestPrivilege  = requestPrivilege;
+    lru->allowed           = allowed;
+    lru->lastUse           = ++mDecisionCacheUseCounter;
+}
+
+void AccessControl::InvalidateDecisionCache()
+{
+    for (auto & decision : mDecisionCache)
+    {
+        decision.lastUse = 0;
+    }
+    // Restarting the use counter avoids (very theoretical) wraparound after invalidation.
+    mDecisionCacheUseCounter = 0;
+}
+
 AccessControl & GetAccessControl()
 {
     return *globalAccessControl;
@@ -391,6 +391,7 @@ public:
      */
     CHIP_ERROR CreateEntry(size_t * index, const Entry & entry, FabricIndex * fabricIndex = nullptr)
     {
+        InvalidateDecisionCache();
         return mDelegate.CreateEntry(index, entry, fabricIndex);
     }
 
@@ -415,6 +416,7 @@ public:
      */
     CHIP_ERROR UpdateEntry(size_t index, const Entry & entry, const FabricIndex * fabricIndex = nullptr)
     {
+        InvalidateDecisionCache();
         return mDelegate.UpdateEntry(index, entry, fabricIndex);
     }
 
@@ -426,6 +428,7 @@ public:
      */
     CHIP_ERROR DeleteEntry(size_t index, const FabricIndex * fabricIndex = nullptr)
     {
+        InvalidateDecisionCache();
         return mDelegate.DeleteEntry(index, fabricIndex);
     }
 
@@ -451,8 +454,34 @@ public:
     CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
 
 private:
+    // A cached allow/deny decision for a (subject, path, privilege) tuple.  Subscriptions
+    // re-evaluate the same tuples constantly, so a small cache lets steady-state traffic
+    // skip the full entry iteration in Check().  The cache is invalidated whenever entries
+    // are created, updated or deleted.
+    static constexpr size_t kDecisionCacheSize = 8;
+    struct CachedDecision
+    {
+        SubjectDescriptor subjectDescriptor;
+        RequestPath requestPath;
+        Privilege requestPrivilege = Privilege::kView;
+        bool allowed               = false;
+        uint32_t lastUse           = 0; ///< 0 means the slot is unused.
+    };
+
+    bool FindCachedDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                            Privilege requestPrivilege, bool & allowed);
+    void CacheDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                       bool allowed);
+    void InvalidateDecisionCache();
+
+    CHIP_ERROR CheckAgainstEntries(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                   Privilege requestPrivilege);
+
     static Delegate mDefaultDelegate;
     Delegate & mDelegate = mDefaultDelegate;
+
+    CachedDecision mDecisionCache[kDecisionCacheSize];
+    uint32_t mDecisionCacheUseCounter = 0;
 };
 
 /**
@@ -19,6 +19,7 @@
 #include "ExampleAccessControlDelegate.h"
 
 #include <lib/core/CHIPConfig.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
 
 #include <algorithm>
 #include <cstdint>
@@ -34,6 +35,9 @@ using chip::NodeId;
 
 using chip::kUndefinedNodeId;
 
+using chip::DefaultStorageKeyAllocator;
+using chip::PersistentStorageDelegate;
+
 using chip::Access::AccessControl;
 using chip::Access::AuthMode;
 using chip::Access::Privilege;
@@ -1001,6 +1005,8 @@ public:
         return CHIP_ERROR_BUFFER_TOO_SMALL;
     }
 
+    void SetStorageDelegate(PersistentStorageDelegate * storageDelegate) { mStorageDelegate = storageDelegate; }
+
     CHIP_ERROR CreateEntry(size_t * index, const Entry & entry, FabricIndex * fabricIndex) override
     {
         if (auto * storage = EntryStorage::FindUnusedInAcl())
@@ -1008,6 +1014,12 @@ public:
             CHIP_ERROR err = Copy(entry, *storage);
             if (err == CHIP_NO_ERROR)
             {
+                err = SaveEntryToFlash(size_t(storage - EntryStorage::acl));
+                if (err != CHIP_NO_ERROR)
+                {
+                    storage->Clear();
+                    return err;
+                }
                 if (fabricIndex != nullptr)
                 {
                     *fabricIndex = storage->mFabricIndex;
@@ -1044,7 +1056,13 @@ public:
     {
         if (auto * storage = EntryStorage::FindUsedInAcl(index, fabricIndex))
         {
-            return Copy(entry, *storage);
+            CHIP_ERROR err = Copy(entry, *storage);
+            if (err == CHIP_NO_ERROR)
+            {
+                // A single-entry update rewrites exactly its own record.
+                err = SaveEntryToFlash(size_t(storage - EntryStorage::acl));
+            }
+            return err;
         }
         return CHIP_ERROR_SENTINEL;
     }
@@ -1053,8 +1071,9 @@ public:
     {
         if (auto * storage = EntryStorage::FindUsedInAcl(index, fabricIndex))
         {
-            constexpr auto & acl = EntryStorage::acl;
-            constexpr auto * end = acl + ArraySize(acl);
+            const size_t absoluteIndex = size_t(storage - EntryStorage::acl);
+            constexpr auto & acl       = EntryStorage::acl;
+            constexpr auto * end       = acl + ArraySize(acl);
             // Go through the access control list starting at the deleted storage...
             for (auto * next = storage + 1; storage < end; ++storage, ++next)
             {
@@ -1080,7 +1099,9 @@ public:
             {
                 delegate.FixAfterDelete(*storage);
             }
-            return CHIP_NO_ERROR;
+            // Compacting the list shifted the entries after the deleted one, so
+            // rewrite their records and drop the record of the former last entry.
+            return SaveTailToFlash(absoluteIndex);
         }
         return CHIP_ERROR_SENTINEL;
     }
@@ -1098,9 +1119,85 @@ public:
     bool IsTransitional() const override { return false; }
 
 private:
-    CHIP_ERROR LoadFromFlash() { return CHIP_NO_ERROR; }
+    CHIP_ERROR LoadFromFlash()
+    {
+        if (mStorageDelegate == nullptr)
+        {
+            // No persistent storage was injected; the access control list is RAM only.
+            return CHIP_NO_ERROR;
+        }
+        DefaultStorageKeyAllocator key;
+        for (size_t index = 0; index < ArraySize(EntryStorage::acl); ++index)
+        {
+            auto & storage = EntryStorage::acl[index];
+            uint16_t size  = static_cast<uint16_t>(sizeof(storage));
+            CHIP_ERROR err = mStorageDelegate->SyncGetKeyValue(key.AccessControlEntry(index), &storage, size);
+            if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+            {
+                // Records are stored contiguously from zero, so the first missing
+                // one ends the list.
+                for (; index < ArraySize(EntryStorage::acl); ++index)
+                {
+                    EntryStorage::acl[index].Clear();
+                }
+                break;
+            }
+            if (err != CHIP_NO_ERROR)
+            {
+                return err;
+            }
+        }
+        return CHIP_NO_ERROR;
+    }
 
-    CHIP_ERROR SaveToFlash() { return CHIP_NO_ERROR; }
+    CHIP_ERROR SaveToFlash() { return SaveTailToFlash(0); }
+
+    // Write the record for a single entry; a single-entry change costs a
+    // single-record write, however large the list is.
+    CHIP_ERROR SaveEntryToFlash(size_t index)
+    {
+        if (mStorageDelegate == nullptr)
+        {
+            return CHIP_NO_ERROR;
+        }
+        DefaultStorageKeyAllocator key;
+        const auto & storage = EntryStorage::acl[index];
+        return mStorageDelegate->SyncSetKeyValue(key.AccessControlEntry(index), &storage, static_cast<uint16_t>(sizeof(storage)));
+    }
+
+    // Rewrite the records from the given index through the last used entry,
+    // then delete the record just past them (left over after a delete
+    // compacted the list) so loading stops at the right place.
+    CHIP_ERROR SaveTailToFlash(size_t index)
+    {
+        if (mStorageDelegate == nullptr)
+        {
+            return CHIP_NO_ERROR;
+        }
+        DefaultStorageKeyAllocator key;
+        for (; index < ArraySize(EntryStorage::acl); ++index)
+        {
+            const auto & storage = EntryStorage::acl[index];
+            if (!storage.InUse())
+            {
+                break;
+            }
+            CHIP_ERROR err =
+                mStorageDelegate->SyncSetKeyValue(key.AccessControlEntry(index), &storage, static_cast<uint16_t>(sizeof(storage)));
+            if (err != CHIP_NO_ERROR)
+            {
+                return err;
+            }
+        }
+        CHIP_ERROR err = mStorageDelegate->SyncDeleteKeyValue(key.AccessControlEntry(index));
+        if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+        {
+            err = CHIP_NO_ERROR;
+        }
+        return err;
+    }
+
+    PersistentStorageDelegate * mStorageDelegate = nullptr;
 };
 
 static_assert(std::is_pod<SubjectStorage>(), "Storage type must be POD");
@@ -1118,9 +1215,13 @@ namespace chip {
 namespace Access {
 namespace Examples {
 
-AccessControl::Delegate & GetAccessControlDelegate()
+AccessControl::Delegate & GetAccessControlDelegate(PersistentStorageDelegate * storageDelegate)
 {
     static AccessControlDelegate accessControlDelegate;
+    if (storageDelegate != nullptr)
+    {
+        accessControlDelegate.SetStorageDelegate(storageDelegate);
+    }
     return accessControlDelegate;
 }
 
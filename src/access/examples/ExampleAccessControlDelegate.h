@@ -18,11 +18,25 @@
 
 #include "access/AccessControl.h"
 
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+
 namespace chip {
 namespace Access {
 namespace Examples {
 
-AccessControl::Delegate & GetAccessControlDelegate();
+/**
+ * Get the example access control delegate.
+ *
+ * If a storage delegate is provided, entries are persisted as one record per
+ * entry, so a single-entry change writes (or deletes) a single record rather
+ * than rewriting the whole list.  Without a storage delegate the access
+ * control list is kept in RAM only, as before.
+ *
+ * A non-null storage delegate is remembered across calls, so early callers
+ * (e.g. static initialization) may omit it and have it injected later, before
+ * AccessControl::Init() runs.
+ */
+AccessControl::Delegate & GetAccessControlDelegate(PersistentStorageDelegate * storageDelegate = nullptr);
 
 } // namespace Examples
 } // namespace Access
@@ -20,6 +20,8 @@
 #include "access/examples/ExampleAccessControlDelegate.h"
 
 #include <lib/core/CHIPCore.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/UnitTestRegistration.h>
 
 #include <nlunit-test.h>
@@ -35,6 +37,10 @@ using Target        = Entry::Target;
 
 AccessControl accessControl(Examples::GetAccessControlDelegate());
 
+// Injected into the delegate by TestPersistence; must outlive the delegate's
+// use of it, so it lives here rather than in the test function.
+TestPersistentStorageDelegate persistentStorage;
+
 constexpr ClusterId kOnOffCluster         = 0x0006;
 constexpr ClusterId kLevelControlCluster  = 0x0008;
 constexpr ClusterId kAccessControlCluster = 0x001F;
@@ -1083,6 +1089,43 @@ void TestUpdateEntry(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+void TestPersistence(nlTestSuite * inSuite, void * inContext)
+{
+    Examples::GetAccessControlDelegate(&persistentStorage);
+
+    EntryData data[entryData1Count];
+    memcpy(data, entryData1, sizeof(data));
+    NL_TEST_ASSERT(inSuite, LoadAccessControl(accessControl, data, ArraySize(data)) == CHIP_NO_ERROR);
+
+    // Each entry has its own record, contiguous from zero.
+    DefaultStorageKeyAllocator key;
+    uint8_t buffer[512];
+    uint16_t size = sizeof(buffer);
+    NL_TEST_ASSERT(inSuite, persistentStorage.SyncGetKeyValue(key.AccessControlEntry(0), buffer, size) == CHIP_NO_ERROR);
+    size = sizeof(buffer);
+    NL_TEST_ASSERT(inSuite,
+                   persistentStorage.SyncGetKeyValue(key.AccessControlEntry(ArraySize(data) - 1), buffer, size) == CHIP_NO_ERROR);
+    size = sizeof(buffer);
+    NL_TEST_ASSERT(inSuite,
+                   persistentStorage.SyncGetKeyValue(key.AccessControlEntry(ArraySize(data)), buffer, size) ==
+                       CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    // A fresh Init reads the persisted list back.
+    NL_TEST_ASSERT(inSuite, accessControl.Finish() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, accessControl.Init() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, CompareAccessControl(accessControl, data, ArraySize(data)) == CHIP_NO_ERROR);
+
+    // Deleting an entry compacts the records and drops the former last one.
+    NL_TEST_ASSERT(inSuite, accessControl.DeleteEntry(0) == CHIP_NO_ERROR);
+    size = sizeof(buffer);
+    NL_TEST_ASSERT(inSuite,
+                   persistentStorage.SyncGetKeyValue(key.AccessControlEntry(ArraySize(data) - 1), buffer, size) ==
+                       CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, accessControl.Finish() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, accessControl.Init() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, CompareAccessControl(accessControl, data + 1, ArraySize(data) - 1) == CHIP_NO_ERROR);
+}
+
 int Setup(void * inContext)
 {
     SetAccessControl(accessControl);
@@ -1122,6 +1165,7 @@ int TestAccessControl()
         NL_TEST_DEF("TestFabricFilteredReadEntry", TestFabricFilteredReadEntry),
         NL_TEST_DEF("TestFabricFilteredCreateEntry", TestFabricFilteredCreateEntry),
         NL_TEST_DEF("TestCheck", TestCheck),
+        NL_TEST_DEF("TestPersistence", TestPersistence),
         NL_TEST_SENTINEL()
     };
     // clang-format on
@@ -113,6 +113,18 @@ public:
             return mAttributeValueEncoder.EncodeListItem(std::forward<T>(aArg));
         }
 
+        /**
+         * Index of the first list item that still needs to be encoded in this report chunk.
+         *
+         * By default a list generator produces every item on every chunk and the encoder skips the
+         * ones previous chunks already sent, which makes resuming a large list quadratic in its
+         * length.  Generators whose backing store supports random access may instead call this once
+         * before producing any items and start production at the returned index; the items before
+         * it are then treated as produced, so the next Encode() call encodes the item at the
+         * returned index.
+         */
+        ListIndex ResumeIndex() const { return mAttributeValueEncoder.ResumeListEncoding(); }
+
     private:
         AttributeValueEncoder & mAttributeValueEncoder;
     };
@@ -253,6 +265,18 @@ private:
         return CHIP_NO_ERROR;
     }
 
+    /**
+     * Fast-forward the per-chunk item counter over the items previous chunks already encoded and
+     * return the index at which production should resume.  Only meaningful inside EncodeList(),
+     * after EncodeEmptyList() has initialized the list indices, and before any item of the current
+     * chunk has been encoded.
+     */
+    ListIndex ResumeListEncoding()
+    {
+        mCurrentEncodingListIndex = mEncodeState.mCurrentEncodingListIndex;
+        return mCurrentEncodingListIndex;
+    }
+
     /**
      * Builds a single AttributeReportIB in AttributeReportIBs.  The caller is
      * responsible for setting up mPath correctly.
@@ -328,7 +352,22 @@ public:
      * used with all endpoints.
      */
     AttributeAccessInterface(Optional<EndpointId> aEndpointId, ClusterId aClusterId) :
-        mEndpointId(aEndpointId), mClusterId(aClusterId)
+        mEndpointId(aEndpointId), mClusterId(aClusterId), mLastEndpointId(aEndpointId.ValueOr(kInvalidEndpointId))
+    {}
+
+    /**
+     * Constructs an interface that handles every cluster on the contiguous
+     * endpoint range [aFirstEndpointId, aLastEndpointId].
+     *
+     * This is the registration shape used by bridges: one provider serves all
+     * externally stored attributes of its dynamic endpoints, and the read path
+     * hands it the TLV encoder directly instead of round-tripping each value
+     * through the fixed-size ember attribute buffer and the external read
+     * callback.
+     */
+    AttributeAccessInterface(EndpointId aFirstEndpointId, EndpointId aLastEndpointId) :
+        mEndpointId(MakeOptional(aFirstEndpointId)), mClusterId(kInvalidClusterId), mLastEndpointId(aLastEndpointId),
+        mMatchesAllClusters(true)
     {}
     virtual ~AttributeAccessInterface() {}
 
@@ -360,6 +399,19 @@ public:
      */
     virtual CHIP_ERROR Write(const ConcreteDataAttributePath & aPath, AttributeValueDecoder & aDecoder) { return CHIP_NO_ERROR; }
 
+    /**
+     * Indicates whether the attribute at aPath has a compact summary representation in
+     * addition to its full value.
+     *
+     * Clusters with very large attributes (big lists and tables) can return true here
+     * and check ConcreteReadAttributePath::mSummaryRead in Read(): when set, Read()
+     * may encode an abbreviated form of the value.  The reporting engine requests the
+     * summary in a subscription's priming report and immediately marks the attribute
+     * dirty again, so the full value streams in the report that follows.  Non-priming
+     * reads always receive the full value.
+     */
+    virtual bool HasSummaryRepresentation(const ConcreteAttributePath & aPath) { return false; }
+
     /**
      * Mechanism for keeping track of a chain of AttributeAccessInterfaces.
      */
@@ -374,15 +426,23 @@ public:
      */
     bool Matches(EndpointId aEndpointId, ClusterId aClusterId) const
     {
-        return (!mEndpointId.HasValue() || mEndpointId.Value() == aEndpointId) && mClusterId == aClusterId;
+        return (!mEndpointId.HasValue() || (mEndpointId.Value() <= aEndpointId && aEndpointId <= mLastEndpointId)) &&
+            (mMatchesAllClusters || mClusterId == aClusterId);
     }
 
     /**
      * Check whether an AttributeAccessInterface is relevant for a particular
      * specific endpoint.  This is used to clean up overrides registered for an
      * endpoint that becomes disabled.
+     *
+     * Deliberately matches only single-endpoint registrations: an endpoint
+     * range provider outlives any one of its endpoints, so its owner (e.g. the
+     * bridge that registered it) manages its lifetime instead.
      */
-    bool MatchesEndpoint(EndpointId aEndpointId) const { return mEndpointId.HasValue() && mEndpointId.Value() == aEndpointId; }
+    bool MatchesEndpoint(EndpointId aEndpointId) const
+    {
+        return mEndpointId.HasValue() && mEndpointId.Value() == aEndpointId && mLastEndpointId == aEndpointId;
+    }
 
     /**
      * Check whether another AttributeAccessInterface wants to handle the same set of
@@ -390,13 +450,19 @@ public:
      */
     bool Matches(const AttributeAccessInterface & aOther) const
     {
-        return mClusterId == aOther.mClusterId &&
-            (!mEndpointId.HasValue() || !aOther.mEndpointId.HasValue() || mEndpointId.Value() == aOther.mEndpointId.Value());
+        const bool clustersOverlap = mMatchesAllClusters || aOther.mMatchesAllClusters || mClusterId == aOther.mClusterId;
+        const bool endpointsOverlap = !mEndpointId.HasValue() || !aOther.mEndpointId.HasValue() ||
+            (mEndpointId.Value() <= aOther.mLastEndpointId && aOther.mEndpointId.Value() <= mLastEndpointId);
+        return clustersOverlap && endpointsOverlap;
     }
 
 private:
     Optional<EndpointId> mEndpointId;
     ClusterId mClusterId;
+    // For single-endpoint and all-endpoint registrations the range is
+    // degenerate (mLastEndpointId mirrors mEndpointId or is unused).
+    EndpointId mLastEndpointId       = kInvalidEndpointId;
+    bool mMatchesAllClusters         = false;
     AttributeAccessInterface * mNext = nullptr;
 };
 
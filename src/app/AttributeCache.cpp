@@ -24,6 +24,26 @@
 namespace chip {
 namespace app {
 
+namespace {
+
+// Tags for the versioned binary snapshot produced by SerializeState().
+constexpr uint8_t kSnapshotVersion = 1;
+
+constexpr TLV::Tag kTagSnapshotVersion = TLV::ContextTag(0);
+constexpr TLV::Tag kTagEndpoints       = TLV::ContextTag(1);
+constexpr TLV::Tag kTagEndpointId      = TLV::ContextTag(0);
+constexpr TLV::Tag kTagClusters        = TLV::ContextTag(1);
+constexpr TLV::Tag kTagClusterId       = TLV::ContextTag(0);
+constexpr TLV::Tag kTagAttributes      = TLV::ContextTag(1);
+constexpr TLV::Tag kTagAttributeId     = TLV::ContextTag(0);
+constexpr TLV::Tag kTagAttributeData   = TLV::ContextTag(1);
+
+// Attribute payloads average a few dozen bytes; size cache buffers from what
+// recent payloads needed instead of allocating a full SDU for each one.
+System::PacketBufferSizeEstimator sAttributeDataSizeEstimator;
+
+} // namespace
+
 CHIP_ERROR AttributeCache::UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus)
 {
     AttributeState state;
@@ -32,12 +52,34 @@ CHIP_ERROR AttributeCache::UpdateCache(const ConcreteDataAttributePath & aPath,
 
     if (apData)
     {
-        handle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+        TLV::TLVReader dataSnapshot;
+        dataSnapshot.Init(*apData);
+
+        handle = System::PacketBufferHandle::New(sAttributeDataSizeEstimator.SuggestedSize(chip::app::kMaxSecureSduLengthBytes));
+        VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
 
         writer.Init(std::move(handle), false);
 
-        ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag, *apData));
+        CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag, *apData);
+        if (err == CHIP_ERROR_NO_MEMORY)
+        {
+            //
+            // The right-sized guess was too small for this payload; retry once
+            // with the worst-case buffer.
+            //
+            sAttributeDataSizeEstimator.ReportUndersized();
+            writer.Reset();
+
+            apData->Init(dataSnapshot);
+            handle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+            VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+            writer.Init(std::move(handle), false);
+            err = writer.CopyElement(TLV::AnonymousTag, *apData);
+        }
+        ReturnErrorOnFailure(err);
         ReturnErrorOnFailure(writer.Finalize(&handle));
+        sAttributeDataSizeEstimator.ReportFinalSize(handle->TotalLength());
 
         //
         // Compact the buffer down to a more reasonably sized packet buffer
@@ -197,6 +239,156 @@ AttributeCache::AttributeState * AttributeCache::GetAttributeState(EndpointId en
     return &attributeState->second;
 }
 
+CHIP_ERROR AttributeCache::SerializeState(TLV::TLVWriter & writer)
+{
+    TLV::TLVType snapshotType, endpointsType;
+
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, snapshotType));
+    ReturnErrorOnFailure(writer.Put(kTagSnapshotVersion, kSnapshotVersion));
+    ReturnErrorOnFailure(writer.StartContainer(kTagEndpoints, TLV::kTLVType_Array, endpointsType));
+
+    for (auto & endpointIter : mCache)
+    {
+        TLV::TLVType endpointType, clustersType;
+
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, endpointType));
+        ReturnErrorOnFailure(writer.Put(kTagEndpointId, endpointIter.first));
+        ReturnErrorOnFailure(writer.StartContainer(kTagClusters, TLV::kTLVType_Array, clustersType));
+
+        for (auto & clusterIter : endpointIter.second)
+        {
+            TLV::TLVType clusterType, attributesType;
+
+            ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, clusterType));
+            ReturnErrorOnFailure(writer.Put(kTagClusterId, clusterIter.first));
+            ReturnErrorOnFailure(writer.StartContainer(kTagAttributes, TLV::kTLVType_Array, attributesType));
+
+            for (auto & attributeIter : clusterIter.second)
+            {
+                //
+                // StatusIB entries are transient; only actual attribute data is persisted.
+                //
+                if (attributeIter.second.Is<StatusIB>())
+                {
+                    continue;
+                }
+
+                TLV::TLVType attributeType;
+                System::PacketBufferTLVReader dataReader;
+
+                dataReader.Init(attributeIter.second.Get<System::PacketBufferHandle>().Retain());
+                ReturnErrorOnFailure(dataReader.Next());
+
+                ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, attributeType));
+                ReturnErrorOnFailure(writer.Put(kTagAttributeId, attributeIter.first));
+                ReturnErrorOnFailure(writer.CopyElement(kTagAttributeData, dataReader));
+                ReturnErrorOnFailure(writer.EndContainer(attributeType));
+            }
+
+            ReturnErrorOnFailure(writer.EndContainer(attributesType));
+            ReturnErrorOnFailure(writer.EndContainer(clusterType));
+        }
+
+        ReturnErrorOnFailure(writer.EndContainer(clustersType));
+        ReturnErrorOnFailure(writer.EndContainer(endpointType));
+    }
+
+    ReturnErrorOnFailure(writer.EndContainer(endpointsType));
+    ReturnErrorOnFailure(writer.EndContainer(snapshotType));
+    return writer.Finalize();
+}
+
+CHIP_ERROR AttributeCache::DeserializeState(TLV::TLVReader & reader)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TLV::TLVType snapshotType, endpointsType;
+    uint8_t version = 0;
+
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag));
+    ReturnErrorOnFailure(reader.EnterContainer(snapshotType));
+
+    ReturnErrorOnFailure(reader.Next(kTagSnapshotVersion));
+    ReturnErrorOnFailure(reader.Get(version));
+    VerifyOrReturnError(version == kSnapshotVersion, CHIP_ERROR_VERSION_MISMATCH);
+
+    mCache.clear();
+
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, kTagEndpoints));
+    ReturnErrorOnFailure(reader.EnterContainer(endpointsType));
+
+    while ((err = reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag)) == CHIP_NO_ERROR)
+    {
+        TLV::TLVType endpointType, clustersType;
+        EndpointId endpointId;
+
+        ReturnErrorOnFailure(reader.EnterContainer(endpointType));
+        ReturnErrorOnFailure(reader.Next(kTagEndpointId));
+        ReturnErrorOnFailure(reader.Get(endpointId));
+
+        ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, kTagClusters));
+        ReturnErrorOnFailure(reader.EnterContainer(clustersType));
+
+        while ((err = reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag)) == CHIP_NO_ERROR)
+        {
+            TLV::TLVType clusterType, attributesType;
+            ClusterId clusterId;
+
+            ReturnErrorOnFailure(reader.EnterContainer(clusterType));
+            ReturnErrorOnFailure(reader.Next(kTagClusterId));
+            ReturnErrorOnFailure(reader.Get(clusterId));
+
+            ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, kTagAttributes));
+            ReturnErrorOnFailure(reader.EnterContainer(attributesType));
+
+            while ((err = reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag)) == CHIP_NO_ERROR)
+            {
+                TLV::TLVType attributeType;
+                AttributeId attributeId;
+                AttributeState state;
+                System::PacketBufferHandle handle;
+                System::PacketBufferTLVWriter writer;
+
+                ReturnErrorOnFailure(reader.EnterContainer(attributeType));
+                ReturnErrorOnFailure(reader.Next(kTagAttributeId));
+                ReturnErrorOnFailure(reader.Get(attributeId));
+
+                ReturnErrorOnFailure(reader.Next(kTagAttributeData));
+
+                //
+                // Re-materialize the attribute data into its own packet buffer, using
+                // the same anonymous-tagged representation UpdateCache() produces.
+                //
+                handle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+                VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+                writer.Init(std::move(handle), false);
+                ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag, reader));
+                ReturnErrorOnFailure(writer.Finalize(&handle));
+                handle.RightSize();
+
+                state.Set<System::PacketBufferHandle>(std::move(handle));
+                mCache[endpointId][clusterId][attributeId] = std::move(state);
+
+                ReturnErrorOnFailure(reader.ExitContainer(attributeType));
+            }
+            VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+            ReturnErrorOnFailure(reader.ExitContainer(attributesType));
+            ReturnErrorOnFailure(reader.ExitContainer(clusterType));
+        }
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+        ReturnErrorOnFailure(reader.ExitContainer(clustersType));
+        ReturnErrorOnFailure(reader.ExitContainer(endpointType));
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    ReturnErrorOnFailure(reader.ExitContainer(endpointsType));
+    ReturnErrorOnFailure(reader.ExitContainer(snapshotType));
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR AttributeCache::GetStatus(const ConcreteAttributePath & path, StatusIB & status)
 {
     CHIP_ERROR err;
@@ -216,6 +216,31 @@ public:
      */
     CHIP_ERROR Get(const ConcreteAttributePath & path, TLV::TLVReader & reader);
 
+    /*
+     * Serialize the current contents of the cache into a versioned binary snapshot,
+     * suitable for stashing in persistent storage and restoring with DeserializeState()
+     * after a restart. The snapshot is written as a single anonymous TLV structure
+     * through the provided writer, which the caller is expected to have initialized
+     * over suitable backing storage; the writer is finalized on success.
+     *
+     * Only attribute data is serialized; StatusIB entries are transient and skipped.
+     */
+    CHIP_ERROR SerializeState(TLV::TLVWriter & writer);
+
+    /*
+     * Replace the contents of the cache with a snapshot previously produced by
+     * SerializeState(). Any existing cached state is discarded, and none of the
+     * OnAttributeChanged/OnClusterChanged/OnEndpointAdded callbacks are invoked
+     * for the restored state.
+     *
+     * Notable return values:
+     *      - CHIP_ERROR_VERSION_MISMATCH shall be returned if the snapshot was produced
+     *        by an incompatible version of this code.
+     *
+     * If any error is returned, the cache may be left partially populated.
+     */
+    CHIP_ERROR DeserializeState(TLV::TLVReader & reader);
+
     /*
      * Execute an iterator function that is called for every attribute
      * in a given endpoint and cluster. The function when invoked is provided a concrete attribute path
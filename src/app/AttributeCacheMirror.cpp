@@ -0,0 +1,404 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/AttributeCacheMirror.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TypeTraits.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <new>
+#include <string.h>
+
+namespace chip {
+namespace app {
+
+size_t AttributeCacheMirror::SlotPitch(uint16_t slotDataSize)
+{
+    size_t pitch = sizeof(Slot) + slotDataSize;
+    return (pitch + alignof(Slot) - 1) & ~(alignof(Slot) - 1);
+}
+
+size_t AttributeCacheMirror::RequiredBufferSize(uint16_t slotCount, uint16_t slotDataSize)
+{
+    return sizeof(Header) + slotCount * SlotPitch(slotDataSize);
+}
+
+CHIP_ERROR AttributeCacheMirror::Init(void * buffer, size_t bufferSize, uint16_t slotCount, uint16_t slotDataSize)
+{
+    VerifyOrReturnError(buffer != nullptr && slotCount > 0 && slotDataSize > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(bufferSize >= RequiredBufferSize(slotCount, slotDataSize), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    memset(buffer, 0, RequiredBufferSize(slotCount, slotDataSize));
+
+    mHeader                  = new (buffer) Header();
+    mHeader->mMagic          = kMagic;
+    mHeader->mLayoutRevision = kLayoutRevision;
+    mHeader->mSlotCount      = slotCount;
+    mHeader->mSlotDataSize   = slotDataSize;
+    mHeader->mSequence.store(0, std::memory_order_relaxed);
+
+    mSlots     = static_cast<uint8_t *>(buffer) + sizeof(Header);
+    mSlotPitch = SlotPitch(slotDataSize);
+    mInUpdate  = false;
+
+    return CHIP_NO_ERROR;
+}
+
+void AttributeCacheMirror::BeginUpdate()
+{
+    VerifyOrReturn(mHeader != nullptr && !mInUpdate);
+
+    // Move the sequence to an odd value: readers treat the slot data as unstable until
+    // EndUpdate() moves it back to an even value.
+    mHeader->mSequence.fetch_add(1, std::memory_order_acq_rel);
+    mInUpdate = true;
+}
+
+void AttributeCacheMirror::EndUpdate()
+{
+    VerifyOrReturn(mHeader != nullptr && mInUpdate);
+
+    mHeader->mSequence.fetch_add(1, std::memory_order_release);
+    mInUpdate = false;
+}
+
+uint32_t AttributeCacheMirror::PackStatus(const StatusIB & status)
+{
+    uint32_t packed = to_underlying(status.mStatus);
+    if (status.mClusterStatus.HasValue())
+    {
+        packed |= 0x10000 | (static_cast<uint32_t>(status.mClusterStatus.Value()) << 8);
+    }
+    return packed;
+}
+
+StatusIB AttributeCacheMirror::UnpackStatus(uint32_t packed)
+{
+    StatusIB status;
+    status.mStatus = static_cast<Protocols::InteractionModel::Status>(packed & 0xFF);
+    if (packed & 0x10000)
+    {
+        status.mClusterStatus.SetValue(static_cast<ClusterStatus>((packed >> 8) & 0xFF));
+    }
+    return status;
+}
+
+AttributeCacheMirror::Slot * AttributeCacheMirror::FindOrAssignSlot(const ConcreteAttributePath & path, CHIP_ERROR & err)
+{
+    Slot * freeSlot = nullptr;
+
+    for (uint16_t i = 0; i < mHeader->mSlotCount; i++)
+    {
+        Slot * slot = reinterpret_cast<Slot *>(mSlots + i * mSlotPitch);
+        if (!(slot->mFlags & kSlotFlagInUse))
+        {
+            if (freeSlot == nullptr)
+            {
+                freeSlot = slot;
+            }
+            continue;
+        }
+        if (slot->mEndpointId == path.mEndpointId && slot->mClusterId == path.mClusterId && slot->mAttributeId == path.mAttributeId)
+        {
+            err = CHIP_NO_ERROR;
+            return slot;
+        }
+    }
+
+    if (freeSlot == nullptr)
+    {
+        err = CHIP_ERROR_NO_MEMORY;
+        return nullptr;
+    }
+
+    freeSlot->mEndpointId  = path.mEndpointId;
+    freeSlot->mClusterId   = path.mClusterId;
+    freeSlot->mAttributeId = path.mAttributeId;
+    freeSlot->mFlags       = kSlotFlagInUse;
+
+    err = CHIP_NO_ERROR;
+    return freeSlot;
+}
+
+CHIP_ERROR AttributeCacheMirror::Publish(const ConcreteAttributePath & path, TLV::TLVReader & data)
+{
+    VerifyOrReturnError(mHeader != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    const bool localUpdate = !mInUpdate;
+    if (localUpdate)
+    {
+        BeginUpdate();
+    }
+
+    Slot * slot = FindOrAssignSlot(path, err);
+    if (slot != nullptr)
+    {
+        TLV::TLVReader dataCopy;
+        dataCopy.Init(data);
+
+        TLV::TLVWriter writer;
+        writer.Init(reinterpret_cast<uint8_t *>(slot + 1), mHeader->mSlotDataSize);
+
+        err = writer.CopyElement(TLV::AnonymousTag, dataCopy);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = writer.Finalize();
+        }
+
+        if (err == CHIP_NO_ERROR)
+        {
+            slot->mDataSize = static_cast<uint16_t>(writer.GetLengthWritten());
+            slot->mFlags    = kSlotFlagInUse;
+        }
+        else
+        {
+            // The slot data was already clobbered, so give the slot up entirely rather than
+            // leaving a stale value behind.
+            slot->mFlags = 0;
+            if (err == CHIP_ERROR_NO_MEMORY)
+            {
+                err = CHIP_ERROR_BUFFER_TOO_SMALL;
+            }
+        }
+    }
+
+    if (localUpdate)
+    {
+        EndUpdate();
+    }
+
+    return err;
+}
+
+CHIP_ERROR AttributeCacheMirror::PublishStatus(const ConcreteAttributePath & path, const StatusIB & status)
+{
+    VerifyOrReturnError(mHeader != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    const bool localUpdate = !mInUpdate;
+    if (localUpdate)
+    {
+        BeginUpdate();
+    }
+
+    Slot * slot = FindOrAssignSlot(path, err);
+    if (slot != nullptr)
+    {
+        slot->mStatus   = PackStatus(status);
+        slot->mDataSize = 0;
+        slot->mFlags    = kSlotFlagInUse | kSlotFlagStatus;
+    }
+
+    if (localUpdate)
+    {
+        EndUpdate();
+    }
+
+    return err;
+}
+
+void AttributeCacheMirror::CacheListener::OnReportBegin(const ReadClient * apReadClient)
+{
+    mMirror.BeginUpdate();
+    mCallback.OnReportBegin(apReadClient);
+}
+
+void AttributeCacheMirror::CacheListener::OnReportEnd(const ReadClient * apReadClient)
+{
+    mMirror.EndUpdate();
+    mCallback.OnReportEnd(apReadClient);
+}
+
+void AttributeCacheMirror::CacheListener::OnAttributeChanged(AttributeCache * cache, const ConcreteAttributePath & path)
+{
+    TLV::TLVReader reader;
+    CHIP_ERROR err = cache->Get(path, reader);
+    if (err == CHIP_ERROR_IM_STATUS_CODE_RECEIVED)
+    {
+        StatusIB status;
+        err = cache->GetStatus(path, status);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = mMirror.PublishStatus(path, status);
+        }
+    }
+    else if (err == CHIP_NO_ERROR)
+    {
+        err = mMirror.Publish(path, reader);
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to mirror attribute value: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    mCallback.OnAttributeChanged(cache, path);
+}
+
+void AttributeCacheMirror::CacheListener::OnClusterChanged(AttributeCache * cache, EndpointId endpointId, ClusterId clusterId)
+{
+    mCallback.OnClusterChanged(cache, endpointId, clusterId);
+}
+
+void AttributeCacheMirror::CacheListener::OnEndpointAdded(AttributeCache * cache, EndpointId endpointId)
+{
+    mCallback.OnEndpointAdded(cache, endpointId);
+}
+
+void AttributeCacheMirror::CacheListener::OnAttributeData(const ReadClient * apReadClient, const ConcreteDataAttributePath & aPath,
+                                                          TLV::TLVReader * apData, const StatusIB & aStatus)
+{
+    mCallback.OnAttributeData(apReadClient, aPath, apData, aStatus);
+}
+
+void AttributeCacheMirror::CacheListener::OnEventData(const ReadClient * apReadClient, const EventHeader & aEventHeader,
+                                                      TLV::TLVReader * apData, const StatusIB * apStatus)
+{
+    mCallback.OnEventData(apReadClient, aEventHeader, apData, apStatus);
+}
+
+void AttributeCacheMirror::CacheListener::OnError(const ReadClient * apReadClient, CHIP_ERROR aError)
+{
+    mCallback.OnError(apReadClient, aError);
+}
+
+void AttributeCacheMirror::CacheListener::OnDone(ReadClient * apReadClient)
+{
+    mCallback.OnDone(apReadClient);
+}
+
+void AttributeCacheMirror::CacheListener::OnSubscriptionEstablished(const ReadClient * apReadClient)
+{
+    mCallback.OnSubscriptionEstablished(apReadClient);
+}
+
+CHIP_ERROR AttributeCacheMirrorReader::Attach(const void * buffer, size_t bufferSize)
+{
+    VerifyOrReturnError(buffer != nullptr && bufferSize >= sizeof(Header), CHIP_ERROR_INVALID_ARGUMENT);
+
+    const Header * header = static_cast<const Header *>(buffer);
+    VerifyOrReturnError(header->mMagic == AttributeCacheMirror::kMagic, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(header->mLayoutRevision == AttributeCacheMirror::kLayoutRevision, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(header->mSlotCount > 0 && header->mSlotDataSize > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(bufferSize >= AttributeCacheMirror::RequiredBufferSize(header->mSlotCount, header->mSlotDataSize),
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    mHeader    = header;
+    mSlots     = static_cast<const uint8_t *>(buffer) + sizeof(Header);
+    mSlotPitch = AttributeCacheMirror::SlotPitch(header->mSlotDataSize);
+
+    return CHIP_NO_ERROR;
+}
+
+bool AttributeCacheMirrorReader::TryGet(const ConcreteAttributePath & path, void * buffer, size_t bufferSize, size_t & size,
+                                        StatusIB * status, CHIP_ERROR & result)
+{
+    const uint32_t seqBefore = mHeader->mSequence.load(std::memory_order_acquire);
+    if (seqBefore & 1)
+    {
+        // A write is in progress.
+        return false;
+    }
+
+    result = CHIP_ERROR_KEY_NOT_FOUND;
+
+    for (uint16_t i = 0; i < mHeader->mSlotCount; i++)
+    {
+        const Slot * slot = reinterpret_cast<const Slot *>(mSlots + i * mSlotPitch);
+        if (!(slot->mFlags & AttributeCacheMirror::kSlotFlagInUse) || slot->mEndpointId != path.mEndpointId ||
+            slot->mClusterId != path.mClusterId || slot->mAttributeId != path.mAttributeId)
+        {
+            continue;
+        }
+
+        if (slot->mFlags & AttributeCacheMirror::kSlotFlagStatus)
+        {
+            if (status == nullptr)
+            {
+                result = CHIP_ERROR_IM_STATUS_CODE_RECEIVED;
+            }
+            else
+            {
+                *status = AttributeCacheMirror::UnpackStatus(slot->mStatus);
+                result  = CHIP_NO_ERROR;
+            }
+        }
+        else if (status != nullptr)
+        {
+            result = CHIP_ERROR_INVALID_ARGUMENT;
+        }
+        else if (slot->mDataSize > mHeader->mSlotDataSize)
+        {
+            // Torn read of the slot while racing the writer; retry.
+            return false;
+        }
+        else if (slot->mDataSize > bufferSize)
+        {
+            result = CHIP_ERROR_BUFFER_TOO_SMALL;
+        }
+        else
+        {
+            memcpy(buffer, slot + 1, slot->mDataSize);
+            size   = slot->mDataSize;
+            result = CHIP_NO_ERROR;
+        }
+        break;
+    }
+
+    // Everything read above is only trustworthy if the writer did not touch the region in
+    // the meantime.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return mHeader->mSequence.load(std::memory_order_relaxed) == seqBefore;
+}
+
+CHIP_ERROR AttributeCacheMirrorReader::Get(const ConcreteAttributePath & path, void * buffer, size_t bufferSize, size_t & size)
+{
+    VerifyOrReturnError(mHeader != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(buffer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    CHIP_ERROR result = CHIP_ERROR_TIMEOUT;
+    for (int retry = 0; retry < kMaxReadRetries; retry++)
+    {
+        if (TryGet(path, buffer, bufferSize, size, nullptr, result))
+        {
+            return result;
+        }
+    }
+    return CHIP_ERROR_TIMEOUT;
+}
+
+CHIP_ERROR AttributeCacheMirrorReader::GetStatus(const ConcreteAttributePath & path, StatusIB & status)
+{
+    VerifyOrReturnError(mHeader != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_ERROR result = CHIP_ERROR_TIMEOUT;
+    size_t size       = 0;
+    for (int retry = 0; retry < kMaxReadRetries; retry++)
+    {
+        if (TryGet(path, nullptr, 0, size, &status, result))
+        {
+            return result;
+        }
+    }
+    return CHIP_ERROR_TIMEOUT;
+}
+
+} // namespace app
+} // namespace chip
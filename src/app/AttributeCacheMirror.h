@@ -0,0 +1,237 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributeCache.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/MessageDef/StatusIB.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPTLV.h>
+
+#include <atomic>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/*
+ * This implements a mirror of attribute cache contents into a flat, position-independent
+ * memory region with a versioned seqlock layout, so that a single subscription owned by one
+ * process can feed any number of reader processes with no additional network or decode cost.
+ *
+ * The mirror deliberately does not create or map the memory region itself: the application is
+ * expected to obtain it (e.g. via shm_open/mmap on POSIX systems) and hand the mapping to the
+ * writer and the readers. This keeps all OS specifics out of the SDK and also allows the layout
+ * to be used over any plain memory when testing.
+ *
+ * Layout and concurrency model:
+ *      - The region starts with a header carrying a magic value, a layout revision and a
+ *        single seqlock sequence counter, followed by a fixed number of equally sized slots.
+ *      - Each slot stores one concrete attribute path together with either the TLV encoding
+ *        of its value or the StatusIB received in its place.
+ *      - There is exactly one writer. The writer increments the sequence counter to an odd
+ *        value before touching slot data and back to an even value afterwards; readers retry
+ *        whenever they observe an odd or changing sequence. All changes from one report are
+ *        published in a single write section, so readers always observe consistent snapshots.
+ *      - Writer and readers must run on the same architecture (same endianness and atomics);
+ *        this holds trivially for processes sharing memory on one host.
+ */
+class AttributeCacheMirror
+{
+public:
+    /*
+     * Computes the region size required for a given slot configuration, for use when the
+     * application creates the shared memory region.
+     */
+    static size_t RequiredBufferSize(uint16_t slotCount, uint16_t slotDataSize);
+
+    /*
+     * Formats the provided region and prepares this object for publishing into it.
+     *
+     * slotCount bounds the number of distinct attribute paths that can be mirrored and
+     * slotDataSize bounds the TLV encoding size of a single attribute value. Values whose
+     * encoding does not fit are skipped with CHIP_ERROR_BUFFER_TOO_SMALL from Publish().
+     *
+     * Notable return values:
+     *      - CHIP_ERROR_BUFFER_TOO_SMALL if the region is smaller than RequiredBufferSize().
+     */
+    CHIP_ERROR Init(void * buffer, size_t bufferSize, uint16_t slotCount, uint16_t slotDataSize);
+
+    /*
+     * Opens a seqlock write section. Publish() calls made before the matching EndUpdate()
+     * become visible to readers atomically as one snapshot. Update sections do not nest.
+     */
+    void BeginUpdate();
+    void EndUpdate();
+
+    /*
+     * Publishes the TLV encoding of an attribute value. The reader is expected to be
+     * positioned on the value element. May be called outside of an update section, in which
+     * case a section is opened for this single value.
+     *
+     * Notable return values:
+     *      - CHIP_ERROR_NO_MEMORY if all slots are taken by other paths.
+     *      - CHIP_ERROR_BUFFER_TOO_SMALL if the encoding does not fit a slot.
+     */
+    CHIP_ERROR Publish(const ConcreteAttributePath & path, TLV::TLVReader & data);
+
+    /*
+     * Publishes a StatusIB received in place of attribute data.
+     */
+    CHIP_ERROR PublishStatus(const ConcreteAttributePath & path, const StatusIB & status);
+
+    /*
+     * An AttributeCache::Callback adapter that mirrors every cache change into the region and
+     * forwards all calls to an inner callback, mirroring the callback-chaining style used by
+     * BufferedReadCallback. A whole report is published as one seqlock write section.
+     */
+    class CacheListener : public AttributeCache::Callback
+    {
+    public:
+        CacheListener(AttributeCacheMirror & mirror, AttributeCache::Callback & callback) : mMirror(mirror), mCallback(callback) {}
+
+    private:
+        void OnReportBegin(const ReadClient * apReadClient) override;
+        void OnReportEnd(const ReadClient * apReadClient) override;
+        void OnAttributeChanged(AttributeCache * cache, const ConcreteAttributePath & path) override;
+        void OnClusterChanged(AttributeCache * cache, EndpointId endpointId, ClusterId clusterId) override;
+        void OnEndpointAdded(AttributeCache * cache, EndpointId endpointId) override;
+        void OnAttributeData(const ReadClient * apReadClient, const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                             const StatusIB & aStatus) override;
+        void OnEventData(const ReadClient * apReadClient, const EventHeader & aEventHeader, TLV::TLVReader * apData,
+                         const StatusIB * apStatus) override;
+        void OnError(const ReadClient * apReadClient, CHIP_ERROR aError) override;
+        void OnDone(ReadClient * apReadClient) override;
+        void OnSubscriptionEstablished(const ReadClient * apReadClient) override;
+
+        AttributeCacheMirror & mMirror;
+        AttributeCache::Callback & mCallback;
+    };
+
+private:
+    friend class AttributeCacheMirrorReader;
+
+    static constexpr uint32_t kMagic          = 0x4d435243; // 'MCRC', mirrored cache region
+    static constexpr uint16_t kLayoutRevision = 1;
+
+    static constexpr uint8_t kSlotFlagInUse  = 0x01;
+    static constexpr uint8_t kSlotFlagStatus = 0x02;
+
+    struct Header
+    {
+        uint32_t mMagic;
+        uint16_t mLayoutRevision;
+        uint16_t mSlotCount;
+        uint16_t mSlotDataSize;
+        uint16_t mReserved;
+        std::atomic<uint32_t> mSequence;
+    };
+
+    struct Slot
+    {
+        ClusterId mClusterId;
+        AttributeId mAttributeId;
+        uint32_t mStatus; // packed StatusIB, valid when kSlotFlagStatus is set
+        EndpointId mEndpointId;
+        uint8_t mFlags;
+        uint8_t mReserved;
+        uint16_t mDataSize;
+        uint16_t mReserved2;
+        // Followed by mSlotDataSize bytes of TLV data.
+    };
+
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Sequence counter must be usable in shared memory");
+
+    // Per-slot stride: sizeof(Slot) plus the data area, rounded up so every slot stays aligned.
+    static size_t SlotPitch(uint16_t slotDataSize);
+
+    static uint32_t PackStatus(const StatusIB & status);
+    static StatusIB UnpackStatus(uint32_t packed);
+
+    /*
+     * Returns the slot assigned to the path, assigning a free slot on first publication, or
+     * nullptr with err set to CHIP_ERROR_NO_MEMORY if all slots are taken.
+     */
+    Slot * FindOrAssignSlot(const ConcreteAttributePath & path, CHIP_ERROR & err);
+
+    Header * mHeader  = nullptr;
+    uint8_t * mSlots  = nullptr;
+    size_t mSlotPitch = 0; // sizeof(Slot) plus the per-slot data area
+    bool mInUpdate    = false;
+};
+
+/*
+ * Read side of the mirror, intended for use in processes that do not own the subscription.
+ * Attach() validates the layout and Get() copies values out under the seqlock so that torn
+ * reads are never surfaced.
+ */
+class AttributeCacheMirrorReader
+{
+public:
+    /*
+     * Attaches to a region previously formatted by AttributeCacheMirror::Init().
+     *
+     * Notable return values:
+     *      - CHIP_ERROR_INVALID_ARGUMENT if the region does not carry the expected magic
+     *        value or layout revision, or is inconsistent with its own slot configuration.
+     */
+    CHIP_ERROR Attach(const void * buffer, size_t bufferSize);
+
+    /*
+     * Copies the TLV encoding of an attribute value into the provided buffer and updates
+     * size to the number of bytes copied. The copy can be handed to TLV::TLVReader::Init().
+     *
+     * Notable return values:
+     *      - CHIP_ERROR_KEY_NOT_FOUND if the path has not been mirrored.
+     *      - CHIP_ERROR_IM_STATUS_CODE_RECEIVED if a StatusIB was mirrored in place of data;
+     *        it can be retrieved with GetStatus().
+     *      - CHIP_ERROR_BUFFER_TOO_SMALL if the value does not fit the provided buffer.
+     *      - CHIP_ERROR_TIMEOUT if the writer kept invalidating the read; callers may retry.
+     */
+    CHIP_ERROR Get(const ConcreteAttributePath & path, void * buffer, size_t bufferSize, size_t & size);
+
+    /*
+     * Retrieves the StatusIB mirrored for the given path, if one is present in place of data.
+     *
+     * Notable return values mirror those of Get(), with CHIP_ERROR_INVALID_ARGUMENT returned
+     * when data rather than a status is present.
+     */
+    CHIP_ERROR GetStatus(const ConcreteAttributePath & path, StatusIB & status);
+
+private:
+    using Header = AttributeCacheMirror::Header;
+    using Slot   = AttributeCacheMirror::Slot;
+
+    // Bounds how often a read retries while racing the writer before giving up.
+    static constexpr int kMaxReadRetries = 8;
+
+    /*
+     * Runs one seqlock-protected lookup attempt. Returns false if the writer raced the read
+     * and the attempt must be retried; result carries the outcome otherwise.
+     */
+    bool TryGet(const ConcreteAttributePath & path, void * buffer, size_t bufferSize, size_t & size, StatusIB * status,
+                CHIP_ERROR & result);
+
+    const Header * mHeader = nullptr;
+    const uint8_t * mSlots = nullptr;
+    size_t mSlotPitch      = 0;
+};
+
+} // namespace app
+} // namespace chip
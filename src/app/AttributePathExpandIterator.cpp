@@ -47,18 +47,163 @@ extern Optional<ClusterId> emberAfGetNthClusterId(chip::EndpointId endpoint, uin
 extern Optional<AttributeId> emberAfGetServerAttributeIdByIndex(chip::EndpointId endpoint, chip::ClusterId cluster,
                                                                 uint16_t attributeIndex);
 extern uint8_t emberAfClusterIndex(EndpointId endpoint, ClusterId clusterId, EmberAfClusterMask mask);
+extern uint32_t emberAfMetadataStructureGeneration(void);
 
 namespace chip {
 namespace app {
 
+#if CHIP_IM_ATTRIBUTE_PATH_EXPANSION_CACHE_ENTRIES > 0
+namespace {
+
+static_assert(CHIP_IM_ATTRIBUTE_PATH_EXPANSION_CACHE_PATHS_PER_ENTRY < UINT16_MAX,
+              "Cached path indices are tracked in uint16_t");
+
+// Cached expansion of a single wildcard attribute path.  Entries are keyed by the path's id
+// fields (wildcards are encoded as kInvalid* sentinel values, so comparing the raw values is
+// sufficient) rather than by ClusterInfo pointer, so a recycled ClusterInfo pool slot cannot
+// alias a stale entry.  An entry remains valid until the ember metadata generation changes,
+// e.g. when a dynamic endpoint is added or removed.
+struct ExpansionCacheEntry
+{
+    EndpointId mEndpointId;
+    ClusterId mClusterId;
+    AttributeId mAttributeId;
+    uint32_t mGeneration;
+    uint32_t mLastUse; // 0 = unused
+    uint16_t mNumPaths;
+    bool mOverflowed; // The expansion did not fit in mPaths; remembered so we do not retry every pass.
+    struct
+    {
+        EndpointId mEndpointId;
+        ClusterId mClusterId;
+        AttributeId mAttributeId;
+    } mPaths[CHIP_IM_ATTRIBUTE_PATH_EXPANSION_CACHE_PATHS_PER_ENTRY];
+};
+
+ExpansionCacheEntry gExpansionCache[CHIP_IM_ATTRIBUTE_PATH_EXPANSION_CACHE_ENTRIES];
+uint32_t gExpansionCacheUseCounter = 0;
+
+ExpansionCacheEntry * FindExpansionCacheEntry(const ClusterInfo & aClusterInfo)
+{
+    uint32_t generation = emberAfMetadataStructureGeneration();
+    for (auto & entry : gExpansionCache)
+    {
+        if (entry.mLastUse != 0 && entry.mGeneration == generation && entry.mEndpointId == aClusterInfo.mEndpointId &&
+            entry.mClusterId == aClusterInfo.mClusterId && entry.mAttributeId == aClusterInfo.mAttributeId)
+        {
+            entry.mLastUse = ++gExpansionCacheUseCounter;
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Expands aClusterInfo into aEntry, mirroring the expansion order of
+ * AttributePathExpandIterator::AdvanceOutputPath exactly so that cached replay and live
+ * expansion are interchangeable.  Sets mOverflowed if the expansion does not fit.
+ */
+void FillExpansionCacheEntry(const ClusterInfo & aClusterInfo, ExpansionCacheEntry & aEntry)
+{
+    aEntry.mEndpointId  = aClusterInfo.mEndpointId;
+    aEntry.mClusterId   = aClusterInfo.mClusterId;
+    aEntry.mAttributeId = aClusterInfo.mAttributeId;
+    aEntry.mGeneration  = emberAfMetadataStructureGeneration();
+    aEntry.mLastUse     = ++gExpansionCacheUseCounter;
+    aEntry.mNumPaths    = 0;
+    aEntry.mOverflowed  = false;
+
+    uint16_t endpointIndex, endEndpointIndex;
+    if (aClusterInfo.HasWildcardEndpointId())
+    {
+        endpointIndex    = 0;
+        endEndpointIndex = emberAfEndpointCount();
+    }
+    else
+    {
+        endpointIndex    = emberAfIndexFromEndpoint(aClusterInfo.mEndpointId);
+        endEndpointIndex = static_cast<uint16_t>(endpointIndex + 1);
+    }
+
+    for (; endpointIndex < endEndpointIndex; endpointIndex++)
+    {
+        EndpointId endpointId = emberAfEndpointFromIndex(endpointIndex);
+
+        uint8_t clusterIndex, endClusterIndex;
+        if (aClusterInfo.HasWildcardClusterId())
+        {
+            clusterIndex    = 0;
+            endClusterIndex = emberAfClusterCount(endpointId, true /* server */);
+        }
+        else
+        {
+            clusterIndex    = emberAfClusterIndex(endpointId, aClusterInfo.mClusterId, CLUSTER_MASK_SERVER);
+            endClusterIndex = static_cast<uint8_t>(clusterIndex + 1);
+        }
+
+        for (; clusterIndex < endClusterIndex; clusterIndex++)
+        {
+            ClusterId clusterId = emberAfGetNthClusterId(endpointId, clusterIndex, true /* server */).Value();
+
+            uint16_t attributeIndex, endAttributeIndex;
+            if (aClusterInfo.HasWildcardAttributeId())
+            {
+                attributeIndex    = 0;
+                endAttributeIndex = emberAfGetServerAttributeCount(endpointId, clusterId);
+            }
+            else
+            {
+                attributeIndex    = emberAfGetServerAttributeIndexByAttributeId(endpointId, clusterId, aClusterInfo.mAttributeId);
+                endAttributeIndex = static_cast<uint16_t>(attributeIndex + 1);
+            }
+
+            for (; attributeIndex < endAttributeIndex; attributeIndex++)
+            {
+                if (aEntry.mNumPaths >= CHIP_IM_ATTRIBUTE_PATH_EXPANSION_CACHE_PATHS_PER_ENTRY)
+                {
+                    aEntry.mOverflowed = true;
+                    return;
+                }
+                auto & path       = aEntry.mPaths[aEntry.mNumPaths++];
+                path.mEndpointId  = endpointId;
+                path.mClusterId   = clusterId;
+                path.mAttributeId = emberAfGetServerAttributeIdByIndex(endpointId, clusterId, attributeIndex).Value();
+            }
+        }
+    }
+}
+
+ExpansionCacheEntry * FindOrFillExpansionCacheEntry(const ClusterInfo & aClusterInfo)
+{
+    ExpansionCacheEntry * entry = FindExpansionCacheEntry(aClusterInfo);
+    if (entry == nullptr)
+    {
+        // Evict the least recently used entry.
+        entry = &gExpansionCache[0];
+        for (auto & candidate : gExpansionCache)
+        {
+            if (candidate.mLastUse < entry->mLastUse)
+            {
+                entry = &candidate;
+            }
+        }
+        FillExpansionCacheEntry(aClusterInfo, *entry);
+    }
+    return entry;
+}
+
+} // anonymous namespace
+#endif // CHIP_IM_ATTRIBUTE_PATH_EXPANSION_CACHE_ENTRIES > 0
+
 AttributePathExpandIterator::AttributePathExpandIterator(ClusterInfo * aClusterInfo)
 {
     mpClusterInfo = aClusterInfo;
 
     // Reset iterator state
-    mEndpointIndex  = UINT16_MAX;
-    mClusterIndex   = UINT8_MAX;
-    mAttributeIndex = UINT16_MAX;
+    mEndpointIndex   = UINT16_MAX;
+    mClusterIndex    = UINT8_MAX;
+    mAttributeIndex  = UINT16_MAX;
+    mCachedPathIndex = UINT16_MAX;
 
     // Make the iterator ready to emit the first valid path in the list.
     Next();
@@ -113,9 +258,52 @@ void AttributePathExpandIterator::PrepareAttributeIndexRange(const ClusterInfo &
     }
 }
 
+bool AttributePathExpandIterator::AdvanceOutputPath()
+{
+    for (; mEndpointIndex < mEndEndpointIndex; (mEndpointIndex++, mClusterIndex = UINT8_MAX, mAttributeIndex = UINT16_MAX))
+    {
+        EndpointId endpointId = emberAfEndpointFromIndex(mEndpointIndex);
+
+        if (mClusterIndex == UINT8_MAX)
+        {
+            PrepareClusterIndexRange(*mpClusterInfo, endpointId);
+            mAttributeIndex = UINT16_MAX;
+        }
+
+        for (; mClusterIndex < mEndClusterIndex; (mClusterIndex++, mAttributeIndex = UINT16_MAX))
+        {
+            // emberAfGetNthClusterId must return a valid cluster id here since we have verified the mClusterIndex does
+            // not exceed the mEndClusterIndex.
+            ClusterId clusterId = emberAfGetNthClusterId(endpointId, mClusterIndex, true /* server */).Value();
+            if (mAttributeIndex == UINT16_MAX)
+            {
+                PrepareAttributeIndexRange(*mpClusterInfo, endpointId, clusterId);
+            }
+
+            if (mAttributeIndex < mEndAttributeIndex)
+            {
+                // GetServerAttributeIdByIdex must return a valid attribute here since we have verified the mAttributeIndex does
+                // not exceed the mEndAttributeIndex.
+                mOutputPath.mAttributeId = emberAfGetServerAttributeIdByIndex(endpointId, clusterId, mAttributeIndex).Value();
+                mOutputPath.mClusterId   = clusterId;
+                mOutputPath.mEndpointId  = endpointId;
+                mAttributeIndex++;
+                // We found a valid attribute path, now return and increase the attribute index for next iteration.
+                // Return true will skip the increment of mClusterIndex and mEndpointIndex.
+                return true;
+            }
+            // We have exhausted all attributes of this cluster, continue iterating over attributes of next cluster.
+        }
+        // We have exhausted all clusters of this endpoint, continue iterating over clusters of next endpoint.
+    }
+    // We have exhausted all endpoints in this cluster info.
+    return false;
+}
+
 bool AttributePathExpandIterator::Next()
 {
-    for (; mpClusterInfo != nullptr; (mpClusterInfo = mpClusterInfo->mpNext, mEndpointIndex = UINT16_MAX))
+    for (; mpClusterInfo != nullptr;
+         (mpClusterInfo = mpClusterInfo->mpNext, mEndpointIndex = UINT16_MAX, mCachedPathIndex = UINT16_MAX))
     {
         mOutputPath.mExpanded = mpClusterInfo->HasAttributeWildcard();
 
@@ -133,45 +321,59 @@ bool AttributePathExpandIterator::Next()
                 return true;
             }
 
-            PrepareEndpointIndexRange(*mpClusterInfo);
-            mClusterIndex = UINT8_MAX;
-        }
-
-        for (; mEndpointIndex < mEndEndpointIndex; (mEndpointIndex++, mClusterIndex = UINT8_MAX, mAttributeIndex = UINT16_MAX))
-        {
-            EndpointId endpointId = emberAfEndpointFromIndex(mEndpointIndex);
-
-            if (mClusterIndex == UINT8_MAX)
+#if CHIP_IM_ATTRIBUTE_PATH_EXPANSION_CACHE_ENTRIES > 0
+            ExpansionCacheEntry * entry = FindOrFillExpansionCacheEntry(*mpClusterInfo);
+            if (!entry->mOverflowed)
             {
-                PrepareClusterIndexRange(*mpClusterInfo, endpointId);
-                mAttributeIndex = UINT16_MAX;
+                // Replay the cached expansion instead of expanding live; park the live index
+                // ranges past-the-end so reentry skips straight to the replay below.
+                mCachedPathIndex = 0;
+                mEndpointIndex = mEndEndpointIndex = 0;
             }
-
-            for (; mClusterIndex < mEndClusterIndex; (mClusterIndex++, mAttributeIndex = UINT16_MAX))
+            else
+#endif // CHIP_IM_ATTRIBUTE_PATH_EXPANSION_CACHE_ENTRIES > 0
             {
-                // emberAfGetNthClusterId must return a valid cluster id here since we have verified the mClusterIndex does
-                // not exceed the mEndClusterIndex.
-                ClusterId clusterId = emberAfGetNthClusterId(endpointId, mClusterIndex, true /* server */).Value();
-                if (mAttributeIndex == UINT16_MAX)
-                {
-                    PrepareAttributeIndexRange(*mpClusterInfo, endpointId, clusterId);
-                }
+                PrepareEndpointIndexRange(*mpClusterInfo);
+                mClusterIndex = UINT8_MAX;
+            }
+        }
 
-                if (mAttributeIndex < mEndAttributeIndex)
+#if CHIP_IM_ATTRIBUTE_PATH_EXPANSION_CACHE_ENTRIES > 0
+        if (mCachedPathIndex != UINT16_MAX)
+        {
+            const ExpansionCacheEntry * entry = FindExpansionCacheEntry(*mpClusterInfo);
+            if (entry != nullptr)
+            {
+                if (mCachedPathIndex < entry->mNumPaths)
                 {
-                    // GetServerAttributeIdByIdex must return a valid attribute here since we have verified the mAttributeIndex does
-                    // not exceed the mEndAttributeIndex.
-                    mOutputPath.mAttributeId = emberAfGetServerAttributeIdByIndex(endpointId, clusterId, mAttributeIndex).Value();
-                    mOutputPath.mClusterId   = clusterId;
-                    mOutputPath.mEndpointId  = endpointId;
-                    mAttributeIndex++;
-                    // We found a valid attribute path, now return and increase the attribute index for next iteration.
-                    // Return true will skip the increment of mClusterIndex, mEndpointIndex and mpClusterInfo.
+                    const auto & path        = entry->mPaths[mCachedPathIndex];
+                    mOutputPath.mEndpointId  = path.mEndpointId;
+                    mOutputPath.mClusterId   = path.mClusterId;
+                    mOutputPath.mAttributeId = path.mAttributeId;
+                    mCachedPathIndex++;
                     return true;
                 }
-                // We have exhausted all attributes of this cluster, continue iterating over attributes of next cluster.
+                // The cached expansion is exhausted, continue iterating over next cluster info item.
+                continue;
             }
-            // We have exhausted all clusters of this endpoint, continue iterating over clusters of next endpoint.
+            // The entry was evicted (or the metadata changed) part way through the replay: fall
+            // back to live expansion, skipping the paths that were already emitted.  Note that a
+            // metadata change invalidates this iterator regardless of caching, see the class
+            // documentation.
+            uint16_t pathsEmitted = mCachedPathIndex;
+            mCachedPathIndex      = UINT16_MAX;
+            PrepareEndpointIndexRange(*mpClusterInfo);
+            mClusterIndex   = UINT8_MAX;
+            mAttributeIndex = UINT16_MAX;
+            while (pathsEmitted-- > 0 && AdvanceOutputPath())
+            {
+            }
+        }
+#endif // CHIP_IM_ATTRIBUTE_PATH_EXPANSION_CACHE_ENTRIES > 0
+
+        if (AdvanceOutputPath())
+        {
+            return true;
         }
         // We have exhausted all endpoints in this cluster info, continue iterating over next cluster info item.
     }
@@ -102,9 +102,20 @@ private:
     // Note: should use decltype(EmberAfEndpointType::clusterCount) here, but af-types is including app specific generated files.
     uint8_t mClusterIndex, mEndClusterIndex;
     uint16_t mAttributeIndex, mEndAttributeIndex;
+    // Position within the cached expansion of the current ClusterInfo, or UINT16_MAX when the current ClusterInfo is not being
+    // replayed from the expansion cache.  Only used when CHIP_IM_ATTRIBUTE_PATH_EXPANSION_CACHE_ENTRIES is non-zero.
+    uint16_t mCachedPathIndex;
 
     ConcreteAttributePath mOutputPath;
 
+    /**
+     * Advance mOutputPath to the next concrete path produced by expanding the current cluster info, driving the
+     * endpoint/cluster/attribute index ranges set up by Prepare*IndexRange.
+     *
+     * Returns false if the current cluster info is exhausted.
+     */
+    bool AdvanceOutputPath();
+
     /**
      * Prepare*IndexRange will update mBegin*Index and mEnd*Index variables.
      * If ClusterInfo contains a wildcard field, it will set mBegin*Index to 0 and mEnd*Index to count.
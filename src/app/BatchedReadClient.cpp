@@ -0,0 +1,110 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/BatchedReadClient.h>
+#include <app/InteractionModelEngine.h>
+
+namespace chip {
+namespace app {
+
+CHIP_ERROR BatchedReadClient::SendBatchedRead(const SessionHandle & sessionHandle, AttributePathParams * apAttributePaths,
+                                              size_t aPathCount, Callback * apCallback, System::Clock::Timeout aTimeout)
+{
+    VerifyOrReturnError(!IsBusy(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(apAttributePaths != nullptr && aPathCount > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(apCallback != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mSessionHandle.SetValue(sessionHandle);
+    mpAttributePaths = apAttributePaths;
+    mPathCount       = aPathCount;
+    mNextPathIndex   = 0;
+    mBatchError      = CHIP_NO_ERROR;
+    mTimeout         = aTimeout;
+    mpCallback       = apCallback;
+
+    CHIP_ERROR err = SendNextChunk();
+    if (err != CHIP_NO_ERROR)
+    {
+        mpCallback = nullptr;
+        mSessionHandle.ClearValue();
+    }
+    return err;
+}
+
+CHIP_ERROR BatchedReadClient::SendNextChunk()
+{
+    const size_t remaining = mPathCount - mNextPathIndex;
+    const size_t chunkSize = (remaining > kMaxPathsPerReadRequest) ? kMaxPathsPerReadRequest : remaining;
+
+    ReadPrepareParams readParams(mSessionHandle.Value());
+    readParams.mpAttributePathParamsList    = mpAttributePaths + mNextPathIndex;
+    readParams.mAttributePathParamsListSize = chunkSize;
+    readParams.mTimeout                     = mTimeout;
+
+    // The path list is encoded into the request synchronously, so handing out pointers into
+    // the caller's list is safe even though ReadPrepareParams does not own it.
+    ReturnErrorOnFailure(InteractionModelEngine::GetInstance()->SendReadRequest(readParams, this));
+    mNextPathIndex += chunkSize;
+    return CHIP_NO_ERROR;
+}
+
+void BatchedReadClient::OnAttributeData(const ReadClient * apReadClient, const ConcreteDataAttributePath & aPath,
+                                        TLV::TLVReader * apData, const StatusIB & aStatus)
+{
+    mpCallback->OnAttributeData(aPath, apData, aStatus);
+}
+
+void BatchedReadClient::OnError(const ReadClient * apReadClient, CHIP_ERROR aError)
+{
+    if (mBatchError == CHIP_NO_ERROR)
+    {
+        mBatchError = aError;
+    }
+}
+
+void BatchedReadClient::OnDone(ReadClient * apReadClient)
+{
+    if (mNextPathIndex < mPathCount)
+    {
+        CHIP_ERROR err = SendNextChunk();
+        if (err == CHIP_NO_ERROR)
+        {
+            return;
+        }
+        if (mBatchError == CHIP_NO_ERROR)
+        {
+            mBatchError = err;
+        }
+    }
+
+    Callback * callback   = mpCallback;
+    CHIP_ERROR batchError = mBatchError;
+
+    // Reset before notifying so the callback is free to start another batch immediately.
+    mpCallback       = nullptr;
+    mpAttributePaths = nullptr;
+    mPathCount       = 0;
+    mNextPathIndex   = 0;
+    mBatchError      = CHIP_NO_ERROR;
+    mSessionHandle.ClearValue();
+
+    callback->OnBatchDone(batchError);
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,110 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/ReadClient.h>
+#include <lib/core/Optional.h>
+
+namespace chip {
+namespace app {
+
+/*
+ * This is a facade over ReadClient for reading a large set of attribute paths from a single
+ * peer. Instead of issuing one Read Interaction per path - each paying exchange setup and a
+ * full ReportData round trip - the paths are packed into as few ReadRequests as will hold
+ * them, issued one interaction at a time. Attribute data is still delivered per concrete
+ * path as it arrives, and a single completion callback fires once every path has been
+ * serviced.
+ *
+ * The caller-provided path list must stay alive until OnBatchDone is delivered, since later
+ * chunks are encoded from it lazily as earlier interactions complete.
+ */
+class BatchedReadClient : public ReadClient::Callback
+{
+public:
+    class Callback
+    {
+    public:
+        virtual ~Callback() = default;
+
+        /**
+         * Delivers attribute data (or an attribute-specific status) for one concrete path in
+         * the batch, with the same semantics as ReadClient::Callback::OnAttributeData.
+         */
+        virtual void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) {}
+
+        /**
+         * Called exactly once per successful call to SendBatchedRead, after the last
+         * interaction of the batch has completed.
+         *
+         * @param[in] aError  CHIP_NO_ERROR if every interaction completed, otherwise the
+         *                    first error encountered. Later chunks are still attempted after
+         *                    an error so one failed interaction does not discard the rest of
+         *                    the batch.
+         */
+        virtual void OnBatchDone(CHIP_ERROR aError) = 0;
+    };
+
+    /**
+     * The maximum number of attribute paths packed into a single ReadRequest. Each encoded
+     * AttributePathIB costs on the order of 20 bytes of TLV, so this keeps the request
+     * comfortably within a single secure message while still amortizing the per-interaction
+     * overhead across many paths.
+     */
+    static constexpr size_t kMaxPathsPerReadRequest = 30;
+
+    /**
+     * Start reading the given attribute paths from the peer on the given session. Only one
+     * batch can be outstanding on a given BatchedReadClient at a time.
+     *
+     * @retval #CHIP_ERROR_INCORRECT_STATE  if a batch is already in progress.
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT if the path list is empty.
+     * @retval #CHIP_NO_ERROR               on success; OnBatchDone will be called.
+     */
+    CHIP_ERROR SendBatchedRead(const SessionHandle & sessionHandle, AttributePathParams * apAttributePaths, size_t aPathCount,
+                               Callback * apCallback, System::Clock::Timeout aTimeout = kImMessageTimeout);
+
+    bool IsBusy() const { return mpCallback != nullptr; }
+
+private:
+    //
+    // ReadClient::Callback
+    //
+    void OnAttributeData(const ReadClient * apReadClient, const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                         const StatusIB & aStatus) override;
+    void OnError(const ReadClient * apReadClient, CHIP_ERROR aError) override;
+    void OnDone(ReadClient * apReadClient) override;
+
+    /*
+     * Issue a single ReadRequest carrying the next (at most kMaxPathsPerReadRequest) paths.
+     */
+    CHIP_ERROR SendNextChunk();
+
+    Optional<SessionHandle> mSessionHandle;
+    AttributePathParams * mpAttributePaths = nullptr;
+    size_t mPathCount                      = 0;
+    size_t mNextPathIndex                  = 0;
+    Callback * mpCallback                  = nullptr;
+    CHIP_ERROR mBatchError                 = CHIP_NO_ERROR;
+    System::Clock::Timeout mTimeout        = kImMessageTimeout;
+};
+
+} // namespace app
+} // namespace chip
@@ -43,8 +43,17 @@ CHIP_ERROR CASEClient::EstablishSession(PeerId peer, const Transport::PeerAddres
     uint16_t keyID = 0;
     ReturnErrorOnFailure(mInitParams.idAllocator->Allocate(keyID));
 
+    // If we have cached state from a previous session with this peer, request resumption.
+    CASESessionCachable cachedSession;
+    const CASESessionCachable * previousSession = nullptr;
+    if (mInitParams.sessionResumptionCache != nullptr &&
+        mInitParams.sessionResumptionCache->Get(peer, cachedSession) == CHIP_NO_ERROR)
+    {
+        previousSession = &cachedSession;
+    }
+
     ReturnErrorOnFailure(mCASESession.EstablishSession(peerAddress, mInitParams.fabricInfo, peer.GetNodeId(), keyID, exchange, this,
-                                                       mInitParams.mrpLocalConfig));
+                                                       mInitParams.mrpLocalConfig, previousSession));
     mConnectionSuccessCallback = onConnection;
     mConnectionFailureCallback = onFailure;
     mConectionContext          = context;
@@ -66,6 +75,17 @@ void CASEClient::OnSessionEstablishmentError(CHIP_ERROR error)
 
 void CASEClient::OnSessionEstablished()
 {
+    // Cache the established state so later reconnects to this peer can resume the
+    // session rather than perform a full handshake.
+    if (mInitParams.sessionResumptionCache != nullptr)
+    {
+        CASESessionCachable cachableSession;
+        if (mCASESession.ToCachable(cachableSession) == CHIP_NO_ERROR)
+        {
+            mInitParams.sessionResumptionCache->Add(cachableSession);
+        }
+    }
+
     // On successfull CASE connection, the local session ID will be used for the derived secure session.
     if (mConnectionSuccessCallback)
     {
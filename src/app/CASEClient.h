@@ -20,6 +20,7 @@
 #include <messaging/ExchangeMgr.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <protocols/secure_channel/CASESession.h>
+#include <protocols/secure_channel/CASESessionCache.h>
 #include <protocols/secure_channel/SessionIDAllocator.h>
 
 namespace chip {
@@ -36,6 +37,10 @@ struct CASEClientInitParams
     SessionIDAllocator * idAllocator         = nullptr;
     FabricInfo * fabricInfo                  = nullptr;
 
+    // Optional cache of previously established CASE session state, used to request
+    // session resumption instead of a full sigma handshake when reconnecting.
+    CASESessionCache * sessionResumptionCache = nullptr;
+
     Optional<ReliableMessageProtocolConfig> mrpLocalConfig = Optional<ReliableMessageProtocolConfig>::Missing();
 };
 
@@ -28,6 +28,17 @@ CHIP_ERROR CASESessionManager::FindOrEstablishSession(PeerId peerId, Callback::C
 
     bool nodeIDWasResolved = (mConfig.dnsCache != nullptr && mConfig.dnsCache->Lookup(peerId, resolutionData) == CHIP_NO_ERROR);
 
+    // On an in-memory cache miss (e.g. right after a restart), fall back to the
+    // persisted last-known-good address so connection establishment can start
+    // immediately; a stale entry is revalidated via DNS-SD in the background
+    // and any fresh resolution updates the in-flight session's address.
+    bool addressIsStale = false;
+    if (!nodeIDWasResolved && mConfig.persistedAddressCache != nullptr &&
+        mConfig.persistedAddressCache->Lookup(peerId, resolutionData, addressIsStale) == CHIP_NO_ERROR)
+    {
+        nodeIDWasResolved = true;
+    }
+
     OperationalDeviceProxy * session = FindExistingSession(peerId);
     if (session == nullptr)
     {
@@ -57,6 +68,10 @@ CHIP_ERROR CASESessionManager::FindOrEstablishSession(PeerId peerId, Callback::C
     {
         ReleaseSession(session);
     }
+    else if (addressIsStale)
+    {
+        LogErrorOnFailure(mConfig.dnsResolver->ResolveNodeId(peerId, Inet::IPAddressType::kAny, Dnssd::Resolver::CacheBypass::On));
+    }
 
     return err;
 }
@@ -66,6 +81,194 @@ void CASESessionManager::ReleaseSession(PeerId peerId)
     ReleaseSession(FindExistingSession(peerId));
 }
 
+CHIP_ERROR CASESessionManager::SetWarmPeerSet(const PeerId * peers, size_t count)
+{
+    VerifyOrReturnError(count == 0 || peers != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(count <= kWarmPoolMaxPeers, CHIP_ERROR_NO_MEMORY);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        mWarmPeers[i] = peers[i];
+    }
+    mWarmPeerCount     = count;
+    mWarmPoolNextIndex = 0;
+
+    // Kick off the first establishment right away; the rest are staggered by the
+    // maintenance timer. An already-armed timer picks up the new set on its next tick.
+    if (!mWarmPoolTimerArmed)
+    {
+        RunWarmPoolMaintenance();
+    }
+    return CHIP_NO_ERROR;
+}
+
+void CASESessionManager::ClearWarmPeerSet()
+{
+    mWarmPeerCount = 0;
+    if (mWarmPoolTimerArmed)
+    {
+        DeviceLayer::SystemLayer().CancelTimer(WarmPoolTimerHandler, this);
+        mWarmPoolTimerArmed = false;
+    }
+}
+
+void CASESessionManager::ScheduleWarmPoolMaintenance()
+{
+    VerifyOrReturn(!mWarmPoolTimerArmed && mWarmPeerCount != 0);
+    CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(kWarmPoolMaintenanceInterval, WarmPoolTimerHandler, this);
+    LogErrorOnFailure(err);
+    mWarmPoolTimerArmed = (err == CHIP_NO_ERROR);
+}
+
+void CASESessionManager::WarmPoolTimerHandler(System::Layer * layer, void * appState)
+{
+    static_cast<CASESessionManager *>(appState)->RunWarmPoolMaintenance();
+}
+
+void CASESessionManager::RunWarmPoolMaintenance()
+{
+    mWarmPoolTimerArmed = false;
+    VerifyOrReturn(mWarmPeerCount != 0);
+
+    // At most one handshake is kept in flight, so that warming a large working set
+    // (or re-warming after a network blip) does not burst CASE handshakes.
+    if (!mWarmEstablishmentInFlight)
+    {
+        for (size_t i = 0; i < mWarmPeerCount; i++)
+        {
+            const size_t index               = (mWarmPoolNextIndex + i) % mWarmPeerCount;
+            OperationalDeviceProxy * session = FindExistingSession(mWarmPeers[index]);
+            if (session != nullptr && (session->IsConnected() || session->IsConnecting()))
+            {
+                continue;
+            }
+
+            mWarmPoolNextIndex         = (index + 1) % mWarmPeerCount;
+            mWarmEstablishmentInFlight = true;
+            CHIP_ERROR err             = FindOrEstablishSession(mWarmPeers[index], &mOnWarmConnected, &mOnWarmConnectionFailure);
+            if (err != CHIP_NO_ERROR)
+            {
+                mWarmEstablishmentInFlight = false;
+            }
+            break;
+        }
+    }
+
+    ScheduleWarmPoolMaintenance();
+}
+
+void CASESessionManager::OnWarmConnected(void * context, OperationalDeviceProxy * device)
+{
+    auto * manager                      = static_cast<CASESessionManager *>(context);
+    manager->mWarmEstablishmentInFlight = false;
+    ChipLogDetail(Controller, "Warm pool: session established with node 0x" ChipLogFormatX64,
+                  ChipLogValueX64(device->GetDeviceId()));
+}
+
+void CASESessionManager::OnWarmConnectionFailure(void * context, PeerId peerId, CHIP_ERROR error)
+{
+    auto * manager                      = static_cast<CASESessionManager *>(context);
+    manager->mWarmEstablishmentInFlight = false;
+    // Leave the peer in the working set; the next maintenance tick retries it after
+    // the round-robin cursor has visited the other peers.
+    ChipLogError(Controller, "Warm pool: failed to establish session with node 0x" ChipLogFormatX64 ": %s",
+                 ChipLogValueX64(peerId.GetNodeId()), ErrorStr(error));
+}
+
+CHIP_ERROR CASESessionManager::RequestPreResolution(PeerId peerId)
+{
+    // A fresh cache entry or a live session means there is no resolution latency to hide.
+    Dnssd::ResolvedNodeData resolutionData;
+    if (mConfig.dnsCache != nullptr && mConfig.dnsCache->Lookup(peerId, resolutionData) == CHIP_NO_ERROR)
+    {
+        return CHIP_NO_ERROR;
+    }
+    OperationalDeviceProxy * session = FindExistingSession(peerId);
+    if (session != nullptr && (session->IsConnected() || session->IsConnecting()))
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+
+    PreResolveEntry * slot = nullptr;
+    for (auto & entry : mPreResolveQueue)
+    {
+        if (entry.mInUse && entry.mPeer == peerId)
+        {
+            if (entry.mPending || now < entry.mLastRequest + kPreResolveCooldown)
+            {
+                // Already queued, or resolved too recently: deduplicate the hint.
+                return CHIP_NO_ERROR;
+            }
+            slot = &entry;
+            break;
+        }
+        // Free slots and entries whose cooldown has elapsed are both available.
+        if (slot == nullptr && (!entry.mInUse || (!entry.mPending && now >= entry.mLastRequest + kPreResolveCooldown)))
+        {
+            slot = &entry;
+        }
+    }
+    if (slot == nullptr)
+    {
+        // Every slot is tracking another peer; drop the hint — pre-resolution is best-effort.
+        return CHIP_NO_ERROR;
+    }
+
+    slot->mInUse   = true;
+    slot->mPeer    = peerId;
+    slot->mPending = true;
+
+    // Issue the first resolution right away; further queued peers are drained one per
+    // kPreResolveInterval by the timer.
+    if (!mPreResolveTimerArmed)
+    {
+        RunPreResolve();
+    }
+    return CHIP_NO_ERROR;
+}
+
+void CASESessionManager::PreResolveTimerHandler(System::Layer * layer, void * appState)
+{
+    static_cast<CASESessionManager *>(appState)->RunPreResolve();
+}
+
+void CASESessionManager::RunPreResolve()
+{
+    mPreResolveTimerArmed = false;
+
+    PreResolveEntry * next = nullptr;
+    bool morePending       = false;
+    for (auto & entry : mPreResolveQueue)
+    {
+        if (entry.mInUse && entry.mPending)
+        {
+            if (next == nullptr)
+            {
+                next = &entry;
+            }
+            else
+            {
+                morePending = true;
+            }
+        }
+    }
+    VerifyOrReturn(next != nullptr);
+
+    next->mPending     = false;
+    next->mLastRequest = System::SystemClock().GetMonotonicTimestamp();
+    ChipLogDetail(Controller, "Pre-resolving address for node 0x" ChipLogFormatX64, ChipLogValueX64(next->mPeer.GetNodeId()));
+    LogErrorOnFailure(mConfig.dnsResolver->ResolveNodeId(next->mPeer, Inet::IPAddressType::kAny, Dnssd::Resolver::CacheBypass::On));
+
+    if (morePending)
+    {
+        CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(kPreResolveInterval, PreResolveTimerHandler, this);
+        LogErrorOnFailure(err);
+        mPreResolveTimerArmed = (err == CHIP_NO_ERROR);
+    }
+}
+
 CHIP_ERROR CASESessionManager::ResolveDeviceAddress(FabricInfo * fabric, NodeId nodeId)
 {
     return mConfig.dnsResolver->ResolveNodeId(fabric->GetPeerIdForNode(nodeId), Inet::IPAddressType::kAny,
@@ -81,6 +284,11 @@ void CASESessionManager::OnNodeIdResolved(const Dnssd::ResolvedNodeData & nodeDa
         LogErrorOnFailure(mConfig.dnsCache->Insert(nodeData));
     }
 
+    if (mConfig.persistedAddressCache != nullptr)
+    {
+        LogErrorOnFailure(mConfig.persistedAddressCache->Store(nodeData));
+    }
+
     OperationalDeviceProxy * session = FindExistingSession(nodeData.mPeerId);
     VerifyOrReturn(session != nullptr,
                    ChipLogDetail(Controller, "OnNodeIdResolved was called for a device with no active sessions, ignoring it."));
@@ -24,8 +24,10 @@
 #include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/dnssd/DnssdCache.h>
+#include <lib/dnssd/PersistedAddressCache.h>
 #include <lib/support/Pool.h>
 #include <platform/CHIPDeviceLayer.h>
+#include <protocols/secure_channel/CASESessionCache.h>
 #include <transport/SessionDelegate.h>
 
 #include <lib/dnssd/ResolverProxy.h>
@@ -38,6 +40,12 @@ struct CASESessionManagerConfig
     Dnssd::DnssdCache<CHIP_CONFIG_MDNS_CACHE_SIZE> * dnsCache = nullptr;
     OperationalDeviceProxyPoolDelegate * devicePool           = nullptr;
     Dnssd::ResolverProxy * dnsResolver                        = nullptr;
+    // Optional persisted last-known-good address cache: lets connections after
+    // a restart start immediately instead of waiting for DNS-SD resolution.
+    Dnssd::PersistedAddressCache * persistedAddressCache = nullptr;
+    // Optional storage for the internal CASE resumption cache, so resumption
+    // state survives a process restart.
+    PersistentStorageDelegate * sessionResumptionStorage = nullptr;
 };
 
 /**
@@ -53,11 +61,20 @@ class CASESessionManager : public SessionReleaseDelegate, public Dnssd::Resolver
 public:
     CASESessionManager() = delete;
 
-    CASESessionManager(const CASESessionManagerConfig & params)
+    CASESessionManager(const CASESessionManagerConfig & params) :
+        mOnWarmConnected(OnWarmConnected, this), mOnWarmConnectionFailure(OnWarmConnectionFailure, this)
     {
         VerifyOrDie(params.sessionInitParams.Validate() == CHIP_NO_ERROR);
 
         mConfig = params;
+
+        // Share one resumption cache across all sessions managed here, so that
+        // re-establishment after idle eviction can resume instead of redoing the
+        // full sigma handshake.
+        if (mConfig.sessionInitParams.sessionResumptionCache == nullptr)
+        {
+            mConfig.sessionInitParams.sessionResumptionCache = &mCASESessionCache;
+        }
     }
 
     CHIP_ERROR Init()
@@ -68,10 +85,25 @@ public:
             mDNSResolver.SetResolverDelegate(this);
             mConfig.dnsResolver = &mDNSResolver;
         }
+        // Reload persisted resumption state into the shared cache, so the first
+        // reconnects after a restart can still resume instead of redoing full CASE.
+        if (mConfig.sessionResumptionStorage != nullptr &&
+            mConfig.sessionInitParams.sessionResumptionCache == &mCASESessionCache)
+        {
+            ReturnErrorOnFailure(mCASESessionCache.Init(mConfig.sessionResumptionStorage));
+        }
         return CHIP_NO_ERROR;
     }
 
-    virtual ~CASESessionManager() { mDNSResolver.Shutdown(); }
+    virtual ~CASESessionManager()
+    {
+        ClearWarmPeerSet();
+        if (mPreResolveTimerArmed)
+        {
+            DeviceLayer::SystemLayer().CancelTimer(PreResolveTimerHandler, this);
+        }
+        mDNSResolver.Shutdown();
+    }
 
     /**
      * Find an existing session for the given node ID, or trigger a new session request.
@@ -86,6 +118,40 @@ public:
 
     void ReleaseSession(PeerId peerId);
 
+    /**
+     * Declare the working set of peers whose CASE sessions should be kept warm, replacing any
+     * previously declared set.
+     *
+     * Sessions for warm peers are established in the background — staggered, one handshake at a
+     * time — and re-established when they drop, so that the first command to a warm peer pays no
+     * handshake latency. An empty set (count == 0) stops the background maintenance.
+     *
+     * @retval CHIP_ERROR_NO_MEMORY if count exceeds CHIP_CONFIG_CASE_WARM_POOL_SIZE.
+     */
+    CHIP_ERROR SetWarmPeerSet(const PeerId * peers, size_t count);
+
+    /**
+     * Forget the warm peer working set and stop background session maintenance. Established
+     * sessions are left in place.
+     */
+    void ClearWarmPeerSet();
+
+    /**
+     * Request a background DNS-SD resolution for the given peer, so that a later
+     * FindOrEstablishSession() finds a fresh address in the DNS-SD cache instead of paying
+     * resolution latency on the first-command path.
+     *
+     * Callers invoke this on hints that an interaction with the peer is likely: a node newly
+     * joined to the fabric, a binding table entry naming the peer, or an expired cache entry
+     * for a recently used peer. Requests are rate limited — at most one resolution is issued
+     * per kPreResolveInterval, a peer is not re-resolved within kPreResolveCooldown of its
+     * last request, and at most kPreResolveQueueSize peers are tracked at once. Requests
+     * deduplicated or dropped by the rate limits still return CHIP_NO_ERROR; pre-resolution
+     * is best-effort and resolution results flow through the normal ResolverDelegate path
+     * into the configured caches.
+     */
+    CHIP_ERROR RequestPreResolution(PeerId peerId);
+
     /**
      * This API triggers the DNS-SD resolution for the given node ID. The node ID will be looked up
      * on the fabric that was configured for the CASESessionManager object.
@@ -117,8 +183,48 @@ private:
     OperationalDeviceProxy * FindSession(const SessionHandle & session);
     void ReleaseSession(OperationalDeviceProxy * device);
 
+    void RunPreResolve();
+    static void PreResolveTimerHandler(System::Layer * layer, void * appState);
+
+    void ScheduleWarmPoolMaintenance();
+    void RunWarmPoolMaintenance();
+    static void WarmPoolTimerHandler(System::Layer * layer, void * appState);
+    static void OnWarmConnected(void * context, OperationalDeviceProxy * device);
+    static void OnWarmConnectionFailure(void * context, PeerId peerId, CHIP_ERROR error);
+
+    static constexpr size_t kWarmPoolMaxPeers = CHIP_CONFIG_CASE_WARM_POOL_SIZE;
+    // One missing session is (re-)established per tick, so a large working set warms up
+    // staggered instead of bursting all handshakes at once.
+    static constexpr System::Clock::Timeout kWarmPoolMaintenanceInterval = System::Clock::Seconds16(1);
+
+    static constexpr size_t kPreResolveQueueSize = 8;
+    // At most one speculative resolution is issued per interval, so a burst of hints (e.g. a
+    // binding table replayed at boot) does not burst multicast queries onto the network.
+    static constexpr System::Clock::Timeout kPreResolveInterval = System::Clock::Seconds16(1);
+    // A peer is not speculatively re-resolved within this window of its last request.
+    static constexpr System::Clock::Timeout kPreResolveCooldown = System::Clock::Seconds16(30);
+
+    struct PreResolveEntry
+    {
+        PeerId mPeer;
+        System::Clock::Timestamp mLastRequest{ 0 };
+        bool mPending = false; ///< Queued but not yet issued to the resolver.
+        bool mInUse   = false;
+    };
+
     CASESessionManagerConfig mConfig;
     Dnssd::ResolverProxy mDNSResolver;
+    CASESessionCache mCASESessionCache;
+
+    PeerId mWarmPeers[kWarmPoolMaxPeers];
+    size_t mWarmPeerCount     = 0;
+    size_t mWarmPoolNextIndex = 0; ///< Round-robin cursor over mWarmPeers for staggered establishment.
+    bool mWarmPoolTimerArmed  = false;
+    bool mWarmEstablishmentInFlight = false;
+    PreResolveEntry mPreResolveQueue[kPreResolveQueueSize];
+    bool mPreResolveTimerArmed = false;
+    Callback::Callback<OnDeviceConnected> mOnWarmConnected;
+    Callback::Callback<OnDeviceConnectionFailure> mOnWarmConnectionFailure;
 };
 
 } // namespace chip
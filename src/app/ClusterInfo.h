@@ -79,6 +79,22 @@ public:
     // For event, an event id can only be interpreted if the cluster id is known.
     bool IsValidEventPath() const { return !(HasWildcardClusterId() && !HasWildcardEventId()); }
 
+    /**
+     * Summarize the (endpoint, cluster) coordinates of this path into a coarse 64-bit interest
+     * mask.  Two paths can only intersect if their masks share a bit, so a single AND of
+     * accumulated masks rejects most non-overlapping path sets without walking them.  Paths
+     * with a wildcard endpoint or cluster summarize to all-ones since they may intersect
+     * anything.
+     */
+    uint64_t GetAttributeInterestMask() const
+    {
+        if (HasWildcardEndpointId() || HasWildcardClusterId())
+        {
+            return UINT64_MAX;
+        }
+        return static_cast<uint64_t>(1) << (((static_cast<uint32_t>(mEndpointId) * 31) ^ mClusterId) % 64);
+    }
+
     inline bool HasWildcardNodeId() const { return mNodeId == kUndefinedNodeId; }
     inline bool HasWildcardEndpointId() const { return mEndpointId == kInvalidEndpointId; }
     inline bool HasWildcardClusterId() const { return mClusterId == kInvalidClusterId; }
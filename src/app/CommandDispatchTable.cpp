@@ -0,0 +1,62 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/CommandDispatchTable.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace app {
+
+void CommandDispatchTable::EnsureSorted()
+{
+    if (mSorted)
+    {
+        return;
+    }
+    std::sort(mpEntries, mpEntries + mEntryCount, [](const Entry & a, const Entry & b) { return a.key < b.key; });
+    mSorted = true;
+}
+
+const CommandDispatchTable::Entry * CommandDispatchTable::LowerBound(uint64_t aKey) const
+{
+    return std::lower_bound(mpEntries, mpEntries + mEntryCount, aKey,
+                            [](const Entry & entry, uint64_t key) { return entry.key < key; });
+}
+
+CommandDispatchTable::CommandHandlerFunction CommandDispatchTable::FindHandler(ClusterId aClusterId, CommandId aCommandId)
+{
+    EnsureSorted();
+
+    const uint64_t key  = MakeKey(aClusterId, aCommandId);
+    const Entry * entry = LowerBound(key);
+    return (entry != mpEntries + mEntryCount && entry->key == key) ? entry->handler : nullptr;
+}
+
+bool CommandDispatchTable::HasCluster(ClusterId aClusterId)
+{
+    EnsureSorted();
+
+    // The smallest possible key for the cluster is (cluster id, command 0); if the cluster
+    // has any entry at all, the lower bound for that key still falls within the cluster.
+    const Entry * entry = LowerBound(MakeKey(aClusterId, 0));
+    return entry != mpEntries + mEntryCount && static_cast<ClusterId>(entry->key >> 32) == aClusterId;
+}
+
+} // namespace app
+} // namespace chip
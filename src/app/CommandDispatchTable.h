@@ -0,0 +1,90 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/util/basic-types.h>
+
+#include <stdint.h>
+
+namespace chip {
+
+namespace TLV {
+class TLVReader;
+} // namespace TLV
+
+namespace app {
+
+class CommandHandler;
+struct ConcreteCommandPath;
+
+/*
+ * A flat (cluster id, command id) -> handler function dispatch table for generated server
+ * command handling. The ZAP templates emit one entry per enabled command, each pointing at
+ * a standalone decode-and-invoke function, so an invoke is dispatched with a single binary
+ * search over packed 64-bit keys instead of the cascading per-cluster and per-command
+ * switches previously generated.
+ *
+ * Generated tables are emitted in template iteration order (alphabetical by name), so the
+ * table sorts itself by key on the first lookup. Dispatch only ever runs on the Matter
+ * event loop, so the one-time sort needs no synchronization.
+ */
+class CommandDispatchTable
+{
+public:
+    using CommandHandlerFunction = void (*)(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath,
+                                            TLV::TLVReader & aDataTlv);
+
+    struct Entry
+    {
+        uint64_t key; // MakeKey(cluster id, command id)
+        CommandHandlerFunction handler;
+    };
+
+    static constexpr uint64_t MakeKey(ClusterId aClusterId, CommandId aCommandId)
+    {
+        return (static_cast<uint64_t>(aClusterId) << 32) | aCommandId;
+    }
+
+    constexpr CommandDispatchTable(Entry * apEntries, size_t aEntryCount) : mpEntries(apEntries), mEntryCount(aEntryCount) {}
+
+    /**
+     * Find the handler registered for the given cluster/command pair.
+     *
+     * @return the handler function, or nullptr if the pair is not in the table.
+     */
+    CommandHandlerFunction FindHandler(ClusterId aClusterId, CommandId aCommandId);
+
+    /**
+     * Whether any command of the given cluster is present in the table, so callers can
+     * distinguish an unsupported command on a supported cluster from an unsupported
+     * cluster.
+     */
+    bool HasCluster(ClusterId aClusterId);
+
+private:
+    void EnsureSorted();
+    const Entry * LowerBound(uint64_t aKey) const;
+
+    Entry * mpEntries;
+    size_t mEntryCount;
+    bool mSorted = false;
+};
+
+} // namespace app
+} // namespace chip
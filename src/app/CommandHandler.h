@@ -80,6 +80,20 @@ public:
         virtual bool CommandExists(const ConcreteCommandPath & aCommandPath) = 0;
     };
 
+    /**
+     * CommandHandler::Handle is the mechanism for finishing a command asynchronously.
+     *
+     * A cluster handler that cannot produce its response synchronously (e.g. one that
+     * has to wait for slow hardware) constructs a Handle from the CommandHandler inside
+     * DispatchCommand and returns without adding a response or status. The InvokeResponse
+     * is only encoded and sent once the last outstanding Handle releases its reference,
+     * so the event loop is free to process other exchanges in the meantime. Once the
+     * asynchronous work completes, call Get() to recover the CommandHandler, add the
+     * response data or status, and release (or destroy) the Handle.
+     *
+     * Get() re-validates the reference against the InteractionModelEngine's magic number
+     * and returns nullptr if the engine has been shut down since the Handle was taken.
+     */
     class Handle
     {
     public:
@@ -185,6 +199,20 @@ public:
      */
     bool IsTimedInvoke() const { return mTimedRequest; }
 
+    /**
+     * Flush the pending MRP acknowledgement right away instead of piggybacking it
+     * on the InvokeResponse. A handler that defers its command completion via
+     * CommandHandler::Handle should call this before returning, so the peer does
+     * not retransmit the request while the command is handled asynchronously.
+     */
+    void FlushAcksRightAwayOnSlowCommand()
+    {
+        VerifyOrReturn(mpExchangeCtx != nullptr);
+        auto * msgContext = mpExchangeCtx->GetReliableMessageContext();
+        VerifyOrReturn(msgContext != nullptr);
+        msgContext->FlushAcks();
+    }
+
     /*
      * This forcibly closes the exchange context if a valid one is pointed to. Such a situation does
      * not arise during normal message processing flows that all normally call Close() above. This can only
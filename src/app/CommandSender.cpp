@@ -25,6 +25,7 @@
 #include "CommandSender.h"
 #include "InteractionModelEngine.h"
 #include "StatusResponse.h"
+#include <app/InteractionLatencyStats.h>
 #include <app/TimedRequest.h>
 #include <protocols/Protocols.h>
 #include <protocols/interaction_model/Constants.h>
@@ -60,6 +61,21 @@ CHIP_ERROR CommandSender::AllocateBuffer()
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CommandSender::SetPreparedInvokeRequest(System::PacketBufferHandle && aRequest,
+                                                   const Optional<uint16_t> & aTimedInvokeTimeoutMs)
+{
+    VerifyOrReturnError(mState == State::Idle, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!mBufferAllocated, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!aRequest.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    mPendingInvokeData    = std::move(aRequest);
+    mTimedInvokeTimeoutMs = aTimedInvokeTimeoutMs;
+    mTimedRequest         = aTimedInvokeTimeoutMs.HasValue();
+
+    MoveToState(State::AddedCommand);
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR CommandSender::SendCommandRequest(const SessionHandle & session, System::Clock::Timeout timeout)
 {
     VerifyOrReturnError(mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
@@ -72,6 +88,11 @@ CHIP_ERROR CommandSender::SendCommandRequest(const SessionHandle & session, Syst
 
     mpExchangeCtx->SetResponseTimeout(timeout);
 
+#if CHIP_CONFIG_IM_LATENCY_STATS
+    mRequestStartTime  = System::SystemClock().GetMonotonicTimestamp();
+    mRequestPeerNodeId = session.GetPeerNodeId();
+#endif
+
     if (mTimedInvokeTimeoutMs.HasValue())
     {
         ReturnErrorOnFailure(TimedRequest::Send(mpExchangeCtx, mTimedInvokeTimeoutMs.Value()));
@@ -100,6 +121,11 @@ CHIP_ERROR CommandSender::OnMessageReceived(Messaging::ExchangeContext * apExcha
     if (mState == State::CommandSent)
     {
         MoveToState(State::ResponseReceived);
+
+#if CHIP_CONFIG_IM_LATENCY_STATS
+        const System::Clock::Milliseconds64 roundTrip = System::SystemClock().GetMonotonicTimestamp() - mRequestStartTime;
+        GlobalInteractionLatencyStats().Record(mRequestPeerNodeId, static_cast<uint32_t>(roundTrip.count()));
+#endif
     }
 
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -390,6 +416,14 @@ CHIP_ERROR CommandSender::FinishCommand(const Optional<uint16_t> & aTimedInvokeT
 CHIP_ERROR CommandSender::Finalize(System::PacketBufferHandle & commandPacket)
 {
     VerifyOrReturnError(mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+
+    // A prepared invoke request loaded via SetPreparedInvokeRequest() is
+    // already finalized.
+    if (!commandPacket.IsNull())
+    {
+        return CHIP_NO_ERROR;
+    }
+
     return mCommandMessageWriter.Finalize(&commandPacket);
 }
 
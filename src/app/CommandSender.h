@@ -43,6 +43,7 @@
 #include <messaging/ExchangeMgr.h>
 #include <messaging/Flags.h>
 #include <protocols/Protocols.h>
+#include <system/SystemClock.h>
 #include <system/SystemPacketBuffer.h>
 #include <system/TLVPacketBufferBackingStore.h>
 
@@ -197,6 +198,19 @@ private:
     }
 
 public:
+    /**
+     * Load a fully encoded invoke request, e.g. one produced by
+     * PreparedInvokeTemplate, bypassing per-send command encoding.  The sender
+     * must be idle and moves directly to the AddedCommand state, ready for
+     * SendCommandRequest().
+     *
+     * @param [in] aRequest               The encoded InvokeRequestMessage payload.
+     * @param [in] aTimedInvokeTimeoutMs  If it has a value, this invoke will be
+     *                                    a timed invoke; the payload must have
+     *                                    been encoded with TimedRequest set.
+     */
+    CHIP_ERROR SetPreparedInvokeRequest(System::PacketBufferHandle && aRequest, const Optional<uint16_t> & aTimedInvokeTimeoutMs);
+
     // Sends a queued up command request to the target encapsulated by the secureSession handle.
     //
     // Upon successful return from this call, all subsequent errors that occur during this interaction
@@ -300,6 +314,13 @@ private:
     State mState = State::Idle;
     chip::System::PacketBufferTLVWriter mCommandMessageWriter;
     bool mBufferAllocated = false;
+
+#if CHIP_CONFIG_IM_LATENCY_STATS
+    // Exchange-level request timestamp and peer, recorded into the global
+    // interaction latency histograms when the response arrives.
+    System::Clock::Timestamp mRequestStartTime = System::Clock::kZero;
+    NodeId mRequestPeerNodeId                  = kUndefinedNodeId;
+#endif
 };
 
 } // namespace app
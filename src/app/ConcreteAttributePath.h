@@ -77,6 +77,11 @@ struct ConcreteReadAttributePath : public ConcreteAttributePath
     }
 
     Optional<uint16_t> mListIndex;
+
+    // Set by the reporting engine when the cluster advertises a summary representation
+    // for this attribute (AttributeAccessInterface::HasSummaryRepresentation) and this
+    // read may return it instead of the full value.  See the comments on that method.
+    bool mSummaryRead = false;
 };
 
 /**
@@ -0,0 +1,51 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/util/basic-types.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * A client-held (endpoint, cluster, data version) tuple.  Encoded as a
+ * DataVersionFilterIB in read/subscribe requests; the server suppresses the
+ * attributes of any cluster whose current data version still matches the
+ * filter.
+ */
+struct DataVersionFilter
+{
+    DataVersionFilter(EndpointId aEndpointId, ClusterId aClusterId, DataVersion aDataVersion) :
+        mEndpointId(aEndpointId), mClusterId(aClusterId), mDataVersion(aDataVersion)
+    {}
+
+    DataVersionFilter() {}
+
+    bool IsValidDataVersionFilter() const
+    {
+        return (mEndpointId != kInvalidEndpointId) && (mClusterId != kInvalidClusterId);
+    }
+
+    EndpointId mEndpointId   = kInvalidEndpointId;
+    ClusterId mClusterId     = kInvalidClusterId;
+    DataVersion mDataVersion = 0;
+};
+
+} // namespace app
+} // namespace chip
@@ -63,6 +63,7 @@ struct ReclaimEventCtx
 {
     CircularEventBuffer * mpEventBuffer = nullptr;
     size_t mSpaceNeededForMovedEvent    = 0;
+    EventNumber mHeadEventNumber        = 0;
 };
 
 /**
@@ -210,6 +211,138 @@ exit:
     return err;
 }
 
+void EventManagement::EnableColdStorage(CircularEventBuffer * apColdBuffer, uint8_t * apBuffer, uint32_t aBufferSize)
+{
+    apColdBuffer->Init(apBuffer, aBufferSize, nullptr, nullptr, PriorityLevel::Invalid);
+    apColdBuffer->mProcessEvictedElement = NoteColdEventEvicted;
+    apColdBuffer->mAppData               = apColdBuffer;
+    mpColdStorageBuffer                  = apColdBuffer;
+}
+
+void EventManagement::EnableEventPersistence(PersistentEventLog * apPersistentLog, PriorityLevel aMinPersistPriority)
+{
+    mpPersistentEventLog = apPersistentLog;
+    mPersistMinPriority  = aMinPersistPriority;
+}
+
+CHIP_ERROR EventManagement::ReplayPersistedEvents()
+{
+    VerifyOrReturnError(mState != EventManagementStates::Shutdown, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mpPersistentEventLog != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    const bool intoHeadBuffer = (mpColdStorageBuffer == nullptr);
+    if (intoHeadBuffer)
+    {
+        // Let overflow during replay evict the oldest replayed events, the way the
+        // cold buffer does, instead of failing the replay outright.
+        mpEventBuffer->mProcessEvictedElement = NoteColdEventEvicted;
+        mpEventBuffer->mAppData               = mpEventBuffer;
+    }
+
+    CHIP_ERROR err = mpPersistentEventLog->Replay(ReplayPersistedEvent, this);
+
+    if (intoHeadBuffer)
+    {
+        mpEventBuffer->mProcessEvictedElement = nullptr;
+        mpEventBuffer->mAppData               = nullptr;
+    }
+
+    if (err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL)
+    {
+        ChipLogProgress(EventLogging, "Event replay stopped: buffers full");
+        err = CHIP_NO_ERROR;
+    }
+    return err;
+}
+
+CHIP_ERROR EventManagement::ReplayPersistedEvent(EventNumber aEventNumber, TLVReader & aReader, void * apContext)
+{
+    EventManagement * instance   = static_cast<EventManagement *>(apContext);
+    CircularEventBuffer * buffer =
+        (instance->mpColdStorageBuffer != nullptr) ? instance->mpColdStorageBuffer : instance->mpEventBuffer;
+
+    CircularTLVWriter writer;
+    CHIP_ERROR err             = CHIP_NO_ERROR;
+    CircularEventBuffer backup = *buffer;
+
+    writer.Init(*buffer);
+
+    err = aReader.Next();
+    SuccessOrExit(err);
+
+    err = writer.CopyElement(aReader);
+    SuccessOrExit(err);
+
+    err = writer.Finalize();
+    SuccessOrExit(err);
+
+    buffer->NoteEventAppended(aEventNumber);
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        *buffer = backup;
+    }
+    return err;
+}
+
+CHIP_ERROR EventManagement::PersistEvent(EventLoggingDelegate * apDelegate, const EventOptions & aOptions,
+                                         EventNumber aEventNumber)
+{
+    System::PacketBufferTLVWriter writer;
+    EventLoadOutContext ctxt       = EventLoadOutContext(writer, aOptions.mPriority, mLastEventNumber);
+    System::PacketBufferHandle buf = System::PacketBufferHandle::New(kMaxEventSizeReserve);
+    VerifyOrReturnError(!buf.IsNull(), CHIP_ERROR_NO_MEMORY);
+    writer.Init(std::move(buf));
+
+    // Re-serialize with the same baselines the in-buffer copy was built from, so the
+    // persisted bytes match what the circular buffer holds.
+    ctxt.mCurrentEventNumber = mLastEventNumber;
+    ctxt.mCurrentTime        = mLastEventTimestamp;
+    ReturnErrorOnFailure(ConstructEvent(&ctxt, apDelegate, &aOptions));
+    ReturnErrorOnFailure(writer.Finalize(&buf));
+    VerifyOrReturnError(!buf->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
+
+    return mpPersistentEventLog->Append(aEventNumber, buf->Start(), buf->DataLength());
+}
+
+CHIP_ERROR EventManagement::NoteColdEventEvicted(CHIPCircularTLVBuffer & aBuffer, void * apAppData, TLVReader & aReader)
+{
+    static_cast<CircularEventBuffer *>(apAppData)->NoteEventEvicted();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR EventManagement::CopyToColdStorage(CircularEventBuffer * apEventBuffer, EventNumber aEventNumber)
+{
+    VerifyOrReturnError(mpColdStorageBuffer != nullptr, CHIP_NO_ERROR);
+
+    CircularTLVWriter writer;
+    CircularTLVReader reader;
+    CHIP_ERROR err             = CHIP_NO_ERROR;
+    CircularEventBuffer backup = *mpColdStorageBuffer;
+
+    writer.Init(*mpColdStorageBuffer);
+
+    // Set up the reader s.t. it is positioned to read the head event
+    reader.Init(*apEventBuffer);
+
+    err = reader.Next();
+    SuccessOrExit(err);
+
+    err = writer.CopyElement(reader);
+    SuccessOrExit(err);
+
+    err = writer.Finalize();
+    SuccessOrExit(err);
+
+    mpColdStorageBuffer->NoteEventAppended(aEventNumber);
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        *mpColdStorageBuffer = backup;
+    }
+    return err;
+}
+
 CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace)
 {
     CHIP_ERROR err                    = CHIP_NO_ERROR;
@@ -238,6 +371,11 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace)
             // buffer(final one), or we figured out how much space we need to evict it into the next buffer, the check happens in
             // EvictEvent function
 
+            if (err == CHIP_NO_ERROR)
+            {
+                eventBuffer->NoteEventEvicted();
+            }
+
             if (err != CHIP_NO_ERROR)
             {
                 VerifyOrExit(ctx.mSpaceNeededForMovedEvent != 0, /* no-op, return err */);
@@ -252,6 +390,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace)
                     // this to fail.
                     err = CopyToNextBuffer(eventBuffer);
                     SuccessOrExit(err);
+                    eventBuffer->GetNextCircularEventBuffer()->NoteEventAppended(ctx.mHeadEventNumber);
                     // success; evict head unconditionally
                     eventBuffer->mProcessEvictedElement = nullptr;
                     err                                 = eventBuffer->EvictHead();
@@ -261,6 +400,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace)
                     // caller know that we could not honor the
                     // request
                     SuccessOrExit(err);
+                    eventBuffer->NoteEventEvicted();
                     continue;
                 }
                 // we cannot copy event outright. We remember the
@@ -387,9 +527,16 @@ void EventManagement::DestroyEventManagement()
 #if !CHIP_SYSTEM_CONFIG_NO_LOCKING
     ScopedLock lock(sInstance);
 #endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
-    sInstance.mState        = EventManagementStates::Shutdown;
-    sInstance.mpEventBuffer = nullptr;
-    sInstance.mpExchangeMgr = nullptr;
+    if (sInstance.mpPersistentEventLog != nullptr)
+    {
+        // Push the partially filled segment out so an orderly shutdown loses no events.
+        LogErrorOnFailure(sInstance.mpPersistentEventLog->Flush());
+    }
+    sInstance.mState                = EventManagementStates::Shutdown;
+    sInstance.mpEventBuffer         = nullptr;
+    sInstance.mpColdStorageBuffer   = nullptr;
+    sInstance.mpPersistentEventLog  = nullptr;
+    sInstance.mpExchangeMgr         = nullptr;
 }
 
 CircularEventBuffer * EventManagement::GetPriorityBuffer(PriorityLevel aPriority) const
@@ -531,6 +678,15 @@ exit:
     else if (opts.mPriority >= CHIP_CONFIG_EVENT_GLOBAL_PRIORITY)
     {
         aEventNumber = mLastEventNumber;
+        if (mpPersistentEventLog != nullptr && opts.mPriority >= mPersistMinPriority)
+        {
+            // Best effort: a persistence failure must not fail the log operation itself.
+            LogErrorOnFailure(PersistEvent(apDelegate, opts, aEventNumber));
+        }
+        mpEventBuffer->NoteEventAppended(mLastEventNumber);
+#if CHIP_CONFIG_EVENT_LOGGING_CLUSTER_INDEX_SIZE > 0
+        NoteEventLogged(opts.mPath, mLastEventNumber);
+#endif // CHIP_CONFIG_EVENT_LOGGING_CLUSTER_INDEX_SIZE > 0
         VendEventNumber();
         mLastEventTimestamp = timestamp;
 #if CHIP_CONFIG_EVENT_LOGGING_VERBOSE_DEBUG_LOGS
@@ -549,6 +705,70 @@ exit:
     return err;
 }
 
+#if CHIP_CONFIG_EVENT_LOGGING_CLUSTER_INDEX_SIZE > 0
+void EventManagement::NoteEventLogged(const ConcreteEventPath & aPath, EventNumber aEventNumber)
+{
+    ClusterEventIndexEntry * freeEntry = nullptr;
+
+    VerifyOrReturn(!mClusterIndexOverflowed);
+
+    for (ClusterEventIndexEntry & entry : mClusterEventIndex)
+    {
+        if (entry.mInUse)
+        {
+            if (entry.mEndpointId == aPath.mEndpointId && entry.mClusterId == aPath.mClusterId)
+            {
+                entry.mLastEventNumber = aEventNumber;
+                return;
+            }
+        }
+        else if (freeEntry == nullptr)
+        {
+            freeEntry = &entry;
+        }
+    }
+
+    if (freeEntry == nullptr)
+    {
+        // More distinct (endpoint, cluster) pairs than slots: the index can no longer
+        // prove the absence of interesting events, so stop consulting it.
+        mClusterIndexOverflowed = true;
+        return;
+    }
+
+    freeEntry->mInUse           = true;
+    freeEntry->mEndpointId      = aPath.mEndpointId;
+    freeEntry->mClusterId       = aPath.mClusterId;
+    freeEntry->mLastEventNumber = aEventNumber;
+}
+
+bool EventManagement::MayContainInterestedEvents(ClusterInfo * apClusterInfolist, EventNumber aEventMin) const
+{
+    VerifyOrReturnError(!mClusterIndexOverflowed, true);
+
+    for (const ClusterEventIndexEntry & entry : mClusterEventIndex)
+    {
+        if (!entry.mInUse || entry.mLastEventNumber < aEventMin)
+        {
+            continue;
+        }
+
+        for (ClusterInfo * interestedPath = apClusterInfolist; interestedPath != nullptr; interestedPath = interestedPath->mpNext)
+        {
+            // The event id is deliberately ignored: matching on (endpoint, cluster)
+            // alone errs towards scanning, never towards skipping a wanted event.
+            if ((interestedPath->HasWildcardEndpointId() || interestedPath->mEndpointId == entry.mEndpointId) &&
+                (interestedPath->HasWildcardClusterId() || interestedPath->mClusterId == entry.mClusterId))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+#endif // CHIP_CONFIG_EVENT_LOGGING_CLUSTER_INDEX_SIZE > 0
+
 CHIP_ERROR EventManagement::CopyEvent(const TLVReader & aReader, TLVWriter & aWriter, EventLoadOutContext * apContext)
 {
     TLVReader reader;
@@ -674,8 +894,50 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, ClusterInfo *
 #endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
 
     context.mpInterestedEventPaths = apClusterInfolist;
-    err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
-    SuccessOrExit(err);
+
+#if CHIP_CONFIG_EVENT_LOGGING_CLUSTER_INDEX_SIZE > 0
+    // If the cluster index proves that no event at or past aEventMin can match an
+    // interested path, skip the log walk outright.  aEventMin is left unchanged; the
+    // index is re-checked on the next fetch, which is as cheap as this check.
+    if (!MayContainInterestedEvents(apClusterInfolist, aEventMin))
+    {
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_CONFIG_EVENT_LOGGING_CLUSTER_INDEX_SIZE > 0
+
+    // Fetch first from the cold-storage tier, if configured: events there are older than
+    // anything in the buffer chain, and scanning them first keeps the event-number
+    // accounting on exit anchored to the newest in-memory event.
+    if (mpColdStorageBuffer != nullptr && mpColdStorageBuffer->MightContainEventsFrom(aEventMin))
+    {
+        TLVReader coldReader;
+        CircularEventBufferWrapper coldBufWrapper;
+        coldBufWrapper.mpCurrent = mpColdStorageBuffer;
+
+        CircularEventReader eventReader;
+        eventReader.Init(&coldBufWrapper);
+        coldReader.Init(eventReader);
+
+        err = TLV::Utilities::Iterate(coldReader, CopyEventsSince, &context, recurse);
+        if (err != CHIP_NO_ERROR && err != CHIP_END_OF_TLV)
+        {
+            ExitNow();
+        }
+    }
+
+    {
+        // Skip whole buffers that cannot hold events at or past aEventMin, so resuming a
+        // fetch from a recent event number does not force a TLV scan of the older buffers.
+        // The newest buffer is always scanned, which keeps the event-number accounting on
+        // exit identical to a full scan.
+        CircularEventBuffer * buffer = GetPriorityBuffer(PriorityLevel::Critical);
+        while (buffer->GetPreviousCircularEventBuffer() != nullptr && !buffer->MightContainEventsFrom(aEventMin))
+        {
+            buffer = buffer->GetPreviousCircularEventBuffer();
+        }
+        err = GetEventReader(reader, buffer->GetPriority(), &bufWrapper);
+        SuccessOrExit(err);
+    }
 
     err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
     if (err == CHIP_END_OF_TLV)
@@ -775,13 +1037,27 @@ CHIP_ERROR EventManagement::EvictEvent(CHIPCircularTLVBuffer & apBuffer, void *
 
     ReclaimEventCtx * const ctx             = static_cast<ReclaimEventCtx *>(apAppData);
     CircularEventBuffer * const eventBuffer = ctx->mpEventBuffer;
+    ctx->mHeadEventNumber                   = context.mEventNumber;
     if (eventBuffer->IsFinalDestinationForPriority(imp))
     {
-        ChipLogProgress(EventLogging,
-                        "Dropped 1 event from buffer with priority %u and event number  0x" ChipLogFormatX64
-                        " due to overflow: event priority_level: %u",
-                        static_cast<unsigned>(eventBuffer->GetPriority()), ChipLogValueX64(context.mEventNumber),
-                        static_cast<unsigned>(imp));
+        // Retain the dropped event in the cold-storage tier when one is configured.  This is
+        // best effort: an event too large for the cold buffer is simply dropped, as before.
+        if (sInstance.mpColdStorageBuffer != nullptr &&
+            sInstance.CopyToColdStorage(eventBuffer, context.mEventNumber) == CHIP_NO_ERROR)
+        {
+            ChipLogProgress(EventLogging,
+                            "Moved 1 event with number 0x" ChipLogFormatX64
+                            " from buffer with priority %u to cold storage due to overflow",
+                            ChipLogValueX64(context.mEventNumber), static_cast<unsigned>(eventBuffer->GetPriority()));
+        }
+        else
+        {
+            ChipLogProgress(EventLogging,
+                            "Dropped 1 event from buffer with priority %u and event number  0x" ChipLogFormatX64
+                            " due to overflow: event priority_level: %u",
+                            static_cast<unsigned>(eventBuffer->GetPriority()), ChipLogValueX64(context.mEventNumber),
+                            static_cast<unsigned>(imp));
+        }
         ctx->mSpaceNeededForMovedEvent = 0;
         return CHIP_NO_ERROR;
     }
@@ -809,6 +1085,27 @@ void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, Circu
     mpNext               = apNext;
     mPriority            = aPriorityLevel;
     mpEventNumberCounter = nullptr;
+    mLastEventNumber     = 0;
+    mEventCount          = 0;
+}
+
+void CircularEventBuffer::NoteEventAppended(EventNumber aEventNumber)
+{
+    mLastEventNumber = aEventNumber;
+    mEventCount++;
+}
+
+void CircularEventBuffer::NoteEventEvicted()
+{
+    if (mEventCount > 0)
+    {
+        mEventCount--;
+    }
+}
+
+bool CircularEventBuffer::MightContainEventsFrom(EventNumber aEventMin) const
+{
+    return (mEventCount != 0) && (mLastEventNumber >= aEventMin);
 }
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
@@ -31,6 +31,7 @@
 #include <app/ClusterInfo.h>
 #include <app/MessageDef/EventDataIB.h>
 #include <app/util/basic-types.h>
+#include <app/PersistentEventLog.h>
 #include <lib/core/CHIPCircularTLVBuffer.h>
 #include <lib/support/PersistedCounter.h>
 #include <messaging/ExchangeMgr.h>
@@ -96,6 +97,25 @@ public:
     void SetRequiredSpaceforEvicted(size_t aRequiredSpace) { mRequiredSpaceForEvicted = aRequiredSpace; }
     size_t GetRequiredSpaceforEvicted() { return mRequiredSpaceForEvicted; }
 
+    /**
+     * @brief
+     *   Note that the event with the given number was stored into this buffer, either by
+     *   direct append or by promotion from the previous buffer, keeping track of the
+     *   newest event number the buffer holds.
+     */
+    void NoteEventAppended(EventNumber aEventNumber);
+
+    /// Note that the head event was evicted from this buffer.
+    void NoteEventEvicted();
+
+    /**
+     * @brief
+     *   Whether this buffer might hold events with numbers at or past aEventMin.  The
+     *   newest event number is maintained on append and promotion, and eviction never
+     *   increases it, so a false result allows readers to skip the buffer outright.
+     */
+    bool MightContainEventsFrom(EventNumber aEventMin) const;
+
     virtual ~CircularEventBuffer() = default;
 
 private:
@@ -112,6 +132,9 @@ private:
     MonotonicallyIncreasingCounter mNonPersistedCounter;
 
     size_t mRequiredSpaceForEvicted = 0; ///< Required space for previous buffer to evict event to new buffer
+
+    EventNumber mLastEventNumber = 0; ///< Number of the newest event in the buffer; only meaningful when mEventCount != 0
+    size_t mEventCount           = 0; ///< Number of events currently stored in the buffer
 };
 
 class CircularEventReader;
@@ -338,6 +361,50 @@ public:
     CHIP_ERROR FetchEventsSince(chip::TLV::TLVWriter & aWriter, ClusterInfo * apClusterInfolist, EventNumber & aEventMin,
                                 size_t & aEventCount);
 
+    /**
+     * @brief
+     *   Enable an optional cold-storage tier for evicted events.
+     *
+     * Once enabled, an event that would be dropped from its final-destination buffer on
+     * overflow is instead retained in the supplied circular buffer, until that buffer
+     * overflows in turn.  FetchEventsSince() scans the cold tier transparently, ahead of
+     * the in-memory buffer chain, so retained events are still delivered to readers and
+     * the effective retention grows by the cold buffer's capacity.
+     *
+     * @param[in] apColdBuffer   The CircularEventBuffer to manage the cold storage; not
+     *                           part of the priority buffer chain.
+     * @param[in] apBuffer       The actual storage for cold events.  Must not be nullptr.
+     * @param[in] aBufferSize    The size, in bytes, of \c apBuffer.
+     */
+    void EnableColdStorage(CircularEventBuffer * apColdBuffer, uint8_t * apBuffer, uint32_t aBufferSize);
+
+    /**
+     * @brief
+     *   Enable an optional persistent tier for logged events.
+     *
+     * Once enabled, every event at or above \c aMinPersistPriority is appended to the
+     * supplied log as it is logged.  Appends only stage the event in RAM; the log writes
+     * to its storage backend one segment at a time, so the per-event logging path gains
+     * no storage latency.  DestroyEventManagement() flushes the segment in progress on
+     * orderly shutdown.
+     *
+     * @param[in] apPersistentLog      An initialized PersistentEventLog; not owned.
+     * @param[in] aMinPersistPriority  The lowest priority worth persisting.
+     */
+    void EnableEventPersistence(PersistentEventLog * apPersistentLog, PriorityLevel aMinPersistPriority);
+
+    /**
+     * @brief
+     *   Replay events persisted by a previous boot into the event buffers.
+     *
+     * Replayed events land in the cold-storage tier when one is enabled (they are by
+     * definition the oldest events held), and in the head event buffer otherwise, with
+     * their original event numbers; FetchEventsSince() then delivers them like any other
+     * retained event.  Call after Init() and before any events are logged.  Replay stops
+     * quietly once the buffers are full.
+     */
+    CHIP_ERROR ReplayPersistedEvents();
+
     /**
      * @brief
      *   Fetch the most recently vended Number for a particular priority level
@@ -389,6 +456,34 @@ private:
      */
     CHIP_ERROR CopyToNextBuffer(CircularEventBuffer * apEventBuffer);
 
+    /**
+     * @brief copy the event at the head of apEventBuffer into the cold-storage buffer, evicting
+     * the cold buffer's own oldest events as needed.  A no-op when cold storage is not enabled.
+     *
+     * @param[in] apEventBuffer  CircularEventBuffer whose head event is being dropped
+     * @param[in] aEventNumber   Number of the event being dropped
+     *
+     */
+    CHIP_ERROR CopyToColdStorage(CircularEventBuffer * apEventBuffer, EventNumber aEventNumber);
+
+    /**
+     * @brief re-serialize the event that was just logged and append it to the persistent
+     * event log.  The caller treats failure as non-fatal: the event is still logged in RAM.
+     *
+     * @param[in] apDelegate    The delegate that serialized the event's data
+     * @param[in] aOptions      Options the event was logged with
+     * @param[in] aEventNumber  Number vended for the event
+     *
+     */
+    CHIP_ERROR PersistEvent(EventLoggingDelegate * apDelegate, const EventOptions & aOptions, EventNumber aEventNumber);
+
+    /**
+     * @brief PersistentEventLog::Replay() visitor: copy one persisted event into the
+     * replay destination buffer with its original event number.
+     *
+     */
+    static CHIP_ERROR ReplayPersistedEvent(EventNumber aEventNumber, TLV::TLVReader & aReader, void * apContext);
+
     /**
      * @brief eusure current buffer has enough space, if not, when current buffer is final destination of last tail's event
      * priority, we need to drop event, otherwises, move the last event to the buffer with higher priority
@@ -443,6 +538,13 @@ private:
      * requires, and return.
      */
     static CHIP_ERROR EvictEvent(chip::TLV::CHIPCircularTLVBuffer & aBuffer, void * apAppData, TLV::TLVReader & aReader);
+
+    /**
+     * @brief eviction callback for the cold-storage buffer: the oldest cold events are
+     * reclaimed unconditionally; this only maintains the event count used to skip the
+     * buffer on reads.
+     */
+    static CHIP_ERROR NoteColdEventEvicted(chip::TLV::CHIPCircularTLVBuffer & aBuffer, void * apAppData, TLV::TLVReader & aReader);
     static CHIP_ERROR AlwaysFail(chip::TLV::CHIPCircularTLVBuffer & aBuffer, void * apAppData, TLV::TLVReader & aReader)
     {
         return CHIP_ERROR_NO_MEMORY;
@@ -463,8 +565,34 @@ private:
      */
     CircularEventBuffer * GetPriorityBuffer(PriorityLevel aPriority) const;
 
+#if CHIP_CONFIG_EVENT_LOGGING_CLUSTER_INDEX_SIZE > 0
+    /**
+     * @brief
+     *   Record in the cluster index that an event was logged for aPath.
+     *
+     * If the index is out of slots for a new (endpoint, cluster) pair it disables
+     * itself, making MayContainInterestedEvents() conservatively answer true.
+     */
+    void NoteEventLogged(const ConcreteEventPath & aPath, EventNumber aEventNumber);
+
+    /**
+     * @brief
+     *   Check whether any event at or past aEventMin could match a path in apClusterInfolist.
+     *
+     * Consults only the per-cluster event number ranges; a false return proves the
+     * log walk would produce nothing.  A true return says nothing either way.
+     */
+    bool MayContainInterestedEvents(ClusterInfo * apClusterInfolist, EventNumber aEventMin) const;
+#endif // CHIP_CONFIG_EVENT_LOGGING_CLUSTER_INDEX_SIZE > 0
+
     // EventBuffer for debug level,
     CircularEventBuffer * mpEventBuffer        = nullptr;
+    // Optional cold-storage tier for events evicted from their final-destination buffer;
+    // not part of the priority buffer chain.
+    CircularEventBuffer * mpColdStorageBuffer  = nullptr;
+    // Optional persistent tier appending logged events to storage; not owned.
+    PersistentEventLog * mpPersistentEventLog  = nullptr;
+    PriorityLevel mPersistMinPriority          = PriorityLevel::Critical;
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
     EventManagementStates mState               = EventManagementStates::Shutdown;
     uint32_t mBytesWritten                     = 0;
@@ -480,6 +608,22 @@ private:
 
     EventNumber mLastEventNumber = 0; ///< Last event Number vended for this priority
     Timestamp mLastEventTimestamp;    ///< The timestamp of the last event in this buffer
+
+#if CHIP_CONFIG_EVENT_LOGGING_CLUSTER_INDEX_SIZE > 0
+    // Per-(endpoint, cluster) record of the highest event number logged, used by
+    // FetchEventsSince() to skip the log walk when no interested path can match.
+    // Entries are never released: eviction of old events only ever shrinks the set
+    // of fetchable events, so a stale upper bound stays conservative.
+    struct ClusterEventIndexEntry
+    {
+        EndpointId mEndpointId       = 0;
+        ClusterId mClusterId         = 0;
+        EventNumber mLastEventNumber = 0;
+        bool mInUse                  = false;
+    };
+    ClusterEventIndexEntry mClusterEventIndex[CHIP_CONFIG_EVENT_LOGGING_CLUSTER_INDEX_SIZE];
+    bool mClusterIndexOverflowed = false;
+#endif // CHIP_CONFIG_EVENT_LOGGING_CLUSTER_INDEX_SIZE > 0
 };
 } // namespace app
 } // namespace chip
@@ -0,0 +1,128 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/InteractionLatencyStats.h>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+size_t BucketFor(uint32_t aMillis)
+{
+    size_t bucket = 0;
+    while ((aMillis >> (bucket + 1)) != 0 && bucket < LatencyHistogram::kNumBuckets - 1)
+    {
+        bucket++;
+    }
+    return bucket;
+}
+
+} // namespace
+
+void LatencyHistogram::Record(uint32_t aMillis)
+{
+    mBuckets[BucketFor(aMillis)]++;
+    mCount++;
+    mTotalMillis += aMillis;
+    if (aMillis > mMaxMillis)
+    {
+        mMaxMillis = aMillis;
+    }
+}
+
+uint32_t LatencyHistogram::GetPercentileMillis(uint8_t aPercentile) const
+{
+    if (mCount == 0)
+    {
+        return 0;
+    }
+
+    // Rank of the requested percentile, rounding up so p100 is the last sample.
+    const uint64_t rank = (mCount * aPercentile + 99) / 100;
+
+    uint64_t cumulative = 0;
+    for (size_t bucket = 0; bucket < kNumBuckets; bucket++)
+    {
+        cumulative += mBuckets[bucket];
+        if (cumulative >= rank)
+        {
+            if (bucket == kNumBuckets - 1)
+            {
+                // The last bucket is open-ended; the recorded maximum is its
+                // tightest upper bound.
+                return mMaxMillis;
+            }
+            return static_cast<uint32_t>(1) << (bucket + 1);
+        }
+    }
+
+    return mMaxMillis;
+}
+
+void InteractionLatencyStats::Record(NodeId aPeerNodeId, uint32_t aRoundTripMillis)
+{
+    mGlobal.Record(aRoundTripMillis);
+
+    for (size_t i = 0; i < mNumPeers; i++)
+    {
+        if (mPeers[i].mPeerNodeId == aPeerNodeId)
+        {
+            mPeers[i].mHistogram.Record(aRoundTripMillis);
+            return;
+        }
+    }
+
+    // Once all per-peer slots are taken, later peers fold into the global
+    // histogram only.
+    if (mNumPeers < kMaxPeers)
+    {
+        mPeers[mNumPeers].mPeerNodeId = aPeerNodeId;
+        mPeers[mNumPeers].mHistogram.Record(aRoundTripMillis);
+        mNumPeers++;
+    }
+}
+
+const PeerLatencyStats * InteractionLatencyStats::GetPeerStats(size_t aIndex) const
+{
+    if (aIndex >= mNumPeers)
+    {
+        return nullptr;
+    }
+    return &mPeers[aIndex];
+}
+
+void InteractionLatencyStats::Reset()
+{
+    for (size_t i = 0; i < mNumPeers; i++)
+    {
+        mPeers[i].mPeerNodeId = kUndefinedNodeId;
+        mPeers[i].mHistogram.Reset();
+    }
+    mNumPeers = 0;
+    mGlobal.Reset();
+}
+
+InteractionLatencyStats & GlobalInteractionLatencyStats()
+{
+    static InteractionLatencyStats sStats;
+    return sStats;
+}
+
+} // namespace app
+} // namespace chip
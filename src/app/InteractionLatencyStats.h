@@ -0,0 +1,104 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/NodeId.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Approximate latency distribution held as a power-of-two-bucketed histogram:
+ * bucket k counts round trips in [2^k, 2^(k + 1)) milliseconds. Percentile
+ * queries return the upper bound of the bucket containing the requested rank,
+ * so estimates are within a factor of two of the true value at a fixed memory
+ * cost, which is accurate enough to tell network stalls from stack queuing.
+ */
+struct LatencyHistogram
+{
+    static constexpr size_t kNumBuckets = 16;
+
+    uint32_t mBuckets[kNumBuckets] = {};
+    uint64_t mCount                = 0;
+    uint64_t mTotalMillis          = 0;
+    uint32_t mMaxMillis            = 0;
+
+    void Record(uint32_t aMillis);
+
+    /**
+     * Upper-bound estimate of the given percentile (1-100) in milliseconds,
+     * or 0 when nothing has been recorded.
+     */
+    uint32_t GetPercentileMillis(uint8_t aPercentile) const;
+
+    void Reset() { *this = LatencyHistogram(); }
+};
+
+/** Latency histogram attributed to a single peer node. */
+struct PeerLatencyStats
+{
+    NodeId mPeerNodeId = kUndefinedNodeId;
+    LatencyHistogram mHistogram;
+};
+
+/**
+ * Round-trip latency of interactions (command invokes and read/subscribe
+ * primed reports), measured at the exchange level between request send and
+ * response arrival so stack-internal queuing is included. A global histogram
+ * aggregates everything; the first CHIP_CONFIG_IM_LATENCY_STATS_MAX_PEERS
+ * distinct peers additionally get their own histogram, and later peers fold
+ * into the global one only. Updates happen on the CHIP event loop thread, so
+ * no synchronization is needed. Exported through the accessors below and the
+ * `im-latency` shell command.
+ */
+class InteractionLatencyStats
+{
+public:
+    static constexpr size_t kMaxPeers = CHIP_CONFIG_IM_LATENCY_STATS_MAX_PEERS;
+
+    void Record(NodeId aPeerNodeId, uint32_t aRoundTripMillis);
+
+    const LatencyHistogram & GetGlobalHistogram() const { return mGlobal; }
+
+    /**
+     * Stats of the aIndex-th tracked peer, or nullptr once aIndex reaches the
+     * number of peers seen so far.
+     */
+    const PeerLatencyStats * GetPeerStats(size_t aIndex) const;
+
+    void Reset();
+
+private:
+    PeerLatencyStats mPeers[kMaxPeers];
+    size_t mNumPeers = 0;
+    LatencyHistogram mGlobal;
+};
+
+/**
+ * Interaction latency aggregated since boot (or the last reset via the
+ * `im-latency` shell command).
+ */
+InteractionLatencyStats & GlobalInteractionLatencyStats();
+
+} // namespace app
+} // namespace chip
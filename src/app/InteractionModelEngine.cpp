@@ -25,6 +25,7 @@
 
 #include "InteractionModelEngine.h"
 #include <cinttypes>
+#include <lib/core/CHIPTLVUtilities.hpp>
 
 namespace chip {
 namespace app {
@@ -179,6 +180,90 @@ uint32_t InteractionModelEngine::GetNumActiveReadHandlers() const
     return numActive;
 }
 
+uint32_t InteractionModelEngine::GetNumActiveSubscriptions(FabricIndex aFabricIndex) const
+{
+    uint32_t numActive = 0;
+
+    for (auto & readHandler : mReadHandlers)
+    {
+        if (!readHandler.IsFree() && readHandler.IsSubscriptionType() && readHandler.GetAccessingFabricIndex() == aFabricIndex)
+        {
+            numActive++;
+        }
+    }
+
+    return numActive;
+}
+
+bool InteractionModelEngine::ShedSubscription(FabricIndex aFabricIndex)
+{
+    ReadHandler * victim = nullptr;
+    size_t victimCost    = 0;
+
+    for (auto & readHandler : mReadHandlers)
+    {
+        if (readHandler.IsFree() || !readHandler.IsSubscriptionType() || readHandler.GetAccessingFabricIndex() != aFabricIndex)
+        {
+            continue;
+        }
+
+        size_t cost = readHandler.GetInterestedPathCount();
+        if (victim == nullptr || cost > victimCost)
+        {
+            victim     = &readHandler;
+            victimCost = cost;
+        }
+    }
+
+    VerifyOrReturnError(victim != nullptr, false);
+
+    ChipLogProgress(InteractionModel, "Shedding subscription with %u paths on fabric index %u under subscription pressure",
+                    static_cast<unsigned>(victimCost), static_cast<unsigned>(aFabricIndex));
+    victim->Shutdown(ReadHandler::ShutdownOptions::AbortCurrentExchange);
+    return true;
+}
+
+void InteractionModelEngine::ApplySubscriptionAdmissionPolicy(FabricIndex aRequestingFabric)
+{
+#if CHIP_IM_MAX_NUM_SUBSCRIPTIONS_PER_FABRIC > 0
+    // A fabric at its quota sheds its own cheapest-to-lose subscription, so a
+    // misbehaving controller only ever degrades itself.
+    while (GetNumActiveSubscriptions(aRequestingFabric) >= CHIP_IM_MAX_NUM_SUBSCRIPTIONS_PER_FABRIC)
+    {
+        VerifyOrReturn(ShedSubscription(aRequestingFabric));
+    }
+#endif // CHIP_IM_MAX_NUM_SUBSCRIPTIONS_PER_FABRIC > 0
+
+    // Under pool pressure, shed from the fabric holding the most
+    // subscriptions, but only when it holds strictly more than the requester:
+    // an even split is already fair and stays first come, first served.
+    if ((CHIP_IM_MAX_NUM_READ_HANDLER - GetNumActiveReadHandlers()) <= 1)
+    {
+        FabricIndex heaviestFabric = kUndefinedFabricIndex;
+        uint32_t heaviestCount     = GetNumActiveSubscriptions(aRequestingFabric);
+
+        for (auto & readHandler : mReadHandlers)
+        {
+            if (readHandler.IsFree() || !readHandler.IsSubscriptionType())
+            {
+                continue;
+            }
+
+            uint32_t count = GetNumActiveSubscriptions(readHandler.GetAccessingFabricIndex());
+            if (count > heaviestCount)
+            {
+                heaviestFabric = readHandler.GetAccessingFabricIndex();
+                heaviestCount  = count;
+            }
+        }
+
+        if (heaviestFabric != kUndefinedFabricIndex)
+        {
+            ShedSubscription(heaviestFabric);
+        }
+    }
+}
+
 uint32_t InteractionModelEngine::GetNumActiveWriteClients() const
 {
     uint32_t numActive = 0;
@@ -313,6 +398,11 @@ CHIP_ERROR InteractionModelEngine::OnReadInitialRequest(Messaging::ExchangeConte
         }
     }
 
+    if (aInteractionType == ReadHandler::InteractionType::Subscribe)
+    {
+        ApplySubscriptionAdmissionPolicy(apExchangeContext->GetSessionHandle().GetFabricIndex());
+    }
+
     // Reserve the last ReadHandler for ReadInteraction
     if (aInteractionType == ReadHandler::InteractionType::Subscribe &&
         ((CHIP_IM_MAX_NUM_READ_HANDLER - GetNumActiveReadHandlers()) == 1) && !HasActiveRead())
@@ -415,6 +505,20 @@ CHIP_ERROR InteractionModelEngine::OnMessageReceived(Messaging::ExchangeContext
     CHIP_ERROR err                             = CHIP_NO_ERROR;
     Protocols::InteractionModel::Status status = Protocols::InteractionModel::Status::Failure;
 
+    // Every Interaction Model payload is TLV.  Verify well-formedness and bound
+    // container nesting in a single O(1)-memory pass before any handler object is
+    // allocated, so garbage from a buggy or hostile peer is rejected at ingress
+    // instead of deep inside a parse loop.
+    {
+        TLV::TLVReader validator;
+        validator.Init(aPayload->Start(), aPayload->DataLength());
+        if (TLV::Utilities::Validate(validator, CHIP_CONFIG_IM_MAX_INCOMING_TLV_DEPTH) != CHIP_NO_ERROR)
+        {
+            ChipLogProgress(InteractionModel, "Rejecting malformed payload at ingress");
+            ExitNow(status = Protocols::InteractionModel::Status::InvalidAction);
+        }
+    }
+
     if (aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::InvokeCommandRequest))
     {
         SuccessOrExit(
@@ -573,6 +677,25 @@ bool InteractionModelEngine::IsOverlappedAttributePath(ClusterInfo & aAttributeP
     return false;
 }
 
+bool InteractionModelEngine::PathRequiresImmediateDelivery(const ConcreteAttributePath & aPath)
+{
+    for (auto & handler : mReadHandlers)
+    {
+        if (handler.IsFree() || !handler.IsSubscriptionType() || handler.GetMinIntervalFloorSeconds() != 0)
+        {
+            continue;
+        }
+        for (auto clusterInfo = handler.GetAttributeClusterInfolist(); clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
+        {
+            if (clusterInfo->IsAttributePathSupersetOf(aPath))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 void InteractionModelEngine::DispatchCommand(CommandHandler & apCommandObj, const ConcreteCommandPath & aCommandPath,
                                              TLV::TLVReader & apPayload)
 {
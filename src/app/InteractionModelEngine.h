@@ -50,6 +50,7 @@
 #include <app/ReadClient.h>
 #include <app/ReadHandler.h>
 #include <app/StatusResponse.h>
+#include <app/SubscriptionResumptionStorage.h>
 #include <app/TimedHandler.h>
 #include <app/WriteClient.h>
 #include <app/WriteHandler.h>
@@ -165,6 +166,11 @@ public:
     uint32_t GetNumActiveReadHandlers() const;
     uint32_t GetNumActiveReadClients() const;
 
+    /**
+     *  Get the number of active subscriptions held by the given fabric.
+     */
+    uint32_t GetNumActiveSubscriptions(FabricIndex aFabricIndex) const;
+
     uint32_t GetNumActiveWriteHandlers() const;
     uint32_t GetNumActiveWriteClients() const;
 
@@ -187,6 +193,17 @@ public:
 
     reporting::Engine & GetReportingEngine() { return mReportingEngine; }
 
+    /**
+     * Provide the storage used to persist active subscriptions across restarts.
+     * May be left unset, in which case subscriptions are not persisted.
+     */
+    void SetSubscriptionResumptionStorage(SubscriptionResumptionStorage * apStorage)
+    {
+        mpSubscriptionResumptionStorage = apStorage;
+    }
+
+    SubscriptionResumptionStorage * GetSubscriptionResumptionStorage() { return mpSubscriptionResumptionStorage; }
+
     void ReleaseClusterInfoList(ClusterInfo *& aClusterInfo);
     CHIP_ERROR PushFront(ClusterInfo *& aClusterInfoLisst, ClusterInfo & aClusterInfo);
     // Merges aAttributePath inside apAttributePathList if current path is overlapped with existing path in apAttributePathList
@@ -194,6 +211,11 @@ public:
     bool MergeOverlappedAttributePath(ClusterInfo * apAttributePathList, ClusterInfo & aAttributePath);
     bool IsOverlappedAttributePath(ClusterInfo & aAttributePath);
 
+    // Returns whether an active subscription with a zero minimum reporting interval covers the
+    // given attribute path.  Such subscribers expect every change promptly, so write coalescing
+    // layers must bypass their buffering for matching paths.
+    bool PathRequiresImmediateDelivery(const ConcreteAttributePath & aPath);
+
     CHIP_ERROR RegisterCommandHandler(CommandHandlerInterface * handler);
     CHIP_ERROR UnregisterCommandHandler(CommandHandlerInterface * handler);
     CommandHandlerInterface * FindCommandHandler(EndpointId endpointId, ClusterId clusterId);
@@ -278,9 +300,28 @@ private:
 
     bool HasActiveRead();
 
+    /**
+     * Make room for an incoming subscribe request from the given fabric:
+     * enforce the per-fabric quota (CHIP_IM_MAX_NUM_SUBSCRIPTIONS_PER_FABRIC)
+     * against the requester itself, and under pool pressure shed a
+     * subscription from the fabric holding the most of them, provided it holds
+     * strictly more than the requester.
+     */
+    void ApplySubscriptionAdmissionPolicy(FabricIndex aRequestingFabric);
+
+    /**
+     * Shut down the given fabric's cheapest-to-lose subscription: the one
+     * whose interest list carries the highest path cost, i.e. the one that is
+     * the most expensive to keep serving. Returns false if the fabric holds no
+     * subscription.
+     */
+    bool ShedSubscription(FabricIndex aFabricIndex);
+
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
     InteractionModelDelegate * mpDelegate      = nullptr;
 
+    SubscriptionResumptionStorage * mpSubscriptionResumptionStorage = nullptr;
+
     CommandHandlerInterface * mCommandHandlerList = nullptr;
 
     // TODO(#8006): investgate if we can disable some IM functions on some compact accessories.
@@ -339,6 +380,23 @@ CHIP_ERROR ReadSingleClusterData(const Access::SubjectDescriptor & aSubjectDescr
                                  AttributeReportIBs::Builder & aAttributeReports,
                                  AttributeValueEncoder::AttributeEncodeState * apEncoderState);
 
+/**
+ * Returns the current data version of the given server cluster, as emitted in
+ * AttributeDataIBs and compared against client DataVersionFilterIBs.  Like
+ * ReadSingleClusterData, this is provided by the cluster data storage
+ * implementation.  Returns 0 if the cluster does not exist.
+ */
+DataVersion GetClusterDataVersion(EndpointId aEndpointId, ClusterId aClusterId);
+
+/**
+ * Returns a generation counter that advances whenever any attribute data in
+ * the cluster data storage changes.  The reporting engine compares generations
+ * taken before and after encoding an attribute to detect mutations made
+ * reentrantly by application read callbacks, so it can re-encode a consistent
+ * snapshot instead of reporting a mix of old and new data.
+ */
+uint32_t GetAttributeStoreGeneration();
+
 /**
  * TODO: Document.
  */
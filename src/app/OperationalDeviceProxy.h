@@ -55,6 +55,10 @@ struct DeviceProxyInitParams
     FabricTable * fabricTable                = nullptr;
     CASEClientPoolDelegate * clientPool      = nullptr;
 
+    // Optional cache of previously established CASE session state, shared by all CASE
+    // clients so reconnects can use session resumption.
+    CASESessionCache * sessionResumptionCache = nullptr;
+
     Controller::DeviceControllerInteractionModelDelegate * imDelegate = nullptr;
 
     Optional<ReliableMessageProtocolConfig> mrpLocalConfig = Optional<ReliableMessageProtocolConfig>::Missing();
@@ -48,16 +48,30 @@ public:
 
     OperationalDeviceProxy * Allocate(DeviceProxyInitParams & params, PeerId peerId) override
     {
-        return mDevicePool.CreateObject(params, peerId);
+        OperationalDeviceProxy * device = mDevicePool.CreateObject(params, peerId);
+        if (device != nullptr)
+        {
+            IndexInsert(device);
+        }
+        return device;
     }
 
     OperationalDeviceProxy * Allocate(DeviceProxyInitParams & params, PeerId peerId,
                                       const Dnssd::ResolvedNodeData & nodeResolutionData) override
     {
-        return mDevicePool.CreateObject(params, peerId, nodeResolutionData);
+        OperationalDeviceProxy * device = mDevicePool.CreateObject(params, peerId, nodeResolutionData);
+        if (device != nullptr)
+        {
+            IndexInsert(device);
+        }
+        return device;
     }
 
-    void Release(OperationalDeviceProxy * device) override { mDevicePool.ReleaseObject(device); }
+    void Release(OperationalDeviceProxy * device) override
+    {
+        IndexRemove(device);
+        mDevicePool.ReleaseObject(device);
+    }
 
     OperationalDeviceProxy * FindDevice(const SessionHandle & session) override
     {
@@ -76,21 +90,86 @@ public:
 
     OperationalDeviceProxy * FindDevice(PeerId peerId) override
     {
-        OperationalDeviceProxy * foundDevice = nullptr;
-        mDevicePool.ForEachActiveObject([&](auto * activeDevice) {
-            if (activeDevice->GetPeerId() == peerId)
+        size_t slot = IndexHash(peerId);
+        while (mDeviceIndex[slot] != nullptr)
+        {
+            if (mDeviceIndex[slot]->GetPeerId() == peerId)
             {
-                foundDevice = activeDevice;
-                return Loop::Break;
+                return mDeviceIndex[slot];
             }
-            return Loop::Continue;
-        });
-
-        return foundDevice;
+            slot = (slot + 1) & kIndexMask;
+        }
+        return nullptr;
     }
 
 private:
+    static constexpr size_t NextPowerOfTwo(size_t value)
+    {
+        size_t power = 1;
+        while (power < value)
+        {
+            power <<= 1;
+        }
+        return power;
+    }
+
+    // PeerId-keyed index over the pool, maintained on Allocate/Release so
+    // FindDevice(PeerId) does not scan every pooled proxy on each lookup.
+    // Open addressing with linear probing; kept at most half full so probe
+    // chains stay short even when the pool itself is exhausted.
+    static constexpr size_t kIndexSize = NextPowerOfTwo(2 * N);
+    static constexpr size_t kIndexMask = kIndexSize - 1;
+
+    static size_t IndexHash(PeerId peerId)
+    {
+        uint64_t hash = peerId.GetNodeId() ^ (peerId.GetCompressedFabricId() * 0x9E3779B97F4A7C15ULL);
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDULL;
+        hash ^= hash >> 33;
+        return static_cast<size_t>(hash) & kIndexMask;
+    }
+
+    void IndexInsert(OperationalDeviceProxy * device)
+    {
+        size_t slot = IndexHash(device->GetPeerId());
+        while (mDeviceIndex[slot] != nullptr)
+        {
+            slot = (slot + 1) & kIndexMask;
+        }
+        mDeviceIndex[slot] = device;
+    }
+
+    void IndexRemove(OperationalDeviceProxy * device)
+    {
+        size_t slot = IndexHash(device->GetPeerId());
+        while (mDeviceIndex[slot] != device)
+        {
+            if (mDeviceIndex[slot] == nullptr)
+            {
+                return; // never indexed, e.g. released twice
+            }
+            slot = (slot + 1) & kIndexMask;
+        }
+
+        // Backward-shift deletion keeps probe chains intact without leaving
+        // tombstones behind, so lookup cost does not grow with churn.
+        size_t hole = slot;
+        size_t next = (hole + 1) & kIndexMask;
+        while (mDeviceIndex[next] != nullptr)
+        {
+            const size_t home = IndexHash(mDeviceIndex[next]->GetPeerId());
+            if (((next - home) & kIndexMask) >= ((next - hole) & kIndexMask))
+            {
+                mDeviceIndex[hole] = mDeviceIndex[next];
+                hole               = next;
+            }
+            next = (next + 1) & kIndexMask;
+        }
+        mDeviceIndex[hole] = nullptr;
+    }
+
     BitMapObjectPool<OperationalDeviceProxy, N> mDevicePool;
+    OperationalDeviceProxy * mDeviceIndex[kIndexSize] = {};
 };
 
 }; // namespace chip
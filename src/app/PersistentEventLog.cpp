@@ -0,0 +1,245 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/PersistentEventLog.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/BufferReader.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string.h>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+constexpr uint8_t kEventLogStateVersion = 1;
+
+// State record: version, oldest segment slot, segment count.
+constexpr uint16_t kEventLogStateSize = sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint16_t);
+
+uint32_t Crc32(const uint8_t * data, size_t length)
+{
+    // CRC-32 (reflected polynomial 0xEDB88320), computed bitwise to avoid a
+    // lookup table; segments are written rarely enough that speed is moot.
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; ++i)
+    {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320 : 0);
+        }
+    }
+    return ~crc;
+}
+
+} // namespace
+
+CHIP_ERROR PersistentEventLog::Init(PersistentStorageDelegate * apStorage, uint8_t * apStagingBuffer, uint32_t aStagingBufferSize,
+                                    uint16_t aMaxSegments)
+{
+    VerifyOrReturnError(apStorage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(apStagingBuffer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aStagingBufferSize > kSegmentOverhead + kEventFrameOverhead, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aStagingBufferSize <= UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aMaxSegments > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mpStorage            = apStorage;
+    mpStagingBuffer      = apStagingBuffer;
+    mStagingBufferSize   = aStagingBufferSize;
+    mStagedPayloadLength = 0;
+    mMaxSegments         = aMaxSegments;
+    mReplayAllowed       = true;
+
+    if (LoadState() != CHIP_NO_ERROR)
+    {
+        // Missing or corrupt state record: start over with an empty log.
+        mFirstSegment = 0;
+        mSegmentCount = 0;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistentEventLog::Append(EventNumber aEventNumber, const uint8_t * apData, uint32_t aDataLength)
+{
+    VerifyOrReturnError(mpStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(apData != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const uint32_t frameLength = kEventFrameOverhead + aDataLength;
+    VerifyOrReturnError(frameLength <= SegmentCapacity(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    if (mStagedPayloadLength + frameLength > SegmentCapacity())
+    {
+        ReturnErrorOnFailure(FlushStagedSegment());
+    }
+
+    Encoding::LittleEndian::BufferWriter writer(mpStagingBuffer + kSegmentOverhead + mStagedPayloadLength,
+                                                SegmentCapacity() - mStagedPayloadLength);
+    writer.Put64(aEventNumber).Put16(static_cast<uint16_t>(aDataLength)).Put(apData, aDataLength);
+    VerifyOrReturnError(writer.Fit(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    mStagedPayloadLength += frameLength;
+    mReplayAllowed = false;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistentEventLog::Flush()
+{
+    VerifyOrReturnError(mpStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mStagedPayloadLength != 0, CHIP_NO_ERROR);
+    return FlushStagedSegment();
+}
+
+CHIP_ERROR PersistentEventLog::FlushStagedSegment()
+{
+    DefaultStorageKeyAllocator key;
+
+    // Frame the staged payload: length first, then CRC over length + payload,
+    // so that a torn write fails the check regardless of where it tore.
+    Encoding::LittleEndian::Put16(mpStagingBuffer + sizeof(uint32_t), static_cast<uint16_t>(mStagedPayloadLength));
+    const uint32_t crc = Crc32(mpStagingBuffer + sizeof(uint32_t), sizeof(uint16_t) + mStagedPayloadLength);
+    Encoding::LittleEndian::Put32(mpStagingBuffer, crc);
+
+    const uint16_t slot = static_cast<uint16_t>((mFirstSegment + mSegmentCount) % mMaxSegments);
+    ReturnErrorOnFailure(mpStorage->SyncSetKeyValue(key.EventLogSegment(slot), mpStagingBuffer,
+                                                    static_cast<uint16_t>(kSegmentOverhead + mStagedPayloadLength)));
+
+    if (mSegmentCount < mMaxSegments)
+    {
+        mSegmentCount++;
+    }
+    else
+    {
+        // Ring is full: the slot just written replaces the oldest segment.
+        mFirstSegment = static_cast<uint16_t>((mFirstSegment + 1) % mMaxSegments);
+    }
+    mStagedPayloadLength = 0;
+    return SaveState();
+}
+
+CHIP_ERROR PersistentEventLog::Replay(EventVisitor aVisitor, void * apContext)
+{
+    VerifyOrReturnError(mpStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(aVisitor != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mReplayAllowed, CHIP_ERROR_INCORRECT_STATE);
+
+    DefaultStorageKeyAllocator key;
+
+    for (uint16_t i = 0; i < mSegmentCount; ++i)
+    {
+        const uint16_t slot = static_cast<uint16_t>((mFirstSegment + i) % mMaxSegments);
+        uint16_t size       = static_cast<uint16_t>(mStagingBufferSize);
+        CHIP_ERROR err      = mpStorage->SyncGetKeyValue(key.EventLogSegment(slot), mpStagingBuffer, size);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogProgress(EventLogging, "Skipping unreadable event log segment %u: %s", slot, ErrorStr(err));
+            continue;
+        }
+        if (size < kSegmentOverhead)
+        {
+            ChipLogProgress(EventLogging, "Skipping truncated event log segment %u", slot);
+            continue;
+        }
+
+        Encoding::LittleEndian::Reader header(mpStagingBuffer, size);
+        uint32_t crc           = 0;
+        uint16_t payloadLength = 0;
+        ReturnErrorOnFailure(header.Read32(&crc).Read16(&payloadLength).StatusCode());
+        if (payloadLength != size - kSegmentOverhead ||
+            crc != Crc32(mpStagingBuffer + sizeof(uint32_t), sizeof(uint16_t) + payloadLength))
+        {
+            // Most likely a write torn by power loss; the events in this
+            // segment are gone, but the rest of the log is still usable.
+            ChipLogProgress(EventLogging, "Skipping corrupt event log segment %u", slot);
+            continue;
+        }
+
+        Encoding::LittleEndian::Reader payload(mpStagingBuffer + kSegmentOverhead, payloadLength);
+        while (payload.Remaining() >= kEventFrameOverhead)
+        {
+            uint64_t eventNumber = 0;
+            uint16_t eventLength = 0;
+            ReturnErrorOnFailure(payload.Read64(&eventNumber).Read16(&eventLength).StatusCode());
+            VerifyOrReturnError(eventLength <= payload.Remaining(), CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+            TLV::TLVReader reader;
+            reader.Init(mpStagingBuffer + kSegmentOverhead + (payloadLength - payload.Remaining()), eventLength);
+            ReturnErrorOnFailure(aVisitor(static_cast<EventNumber>(eventNumber), reader, apContext));
+            ReturnErrorOnFailure(payload.Skip(eventLength).StatusCode());
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistentEventLog::Clear()
+{
+    VerifyOrReturnError(mpStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    DefaultStorageKeyAllocator key;
+    for (uint16_t i = 0; i < mSegmentCount; ++i)
+    {
+        const uint16_t slot = static_cast<uint16_t>((mFirstSegment + i) % mMaxSegments);
+        // A missing segment is already in the desired state.
+        (void) mpStorage->SyncDeleteKeyValue(key.EventLogSegment(slot));
+    }
+    mFirstSegment        = 0;
+    mSegmentCount        = 0;
+    mStagedPayloadLength = 0;
+    mReplayAllowed       = true;
+    return SaveState();
+}
+
+CHIP_ERROR PersistentEventLog::LoadState()
+{
+    DefaultStorageKeyAllocator key;
+    uint8_t state[kEventLogStateSize];
+    uint16_t size = sizeof(state);
+
+    ReturnErrorOnFailure(mpStorage->SyncGetKeyValue(key.EventLogState(), state, size));
+    VerifyOrReturnError(size == sizeof(state), CHIP_ERROR_INVALID_ARGUMENT);
+
+    Encoding::LittleEndian::Reader reader(state, size);
+    uint8_t version       = 0;
+    uint16_t firstSegment = 0;
+    uint16_t segmentCount = 0;
+    ReturnErrorOnFailure(reader.Read8(&version).Read16(&firstSegment).Read16(&segmentCount).StatusCode());
+    VerifyOrReturnError(version == kEventLogStateVersion, CHIP_ERROR_VERSION_MISMATCH);
+    VerifyOrReturnError(firstSegment < mMaxSegments && segmentCount <= mMaxSegments, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mFirstSegment = firstSegment;
+    mSegmentCount = segmentCount;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistentEventLog::SaveState()
+{
+    DefaultStorageKeyAllocator key;
+    uint8_t state[kEventLogStateSize];
+
+    Encoding::LittleEndian::BufferWriter writer(state, sizeof(state));
+    writer.Put8(kEventLogStateVersion).Put16(mFirstSegment).Put16(mSegmentCount);
+    return mpStorage->SyncSetKeyValue(key.EventLogState(), state, static_cast<uint16_t>(writer.Needed()));
+}
+
+} // namespace app
+} // namespace chip
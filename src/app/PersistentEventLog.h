@@ -0,0 +1,134 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * @brief
+ *   Append-only persistent storage for logged events, so that events survive
+ *   a crash or reboot and can be replayed into the in-memory event buffers
+ *   (see EventManagement::ReplayPersistedEvents()).
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/core/DataModelTypes.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * @brief
+ *   A segment-structured, append-only event log on top of a
+ *   PersistentStorageDelegate.
+ *
+ *   Appended events accumulate in a caller-supplied RAM staging buffer; the
+ *   backend is only written when a whole segment fills up (or on an explicit
+ *   Flush()), so persistence adds no storage latency to the per-event logging
+ *   path.  Sizing the staging buffer to the backend's natural write unit
+ *   (e.g. a flash page) keeps each storage write sector-aligned.
+ *
+ *   Each segment is framed with a CRC over its contents, so a write torn by
+ *   power loss is detected and skipped at replay rather than corrupting the
+ *   log.  Segments form a ring: once all slots hold data, appending a new
+ *   segment overwrites the oldest one.
+ */
+class PersistentEventLog
+{
+public:
+    /// Segment framing: CRC-32 over the remainder, then payload length.
+    static constexpr uint32_t kSegmentOverhead = sizeof(uint32_t) + sizeof(uint16_t);
+
+    /// Per-event framing within a segment payload: event number, TLV length.
+    static constexpr uint32_t kEventFrameOverhead = sizeof(EventNumber) + sizeof(uint16_t);
+
+    /**
+     * Visitor invoked by Replay() for each intact persisted event, oldest
+     * first.  The reader is positioned before the event's TLV element; the
+     * visitor calls Next() and copies or inspects the element as needed.
+     * Returning an error aborts the replay.
+     */
+    using EventVisitor = CHIP_ERROR (*)(EventNumber aEventNumber, TLV::TLVReader & aReader, void * apContext);
+
+    /**
+     * Initialize the log and load the segment ring state left by a previous
+     * boot.  A missing or corrupt state record starts an empty log.
+     *
+     * @param[in] apStorage           Backend to persist segments into.
+     * @param[in] apStagingBuffer     RAM buffer holding the segment being
+     *                                assembled; must stay valid for the
+     *                                lifetime of the log.
+     * @param[in] aStagingBufferSize  Size of the staging buffer; this is the
+     *                                segment size written to the backend and
+     *                                must exceed kSegmentOverhead plus
+     *                                kEventFrameOverhead.
+     * @param[in] aMaxSegments        Number of segment slots in the ring.
+     */
+    CHIP_ERROR Init(PersistentStorageDelegate * apStorage, uint8_t * apStagingBuffer, uint32_t aStagingBufferSize,
+                    uint16_t aMaxSegments);
+
+    /**
+     * Stage one event for persistence.  The data is copied into the staging
+     * buffer; the backend is only touched when the segment in progress has no
+     * room left, in which case it is flushed before the event is staged.
+     *
+     * @return CHIP_ERROR_BUFFER_TOO_SMALL if the event can never fit in a
+     *         segment; such events are simply not persisted.
+     */
+    CHIP_ERROR Append(EventNumber aEventNumber, const uint8_t * apData, uint32_t aDataLength);
+
+    /**
+     * Write the partially filled segment in progress, if any, to the backend.
+     * Intended for orderly shutdown; events staged since the last segment
+     * boundary are otherwise lost on power failure.
+     */
+    CHIP_ERROR Flush();
+
+    /**
+     * Invoke the visitor for every intact persisted event, oldest segment
+     * first.  Segments that fail their CRC check (torn writes) are skipped.
+     * Must be called before any Append() in this boot; the staging buffer is
+     * reused as scratch space for reading segments back.
+     */
+    CHIP_ERROR Replay(EventVisitor aVisitor, void * apContext);
+
+    /// Discard all persisted segments and any staged events.
+    CHIP_ERROR Clear();
+
+private:
+    CHIP_ERROR LoadState();
+    CHIP_ERROR SaveState();
+    CHIP_ERROR FlushStagedSegment();
+
+    uint32_t SegmentCapacity() const { return mStagingBufferSize - kSegmentOverhead; }
+
+    PersistentStorageDelegate * mpStorage = nullptr;
+    uint8_t * mpStagingBuffer             = nullptr;
+    uint32_t mStagingBufferSize           = 0;
+    uint32_t mStagedPayloadLength         = 0;
+    uint16_t mMaxSegments                 = 0;
+    uint16_t mFirstSegment                = 0; ///< Ring slot holding the oldest segment.
+    uint16_t mSegmentCount                = 0;
+    bool mReplayAllowed                   = false;
+};
+
+} // namespace app
+} // namespace chip
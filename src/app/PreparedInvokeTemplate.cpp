@@ -0,0 +1,178 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/PreparedInvokeTemplate.h>
+
+#include <app/StatusResponse.h>
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+
+CHIP_ERROR PreparedInvokeTemplate::Begin(const CommandPathParams & aCommandPath, const Optional<uint16_t> & aTimedInvokeTimeoutMs)
+{
+    VerifyOrReturnError(mState == State::Idle, CHIP_ERROR_INCORRECT_STATE);
+
+    mCommandMessageWriter.Reset();
+
+    System::PacketBufferHandle commandPacket = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+    VerifyOrReturnError(!commandPacket.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    mCommandMessageWriter.Init(std::move(commandPacket));
+    ReturnErrorOnFailure(mInvokeRequestBuilder.Init(&mCommandMessageWriter));
+
+    mInvokeRequestBuilder.SuppressResponse(false).TimedRequest(aTimedInvokeTimeoutMs.HasValue());
+    ReturnErrorOnFailure(mInvokeRequestBuilder.GetError());
+
+    mInvokeRequestBuilder.CreateInvokeRequests();
+    ReturnErrorOnFailure(mInvokeRequestBuilder.GetError());
+
+    InvokeRequests::Builder & invokeRequests = mInvokeRequestBuilder.GetInvokeRequests();
+    CommandDataIB::Builder & invokeRequest   = invokeRequests.CreateCommandData();
+    ReturnErrorOnFailure(invokeRequests.GetError());
+    CommandPathIB::Builder & path = invokeRequest.CreatePath();
+    ReturnErrorOnFailure(invokeRequest.GetError());
+    ReturnErrorOnFailure(path.Encode(aCommandPath));
+
+    ReturnErrorOnFailure(invokeRequest.GetWriter()->StartContainer(TLV::ContextTag(to_underlying(CommandDataIB::Tag::kData)),
+                                                                   TLV::kTLVType_Structure, mDataElementContainerType));
+
+    mTimedInvokeTimeoutMs = aTimedInvokeTimeoutMs;
+    mState                = State::Encoding;
+    return CHIP_NO_ERROR;
+}
+
+TLV::TLVWriter * PreparedInvokeTemplate::GetCommandDataIBTLVWriter()
+{
+    if (mState != State::Encoding)
+    {
+        return nullptr;
+    }
+
+    return mInvokeRequestBuilder.GetInvokeRequests().GetCommandData().GetWriter();
+}
+
+CHIP_ERROR PreparedInvokeTemplate::RecordPatchField(uint8_t aWidth, uint8_t & outFieldIndex)
+{
+    VerifyOrReturnError(mNumPatchFields < kMaxPatchFields, CHIP_ERROR_NO_MEMORY);
+
+    // The writer is backed by a single buffer, so the total length written so
+    // far is also the offset just past the value bytes in the sealed payload.
+    const uint32_t lengthWritten = mCommandMessageWriter.GetLengthWritten();
+
+    mPatchFields[mNumPatchFields].offset = static_cast<uint16_t>(lengthWritten - aWidth);
+    mPatchFields[mNumPatchFields].width  = aWidth;
+    outFieldIndex                        = mNumPatchFields++;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PreparedInvokeTemplate::AddPatchableUInt8(TLV::Tag aTag, uint8_t aInitialValue, uint8_t & outFieldIndex)
+{
+    TLV::TLVWriter * writer = GetCommandDataIBTLVWriter();
+    VerifyOrReturnError(writer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    ReturnErrorOnFailure(writer->Put(aTag, aInitialValue, /* preserveSize = */ true));
+    return RecordPatchField(sizeof(uint8_t), outFieldIndex);
+}
+
+CHIP_ERROR PreparedInvokeTemplate::AddPatchableUInt16(TLV::Tag aTag, uint16_t aInitialValue, uint8_t & outFieldIndex)
+{
+    TLV::TLVWriter * writer = GetCommandDataIBTLVWriter();
+    VerifyOrReturnError(writer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    ReturnErrorOnFailure(writer->Put(aTag, aInitialValue, /* preserveSize = */ true));
+    return RecordPatchField(sizeof(uint16_t), outFieldIndex);
+}
+
+CHIP_ERROR PreparedInvokeTemplate::AddPatchableUInt32(TLV::Tag aTag, uint32_t aInitialValue, uint8_t & outFieldIndex)
+{
+    TLV::TLVWriter * writer = GetCommandDataIBTLVWriter();
+    VerifyOrReturnError(writer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    ReturnErrorOnFailure(writer->Put(aTag, aInitialValue, /* preserveSize = */ true));
+    return RecordPatchField(sizeof(uint32_t), outFieldIndex);
+}
+
+CHIP_ERROR PreparedInvokeTemplate::Finish()
+{
+    VerifyOrReturnError(mState == State::Encoding, CHIP_ERROR_INCORRECT_STATE);
+
+    CommandDataIB::Builder & commandData = mInvokeRequestBuilder.GetInvokeRequests().GetCommandData();
+
+    ReturnErrorOnFailure(commandData.GetWriter()->EndContainer(mDataElementContainerType));
+    ReturnErrorOnFailure(commandData.EndOfCommandDataIB().GetError());
+    ReturnErrorOnFailure(mInvokeRequestBuilder.GetInvokeRequests().EndOfInvokeRequests().GetError());
+    ReturnErrorOnFailure(mInvokeRequestBuilder.EndOfInvokeRequestMessage().GetError());
+    ReturnErrorOnFailure(mCommandMessageWriter.Finalize(&mTemplateData));
+
+    mState = State::Ready;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PreparedInvokeTemplate::PatchField32(uint8_t aFieldIndex, uint8_t aWidth, uint32_t aValue)
+{
+    VerifyOrReturnError(mState == State::Ready, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(aFieldIndex < mNumPatchFields, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const PatchField & field = mPatchFields[aFieldIndex];
+    VerifyOrReturnError(field.width == aWidth, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // TLV integer values are encoded little-endian.
+    uint8_t * p = mTemplateData->Start() + field.offset;
+    switch (aWidth)
+    {
+    case sizeof(uint8_t):
+        Encoding::Write8(p, static_cast<uint8_t>(aValue));
+        break;
+    case sizeof(uint16_t):
+        Encoding::LittleEndian::Write16(p, static_cast<uint16_t>(aValue));
+        break;
+    case sizeof(uint32_t):
+        Encoding::LittleEndian::Write32(p, aValue);
+        break;
+    default:
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PreparedInvokeTemplate::PatchUInt8(uint8_t aFieldIndex, uint8_t aValue)
+{
+    return PatchField32(aFieldIndex, sizeof(uint8_t), aValue);
+}
+
+CHIP_ERROR PreparedInvokeTemplate::PatchUInt16(uint8_t aFieldIndex, uint16_t aValue)
+{
+    return PatchField32(aFieldIndex, sizeof(uint16_t), aValue);
+}
+
+CHIP_ERROR PreparedInvokeTemplate::PatchUInt32(uint8_t aFieldIndex, uint32_t aValue)
+{
+    return PatchField32(aFieldIndex, sizeof(uint32_t), aValue);
+}
+
+CHIP_ERROR PreparedInvokeTemplate::PrepareInvoke(CommandSender & aCommandSender) const
+{
+    VerifyOrReturnError(mState == State::Ready, CHIP_ERROR_INCORRECT_STATE);
+
+    System::PacketBufferHandle request = mTemplateData.CloneData();
+    VerifyOrReturnError(!request.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    return aCommandSender.SetPreparedInvokeRequest(std::move(request), mTimedInvokeTimeoutMs);
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,144 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a reusable, pre-encoded invoke request template
+ *      whose variable fields are patched in place per send.
+ */
+
+#pragma once
+
+#include <app/CommandPathParams.h>
+#include <app/CommandSender.h>
+#include <app/MessageDef/InvokeRequestMessage.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/core/Optional.h>
+#include <system/SystemPacketBuffer.h>
+#include <system/TLVPacketBufferBackingStore.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * @brief
+ *   A pre-encoded invoke request whose variable fields can be patched in
+ *   place, for senders that issue the same command shape repeatedly.
+ *
+ *   A CommandSender re-encodes the full InvokeRequestMessage TLV on every
+ *   send.  When an application sends the same command thousands of times
+ *   varying only a few numeric fields (e.g. a scheduler driving MoveToLevel),
+ *   that per-send encode is pure overhead.  This class encodes the invariant
+ *   message skeleton once; fields registered as patchable are written with a
+ *   fixed-width TLV encoding and their offsets recorded, so a subsequent send
+ *   costs a few in-place stores plus one buffer clone.
+ *
+ *   Usage:
+ *     - Begin() starts the template for a command path, after which invariant
+ *       fields are written through GetCommandDataIBTLVWriter() and variable
+ *       fields are registered with AddPatchableUIntN(), interleaved in the
+ *       field order the command expects.
+ *     - Finish() seals the template.
+ *     - Per send: PatchUIntN() updates the variable fields, then
+ *       PrepareInvoke() loads a clone of the template into a CommandSender,
+ *       which is then sent as usual with SendCommandRequest().
+ */
+class PreparedInvokeTemplate
+{
+public:
+    // Maximum number of patchable fields a template can carry.
+    static constexpr size_t kMaxPatchFields = 4;
+
+    /**
+     * Start encoding a template for the given command path.  If a timed
+     * invoke timeout is provided, every invoke prepared from this template
+     * will be a timed invoke with that timeout.
+     */
+    CHIP_ERROR Begin(const CommandPathParams & aCommandPath, const Optional<uint16_t> & aTimedInvokeTimeoutMs = NullOptional);
+
+    /**
+     * Writer positioned inside the CommandFields struct, for encoding the
+     * invariant fields of the command.  Returns nullptr unless encoding is in
+     * progress.
+     */
+    TLV::TLVWriter * GetCommandDataIBTLVWriter();
+
+    /**
+     * Encode an unsigned integer command field with a fixed-width TLV
+     * representation and register it for in-place patching.  On success
+     * outFieldIndex identifies the field for the PatchUIntN() calls.
+     */
+    CHIP_ERROR AddPatchableUInt8(TLV::Tag aTag, uint8_t aInitialValue, uint8_t & outFieldIndex);
+    CHIP_ERROR AddPatchableUInt16(TLV::Tag aTag, uint16_t aInitialValue, uint8_t & outFieldIndex);
+    CHIP_ERROR AddPatchableUInt32(TLV::Tag aTag, uint32_t aInitialValue, uint8_t & outFieldIndex);
+
+    /**
+     * Seal the template.  After this succeeds the template can be patched and
+     * sent any number of times.
+     */
+    CHIP_ERROR Finish();
+
+    /**
+     * Update a patchable field in the sealed template.  The width must match
+     * the AddPatchableUIntN() call that registered the field.
+     */
+    CHIP_ERROR PatchUInt8(uint8_t aFieldIndex, uint8_t aValue);
+    CHIP_ERROR PatchUInt16(uint8_t aFieldIndex, uint16_t aValue);
+    CHIP_ERROR PatchUInt32(uint8_t aFieldIndex, uint32_t aValue);
+
+    /**
+     * Load a clone of the (patched) template into the given idle
+     * CommandSender, leaving it ready for SendCommandRequest().
+     */
+    CHIP_ERROR PrepareInvoke(CommandSender & aCommandSender) const;
+
+    /**
+     * The sealed request payload.  Exposed for tests; invalid before Finish()
+     * succeeds.
+     */
+    const System::PacketBufferHandle & GetTemplateData() const { return mTemplateData; }
+
+private:
+    enum class State : uint8_t
+    {
+        Idle,     ///< Begin() has not been called.
+        Encoding, ///< Between Begin() and Finish().
+        Ready,    ///< Sealed; may be patched and sent.
+    };
+
+    struct PatchField
+    {
+        uint16_t offset; ///< Offset of the value bytes within the sealed payload.
+        uint8_t width;   ///< Value width in bytes.
+    };
+
+    CHIP_ERROR RecordPatchField(uint8_t aWidth, uint8_t & outFieldIndex);
+    CHIP_ERROR PatchField32(uint8_t aFieldIndex, uint8_t aWidth, uint32_t aValue);
+
+    State mState = State::Idle;
+    uint8_t mNumPatchFields = 0;
+    PatchField mPatchFields[kMaxPatchFields];
+    Optional<uint16_t> mTimedInvokeTimeoutMs;
+    TLV::TLVType mDataElementContainerType = TLV::kTLVType_NotSpecified;
+    InvokeRequestMessage::Builder mInvokeRequestBuilder;
+    System::PacketBufferTLVWriter mCommandMessageWriter;
+    System::PacketBufferHandle mTemplateData;
+};
+
+} // namespace app
+} // namespace chip
@@ -24,9 +24,11 @@
 
 #include "lib/core/CHIPTLVTypes.h"
 #include <app/AppBuildConfig.h>
+#include <app/InteractionLatencyStats.h>
 #include <app/InteractionModelEngine.h>
 #include <app/ReadClient.h>
 #include <app/StatusResponse.h>
+#include <lib/core/CHIPTLVUtilities.hpp>
 
 namespace chip {
 namespace app {
@@ -164,6 +166,15 @@ CHIP_ERROR ReadClient::SendReadRequest(ReadPrepareParams & aReadPrepareParams)
             SuccessOrExit(err);
         }
 
+        if (aReadPrepareParams.mDataVersionFilterListSize != 0 && aReadPrepareParams.mpDataVersionFilterList != nullptr)
+        {
+            DataVersionFilterIBs::Builder & dataVersionFilterListBuilder = request.CreateDataVersionFilters();
+            SuccessOrExit(err = request.GetError());
+            err = GenerateDataVersionFilterList(dataVersionFilterListBuilder, aReadPrepareParams.mpDataVersionFilterList,
+                                                aReadPrepareParams.mDataVersionFilterListSize);
+            SuccessOrExit(err);
+        }
+
         if (aReadPrepareParams.mEventPathParamsListSize != 0 && aReadPrepareParams.mpEventPathParamsList != nullptr)
         {
             EventPathIBs::Builder & eventPathListBuilder = request.CreateEventRequests();
@@ -203,6 +214,10 @@ CHIP_ERROR ReadClient::SendReadRequest(ReadPrepareParams & aReadPrepareParams)
     mPeerNodeId  = aReadPrepareParams.mSessionHandle.GetPeerNodeId();
     mFabricIndex = aReadPrepareParams.mSessionHandle.GetFabricIndex();
 
+#if CHIP_CONFIG_IM_LATENCY_STATS
+    mRequestStartTime = System::SystemClock().GetMonotonicTimestamp();
+#endif
+
     MoveToState(ClientState::AwaitingInitialReport);
 
 exit:
@@ -245,14 +260,55 @@ CHIP_ERROR ReadClient::GenerateAttributePathList(AttributePathIBs::Builder & aAt
     return aAttributePathIBsBuilder.GetError();
 }
 
+CHIP_ERROR ReadClient::GenerateDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
+                                                     DataVersionFilter * apDataVersionFilterList,
+                                                     size_t aDataVersionFilterListSize)
+{
+    for (size_t index = 0; index < aDataVersionFilterListSize; index++)
+    {
+        VerifyOrReturnError(apDataVersionFilterList[index].IsValidDataVersionFilter(),
+                            CHIP_ERROR_IM_MALFORMED_DATA_VERSION_FILTER_IB);
+        DataVersionFilterIB::Builder & filter = aDataVersionFilterIBsBuilder.CreateDataVersionFilter();
+        ReturnErrorOnFailure(aDataVersionFilterIBsBuilder.GetError());
+        ClusterPathIB::Builder & path = filter.CreatePath();
+        ReturnErrorOnFailure(filter.GetError());
+        path.Endpoint(apDataVersionFilterList[index].mEndpointId)
+            .Cluster(apDataVersionFilterList[index].mClusterId)
+            .EndOfClusterPathIB();
+        ReturnErrorOnFailure(path.GetError());
+        filter.DataVersion(apDataVersionFilterList[index].mDataVersion).EndOfDataVersionFilterIB();
+        ReturnErrorOnFailure(filter.GetError());
+    }
+    aDataVersionFilterIBsBuilder.EndOfDataVersionFilterIBs();
+    return aDataVersionFilterIBsBuilder.GetError();
+}
+
 CHIP_ERROR ReadClient::OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PayloadHeader & aPayloadHeader,
                                          System::PacketBufferHandle && aPayload)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     VerifyOrExit(!IsFree(), err = CHIP_ERROR_INCORRECT_STATE);
     VerifyOrExit(mpCallback != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+
+    // Reports come from peers whose encoders we do not control.  Verify
+    // well-formedness and bound container nesting in a single O(1)-memory pass
+    // before the parse loops below allocate anything.
+    {
+        TLV::TLVReader validator;
+        validator.Init(aPayload->Start(), aPayload->DataLength());
+        VerifyOrExit(TLV::Utilities::Validate(validator, CHIP_CONFIG_IM_MAX_INCOMING_TLV_DEPTH) == CHIP_NO_ERROR,
+                     err = CHIP_ERROR_INVALID_TLV_ELEMENT);
+    }
+
     if (aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::ReportData))
     {
+#if CHIP_CONFIG_IM_LATENCY_STATS
+        if (IsAwaitingInitialReport())
+        {
+            const System::Clock::Milliseconds64 roundTrip = System::SystemClock().GetMonotonicTimestamp() - mRequestStartTime;
+            GlobalInteractionLatencyStats().Record(mPeerNodeId, static_cast<uint32_t>(roundTrip.count()));
+        }
+#endif
         err = ProcessReportData(std::move(aPayload));
         SuccessOrExit(err);
     }
@@ -671,6 +727,15 @@ CHIP_ERROR ReadClient::SendSubscribeRequest(ReadPrepareParams & aReadPreparePara
         SuccessOrExit(err);
     }
 
+    if (aReadPrepareParams.mDataVersionFilterListSize != 0 && aReadPrepareParams.mpDataVersionFilterList != nullptr)
+    {
+        DataVersionFilterIBs::Builder & dataVersionFilterListBuilder = request.CreateDataVersionFilters();
+        SuccessOrExit(err = request.GetError());
+        err = GenerateDataVersionFilterList(dataVersionFilterListBuilder, aReadPrepareParams.mpDataVersionFilterList,
+                                            aReadPrepareParams.mDataVersionFilterListSize);
+        SuccessOrExit(err);
+    }
+
     if (aReadPrepareParams.mEventPathParamsListSize != 0 && aReadPrepareParams.mpEventPathParamsList != nullptr)
     {
         EventPathIBs::Builder & eventPathListBuilder = request.CreateEventRequests();
@@ -715,6 +780,11 @@ CHIP_ERROR ReadClient::SendSubscribeRequest(ReadPrepareParams & aReadPreparePara
 
     mPeerNodeId  = aReadPrepareParams.mSessionHandle.GetPeerNodeId();
     mFabricIndex = aReadPrepareParams.mSessionHandle.GetFabricIndex();
+
+#if CHIP_CONFIG_IM_LATENCY_STATS
+    mRequestStartTime = System::SystemClock().GetMonotonicTimestamp();
+#endif
+
     MoveToState(ClientState::AwaitingInitialReport);
 
 exit:
@@ -36,6 +36,7 @@
 #include <app/data-model/Decode.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/CHIPTLVDebug.hpp>
+#include <lib/support/CodeLayoutAnnotations.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
 #include <lib/support/logging/CHIPLogging.h>
@@ -255,6 +256,8 @@ private:
                                   size_t aEventPathParamsListSize);
     CHIP_ERROR GenerateAttributePathList(AttributePathIBs::Builder & aAttributePathIBsBuilder,
                                          AttributePathParams * apAttributePathParamsList, size_t aAttributePathParamsListSize);
+    CHIP_ERROR GenerateDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
+                                             DataVersionFilter * apDataVersionFilterList, size_t aDataVersionFilterListSize);
     CHIP_ERROR ProcessAttributeReportIBs(TLV::TLVReader & aAttributeDataIBsReader);
     CHIP_ERROR ProcessEventReportIBs(TLV::TLVReader & aEventReportIBsReader);
 
@@ -265,7 +268,7 @@ private:
     void CancelLivenessCheckTimer();
     void MoveToState(const ClientState aTargetState);
     CHIP_ERROR ProcessAttributePath(AttributePathIB::Parser & aAttributePath, ConcreteDataAttributePath & aClusterInfo);
-    CHIP_ERROR ProcessReportData(System::PacketBufferHandle && aPayload);
+    CHIP_HOT CHIP_ERROR ProcessReportData(System::PacketBufferHandle && aPayload);
     CHIP_ERROR AbortExistingExchangeContext();
     const char * GetStateStr() const;
 
@@ -292,6 +295,12 @@ private:
     InteractionType mInteractionType           = InteractionType::Read;
     Timestamp mEventTimestamp;
     EventNumber mEventMin = 0;
+
+#if CHIP_CONFIG_IM_LATENCY_STATS
+    // Exchange-level request timestamp, recorded into the global interaction
+    // latency histograms when the primed report arrives.
+    System::Clock::Timestamp mRequestStartTime = System::Clock::kZero;
+#endif
 };
 
 }; // namespace app
@@ -46,8 +46,10 @@ CHIP_ERROR ReadHandler::Init(Messaging::ExchangeManager * apExchangeMgr, Interac
     mSuppressResponse          = true;
     mpAttributeClusterInfoList = nullptr;
     mpEventClusterInfoList     = nullptr;
+    mAttributeInterestMask     = 0;
     mCurrentPriority           = PriorityLevel::Invalid;
     mEventMin                  = 0;
+    mDataVersionFilterCount    = 0;
     mLastScheduledEventNumber  = 0;
     mIsPrimingReports          = true;
     MoveToState(HandlerState::Initialized);
@@ -61,6 +63,8 @@ CHIP_ERROR ReadHandler::Init(Messaging::ExchangeManager * apExchangeMgr, Interac
     mInitiatorNodeId        = apExchangeContext->GetSessionHandle().GetPeerNodeId();
     mSubjectDescriptor      = apExchangeContext->GetSessionHandle().GetSubjectDescriptor();
     mHoldSync               = false;
+    mHoldCoalesce           = false;
+    mReportCoalescingWindow = System::Clock::Milliseconds32(CHIP_IM_DEFAULT_REPORT_COALESCING_WINDOW_MS);
     mLastWrittenEventsBytes = 0;
     if (apExchangeContext != nullptr)
     {
@@ -74,8 +78,20 @@ void ReadHandler::Shutdown(ShutdownOptions aOptions)
 {
     if (IsSubscriptionType())
     {
+        if (mActiveSubscription)
+        {
+            SetSessionPinned(false);
+            SubscriptionResumptionStorage * resumptionStorage =
+                InteractionModelEngine::GetInstance()->GetSubscriptionResumptionStorage();
+            if (resumptionStorage != nullptr)
+            {
+                resumptionStorage->Delete(GetAccessingFabricIndex(), mInitiatorNodeId, mSubscriptionId);
+            }
+        }
         InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
             OnRefreshSubscribeTimerSyncCallback, this);
+        InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
+            OnCoalescingWindowCallback, this);
         if (mpDelegate != nullptr)
         {
             mpDelegate->SubscriptionTerminated(this);
@@ -105,8 +121,10 @@ void ReadHandler::Shutdown(ShutdownOptions aOptions)
     MoveToState(HandlerState::Uninitialized);
     mpAttributeClusterInfoList = nullptr;
     mpEventClusterInfoList     = nullptr;
+    mAttributeInterestMask     = 0;
     mCurrentPriority           = PriorityLevel::Invalid;
     mEventMin                  = 0;
+    mDataVersionFilterCount    = 0;
     mLastScheduledEventNumber  = 0;
     mIsPrimingReports          = false;
     mpDelegate                 = nullptr;
@@ -116,6 +134,8 @@ void ReadHandler::Shutdown(ShutdownOptions aOptions)
     mIsChunkedReport           = false;
     mInitiatorNodeId           = kUndefinedNodeId;
     mHoldSync                  = false;
+    mHoldCoalesce              = false;
+    mReportCoalescingWindow    = System::Clock::Milliseconds32(CHIP_IM_DEFAULT_REPORT_COALESCING_WINDOW_MS);
     mLastWrittenEventsBytes    = 0;
 }
 
@@ -169,6 +189,10 @@ CHIP_ERROR ReadHandler::OnStatusResponse(Messaging::ExchangeContext * apExchange
                 mpExchangeCtx = nullptr;
                 SuccessOrExit(err);
                 mActiveSubscription = true;
+                // Protect the session carrying this subscription from table eviction
+                // for as long as the subscription stays active.
+                SetSessionPinned(true);
+                PersistSubscription();
             }
             else
             {
@@ -297,6 +321,16 @@ CHIP_ERROR ReadHandler::ProcessReadRequest(System::PacketBufferHandle && aPayloa
     else if (err == CHIP_NO_ERROR)
     {
         ReturnErrorOnFailure(ProcessAttributePathList(attributePathListParser));
+        DataVersionFilterIBs::Parser dataVersionFilterListParser;
+        err = readRequestParser.GetDataVersionFilters(&dataVersionFilterListParser);
+        if (err == CHIP_END_OF_TLV)
+        {
+            err = CHIP_NO_ERROR;
+        }
+        else if (err == CHIP_NO_ERROR)
+        {
+            ReturnErrorOnFailure(ProcessDataVersionFilters(dataVersionFilterListParser));
+        }
     }
     ReturnErrorOnFailure(err);
     err = readRequestParser.GetEventRequests(&eventPathListParser);
@@ -399,6 +433,7 @@ CHIP_ERROR ReadHandler::ProcessAttributePathList(AttributePathIBs::Parser & aAtt
         SuccessOrExit(err);
         err = InteractionModelEngine::GetInstance()->PushFront(mpAttributeClusterInfoList, clusterInfo);
         SuccessOrExit(err);
+        mAttributeInterestMask |= clusterInfo.GetAttributeInterestMask();
         mIsPrimingReports = true;
     }
     // if we have exhausted this container
@@ -490,6 +525,58 @@ CHIP_ERROR ReadHandler::ProcessEventFilters(EventFilterIBs::Parser & aEventFilte
     return err;
 }
 
+CHIP_ERROR ReadHandler::ProcessDataVersionFilters(DataVersionFilterIBs::Parser & aDataVersionFiltersParser)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TLV::TLVReader reader;
+    aDataVersionFiltersParser.GetReader(&reader);
+
+    while (CHIP_NO_ERROR == (err = reader.Next()))
+    {
+        VerifyOrReturnError(TLV::AnonymousTag == reader.GetTag(), CHIP_ERROR_INVALID_TLV_TAG);
+        if (mDataVersionFilterCount >= kMaxDataVersionFilters)
+        {
+            // Filters are purely an optimization: dropping the excess just means the
+            // corresponding clusters get reported in full.
+            ChipLogDetail(DataManagement, "Ignoring data version filters beyond the first %u",
+                          static_cast<unsigned>(kMaxDataVersionFilters));
+            break;
+        }
+
+        DataVersionFilterIB::Parser filter;
+        ReturnErrorOnFailure(filter.Init(reader));
+
+        ClusterPathIB::Parser path;
+        ReturnErrorOnFailure(filter.GetPath(&path));
+
+        DataVersionFilter versionFilter;
+        ReturnErrorOnFailure(path.GetEndpoint(&(versionFilter.mEndpointId)));
+        ReturnErrorOnFailure(path.GetCluster(&(versionFilter.mClusterId)));
+        ReturnErrorOnFailure(filter.GetDataVersion(&(versionFilter.mDataVersion)));
+        VerifyOrReturnError(versionFilter.IsValidDataVersionFilter(), CHIP_ERROR_IM_MALFORMED_DATA_VERSION_FILTER_IB);
+
+        mDataVersionFilters[mDataVersionFilterCount++] = versionFilter;
+    }
+    if (CHIP_END_OF_TLV == err)
+    {
+        err = CHIP_NO_ERROR;
+    }
+    return err;
+}
+
+bool ReadHandler::GetDataVersionFilter(EndpointId aEndpointId, ClusterId aClusterId, DataVersion & aDataVersion) const
+{
+    for (size_t i = 0; i < mDataVersionFilterCount; i++)
+    {
+        if (mDataVersionFilters[i].mEndpointId == aEndpointId && mDataVersionFilters[i].mClusterId == aClusterId)
+        {
+            aDataVersion = mDataVersionFilters[i].mDataVersion;
+            return true;
+        }
+    }
+    return false;
+}
+
 const char * ReadHandler::GetStateStr() const
 {
 #if CHIP_DETAIL_LOGGING
@@ -589,6 +676,16 @@ CHIP_ERROR ReadHandler::ProcessSubscribeRequest(System::PacketBufferHandle && aP
     else if (err == CHIP_NO_ERROR)
     {
         ReturnErrorOnFailure(ProcessAttributePathList(attributePathListParser));
+        DataVersionFilterIBs::Parser dataVersionFilterListParser;
+        err = subscribeRequestParser.GetDataVersionFilters(&dataVersionFilterListParser);
+        if (err == CHIP_END_OF_TLV)
+        {
+            err = CHIP_NO_ERROR;
+        }
+        else if (err == CHIP_NO_ERROR)
+        {
+            ReturnErrorOnFailure(ProcessDataVersionFilters(dataVersionFilterListParser));
+        }
     }
     ReturnErrorOnFailure(err);
 
@@ -632,6 +729,47 @@ CHIP_ERROR ReadHandler::ProcessSubscribeRequest(System::PacketBufferHandle && aP
     return CHIP_NO_ERROR;
 }
 
+void ReadHandler::PersistSubscription()
+{
+    SubscriptionResumptionStorage * resumptionStorage = InteractionModelEngine::GetInstance()->GetSubscriptionResumptionStorage();
+    VerifyOrReturn(resumptionStorage != nullptr);
+
+    SubscriptionResumptionStorage::Entry entry;
+    entry.nodeId         = mInitiatorNodeId;
+    entry.subscriptionId = mSubscriptionId;
+    entry.fabricIndex    = GetAccessingFabricIndex();
+    entry.minInterval    = mMinIntervalFloorSeconds;
+    entry.maxInterval    = mMaxIntervalCeilingSeconds;
+    entry.fabricFiltered = mIsFabricFiltered;
+
+    for (ClusterInfo * info = mpAttributeClusterInfoList; info != nullptr; info = info->mpNext)
+    {
+        VerifyOrReturn(entry.attributePathCount < SubscriptionResumptionStorage::kMaxPathsPerSubscription,
+                       ChipLogDetail(DataManagement, "Subscription has too many attribute paths to persist for resumption"));
+        entry.attributePaths[entry.attributePathCount]        = *info;
+        entry.attributePaths[entry.attributePathCount].mpNext = nullptr;
+        entry.attributePathCount++;
+    }
+    for (ClusterInfo * info = mpEventClusterInfoList; info != nullptr; info = info->mpNext)
+    {
+        VerifyOrReturn(entry.eventPathCount < SubscriptionResumptionStorage::kMaxPathsPerSubscription,
+                       ChipLogDetail(DataManagement, "Subscription has too many event paths to persist for resumption"));
+        entry.eventPaths[entry.eventPathCount]        = *info;
+        entry.eventPaths[entry.eventPathCount].mpNext = nullptr;
+        entry.eventPathCount++;
+    }
+
+    LogErrorOnFailure(resumptionStorage->Save(entry));
+}
+
+void ReadHandler::SetSessionPinned(bool aPinned)
+{
+    VerifyOrReturn(mSessionHandle.HasValue());
+    Transport::SecureSession * session = mpExchangeMgr->GetSessionManager()->GetSecureSession(mSessionHandle.Value());
+    VerifyOrReturn(session != nullptr);
+    session->SetPinned(aPinned);
+}
+
 void ReadHandler::OnUnblockHoldReportCallback(System::Layer * apSystemLayer, void * apAppState)
 {
     VerifyOrReturn(apAppState != nullptr);
@@ -657,6 +795,43 @@ void ReadHandler::OnRefreshSubscribeTimerSyncCallback(System::Layer * apSystemLa
     InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
 }
 
+CHIP_ERROR ReadHandler::SetReportingIntervals(uint16_t aMinIntervalFloorSeconds, uint16_t aMaxIntervalCeilingSeconds,
+                                              System::Clock::Milliseconds32 aReportCoalescingWindow)
+{
+    VerifyOrReturnError(aMinIntervalFloorSeconds <= aMaxIntervalCeilingSeconds, CHIP_ERROR_INVALID_ARGUMENT);
+    mMinIntervalFloorSeconds   = aMinIntervalFloorSeconds;
+    mMaxIntervalCeilingSeconds = aMaxIntervalCeilingSeconds;
+    mReportCoalescingWindow    = aReportCoalescingWindow;
+    return CHIP_NO_ERROR;
+}
+
+void ReadHandler::ArmCoalescingWindow()
+{
+    // Coalescing only applies to subscription reports driven by dirty attributes; priming
+    // reports and plain reads must go out as soon as they are allowed to.
+    VerifyOrReturn(mReportCoalescingWindow.count() != 0);
+    VerifyOrReturn(IsSubscriptionType() && !IsPriming());
+    VerifyOrReturn(!mHoldCoalesce);
+
+    CHIP_ERROR err = InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->StartTimer(
+        mReportCoalescingWindow, OnCoalescingWindowCallback, this);
+    // If the timer could not be started, fall back to immediate reporting rather than holding
+    // the report forever.
+    VerifyOrReturn(err == CHIP_NO_ERROR);
+    mHoldCoalesce = true;
+}
+
+void ReadHandler::OnCoalescingWindowCallback(System::Layer * apSystemLayer, void * apAppState)
+{
+    VerifyOrReturn(apAppState != nullptr);
+    ReadHandler * readHandler  = static_cast<ReadHandler *>(apAppState);
+    readHandler->mHoldCoalesce = false;
+    if (readHandler->IsReportable())
+    {
+        InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
+    }
+}
+
 CHIP_ERROR ReadHandler::RefreshSubscribeSyncTimer()
 {
     ChipLogProgress(DataManagement, "Refresh Subscribe Sync Timer with max %d seconds", mMaxIntervalCeilingSeconds);
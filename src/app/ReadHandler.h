@@ -28,7 +28,9 @@
 #include <app/AttributeAccessInterface.h>
 #include <app/AttributePathExpandIterator.h>
 #include <app/ClusterInfo.h>
+#include <app/DataVersionFilter.h>
 #include <app/EventManagement.h>
+#include <app/MessageDef/DataVersionFilterIBs.h>
 #include <app/InteractionModelDelegate.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/CHIPTLVDebug.hpp>
@@ -39,6 +41,7 @@
 #include <messaging/ExchangeMgr.h>
 #include <messaging/Flags.h>
 #include <protocols/Protocols.h>
+#include <system/SystemClock.h>
 #include <system/SystemPacketBuffer.h>
 
 namespace chip {
@@ -111,14 +114,26 @@ public:
     CHIP_ERROR SendReportData(System::PacketBufferHandle && aPayload, bool mMoreChunks);
 
     bool IsFree() const { return mState == HandlerState::Uninitialized; }
-    bool IsReportable() const { return mState == HandlerState::GeneratingReports && !mHoldReport && (mDirty || !mHoldSync); }
+    bool IsReportable() const
+    {
+        return mState == HandlerState::GeneratingReports && !mHoldReport && !mHoldCoalesce && (mDirty || !mHoldSync);
+    }
     bool IsGeneratingReports() const { return mState == HandlerState::GeneratingReports; }
     bool IsAwaitingReportResponse() const { return mState == HandlerState::AwaitingReportResponse; }
     virtual ~ReadHandler() = default;
 
     ClusterInfo * GetAttributeClusterInfolist() { return mpAttributeClusterInfoList; }
+    uint64_t GetAttributeInterestMask() const { return mAttributeInterestMask; }
     ClusterInfo * GetEventClusterInfolist() { return mpEventClusterInfoList; }
     EventNumber & GetEventMin() { return mEventMin; }
+
+    /**
+     *  Returns whether the client attached a data version filter for the given cluster
+     *  and, if so, copies the filtered version into aDataVersion.  Used by the reporting
+     *  engine to suppress attributes of clusters that have not changed since the client
+     *  last saw them.
+     */
+    bool GetDataVersionFilter(EndpointId aEndpointId, ClusterId aClusterId, DataVersion & aDataVersion) const;
     PriorityLevel GetCurrentPriority() { return mCurrentPriority; }
 
     // if current priority is in the middle, it has valid snapshoted last event number, it check cleaness via comparing
@@ -127,10 +142,25 @@ public:
     bool CheckEventClean(EventManagement & aEventManager);
 
     bool IsReadType() { return mInteractionType == InteractionType::Read; }
-    bool IsSubscriptionType() { return mInteractionType == InteractionType::Subscribe; }
+    bool IsSubscriptionType() const { return mInteractionType == InteractionType::Subscribe; }
     bool IsChunkedReport() { return mIsChunkedReport; }
     bool IsPriming() { return mIsPrimingReports; }
+
+    /**
+     *  Set the reporting intervals and the report coalescing window for this handler.  The
+     *  coalescing window delays the report triggered by a dirty attribute so that attributes
+     *  dirtied shortly afterwards are merged into the same ReportData message, trading a small
+     *  amount of latency for fewer messages on rapidly-changing subscriptions.  A window of
+     *  zero disables coalescing.
+     *
+     *  @retval #CHIP_ERROR_INVALID_ARGUMENT If the min interval exceeds the max interval.
+     *  @retval #CHIP_NO_ERROR On success.
+     */
+    CHIP_ERROR SetReportingIntervals(uint16_t aMinIntervalFloorSeconds, uint16_t aMaxIntervalCeilingSeconds,
+                                     System::Clock::Milliseconds32 aReportCoalescingWindow);
+
     bool IsActiveSubscription() const { return mActiveSubscription; }
+    uint16_t GetMinIntervalFloorSeconds() const { return mMinIntervalFloorSeconds; }
     CHIP_ERROR OnSubscribeRequest(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle && aPayload);
     void GetSubscriptionId(uint64_t & aSubscriptionId) { aSubscriptionId = mSubscriptionId; }
     AttributePathExpandIterator * GetAttributePathExpandIterator() { return &mAttributePathExpandIterator; }
@@ -141,18 +171,40 @@ public:
         // we've sent up till now are no longer valid and need to be invalidated.
         mAttributePathExpandIterator = AttributePathExpandIterator(mpAttributeClusterInfoList);
         mAttributeEncoderState       = AttributeValueEncoder::AttributeEncodeState();
+        ArmCoalescingWindow();
     }
     void ClearDirty() { mDirty = false; }
     bool IsDirty() { return mDirty; }
     NodeId GetInitiatorNodeId() const { return mInitiatorNodeId; }
     FabricIndex GetAccessingFabricIndex() const { return mSubjectDescriptor.fabricIndex; }
 
+    /**
+     *  Number of attribute and event paths this handler is interested in, used by the
+     *  engine's subscription admission policy as the cost of serving (and of shedding)
+     *  the subscription.  A wildcard path counts once, like the ClusterInfo node that
+     *  represents it.
+     */
+    size_t GetInterestedPathCount() const
+    {
+        size_t count = 0;
+        for (const ClusterInfo * info = mpAttributeClusterInfoList; info != nullptr; info = info->mpNext)
+        {
+            count++;
+        }
+        for (const ClusterInfo * info = mpEventClusterInfoList; info != nullptr; info = info->mpNext)
+        {
+            count++;
+        }
+        return count;
+    }
+
     const SubjectDescriptor & GetSubjectDescriptor() const { return mSubjectDescriptor; }
 
     void UnblockUrgentEventDelivery()
     {
-        mHoldReport = false;
-        mDirty      = true;
+        mHoldReport   = false;
+        mHoldCoalesce = false;
+        mDirty        = true;
     }
 
     const AttributeValueEncoder::AttributeEncodeState & GetAttributeEncodeState() const { return mAttributeEncoderState; }
@@ -170,8 +222,22 @@ private:
         AwaitingReportResponse, ///< The handler has sent the report to the client and is awaiting a status response.
     };
 
+    /**
+     * Persist this subscription for resumption after a restart, if a
+     * SubscriptionResumptionStorage has been provided to the engine.
+     */
+    void PersistSubscription();
+
+    /**
+     * Pin (or unpin) the underlying secure session so that the session table does
+     * not evict it while this handler carries an active subscription.
+     */
+    void SetSessionPinned(bool aPinned);
+
     static void OnUnblockHoldReportCallback(System::Layer * apSystemLayer, void * apAppState);
     static void OnRefreshSubscribeTimerSyncCallback(System::Layer * apSystemLayer, void * apAppState);
+    static void OnCoalescingWindowCallback(System::Layer * apSystemLayer, void * apAppState);
+    void ArmCoalescingWindow();
     CHIP_ERROR RefreshSubscribeSyncTimer();
     CHIP_ERROR SendSubscribeResponse();
     CHIP_ERROR ProcessSubscribeRequest(System::PacketBufferHandle && aPayload);
@@ -179,6 +245,7 @@ private:
     CHIP_ERROR ProcessAttributePathList(AttributePathIBs::Parser & aAttributePathListParser);
     CHIP_ERROR ProcessEventPaths(EventPathIBs::Parser & aEventPathsParser);
     CHIP_ERROR ProcessEventFilters(EventFilterIBs::Parser & aEventFiltersParser);
+    CHIP_ERROR ProcessDataVersionFilters(DataVersionFilterIBs::Parser & aDataVersionFiltersParser);
     CHIP_ERROR OnStatusResponse(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle && aPayload);
     CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PayloadHeader & aPayloadHeader,
                                  System::PacketBufferHandle && aPayload) override;
@@ -199,10 +266,20 @@ private:
     ClusterInfo * mpAttributeClusterInfoList = nullptr;
     ClusterInfo * mpEventClusterInfoList     = nullptr;
 
+    // Union of GetAttributeInterestMask() over mpAttributeClusterInfoList, used by the
+    // reporting engine to cheaply skip handlers that cannot match a dirty path.
+    uint64_t mAttributeInterestMask = 0;
+
     PriorityLevel mCurrentPriority = PriorityLevel::Invalid;
 
     EventNumber mEventMin = 0;
 
+    // Data version filters attached to the read/subscribe request.  Filters beyond
+    // the capacity are dropped, which only costs suppression, never correctness.
+    static constexpr size_t kMaxDataVersionFilters = 8;
+    DataVersionFilter mDataVersionFilters[kMaxDataVersionFilters];
+    size_t mDataVersionFilterCount = 0;
+
     // The last schedule event number snapshoted in the beginning when preparing to fill new events to reports
     EventNumber mLastScheduledEventNumber      = 0;
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
@@ -225,9 +302,14 @@ private:
     bool mIsChunkedReport                                    = false;
     NodeId mInitiatorNodeId                                  = kUndefinedNodeId;
     AttributePathExpandIterator mAttributePathExpandIterator = AttributePathExpandIterator(nullptr);
-    bool mIsFabricFiltered                                   = false;
-    bool mHoldSync                                           = false;
-    uint32_t mLastWrittenEventsBytes                         = 0;
+    bool mIsFabricFiltered = false;
+    bool mHoldSync         = false;
+    // When true, report generation is held back until the coalescing window timer fires so
+    // that several closely-spaced dirty attributes end up in one ReportData message.
+    bool mHoldCoalesce = false;
+    System::Clock::Milliseconds32 mReportCoalescingWindow =
+        System::Clock::Milliseconds32(CHIP_IM_DEFAULT_REPORT_COALESCING_WINDOW_MS);
+    uint32_t mLastWrittenEventsBytes = 0;
     SubjectDescriptor mSubjectDescriptor;
     // The detailed encoding state for a single attribute, used by list chunking feature.
     AttributeValueEncoder::AttributeEncodeState mAttributeEncoderState;
@@ -21,21 +21,46 @@
 
 namespace chip {
 namespace app {
+namespace {
+
+// The encoded StatusResponseMessage is a handful of bytes fully determined by the status
+// code. Keep the most recently encoded message around, so the ack-heavy cases (long runs
+// of Success responses) copy preformatted bytes instead of running the TLV encoder for
+// every send. Only ever touched on the CHIP event loop thread, like the rest of the IM.
+constexpr size_t kMaxEncodedStatusResponseSize = 16;
+uint8_t gEncodedStatusResponse[kMaxEncodedStatusResponseSize];
+uint16_t gEncodedStatusResponseLen = 0;
+Protocols::InteractionModel::Status gEncodedStatus;
+
+} // namespace
+
 CHIP_ERROR StatusResponse::Send(Protocols::InteractionModel::Status aStatus, Messaging::ExchangeContext * apExchangeContext,
                                 bool aExpectResponse)
 {
     VerifyOrReturnError(apExchangeContext != nullptr, CHIP_ERROR_INCORRECT_STATE);
-    System::PacketBufferHandle msgBuf = System::PacketBufferHandle::New(kMaxSecureSduLengthBytes);
-    VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_NO_MEMORY);
 
-    System::PacketBufferTLVWriter writer;
-    writer.Init(std::move(msgBuf));
+    if (gEncodedStatusResponseLen == 0 || gEncodedStatus != aStatus)
+    {
+        gEncodedStatusResponseLen = 0;
+
+        TLV::TLVWriter writer;
+        writer.Init(gEncodedStatusResponse, sizeof(gEncodedStatusResponse));
+
+        StatusResponseMessage::Builder response;
+        ReturnErrorOnFailure(response.Init(&writer));
+        response.Status(aStatus);
+        ReturnErrorOnFailure(response.GetError());
+        ReturnErrorOnFailure(writer.Finalize());
+
+        gEncodedStatusResponseLen = static_cast<uint16_t>(writer.GetLengthWritten());
+        gEncodedStatus            = aStatus;
+    }
+
+    // Allocate the message buffer at the exact encoded size rather than the worst-case SDU
+    // length; the default reserve leaves room for the headers prepended on send.
+    System::PacketBufferHandle msgBuf = System::PacketBufferHandle::NewWithData(gEncodedStatusResponse, gEncodedStatusResponseLen);
+    VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_NO_MEMORY);
 
-    StatusResponseMessage::Builder response;
-    ReturnErrorOnFailure(response.Init(&writer));
-    response.Status(aStatus);
-    ReturnErrorOnFailure(response.GetError());
-    ReturnErrorOnFailure(writer.Finalize(&msgBuf));
     ReturnErrorOnFailure(apExchangeContext->SendMessage(Protocols::InteractionModel::MsgType::StatusResponse, std::move(msgBuf),
                                                         aExpectResponse ? Messaging::SendMessageFlags::kExpectResponse
                                                                         : Messaging::SendMessageFlags::kNone));
@@ -0,0 +1,245 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/SubscriptionResumptionStorage.h>
+
+#include <lib/core/CHIPTLV.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+constexpr TLV::Tag kTagNodeId         = TLV::ContextTag(1);
+constexpr TLV::Tag kTagSubscriptionId = TLV::ContextTag(2);
+constexpr TLV::Tag kTagFabricIndex    = TLV::ContextTag(3);
+constexpr TLV::Tag kTagMinInterval    = TLV::ContextTag(4);
+constexpr TLV::Tag kTagMaxInterval    = TLV::ContextTag(5);
+constexpr TLV::Tag kTagFabricFiltered = TLV::ContextTag(6);
+constexpr TLV::Tag kTagAttributePaths = TLV::ContextTag(7);
+constexpr TLV::Tag kTagEventPaths     = TLV::ContextTag(8);
+
+constexpr TLV::Tag kTagPathEndpoint = TLV::ContextTag(1);
+constexpr TLV::Tag kTagPathCluster  = TLV::ContextTag(2);
+constexpr TLV::Tag kTagPathId       = TLV::ContextTag(3);
+
+CHIP_ERROR SerializePaths(TLV::TLVWriter & writer, TLV::Tag tag, const ClusterInfo * paths, size_t count, bool isAttributePath)
+{
+    TLV::TLVType array;
+    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Array, array));
+    for (size_t i = 0; i < count; i++)
+    {
+        TLV::TLVType item;
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, item));
+        ReturnErrorOnFailure(writer.Put(kTagPathEndpoint, paths[i].mEndpointId));
+        ReturnErrorOnFailure(writer.Put(kTagPathCluster, paths[i].mClusterId));
+        ReturnErrorOnFailure(writer.Put(kTagPathId, isAttributePath ? paths[i].mAttributeId : paths[i].mEventId));
+        ReturnErrorOnFailure(writer.EndContainer(item));
+    }
+    return writer.EndContainer(array);
+}
+
+CHIP_ERROR DeserializePaths(TLV::TLVReader & reader, ClusterInfo * paths, size_t capacity, size_t & count, bool isAttributePath)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TLV::TLVType array;
+    ReturnErrorOnFailure(reader.EnterContainer(array));
+    count = 0;
+    while (CHIP_NO_ERROR == (err = reader.Next(TLV::AnonymousTag)))
+    {
+        VerifyOrReturnError(count < capacity, CHIP_ERROR_NO_MEMORY);
+        TLV::TLVType item;
+        ReturnErrorOnFailure(reader.EnterContainer(item));
+        ReturnErrorOnFailure(reader.Next(kTagPathEndpoint));
+        ReturnErrorOnFailure(reader.Get(paths[count].mEndpointId));
+        ReturnErrorOnFailure(reader.Next(kTagPathCluster));
+        ReturnErrorOnFailure(reader.Get(paths[count].mClusterId));
+        ReturnErrorOnFailure(reader.Next(kTagPathId));
+        if (isAttributePath)
+        {
+            ReturnErrorOnFailure(reader.Get(paths[count].mAttributeId));
+        }
+        else
+        {
+            ReturnErrorOnFailure(reader.Get(paths[count].mEventId));
+        }
+        ReturnErrorOnFailure(reader.ExitContainer(item));
+        count++;
+    }
+    VerifyOrReturnError(CHIP_END_OF_TLV == err, err);
+    return reader.ExitContainer(array);
+}
+
+} // namespace
+
+CHIP_ERROR SubscriptionResumptionStorage::SaveToSlot(size_t index, const Entry & entry)
+{
+    uint8_t buffer[kMaxSerializedSize] = { 0 };
+
+    TLV::TLVWriter writer;
+    writer.Init(buffer, sizeof(buffer));
+
+    TLV::TLVType container;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, container));
+    ReturnErrorOnFailure(writer.Put(kTagNodeId, entry.nodeId));
+    ReturnErrorOnFailure(writer.Put(kTagSubscriptionId, entry.subscriptionId));
+    ReturnErrorOnFailure(writer.Put(kTagFabricIndex, entry.fabricIndex));
+    ReturnErrorOnFailure(writer.Put(kTagMinInterval, entry.minInterval));
+    ReturnErrorOnFailure(writer.Put(kTagMaxInterval, entry.maxInterval));
+    ReturnErrorOnFailure(writer.Put(kTagFabricFiltered, entry.fabricFiltered));
+    ReturnErrorOnFailure(SerializePaths(writer, kTagAttributePaths, entry.attributePaths, entry.attributePathCount, true));
+    ReturnErrorOnFailure(SerializePaths(writer, kTagEventPaths, entry.eventPaths, entry.eventPathCount, false));
+    ReturnErrorOnFailure(writer.EndContainer(container));
+
+    DefaultStorageKeyAllocator key;
+    return mStorage->SyncSetKeyValue(key.SubscriptionResumption(static_cast<uint16_t>(index)), buffer,
+                                     static_cast<uint16_t>(writer.GetLengthWritten()));
+}
+
+CHIP_ERROR SubscriptionResumptionStorage::Save(const Entry & entry)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(entry.attributePathCount <= kMaxPathsPerSubscription, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(entry.eventPathCount <= kMaxPathsPerSubscription, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Reuse the slot already holding this subscription, otherwise take the first free one.
+    size_t target = kMaxSubscriptions;
+    for (size_t i = 0; i < kMaxSubscriptions; i++)
+    {
+        Entry existing;
+        CHIP_ERROR err = Load(i, existing);
+        if (CHIP_ERROR_NOT_FOUND == err)
+        {
+            if (target == kMaxSubscriptions)
+            {
+                target = i;
+            }
+            continue;
+        }
+        ReturnErrorOnFailure(err);
+        if (existing.fabricIndex == entry.fabricIndex && existing.nodeId == entry.nodeId &&
+            existing.subscriptionId == entry.subscriptionId)
+        {
+            target = i;
+            break;
+        }
+    }
+    VerifyOrReturnError(target < kMaxSubscriptions, CHIP_ERROR_NO_MEMORY);
+
+    return SaveToSlot(target, entry);
+}
+
+CHIP_ERROR SubscriptionResumptionStorage::Load(size_t index, Entry & entry)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(index < kMaxSubscriptions, CHIP_ERROR_INVALID_ARGUMENT);
+
+    uint8_t buffer[kMaxSerializedSize] = { 0 };
+    uint16_t size                      = static_cast<uint16_t>(sizeof(buffer));
+
+    DefaultStorageKeyAllocator key;
+    CHIP_ERROR err = mStorage->SyncGetKeyValue(key.SubscriptionResumption(static_cast<uint16_t>(index)), buffer, size);
+    VerifyOrReturnError(CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND != err, CHIP_ERROR_NOT_FOUND);
+    ReturnErrorOnFailure(err);
+
+    TLV::TLVReader reader;
+    reader.Init(buffer, size);
+    ReturnErrorOnFailure(reader.Next(TLV::AnonymousTag));
+
+    TLV::TLVType container;
+    ReturnErrorOnFailure(reader.EnterContainer(container));
+    ReturnErrorOnFailure(reader.Next(kTagNodeId));
+    ReturnErrorOnFailure(reader.Get(entry.nodeId));
+    ReturnErrorOnFailure(reader.Next(kTagSubscriptionId));
+    ReturnErrorOnFailure(reader.Get(entry.subscriptionId));
+    ReturnErrorOnFailure(reader.Next(kTagFabricIndex));
+    ReturnErrorOnFailure(reader.Get(entry.fabricIndex));
+    ReturnErrorOnFailure(reader.Next(kTagMinInterval));
+    ReturnErrorOnFailure(reader.Get(entry.minInterval));
+    ReturnErrorOnFailure(reader.Next(kTagMaxInterval));
+    ReturnErrorOnFailure(reader.Get(entry.maxInterval));
+    ReturnErrorOnFailure(reader.Next(kTagFabricFiltered));
+    ReturnErrorOnFailure(reader.Get(entry.fabricFiltered));
+    ReturnErrorOnFailure(reader.Next(kTagAttributePaths));
+    ReturnErrorOnFailure(
+        DeserializePaths(reader, entry.attributePaths, kMaxPathsPerSubscription, entry.attributePathCount, true));
+    ReturnErrorOnFailure(reader.Next(kTagEventPaths));
+    ReturnErrorOnFailure(DeserializePaths(reader, entry.eventPaths, kMaxPathsPerSubscription, entry.eventPathCount, false));
+    return reader.ExitContainer(container);
+}
+
+CHIP_ERROR SubscriptionResumptionStorage::Delete(FabricIndex fabricIndex, NodeId nodeId, uint64_t subscriptionId)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    DefaultStorageKeyAllocator key;
+    for (size_t i = 0; i < kMaxSubscriptions; i++)
+    {
+        Entry entry;
+        if (CHIP_NO_ERROR != Load(i, entry))
+        {
+            continue;
+        }
+        if (entry.fabricIndex == fabricIndex && entry.nodeId == nodeId && entry.subscriptionId == subscriptionId)
+        {
+            return mStorage->SyncDeleteKeyValue(key.SubscriptionResumption(static_cast<uint16_t>(i)));
+        }
+    }
+    return CHIP_ERROR_NOT_FOUND;
+}
+
+CHIP_ERROR SubscriptionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    DefaultStorageKeyAllocator key;
+    for (size_t i = 0; i < kMaxSubscriptions; i++)
+    {
+        Entry entry;
+        if (CHIP_NO_ERROR != Load(i, entry))
+        {
+            continue;
+        }
+        if (entry.fabricIndex == fabricIndex)
+        {
+            LogErrorOnFailure(mStorage->SyncDeleteKeyValue(key.SubscriptionResumption(static_cast<uint16_t>(i))));
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+size_t SubscriptionResumptionStorage::Count()
+{
+    VerifyOrReturnError(mStorage != nullptr, 0);
+
+    size_t count = 0;
+    for (size_t i = 0; i < kMaxSubscriptions; i++)
+    {
+        Entry entry;
+        if (CHIP_NO_ERROR == Load(i, entry))
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,116 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/ClusterInfo.h>
+#include <app/util/basic-types.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/NodeId.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Persists the state of active subscriptions so that it survives a server
+ * restart.  Without this every subscription is lost on reboot and all
+ * subscribers have to renegotiate (CASE plus a full subscribe exchange) at
+ * the same time, which is expensive on large fabrics.
+ *
+ * One storage slot is reserved per ReadHandler; a slot is written when a
+ * subscription becomes active and cleared when the subscription shuts down,
+ * so entries found at boot describe the subscriptions that were live when
+ * power was lost.
+ */
+class SubscriptionResumptionStorage
+{
+public:
+    static constexpr size_t kMaxSubscriptions        = CHIP_IM_MAX_NUM_READ_HANDLER;
+    static constexpr size_t kMaxPathsPerSubscription = 4;
+
+    /**
+     * Persisted state for one subscription.  The paths reuse ClusterInfo, the
+     * same representation ReadHandler keeps in memory; the mpNext links are
+     * not persisted.
+     */
+    struct Entry
+    {
+        NodeId nodeId             = kUndefinedNodeId;
+        uint64_t subscriptionId   = 0;
+        FabricIndex fabricIndex   = kUndefinedFabricIndex;
+        uint16_t minInterval      = 0;
+        uint16_t maxInterval      = 0;
+        bool fabricFiltered       = false;
+        size_t attributePathCount = 0;
+        size_t eventPathCount     = 0;
+        ClusterInfo attributePaths[kMaxPathsPerSubscription];
+        ClusterInfo eventPaths[kMaxPathsPerSubscription];
+    };
+
+    CHIP_ERROR Init(PersistentStorageDelegate * storage)
+    {
+        VerifyOrReturnError(storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        mStorage = storage;
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * Persist the given subscription, replacing any existing entry with the
+     * same fabric, node and subscription id.
+     *
+     * @retval #CHIP_ERROR_NO_MEMORY if all slots are occupied.
+     */
+    CHIP_ERROR Save(const Entry & entry);
+
+    /**
+     * Load the entry stored in the given slot, if any.
+     *
+     * @retval #CHIP_ERROR_NOT_FOUND if the slot is empty.
+     */
+    CHIP_ERROR Load(size_t index, Entry & entry);
+
+    /**
+     * Remove the entry matching the given subscription, if any.
+     */
+    CHIP_ERROR Delete(FabricIndex fabricIndex, NodeId nodeId, uint64_t subscriptionId);
+
+    /**
+     * Remove all entries belonging to the given fabric, e.g. when the fabric
+     * is removed from the node.
+     */
+    CHIP_ERROR DeleteAll(FabricIndex fabricIndex);
+
+    /**
+     * Number of occupied slots.
+     */
+    size_t Count();
+
+private:
+    // Worst-case TLV encoding of an Entry stays well below this bound.
+    static constexpr size_t kMaxSerializedSize = 256;
+
+    CHIP_ERROR SaveToSlot(size_t index, const Entry & entry);
+
+    PersistentStorageDelegate * mStorage = nullptr;
+};
+
+} // namespace app
+} // namespace chip
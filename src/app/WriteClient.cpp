@@ -31,6 +31,13 @@
 namespace chip {
 namespace app {
 
+namespace {
+// Space reserved in every message for closing out the AttributeDataIBs array and the
+// WriteRequestMessage struct, including the MoreChunkedMessages and IsFabricFiltered
+// booleans, so that finalizing a chunk can never fail for lack of room.
+constexpr uint32_t kReservedSizeForTLVEncodingOverhead = 16;
+} // namespace
+
 CHIP_ERROR WriteClient::Init(Messaging::ExchangeManager * apExchangeMgr, Callback * apCallback,
                              const Optional<uint16_t> & aTimedWriteTimeoutMs)
 {
@@ -38,25 +45,40 @@ CHIP_ERROR WriteClient::Init(Messaging::ExchangeManager * apExchangeMgr, Callbac
     VerifyOrReturnError(mpExchangeMgr == nullptr, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mpExchangeCtx == nullptr, CHIP_ERROR_INCORRECT_STATE);
 
+    mTimedWriteTimeoutMs = aTimedWriteTimeoutMs;
+    ReturnErrorOnFailure(StartNewMessage());
+    ClearExistingExchangeContext();
+    mpExchangeMgr = apExchangeMgr;
+    mpCallback    = apCallback;
+    MoveToState(State::Initialized);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR WriteClient::StartNewMessage()
+{
     System::PacketBufferHandle packet = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
     VerifyOrReturnError(!packet.IsNull(), CHIP_ERROR_NO_MEMORY);
 
     mMessageWriter.Init(std::move(packet));
+    ReturnErrorOnFailure(mMessageWriter.ReserveBuffer(kReservedSizeForTLVEncodingOverhead));
 
     ReturnErrorOnFailure(mWriteRequestBuilder.Init(&mMessageWriter));
-    mWriteRequestBuilder.TimedRequest(aTimedWriteTimeoutMs.HasValue());
+    mWriteRequestBuilder.TimedRequest(mTimedWriteTimeoutMs.HasValue());
     ReturnErrorOnFailure(mWriteRequestBuilder.GetError());
     mWriteRequestBuilder.CreateWriteRequests();
     ReturnErrorOnFailure(mWriteRequestBuilder.GetError());
-    ClearExistingExchangeContext();
-    mpExchangeMgr        = apExchangeMgr;
-    mpCallback           = apCallback;
-    mTimedWriteTimeoutMs = aTimedWriteTimeoutMs;
-    MoveToState(State::Initialized);
+    mHasDataInCurrentChunk = false;
 
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR WriteClient::StartNewChunk()
+{
+    ReturnErrorOnFailure(FinalizeMessage(/* aHasMoreChunks = */ true));
+    return StartNewMessage();
+}
+
 void WriteClient::Shutdown()
 {
     VerifyOrReturn(mState != State::Uninitialized);
@@ -67,6 +89,8 @@ void WriteClient::Shutdown()
 void WriteClient::ShutdownInternal()
 {
     mMessageWriter.Reset();
+    mPendingWriteData = nullptr;
+    mChunks           = nullptr;
 
     mpExchangeMgr = nullptr;
     mpExchangeCtx = nullptr;
@@ -147,11 +171,33 @@ CHIP_ERROR WriteClient::PrepareAttribute(const AttributePathParams & attributePa
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR WriteClient::PrepareListItemAttribute(const AttributePathParams & attributePathParams)
+{
+    VerifyOrReturnError(attributePathParams.IsValidAttributePath(), CHIP_ERROR_INVALID_PATH_LIST);
+    AttributeDataIBs::Builder & writeRequests  = mWriteRequestBuilder.GetWriteRequests();
+    AttributeDataIB::Builder & attributeDataIB = writeRequests.CreateAttributeDataIBBuilder();
+    ReturnErrorOnFailure(writeRequests.GetError());
+    // TODO: Add attribute version support
+    attributeDataIB.DataVersion(0);
+    ReturnErrorOnFailure(attributeDataIB.GetError());
+    AttributePathIB::Builder & path = attributeDataIB.CreatePath();
+    ReturnErrorOnFailure(attributeDataIB.GetError());
+    // An append operation encodes the path of the targeted list attribute with a null
+    // list index.
+    path.Endpoint(attributePathParams.mEndpointId)
+        .Cluster(attributePathParams.mClusterId)
+        .Attribute(attributePathParams.mAttributeId)
+        .ListIndex(DataModel::Nullable<ListIndex>());
+    path.EndOfAttributePathIB();
+    return path.GetError();
+}
+
 CHIP_ERROR WriteClient::FinishAttribute()
 {
     AttributeDataIB::Builder & attributeDataIB = mWriteRequestBuilder.GetWriteRequests().GetAttributeDataIBBuilder();
     attributeDataIB.EndOfAttributeDataIB();
     ReturnErrorOnFailure(attributeDataIB.GetError());
+    mHasDataInCurrentChunk = true;
     MoveToState(State::AddAttribute);
     return CHIP_NO_ERROR;
 }
@@ -161,15 +207,41 @@ TLV::TLVWriter * WriteClient::GetAttributeDataIBTLVWriter()
     return mWriteRequestBuilder.GetWriteRequests().GetAttributeDataIBBuilder().GetWriter();
 }
 
-CHIP_ERROR WriteClient::FinalizeMessage(System::PacketBufferHandle & aPacket)
+void WriteClient::Checkpoint(TLV::TLVWriter & aBackup)
+{
+    mWriteRequestBuilder.GetWriteRequests().Checkpoint(aBackup);
+}
+
+void WriteClient::Rollback(const TLV::TLVWriter & aBackup)
+{
+    mWriteRequestBuilder.GetWriteRequests().Rollback(aBackup);
+    // Clear any overflow error latched while encoding the discarded AttributeDataIB, so
+    // encoding can be retried against a fresh chunk.
+    mWriteRequestBuilder.GetWriteRequests().ResetError();
+    mWriteRequestBuilder.GetWriteRequests().GetAttributeDataIBBuilder().ResetError();
+}
+
+CHIP_ERROR WriteClient::FinalizeMessage(bool aHasMoreChunks)
 {
+    System::PacketBufferHandle packet;
     VerifyOrReturnError(mState == State::AddAttribute, CHIP_ERROR_INCORRECT_STATE);
+
+    ReturnErrorOnFailure(mMessageWriter.UnreserveBuffer(kReservedSizeForTLVEncodingOverhead));
     AttributeDataIBs::Builder & attributeDataIBsBuilder = mWriteRequestBuilder.GetWriteRequests().EndOfAttributeDataIBs();
     ReturnErrorOnFailure(attributeDataIBsBuilder.GetError());
 
+    if (aHasMoreChunks)
+    {
+        // Not encoded at all on the final message, so non-chunked requests keep their
+        // existing wire format.
+        mWriteRequestBuilder.MoreChunkedMessages(true);
+        ReturnErrorOnFailure(mWriteRequestBuilder.GetError());
+    }
+
     mWriteRequestBuilder.IsFabricFiltered(false).EndOfWriteRequestMessage();
     ReturnErrorOnFailure(mWriteRequestBuilder.GetError());
-    ReturnErrorOnFailure(mMessageWriter.Finalize(&aPacket));
+    ReturnErrorOnFailure(mMessageWriter.Finalize(&packet));
+    mChunks.AddToEnd(std::move(packet));
     return CHIP_NO_ERROR;
 }
 
@@ -217,9 +289,15 @@ CHIP_ERROR WriteClient::SendWriteRequest(const SessionHandle & session, System::
 
     VerifyOrExit(mState == State::AddAttribute, err = CHIP_ERROR_INCORRECT_STATE);
 
-    err = FinalizeMessage(mPendingWriteData);
+    err = FinalizeMessage(/* aHasMoreChunks = */ false);
     SuccessOrExit(err);
 
+    // Chunked requests are paced by the Write Response to each chunk, which group
+    // sessions cannot deliver.
+    VerifyOrExit(!(session.IsGroupSession() && mChunks.HasChainedBuffer()), err = CHIP_ERROR_INVALID_ARGUMENT);
+
+    mPendingWriteData = mChunks.PopHead();
+
     // Discard any existing exchange context. Effectively we can only have one exchange per WriteClient
     // at any one time.
     ClearExistingExchangeContext();
@@ -307,6 +385,14 @@ CHIP_ERROR WriteClient::OnMessageReceived(Messaging::ExchangeContext * apExchang
     {
         err = ProcessWriteResponseMessage(std::move(aPayload));
         SuccessOrExit(err);
+        if (!mChunks.IsNull())
+        {
+            // The response acknowledges the previous chunk; send the next one on the same
+            // exchange.  This moves us back to AwaitingResponse, keeping the client alive.
+            mPendingWriteData = mChunks.PopHead();
+            err               = SendWriteRequest();
+            SuccessOrExit(err);
+        }
     }
     else if (aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::StatusResponse))
     {
@@ -115,6 +115,66 @@ public:
     CHIP_ERROR FinishAttribute();
     TLV::TLVWriter * GetAttributeDataIBTLVWriter();
 
+    /**
+     *  Encode an attribute value into the pending write request.  If the encoded value does
+     *  not fit into the message under construction, that message is queued as a chunk (with
+     *  MoreChunkedMessages set) and encoding is retried in a fresh message, so requests
+     *  larger than a single message are split across multiple WriteRequest messages
+     *  transparently.  The chunks are sent one at a time, each waiting for the Write
+     *  Response to the previous one.
+     */
+    template <class T>
+    CHIP_ERROR EncodeAttribute(const AttributePathParams & attributePath, const T & value)
+    {
+        CHIP_ERROR err = TryEncodeSingleAttributeDataIB(attributePath, value, /* aForListItem = */ false);
+        if (err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL)
+        {
+            // Only retry in a fresh chunk if the current message already carries data;
+            // otherwise the value cannot fit any message and the error is final.
+            VerifyOrReturnError(mHasDataInCurrentChunk, err);
+            ReturnErrorOnFailure(StartNewChunk());
+            err = TryEncodeSingleAttributeDataIB(attributePath, value, /* aForListItem = */ false);
+        }
+        return err;
+    }
+
+    /**
+     *  Encode a list attribute value into the pending write request.  A list that fits the
+     *  message under construction is encoded as a whole, keeping the wire format of small
+     *  writes unchanged.  A list that does not fit is written as a replace with an empty
+     *  list followed by one append per entry, so the entries can spread across as many
+     *  chunks as needed.
+     */
+    template <class T>
+    CHIP_ERROR EncodeAttribute(const AttributePathParams & attributePath, const DataModel::List<T> & value)
+    {
+        CHIP_ERROR err = TryEncodeSingleAttributeDataIB(attributePath, value, /* aForListItem = */ false);
+        VerifyOrReturnError(err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL, err);
+
+        // Replace the list with an empty list first; the entries are appended below.
+        err = TryEncodeSingleAttributeDataIB(attributePath, DataModel::List<T>(), /* aForListItem = */ false);
+        if (err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL)
+        {
+            VerifyOrReturnError(mHasDataInCurrentChunk, err);
+            ReturnErrorOnFailure(StartNewChunk());
+            err = TryEncodeSingleAttributeDataIB(attributePath, DataModel::List<T>(), /* aForListItem = */ false);
+        }
+        ReturnErrorOnFailure(err);
+
+        for (size_t i = 0; i < value.size(); i++)
+        {
+            err = TryEncodeSingleAttributeDataIB(attributePath, value.data()[i], /* aForListItem = */ true);
+            if (err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL)
+            {
+                VerifyOrReturnError(mHasDataInCurrentChunk, err);
+                ReturnErrorOnFailure(StartNewChunk());
+                err = TryEncodeSingleAttributeDataIB(attributePath, value.data()[i], /* aForListItem = */ true);
+            }
+            ReturnErrorOnFailure(err);
+        }
+        return CHIP_NO_ERROR;
+    }
+
     NodeId GetSourceNodeId() const
     {
         return mpExchangeCtx != nullptr ? mpExchangeCtx->GetSessionHandle().GetPeerNodeId() : kUndefinedNodeId;
@@ -136,9 +196,65 @@ private:
     };
 
     /**
-     * Finalize Write Request Message TLV Builder and retrieve final data from tlv builder for later sending
+     * Encode a single AttributeDataIB, rolling the message back to its previous state if
+     * the encode does not fit, so a fresh chunk can be started and the encode retried.
+     * List item values are encoded as append operations when aForListItem is true.
+     */
+    template <class T>
+    CHIP_ERROR TryEncodeSingleAttributeDataIB(const AttributePathParams & attributePath, const T & value, bool aForListItem)
+    {
+        TLV::TLVWriter backup;
+        Checkpoint(backup);
+
+        CHIP_ERROR err = EncodeSingleAttributeDataIB(attributePath, value, aForListItem);
+        if (err != CHIP_NO_ERROR)
+        {
+            Rollback(backup);
+        }
+        return err;
+    }
+
+    template <class T>
+    CHIP_ERROR EncodeSingleAttributeDataIB(const AttributePathParams & attributePath, const T & value, bool aForListItem)
+    {
+        TLV::TLVWriter * writer = nullptr;
+
+        ReturnErrorOnFailure(aForListItem ? PrepareListItemAttribute(attributePath) : PrepareAttribute(attributePath));
+        VerifyOrReturnError((writer = GetAttributeDataIBTLVWriter()) != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        ReturnErrorOnFailure(
+            DataModel::Encode(*writer, TLV::ContextTag(to_underlying(AttributeDataIB::Tag::kData)), value));
+        return FinishAttribute();
+    }
+
+    /**
+     * Like PrepareAttribute, but encodes the path with a null list index, marking the
+     * AttributeDataIB as an append to the targeted list attribute.
+     */
+    CHIP_ERROR PrepareListItemAttribute(const AttributePathParams & attributePathParams);
+
+    /**
+     * Start constructing a new Write Request message in mMessageWriter.
      */
-    CHIP_ERROR FinalizeMessage(System::PacketBufferHandle & aPacket);
+    CHIP_ERROR StartNewMessage();
+
+    /**
+     * Queue the message under construction as a chunk (with MoreChunkedMessages set) and
+     * start a fresh message for the remaining data.
+     */
+    CHIP_ERROR StartNewChunk();
+
+    /**
+     * Snapshot/restore the state of the message under construction around encoding one
+     * AttributeDataIB, so an encode that overflows the message can be undone cleanly.
+     */
+    void Checkpoint(TLV::TLVWriter & aBackup);
+    void Rollback(const TLV::TLVWriter & aBackup);
+
+    /**
+     * Finalize the Write Request message under construction and append it to the queue of
+     * chunks awaiting transmission.
+     */
+    CHIP_ERROR FinalizeMessage(bool aHasMoreChunks);
 
     /**
      *  Once SendWriteRequest returns successfully, the WriteClient will
@@ -213,6 +329,13 @@ private:
     // but have it hold on to the buffer, and get the buffer from it later.
     // Then we could avoid this extra pointer-sized member.
     System::PacketBufferHandle mPendingWriteData;
+    // Finalized chunks awaiting transmission, kept as a chain of packet buffers with one
+    // message per buffer.  The head is popped into mPendingWriteData as each Write
+    // Response arrives.
+    System::PacketBufferHandle mChunks;
+    // Whether at least one AttributeDataIB has been encoded into the message under
+    // construction; chunking only makes sense once the current message carries data.
+    bool mHasDataInCurrentChunk = false;
     // If mTimedWriteTimeoutMs has a value, we are expected to do a timed
     // write.
     Optional<uint16_t> mTimedWriteTimeoutMs;
@@ -255,21 +378,15 @@ public:
     CHIP_ERROR SendWriteRequest(const SessionHandle & session, System::Clock::Timeout timeout = kImMessageTimeout);
 
     /**
-     *  Encode an attribute value that can be directly encoded using TLVWriter::Put
+     *  Encode an attribute value that can be directly encoded using DataModel::Encode.
+     *  Values that do not fit the message under construction cause the request to be
+     *  split into multiple chunked messages; see WriteClient::EncodeAttribute.
      */
     template <class T>
     CHIP_ERROR EncodeAttributeWritePayload(const chip::app::AttributePathParams & attributePath, const T & value)
     {
-        chip::TLV::TLVWriter * writer = nullptr;
-
         VerifyOrReturnError(mpWriteClient != nullptr, CHIP_ERROR_INCORRECT_STATE);
-        ReturnErrorOnFailure(mpWriteClient->PrepareAttribute(attributePath));
-        VerifyOrReturnError((writer = mpWriteClient->GetAttributeDataIBTLVWriter()) != nullptr, CHIP_ERROR_INCORRECT_STATE);
-        ReturnErrorOnFailure(
-            DataModel::Encode(*writer, chip::TLV::ContextTag(to_underlying(chip::app::AttributeDataIB::Tag::kData)), value));
-        ReturnErrorOnFailure(mpWriteClient->FinishAttribute());
-
-        return CHIP_NO_ERROR;
+        return mpWriteClient->EncodeAttribute(attributePath, value);
     }
 
     /**
@@ -19,6 +19,7 @@
 #include <app/AppBuildConfig.h>
 #include <app/InteractionModelEngine.h>
 #include <app/MessageDef/EventPathIB.h>
+#include <app/StatusResponse.h>
 #include <app/WriteHandler.h>
 #include <app/reporting/Engine.h>
 #include <app/util/MatterCallbacks.h>
@@ -43,6 +44,9 @@ CHIP_ERROR WriteHandler::Init(InteractionModelDelegate * apDelegate)
     mWriteResponseBuilder.CreateWriteResponses();
     ReturnErrorOnFailure(mWriteResponseBuilder.GetError());
 
+    mHasMoreChunks     = false;
+    mUnackedChunkCount = 0;
+
     MoveToState(State::Initialized);
 
     return CHIP_NO_ERROR;
@@ -63,6 +67,26 @@ Status WriteHandler::OnWriteRequest(Messaging::ExchangeContext * apExchangeConte
 
     Status status = ProcessWriteRequest(std::move(aPayload), aIsTimedWrite);
 
+    if (status == Status::Success && mHasMoreChunks)
+    {
+        if (aIsTimedWrite || apExchangeContext->IsGroupExchangeContext())
+        {
+            // Streaming writes span multiple messages, which neither the timed interaction
+            // window nor the response-less group path supports.
+            status = Status::InvalidAction;
+        }
+        else if (PrepareForNextChunk() == CHIP_NO_ERROR)
+        {
+            // Stay alive: further chunks arrive via OnMessageReceived and the aggregated
+            // response is sent after the final chunk.
+            return Status::Success;
+        }
+        else
+        {
+            status = Status::Failure;
+        }
+    }
+
     // Do not send response on Group Write
     if (status == Status::Success && !apExchangeContext->IsGroupExchangeContext())
     {
@@ -77,6 +101,78 @@ Status WriteHandler::OnWriteRequest(Messaging::ExchangeContext * apExchangeConte
     return status;
 }
 
+CHIP_ERROR WriteHandler::PrepareForNextChunk()
+{
+    VerifyOrReturnError(mpExchangeCtx != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    // Take over the exchange so follow-up chunks are delivered directly to this handler,
+    // and keep it open while we wait for them.
+    mpExchangeCtx->SetDelegate(this);
+    mpExchangeCtx->WillSendMessage();
+
+    if (++mUnackedChunkCount >= CHIP_CONFIG_IM_WRITE_CHUNK_ACK_WINDOW)
+    {
+        mUnackedChunkCount = 0;
+        ReturnErrorOnFailure(StatusResponse::Send(Status::Success, mpExchangeCtx, true /* aExpectResponse */));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR WriteHandler::OnMessageReceived(Messaging::ExchangeContext * apExchangeContext,
+                                           const PayloadHeader & aPayloadHeader, System::PacketBufferHandle && aPayload)
+{
+    Status status = Status::InvalidAction;
+
+    if (aPayloadHeader.HasMessageType(MsgType::WriteRequest))
+    {
+        status = ProcessWriteRequest(std::move(aPayload), /* aIsTimedWrite = */ false);
+    }
+
+    if (status == Status::Success)
+    {
+        if (mHasMoreChunks)
+        {
+            if (PrepareForNextChunk() == CHIP_NO_ERROR)
+            {
+                return CHIP_NO_ERROR;
+            }
+            status = Status::Failure;
+        }
+        else
+        {
+            // Final chunk: clear the delegate before sending so that the exchange closing
+            // underneath the send does not re-enter this handler, then send the single
+            // response aggregating the statuses of every chunk.
+            apExchangeContext->SetDelegate(nullptr);
+            CHIP_ERROR err = SendWriteResponse();
+            Shutdown();
+            return err;
+        }
+    }
+
+    apExchangeContext->SetDelegate(nullptr);
+    StatusResponse::Send(status, apExchangeContext, false /* aExpectResponse */);
+    Shutdown();
+    return CHIP_NO_ERROR;
+}
+
+void WriteHandler::OnResponseTimeout(Messaging::ExchangeContext * apExchangeContext)
+{
+    ChipLogError(DataManagement, "Time out! Failed to receive write chunk from Exchange: " ChipLogFormatExchange,
+                 ChipLogValueExchange(apExchangeContext));
+    Shutdown();
+}
+
+void WriteHandler::OnExchangeClosing(Messaging::ExchangeContext * apExchangeContext)
+{
+    // The peer dropped the exchange before the final chunk arrived: abandon the partially
+    // accumulated response.
+    VerifyOrReturn(mState != State::Uninitialized && mState != State::Sending);
+    mpExchangeCtx = nullptr;
+    Shutdown();
+}
+
 CHIP_ERROR WriteHandler::FinalizeMessage(System::PacketBufferHandle & packet)
 {
     VerifyOrReturnError(mState == State::AddStatus, CHIP_ERROR_INCORRECT_STATE);
@@ -231,6 +327,14 @@ Status WriteHandler::ProcessWriteRequest(System::PacketBufferHandle && aPayload,
     err = writeRequestParser.GetIsFabricFiltered(&mIsFabricFiltered);
     SuccessOrExit(err);
 
+    mHasMoreChunks = false;
+    err            = writeRequestParser.GetMoreChunkedMessages(&mHasMoreChunks);
+    if (err == CHIP_END_OF_TLV)
+    {
+        err = CHIP_NO_ERROR;
+    }
+    SuccessOrExit(err);
+
     err = writeRequestParser.GetWriteRequests(&AttributeDataIBsParser);
     SuccessOrExit(err);
 
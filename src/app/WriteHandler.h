@@ -36,8 +36,14 @@ namespace chip {
 namespace app {
 /**
  *  @brief The write handler is responsible for processing a write request and sending a write reply.
+ *
+ *  A request carrying MoreChunkedMessages switches the handler into streaming mode: the handler
+ *  takes over the exchange, accumulates per-attribute statuses across all chunks and sends one
+ *  aggregated WriteResponse after the final chunk.  Intermediate chunks are acknowledged with a
+ *  StatusResponse only once per CHIP_CONFIG_IM_WRITE_CHUNK_ACK_WINDOW chunks, so bulk writes cost
+ *  a round trip per window instead of one per message.
  */
-class WriteHandler
+class WriteHandler : public Messaging::ExchangeDelegate
 {
 public:
     /**
@@ -106,6 +112,19 @@ private:
     CHIP_ERROR FinalizeMessage(System::PacketBufferHandle & packet);
     CHIP_ERROR SendWriteResponse();
 
+    /**
+     *  Keep the exchange open after a chunk that announced more chunks to come: take over the
+     *  exchange so follow-up chunks are delivered to this handler, and acknowledge progress with
+     *  a StatusResponse once per ack window.
+     */
+    CHIP_ERROR PrepareForNextChunk();
+
+    // ExchangeDelegate: delivery of follow-up WriteRequest chunks in streaming mode.
+    CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PayloadHeader & aPayloadHeader,
+                                 System::PacketBufferHandle && aPayload) override;
+    void OnResponseTimeout(Messaging::ExchangeContext * apExchangeContext) override;
+    void OnExchangeClosing(Messaging::ExchangeContext * apExchangeContext) override;
+
     void MoveToState(const State aTargetState);
     void ClearState();
     const char * GetStateStr() const;
@@ -117,9 +136,11 @@ private:
     Messaging::ExchangeContext * mpExchangeCtx = nullptr;
     WriteResponseMessage::Builder mWriteResponseBuilder;
     System::PacketBufferTLVWriter mMessageWriter;
-    State mState           = State::Uninitialized;
-    bool mIsTimedRequest   = false;
-    bool mIsFabricFiltered = false;
+    State mState               = State::Uninitialized;
+    bool mIsTimedRequest       = false;
+    bool mIsFabricFiltered     = false;
+    bool mHasMoreChunks        = false; // The chunk being processed announced more chunks to come
+    uint8_t mUnackedChunkCount = 0;     // Chunks absorbed since the last StatusResponse acknowledgment
 };
 } // namespace app
 } // namespace chip
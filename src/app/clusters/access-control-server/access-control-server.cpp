@@ -26,6 +26,7 @@
 #include <app/CommandHandler.h>
 #include <app/ConcreteCommandPath.h>
 #include <app/data-model/Encode.h>
+#include <app/server/Server.h>
 #include <app/util/af.h>
 #include <app/util/attribute-storage.h>
 
@@ -444,6 +445,8 @@ void MatterAccessControlPluginServerInitCallback()
 
     // TODO: move access control setup to lower level
     //       (it's OK and convenient here during development)
+    // Inject the server's storage so entries persist one record each.
+    Examples::GetAccessControlDelegate(&Server::GetInstance().GetPersistentStorage());
     gAccessControl.Init();
     SetAccessControl(gAccessControl);
 }
@@ -20,7 +20,11 @@
 
 #include <app/data-model/Decode.h>
 #include <app/data-model/Encode.h>
+#include <lib/core/CHIPEncoding.h>
 #include <lib/core/CHIPTLV.h>
+#include <lib/support/TypeTraits.h>
+
+#include <string.h>
 
 namespace chip {
 namespace app {
@@ -57,7 +61,117 @@ struct List : public Span<T>
     }
 };
 
+namespace detail {
+
+/*
+ * Fixed-width numeric list payloads can be serialized in bulk rather than
+ * element by element; everything else takes the generic path below.
+ */
 template <typename X>
+struct IsPackedNumericListElement
+{
+    static constexpr bool value = (std::is_integral<X>::value && !std::is_same<std::remove_cv_t<X>, bool>::value) ||
+        std::is_floating_point<X>::value;
+};
+
+/*
+ * Emit a single anonymous-tagged numeric element at p, producing bytes
+ * identical to what TLVWriter::Put() would emit for the same value (smallest
+ * integer width that can represent the value; fixed width for floats).
+ * Returns the advanced write pointer.  An element occupies at most
+ * kMaxPackedElementSize bytes.
+ */
+constexpr size_t kMaxPackedElementSize = 1 + sizeof(uint64_t);
+
+inline uint8_t * EmitPackedElement(uint8_t * p, uint64_t value)
+{
+    if (value <= UINT8_MAX)
+    {
+        Encoding::Write8(p, to_underlying(TLV::TLVElementType::UInt8));
+        Encoding::Write8(p, static_cast<uint8_t>(value));
+    }
+    else if (value <= UINT16_MAX)
+    {
+        Encoding::Write8(p, to_underlying(TLV::TLVElementType::UInt16));
+        Encoding::LittleEndian::Write16(p, static_cast<uint16_t>(value));
+    }
+    else if (value <= UINT32_MAX)
+    {
+        Encoding::Write8(p, to_underlying(TLV::TLVElementType::UInt32));
+        Encoding::LittleEndian::Write32(p, static_cast<uint32_t>(value));
+    }
+    else
+    {
+        Encoding::Write8(p, to_underlying(TLV::TLVElementType::UInt64));
+        Encoding::LittleEndian::Write64(p, value);
+    }
+    return p;
+}
+
+inline uint8_t * EmitPackedElement(uint8_t * p, int64_t value)
+{
+    if (value >= INT8_MIN && value <= INT8_MAX)
+    {
+        Encoding::Write8(p, to_underlying(TLV::TLVElementType::Int8));
+        Encoding::Write8(p, static_cast<uint8_t>(value));
+    }
+    else if (value >= INT16_MIN && value <= INT16_MAX)
+    {
+        Encoding::Write8(p, to_underlying(TLV::TLVElementType::Int16));
+        Encoding::LittleEndian::Write16(p, static_cast<uint16_t>(value));
+    }
+    else if (value >= INT32_MIN && value <= INT32_MAX)
+    {
+        Encoding::Write8(p, to_underlying(TLV::TLVElementType::Int32));
+        Encoding::LittleEndian::Write32(p, static_cast<uint32_t>(value));
+    }
+    else
+    {
+        Encoding::Write8(p, to_underlying(TLV::TLVElementType::Int64));
+        Encoding::LittleEndian::Write64(p, static_cast<uint64_t>(value));
+    }
+    return p;
+}
+
+inline uint8_t * EmitPackedElement(uint8_t * p, float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    Encoding::Write8(p, to_underlying(TLV::TLVElementType::FloatingPointNumber32));
+    Encoding::LittleEndian::Write32(p, bits);
+    return p;
+}
+
+inline uint8_t * EmitPackedElement(uint8_t * p, double value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    Encoding::Write8(p, to_underlying(TLV::TLVElementType::FloatingPointNumber64));
+    Encoding::LittleEndian::Write64(p, bits);
+    return p;
+}
+
+template <typename X, typename std::enable_if_t<std::is_integral<X>::value && std::is_unsigned<X>::value, int> = 0>
+inline uint8_t * EmitPackedListElement(uint8_t * p, X value)
+{
+    return EmitPackedElement(p, static_cast<uint64_t>(value));
+}
+
+template <typename X, typename std::enable_if_t<std::is_integral<X>::value && std::is_signed<X>::value, int> = 0>
+inline uint8_t * EmitPackedListElement(uint8_t * p, X value)
+{
+    return EmitPackedElement(p, static_cast<int64_t>(value));
+}
+
+template <typename X, typename std::enable_if_t<std::is_floating_point<X>::value, int> = 0>
+inline uint8_t * EmitPackedListElement(uint8_t * p, X value)
+{
+    return EmitPackedElement(p, value);
+}
+
+} // namespace detail
+
+template <typename X, typename std::enable_if_t<!detail::IsPackedNumericListElement<X>::value, int> = 0>
 inline CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag, List<X> list)
 {
     TLV::TLVType type;
@@ -72,6 +186,38 @@ inline CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag, List<X> list)
     return CHIP_NO_ERROR;
 }
 
+/*
+ * Fast path for lists of fixed-width numeric values: elements are serialized
+ * in bulk into a small stack buffer that is flushed into the writer with
+ * PutPreEncodedElements(), avoiding the per-element writer state machine.
+ * The output is byte-identical to the generic path above.
+ */
+template <typename X, typename std::enable_if_t<detail::IsPackedNumericListElement<X>::value, int> = 0>
+inline CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag, List<X> list)
+{
+    TLV::TLVType type;
+    uint8_t chunk[16 * detail::kMaxPackedElementSize];
+    uint8_t * p = chunk;
+
+    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Array, type));
+    for (auto & item : list)
+    {
+        p = detail::EmitPackedListElement(p, item);
+        if (static_cast<size_t>(p - chunk) + detail::kMaxPackedElementSize > sizeof(chunk))
+        {
+            ReturnErrorOnFailure(writer.PutPreEncodedElements(chunk, static_cast<uint32_t>(p - chunk)));
+            p = chunk;
+        }
+    }
+    if (p != chunk)
+    {
+        ReturnErrorOnFailure(writer.PutPreEncodedElements(chunk, static_cast<uint32_t>(p - chunk)));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(type));
+
+    return CHIP_NO_ERROR;
+}
+
 } // namespace DataModel
 } // namespace app
 } // namespace chip
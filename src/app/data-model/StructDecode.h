@@ -0,0 +1,120 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/data-model/Decode.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+
+/*
+ * @brief
+ *
+ * Compile-time description of a single struct field: the context tag number the
+ * field is encoded under and the member of the decodable type it decodes into.
+ *
+ * A set of these forms the schema table for a struct; building the table is a
+ * constexpr operation, so a table declared static const occupies read-only data
+ * and costs nothing at runtime beyond the tag comparisons.
+ */
+template <typename Struct, typename Field>
+struct FieldDescriptor
+{
+    uint8_t tag;
+    Field Struct::*member;
+};
+
+template <typename Struct, typename Field>
+constexpr FieldDescriptor<Struct, Field> MakeFieldDescriptor(uint8_t tag, Field Struct::*member)
+{
+    return FieldDescriptor<Struct, Field>{ tag, member };
+}
+
+namespace detail {
+
+template <typename Struct>
+inline bool DecodeMatchingField(TLV::TLVReader & reader, Struct & x, uint8_t tagNum, CHIP_ERROR & err)
+{
+    return false;
+}
+
+template <typename Struct, typename Field, typename... Rest>
+inline bool DecodeMatchingField(TLV::TLVReader & reader, Struct & x, uint8_t tagNum, CHIP_ERROR & err,
+                                const FieldDescriptor<Struct, Field> & field, const Rest &... rest)
+{
+    if (field.tag == tagNum)
+    {
+        err = Decode(reader, x.*(field.member));
+        return true;
+    }
+    return DecodeMatchingField(reader, x, tagNum, err, rest...);
+}
+
+} // namespace detail
+
+/*
+ * @brief
+ *
+ * Decodes a TLV structure into @p x in a single pass, driven by a schema table of
+ * FieldDescriptors rather than a hand-rolled per-field tag switch.
+ *
+ * The reader is expected to be positioned on the structure element.  Elements whose
+ * context tag does not appear in the schema (and elements with non-context tags) are
+ * skipped, preserving the forward-compatibility behavior of the generated decoders.
+ *
+ * Intended use, mirroring the generated DecodableType::Decode bodies:
+ *
+ * CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+ * {
+ *     return DataModel::DecodeStruct(reader, *this,
+ *                                    DataModel::MakeFieldDescriptor(to_underlying(Fields::kFieldA), &DecodableType::fieldA),
+ *                                    DataModel::MakeFieldDescriptor(to_underlying(Fields::kFieldB), &DecodableType::fieldB));
+ * }
+ */
+template <typename Struct, typename... Fields>
+CHIP_ERROR DecodeStruct(TLV::TLVReader & reader, Struct & x, const Fields &... fields)
+{
+    CHIP_ERROR err;
+    TLV::TLVType outer;
+
+    VerifyOrReturnError(reader.GetType() == TLV::kTLVType_Structure, CHIP_ERROR_WRONG_TLV_TYPE);
+    ReturnErrorOnFailure(reader.EnterContainer(outer));
+
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        if (!TLV::IsContextTag(reader.GetTag()))
+            continue;
+
+        CHIP_ERROR fieldErr = CHIP_NO_ERROR;
+        if (detail::DecodeMatchingField(reader, x, static_cast<uint8_t>(TLV::TagNumFromTag(reader.GetTag())), fieldErr, fields...))
+        {
+            ReturnErrorOnFailure(fieldErr);
+        }
+    }
+
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    return reader.ExitContainer(outer);
+}
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
@@ -27,16 +27,33 @@
 #include <app/InteractionModelEngine.h>
 #include <app/reporting/Engine.h>
 #include <app/util/MatterCallbacks.h>
+#include <app/util/attribute-storage.h>
 
 using namespace chip::Access;
 
 namespace chip {
 namespace app {
 namespace reporting {
+namespace {
+
+bool SubjectDescriptorsMatch(const SubjectDescriptor & a, const SubjectDescriptor & b)
+{
+    VerifyOrReturnError(a.fabricIndex == b.fabricIndex && a.authMode == b.authMode && a.subject == b.subject, false);
+    for (size_t i = 0; i < CATValues::size(); i++)
+    {
+        VerifyOrReturnError(a.cats.values[i] == b.cats.values[i], false);
+    }
+    return true;
+}
+
+} // namespace
+
 CHIP_ERROR Engine::Init()
 {
     mNumReportsInFlight = 0;
     mCurReadHandlerIdx  = 0;
+    InvalidateCachedAttributeData();
+    ReplenishReportDeficits();
     return CHIP_NO_ERROR;
 }
 
@@ -44,18 +61,143 @@ void Engine::Shutdown()
 {
     mNumReportsInFlight = 0;
     mCurReadHandlerIdx  = 0;
+    InvalidateCachedAttributeData();
+    ReplenishReportDeficits();
     InteractionModelEngine::GetInstance()->ReleaseClusterInfoList(mpGlobalDirtySet);
     mpGlobalDirtySet = nullptr;
 }
 
+bool Engine::IsAttributeDataShared(ReadHandler * apReadHandler, const ConcreteReadAttributePath & aPath)
+{
+    ClusterInfo pathInfo;
+    pathInfo.mEndpointId  = aPath.mEndpointId;
+    pathInfo.mClusterId   = aPath.mClusterId;
+    pathInfo.mAttributeId = aPath.mAttributeId;
+
+    const uint64_t pathInterestMask = pathInfo.GetAttributeInterestMask();
+
+    for (auto & handler : InteractionModelEngine::GetInstance()->mReadHandlers)
+    {
+        if (&handler == apReadHandler || handler.IsFree() || !handler.IsSubscriptionType())
+        {
+            continue;
+        }
+        if ((handler.GetAttributeInterestMask() & pathInterestMask) == 0)
+        {
+            continue;
+        }
+        if (!SubjectDescriptorsMatch(handler.GetSubjectDescriptor(), apReadHandler->GetSubjectDescriptor()))
+        {
+            continue;
+        }
+        for (auto clusterInfo = handler.GetAttributeClusterInfolist(); clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
+        {
+            if (clusterInfo->IsAttributePathSupersetOf(aPath))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+CHIP_ERROR Engine::CacheAttributeData(const SubjectDescriptor & aSubjectDescriptor, const ConcreteReadAttributePath & aPath,
+                                      AttributeValueEncoder::AttributeEncodeState * apEncoderState)
+{
+    InvalidateCachedAttributeData();
+
+    // The read mutates the encode state; keep a copy so that on failure the caller can
+    // restart the direct, chunkable encoding from the original state.
+    AttributeValueEncoder::AttributeEncodeState stateBackup = *apEncoderState;
+
+    TLV::TLVWriter cacheWriter;
+    AttributeReportIBs::Builder cacheBuilder;
+
+    cacheWriter.Init(mCachedAttributeData, sizeof(mCachedAttributeData));
+    CHIP_ERROR err = cacheBuilder.Init(&cacheWriter);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = ReadSingleClusterData(aSubjectDescriptor, aPath, cacheBuilder, apEncoderState);
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        err = cacheBuilder.EndOfAttributeReportIBs().GetError();
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        err = cacheWriter.Finalize();
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        // Most commonly the encoding does not fit kAttributeCacheSize; such attributes are
+        // encoded (and, if need be, chunked) directly into each report instead.
+        *apEncoderState = stateBackup;
+        return err;
+    }
+
+    mCachedAttributePath     = aPath;
+    mCachedSubjectDescriptor = aSubjectDescriptor;
+    mCachedAttributeDataLen  = cacheWriter.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Engine::CopyCachedAttributeData(AttributeReportIBs::Builder & aAttributeReportIBs)
+{
+    TLV::TLVReader reader;
+    TLV::TLVType containerType;
+
+    reader.Init(mCachedAttributeData, mCachedAttributeDataLen);
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        ReturnErrorOnFailure(aAttributeReportIBs.GetWriter()->CopyElement(reader));
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR
-Engine::RetrieveClusterData(const SubjectDescriptor & aSubjectDescriptor, AttributeReportIBs::Builder & aAttributeReportIBs,
+Engine::RetrieveClusterData(ReadHandler * apReadHandler, AttributeReportIBs::Builder & aAttributeReportIBs,
                             const ConcreteReadAttributePath & aPath, AttributeValueEncoder::AttributeEncodeState * aEncoderState)
 {
+    const SubjectDescriptor & subjectDescriptor = apReadHandler->GetSubjectDescriptor();
+
     ChipLogDetail(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Attribute %" PRIx32 " is dirty", aPath.mClusterId,
                   aPath.mAttributeId);
     MatterPreAttributeReadCallback(aPath);
-    ReturnErrorOnFailure(ReadSingleClusterData(aSubjectDescriptor, aPath, aAttributeReportIBs, aEncoderState));
+
+    // A partially encoded list is resumed from aEncoderState, which is specific to this
+    // handler's report stream, so the shared-encoding cache is bypassed entirely.
+    const bool chunkingInProgress = (aEncoderState != nullptr) && aEncoderState->AllowPartialData();
+    bool useCachedData            = false;
+
+    if (!chunkingInProgress)
+    {
+        if (mCachedAttributeDataLen != 0 && mCachedAttributePath == aPath &&
+            SubjectDescriptorsMatch(mCachedSubjectDescriptor, subjectDescriptor))
+        {
+            useCachedData = true;
+        }
+        else if (aEncoderState != nullptr && IsAttributeDataShared(apReadHandler, aPath) &&
+                 CacheAttributeData(subjectDescriptor, aPath, aEncoderState) == CHIP_NO_ERROR)
+        {
+            useCachedData = true;
+        }
+    }
+
+    if (useCachedData)
+    {
+        // Another subscription with the same subject also reports this attribute; splice
+        // the one shared encoding into this report instead of repeating the read.
+        ReturnErrorOnFailure(CopyCachedAttributeData(aAttributeReportIBs));
+    }
+    else
+    {
+        ReturnErrorOnFailure(ReadSingleClusterData(subjectDescriptor, aPath, aAttributeReportIBs, aEncoderState));
+    }
     MatterPostAttributeReadCallback(aPath);
     return CHIP_NO_ERROR;
 }
@@ -111,14 +253,62 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
                     continue;
                 }
             }
+            else
+            {
+                // Priming reports regard every path as dirty, but the client may have
+                // told us which cluster data versions it already holds; suppress
+                // clusters that have not changed since.
+                DataVersion filterVersion;
+                if (apReadHandler->GetDataVersionFilter(readPath.mEndpointId, readPath.mClusterId, filterVersion) &&
+                    filterVersion == GetClusterDataVersion(readPath.mEndpointId, readPath.mClusterId))
+                {
+                    continue;
+                }
+            }
 
             // If we are processing a read request, or the initial report of a subscription, just regard all paths as dirty paths.
             TLV::TLVWriter attributeBackup;
             attributeReportIBs.Checkpoint(attributeBackup);
             ConcreteReadAttributePath pathForRetrieval(readPath);
+
+            // Tiered reporting: when the cluster offers a compact summary for this
+            // attribute, the subscription's priming report carries the summary and the
+            // attribute is marked dirty again, so the full value streams in the report
+            // that follows and first-paint does not wait on a huge list transfer.
+            if (apReadHandler->IsPriming() && apReadHandler->IsSubscriptionType())
+            {
+                AttributeAccessInterface * accessInterface =
+                    findAttributeAccessOverride(readPath.mEndpointId, readPath.mClusterId);
+                if (accessInterface != nullptr && accessInterface->HasSummaryRepresentation(readPath))
+                {
+                    pathForRetrieval.mSummaryRead = true;
+
+                    ClusterInfo detailPath;
+                    detailPath.mEndpointId  = readPath.mEndpointId;
+                    detailPath.mClusterId   = readPath.mClusterId;
+                    detailPath.mAttributeId = readPath.mAttributeId;
+                    // Failure only means the dirty set is full; the summary is still
+                    // delivered and any later mutation re-dirties the attribute.
+                    LogErrorOnFailure(SetDirty(detailPath));
+                }
+            }
             // Load the saved state from previous encoding session for chunking of one single attribute (list chunking).
             AttributeValueEncoder::AttributeEncodeState encodeState = apReadHandler->GetAttributeEncodeState();
-            err = RetrieveClusterData(apReadHandler->GetSubjectDescriptor(), attributeReportIBs, pathForRetrieval, &encodeState);
+            uint32_t storeGeneration                                = GetAttributeStoreGeneration();
+            err = RetrieveClusterData(apReadHandler, attributeReportIBs, pathForRetrieval, &encodeState);
+            if (err == CHIP_NO_ERROR && storeGeneration != GetAttributeStoreGeneration())
+            {
+                // An application read callback mutated attribute data while this
+                // attribute was being encoded, so the encoding may mix pre- and
+                // post-write data.  Roll it back and encode again: the retry runs
+                // after the write completed and captures a consistent snapshot.
+                // A single retry is deliberate -- a callback that writes on every
+                // read would otherwise never converge.
+                ChipLogDetail(DataManagement, "<RE:Run> Attribute data changed mid-encode, re-encoding a consistent snapshot");
+                attributeReportIBs.Rollback(attributeBackup);
+                encodeState = apReadHandler->GetAttributeEncodeState();
+                err         = RetrieveClusterData(apReadHandler, attributeReportIBs, pathForRetrieval, &encodeState);
+            }
             if (err != CHIP_NO_ERROR)
             {
                 ChipLogError(DataManagement,
@@ -310,10 +500,24 @@ exit:
 CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
-    chip::System::PacketBufferTLVWriter reportDataWriter;
-    ReportDataMessage::Builder reportDataBuilder;
+    // Reuse the engine-owned writer and builder tree instead of constructing
+    // them on the stack for every chunk; Init below resets all nested state.
+    chip::System::PacketBufferTLVWriter & reportDataWriter = mReportDataWriter;
+    ReportDataMessage::Builder & reportDataBuilder         = mReportDataBuilder;
+
+    // Segment size for growing the report with chained buffers on demand.  The
+    // encryption path consolidates the chain once, into an exactly sized
+    // buffer, so a small report never pays for the worst-case allocation and a
+    // large one grows segment by segment instead of failing outright.
+    constexpr uint16_t kReportSegmentSize = 512;
+
+#if CONFIG_IM_BUILD_FOR_UNIT_TEST
+    // Tests reserve large amounts of the buffer up front to force chunking,
+    // which requires the worst case to be physically present in one segment.
     chip::System::PacketBufferHandle bufHandle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
-    uint16_t reservedSize                      = 0;
+#else
+    chip::System::PacketBufferHandle bufHandle = System::PacketBufferHandle::New(kReportSegmentSize);
+#endif
     bool hasMoreChunks;
 
     // Reserved size for the MoreChunks boolean flag, which takes up 1 byte for the control tag and 1 byte for the context tag.
@@ -325,21 +529,17 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     VerifyOrExit(apReadHandler != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(!bufHandle.IsNull(), err = CHIP_ERROR_NO_MEMORY);
 
-    if (bufHandle->AvailableDataLength() > kMaxSecureSduLengthBytes)
-    {
-        reservedSize = static_cast<uint16_t>(bufHandle->AvailableDataLength() - kMaxSecureSduLengthBytes);
-    }
-
-    reportDataWriter.Init(std::move(bufHandle));
+    // The writer's maximum length caps the whole chain, so the generated packet
+    // always fits within kMaxSecureSduLengthBytes regardless of buffer capacity.
+    reportDataWriter.Init(std::move(bufHandle), /* useChainedBuffers = */ true, chip::app::kMaxSecureSduLengthBytes,
+                          kReportSegmentSize);
 
 #if CONFIG_IM_BUILD_FOR_UNIT_TEST
     reportDataWriter.ReserveBuffer(mReservedSize);
 #endif
 
-    // Always limit the size of the generated packet to fit within kMaxSecureSduLengthBytes regardless of the available buffer
-    // capacity.
-    // Also, we need to reserve some extra space for the MIC field.
-    reportDataWriter.ReserveBuffer(static_cast<uint32_t>(reservedSize + chip::Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES));
+    // Reserve space for the MIC field appended after encryption.
+    reportDataWriter.ReserveBuffer(chip::Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES);
 
     // Create a report data.
     err = reportDataBuilder.Init(&reportDataWriter);
@@ -404,10 +604,21 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     VerifyOrExit(err == CHIP_NO_ERROR,
                  ChipLogError(DataManagement, "<RE> Error sending out report data with %" CHIP_ERROR_FORMAT "!", err.Format()));
 
+    if (CHIP_IM_REPORT_SCHEDULING_QUANTUM_BYTES != 0)
+    {
+        // Charge the bytes just sent against this handler's deficit round-robin credit, so
+        // Run() lets lighter subscriptions ahead once a heavy one has used its share.
+        mHandlerByteDeficit[InteractionModelEngine::GetInstance()->GetReadHandlerArrayIndex(apReadHandler)] -=
+            static_cast<int32_t>(reportDataWriter.GetLengthWritten());
+    }
+
     ChipLogDetail(DataManagement, "<RE> ReportsInFlight = %" PRIu32 " with readHandler %" PRIu32 ", RE has %s", mNumReportsInFlight,
                   mCurReadHandlerIdx, hasMoreChunks ? "more messages" : "no more messages");
 
 exit:
+    // Drop the packet buffer on paths that never reached Finalize(); a no-op
+    // when the buffer was already released to SendReport.
+    reportDataWriter.Reset();
     if (err != CHIP_NO_ERROR)
     {
         apReadHandler->Shutdown(ReadHandler::ShutdownOptions::AbortCurrentExchange);
@@ -454,26 +665,66 @@ CHIP_ERROR Engine::ScheduleRun()
 
 void Engine::Run()
 {
-    uint32_t numReadHandled = 0;
+    uint32_t numReadHandled                     = 0;
+    const System::Clock::Timestamp runStartTime = System::SystemClock().GetMonotonicTimestamp();
+
+    // Cached attribute encodings are only coherent within a single pass of the run loop.
+    InvalidateCachedAttributeData();
 
     InteractionModelEngine * imEngine = InteractionModelEngine::GetInstance();
     ReadHandler * readHandler         = imEngine->mReadHandlers + mCurReadHandlerIdx;
 
     mRunScheduled = false;
 
+    bool deferredForFairness = false;
+
     while ((mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT) && (numReadHandled < CHIP_IM_MAX_NUM_READ_HANDLER))
     {
         if (readHandler->IsReportable())
         {
-            CHIP_ERROR err = BuildAndSendSingleReportData(readHandler);
-            if (err != CHIP_NO_ERROR)
+            if ((CHIP_IM_REPORT_SCHEDULING_QUANTUM_BYTES == 0) || (mHandlerByteDeficit[mCurReadHandlerIdx] > 0))
             {
-                return;
+                CHIP_ERROR err = BuildAndSendSingleReportData(readHandler);
+                if (err != CHIP_NO_ERROR)
+                {
+                    return;
+                }
             }
+            else
+            {
+                // This handler has spent its byte quantum; let the remaining handlers report
+                // first and give it a fresh slice on the pass scheduled below.
+                deferredForFairness = true;
+            }
+        }
+        else if (readHandler->IsFree())
+        {
+            // Keep freed slots at full credit so a new subscription does not inherit the
+            // deficit its predecessor ran up.
+            mHandlerByteDeficit[mCurReadHandlerIdx] = CHIP_IM_REPORT_SCHEDULING_QUANTUM_BYTES;
         }
         numReadHandled++;
         mCurReadHandlerIdx = (mCurReadHandlerIdx + 1) % CHIP_IM_MAX_NUM_READ_HANDLER;
         readHandler        = imEngine->mReadHandlers + mCurReadHandlerIdx;
+
+        // Bound how long a single pass may occupy the event loop.  mCurReadHandlerIdx already
+        // carries the round-robin position, so the remaining handlers are simply deferred to a
+        // freshly scheduled pass, letting other queued work interleave with report generation.
+        if ((CHIP_IM_REPORT_RUN_BUDGET_MS != 0) && (numReadHandled < CHIP_IM_MAX_NUM_READ_HANDLER) &&
+            (System::SystemClock().GetMonotonicTimestamp() - runStartTime >=
+             System::Clock::Milliseconds64(CHIP_IM_REPORT_RUN_BUDGET_MS)))
+        {
+            LogErrorOnFailure(ScheduleRun());
+            return;
+        }
+    }
+
+    if (deferredForFairness)
+    {
+        // Every handler with remaining credit has had its turn; replenish the quanta and
+        // re-run for the handlers deferred above.
+        ReplenishReportDeficits();
+        LogErrorOnFailure(ScheduleRun());
     }
 
     bool allReadClean = true;
@@ -493,10 +744,32 @@ void Engine::Run()
     }
 }
 
+void Engine::ReplenishReportDeficits()
+{
+    for (auto & deficit : mHandlerByteDeficit)
+    {
+        deficit = CHIP_IM_REPORT_SCHEDULING_QUANTUM_BYTES;
+    }
+}
+
 CHIP_ERROR Engine::SetDirty(ClusterInfo & aClusterInfo)
 {
+    const uint64_t dirtyInterestMask = aClusterInfo.GetAttributeInterestMask();
+
+    if (mCachedAttributeDataLen != 0 && aClusterInfo.IsAttributePathSupersetOf(mCachedAttributePath))
+    {
+        InvalidateCachedAttributeData();
+    }
+
     for (auto & handler : InteractionModelEngine::GetInstance()->mReadHandlers)
     {
+        // A handler whose accumulated interest mask shares no bits with the dirty path cannot
+        // have an intersecting path, so skip walking its path list entirely.
+        if ((handler.GetAttributeInterestMask() & dirtyInterestMask) == 0)
+        {
+            continue;
+        }
+
         // We call SetDirty for both read interactions and subscribe interactions, since we may sent inconsistent attribute data
         // between two chunks. SetDirty will be ignored automatically by read handlers which is waiting for response to last message
         // chunk for read interactions.
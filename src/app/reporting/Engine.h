@@ -108,11 +108,33 @@ private:
                                                        bool * apHasMoreChunks, bool * apHasEncodedData);
     CHIP_ERROR BuildSingleReportDataEventReports(ReportDataMessage::Builder & reportDataBuilder, ReadHandler * apReadHandler,
                                                  bool * apHasMoreChunks, bool * apHasEncodedData);
-    CHIP_ERROR RetrieveClusterData(const Access::SubjectDescriptor & aSubjectDescriptor,
-                                   AttributeReportIBs::Builder & aAttributeReportIBs,
+    CHIP_ERROR RetrieveClusterData(ReadHandler * apReadHandler, AttributeReportIBs::Builder & aAttributeReportIBs,
                                    const ConcreteReadAttributePath & aClusterInfo,
                                    AttributeValueEncoder::AttributeEncodeState * apEncoderState);
 
+    /**
+     * Returns true if some other active subscription with the same subject descriptor as
+     * apReadHandler also has aPath in its interest set, i.e. the attribute data about to be
+     * encoded for apReadHandler would be read and encoded again, identically, for that handler.
+     */
+    bool IsAttributeDataShared(ReadHandler * apReadHandler, const ConcreteReadAttributePath & aPath);
+
+    /**
+     * Read an attribute once and keep its encoded AttributeReportIB(s) in
+     * mCachedAttributeData, so path-identical subscriptions reporting in the same run can
+     * copy the encoding instead of repeating the read. Fails (leaving the cache invalid and
+     * *apEncoderState unchanged) if the encoding does not fit kAttributeCacheSize.
+     */
+    CHIP_ERROR CacheAttributeData(const Access::SubjectDescriptor & aSubjectDescriptor, const ConcreteReadAttributePath & aPath,
+                                  AttributeValueEncoder::AttributeEncodeState * apEncoderState);
+
+    /**
+     * Copy the cached attribute encoding into aAttributeReportIBs.
+     */
+    CHIP_ERROR CopyCachedAttributeData(AttributeReportIBs::Builder & aAttributeReportIBs);
+
+    void InvalidateCachedAttributeData() { mCachedAttributeDataLen = 0; }
+
     /**
      * Check all active subscription, if the subscription has no paths that intersect with global dirty set,
      * it would clear dirty flag for that subscription
@@ -135,6 +157,11 @@ private:
     CHIP_ERROR ScheduleBufferPressureEventDelivery(uint32_t aBytesWritten);
     void GetMinEventLogPosition(uint32_t & aMinLogPosition);
 
+    /**
+     * Restore every read handler's deficit round-robin byte credit to the full quantum.
+     */
+    void ReplenishReportDeficits();
+
     /**
      * Boolean to indicate if ScheduleRun is pending. This flag is used to prevent calling ScheduleRun multiple times
      * within the same execution context to avoid applying too much pressure on platforms that use small, fixed size event queues.
@@ -163,6 +190,44 @@ private:
      */
     ClusterInfo * mpGlobalDirtySet = nullptr;
 
+    /**
+     *  Deficit round-robin byte credit for each read handler slot. A handler only builds
+     *  reports while its credit is positive; the bytes of every report sent are charged
+     *  against the sending handler's credit, and credit is replenished once every handler
+     *  with remaining credit has had its turn. This keeps a large wildcard read from
+     *  delaying a small subscription's report past a single pass of the run loop.
+     *
+     */
+    int32_t mHandlerByteDeficit[CHIP_IM_MAX_NUM_READ_HANDLER];
+
+    /**
+     *  Reusable scaffolding for report construction. ReportDataMessage::Builder
+     *  embeds the whole nested builder tree (AttributeReportIBs, EventReportIBs
+     *  and their IB builders), so keeping one instance here and re-initializing
+     *  it in place avoids constructing and tearing that tree down on the stack
+     *  for every chunk of every report. Both objects are only valid while a
+     *  report is being built; BuildAndSendSingleReportData re-initializes them
+     *  before use and releases the packet buffer on all exit paths.
+     *
+     */
+    chip::System::PacketBufferTLVWriter mReportDataWriter;
+    ReportDataMessage::Builder mReportDataBuilder;
+
+    /**
+     *  Single-entry cache of the most recently encoded attribute, used to fan a data change
+     *  out to multiple subscriptions without re-reading and re-encoding the attribute once
+     *  per subscriber. The cache is only filled when another subscription with the same
+     *  subject descriptor shares the path (access control and fabric-scoped data make the
+     *  encoding subject-dependent), is coherent only within a single pass of the run loop,
+     *  and is invalidated as soon as the attribute is marked dirty again.
+     *
+     */
+    static constexpr size_t kAttributeCacheSize = 256;
+    ConcreteAttributePath mCachedAttributePath;
+    Access::SubjectDescriptor mCachedSubjectDescriptor;
+    uint32_t mCachedAttributeDataLen = 0;
+    uint8_t mCachedAttributeData[kAttributeCacheSize];
+
 #if CONFIG_IM_BUILD_FOR_UNIT_TEST
     uint32_t mReservedSize = 0;
 #endif
@@ -61,3 +61,12 @@ void MatterReportingAttributeChangeCallback(chip::EndpointId endpoint, chip::Clu
  * Same but with a nicer attribute path.
  */
 void MatterReportingAttributeChangeCallback(const chip::app::ConcreteAttributePath & aPath);
+
+/*
+ * Same but for the case when the entire set of attributes on an endpoint
+ * changes at once -- e.g. a dynamic (bridged) endpoint appearing or
+ * disappearing.  Marks every path on that endpoint dirty and bumps the data
+ * version of each of its server clusters, without touching any other
+ * endpoint.
+ */
+void MatterReportingAttributeChangeCallback(chip::EndpointId endpoint);
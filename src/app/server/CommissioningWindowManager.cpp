@@ -186,13 +186,18 @@ CHIP_ERROR CommissioningWindowManager::OpenCommissioningWindow()
     }
     else
     {
-        uint32_t pinCode;
-        ReturnErrorOnFailure(DeviceLayer::ConfigurationMgr().GetSetupPinCode(pinCode));
+        if (!mBasicVerifierReady)
+        {
+            // Fall back to deriving the verifier now.  Applications that care
+            // about event-loop stalls should call PrecomputeBasicVerifier
+            // before commissioning traffic starts.
+            ReturnErrorOnFailure(PrecomputeBasicVerifier());
+        }
 
         ReturnErrorOnFailure(mPairingSession.WaitForPairing(
-            pinCode, kSpake2p_Iteration_Count,
-            ByteSpan(reinterpret_cast<const uint8_t *>(kSpake2pKeyExchangeSalt), strlen(kSpake2pKeyExchangeSalt)), keyID,
-            Optional<ReliableMessageProtocolConfig>::Value(gDefaultMRPConfig), this));
+            mBasicPASEVerifier, kSpake2p_Iteration_Count,
+            ByteSpan(reinterpret_cast<const uint8_t *>(kSpake2pKeyExchangeSalt), strlen(kSpake2pKeyExchangeSalt)),
+            0 /* passcodeID */, keyID, Optional<ReliableMessageProtocolConfig>::Value(gDefaultMRPConfig), this));
 
         // reset all advertising, indicating we are in commissioningMode
         app::DnssdServer::Instance().StartServer(Dnssd::CommissioningMode::kEnabledBasic);
@@ -201,6 +206,20 @@ CHIP_ERROR CommissioningWindowManager::OpenCommissioningWindow()
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CommissioningWindowManager::PrecomputeBasicVerifier()
+{
+    uint32_t pinCode;
+    ReturnErrorOnFailure(DeviceLayer::ConfigurationMgr().GetSetupPinCode(pinCode));
+
+    ReturnErrorOnFailure(PASESession::GeneratePASEVerifier(
+        mBasicPASEVerifier, kSpake2p_Iteration_Count,
+        ByteSpan(reinterpret_cast<const uint8_t *>(kSpake2pKeyExchangeSalt), strlen(kSpake2pKeyExchangeSalt)),
+        false /* useRandomPIN */, pinCode));
+
+    mBasicVerifierReady = true;
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR CommissioningWindowManager::OpenBasicCommissioningWindow(uint16_t commissioningTimeoutSeconds,
                                                                     CommissioningWindowAdvertisement advertisementMode)
 {
@@ -57,6 +57,22 @@ public:
                                                PASEVerifier & verifier, uint32_t iterations, chip::ByteSpan salt,
                                                uint16_t passcodeID);
 
+    /**
+     * Precompute and cache the PASE verifier used by basic commissioning windows.
+     *
+     * The PBKDF2 derivation behind the verifier is expensive and otherwise runs
+     * during every PASE handshake.  Calling this ahead of time -- for example
+     * from an application worker thread during startup, before the event loop
+     * begins serving commissioning traffic -- means opening or reopening a
+     * basic window never runs the derivation while messages are being
+     * processed.  The cached verifier is reused for every subsequent basic
+     * window; call again to refresh it if the device's setup PIN code changes.
+     *
+     * If this has not been called, the verifier is computed on first use when a
+     * basic window is opened.
+     */
+    CHIP_ERROR PrecomputeBasicVerifier();
+
     void CloseCommissioningWindow();
 
     app::Clusters::AdministratorCommissioning::CommissioningWindowStatus CommissioningWindowStatus() const { return mWindowStatus; }
@@ -100,6 +116,9 @@ private:
 
     uint8_t mFailedCommissioningAttempts = 0;
 
+    bool mBasicVerifierReady = false;
+    PASEVerifier mBasicPASEVerifier;
+
     bool mUseECM = false;
     PASEVerifier mECMPASEVerifier;
     uint16_t mECMDiscriminator = 0;
@@ -27,6 +27,7 @@
 #include <inet/IPAddress.h>
 #include <inet/InetError.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/core/CHIPTLV.h>
 #include <lib/dnssd/Advertiser.h>
 #include <lib/dnssd/ServiceNaming.h>
 #include <lib/support/CodeUtils.h>
@@ -64,6 +65,30 @@ constexpr bool isRendezvousBypassed()
 #endif
 }
 
+// Collects each live session's replication record into a TLV array while
+// Server::CaptureUpgradeSnapshot() drives SessionManager::ReplicateAllSessions().
+class SnapshotSessionCapture : public chip::SessionReplicationDelegate
+{
+public:
+    SnapshotSessionCapture(chip::TLV::TLVWriter & writer) : mWriter(writer) {}
+
+    void OnSessionRecordUpdated(const chip::ByteSpan & record) override
+    {
+        if (mError == CHIP_NO_ERROR)
+        {
+            mError = mWriter.Put(chip::TLV::AnonymousTag, record);
+        }
+    }
+
+    void OnSessionRetired(uint16_t localSessionId) override {}
+
+    CHIP_ERROR GetError() const { return mError; }
+
+private:
+    chip::TLV::TLVWriter & mWriter;
+    CHIP_ERROR mError = CHIP_NO_ERROR;
+};
+
 } // namespace
 
 namespace chip {
@@ -95,7 +120,8 @@ Server::Server() :
     }), mCommissioningWindowManager(this), mGroupsProvider(mGroupsStorage)
 {}
 
-CHIP_ERROR Server::Init(AppDelegate * delegate, uint16_t secureServicePort, uint16_t unsecureServicePort)
+CHIP_ERROR Server::Init(AppDelegate * delegate, uint16_t secureServicePort, uint16_t unsecureServicePort,
+                        DataModelInit dataModelInit)
 {
     mSecuredServicePort   = secureServicePort;
     mUnsecuredServicePort = unsecureServicePort;
@@ -106,7 +132,6 @@ CHIP_ERROR Server::Init(AppDelegate * delegate, uint16_t secureServicePort, uint
 
     mCommissioningWindowManager.SetAppDelegate(delegate);
     mCommissioningWindowManager.SetSessionIDAllocator(&mSessionIDAllocator);
-    InitDataModelHandler(&mExchangeMgr);
 
 #if CHIP_DEVICE_LAYER_TARGET_DARWIN
     err = DeviceLayer::PersistedStorage::KeyValueStoreMgrImpl().Init("chip.store");
@@ -163,9 +188,41 @@ CHIP_ERROR Server::Init(AppDelegate * delegate, uint16_t secureServicePort, uint
     err = mMessageCounterManager.Init(&mExchangeMgr);
     SuccessOrExit(err);
 
+    err = mSessionRekey.Init(&mExchangeMgr);
+    SuccessOrExit(err);
+
     err = chip::app::InteractionModelEngine::GetInstance()->Init(&mExchangeMgr, nullptr);
     SuccessOrExit(err);
 
+    // The session path is up; initialize the generated cluster data model.
+    // This is the slowest part of startup on devices with large data models,
+    // so callers may defer it off the critical path: cluster entry points
+    // (read/write/command dispatch) run it lazily on first access, and the
+    // scheduled work item below covers the case where no access happens.
+    if (dataModelInit == DataModelInit::kImmediate)
+    {
+        InitDataModelHandler(&mExchangeMgr);
+    }
+    else
+    {
+        DeferInitDataModelHandler(&mExchangeMgr);
+        DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t) { EnsureDataModelInitialized(); });
+    }
+
+    // Restore persisted subscription state so that subscriptions re-established
+    // after a reboot can skip renegotiating paths and intervals.
+    err = mSubscriptionResumption.Init(&mServerStorage);
+    SuccessOrExit(err);
+    chip::app::InteractionModelEngine::GetInstance()->SetSubscriptionResumptionStorage(&mSubscriptionResumption);
+    {
+        size_t subscriptionCount = mSubscriptionResumption.Count();
+        if (subscriptionCount > 0)
+        {
+            ChipLogProgress(AppServer, "%u persisted subscription(s) awaiting resumption",
+                            static_cast<unsigned>(subscriptionCount));
+        }
+    }
+
 #if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
     // Initialize event logging subsystem
     {
@@ -251,6 +308,80 @@ void Server::Shutdown()
     chip::Platform::MemoryShutdown();
 }
 
+CHIP_ERROR Server::CaptureUpgradeSnapshot(MutableByteSpan & snapshot)
+{
+    TLV::TLVWriter writer;
+    TLV::TLVType outerType;
+    TLV::TLVType arrayType;
+
+    writer.Init(snapshot.data(), static_cast<uint32_t>(snapshot.size()));
+
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, outerType));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(kUpgradeSnapshotTag_Version), kUpgradeSnapshotVersion));
+    ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(kUpgradeSnapshotTag_Sessions), TLV::kTLVType_Array, arrayType));
+
+    {
+        SnapshotSessionCapture capture(writer);
+        SessionReplicationDelegate * appDelegate = mSessions.GetSessionReplicationDelegate();
+
+        mSessions.SetSessionReplicationDelegate(&capture);
+        CHIP_ERROR err = mSessions.ReplicateAllSessions();
+        mSessions.SetSessionReplicationDelegate(appDelegate);
+
+        ReturnErrorOnFailure(err);
+        ReturnErrorOnFailure(capture.GetError());
+    }
+
+    ReturnErrorOnFailure(writer.EndContainer(arrayType));
+    ReturnErrorOnFailure(writer.EndContainer(outerType));
+    ReturnErrorOnFailure(writer.Finalize());
+
+    snapshot.reduce_size(writer.GetLengthWritten());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Server::RestoreUpgradeSnapshot(const ByteSpan & snapshot)
+{
+    TLV::TLVReader reader;
+    TLV::TLVType outerType;
+    TLV::TLVType arrayType;
+    uint8_t version = 0;
+
+    reader.Init(snapshot.data(), static_cast<uint32_t>(snapshot.size()));
+
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag));
+    ReturnErrorOnFailure(reader.EnterContainer(outerType));
+
+    ReturnErrorOnFailure(reader.Next(TLV::ContextTag(kUpgradeSnapshotTag_Version)));
+    ReturnErrorOnFailure(reader.Get(version));
+    VerifyOrReturnError(version == kUpgradeSnapshotVersion, CHIP_ERROR_VERSION_MISMATCH);
+
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, TLV::ContextTag(kUpgradeSnapshotTag_Sessions)));
+    ReturnErrorOnFailure(reader.EnterContainer(arrayType));
+
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        ByteSpan record;
+        ReturnErrorOnFailure(reader.Get(record));
+
+        // A record that cannot be installed (e.g. the peer tore the session down
+        // during the handover window) costs that one peer a re-establishment; the
+        // rest of the snapshot still applies.
+        CHIP_ERROR injectErr = mSessions.InjectSessionRecord(record);
+        if (injectErr != CHIP_NO_ERROR)
+        {
+            ChipLogError(AppServer, "Skipping session record from upgrade snapshot: %s", ErrorStr(injectErr));
+        }
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    ReturnErrorOnFailure(reader.ExitContainer(arrayType));
+    ReturnErrorOnFailure(reader.ExitContainer(outerType));
+
+    return CHIP_NO_ERROR;
+}
+
 #if CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY_CLIENT
 // NOTE: UDC client is located in Server.cpp because it really only makes sense
 // to send UDC from a Matter device. The UDC message payload needs to include the device's
@@ -20,6 +20,7 @@
 #include <app/CASEClientPool.h>
 #include <app/CASESessionManager.h>
 #include <app/OperationalDeviceProxyPool.h>
+#include <app/SubscriptionResumptionStorage.h>
 #include <app/server/AppDelegate.h>
 #include <app/server/CommissioningWindowManager.h>
 #include <credentials/FabricTable.h>
@@ -31,6 +32,7 @@
 #include <platform/KeyValueStoreManager.h>
 #include <protocols/secure_channel/CASEServer.h>
 #include <protocols/secure_channel/MessageCounterManager.h>
+#include <protocols/secure_channel/SessionRekey.h>
 #include <protocols/secure_channel/PASESession.h>
 #include <protocols/secure_channel/RendezvousParameters.h>
 #include <protocols/user_directed_commissioning/UserDirectedCommissioning.h>
@@ -58,8 +60,21 @@ using ServerTransportMgr = chip::TransportMgr<chip::Transport::UDP
 class Server
 {
 public:
+    /**
+     * Controls when the generated cluster data model is initialized relative
+     * to the core transport and session path.
+     */
+    enum class DataModelInit : uint8_t
+    {
+        kImmediate, // Initialize all clusters inside Init() (default).
+        kDeferred,  // Bring up transports and sessions first; clusters
+                    // initialize from the event loop or on first cluster
+                    // access, whichever happens first. Cuts time-to-first-
+                    // response after reboot on devices with large data models.
+    };
+
     CHIP_ERROR Init(AppDelegate * delegate = nullptr, uint16_t secureServicePort = CHIP_PORT,
-                    uint16_t unsecureServicePort = CHIP_UDC_PORT);
+                    uint16_t unsecureServicePort = CHIP_UDC_PORT, DataModelInit dataModelInit = DataModelInit::kImmediate);
 
 #if CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY_CLIENT
     CHIP_ERROR SendUserDirectedCommissioningRequest(chip::Transport::PeerAddress commissioner);
@@ -77,6 +92,8 @@ public:
 
     SessionManager & GetSecureSessionManager() { return mSessions; }
 
+    secure_channel::SessionRekey & GetSessionRekey() { return mSessionRekey; }
+
     TransportMgrBase & GetTransportManager() { return mTransports; }
 
 #if CONFIG_NETWORK_LAYER_BLE
@@ -85,6 +102,40 @@ public:
 
     CommissioningWindowManager & GetCommissioningWindowManager() { return mCommissioningWindowManager; }
 
+    PersistentStorageDelegate & GetPersistentStorage() { return mServerStorage; }
+
+    /**
+     * @brief
+     *   Serialize the server's volatile session state into a versioned snapshot so a
+     *   replacement process (e.g. an upgraded gateway binary) can take over the
+     *   established sessions without renegotiating with the fabric.  Fabrics, group
+     *   state and subscriptions already live in persistent storage shared with the
+     *   replacement process; the snapshot carries only the secure session records
+     *   (see SessionManager::SerializeSessionRecord()).  Records contain raw session
+     *   keys — hand the blob to the new process over a private channel only.
+     *
+     *   Must be called on the Matter thread.  Exchanges still in flight when the
+     *   snapshot is taken are retried by their peers through MRP against the
+     *   restored sessions.
+     *
+     * @param[in,out] snapshot  Buffer of at least kMaxUpgradeSnapshotSize bytes;
+     *                          reduced to the bytes written.
+     */
+    CHIP_ERROR CaptureUpgradeSnapshot(MutableByteSpan & snapshot);
+
+    /**
+     * @brief
+     *   Install the sessions from a snapshot produced by CaptureUpgradeSnapshot() in
+     *   a previous process running the same build.  Call after Init().  Records that
+     *   can no longer be installed are logged and skipped; the affected peers
+     *   re-establish their sessions instead.
+     */
+    CHIP_ERROR RestoreUpgradeSnapshot(const ByteSpan & snapshot);
+
+    /** Upper bound on the size of a snapshot produced by CaptureUpgradeSnapshot(). */
+    static constexpr size_t kMaxUpgradeSnapshotSize =
+        16 + CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE * (SessionManager::kSessionRecordSize + 8);
+
     void Shutdown();
 
     static Server & GetInstance() { return sServer; }
@@ -94,6 +145,11 @@ private:
 
     static Server sServer;
 
+    // TLV layout of the upgrade snapshot (see CaptureUpgradeSnapshot()).
+    static constexpr uint8_t kUpgradeSnapshotVersion      = 1;
+    static constexpr uint8_t kUpgradeSnapshotTag_Version  = 0;
+    static constexpr uint8_t kUpgradeSnapshotTag_Sessions = 1;
+
     class ServerStorageDelegate : public PersistentStorageDelegate, public FabricStorage
     {
         CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override
@@ -146,6 +202,7 @@ private:
     FabricTable mFabrics;
     SessionIDAllocator mSessionIDAllocator;
     secure_channel::MessageCounterManager mMessageCounterManager;
+    secure_channel::SessionRekey mSessionRekey;
 #if CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY_CLIENT
     chip::Protocols::UserDirectedCommissioning::UserDirectedCommissioningClient gUDCClient;
 #endif // CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY_CLIENT
@@ -160,6 +217,8 @@ private:
     TestPersistentStorageDelegate mGroupsStorage;
     Credentials::GroupDataProviderImpl mGroupsProvider;
 
+    app::SubscriptionResumptionStorage mSubscriptionResumption;
+
     // TODO @ceille: Maybe use OperationalServicePort and CommissionableServicePort
     uint16_t mSecuredServicePort;
     uint16_t mUnsecuredServicePort;
@@ -529,10 +529,79 @@ void TestCache(nlTestSuite * apSuite, void * apContext)
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
 }
 
+class SnapshotCallback : public AttributeCache::Callback
+{
+    void OnDone(ReadClient * apReadClient) override {}
+};
+
+/*
+ * This validates the snapshot serialization path by priming a cache with a mix of
+ * data and status values, round-tripping it through SerializeState/DeserializeState
+ * and checking that all data values (and only data values) survive.
+ */
+void TestCacheSnapshot(nlTestSuite * apSuite, void * apContext)
+{
+    AttributeInstructionListType list = { AttributeInstruction(AttributeInstruction::kAttributeA, 0, AttributeInstruction::kData),
+                                          AttributeInstruction(AttributeInstruction::kAttributeB, 1, AttributeInstruction::kData),
+                                          AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData),
+                                          AttributeInstruction(AttributeInstruction::kAttributeC, 2,
+                                                               AttributeInstruction::kStatus) };
+
+    CacheValidator client(list);
+    AttributeCache cache(client);
+    DataSeriesGenerator generator(&cache.GetBufferedCallback(), list);
+    generator.Generate();
+
+    uint8_t buf[4096];
+    TLV::TLVWriter writer;
+    writer.Init(buf, sizeof(buf));
+    NL_TEST_ASSERT(apSuite, cache.SerializeState(writer) == CHIP_NO_ERROR);
+
+    SnapshotCallback restoredClient;
+    AttributeCache restoredCache(restoredClient);
+    TLV::TLVReader reader;
+    reader.Init(buf, writer.GetLengthWritten());
+    NL_TEST_ASSERT(apSuite, restoredCache.DeserializeState(reader) == CHIP_NO_ERROR);
+
+    //
+    // Every data value from the original cache must be retrievable from the restored
+    // cache; status entries are transient and must not have been persisted.
+    //
+    for (auto & instruction : list)
+    {
+        ConcreteAttributePath path(instruction.mEndpointId, Clusters::TestCluster::Id, instruction.GetAttributeId());
+        TLV::TLVReader dataReader;
+
+        if (instruction.mValueType == AttributeInstruction::kData)
+        {
+            NL_TEST_ASSERT(apSuite, restoredCache.Get(path, dataReader) == CHIP_NO_ERROR);
+        }
+        else
+        {
+            NL_TEST_ASSERT(apSuite, restoredCache.Get(path, dataReader) == CHIP_ERROR_KEY_NOT_FOUND);
+        }
+    }
+
+    //
+    // A snapshot with an unknown version must be rejected.
+    //
+    TLV::TLVWriter badWriter;
+    TLV::TLVType outerType;
+    badWriter.Init(buf, sizeof(buf));
+    NL_TEST_ASSERT(apSuite, badWriter.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, outerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, badWriter.Put(TLV::ContextTag(0), static_cast<uint8_t>(0xFF)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, badWriter.EndContainer(outerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, badWriter.Finalize() == CHIP_NO_ERROR);
+
+    reader.Init(buf, badWriter.GetLengthWritten());
+    NL_TEST_ASSERT(apSuite, restoredCache.DeserializeState(reader) == CHIP_ERROR_VERSION_MISMATCH);
+}
+
 // clang-format off
 const nlTest sTests[] =
 {
     NL_TEST_DEF("TestCache", TestCache),
+    NL_TEST_DEF("TestCacheSnapshot", TestCacheSnapshot),
     NL_TEST_SENTINEL()
 };
 
@@ -0,0 +1,198 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/AttributeCacheMirror.h>
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <protocols/interaction_model/Constants.h>
+
+#include <nlunit-test.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+constexpr uint16_t kSlotCount    = 4;
+constexpr uint16_t kSlotDataSize = 32;
+
+// Backing region shared between the writer and the reader; stands in for an mmap'ed
+// shared memory segment.
+uint8_t gRegion[1024];
+
+// Encodes value as an anonymous TLV element and leaves reader positioned on it.
+void EncodeValue(nlTestSuite * apSuite, uint32_t value, uint8_t * buf, size_t bufSize, TLV::TLVReader & reader)
+{
+    TLV::TLVWriter writer;
+    writer.Init(buf, static_cast<uint32_t>(bufSize));
+    NL_TEST_ASSERT(apSuite, writer.Put(TLV::AnonymousTag, value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    reader.Init(buf, writer.GetLengthWritten());
+    NL_TEST_ASSERT(apSuite, reader.Next() == CHIP_NO_ERROR);
+}
+
+void TestRoundTrip(nlTestSuite * apSuite, void * apContext)
+{
+    AttributeCacheMirror mirror;
+
+    size_t regionSize = AttributeCacheMirror::RequiredBufferSize(kSlotCount, kSlotDataSize);
+    NL_TEST_ASSERT(apSuite, regionSize <= sizeof(gRegion));
+    NL_TEST_ASSERT(apSuite, mirror.Init(gRegion, regionSize, kSlotCount, kSlotDataSize) == CHIP_NO_ERROR);
+
+    ConcreteAttributePath dataPath(1, 2, 3);
+    ConcreteAttributePath statusPath(1, 2, 4);
+
+    uint8_t scratch[kSlotDataSize];
+    TLV::TLVReader value;
+    EncodeValue(apSuite, 0xdeadbeef, scratch, sizeof(scratch), value);
+
+    StatusIB status;
+    status.mStatus = Protocols::InteractionModel::Status::UnsupportedRead;
+
+    mirror.BeginUpdate();
+    NL_TEST_ASSERT(apSuite, mirror.Publish(dataPath, value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, mirror.PublishStatus(statusPath, status) == CHIP_NO_ERROR);
+    mirror.EndUpdate();
+
+    AttributeCacheMirrorReader mirrorReader;
+    NL_TEST_ASSERT(apSuite, mirrorReader.Attach(gRegion, regionSize) == CHIP_NO_ERROR);
+
+    uint8_t copy[kSlotDataSize];
+    size_t copySize = 0;
+    NL_TEST_ASSERT(apSuite, mirrorReader.Get(dataPath, copy, sizeof(copy), copySize) == CHIP_NO_ERROR);
+
+    TLV::TLVReader copyReader;
+    copyReader.Init(copy, static_cast<uint32_t>(copySize));
+    NL_TEST_ASSERT(apSuite, copyReader.Next() == CHIP_NO_ERROR);
+
+    uint32_t decoded = 0;
+    NL_TEST_ASSERT(apSuite, copyReader.Get(decoded) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, decoded == 0xdeadbeef);
+
+    //
+    // A path mirrored with a status reports CHIP_ERROR_IM_STATUS_CODE_RECEIVED from Get()
+    // and surfaces the status through GetStatus().
+    //
+    NL_TEST_ASSERT(apSuite, mirrorReader.Get(statusPath, copy, sizeof(copy), copySize) == CHIP_ERROR_IM_STATUS_CODE_RECEIVED);
+
+    StatusIB readStatus;
+    NL_TEST_ASSERT(apSuite, mirrorReader.GetStatus(statusPath, readStatus) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, readStatus.mStatus == Protocols::InteractionModel::Status::UnsupportedRead);
+    NL_TEST_ASSERT(apSuite, mirrorReader.GetStatus(dataPath, readStatus) == CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+void TestNotFoundAndOverflow(nlTestSuite * apSuite, void * apContext)
+{
+    AttributeCacheMirror mirror;
+
+    size_t regionSize = AttributeCacheMirror::RequiredBufferSize(kSlotCount, kSlotDataSize);
+    NL_TEST_ASSERT(apSuite, mirror.Init(gRegion, regionSize, kSlotCount, kSlotDataSize) == CHIP_NO_ERROR);
+
+    AttributeCacheMirrorReader mirrorReader;
+    NL_TEST_ASSERT(apSuite, mirrorReader.Attach(gRegion, regionSize) == CHIP_NO_ERROR);
+
+    uint8_t copy[kSlotDataSize];
+    size_t copySize = 0;
+    NL_TEST_ASSERT(apSuite, mirrorReader.Get(ConcreteAttributePath(9, 9, 9), copy, sizeof(copy), copySize) ==
+                       CHIP_ERROR_KEY_NOT_FOUND);
+
+    //
+    // A value is mirrored, but the caller's buffer cannot hold it.
+    //
+    uint8_t scratch[kSlotDataSize];
+    TLV::TLVReader value;
+    EncodeValue(apSuite, 0x12345678, scratch, sizeof(scratch), value);
+
+    ConcreteAttributePath dataPath(1, 2, 3);
+    NL_TEST_ASSERT(apSuite, mirror.Publish(dataPath, value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, mirrorReader.Get(dataPath, copy, 1, copySize) == CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    //
+    // Once every slot is assigned to a distinct path, further paths are rejected.
+    //
+    for (AttributeId attr = 10; attr < 10 + kSlotCount - 1; attr++)
+    {
+        EncodeValue(apSuite, attr, scratch, sizeof(scratch), value);
+        NL_TEST_ASSERT(apSuite, mirror.Publish(ConcreteAttributePath(1, 2, attr), value) == CHIP_NO_ERROR);
+    }
+
+    EncodeValue(apSuite, 0, scratch, sizeof(scratch), value);
+    NL_TEST_ASSERT(apSuite, mirror.Publish(ConcreteAttributePath(1, 2, 100), value) == CHIP_ERROR_NO_MEMORY);
+
+    //
+    // Re-publishing an already mirrored path reuses its slot.
+    //
+    EncodeValue(apSuite, 42, scratch, sizeof(scratch), value);
+    NL_TEST_ASSERT(apSuite, mirror.Publish(dataPath, value) == CHIP_NO_ERROR);
+}
+
+void TestAttachValidation(nlTestSuite * apSuite, void * apContext)
+{
+    AttributeCacheMirror mirror;
+
+    size_t regionSize = AttributeCacheMirror::RequiredBufferSize(kSlotCount, kSlotDataSize);
+    NL_TEST_ASSERT(apSuite, mirror.Init(gRegion, regionSize, kSlotCount, kSlotDataSize) == CHIP_NO_ERROR);
+
+    AttributeCacheMirrorReader mirrorReader;
+
+    // Truncated region.
+    NL_TEST_ASSERT(apSuite, mirrorReader.Attach(gRegion, regionSize - 1) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Corrupted magic value.
+    gRegion[0] ^= 0xff;
+    NL_TEST_ASSERT(apSuite, mirrorReader.Attach(gRegion, regionSize) == CHIP_ERROR_INVALID_ARGUMENT);
+    gRegion[0] ^= 0xff;
+
+    NL_TEST_ASSERT(apSuite, mirrorReader.Attach(gRegion, regionSize) == CHIP_NO_ERROR);
+
+    // A region smaller than the slot configuration requires cannot be formatted either.
+    NL_TEST_ASSERT(apSuite,
+                   mirror.Init(gRegion, regionSize - 1, kSlotCount, kSlotDataSize) == CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestRoundTrip", TestRoundTrip),
+    NL_TEST_DEF("TestNotFoundAndOverflow", TestNotFoundAndOverflow),
+    NL_TEST_DEF("TestAttachValidation", TestAttachValidation),
+    NL_TEST_SENTINEL()
+};
+
+nlTestSuite sSuite =
+{
+    "TestAttributeCacheMirror",
+    &sTests[0],
+    nullptr,
+    nullptr,
+};
+// clang-format on
+
+} // namespace
+
+int TestAttributeCacheMirror()
+{
+    nlTestRunner(&sSuite, nullptr);
+    return (nlTestRunnerStats(&sSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestAttributeCacheMirror)
@@ -375,6 +375,95 @@ void TestEncodeListChunking(nlTestSuite * aSuite, void * aContext)
     }
 }
 
+void TestEncodeListChunkingResume(nlTestSuite * aSuite, void * aContext)
+{
+    AttributeValueEncoder::AttributeEncodeState state;
+
+    bool list[]          = { true, false };
+    size_t itemsProduced = 0;
+    // A generator with random access to its backing store can resume production at the index
+    // reported by the encoder instead of regenerating the items previous chunks already sent.
+    auto listEncoder = [&list, &itemsProduced](const auto & encoder) -> CHIP_ERROR {
+        for (ListIndex i = encoder.ResumeIndex(); i < ArraySize(list); i++)
+        {
+            ReturnErrorOnFailure(encoder.Encode(list[i]));
+            itemsProduced++;
+        }
+        return CHIP_NO_ERROR;
+    };
+
+    {
+        // Use 60 bytes buffer to force chunking. The kTestFabricIndex is not effective in this test.
+        LimitedTestSetup<60> test1(aSuite, kTestFabricIndex);
+        CHIP_ERROR err = test1.encoder.EncodeList(listEncoder);
+        NL_TEST_ASSERT(aSuite, err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+        // Only the first item fit; the second was produced but failed to encode.
+        NL_TEST_ASSERT(aSuite, itemsProduced == 1);
+        state = test1.encoder.GetState();
+
+        const uint8_t expected[] = {
+            // clang-format off
+            0x15, 0x36, 0x01, // Test overhead, Start Anonymous struct + Start 1 byte Tag Array + Tag (01)
+            0x15, // Start anonymous struct
+              0x35, 0x01, // Start 1 byte tag struct + Tag (01)
+                0x24, 0x00, 0x99, // Tag (00) Value (1 byte uint) 0x99 (Attribute Version)
+                0x37, 0x01, // Start 1 byte tag list + Tag (01) (Attribute Path)
+                  0x24, 0x02, 0x55, // Tag (02) Value (1 byte uint) 0x55
+                  0x24, 0x03, 0xaa, // Tag (03) Value (1 byte uint) 0xaa
+                  0x24, 0x04, 0xcc, // Tag (04) Value (1 byte uint) 0xcc
+                0x18, // End of container
+                // Intended empty array
+                0x36, 0x02, // Start 1 byte tag array + Tag (02) (Attribute Value)
+                0x18, // End of container
+              0x18, // End of container
+            0x18, // End of container
+
+            0x15, // Start anonymous struct
+              0x35, 0x01, // Start 1 byte tag struct + Tag (01)
+                0x24, 0x00, 0x99, // Tag (00) Value (1 byte uint) 0x99 (Attribute Version)
+                0x37, 0x01, // Start 1 byte tag list + Tag (01) (Attribute Path)
+                  0x24, 0x02, 0x55, // Tag (02) Value (1 byte uint) 0x55
+                  0x24, 0x03, 0xaa, // Tag (03) Value (1 byte uint) 0xaa
+                  0x24, 0x04, 0xcc, // Tag (04) Value (1 byte uint) 0xcc
+                  0x34, 0x05, // Tag (05) Null
+                0x18, // End of container
+                0x29, 0x02, // Tag (02) Value True (Attribute Value)
+              0x18, // End of container
+            0x18, // End of container
+            // clang-format on
+        };
+        VERIFY_BUFFER_STATE(aSuite, test1, expected);
+    }
+    {
+        // Use 60 bytes buffer to force chunking. The kTestFabricIndex is not effective in this test.
+        LimitedTestSetup<60> test2(aSuite, 0, state);
+        itemsProduced = 0;
+        CHIP_ERROR err = test2.encoder.EncodeList(listEncoder);
+        NL_TEST_ASSERT(aSuite, err == CHIP_NO_ERROR);
+        // The resumed chunk only produced the one remaining item instead of replaying the list.
+        NL_TEST_ASSERT(aSuite, itemsProduced == 1);
+
+        const uint8_t expected[] = {
+            // clang-format off
+            0x15, 0x36, 0x01, // Test overhead, Start Anonymous struct + Start 1 byte Tag Array + Tag (01)
+            0x15, // Start anonymous struct
+              0x35, 0x01, // Start 1 byte tag struct + Tag (01)
+                0x24, 0x00, 0x99, // Tag (00) Value (1 byte uint) 0x99 (Attribute Version)
+                0x37, 0x01, // Start 1 byte tag list + Tag (01) (Attribute Path)
+                  0x24, 0x02, 0x55, // Tag (02) Value (1 byte uint) 0x55
+                  0x24, 0x03, 0xaa, // Tag (03) Value (1 byte uint) 0xaa
+                  0x24, 0x04, 0xcc, // Tag (04) Value (1 byte uint) 0xcc
+                  0x34, 0x05, // Tag (05) Null
+                0x18, // End of container
+                0x28, 0x02, // Tag (02) Value False (Attribute Value)
+              0x18, // End of container
+            0x18, // End of container
+            // clang-format on
+        };
+        VERIFY_BUFFER_STATE(aSuite, test2, expected);
+    }
+}
+
 #undef VERIFY_STATE
 
 } // anonymous namespace
@@ -384,6 +473,7 @@ const nlTest sTests[] = {
     NL_TEST_DEF("TestEncodeNothing", TestEncodeNothing),           NL_TEST_DEF("TestEncodeBool", TestEncodeBool),
     NL_TEST_DEF("TestEncodeEmptyList", TestEncodeEmptyList),       NL_TEST_DEF("TestEncodeListOfBools1", TestEncodeListOfBools1),
     NL_TEST_DEF("TestEncodeListOfBools2", TestEncodeListOfBools2), NL_TEST_DEF("TestEncodeListChunking", TestEncodeListChunking),
+    NL_TEST_DEF("TestEncodeListChunkingResume", TestEncodeListChunkingResume),
     NL_TEST_DEF("TestEncodeFabricScoped", TestEncodeFabricScoped), NL_TEST_SENTINEL()
 };
 }
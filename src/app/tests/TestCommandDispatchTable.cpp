@@ -0,0 +1,113 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the generated-command dispatch table.
+ *
+ */
+
+#include <app/CommandDispatchTable.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+int gLastDispatched = 0;
+
+void Handler1(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+{
+    gLastDispatched = 1;
+}
+
+void Handler2(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+{
+    gLastDispatched = 2;
+}
+
+void Handler3(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+{
+    gLastDispatched = 3;
+}
+
+void TestLookup(nlTestSuite * apSuite, void * apContext)
+{
+    // Deliberately not sorted by key: generated tables are emitted in template order and
+    // the table is expected to sort itself on first use.
+    CommandDispatchTable::Entry entries[] = {
+        { CommandDispatchTable::MakeKey(0x003C, 0x02), Handler3 },
+        { CommandDispatchTable::MakeKey(0x0006, 0x01), Handler2 },
+        { CommandDispatchTable::MakeKey(0x0006, 0x00), Handler1 },
+    };
+    CommandDispatchTable table(entries, ArraySize(entries));
+
+    NL_TEST_ASSERT(apSuite, table.FindHandler(0x0006, 0x00) == Handler1);
+    NL_TEST_ASSERT(apSuite, table.FindHandler(0x0006, 0x01) == Handler2);
+    NL_TEST_ASSERT(apSuite, table.FindHandler(0x003C, 0x02) == Handler3);
+
+    // Known cluster, unknown command.
+    NL_TEST_ASSERT(apSuite, table.FindHandler(0x0006, 0x02) == nullptr);
+    // Unknown cluster.
+    NL_TEST_ASSERT(apSuite, table.FindHandler(0x0008, 0x00) == nullptr);
+    // A command id that exists on another cluster must not match.
+    NL_TEST_ASSERT(apSuite, table.FindHandler(0x003C, 0x00) == nullptr);
+}
+
+void TestHasCluster(nlTestSuite * apSuite, void * apContext)
+{
+    CommandDispatchTable::Entry entries[] = {
+        { CommandDispatchTable::MakeKey(0x003C, 0x02), Handler3 },
+        { CommandDispatchTable::MakeKey(0x0006, 0x01), Handler2 },
+    };
+    CommandDispatchTable table(entries, ArraySize(entries));
+
+    NL_TEST_ASSERT(apSuite, table.HasCluster(0x0006));
+    NL_TEST_ASSERT(apSuite, table.HasCluster(0x003C));
+    NL_TEST_ASSERT(apSuite, !table.HasCluster(0x0008));
+    // Larger than every key in the table.
+    NL_TEST_ASSERT(apSuite, !table.HasCluster(0xFFFFFFFF));
+}
+
+void TestEmptyTable(nlTestSuite * apSuite, void * apContext)
+{
+    CommandDispatchTable table(nullptr, 0);
+
+    NL_TEST_ASSERT(apSuite, table.FindHandler(0x0006, 0x00) == nullptr);
+    NL_TEST_ASSERT(apSuite, !table.HasCluster(0x0006));
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("TestLookup", TestLookup), NL_TEST_DEF("TestHasCluster", TestHasCluster),
+                          NL_TEST_DEF("TestEmptyTable", TestEmptyTable), NL_TEST_SENTINEL() };
+
+} // namespace
+
+int TestCommandDispatchTable(void)
+{
+    nlTestSuite theSuite = { "CommandDispatchTable", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestCommandDispatchTable)
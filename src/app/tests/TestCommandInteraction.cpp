@@ -26,6 +26,7 @@
 
 #include <app/AppBuildConfig.h>
 #include <app/InteractionModelEngine.h>
+#include <app/PreparedInvokeTemplate.h>
 #include <app/tests/AppTestContext.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/CHIPTLV.h>
@@ -180,6 +181,8 @@ public:
 
     static void TestCommandSenderAbruptDestruction(nlTestSuite * apSuite, void * apContext);
 
+    static void TestPreparedInvokeTemplate(nlTestSuite * apSuite, void * apContext);
+
     static size_t GetNumActiveHandlerObjects()
     {
         return chip::app::InteractionModelEngine::GetInstance()->mCommandHandlerObjs.Allocated();
@@ -725,6 +728,104 @@ void TestCommandInteraction::TestCommandSenderAbruptDestruction(nlTestSuite * ap
     NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
 }
 
+namespace {
+
+// Parse a prepared invoke payload and verify the two patchable fields carry
+// the expected values.
+void ValidatePreparedInvokePayload(nlTestSuite * apSuite, System::PacketBufferHandle && aPayload, uint8_t aExpectedLevel,
+                                   uint16_t aExpectedTime)
+{
+    System::PacketBufferTLVReader reader;
+    reader.Init(std::move(aPayload));
+    NL_TEST_ASSERT(apSuite, reader.Next() == CHIP_NO_ERROR);
+
+    InvokeRequestMessage::Parser invokeRequestMessage;
+    NL_TEST_ASSERT(apSuite, invokeRequestMessage.Init(reader) == CHIP_NO_ERROR);
+
+    InvokeRequests::Parser invokeRequests;
+    NL_TEST_ASSERT(apSuite, invokeRequestMessage.GetInvokeRequests(&invokeRequests) == CHIP_NO_ERROR);
+
+    TLV::TLVReader invokeRequestsReader;
+    invokeRequests.GetReader(&invokeRequestsReader);
+    NL_TEST_ASSERT(apSuite, invokeRequestsReader.Next() == CHIP_NO_ERROR);
+
+    CommandDataIB::Parser commandData;
+    NL_TEST_ASSERT(apSuite, commandData.Init(invokeRequestsReader) == CHIP_NO_ERROR);
+
+    TLV::TLVReader dataReader;
+    NL_TEST_ASSERT(apSuite, commandData.GetData(&dataReader) == CHIP_NO_ERROR);
+
+    TLV::TLVType containerType;
+    NL_TEST_ASSERT(apSuite, dataReader.EnterContainer(containerType) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, dataReader.Next(TLV::ContextTag(2)) == CHIP_NO_ERROR);
+    uint8_t level = 0;
+    NL_TEST_ASSERT(apSuite, dataReader.Get(level) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, level == aExpectedLevel);
+
+    NL_TEST_ASSERT(apSuite, dataReader.Next(TLV::ContextTag(3)) == CHIP_NO_ERROR);
+    uint16_t time = 0;
+    NL_TEST_ASSERT(apSuite, dataReader.Get(time) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, time == aExpectedTime);
+}
+
+} // namespace
+
+void TestCommandInteraction::TestPreparedInvokeTemplate(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    sendResponse = true;
+
+    PreparedInvokeTemplate invokeTemplate;
+    uint8_t levelField = 0;
+    uint8_t timeField  = 0;
+
+    err = invokeTemplate.Begin(MakeTestCommandPath());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // Invariant field.
+    err = invokeTemplate.GetCommandDataIBTLVWriter()->PutBoolean(TLV::ContextTag(1), true);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    err = invokeTemplate.AddPatchableUInt8(TLV::ContextTag(2), 10, levelField);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    err = invokeTemplate.AddPatchableUInt16(TLV::ContextTag(3), 100, timeField);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    err = invokeTemplate.Finish();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // The initial values survive sealing.
+    ValidatePreparedInvokePayload(apSuite, invokeTemplate.GetTemplateData().CloneData(), 10, 100);
+
+    err = invokeTemplate.PatchUInt8(levelField, 42);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    err = invokeTemplate.PatchUInt16(timeField, 1234);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // Width mismatches are rejected.
+    NL_TEST_ASSERT(apSuite, invokeTemplate.PatchUInt16(levelField, 1) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    ValidatePreparedInvokePayload(apSuite, invokeTemplate.GetTemplateData().CloneData(), 42, 1234);
+
+    // Sending from the template goes through the normal CommandSender flow,
+    // and the template stays reusable for further patched sends.
+    mockCommandSenderDelegate.ResetCounter();
+    app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
+
+    err = invokeTemplate.PrepareInvoke(commandSender);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    err = commandSender.SendCommandRequest(ctx.GetSessionBobToAlice());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, mockCommandSenderDelegate.onErrorCalledTimes == 0);
+
+    err = invokeTemplate.PatchUInt8(levelField, 43);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    ValidatePreparedInvokePayload(apSuite, invokeTemplate.GetTemplateData().CloneData(), 43, 1234);
+}
+
 } // namespace app
 } // namespace chip
 
@@ -749,6 +850,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestCommandSenderCommandSpecificResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderCommandSpecificResponseFlow),
     NL_TEST_DEF("TestCommandSenderCommandFailureResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderCommandFailureResponseFlow),
     NL_TEST_DEF("TestCommandSenderAbruptDestruction", chip::app::TestCommandInteraction::TestCommandSenderAbruptDestruction),
+    NL_TEST_DEF("TestPreparedInvokeTemplate", chip::app::TestCommandInteraction::TestPreparedInvokeTemplate),
     NL_TEST_SENTINEL()
 };
 // clang-format on
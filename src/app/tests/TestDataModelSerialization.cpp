@@ -51,6 +51,7 @@ public:
     static void TestDataModelSerialization_ExtraField(nlTestSuite * apSuite, void * apContext);
     static void TestDataModelSerialization_InvalidSimpleFieldTypes(nlTestSuite * apSuite, void * apContext);
     static void TestDataModelSerialization_InvalidListType(nlTestSuite * apSuite, void * apContext);
+    static void TestDataModelSerialization_PackedNumericList(nlTestSuite * apSuite, void * apContext);
 
     static void NullablesOptionalsStruct(nlTestSuite * apSuite, void * apContext);
     static void NullablesOptionalsCommand(nlTestSuite * apSuite, void * apContext);
@@ -812,6 +813,106 @@ void TestDataModelSerialization::TestDataModelSerialization_InvalidListType(nlTe
     }
 }
 
+void TestDataModelSerialization::TestDataModelSerialization_PackedNumericList(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err;
+    auto * _this = static_cast<TestDataModelSerialization *>(apContext);
+
+    _this->mpSuite = apSuite;
+
+    uint32_t unsignedValues[5] = { 0, 255, 256, 65536, 0x01000000 };
+    int32_t signedValues[5]    = { -1, 127, -129, -40000, -70000 };
+
+    //
+    // The packed list fast path must produce bytes identical to encoding each
+    // element individually through the writer.
+    //
+    {
+        uint8_t packedBuf[128];
+        uint8_t referenceBuf[128];
+        TLV::TLVType outer;
+
+        TLV::TLVWriter writer;
+        writer.Init(packedBuf);
+
+        err = DataModel::Encode(writer, TLV::AnonymousTag, DataModel::List<uint32_t>(unsignedValues));
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        err = DataModel::Encode(writer, TLV::AnonymousTag, DataModel::List<int32_t>(signedValues));
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        err = writer.Finalize();
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        TLV::TLVWriter referenceWriter;
+        referenceWriter.Init(referenceBuf);
+
+        err = referenceWriter.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Array, outer);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        for (auto v : unsignedValues)
+        {
+            err = referenceWriter.Put(TLV::AnonymousTag, v);
+            NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        }
+
+        err = referenceWriter.EndContainer(outer);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        err = referenceWriter.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Array, outer);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        for (auto v : signedValues)
+        {
+            err = referenceWriter.Put(TLV::AnonymousTag, v);
+            NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        }
+
+        err = referenceWriter.EndContainer(outer);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        err = referenceWriter.Finalize();
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        NL_TEST_ASSERT(apSuite, writer.GetLengthWritten() == referenceWriter.GetLengthWritten());
+        NL_TEST_ASSERT(apSuite, memcmp(packedBuf, referenceBuf, writer.GetLengthWritten()) == 0);
+    }
+
+    //
+    // Round-trip a packed list through DecodableList.
+    //
+    {
+        _this->SetupBuf();
+
+        err = DataModel::Encode(_this->mWriter, TLV::AnonymousTag, DataModel::List<uint32_t>(unsignedValues));
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        err = _this->mWriter.Finalize();
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        _this->DumpBuf();
+        _this->SetupReader();
+
+        DataModel::DecodableList<uint32_t> list;
+
+        err = DataModel::Decode(_this->mReader, list);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        auto iter = list.begin();
+        size_t i  = 0;
+
+        while (iter.Next())
+        {
+            NL_TEST_ASSERT(apSuite, i < ArraySize(unsignedValues));
+            NL_TEST_ASSERT(apSuite, iter.GetValue() == unsignedValues[i]);
+            i++;
+        }
+
+        NL_TEST_ASSERT(apSuite, iter.GetStatus() == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, i == ArraySize(unsignedValues));
+    }
+}
+
 namespace {
 bool SimpleStructsEqual(const TestCluster::Structs::SimpleStruct::Type & s1, const TestCluster::Structs::SimpleStruct::Type & s2)
 {
@@ -1064,6 +1165,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestDataModelSerialization_ExtraField",  TestDataModelSerialization::TestDataModelSerialization_ExtraField),
     NL_TEST_DEF("TestDataModelSerialization_InvalidSimpleFieldTypes", TestDataModelSerialization::TestDataModelSerialization_InvalidSimpleFieldTypes),
     NL_TEST_DEF("TestDataModelSerialization_InvalidListType", TestDataModelSerialization::TestDataModelSerialization_InvalidListType),
+    NL_TEST_DEF("TestDataModelSerialization_PackedNumericList", TestDataModelSerialization::TestDataModelSerialization_PackedNumericList),
     NL_TEST_DEF("TestDataModelSerialization_NullablesOptionalsStruct", TestDataModelSerialization::NullablesOptionalsStruct),
     NL_TEST_DEF("TestDataModelSerialization_NullablesOptionalsCommand", TestDataModelSerialization::NullablesOptionalsCommand),
     NL_TEST_SENTINEL()
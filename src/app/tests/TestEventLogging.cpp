@@ -53,7 +53,9 @@ static const chip::TLV::Tag kLivenessDeviceStatus = chip::TLV::ContextTag(1);
 static uint8_t gDebugEventBuffer[128];
 static uint8_t gInfoEventBuffer[128];
 static uint8_t gCritEventBuffer[128];
+static uint8_t gColdEventBuffer[256];
 static chip::app::CircularEventBuffer gCircularEventBuffer[3];
+static chip::app::CircularEventBuffer gColdCircularEventBuffer;
 
 class TestContext : public chip::Test::AppContext
 {
@@ -280,12 +282,92 @@ static void CheckLogEventWithDiscardLowEvent(nlTestSuite * apSuite, void * apCon
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
     CheckLogState(apSuite, logMgmt, 3, chip::app::PriorityLevel::Debug);
 }
+static void CheckLogEventWithColdStorage(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::EventNumber eid1, eid2, eid3, eid4;
+    chip::app::EventOptions options;
+    options.mPath     = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    options.mPriority = chip::app::PriorityLevel::Debug;
+    TestEventGenerator testEventGenerator;
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    logMgmt.EnableColdStorage(&gColdCircularEventBuffer, &gColdEventBuffer[0], sizeof(gColdEventBuffer));
+
+    // The debug buffer is already full, so each new debug event now moves an older one into
+    // the cold tier instead of dropping it.
+    testEventGenerator.SetStatus(0);
+    err = logMgmt.LogEvent(&testEventGenerator, options, eid1);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    testEventGenerator.SetStatus(1);
+    err = logMgmt.LogEvent(&testEventGenerator, options, eid2);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    testEventGenerator.SetStatus(0);
+    err = logMgmt.LogEvent(&testEventGenerator, options, eid3);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    testEventGenerator.SetStatus(1);
+    err = logMgmt.LogEvent(&testEventGenerator, options, eid4);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    CheckLogState(apSuite, logMgmt, 3, chip::app::PriorityLevel::Debug);
+
+    chip::app::ClusterInfo testClusterInfo;
+    testClusterInfo.mNodeId     = kTestDeviceNodeId1;
+    testClusterInfo.mEndpointId = kTestEndpointId1;
+    testClusterInfo.mClusterId  = kLivenessClusterId;
+
+    // All four events are still fetchable: eid1 was evicted from the debug buffer but is
+    // retained in the cold tier, eid2 through eid4 come from the debug buffer.
+    CheckLogReadOut(apSuite, logMgmt, eid1, 4, &testClusterInfo);
+}
+
+static void CheckFetchSkipsUninterestedClusters(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err;
+    chip::TLV::TLVWriter writer;
+    uint8_t backingStore[1024];
+    size_t eventCount = 0;
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+    // No event has ever been logged for this cluster, so the cluster index lets the
+    // fetch return without walking the log: no events, and the starting event number
+    // is left where it was.
+    chip::app::ClusterInfo uninterestedClusterInfo;
+    uninterestedClusterInfo.mNodeId     = kTestDeviceNodeId1;
+    uninterestedClusterInfo.mEndpointId = kTestEndpointId1;
+    uninterestedClusterInfo.mClusterId  = kLivenessClusterId + 1;
+
+    chip::EventNumber startingEventNumber = 0;
+    writer.Init(backingStore, sizeof(backingStore));
+    err = logMgmt.FetchEventsSince(writer, &uninterestedClusterInfo, startingEventNumber, eventCount);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, eventCount == 0);
+    NL_TEST_ASSERT(apSuite, startingEventNumber == 0);
+
+    // A fetch starting past the newest logged event is also provably empty.
+    chip::app::ClusterInfo interestedClusterInfo;
+    interestedClusterInfo.mNodeId     = kTestDeviceNodeId1;
+    interestedClusterInfo.mEndpointId = kTestEndpointId1;
+    interestedClusterInfo.mClusterId  = kLivenessClusterId;
+
+    startingEventNumber = 1000;
+    eventCount          = 0;
+    writer.Init(backingStore, sizeof(backingStore));
+    err = logMgmt.FetchEventsSince(writer, &interestedClusterInfo, startingEventNumber, eventCount);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, eventCount == 0);
+    NL_TEST_ASSERT(apSuite, startingEventNumber == 1000);
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
 
 const nlTest sTests[] = { NL_TEST_DEF("CheckLogEventWithEvictToNextBuffer", CheckLogEventWithEvictToNextBuffer),
-                          NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent), NL_TEST_SENTINEL() };
+                          NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent),
+                          NL_TEST_DEF("CheckLogEventWithColdStorage", CheckLogEventWithColdStorage),
+                          NL_TEST_DEF("CheckFetchSkipsUninterestedClusters", CheckFetchSkipsUninterestedClusters),
+                          NL_TEST_SENTINEL() };
 
 // clang-format off
 nlTestSuite sSuite =
@@ -0,0 +1,126 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the interaction latency histograms.
+ *
+ */
+
+#include <app/InteractionLatencyStats.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+namespace chip {
+namespace app {
+namespace TestInteractionLatencyStats {
+
+void TestEmptyHistogram(nlTestSuite * apSuite, void * apContext)
+{
+    LatencyHistogram histogram;
+    NL_TEST_ASSERT(apSuite, histogram.mCount == 0);
+    NL_TEST_ASSERT(apSuite, histogram.GetPercentileMillis(50) == 0);
+    NL_TEST_ASSERT(apSuite, histogram.GetPercentileMillis(100) == 0);
+}
+
+void TestHistogramPercentiles(nlTestSuite * apSuite, void * apContext)
+{
+    LatencyHistogram histogram;
+
+    // 90 fast samples and 10 slow ones: the p50 estimate must stay in the
+    // fast bucket and the p99 estimate in the slow one.
+    for (int i = 0; i < 90; i++)
+    {
+        histogram.Record(10);
+    }
+    for (int i = 0; i < 10; i++)
+    {
+        histogram.Record(1000);
+    }
+
+    NL_TEST_ASSERT(apSuite, histogram.mCount == 100);
+    NL_TEST_ASSERT(apSuite, histogram.mMaxMillis == 1000);
+    NL_TEST_ASSERT(apSuite, histogram.mTotalMillis == 90 * 10 + 10 * 1000);
+
+    // Bucketed estimates are upper bounds within a factor of two.
+    uint32_t p50 = histogram.GetPercentileMillis(50);
+    uint32_t p99 = histogram.GetPercentileMillis(99);
+    NL_TEST_ASSERT(apSuite, p50 >= 10 && p50 < 20);
+    NL_TEST_ASSERT(apSuite, p99 >= 1000 && p99 < 2000);
+    NL_TEST_ASSERT(apSuite, histogram.GetPercentileMillis(100) >= p99);
+
+    histogram.Reset();
+    NL_TEST_ASSERT(apSuite, histogram.mCount == 0);
+    NL_TEST_ASSERT(apSuite, histogram.GetPercentileMillis(99) == 0);
+}
+
+void TestPerPeerTracking(nlTestSuite * apSuite, void * apContext)
+{
+    InteractionLatencyStats stats;
+
+    // Fill every per-peer slot, then record against one more peer: the
+    // overflow peer must still land in the global histogram.
+    for (size_t i = 0; i < InteractionLatencyStats::kMaxPeers; i++)
+    {
+        stats.Record(static_cast<NodeId>(i + 1), 10);
+    }
+    stats.Record(static_cast<NodeId>(InteractionLatencyStats::kMaxPeers + 1), 1000);
+
+    NL_TEST_ASSERT(apSuite, stats.GetGlobalHistogram().mCount == InteractionLatencyStats::kMaxPeers + 1);
+    NL_TEST_ASSERT(apSuite, stats.GetGlobalHistogram().mMaxMillis == 1000);
+
+    for (size_t i = 0; i < InteractionLatencyStats::kMaxPeers; i++)
+    {
+        const PeerLatencyStats * peer = stats.GetPeerStats(i);
+        NL_TEST_ASSERT(apSuite, peer != nullptr);
+        NL_TEST_ASSERT(apSuite, peer->mPeerNodeId == static_cast<NodeId>(i + 1));
+        NL_TEST_ASSERT(apSuite, peer->mHistogram.mCount == 1);
+    }
+    NL_TEST_ASSERT(apSuite, stats.GetPeerStats(InteractionLatencyStats::kMaxPeers) == nullptr);
+
+    // A repeat sample for a known peer reuses its slot.
+    stats.Record(static_cast<NodeId>(1), 20);
+    NL_TEST_ASSERT(apSuite, stats.GetPeerStats(0)->mHistogram.mCount == 2);
+
+    stats.Reset();
+    NL_TEST_ASSERT(apSuite, stats.GetGlobalHistogram().mCount == 0);
+    NL_TEST_ASSERT(apSuite, stats.GetPeerStats(0) == nullptr);
+}
+
+} // namespace TestInteractionLatencyStats
+} // namespace app
+} // namespace chip
+
+namespace {
+const nlTest sTests[] = { NL_TEST_DEF("TestEmptyHistogram", chip::app::TestInteractionLatencyStats::TestEmptyHistogram),
+                          NL_TEST_DEF("TestHistogramPercentiles",
+                                      chip::app::TestInteractionLatencyStats::TestHistogramPercentiles),
+                          NL_TEST_DEF("TestPerPeerTracking", chip::app::TestInteractionLatencyStats::TestPerPeerTracking),
+                          NL_TEST_SENTINEL() };
+}
+
+int TestInteractionLatencyStats()
+{
+    nlTestSuite theSuite = { "InteractionLatencyStats", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestInteractionLatencyStats)
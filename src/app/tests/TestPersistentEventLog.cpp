@@ -0,0 +1,212 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the append-only persistent event log.
+ *
+ */
+
+#include <app/PersistentEventLog.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+constexpr uint32_t kStagingSize = 96;
+constexpr uint16_t kMaxSegments = 3;
+
+uint8_t gStagingBuffer[kStagingSize];
+
+struct ReplayedEvents
+{
+    static constexpr size_t kMaxEvents = 16;
+    EventNumber mNumbers[kMaxEvents];
+    uint64_t mValues[kMaxEvents];
+    size_t mCount = 0;
+};
+
+CHIP_ERROR CollectEvent(EventNumber aEventNumber, TLV::TLVReader & aReader, void * apContext)
+{
+    ReplayedEvents * replayed = static_cast<ReplayedEvents *>(apContext);
+    VerifyOrReturnError(replayed->mCount < ReplayedEvents::kMaxEvents, CHIP_ERROR_NO_MEMORY);
+
+    ReturnErrorOnFailure(aReader.Next());
+    uint64_t value = 0;
+    ReturnErrorOnFailure(aReader.Get(value));
+
+    replayed->mNumbers[replayed->mCount] = aEventNumber;
+    replayed->mValues[replayed->mCount]  = value;
+    replayed->mCount++;
+    return CHIP_NO_ERROR;
+}
+
+uint32_t MakeEvent(uint8_t * apBuffer, uint32_t aBufferSize, uint64_t aValue)
+{
+    TLV::TLVWriter writer;
+    writer.Init(apBuffer, aBufferSize);
+    VerifyOrReturnError(writer.Put(TLV::AnonymousTag, aValue) == CHIP_NO_ERROR, 0);
+    VerifyOrReturnError(writer.Finalize() == CHIP_NO_ERROR, 0);
+    return writer.GetLengthWritten();
+}
+
+void TestAppendFlushReplay(nlTestSuite * apSuite, void * apContext)
+{
+    TestPersistentStorageDelegate storage;
+    PersistentEventLog log;
+    uint8_t event[32];
+
+    NL_TEST_ASSERT(apSuite, log.Init(&storage, gStagingBuffer, kStagingSize, kMaxSegments) == CHIP_NO_ERROR);
+
+    for (uint64_t i = 0; i < 3; i++)
+    {
+        uint32_t length = MakeEvent(event, sizeof(event), 0x1000 + i);
+        NL_TEST_ASSERT(apSuite, length > 0);
+        NL_TEST_ASSERT(apSuite, log.Append(100 + i, event, length) == CHIP_NO_ERROR);
+    }
+
+    // Appends only stage in RAM; nothing reaches storage until the flush.
+    {
+        PersistentEventLog reload;
+        ReplayedEvents replayed;
+        NL_TEST_ASSERT(apSuite, reload.Init(&storage, gStagingBuffer, kStagingSize, kMaxSegments) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, reload.Replay(CollectEvent, &replayed) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, replayed.mCount == 0);
+    }
+
+    NL_TEST_ASSERT(apSuite, log.Init(&storage, gStagingBuffer, kStagingSize, kMaxSegments) == CHIP_NO_ERROR);
+    for (uint64_t i = 0; i < 3; i++)
+    {
+        uint32_t length = MakeEvent(event, sizeof(event), 0x1000 + i);
+        NL_TEST_ASSERT(apSuite, log.Append(100 + i, event, length) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(apSuite, log.Flush() == CHIP_NO_ERROR);
+
+    // A fresh instance on the same storage sees the events, oldest first.
+    PersistentEventLog reload;
+    ReplayedEvents replayed;
+    NL_TEST_ASSERT(apSuite, reload.Init(&storage, gStagingBuffer, kStagingSize, kMaxSegments) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, reload.Replay(CollectEvent, &replayed) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, replayed.mCount == 3);
+    for (size_t i = 0; i < replayed.mCount; i++)
+    {
+        NL_TEST_ASSERT(apSuite, replayed.mNumbers[i] == 100 + i);
+        NL_TEST_ASSERT(apSuite, replayed.mValues[i] == 0x1000 + i);
+    }
+
+    // Replay is only valid before appending in a given boot.
+    uint32_t length = MakeEvent(event, sizeof(event), 0x2000);
+    NL_TEST_ASSERT(apSuite, reload.Append(200, event, length) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, reload.Replay(CollectEvent, &replayed) == CHIP_ERROR_INCORRECT_STATE);
+}
+
+void TestRingOverwrite(nlTestSuite * apSuite, void * apContext)
+{
+    TestPersistentStorageDelegate storage;
+    PersistentEventLog log;
+    uint8_t event[32];
+
+    NL_TEST_ASSERT(apSuite, log.Init(&storage, gStagingBuffer, kStagingSize, kMaxSegments) == CHIP_NO_ERROR);
+
+    // One event per segment; kMaxSegments + 2 flushes must overwrite the two
+    // oldest segments.
+    for (uint64_t i = 0; i < kMaxSegments + 2; i++)
+    {
+        uint32_t length = MakeEvent(event, sizeof(event), i);
+        NL_TEST_ASSERT(apSuite, log.Append(i, event, length) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, log.Flush() == CHIP_NO_ERROR);
+    }
+
+    PersistentEventLog reload;
+    ReplayedEvents replayed;
+    NL_TEST_ASSERT(apSuite, reload.Init(&storage, gStagingBuffer, kStagingSize, kMaxSegments) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, reload.Replay(CollectEvent, &replayed) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, replayed.mCount == kMaxSegments);
+    NL_TEST_ASSERT(apSuite, replayed.mNumbers[0] == 2);
+    NL_TEST_ASSERT(apSuite, replayed.mNumbers[kMaxSegments - 1] == kMaxSegments + 1);
+}
+
+void TestCorruptSegmentSkipped(nlTestSuite * apSuite, void * apContext)
+{
+    TestPersistentStorageDelegate storage;
+    PersistentEventLog log;
+    uint8_t event[32];
+
+    NL_TEST_ASSERT(apSuite, log.Init(&storage, gStagingBuffer, kStagingSize, kMaxSegments) == CHIP_NO_ERROR);
+
+    for (uint64_t i = 0; i < 2; i++)
+    {
+        uint32_t length = MakeEvent(event, sizeof(event), i);
+        NL_TEST_ASSERT(apSuite, log.Append(i, event, length) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, log.Flush() == CHIP_NO_ERROR);
+    }
+
+    // Simulate a write torn by power loss: garble the first segment in place.
+    DefaultStorageKeyAllocator key;
+    uint8_t garbage[4] = { 0xde, 0xad, 0xbe, 0xef };
+    NL_TEST_ASSERT(apSuite, storage.SyncSetKeyValue(key.EventLogSegment(0), garbage, sizeof(garbage)) == CHIP_NO_ERROR);
+
+    PersistentEventLog reload;
+    ReplayedEvents replayed;
+    NL_TEST_ASSERT(apSuite, reload.Init(&storage, gStagingBuffer, kStagingSize, kMaxSegments) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, reload.Replay(CollectEvent, &replayed) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, replayed.mCount == 1);
+    NL_TEST_ASSERT(apSuite, replayed.mNumbers[0] == 1);
+}
+
+void TestClear(nlTestSuite * apSuite, void * apContext)
+{
+    TestPersistentStorageDelegate storage;
+    PersistentEventLog log;
+    uint8_t event[32];
+
+    NL_TEST_ASSERT(apSuite, log.Init(&storage, gStagingBuffer, kStagingSize, kMaxSegments) == CHIP_NO_ERROR);
+
+    uint32_t length = MakeEvent(event, sizeof(event), 1);
+    NL_TEST_ASSERT(apSuite, log.Append(1, event, length) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, log.Flush() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, log.Clear() == CHIP_NO_ERROR);
+
+    ReplayedEvents replayed;
+    NL_TEST_ASSERT(apSuite, log.Replay(CollectEvent, &replayed) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, replayed.mCount == 0);
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("TestAppendFlushReplay", TestAppendFlushReplay),
+                          NL_TEST_DEF("TestRingOverwrite", TestRingOverwrite),
+                          NL_TEST_DEF("TestCorruptSegmentSkipped", TestCorruptSegmentSkipped),
+                          NL_TEST_DEF("TestClear", TestClear), NL_TEST_SENTINEL() };
+
+} // namespace
+
+int TestPersistentEventLog()
+{
+    nlTestSuite theSuite = { "PersistentEventLog", &sTests[0], nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestPersistentEventLog)
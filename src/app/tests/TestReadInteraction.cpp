@@ -23,6 +23,7 @@
  */
 
 #include <app/AttributeAccessInterface.h>
+#include <app/BatchedReadClient.h>
 #include <app/InteractionModelEngine.h>
 #include <app/MessageDef/AttributeReportIBs.h>
 #include <app/MessageDef/EventDataIB.h>
@@ -207,10 +208,38 @@ public:
     uint32_t mNumSubscriptions             = 0;
     chip::app::ReadHandler * mpReadHandler = nullptr;
 };
+
+class MockBatchedReadCallback : public chip::app::BatchedReadClient::Callback
+{
+public:
+    void OnAttributeData(const chip::app::ConcreteDataAttributePath & aPath, chip::TLV::TLVReader * apData,
+                         const chip::app::StatusIB & aStatus) override
+    {
+        if (aStatus.mStatus == chip::Protocols::InteractionModel::Status::Success)
+        {
+            mNumAttributeResponse++;
+        }
+    }
+
+    void OnBatchDone(CHIP_ERROR aError) override
+    {
+        mBatchDone  = true;
+        mBatchError = aError;
+    }
+
+    int mNumAttributeResponse = 0;
+    bool mBatchDone           = false;
+    CHIP_ERROR mBatchError    = CHIP_NO_ERROR;
+};
 } // namespace
 
 namespace chip {
 namespace app {
+DataVersion GetClusterDataVersion(EndpointId aEndpointId, ClusterId aClusterId)
+{
+    return 0;
+}
+
 CHIP_ERROR ReadSingleClusterData(const Access::SubjectDescriptor & aSubjectDescriptor, const ConcreteReadAttributePath & aPath,
                                  AttributeReportIBs::Builder & aAttributeReports,
                                  AttributeValueEncoder::AttributeEncodeState * apEncoderState)
@@ -250,6 +279,7 @@ class TestReadInteraction
 public:
     static void TestReadClient(nlTestSuite * apSuite, void * apContext);
     static void TestReadHandler(nlTestSuite * apSuite, void * apContext);
+    static void TestReadHandlerDataVersionFilters(nlTestSuite * apSuite, void * apContext);
     static void TestReadClientGenerateAttributePathList(nlTestSuite * apSuite, void * apContext);
     static void TestReadClientGenerateInvalidAttributePathList(nlTestSuite * apSuite, void * apContext);
     static void TestReadClientGenerateOneEventPaths(nlTestSuite * apSuite, void * apContext);
@@ -259,6 +289,7 @@ public:
     static void TestProcessSubscribeResponse(nlTestSuite * apSuite, void * apContext);
     static void TestProcessSubscribeRequest(nlTestSuite * apSuite, void * apContext);
     static void TestReadRoundtrip(nlTestSuite * apSuite, void * apContext);
+    static void TestBatchedRead(nlTestSuite * apSuite, void * apContext);
     static void TestReadWildcard(nlTestSuite * apSuite, void * apContext);
     static void TestReadChunking(nlTestSuite * apSuite, void * apContext);
     static void TestSetDirtyBetweenChunks(nlTestSuite * apSuite, void * apContext);
@@ -423,6 +454,78 @@ void TestReadInteraction::TestReadHandler(nlTestSuite * apSuite, void * apContex
     engine->Shutdown();
 }
 
+void TestReadInteraction::TestReadHandlerDataVersionFilters(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    app::ReadHandler readHandler;
+    System::PacketBufferTLVWriter writer;
+    System::PacketBufferHandle readRequestbuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    ReadRequestMessage::Builder readRequestBuilder;
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    Messaging::ExchangeContext * exchangeCtx = ctx.NewExchangeToAlice(nullptr);
+    readHandler.Init(&ctx.GetExchangeManager(), nullptr, exchangeCtx, chip::app::ReadHandler::InteractionType::Read);
+
+    writer.Init(std::move(readRequestbuf));
+    err = readRequestBuilder.Init(&writer);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    AttributePathIBs::Builder & attributePathListBuilder = readRequestBuilder.CreateAttributeRequests();
+    NL_TEST_ASSERT(apSuite, attributePathListBuilder.GetError() == CHIP_NO_ERROR);
+
+    AttributePathIB::Builder & attributePathBuilder = attributePathListBuilder.CreatePath();
+    NL_TEST_ASSERT(apSuite, attributePathListBuilder.GetError() == CHIP_NO_ERROR);
+
+    attributePathBuilder.Node(1).Endpoint(2).Cluster(3).Attribute(4).EndOfAttributePathIB();
+    err = attributePathBuilder.GetError();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    attributePathListBuilder.EndOfAttributePathIBs();
+    err = attributePathListBuilder.GetError();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    DataVersionFilterIBs::Builder & dataVersionFilterListBuilder = readRequestBuilder.CreateDataVersionFilters();
+    NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+
+    DataVersionFilterIB::Builder & dataVersionFilterBuilder = dataVersionFilterListBuilder.CreateDataVersionFilter();
+    NL_TEST_ASSERT(apSuite, dataVersionFilterListBuilder.GetError() == CHIP_NO_ERROR);
+
+    ClusterPathIB::Builder & clusterPathBuilder = dataVersionFilterBuilder.CreatePath();
+    NL_TEST_ASSERT(apSuite, dataVersionFilterBuilder.GetError() == CHIP_NO_ERROR);
+
+    clusterPathBuilder.Endpoint(2).Cluster(3).EndOfClusterPathIB();
+    NL_TEST_ASSERT(apSuite, clusterPathBuilder.GetError() == CHIP_NO_ERROR);
+
+    dataVersionFilterBuilder.DataVersion(5).EndOfDataVersionFilterIB();
+    NL_TEST_ASSERT(apSuite, dataVersionFilterBuilder.GetError() == CHIP_NO_ERROR);
+
+    dataVersionFilterListBuilder.EndOfDataVersionFilterIBs();
+    NL_TEST_ASSERT(apSuite, dataVersionFilterListBuilder.GetError() == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+    readRequestBuilder.IsFabricFiltered(false).EndOfReadRequestMessage();
+    NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+    err = writer.Finalize(&readRequestbuf);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    err = readHandler.OnReadInitialRequest(std::move(readRequestbuf));
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // The filter for endpoint 2 / cluster 3 should have been captured; other
+    // clusters are unfiltered.
+    DataVersion version = 0;
+    NL_TEST_ASSERT(apSuite, readHandler.GetDataVersionFilter(2, 3, version));
+    NL_TEST_ASSERT(apSuite, version == 5);
+    NL_TEST_ASSERT(apSuite, !readHandler.GetDataVersionFilter(2, 4, version));
+
+    exchangeCtx->Close();
+    engine->Shutdown();
+}
+
 void TestReadInteraction::TestReadClientGenerateAttributePathList(nlTestSuite * apSuite, void * apContext)
 {
     CHIP_ERROR err    = CHIP_NO_ERROR;
@@ -714,6 +817,59 @@ void TestReadInteraction::TestReadRoundtrip(nlTestSuite * apSuite, void * apCont
     engine->Shutdown();
 }
 
+void TestReadInteraction::TestBatchedRead(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // One path more than fits in a single ReadRequest, so the batch needs two interactions.
+    constexpr size_t kPathCount = chip::app::BatchedReadClient::kMaxPathsPerReadRequest + 1;
+    chip::app::AttributePathParams attributePathParams[kPathCount];
+    for (size_t i = 0; i < kPathCount; i++)
+    {
+        attributePathParams[i].mEndpointId  = kTestEndpointId;
+        attributePathParams[i].mClusterId   = kTestClusterId;
+        attributePathParams[i].mAttributeId = 1;
+    }
+
+    MockBatchedReadCallback batchCallback;
+    chip::app::BatchedReadClient batchedReadClient;
+    err = batchedReadClient.SendBatchedRead(ctx.GetSessionBobToAlice(), attributePathParams, kPathCount, &batchCallback);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, batchedReadClient.IsBusy());
+
+    // A second batch on the same client must be rejected while the first is in flight.
+    err = batchedReadClient.SendBatchedRead(ctx.GetSessionBobToAlice(), attributePathParams, kPathCount, &batchCallback);
+    NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_INCORRECT_STATE);
+
+    // The second interaction is only started once the first completes, and large reports may
+    // need several reporting passes to chunk out, so keep running the engine until done.
+    for (int i = 0; i < 10 && !batchCallback.mBatchDone; i++)
+    {
+        InteractionModelEngine::GetInstance()->GetReportingEngine().Run();
+    }
+
+    NL_TEST_ASSERT(apSuite, batchCallback.mBatchDone);
+    NL_TEST_ASSERT(apSuite, batchCallback.mBatchError == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, batchCallback.mNumAttributeResponse == static_cast<int>(kPathCount));
+    NL_TEST_ASSERT(apSuite, !batchedReadClient.IsBusy());
+
+    // By now we should have closed all exchanges and sent all pending acks, so
+    // there should be no queued-up things in the retransmit table.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    engine->Shutdown();
+}
+
 void TestReadInteraction::TestReadWildcard(nlTestSuite * apSuite, void * apContext)
 {
     TestContext & ctx = *static_cast<TestContext *>(apContext);
@@ -1038,6 +1194,14 @@ void TestReadInteraction::TestSubscribeRoundtrip(nlTestSuite * apSuite, void * a
     NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 2);
     NL_TEST_ASSERT(apSuite, delegate.mNumSubscriptions == 1);
 
+    // The admission policy sees one active subscription on the accessing fabric,
+    // costing its interested attribute and event paths, and none elsewhere.
+    NL_TEST_ASSERT(apSuite, engine->GetNumActiveSubscriptions(delegate.mpReadHandler->GetAccessingFabricIndex()) == 1);
+    NL_TEST_ASSERT(apSuite, delegate.mpReadHandler->GetInterestedPathCount() > 0);
+    NL_TEST_ASSERT(
+        apSuite,
+        engine->GetNumActiveSubscriptions(static_cast<FabricIndex>(delegate.mpReadHandler->GetAccessingFabricIndex() + 1)) == 0);
+
     GenerateEvents(apSuite, apContext, true /*aIsUrgent*/);
     NL_TEST_ASSERT(apSuite, delegate.mpReadHandler->mHoldReport == false);
     NL_TEST_ASSERT(apSuite, delegate.mpReadHandler->mDirty == true);
@@ -1454,11 +1618,13 @@ namespace {
 const nlTest sTests[] =
 {
     NL_TEST_DEF("TestReadRoundtrip", chip::app::TestReadInteraction::TestReadRoundtrip),
+    NL_TEST_DEF("TestBatchedRead", chip::app::TestReadInteraction::TestBatchedRead),
     NL_TEST_DEF("TestReadWildcard", chip::app::TestReadInteraction::TestReadWildcard),
     NL_TEST_DEF("TestReadChunking", chip::app::TestReadInteraction::TestReadChunking),
     NL_TEST_DEF("TestSetDirtyBetweenChunks", chip::app::TestReadInteraction::TestSetDirtyBetweenChunks),
     NL_TEST_DEF("CheckReadClient", chip::app::TestReadInteraction::TestReadClient),
     NL_TEST_DEF("CheckReadHandler", chip::app::TestReadInteraction::TestReadHandler),
+    NL_TEST_DEF("TestReadHandlerDataVersionFilters", chip::app::TestReadInteraction::TestReadHandlerDataVersionFilters),
     NL_TEST_DEF("TestReadClientGenerateAttributePathList", chip::app::TestReadInteraction::TestReadClientGenerateAttributePathList),
     NL_TEST_DEF("TestReadClientGenerateInvalidAttributePathList", chip::app::TestReadInteraction::TestReadClientGenerateInvalidAttributePathList),
     NL_TEST_DEF("TestReadClientGenerateOneEventPaths", chip::app::TestReadInteraction::TestReadClientGenerateOneEventPaths),
@@ -0,0 +1,129 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <nlunit-test.h>
+
+#include <app/SubscriptionResumptionStorage.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/UnitTestRegistration.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+SubscriptionResumptionStorage::Entry MakeEntry(NodeId nodeId, uint64_t subscriptionId)
+{
+    SubscriptionResumptionStorage::Entry entry;
+    entry.nodeId                          = nodeId;
+    entry.subscriptionId                  = subscriptionId;
+    entry.fabricIndex                     = 1;
+    entry.minInterval                     = 2;
+    entry.maxInterval                     = 60;
+    entry.fabricFiltered                  = true;
+    entry.attributePathCount              = 1;
+    entry.attributePaths[0].mEndpointId   = 3;
+    entry.attributePaths[0].mClusterId    = 6;
+    entry.attributePaths[0].mAttributeId  = 0;
+    entry.eventPathCount                  = 1;
+    entry.eventPaths[0].mEndpointId       = 3;
+    entry.eventPaths[0].mClusterId        = 0x28;
+    entry.eventPaths[0].mEventId          = 1;
+    return entry;
+}
+
+void TestSaveAndLoad(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistentStorageDelegate delegate;
+    SubscriptionResumptionStorage storage;
+
+    NL_TEST_ASSERT(inSuite, storage.Init(&delegate) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.Count() == 0);
+
+    NL_TEST_ASSERT(inSuite, storage.Save(MakeEntry(0x1111, 0xabcd)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.Count() == 1);
+
+    SubscriptionResumptionStorage::Entry loaded;
+    NL_TEST_ASSERT(inSuite, storage.Load(0, loaded) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, loaded.nodeId == 0x1111);
+    NL_TEST_ASSERT(inSuite, loaded.subscriptionId == 0xabcd);
+    NL_TEST_ASSERT(inSuite, loaded.fabricIndex == 1);
+    NL_TEST_ASSERT(inSuite, loaded.minInterval == 2);
+    NL_TEST_ASSERT(inSuite, loaded.maxInterval == 60);
+    NL_TEST_ASSERT(inSuite, loaded.fabricFiltered);
+    NL_TEST_ASSERT(inSuite, loaded.attributePathCount == 1);
+    NL_TEST_ASSERT(inSuite, loaded.attributePaths[0].mEndpointId == 3);
+    NL_TEST_ASSERT(inSuite, loaded.attributePaths[0].mClusterId == 6);
+    NL_TEST_ASSERT(inSuite, loaded.attributePaths[0].mAttributeId == 0);
+    NL_TEST_ASSERT(inSuite, loaded.eventPathCount == 1);
+    NL_TEST_ASSERT(inSuite, loaded.eventPaths[0].mEventId == 1);
+}
+
+void TestReplaceExisting(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistentStorageDelegate delegate;
+    SubscriptionResumptionStorage storage;
+
+    NL_TEST_ASSERT(inSuite, storage.Init(&delegate) == CHIP_NO_ERROR);
+
+    SubscriptionResumptionStorage::Entry entry = MakeEntry(0x1111, 0xabcd);
+    NL_TEST_ASSERT(inSuite, storage.Save(entry) == CHIP_NO_ERROR);
+
+    entry.maxInterval = 120;
+    NL_TEST_ASSERT(inSuite, storage.Save(entry) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.Count() == 1);
+
+    SubscriptionResumptionStorage::Entry loaded;
+    NL_TEST_ASSERT(inSuite, storage.Load(0, loaded) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, loaded.maxInterval == 120);
+}
+
+void TestDelete(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistentStorageDelegate delegate;
+    SubscriptionResumptionStorage storage;
+
+    NL_TEST_ASSERT(inSuite, storage.Init(&delegate) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, storage.Save(MakeEntry(0x1111, 1)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.Save(MakeEntry(0x2222, 2)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.Count() == 2);
+
+    NL_TEST_ASSERT(inSuite, storage.Delete(1, 0x1111, 1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.Count() == 1);
+    NL_TEST_ASSERT(inSuite, storage.Delete(1, 0x1111, 1) == CHIP_ERROR_NOT_FOUND);
+
+    NL_TEST_ASSERT(inSuite, storage.DeleteAll(1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.Count() == 0);
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("TestSaveAndLoad", TestSaveAndLoad),
+                          NL_TEST_DEF("TestReplaceExisting", TestReplaceExisting), NL_TEST_DEF("TestDelete", TestDelete),
+                          NL_TEST_SENTINEL() };
+
+} // namespace
+
+int TestSubscriptionResumptionStorage(void)
+{
+    nlTestSuite theSuite = { "SubscriptionResumptionStorage", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSubscriptionResumptionStorage)
@@ -44,8 +44,10 @@ class TestWriteInteraction
 {
 public:
     static void TestWriteClient(nlTestSuite * apSuite, void * apContext);
+    static void TestWriteClientChunkedList(nlTestSuite * apSuite, void * apContext);
     static void TestWriteClientGroup(nlTestSuite * apSuite, void * apContext);
     static void TestWriteHandler(nlTestSuite * apSuite, void * apContext);
+    static void TestWriteHandlerStreaming(nlTestSuite * apSuite, void * apContext);
     static void TestWriteRoundtrip(nlTestSuite * apSuite, void * apContext);
     static void TestWriteRoundtripWithClusterObjects(nlTestSuite * apSuite, void * apContext);
 
@@ -53,7 +55,7 @@ private:
     static void AddAttributeDataIB(nlTestSuite * apSuite, void * apContext, WriteClientHandle & aWriteClient);
     static void AddAttributeStatus(nlTestSuite * apSuite, void * apContext, WriteHandler & aWriteHandler);
     static void GenerateWriteRequest(nlTestSuite * apSuite, void * apContext, bool aIsTimedWrite,
-                                     System::PacketBufferHandle & aPayload);
+                                     System::PacketBufferHandle & aPayload, bool aMoreChunks = false);
     static void GenerateWriteResponse(nlTestSuite * apSuite, void * apContext, System::PacketBufferHandle & aPayload);
 };
 
@@ -117,7 +119,7 @@ void TestWriteInteraction::AddAttributeStatus(nlTestSuite * apSuite, void * apCo
 }
 
 void TestWriteInteraction::GenerateWriteRequest(nlTestSuite * apSuite, void * apContext, bool aIsTimedWrite,
-                                                System::PacketBufferHandle & aPayload)
+                                                System::PacketBufferHandle & aPayload, bool aMoreChunks)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     System::PacketBufferTLVWriter writer;
@@ -161,6 +163,11 @@ void TestWriteInteraction::GenerateWriteRequest(nlTestSuite * apSuite, void * ap
 
     attributeDataIBsBuilder.EndOfAttributeDataIBs();
     NL_TEST_ASSERT(apSuite, attributeDataIBsBuilder.GetError() == CHIP_NO_ERROR);
+    if (aMoreChunks)
+    {
+        writeRequestBuilder.MoreChunkedMessages(true);
+        NL_TEST_ASSERT(apSuite, writeRequestBuilder.GetError() == CHIP_NO_ERROR);
+    }
     writeRequestBuilder.IsFabricFiltered(false).EndOfWriteRequestMessage();
     NL_TEST_ASSERT(apSuite, writeRequestBuilder.GetError() == CHIP_NO_ERROR);
 
@@ -240,6 +247,61 @@ void TestWriteInteraction::TestWriteClient(nlTestSuite * apSuite, void * apConte
     NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
 }
 
+void TestWriteInteraction::TestWriteClientChunkedList(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    app::WriteClient writeClient;
+    app::WriteClientHandle writeClientHandle;
+    writeClientHandle.SetWriteClient(&writeClient);
+
+    TestWriteClientCallback callback;
+    err = writeClient.Init(&ctx.GetExchangeManager(), &callback, /* aTimedWriteTimeoutMs = */ NullOptional);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    AttributePathParams attributePathParams;
+    attributePathParams.mEndpointId  = 2;
+    attributePathParams.mClusterId   = 3;
+    attributePathParams.mAttributeId = 4;
+
+    // A list too large for a single message: encoding it must queue at least one chunk
+    // with MoreChunkedMessages set and leave the remainder in the message under
+    // construction.
+    uint64_t items[200];
+    for (uint64_t i = 0; i < ArraySize(items); i++)
+    {
+        items[i] = i;
+    }
+
+    err = writeClientHandle.EncodeAttributeWritePayload(attributePathParams,
+                                                        DataModel::List<uint64_t>(items, ArraySize(items)));
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !writeClient.mChunks.IsNull());
+
+    // The queued chunk must parse as a Write Request message carrying the
+    // MoreChunkedMessages flag.
+    System::PacketBufferHandle chunk = writeClient.mChunks.PopHead();
+    System::PacketBufferTLVReader reader;
+    reader.Init(std::move(chunk));
+    err = reader.Next();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    WriteRequestMessage::Parser writeRequestParser;
+    err = writeRequestParser.Init(reader);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    bool moreChunkedMessages = false;
+    err                      = writeRequestParser.GetMoreChunkedMessages(&moreChunkedMessages);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, moreChunkedMessages);
+
+    // Shut the client down while the callback is still in scope.
+    writeClientHandle.SetWriteClient(nullptr);
+    NL_TEST_ASSERT(apSuite, callback.mOnDoneCalled == 1);
+}
+
 void TestWriteInteraction::TestWriteClientGroup(nlTestSuite * apSuite, void * apContext)
 {
     TestContext & ctx = *static_cast<TestContext *>(apContext);
@@ -312,6 +374,44 @@ void TestWriteInteraction::TestWriteHandler(nlTestSuite * apSuite, void * apCont
     }
 }
 
+void TestWriteInteraction::TestWriteHandlerStreaming(nlTestSuite * apSuite, void * apContext)
+{
+    using namespace Protocols::InteractionModel;
+
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    app::WriteHandler writeHandler;
+
+    chip::app::InteractionModelDelegate IMdelegate;
+    err = writeHandler.Init(&IMdelegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    TestExchangeDelegate delegate;
+    Messaging::ExchangeContext * exchange = ctx.NewExchangeToBob(&delegate);
+
+    // First chunk announces more chunks to come: the handler takes over the exchange and
+    // stays busy instead of responding.
+    System::PacketBufferHandle buf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    GenerateWriteRequest(apSuite, apContext, false /* aIsTimedWrite */, buf, true /* aMoreChunks */);
+    Status status = writeHandler.OnWriteRequest(exchange, std::move(buf), false /* aIsTimedWrite */);
+    NL_TEST_ASSERT(apSuite, status == Status::Success);
+    NL_TEST_ASSERT(apSuite, !writeHandler.IsFree());
+
+    // Final chunk: the handler sends the single aggregated WriteResponse and frees itself.
+    buf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    GenerateWriteRequest(apSuite, apContext, false /* aIsTimedWrite */, buf, false /* aMoreChunks */);
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(Protocols::InteractionModel::MsgType::WriteRequest);
+    err = static_cast<Messaging::ExchangeDelegate &>(writeHandler).OnMessageReceived(exchange, payloadHeader, std::move(buf));
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writeHandler.IsFree());
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+}
+
 CHIP_ERROR WriteSingleClusterData(const Access::SubjectDescriptor & aSubjectDescriptor, ClusterInfo & aClusterInfo,
                                   TLV::TLVReader & aReader, WriteHandler * aWriteHandler)
 {
@@ -441,8 +541,10 @@ namespace {
 const nlTest sTests[] =
 {
         NL_TEST_DEF("CheckWriteClient", chip::app::TestWriteInteraction::TestWriteClient),
+        NL_TEST_DEF("CheckWriteClientChunkedList", chip::app::TestWriteInteraction::TestWriteClientChunkedList),
         NL_TEST_DEF("CheckWriteClientGroup", chip::app::TestWriteInteraction::TestWriteClientGroup),
         NL_TEST_DEF("CheckWriteHandler", chip::app::TestWriteInteraction::TestWriteHandler),
+        NL_TEST_DEF("CheckWriteHandlerStreaming", chip::app::TestWriteInteraction::TestWriteHandlerStreaming),
         NL_TEST_DEF("CheckWriteRoundtrip", chip::app::TestWriteInteraction::TestWriteRoundtrip),
         NL_TEST_DEF("TestWriteRoundtripWithClusterObjects", chip::app::TestWriteInteraction::TestWriteRoundtripWithClusterObjects),
         NL_TEST_SENTINEL()
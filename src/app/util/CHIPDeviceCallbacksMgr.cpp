@@ -50,26 +50,29 @@ CHIP_ERROR CHIPDeviceCallbacksMgr::AddResponseCallback(NodeId nodeId, uint8_t se
     memcpy(&onSuccessCallback->mInfo, &info, sizeof(info));
     memcpy(&onFailureCallback->mInfo, &info, sizeof(info));
 
+    const size_t bucket = ResponseBucket(info);
+
     // If some callbacks have already been registered for the same ResponseCallbackInfo, it usually means that the response
     // has not been received for a previous command with the same sequenceNumber. Cancel the previously registered callbacks.
-    CancelCallback(info, mResponsesSuccess);
-    CancelCallback(info, mResponsesFailure);
+    CancelCallback(info, mResponsesSuccess[bucket]);
+    CancelCallback(info, mResponsesFailure[bucket]);
     PopResponseFilter(info, nullptr);
 
     if (filter != nullptr)
     {
         ReturnErrorOnFailure(AddResponseFilter(info, filter));
     }
-    mResponsesSuccess.Enqueue(onSuccessCallback);
-    mResponsesFailure.Enqueue(onFailureCallback);
+    mResponsesSuccess[bucket].Enqueue(onSuccessCallback);
+    mResponsesFailure[bucket].Enqueue(onFailureCallback);
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR CHIPDeviceCallbacksMgr::CancelResponseCallback(NodeId nodeId, uint8_t sequenceNumber)
 {
     ResponseCallbackInfo info = { nodeId, sequenceNumber };
-    CancelCallback(info, mResponsesSuccess);
-    CancelCallback(info, mResponsesFailure);
+    const size_t bucket       = ResponseBucket(info);
+    CancelCallback(info, mResponsesSuccess[bucket]);
+    CancelCallback(info, mResponsesFailure[bucket]);
     PopResponseFilter(info, nullptr);
     return CHIP_NO_ERROR;
 }
@@ -115,11 +118,12 @@ CHIP_ERROR CHIPDeviceCallbacksMgr::GetResponseCallback(NodeId nodeId, uint8_t se
                                                        Callback::Cancelable ** onFailureCallback, TLVDataFilter * outFilter)
 {
     ResponseCallbackInfo info = { nodeId, sequenceNumber };
+    const size_t bucket       = ResponseBucket(info);
 
-    ReturnErrorOnFailure(GetCallback(info, mResponsesSuccess, onSuccessCallback));
+    ReturnErrorOnFailure(GetCallback(info, mResponsesSuccess[bucket], onSuccessCallback));
     (*onSuccessCallback)->Cancel();
 
-    ReturnErrorOnFailure(GetCallback(info, mResponsesFailure, onFailureCallback));
+    ReturnErrorOnFailure(GetCallback(info, mResponsesFailure[bucket], onFailureCallback));
     (*onFailureCallback)->Cancel();
 
     if (outFilter == nullptr)
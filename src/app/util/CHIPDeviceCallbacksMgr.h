@@ -145,8 +145,25 @@ private:
     CHIP_ERROR AddResponseFilter(const ResponseCallbackInfo & info, TLVDataFilter callbackFilter);
     CHIP_ERROR PopResponseFilter(const ResponseCallbackInfo & info, TLVDataFilter * callbackFilter);
 
-    Callback::CallbackDeque mResponsesSuccess;
-    Callback::CallbackDeque mResponsesFailure;
+    // Outstanding response callbacks are kept in hash buckets keyed by
+    // (node id, sequence number), so matching a response against many in-flight
+    // interactions scans one short bucket instead of every registration.
+    // Cancellation stays intrusive — a callback dequeues itself from whichever
+    // bucket list it is on — so there is no index to fix up on cancel.
+    static constexpr size_t kResponseBucketCount = 16;
+    static_assert((kResponseBucketCount & (kResponseBucketCount - 1)) == 0, "bucket count must be a power of two");
+
+    static size_t ResponseBucket(const ResponseCallbackInfo & info)
+    {
+        // Node ids cluster in their low bits, so fold the key through a
+        // multiplicative hash and take bits from the top.
+        uint64_t key = info.nodeId ^ (static_cast<uint64_t>(info.sequenceNumber) << 56);
+        key *= 0x9e3779b97f4a7c15ULL;
+        return static_cast<size_t>(key >> 32) & (kResponseBucketCount - 1);
+    }
+
+    Callback::CallbackDeque mResponsesSuccess[kResponseBucketCount];
+    Callback::CallbackDeque mResponsesFailure[kResponseBucketCount];
     TLVFilterItem<ResponseCallbackInfo> mTLVFilterPool[kTLVFilterPoolSize];
 };
 
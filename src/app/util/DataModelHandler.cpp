@@ -35,8 +35,22 @@ void emberAfPluginIasZoneServerStackStatusCallback(EmberStatus status);
 
 using namespace ::chip;
 
+namespace {
+
+bool sDataModelInitialized                                  = false;
+chip::Messaging::ExchangeManager * sDeferredExchangeManager = nullptr;
+
+} // namespace
+
 void InitDataModelHandler(chip::Messaging::ExchangeManager * exchangeManager)
 {
+    if (sDataModelInitialized)
+    {
+        return;
+    }
+    sDataModelInitialized    = true;
+    sDeferredExchangeManager = nullptr;
+
 #ifdef USE_ZAP_CONFIG
     ChipLogProgress(Zcl, "Using ZAP configuration...");
     emberAfEndpointConfigure();
@@ -51,3 +65,19 @@ void InitDataModelHandler(chip::Messaging::ExchangeManager * exchangeManager)
 #endif
 #endif
 }
+
+void DeferInitDataModelHandler(chip::Messaging::ExchangeManager * exchangeManager)
+{
+    if (!sDataModelInitialized)
+    {
+        sDeferredExchangeManager = exchangeManager;
+    }
+}
+
+void EnsureDataModelInitialized()
+{
+    if (!sDataModelInitialized && sDeferredExchangeManager != nullptr)
+    {
+        InitDataModelHandler(sDeferredExchangeManager);
+    }
+}
@@ -31,5 +31,23 @@
  * Initialize the data model internal code to be ready to send and receive
  * data model messages.
  *
+ * Safe to call more than once; only the first call does any work.
+ *
  */
 void InitDataModelHandler(chip::Messaging::ExchangeManager * exchangeMgr);
+
+/**
+ * Record the exchange manager for a deferred data model initialization
+ * without doing the (potentially slow) cluster initialization work yet.
+ * EnsureDataModelInitialized() performs the actual work later, from the
+ * event loop or on the first cluster access, whichever happens first.
+ *
+ */
+void DeferInitDataModelHandler(chip::Messaging::ExchangeManager * exchangeMgr);
+
+/**
+ * Run a deferred data model initialization if it has not happened yet.
+ * A cheap no-op once initialization is done.
+ *
+ */
+void EnsureDataModelInitialized();
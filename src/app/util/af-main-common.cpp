@@ -356,7 +356,7 @@ EmberStatus emberAfSendMulticast(GroupId multicastId, EmberApsFrame * apsFrame,
 
 EmberStatus emberAfSendMulticastToBindings(EmberApsFrame * apsFrame, uint16_t messageLength, uint8_t * message)
 {
-    EmberStatus status = EMBER_INVALID_BINDING_INDEX;
+    EmberStatus status = EMBER_SUCCESS;
     uint8_t i;
     EmberBindingTableEntry binding;
     GroupId groupDest;
@@ -366,7 +366,10 @@ EmberStatus emberAfSendMulticastToBindings(EmberApsFrame * apsFrame, uint16_t me
         return EMBER_BAD_ARGUMENT;
     }
 
-    for (i = 0; i < EMBER_BINDING_TABLE_SIZE; i++)
+    // The cluster index hands back only entries matching our local endpoint
+    // and cluster, so we just need to filter on the binding type.
+    for (i = emberBindingTableFirstMatch(apsFrame->sourceEndpoint, apsFrame->clusterId); i != EMBER_NULL_BINDING_INDEX;
+         i = emberBindingTableNextMatch(i))
     {
         status = emberGetBinding(i, &binding);
         if (status != EMBER_SUCCESS)
@@ -374,8 +377,7 @@ EmberStatus emberAfSendMulticastToBindings(EmberApsFrame * apsFrame, uint16_t me
             return status;
         }
 
-        if (binding.type == EMBER_MULTICAST_BINDING && binding.local == apsFrame->sourceEndpoint &&
-            binding.clusterId == apsFrame->clusterId)
+        if (binding.type == EMBER_MULTICAST_BINDING)
         {
             groupDest                     = binding.groupId;
             apsFrame->groupId             = groupDest;
@@ -460,10 +462,11 @@ EmberStatus emberAfSendUnicast(const MessageSendDestination & destination, Ember
 EmberStatus emberAfSendUnicastToBindingsWithCallback(EmberApsFrame * apsFrame, uint16_t messageLength, uint8_t * message,
                                                      EmberAfMessageSentFunction callback)
 {
-    EmberStatus status = EMBER_INVALID_BINDING_INDEX;
+    EmberStatus status = EMBER_SUCCESS;
     uint8_t i;
 
-    for (i = 0; i < EMBER_BINDING_TABLE_SIZE; i++)
+    for (i = emberBindingTableFirstMatch(apsFrame->sourceEndpoint, apsFrame->clusterId); i != EMBER_NULL_BINDING_INDEX;
+         i = emberBindingTableNextMatch(i))
     {
         EmberBindingTableEntry binding;
         status = emberGetBinding(i, &binding);
@@ -471,8 +474,7 @@ EmberStatus emberAfSendUnicastToBindingsWithCallback(EmberApsFrame * apsFrame, u
         {
             return status;
         }
-        if (binding.type == EMBER_UNICAST_BINDING && binding.local == apsFrame->sourceEndpoint &&
-            binding.clusterId == apsFrame->clusterId)
+        if (binding.type == EMBER_UNICAST_BINDING)
         {
             apsFrame->destinationEndpoint            = binding.remote;
             const MessageSendDestination destination = MessageSendDestination::ViaBinding(i);
@@ -539,9 +539,17 @@ enum
 
 /**
  * @brief Struct that maps actual endpoint type, onto a specific endpoint.
+ *
+ * One of these is kept in RAM per endpoint slot, so members are ordered by
+ * decreasing alignment to avoid padding; the table dominates static RAM on
+ * configurations with many dynamic endpoints.
  */
 typedef struct
 {
+    /**
+     * Endpoint type for this endpoint.
+     */
+    EmberAfEndpointType * endpointType;
     /**
      * Actual zigbee endpoint number.
      */
@@ -554,10 +562,6 @@ typedef struct
      * Version of the device.
      */
     uint8_t deviceVersion;
-    /**
-     * Endpoint type for this endpoint.
-     */
-    EmberAfEndpointType * endpointType;
     /**
      * Network index for this endpoint.
      */
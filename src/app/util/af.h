@@ -471,6 +471,14 @@ uint16_t emberAfEndpointCount(void);
  */
 uint16_t emberAfFixedEndpointCount(void);
 
+/**
+ * @brief Returns a monotonic counter that is incremented whenever the set of
+ * endpoints changes (endpoints added, removed, enabled or disabled).  Consumers
+ * that cache expansions of the endpoint/cluster/attribute metadata can compare
+ * generations to detect that a cached expansion has become stale.
+ */
+uint32_t emberAfMetadataStructureGeneration(void);
+
 /**
  * Data types are either analog or discrete. This makes a difference for
  * some of the ZCL global commands
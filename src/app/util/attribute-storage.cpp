@@ -52,6 +52,8 @@
 #include <app-common/zap-generated/callbacks/PluginCallbacks.h>
 #include <app-common/zap-generated/ids/Attributes.h>
 
+#include <utility>
+
 using namespace chip;
 
 //------------------------------------------------------------------------------
@@ -60,6 +62,15 @@ using namespace chip;
 // retrieved from tokens.
 EmberAfDefinedEndpoint emAfEndpoints[MAX_ENDPOINT_COUNT];
 
+// Per-cluster data versions, indexed by endpoint index and server cluster index
+// within the endpoint.  Clusters whose index exceeds the slot count share the
+// last slot (see attribute-storage.h).
+static chip::DataVersion sClusterDataVersions[MAX_ENDPOINT_COUNT][EMBER_AF_DATA_VERSION_SLOTS_PER_ENDPOINT];
+
+// Global attribute store generation, bumped alongside every data version
+// increment so readers can detect mutations that landed mid-read.
+static uint32_t sAttributeStoreGeneration = 0;
+
 #if (ATTRIBUTE_MAX_SIZE == 0)
 #define ACTUAL_ATTRIBUTE_SIZE 1
 #else
@@ -98,15 +109,98 @@ constexpr const EmberAfCluster generatedClusters[]                  = GENERATED_
 constexpr const EmberAfEndpointType generatedEmberAfEndpointTypes[] = GENERATED_ENDPOINT_TYPES;
 
 #if !defined(EMBER_SCRIPTED_TEST)
-#define endpointNumber(x) fixedEndpoints[x]
-#define endpointDeviceId(x) fixedDeviceIds[x]
-#define endpointDeviceVersion(x) fixedDeviceVersions[x]
-// Added 'Macro' to silence MISRA warning about conflict with synonymous vars.
-#define endpointTypeMacro(x) (EmberAfEndpointType *) &(generatedEmberAfEndpointTypes[fixedEmberAfEndpointTypes[x]])
-#define endpointNetworkIndex(x) fixedNetworks[x]
+// Fixed-endpoint composition, fully resolved at compile time.  The five FIXED_*
+// macro lists are materialized as constexpr tables and zipped into a flash image
+// of the fixed portion of the endpoint table, so emberAfEndpointConfigure lands
+// it with a single copy instead of a per-field fix-up loop over stack-built
+// arrays.
+constexpr const uint16_t fixedEndpoints[]           = FIXED_ENDPOINT_ARRAY;
+constexpr const uint16_t fixedDeviceIds[]           = FIXED_DEVICE_IDS;
+constexpr const uint8_t fixedDeviceVersions[]       = FIXED_DEVICE_VERSIONS;
+constexpr const uint8_t fixedEmberAfEndpointTypes[] = FIXED_ENDPOINT_TYPES;
+constexpr const uint8_t fixedNetworks[]             = FIXED_NETWORKS;
+
+constexpr EmberAfDefinedEndpoint MakeFixedEndpoint(size_t idx)
+{
+    // The const_cast only satisfies the shared EmberAfDefinedEndpoint layout; the
+    // generated endpoint types are never written through it.
+    return EmberAfDefinedEndpoint{ const_cast<EmberAfEndpointType *>(
+                                       &generatedEmberAfEndpointTypes[fixedEmberAfEndpointTypes[idx]]),
+                                   fixedEndpoints[idx],
+                                   fixedDeviceIds[idx],
+                                   fixedDeviceVersions[idx],
+                                   fixedNetworks[idx],
+                                   EMBER_AF_ENDPOINT_ENABLED };
+}
+
+struct FixedEndpointTable
+{
+    EmberAfDefinedEndpoint entries[FIXED_ENDPOINT_COUNT];
+};
+
+template <size_t... Is>
+constexpr FixedEndpointTable MakeFixedEndpointTable(std::index_sequence<Is...>)
+{
+    return FixedEndpointTable{ { MakeFixedEndpoint(Is)... } };
+}
+
+constexpr const FixedEndpointTable fixedEndpointTable = MakeFixedEndpointTable(std::make_index_sequence<FIXED_ENDPOINT_COUNT>{});
 #endif
 
 app::AttributeAccessInterface * gAttributeAccessOverrides = nullptr;
+
+// Hash table mapping endpoint ids to indices in emAfEndpoints, so that the endpoint
+// lookup performed on every attribute access stays O(1) when many dynamic endpoints are
+// registered.  The table is sized to stay less than half full and uses linear probing;
+// only the first (lowest) index for a given endpoint id is stored, matching linear scan
+// order.  It is rebuilt lazily after any change that can remove or reorder endpoints and
+// updated incrementally as dynamic endpoints register.
+constexpr uint16_t kEndpointIndexHashSize = MAX_ENDPOINT_COUNT * 2 + 1;
+constexpr uint16_t kEndpointIndexEmpty    = 0xFFFF;
+uint16_t endpointIndexHash[kEndpointIndexHashSize];
+bool endpointIndexHashValid = false;
+
+// Monotonic counter bumped whenever the set of endpoints (or their enabled state)
+// changes, so that consumers caching expansions of the endpoint/cluster/attribute
+// metadata can detect staleness without registering callbacks.
+uint32_t metadataStructureGeneration = 0;
+
+uint16_t endpointIndexHashSlot(EndpointId endpoint)
+{
+    return static_cast<uint16_t>((static_cast<uint32_t>(endpoint) * 2654435761u) % kEndpointIndexHashSize);
+}
+
+void insertEndpointIndexHash(EndpointId endpoint, uint16_t index)
+{
+    uint16_t slot = endpointIndexHashSlot(endpoint);
+    while (endpointIndexHash[slot] != kEndpointIndexEmpty)
+    {
+        if (emAfEndpoints[endpointIndexHash[slot]].endpoint == endpoint)
+        {
+            return;
+        }
+        slot = static_cast<uint16_t>((slot + 1) % kEndpointIndexHashSize);
+    }
+    endpointIndexHash[slot] = index;
+}
+
+void rebuildEndpointIndexHash()
+{
+    for (uint16_t slot = 0; slot < kEndpointIndexHashSize; slot++)
+    {
+        endpointIndexHash[slot] = kEndpointIndexEmpty;
+    }
+    for (uint16_t epi = 0; epi < emberEndpointCount; epi++)
+    {
+        // Skip dynamic slots with nothing registered: their endpoint id is meaningless.
+        if (epi >= FIXED_ENDPOINT_COUNT && emAfEndpoints[epi].endpointType == nullptr)
+        {
+            continue;
+        }
+        insertEndpointIndexHash(emAfEndpoints[epi].endpoint, epi);
+    }
+    endpointIndexHashValid = true;
+}
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -120,18 +214,14 @@ static uint16_t findClusterEndpointIndex(EndpointId endpoint, ClusterId clusterI
 // Initial configuration
 void emberAfEndpointConfigure(void)
 {
-    uint8_t ep;
+    emberEndpointCount = FIXED_ENDPOINT_COUNT;
 
 #if !defined(EMBER_SCRIPTED_TEST)
-    uint16_t fixedEndpoints[]           = FIXED_ENDPOINT_ARRAY;
-    uint16_t fixedDeviceIds[]           = FIXED_DEVICE_IDS;
-    uint8_t fixedDeviceVersions[]       = FIXED_DEVICE_VERSIONS;
-    uint8_t fixedEmberAfEndpointTypes[] = FIXED_ENDPOINT_TYPES;
-    uint8_t fixedNetworks[]             = FIXED_NETWORKS;
-#endif
-
-    emberEndpointCount = FIXED_ENDPOINT_COUNT;
-    for (ep = 0; ep < FIXED_ENDPOINT_COUNT; ep++)
+    // The fixed portion of the endpoint table is a compile-time flash image;
+    // landing it is a single copy rather than a per-field fix-up loop.
+    memcpy(emAfEndpoints, fixedEndpointTable.entries, sizeof(fixedEndpointTable.entries));
+#else
+    for (uint8_t ep = 0; ep < FIXED_ENDPOINT_COUNT; ep++)
     {
         emAfEndpoints[ep].endpoint      = endpointNumber(ep);
         emAfEndpoints[ep].deviceId      = endpointDeviceId(ep);
@@ -140,6 +230,7 @@ void emberAfEndpointConfigure(void)
         emAfEndpoints[ep].networkIndex  = endpointNetworkIndex(ep);
         emAfEndpoints[ep].bitmask       = EMBER_AF_ENDPOINT_ENABLED;
     }
+#endif
 
 #if CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT
     if (MAX_ENDPOINT_COUNT > FIXED_ENDPOINT_COUNT)
@@ -150,6 +241,9 @@ void emberAfEndpointConfigure(void)
                sizeof(EmberAfDefinedEndpoint) * (MAX_ENDPOINT_COUNT - FIXED_ENDPOINT_COUNT));
     }
 #endif
+
+    endpointIndexHashValid = false;
+    metadataStructureGeneration++;
 }
 
 void emberAfSetDynamicEndpointCount(uint16_t dynamicEndpointCount)
@@ -199,6 +293,12 @@ EmberAfStatus emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, EmberAfEn
 
     emberAfSetDynamicEndpointCount(MAX_ENDPOINT_COUNT - FIXED_ENDPOINT_COUNT);
 
+    if (endpointIndexHashValid)
+    {
+        insertEndpointIndexHash(id, index);
+    }
+    metadataStructureGeneration++;
+
     // Now enable the endpoint.
     emberAfEndpointEnableDisable(id, true);
     emberAfSetDeviceEnabled(id, true);
@@ -220,6 +320,8 @@ EndpointId emberAfClearDynamicEndpoint(uint16_t index)
             emberAfSetDeviceEnabled(ep, false);
             emberAfEndpointEnableDisable(ep, false);
             emAfEndpoints[index].endpoint = 0;
+            endpointIndexHashValid        = false;
+            metadataStructureGeneration++;
         }
     }
 
@@ -236,6 +338,11 @@ uint16_t emberAfEndpointCount(void)
     return emberEndpointCount;
 }
 
+uint32_t emberAfMetadataStructureGeneration(void)
+{
+    return metadataStructureGeneration;
+}
+
 bool emberAfEndpointIndexIsEnabled(uint16_t index)
 {
     return (emAfEndpoints[index].bitmask & EMBER_AF_ENDPOINT_ENABLED);
@@ -512,28 +619,18 @@ bool emAfMatchAttribute(EmberAfCluster * cluster, EmberAfAttributeMetadata * am,
     return (am->attributeId == attRecord->attributeId);
 }
 
-// When reading non-string attributes, this function returns an error when destination
-// buffer isn't large enough to accommodate the attribute type.  For strings, the
-// function will copy at most readLength bytes.  This means the resulting string
-// may be truncated.  The length byte(s) in the resulting string will reflect
-// any truncation.  If readLength is zero, we are working with backwards-
-// compatibility wrapper functions and we just cross our fingers and hope for
-// the best.
-//
-// When writing attributes, readLength is ignored.  For non-string attributes,
-// this function assumes the source buffer is the same size as the attribute
-// type.  For strings, the function will copy as many bytes as will fit in the
-// attribute.  This means the resulting string may be truncated.  The length
-// byte(s) in the resulting string will reflect any truncated.
-EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
-                                       uint8_t * buffer, uint16_t readLength, bool write)
+// Locates an attribute's metadata and its in-memory storage.  On success
+// populates the metadata, the storage location (meaningless for externally
+// stored attributes) and whether the attribute lives on a dynamic endpoint.
+static EmberAfStatus findAttributeLocation(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
+                                           uint8_t ** attributeLocation, bool * isDynamicEndpoint)
 {
     uint16_t attributeOffsetIndex = 0;
 
     for (uint8_t ep = 0; ep < emberAfEndpointCount(); ep++)
     {
         // Is this a dynamic endpoint?
-        bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+        bool isDynamic = (ep >= emberAfFixedEndpointCount());
 
         if (emAfEndpoints[ep].endpoint == attRecord->endpoint)
         {
@@ -554,74 +651,18 @@ EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord,
                         EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
                         if (emAfMatchAttribute(cluster, am, attRecord))
                         { // Got the attribute
-                            // If passed metadata location is not null, populate
-                            if (metadata != NULL)
-                            {
-                                *metadata = am;
-                            }
-
-                            {
-                                uint8_t * attributeLocation =
-                                    (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am)
-                                                                         : attributeData + attributeOffsetIndex);
-                                uint8_t *src, *dst;
-                                if (write)
-                                {
-                                    src = buffer;
-                                    dst = attributeLocation;
-                                    if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                             EMBER_AF_NULL_MANUFACTURER_CODE, am->attributeId))
-                                    {
-                                        return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
-                                    }
-                                }
-                                else
-                                {
-                                    if (buffer == NULL)
-                                    {
-                                        return EMBER_ZCL_STATUS_SUCCESS;
-                                    }
-
-                                    src = attributeLocation;
-                                    dst = buffer;
-                                    if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                            EMBER_AF_NULL_MANUFACTURER_CODE, am->attributeId))
-                                    {
-                                        return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
-                                    }
-                                }
-
-                                // Is the attribute externally stored?
-                                if (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE)
-                                {
-                                    return (write
-                                                ? emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                                        am, EMBER_AF_NULL_MANUFACTURER_CODE, buffer)
-                                                : emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                                       am, EMBER_AF_NULL_MANUFACTURER_CODE, buffer,
-                                                                                       emberAfAttributeSize(am)));
-                                }
-                                else
-                                {
-                                    // Internal storage is only supported for fixed endpoints
-                                    if (!isDynamicEndpoint)
-                                    {
-                                        return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
-                                    }
-                                    else
-                                    {
-                                        return EMBER_ZCL_STATUS_FAILURE;
-                                    }
-                                }
-                            }
+                            *metadata          = am;
+                            *attributeLocation = (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am)
+                                                                                      : attributeData + attributeOffsetIndex);
+                            *isDynamicEndpoint = isDynamic;
+                            return EMBER_ZCL_STATUS_SUCCESS;
                         }
-                        else
-                        { // Not the attribute we are looking for
-                            // Increase the index if attribute is not externally stored
-                            if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
-                            {
-                                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
-                            }
+
+                        // Not the attribute we are looking for
+                        // Increase the index if attribute is not externally stored
+                        if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
+                        {
+                            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
                         }
                     }
                 }
@@ -634,7 +675,7 @@ EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord,
         else
         { // Not the endpoint we are looking for
             // Dynamic endpoints are external and don't factor into storage size
-            if (!isDynamicEndpoint)
+            if (!isDynamic)
             {
                 attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[ep].endpointType->endpointSize);
             }
@@ -643,6 +684,118 @@ EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord,
     return EMBER_ZCL_STATUS_UNSUPPORTED_ATTRIBUTE; // Sorry, attribute was not found.
 }
 
+// When reading non-string attributes, this function returns an error when destination
+// buffer isn't large enough to accommodate the attribute type.  For strings, the
+// function will copy at most readLength bytes.  This means the resulting string
+// may be truncated.  The length byte(s) in the resulting string will reflect
+// any truncation.  If readLength is zero, we are working with backwards-
+// compatibility wrapper functions and we just cross our fingers and hope for
+// the best.
+//
+// When writing attributes, readLength is ignored.  For non-string attributes,
+// this function assumes the source buffer is the same size as the attribute
+// type.  For strings, the function will copy as many bytes as will fit in the
+// attribute.  This means the resulting string may be truncated.  The length
+// byte(s) in the resulting string will reflect any truncated.
+EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
+                                       uint8_t * buffer, uint16_t readLength, bool write)
+{
+    EmberAfAttributeMetadata * am;
+    uint8_t * attributeLocation;
+    bool isDynamicEndpoint;
+    EmberAfStatus status = findAttributeLocation(attRecord, &am, &attributeLocation, &isDynamicEndpoint);
+    if (status != EMBER_ZCL_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    // If passed metadata location is not null, populate
+    if (metadata != NULL)
+    {
+        *metadata = am;
+    }
+
+    uint8_t *src, *dst;
+    if (write)
+    {
+        src = buffer;
+        dst = attributeLocation;
+        if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId, EMBER_AF_NULL_MANUFACTURER_CODE,
+                                                 am->attributeId))
+        {
+            return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
+        }
+    }
+    else
+    {
+        if (buffer == NULL)
+        {
+            return EMBER_ZCL_STATUS_SUCCESS;
+        }
+
+        src = attributeLocation;
+        dst = buffer;
+        if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId, EMBER_AF_NULL_MANUFACTURER_CODE,
+                                                am->attributeId))
+        {
+            return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
+        }
+    }
+
+    // Is the attribute externally stored?
+    if (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE)
+    {
+        return (write ? emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am,
+                                                              EMBER_AF_NULL_MANUFACTURER_CODE, buffer)
+                      : emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am,
+                                                             EMBER_AF_NULL_MANUFACTURER_CODE, buffer, emberAfAttributeSize(am)));
+    }
+
+    // Internal storage is only supported for fixed endpoints
+    if (isDynamicEndpoint)
+    {
+        return EMBER_ZCL_STATUS_FAILURE;
+    }
+
+    return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
+}
+
+EmberAfStatus emAfReadAttributeDirect(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
+                                      const uint8_t ** dataPtr)
+{
+    EmberAfAttributeMetadata * am;
+    uint8_t * attributeLocation;
+    bool isDynamicEndpoint;
+    EmberAfStatus status = findAttributeLocation(attRecord, &am, &attributeLocation, &isDynamicEndpoint);
+    if (status != EMBER_ZCL_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    if (metadata != NULL)
+    {
+        *metadata = am;
+    }
+
+    if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId, EMBER_AF_NULL_MANUFACTURER_CODE,
+                                            am->attributeId))
+    {
+        return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
+    }
+
+    // Externally stored attributes and attributes on dynamic endpoints have no
+    // live in-memory value; the caller must materialize those through
+    // emAfReadOrWriteAttribute instead.
+    if ((am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) || isDynamicEndpoint)
+    {
+        *dataPtr = NULL;
+        return EMBER_ZCL_STATUS_SUCCESS;
+    }
+
+    *dataPtr = attributeLocation;
+    return EMBER_ZCL_STATUS_SUCCESS;
+}
+
 EmberAfCluster * emberAfFindClusterInTypeWithMfgCode(EmberAfEndpointType * endpointType, ClusterId clusterId,
                                                      EmberAfClusterMask mask, uint16_t manufacturerCode, uint8_t * index)
 {
@@ -719,6 +872,51 @@ uint8_t emberAfClusterIndex(EndpointId endpoint, ClusterId clusterId, EmberAfClu
     return 0xFF;
 }
 
+// Maps an (endpoint, server cluster) pair to its data version slot, or returns
+// NULL if the pair does not name an existing server cluster.
+static chip::DataVersion * dataVersionSlot(EndpointId endpoint, ClusterId clusterId)
+{
+    uint16_t ep = emberAfIndexFromEndpoint(endpoint);
+    if (ep == 0xFFFF)
+    {
+        return NULL;
+    }
+    uint8_t clusterIndex = emberAfClusterIndex(endpoint, clusterId, CLUSTER_MASK_SERVER);
+    if (clusterIndex == 0xFF)
+    {
+        return NULL;
+    }
+    if (clusterIndex >= EMBER_AF_DATA_VERSION_SLOTS_PER_ENDPOINT)
+    {
+        clusterIndex = EMBER_AF_DATA_VERSION_SLOTS_PER_ENDPOINT - 1;
+    }
+    return &sClusterDataVersions[ep][clusterIndex];
+}
+
+chip::DataVersion emberAfDataVersion(EndpointId endpoint, ClusterId clusterId)
+{
+    chip::DataVersion * version = dataVersionSlot(endpoint, clusterId);
+    return (version == NULL) ? 0 : *version;
+}
+
+void emberAfDataVersionIncrement(EndpointId endpoint, ClusterId clusterId)
+{
+    // Bump the store generation even if the cluster has no version slot:
+    // attribute data changed either way.
+    sAttributeStoreGeneration++;
+
+    chip::DataVersion * version = dataVersionSlot(endpoint, clusterId);
+    if (version != NULL)
+    {
+        (*version)++;
+    }
+}
+
+uint32_t emberAfAttributeStoreGeneration(void)
+{
+    return sAttributeStoreGeneration;
+}
+
 // Returns true uf endpoint contains passed cluster
 bool emberAfContainsClusterWithMfgCode(EndpointId endpoint, ClusterId clusterId, uint16_t manufacturerCode)
 {
@@ -902,14 +1100,24 @@ static uint16_t findClusterEndpointIndex(EndpointId endpoint, ClusterId clusterI
 
 static uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints)
 {
-    uint16_t epi;
-    for (epi = 0; epi < emberAfEndpointCount(); epi++)
+    if (!endpointIndexHashValid)
     {
-        if (emAfEndpoints[epi].endpoint == endpoint &&
-            (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask & EMBER_AF_ENDPOINT_ENABLED))
+        rebuildEndpointIndexHash();
+    }
+    uint16_t slot = endpointIndexHashSlot(endpoint);
+    while (endpointIndexHash[slot] != kEndpointIndexEmpty)
+    {
+        uint16_t epi = endpointIndexHash[slot];
+        if (epi < emberAfEndpointCount() && emAfEndpoints[epi].endpoint == endpoint)
         {
-            return epi;
+            if (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask & EMBER_AF_ENDPOINT_ENABLED)
+            {
+                return epi;
+            }
+            // Endpoint ids are unique, so a disabled match means there is no enabled one.
+            return 0xFFFF;
         }
+        slot = static_cast<uint16_t>((slot + 1) % kEndpointIndexHashSize);
     }
     return 0xFFFF;
 }
@@ -957,6 +1165,7 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
 
     if (currentlyEnabled != enable)
     {
+        metadataStructureGeneration++;
         if (enable)
         {
             initializeEndpoint(&(emAfEndpoints[index]));
@@ -1014,9 +1223,14 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
             }
         }
 
-        // TODO: We should notify about the fact that all the attributes for
-        // this endpoint have appeared/disappeared, but the reporting engine has
-        // no way to do that right now.
+        if (enable)
+        {
+            // Report the newly visible endpoint as one targeted unit of work:
+            // every path on it is marked dirty, so a wildcard subscriber is
+            // sent just this endpoint's data instead of being forced into a
+            // full re-sync of unrelated endpoints.
+            MatterReportingAttributeChangeCallback(endpoint);
+        }
 
         // TODO: Once endpoints are in parts lists other than that of endpoint
         // 0, something more complicated might need to happen here.
@@ -124,6 +124,15 @@ void emberAfEndpointConfigure(void);
 EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
                                        uint8_t * buffer, uint16_t readLength, bool write);
 
+// Locates an attribute for a zero-copy read.  On success, dataPtr points at
+// the attribute's live in-memory value, or is set to NULL when the value can
+// only be obtained through emAfReadOrWriteAttribute (externally stored
+// attributes and attributes on dynamic endpoints).  The caller must not write
+// through the returned pointer and must consume it before the attribute can
+// next change.
+EmberAfStatus emAfReadAttributeDirect(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
+                                      const uint8_t ** dataPtr);
+
 bool emAfMatchCluster(EmberAfCluster * cluster, EmberAfAttributeSearchRecord * attRecord);
 bool emAfMatchAttribute(EmberAfCluster * cluster, EmberAfAttributeMetadata * am, EmberAfAttributeSearchRecord * attRecord);
 
@@ -164,6 +173,36 @@ uint8_t emberAfClusterIndexInMatchingEndpoints(chip::EndpointId endpoint, chip::
 //
 uint8_t emberAfClusterIndex(chip::EndpointId endpoint, chip::ClusterId clusterId, EmberAfClusterMask mask);
 
+// Number of per-endpoint data version slots.  Each server cluster on an endpoint
+// gets its own slot up to this count; clusters beyond it share the last slot,
+// which is conservative: a shared slot can only cause an unnecessary report,
+// never suppress a changed one.
+#ifndef EMBER_AF_DATA_VERSION_SLOTS_PER_ENDPOINT
+#define EMBER_AF_DATA_VERSION_SLOTS_PER_ENDPOINT 8
+#endif
+
+//
+// Returns the current data version of the given server cluster, used to populate
+// AttributeDataIBs in reports and to evaluate client DataVersionFilterIBs.
+// Returns 0 if the endpoint or cluster does not exist.
+//
+chip::DataVersion emberAfDataVersion(chip::EndpointId endpoint, chip::ClusterId clusterId);
+
+//
+// Bumps the data version of the given server cluster.  Called whenever an
+// attribute in the cluster changes; no-op if the endpoint or cluster does not
+// exist.
+//
+void emberAfDataVersionIncrement(chip::EndpointId endpoint, chip::ClusterId clusterId);
+
+//
+// Returns a global generation counter that advances on every attribute data
+// mutation (every data version bump).  A reader that may interleave with
+// application callbacks can compare the generation before and after a read to
+// detect that it observed a torn snapshot.
+//
+uint32_t emberAfAttributeStoreGeneration(void);
+
 // If server == true, returns the number of server clusters,
 // otherwise number of client clusters on this endpoint
 uint8_t emberAfClusterCount(chip::EndpointId endpoint, bool server);
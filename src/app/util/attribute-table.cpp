@@ -52,6 +52,7 @@
 #include <app/util/error-mapping.h>
 #include <app/util/odd-sized-integers.h>
 
+#include <app/InteractionModelEngine.h>
 #include <app/reporting/reporting.h>
 #include <protocols/interaction_model/Constants.h>
 
@@ -113,6 +114,136 @@ EmberAfStatus emberAfWriteServerAttribute(EndpointId endpoint, ClusterId cluster
                               false); // just test?
 }
 
+#if CHIP_CONFIG_ATTRIBUTE_WRITE_COALESCING_POOL_SIZE > 0
+
+namespace {
+
+// Latest-value slot for a coalesced server attribute write.  Only fixed-size scalar
+// values that fit the inline buffer are coalesced; everything else writes through.
+struct CoalescedAttributeWrite
+{
+    EndpointId endpoint;
+    ClusterId cluster;
+    AttributeId attributeId;
+    EmberAfAttributeType dataType;
+    uint8_t value[8];
+    uint8_t size;
+    bool inUse;
+};
+
+CoalescedAttributeWrite sCoalescedWrites[CHIP_CONFIG_ATTRIBUTE_WRITE_COALESCING_POOL_SIZE];
+bool sCoalescedFlushScheduled = false;
+
+chip::System::Layer * GetCoalescingSystemLayer()
+{
+    auto * exchangeManager = chip::app::InteractionModelEngine::GetInstance()->GetExchangeManager();
+    VerifyOrReturnError(exchangeManager != nullptr, nullptr);
+    auto * sessionManager = exchangeManager->GetSessionManager();
+    VerifyOrReturnError(sessionManager != nullptr, nullptr);
+    return sessionManager->SystemLayer();
+}
+
+void CoalescedFlushTimerHandler(chip::System::Layer * layer, void * context)
+{
+    sCoalescedFlushScheduled = false;
+    emAfFlushCoalescedAttributeWrites();
+}
+
+bool ScheduleCoalescedFlush()
+{
+    if (sCoalescedFlushScheduled)
+    {
+        return true;
+    }
+    chip::System::Layer * systemLayer = GetCoalescingSystemLayer();
+    VerifyOrReturnError(systemLayer != nullptr, false);
+    CHIP_ERROR err =
+        systemLayer->StartTimer(chip::System::Clock::Milliseconds32(CHIP_CONFIG_ATTRIBUTE_WRITE_COALESCING_FLUSH_INTERVAL_MS),
+                                CoalescedFlushTimerHandler, nullptr);
+    sCoalescedFlushScheduled = (err == CHIP_NO_ERROR);
+    return sCoalescedFlushScheduled;
+}
+
+} // namespace
+
+EmberAfStatus emberAfWriteServerAttributeCoalesced(EndpointId endpoint, ClusterId cluster, AttributeId attributeID,
+                                                   uint8_t * dataPtr, EmberAfAttributeType dataType)
+{
+    const uint8_t size = emberAfGetDataSize(dataType);
+
+    CoalescedAttributeWrite * match    = nullptr;
+    CoalescedAttributeWrite * freeSlot = nullptr;
+    for (auto & entry : sCoalescedWrites)
+    {
+        if (entry.inUse && entry.endpoint == endpoint && entry.cluster == cluster && entry.attributeId == attributeID)
+        {
+            match = &entry;
+            break;
+        }
+        if (freeSlot == nullptr && !entry.inUse)
+        {
+            freeSlot = &entry;
+        }
+    }
+
+    // Only fixed-size scalars that fit a slot can be coalesced, and subscribers with a
+    // zero minimum interval expect every change promptly.
+    const bool coalescable = size != 0 && size <= sizeof(sCoalescedWrites[0].value) &&
+        !chip::app::InteractionModelEngine::GetInstance()->PathRequiresImmediateDelivery(
+            chip::app::ConcreteAttributePath(endpoint, cluster, attributeID));
+
+    CoalescedAttributeWrite * slot = (match != nullptr) ? match : freeSlot;
+    if (!coalescable || slot == nullptr || !ScheduleCoalescedFlush())
+    {
+        // Write through; drop any older pending value so a later flush cannot undo this write.
+        if (match != nullptr)
+        {
+            match->inUse = false;
+        }
+        return emberAfWriteServerAttribute(endpoint, cluster, attributeID, dataPtr, dataType);
+    }
+
+    slot->inUse       = true;
+    slot->endpoint    = endpoint;
+    slot->cluster     = cluster;
+    slot->attributeId = attributeID;
+    slot->dataType    = dataType;
+    slot->size        = size;
+    memcpy(slot->value, dataPtr, size);
+    return EMBER_ZCL_STATUS_SUCCESS;
+}
+
+void emAfFlushCoalescedAttributeWrites(void)
+{
+    for (auto & entry : sCoalescedWrites)
+    {
+        if (!entry.inUse)
+        {
+            continue;
+        }
+        entry.inUse          = false;
+        EmberAfStatus status = emberAfWriteServerAttribute(entry.endpoint, entry.cluster, entry.attributeId, entry.value,
+                                                           entry.dataType);
+        if (status != EMBER_ZCL_STATUS_SUCCESS)
+        {
+            ChipLogError(Zcl, "Coalesced write of attribute " ChipLogFormatMEI "/" ChipLogFormatMEI " on endpoint %u failed: 0x%x",
+                         ChipLogValueMEI(entry.cluster), ChipLogValueMEI(entry.attributeId), entry.endpoint, status);
+        }
+    }
+}
+
+#else // CHIP_CONFIG_ATTRIBUTE_WRITE_COALESCING_POOL_SIZE > 0
+
+EmberAfStatus emberAfWriteServerAttributeCoalesced(EndpointId endpoint, ClusterId cluster, AttributeId attributeID,
+                                                   uint8_t * dataPtr, EmberAfAttributeType dataType)
+{
+    return emberAfWriteServerAttribute(endpoint, cluster, attributeID, dataPtr, dataType);
+}
+
+void emAfFlushCoalescedAttributeWrites(void) {}
+
+#endif // CHIP_CONFIG_ATTRIBUTE_WRITE_COALESCING_POOL_SIZE > 0
+
 EmberAfStatus emberAfWriteManufacturerSpecificClientAttribute(EndpointId endpoint, ClusterId cluster, AttributeId attributeID,
                                                               uint16_t manufacturerCode, uint8_t * dataPtr,
                                                               EmberAfAttributeType dataType)
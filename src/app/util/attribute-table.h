@@ -61,6 +61,22 @@ bool emberAfReadSequentialAttributesAddToResponse(chip::EndpointId endpoint, chi
                                                   chip::AttributeId startAttributeId, uint8_t mask, uint16_t manufacturerCode,
                                                   uint8_t maxAttributeIds, bool includeAccessControl);
 
+// Coalescing variant of emberAfWriteServerAttribute for high-rate writers such as bridges
+// translating downstream device reports.  The latest value for each attribute path is held in
+// a slot and flushed to the attribute store (triggering storage callbacks, change listeners
+// and reporting) at most once per CHIP_CONFIG_ATTRIBUTE_WRITE_COALESCING_FLUSH_INTERVAL_MS,
+// so a chatty device costs one store write per flush interval instead of one per report.
+// Writes bypass coalescing and take effect immediately when the value is not a fixed-size
+// scalar, when no slot is free, or when an active subscription with a zero minimum interval
+// covers the path (such subscribers expect every change promptly).
+EmberAfStatus emberAfWriteServerAttributeCoalesced(chip::EndpointId endpoint, chip::ClusterId cluster,
+                                                   chip::AttributeId attributeID, uint8_t * dataPtr,
+                                                   EmberAfAttributeType dataType);
+
+// Write all pending coalesced attribute values to the attribute store now.  Called from the
+// flush timer; also available to applications that must synchronize (e.g. before shutdown).
+void emAfFlushCoalescedAttributeWrites(void);
+
 EmberAfStatus emAfWriteAttribute(chip::EndpointId endpoint, chip::ClusterId cluster, chip::AttributeId attributeID, uint8_t mask,
                                  uint16_t manufacturerCode, uint8_t * data, EmberAfAttributeType dataType,
                                  bool overrideReadOnlyAndDataType, bool justTest);
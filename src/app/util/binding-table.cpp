@@ -24,6 +24,61 @@
 
 static EmberBindingTableEntry bindingTable[EMBER_BINDING_TABLE_SIZE];
 
+namespace {
+
+// Per-(local endpoint, cluster) bucket index over the binding table. Each
+// in-use entry is chained from the bucket for its (local, clusterId) pair, so
+// fan-out consumers can walk only the matching entries. The index is rebuilt
+// on writes, which are rare compared to bound-cluster notifications.
+struct BindingBucket
+{
+    chip::EndpointId local;
+    chip::ClusterId clusterId;
+    uint8_t head;
+};
+
+// There can be at most as many distinct (endpoint, cluster) pairs as entries.
+BindingBucket sBuckets[EMBER_BINDING_TABLE_SIZE];
+uint8_t sBucketCount = 0;
+uint8_t sNextMatch[EMBER_BINDING_TABLE_SIZE];
+
+void rebuildClusterIndex()
+{
+    sBucketCount = 0;
+    // Walk the table backwards so each bucket chain comes out in ascending
+    // index order, preserving the delivery order of the old full-table scan.
+    for (uint8_t offset = EMBER_BINDING_TABLE_SIZE; offset > 0; offset--)
+    {
+        uint8_t i = static_cast<uint8_t>(offset - 1);
+        if (bindingTable[i].type == EMBER_UNUSED_BINDING)
+        {
+            continue;
+        }
+
+        uint8_t bucket = sBucketCount;
+        for (uint8_t b = 0; b < sBucketCount; b++)
+        {
+            if (sBuckets[b].local == bindingTable[i].local && sBuckets[b].clusterId == bindingTable[i].clusterId)
+            {
+                bucket = b;
+                break;
+            }
+        }
+        if (bucket == sBucketCount)
+        {
+            sBuckets[bucket].local     = bindingTable[i].local;
+            sBuckets[bucket].clusterId = bindingTable[i].clusterId;
+            sBuckets[bucket].head      = EMBER_NULL_BINDING_INDEX;
+            sBucketCount++;
+        }
+
+        sNextMatch[i]        = sBuckets[bucket].head;
+        sBuckets[bucket].head = i;
+    }
+}
+
+} // unnamed namespace
+
 EmberStatus emberGetBinding(uint8_t index, EmberBindingTableEntry * result)
 {
     if (index >= EMBER_BINDING_TABLE_SIZE)
@@ -43,6 +98,7 @@ EmberStatus emberSetBinding(uint8_t index, EmberBindingTableEntry * result)
     }
 
     bindingTable[index] = *result;
+    rebuildClusterIndex();
     return EMBER_SUCCESS;
 }
 
@@ -54,5 +110,27 @@ EmberStatus emberDeleteBinding(uint8_t index)
     }
 
     bindingTable[index].type = EMBER_UNUSED_BINDING;
+    rebuildClusterIndex();
     return EMBER_SUCCESS;
 }
+
+uint8_t emberBindingTableFirstMatch(chip::EndpointId localEndpoint, chip::ClusterId clusterId)
+{
+    for (uint8_t b = 0; b < sBucketCount; b++)
+    {
+        if (sBuckets[b].local == localEndpoint && sBuckets[b].clusterId == clusterId)
+        {
+            return sBuckets[b].head;
+        }
+    }
+    return EMBER_NULL_BINDING_INDEX;
+}
+
+uint8_t emberBindingTableNextMatch(uint8_t index)
+{
+    if (index >= EMBER_BINDING_TABLE_SIZE)
+    {
+        return EMBER_NULL_BINDING_INDEX;
+    }
+    return sNextMatch[index];
+}
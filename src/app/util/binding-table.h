@@ -26,8 +26,23 @@
 // Should this be configurable by the app somehow?
 #define BINDING_TABLE_SIZE 10
 
+// Sentinel returned by the cluster-index iteration functions when there are
+// no (more) matching bindings.
+#define EMBER_NULL_BINDING_INDEX 0xFF
+
 EmberStatus emberGetBinding(uint8_t index, EmberBindingTableEntry * result);
 
 EmberStatus emberSetBinding(uint8_t index, EmberBindingTableEntry * result);
 
 EmberStatus emberDeleteBinding(uint8_t index);
+
+// Returns the index of the first in-use binding whose local endpoint and
+// cluster match, or EMBER_NULL_BINDING_INDEX if there is none. The index is
+// maintained on emberSetBinding/emberDeleteBinding, so fan-out enumeration
+// touches only the matching entries instead of scanning the whole table.
+uint8_t emberBindingTableFirstMatch(chip::EndpointId localEndpoint, chip::ClusterId clusterId);
+
+// Returns the index of the next binding matching the same (local endpoint,
+// cluster) as the one at index, or EMBER_NULL_BINDING_INDEX when exhausted.
+// Matches are returned in ascending table order.
+uint8_t emberBindingTableNextMatch(uint8_t index);
@@ -30,6 +30,7 @@
 #include <app/util/af.h>
 #include <app/util/attribute-storage-null-handling.h>
 #include <app/util/attribute-storage.h>
+#include <app/util/DataModelHandler.h>
 #include <app/util/attribute-table.h>
 #include <app/util/ember-compatibility-functions.h>
 #include <app/util/error-mapping.h>
@@ -58,7 +59,6 @@ namespace chip {
 namespace app {
 namespace Compatibility {
 namespace {
-constexpr uint32_t kTemporaryDataVersion = 0;
 // On some apps, ATTRIBUTE_LARGEST can as small as 3, making compiler unhappy since data[kAttributeReadBufferSize] cannot hold
 // uint64_t. Make kAttributeReadBufferSize at least 8 so it can fit all basic types.
 constexpr size_t kAttributeReadBufferSize = (ATTRIBUTE_LARGEST >= 8 ? ATTRIBUTE_LARGEST : 8);
@@ -212,11 +212,105 @@ namespace {
 // Common buffer for ReadSingleClusterData & WriteSingleClusterData
 uint8_t attributeData[kAttributeReadBufferSize];
 
+#if CHIP_IM_MAX_NUM_CAPTURED_ATTRIBUTE_VALUES > 0
+
+// Attribute values captured when the change was reported.  The write path
+// hands MatterReportingAttributeChangeCallback the raw new value; storing it
+// here lets report generation encode externally stored attributes without
+// re-invoking the application's read callback, so each change is read once
+// and the reported value is exactly the one that made the path dirty.
+constexpr size_t kCapturedAttributeValueSize = 8;
+
+struct CapturedAttributeValue
+{
+    ConcreteAttributePath path;
+    EmberAfAttributeType type;
+    uint8_t size;
+    bool inUse = false;
+    uint8_t value[kCapturedAttributeValueSize];
+};
+
+CapturedAttributeValue sCapturedAttributeValues[CHIP_IM_MAX_NUM_CAPTURED_ATTRIBUTE_VALUES];
+
+CapturedAttributeValue * FindCapturedAttributeValue(const ConcreteAttributePath & path)
+{
+    for (auto & entry : sCapturedAttributeValues)
+    {
+        if (entry.inUse && entry.path == path)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void InvalidateCapturedAttributeValue(const ConcreteAttributePath & path)
+{
+    CapturedAttributeValue * entry = FindCapturedAttributeValue(path);
+    if (entry != nullptr)
+    {
+        entry->inUse = false;
+    }
+}
+
+void InvalidateCapturedAttributeValuesForEndpoint(EndpointId endpoint)
+{
+    for (auto & entry : sCapturedAttributeValues)
+    {
+        if (entry.inUse && entry.path.mEndpointId == endpoint)
+        {
+            entry.inUse = false;
+        }
+    }
+}
+
+void CaptureAttributeValue(const ConcreteAttributePath & path, EmberAfAttributeType type, const uint8_t * data)
+{
+    CapturedAttributeValue * entry = FindCapturedAttributeValue(path);
+
+    uint8_t size = emberAfGetDataSize(type);
+    if (data == nullptr || size == 0 || size > kCapturedAttributeValueSize)
+    {
+        // Variable-size or unknown value; drop any stale capture so the report
+        // falls back to reading the attribute store.
+        if (entry != nullptr)
+        {
+            entry->inUse = false;
+        }
+        return;
+    }
+
+    if (entry == nullptr)
+    {
+        for (auto & candidate : sCapturedAttributeValues)
+        {
+            if (!candidate.inUse)
+            {
+                entry = &candidate;
+                break;
+            }
+        }
+        if (entry == nullptr)
+        {
+            // Pool exhausted; reports for this path re-read the store as before.
+            return;
+        }
+    }
+
+    entry->path = path;
+    entry->type = type;
+    entry->size = size;
+    memcpy(entry->value, data, size);
+    entry->inUse = true;
+}
+
+#endif // CHIP_IM_MAX_NUM_CAPTURED_ATTRIBUTE_VALUES > 0
+
 template <typename T>
-CHIP_ERROR attributeBufferToNumericTlvData(TLV::TLVWriter & writer, bool isNullable)
+CHIP_ERROR attributeBufferToNumericTlvData(TLV::TLVWriter & writer, const uint8_t * data, bool isNullable)
 {
     typename NumericAttributeTraits<T>::StorageType value;
-    memcpy(&value, attributeData, sizeof(value));
+    memcpy(&value, data, sizeof(value));
     TLV::Tag tag = TLV::ContextTag(to_underlying(AttributeDataIB::Tag::kData));
     if (isNullable && NumericAttributeTraits<T>::IsNullValue(value))
     {
@@ -235,6 +329,9 @@ CHIP_ERROR attributeBufferToNumericTlvData(TLV::TLVWriter & writer, bool isNulla
 
 bool ServerClusterCommandExists(const ConcreteCommandPath & aCommandPath)
 {
+    // First cluster access may arrive before a deferred data model init ran.
+    EnsureDataModelInitialized();
+
     // TODO: Currently, we are using cluster catalog from the ember library, this should be modified or replaced after several
     // updates to Commands.
     return emberAfContainsServer(aCommandPath.mEndpointId, aCommandPath.mClusterId);
@@ -334,7 +431,8 @@ CHIP_ERROR ReadViaAccessInterface(FabricIndex aAccessingFabricIndex, const Concr
     // into status responses, unless our caller already does that.
     AttributeValueEncoder::AttributeEncodeState state =
         (aEncoderState == nullptr ? AttributeValueEncoder::AttributeEncodeState() : *aEncoderState);
-    AttributeValueEncoder valueEncoder(aAttributeReports, aAccessingFabricIndex, aPath, kTemporaryDataVersion, state);
+    AttributeValueEncoder valueEncoder(aAttributeReports, aAccessingFabricIndex, aPath,
+                                       emberAfDataVersion(aPath.mEndpointId, aPath.mClusterId), state);
     CHIP_ERROR err = aAccessInterface->Read(aPath, valueEncoder);
 
     if (err != CHIP_NO_ERROR)
@@ -358,6 +456,9 @@ CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, c
                                  AttributeReportIBs::Builder & aAttributeReports,
                                  AttributeValueEncoder::AttributeEncodeState * apEncoderState)
 {
+    // First cluster access may arrive before a deferred data model init ran.
+    EnsureDataModelInitialized();
+
     ChipLogDetail(DataManagement,
                   "Reading attribute: Cluster=" ChipLogFormatMEI " Endpoint=%" PRIx16 " AttributeId=" ChipLogFormatMEI
                   " (expanded=%d)",
@@ -380,6 +481,46 @@ CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, c
         // (which we know will fail and error out);
     }
 
+    bool accessChecked = false;
+
+    // AttributeAccessInterface-first fast path: a cluster that registered
+    // native TLV handlers serves reads without the ember metadata lookup or
+    // the Compatibility-buffer re-marshaling below. This also covers
+    // attributes that exist only on the access interface (e.g. bridged
+    // endpoints) and have no ember storage at all.
+    //
+    // The value encoder will encode the whole AttributeReport, including the path, value and the version.
+    // The AttributeValueEncoder may encode more than one AttributeReportIB for the list chunking feature.
+    if (auto * attrOverride = findAttributeAccessOverride(aPath.mEndpointId, aPath.mClusterId))
+    {
+        Access::RequestPath requestPath{ .cluster = aPath.mClusterId, .endpoint = aPath.mEndpointId };
+        Access::Privilege requestPrivilege = Access::Privilege::kView; // TODO: get actual request privilege
+        CHIP_ERROR err                     = Access::GetAccessControl().Check(aSubjectDescriptor, requestPath, requestPrivilege);
+        err                                = CHIP_NO_ERROR; // TODO: remove override
+        if (err != CHIP_NO_ERROR)
+        {
+            ReturnErrorCodeIf(err != CHIP_ERROR_ACCESS_DENIED, err);
+            if (aPath.mExpanded)
+            {
+                return CHIP_NO_ERROR;
+            }
+
+            AttributeReportIB::Builder & attributeReport = aAttributeReports.CreateAttributeReport();
+            ReturnErrorOnFailure(aAttributeReports.GetError());
+            return SendFailureStatus(aPath, attributeReport, Protocols::InteractionModel::Status::UnsupportedAccess, nullptr);
+        }
+        accessChecked = true;
+
+        bool triedEncode;
+        ReturnErrorOnFailure(ReadViaAccessInterface(aSubjectDescriptor.fabricIndex, aPath, aAttributeReports, apEncoderState,
+                                                    attrOverride, &triedEncode));
+
+        if (triedEncode)
+        {
+            return CHIP_NO_ERROR;
+        }
+    }
+
     EmberAfAttributeMetadata * attributeMetadata =
         emberAfLocateAttributeMetadata(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId, CLUSTER_MASK_SERVER, 0);
 
@@ -392,6 +533,7 @@ CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, c
         return SendFailureStatus(aPath, attributeReport, Protocols::InteractionModel::Status::UnsupportedAttribute, nullptr);
     }
 
+    if (!accessChecked)
     {
         Access::RequestPath requestPath{ .cluster = aPath.mClusterId, .endpoint = aPath.mEndpointId };
         Access::Privilege requestPrivilege = Access::Privilege::kView; // TODO: get actual request privilege
@@ -413,20 +555,6 @@ CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, c
         }
     }
 
-    // Value encoder will encode the whole AttributeReport, including the path, value and the version.
-    // The AttributeValueEncoder may encode more than one AttributeReportIB for the list chunking feature.
-    if (auto * attrOverride = findAttributeAccessOverride(aPath.mEndpointId, aPath.mClusterId))
-    {
-        bool triedEncode;
-        ReturnErrorOnFailure(ReadViaAccessInterface(aSubjectDescriptor.fabricIndex, aPath, aAttributeReports, apEncoderState,
-                                                    attrOverride, &triedEncode));
-
-        if (triedEncode)
-        {
-            return CHIP_NO_ERROR;
-        }
-    }
-
     AttributeReportIB::Builder & attributeReport = aAttributeReports.CreateAttributeReport();
     ReturnErrorOnFailure(aAttributeReports.GetError());
 
@@ -437,7 +565,7 @@ CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, c
     AttributeDataIB::Builder & attributeDataIBBuilder = attributeReport.CreateAttributeData();
     ReturnErrorOnFailure(attributeDataIBBuilder.GetError());
 
-    attributeDataIBBuilder.DataVersion(kTemporaryDataVersion);
+    attributeDataIBBuilder.DataVersion(emberAfDataVersion(aPath.mEndpointId, aPath.mClusterId));
     ReturnErrorOnFailure(attributeDataIBBuilder.GetError());
 
     AttributePathIB::Builder & attributePathIBBuilder = attributeDataIBBuilder.CreatePath();
@@ -450,13 +578,38 @@ CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, c
     ReturnErrorOnFailure(attributePathIBBuilder.GetError());
 
     EmberAfAttributeSearchRecord record;
-    record.endpoint           = aPath.mEndpointId;
-    record.clusterId          = aPath.mClusterId;
-    record.clusterMask        = CLUSTER_MASK_SERVER;
-    record.attributeId        = aPath.mAttributeId;
-    record.manufacturerCode   = EMBER_AF_NULL_MANUFACTURER_CODE;
-    EmberAfStatus emberStatus = emAfReadOrWriteAttribute(&record, &attributeMetadata, attributeData, sizeof(attributeData),
-                                                         /* write = */ false);
+    record.endpoint         = aPath.mEndpointId;
+    record.clusterId        = aPath.mClusterId;
+    record.clusterMask      = CLUSTER_MASK_SERVER;
+    record.attributeId      = aPath.mAttributeId;
+    record.manufacturerCode = EMBER_AF_NULL_MANUFACTURER_CODE;
+
+    // Zero-copy fast path: internally stored attributes are encoded straight
+    // from their live storage into the report writer (which is positioned in
+    // the outgoing packet buffer).  Externally stored attributes and dynamic
+    // endpoints must still be materialized into the scratch buffer first.
+    const uint8_t * data      = nullptr;
+    EmberAfStatus emberStatus = emAfReadAttributeDirect(&record, &attributeMetadata, &data);
+    if (emberStatus == EMBER_ZCL_STATUS_SUCCESS && data == nullptr)
+    {
+#if CHIP_IM_MAX_NUM_CAPTURED_ATTRIBUTE_VALUES > 0
+        // Externally stored attribute: prefer the value captured when the change
+        // was reported, so the application's read callback is not re-invoked for
+        // every reporting cycle and the reported value is the one that made the
+        // path dirty.
+        const CapturedAttributeValue * captured = FindCapturedAttributeValue(aPath);
+        if (captured != nullptr && captured->type == attributeMetadata->attributeType)
+        {
+            data = captured->value;
+        }
+#endif
+        if (data == nullptr)
+        {
+            emberStatus = emAfReadOrWriteAttribute(&record, &attributeMetadata, attributeData, sizeof(attributeData),
+                                                   /* write = */ false);
+            data        = attributeData;
+        }
+    }
 
     if (emberStatus == EMBER_ZCL_STATUS_SUCCESS)
     {
@@ -471,108 +624,108 @@ CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, c
             ReturnErrorOnFailure(writer->PutNull(tag));
             break;
         case ZCL_BOOLEAN_ATTRIBUTE_TYPE: // Boolean
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<bool>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<bool>(*writer, data, isNullable));
             break;
         case ZCL_INT8U_ATTRIBUTE_TYPE: // Unsigned 8-bit integer
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<uint8_t>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<uint8_t>(*writer, data, isNullable));
             break;
         case ZCL_INT16U_ATTRIBUTE_TYPE: // Unsigned 16-bit integer
         {
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<uint16_t>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<uint16_t>(*writer, data, isNullable));
             break;
         }
         case ZCL_INT24U_ATTRIBUTE_TYPE: // Unsigned 24-bit integer
         {
             using IntType = OddSizedInteger<3, false>;
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<IntType>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<IntType>(*writer, data, isNullable));
             break;
         }
         case ZCL_INT32U_ATTRIBUTE_TYPE: // Unsigned 32-bit integer
         {
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<uint32_t>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<uint32_t>(*writer, data, isNullable));
             break;
         }
         case ZCL_INT40U_ATTRIBUTE_TYPE: // Unsigned 40-bit integer
         {
             using IntType = OddSizedInteger<5, false>;
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<IntType>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<IntType>(*writer, data, isNullable));
             break;
         }
         case ZCL_INT48U_ATTRIBUTE_TYPE: // Unsigned 48-bit integer
         {
             using IntType = OddSizedInteger<6, false>;
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<IntType>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<IntType>(*writer, data, isNullable));
             break;
         }
         case ZCL_INT56U_ATTRIBUTE_TYPE: // Unsigned 56-bit integer
         {
             using IntType = OddSizedInteger<7, false>;
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<IntType>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<IntType>(*writer, data, isNullable));
             break;
         }
         case ZCL_INT64U_ATTRIBUTE_TYPE: // Unsigned 64-bit integer
         {
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<uint64_t>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<uint64_t>(*writer, data, isNullable));
             break;
         }
         case ZCL_INT8S_ATTRIBUTE_TYPE: // Signed 8-bit integer
         {
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<int8_t>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<int8_t>(*writer, data, isNullable));
             break;
         }
         case ZCL_INT16S_ATTRIBUTE_TYPE: // Signed 16-bit integer
         {
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<int16_t>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<int16_t>(*writer, data, isNullable));
             break;
         }
         case ZCL_INT24S_ATTRIBUTE_TYPE: // Signed 24-bit integer
         {
             using IntType = OddSizedInteger<3, true>;
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<IntType>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<IntType>(*writer, data, isNullable));
             break;
         }
         case ZCL_INT32S_ATTRIBUTE_TYPE: // Signed 32-bit integer
         {
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<int32_t>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<int32_t>(*writer, data, isNullable));
             break;
         }
         case ZCL_INT40S_ATTRIBUTE_TYPE: // Signed 40-bit integer
         {
             using IntType = OddSizedInteger<5, true>;
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<IntType>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<IntType>(*writer, data, isNullable));
             break;
         }
         case ZCL_INT48S_ATTRIBUTE_TYPE: // Signed 48-bit integer
         {
             using IntType = OddSizedInteger<6, true>;
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<IntType>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<IntType>(*writer, data, isNullable));
             break;
         }
         case ZCL_INT56S_ATTRIBUTE_TYPE: // Signed 56-bit integer
         {
             using IntType = OddSizedInteger<7, true>;
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<IntType>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<IntType>(*writer, data, isNullable));
             break;
         }
         case ZCL_INT64S_ATTRIBUTE_TYPE: // Signed 64-bit integer
         {
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<int64_t>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<int64_t>(*writer, data, isNullable));
             break;
         }
         case ZCL_SINGLE_ATTRIBUTE_TYPE: // 32-bit float
         {
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<float>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<float>(*writer, data, isNullable));
             break;
         }
         case ZCL_DOUBLE_ATTRIBUTE_TYPE: // 64-bit float
         {
-            ReturnErrorOnFailure(attributeBufferToNumericTlvData<double>(*writer, isNullable));
+            ReturnErrorOnFailure(attributeBufferToNumericTlvData<double>(*writer, data, isNullable));
             break;
         }
         case ZCL_CHAR_STRING_ATTRIBUTE_TYPE: // Char string
         {
-            char * actualData  = reinterpret_cast<char *>(attributeData + 1);
-            uint8_t dataLength = attributeData[0];
+            const char * actualData = reinterpret_cast<const char *>(data + 1);
+            uint8_t dataLength      = data[0];
             if (dataLength == 0xFF)
             {
                 if (isNullable)
@@ -591,9 +744,9 @@ CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, c
             break;
         }
         case ZCL_LONG_CHAR_STRING_ATTRIBUTE_TYPE: {
-            char * actualData = reinterpret_cast<char *>(attributeData + 2); // The pascal string contains 2 bytes length
+            const char * actualData = reinterpret_cast<const char *>(data + 2); // The pascal string contains 2 bytes length
             uint16_t dataLength;
-            memcpy(&dataLength, attributeData, sizeof(dataLength));
+            memcpy(&dataLength, data, sizeof(dataLength));
             if (dataLength == 0xFFFF)
             {
                 if (isNullable)
@@ -613,8 +766,8 @@ CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, c
         }
         case ZCL_OCTET_STRING_ATTRIBUTE_TYPE: // Octet string
         {
-            uint8_t * actualData = attributeData + 1;
-            uint8_t dataLength   = attributeData[0];
+            const uint8_t * actualData = data + 1;
+            uint8_t dataLength         = data[0];
             if (dataLength == 0xFF)
             {
                 if (isNullable)
@@ -633,9 +786,9 @@ CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, c
             break;
         }
         case ZCL_LONG_OCTET_STRING_ATTRIBUTE_TYPE: {
-            uint8_t * actualData = attributeData + 2; // The pascal string contains 2 bytes length
+            const uint8_t * actualData = data + 2; // The pascal string contains 2 bytes length
             uint16_t dataLength;
-            memcpy(&dataLength, attributeData, sizeof(dataLength));
+            memcpy(&dataLength, data, sizeof(dataLength));
             if (dataLength == 0xFFFF)
             {
                 if (isNullable)
@@ -656,7 +809,7 @@ CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, c
         case ZCL_ARRAY_ATTRIBUTE_TYPE: {
             // We only get here for attributes of list type that have no override
             // registered.  There should not be any nonempty lists like that.
-            uint16_t length = emberAfGetInt16u(attributeData, 0, 2);
+            uint16_t length = emberAfGetInt16u(data, 0, 2);
             if (length != 0)
             {
                 return CHIP_ERROR_INCORRECT_STATE;
@@ -819,25 +972,42 @@ CHIP_ERROR prepareWriteData(const EmberAfAttributeMetadata * attributeMetadata,
 }
 } // namespace
 
+DataVersion GetClusterDataVersion(EndpointId aEndpointId, ClusterId aClusterId)
+{
+    return emberAfDataVersion(aEndpointId, aClusterId);
+}
+
+uint32_t GetAttributeStoreGeneration()
+{
+    return emberAfAttributeStoreGeneration();
+}
+
 // TODO: Refactor WriteSingleClusterData and all dependent functions to take ConcreteAttributePath instead of ClusterInfo
 // as the input argument.
 CHIP_ERROR WriteSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, ClusterInfo & aClusterInfo,
                                   TLV::TLVReader & aReader, WriteHandler * apWriteHandler)
 {
+    // First cluster access may arrive before a deferred data model init ran.
+    EnsureDataModelInitialized();
+
     // Named aPath for now to reduce the amount of code change that needs to
     // happen when the above TODO is resolved.
     ConcreteDataAttributePath aPath(aClusterInfo.mEndpointId, aClusterInfo.mClusterId, aClusterInfo.mAttributeId);
     const EmberAfAttributeMetadata * attributeMetadata =
         emberAfLocateAttributeMetadata(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId, CLUSTER_MASK_SERVER, 0);
+    auto * attrOverride = findAttributeAccessOverride(aClusterInfo.mEndpointId, aClusterInfo.mClusterId);
 
     AttributePathParams attributePathParams(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId);
 
-    if (attributeMetadata == nullptr)
+    // A cluster with native TLV handlers may serve writes for attributes that
+    // have no ember storage, so missing metadata is only fatal when no access
+    // interface is registered either.
+    if (attributeMetadata == nullptr && attrOverride == nullptr)
     {
         return apWriteHandler->AddStatus(attributePathParams, Protocols::InteractionModel::Status::UnsupportedAttribute);
     }
 
-    if (attributeMetadata->IsReadOnly())
+    if (attributeMetadata != nullptr && attributeMetadata->IsReadOnly())
     {
         return apWriteHandler->AddStatus(attributePathParams, Protocols::InteractionModel::Status::UnsupportedWrite);
     }
@@ -855,12 +1025,12 @@ CHIP_ERROR WriteSingleClusterData(const SubjectDescriptor & aSubjectDescriptor,
         }
     }
 
-    if (attributeMetadata->MustUseTimedWrite() && !apWriteHandler->IsTimedWrite())
+    if (attributeMetadata != nullptr && attributeMetadata->MustUseTimedWrite() && !apWriteHandler->IsTimedWrite())
     {
         return apWriteHandler->AddStatus(attributePathParams, Protocols::InteractionModel::Status::NeedsTimedInteraction);
     }
 
-    if (auto * attrOverride = findAttributeAccessOverride(aClusterInfo.mEndpointId, aClusterInfo.mClusterId))
+    if (attrOverride != nullptr)
     {
         AttributeValueDecoder valueDecoder(aReader, apWriteHandler->GetAccessingFabricIndex());
         ReturnErrorOnFailure(attrOverride->Write(aPath, valueDecoder));
@@ -872,6 +1042,13 @@ CHIP_ERROR WriteSingleClusterData(const SubjectDescriptor & aSubjectDescriptor,
         }
     }
 
+    // The access interface declined the write and there is no ember storage
+    // behind this attribute.
+    if (attributeMetadata == nullptr)
+    {
+        return apWriteHandler->AddStatus(attributePathParams, Protocols::InteractionModel::Status::UnsupportedAttribute);
+    }
+
     CHIP_ERROR preparationError = CHIP_NO_ERROR;
     uint16_t dataLen            = 0;
     if ((preparationError = prepareWriteData(attributeMetadata, aReader, dataLen)) != CHIP_NO_ERROR)
@@ -895,19 +1072,16 @@ CHIP_ERROR WriteSingleClusterData(const SubjectDescriptor & aSubjectDescriptor,
 } // namespace app
 } // namespace chip
 
-void MatterReportingAttributeChangeCallback(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId, uint8_t mask,
-                                            uint16_t manufacturerCode, EmberAfAttributeType type, uint8_t * data)
-{
-    IgnoreUnusedVariable(manufacturerCode);
-    IgnoreUnusedVariable(type);
-    IgnoreUnusedVariable(data);
-    IgnoreUnusedVariable(mask);
-
-    MatterReportingAttributeChangeCallback(endpoint, clusterId, attributeId);
-}
+namespace {
 
-void MatterReportingAttributeChangeCallback(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId)
+// Shared tail of the MatterReportingAttributeChangeCallback overloads: bump
+// the cluster's data version so clients holding the previous version stop
+// matching their DataVersionFilterIBs, mark the path dirty and schedule a
+// reporting run.
+void MarkAttributeChanged(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId)
 {
+    emberAfDataVersionIncrement(endpoint, clusterId);
+
     ClusterInfo info;
     info.mClusterId   = clusterId;
     info.mAttributeId = attributeId;
@@ -921,7 +1095,67 @@ void MatterReportingAttributeChangeCallback(EndpointId endpoint, ClusterId clust
     InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
 }
 
+} // namespace
+
+void MatterReportingAttributeChangeCallback(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId, uint8_t mask,
+                                            uint16_t manufacturerCode, EmberAfAttributeType type, uint8_t * data)
+{
+    IgnoreUnusedVariable(manufacturerCode);
+
+#if CHIP_IM_MAX_NUM_CAPTURED_ATTRIBUTE_VALUES > 0
+    // The write path supplies the raw new value; capture it so report
+    // generation can encode it without re-reading the attribute store.
+    if (mask == CLUSTER_MASK_SERVER)
+    {
+        CaptureAttributeValue(ConcreteAttributePath(endpoint, clusterId, attributeId), type, data);
+    }
+#else
+    IgnoreUnusedVariable(type);
+    IgnoreUnusedVariable(data);
+    IgnoreUnusedVariable(mask);
+#endif
+
+    MarkAttributeChanged(endpoint, clusterId, attributeId);
+}
+
+void MatterReportingAttributeChangeCallback(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId)
+{
+#if CHIP_IM_MAX_NUM_CAPTURED_ATTRIBUTE_VALUES > 0
+    // No value supplied with this change: drop any captured value for the path
+    // so the report re-reads current state instead of an older capture.
+    InvalidateCapturedAttributeValue(ConcreteAttributePath(endpoint, clusterId, attributeId));
+#endif
+
+    MarkAttributeChanged(endpoint, clusterId, attributeId);
+}
+
 void MatterReportingAttributeChangeCallback(const ConcreteAttributePath & aPath)
 {
     return MatterReportingAttributeChangeCallback(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId);
 }
+
+void MatterReportingAttributeChangeCallback(EndpointId endpoint)
+{
+#if CHIP_IM_MAX_NUM_CAPTURED_ATTRIBUTE_VALUES > 0
+    // The endpoint's whole state changed (e.g. a dynamic endpoint was
+    // registered); captured values from its previous incarnation are stale.
+    InvalidateCapturedAttributeValuesForEndpoint(endpoint);
+#endif
+
+    // Bump the data version of every server cluster on the endpoint so that
+    // version filters held by clients cannot suppress its newly visible state.
+    for (uint8_t i = 0; i < emberAfClusterCount(endpoint, /* server = */ true); i++)
+    {
+        EmberAfCluster * cluster = emberAfGetNthCluster(endpoint, i, /* server = */ true);
+        emberAfDataVersionIncrement(endpoint, cluster->clusterId);
+    }
+
+    // A ClusterInfo with only the endpoint filled in is a wildcard over that
+    // endpoint's clusters and attributes; subscriptions not touching the
+    // endpoint are unaffected.
+    ClusterInfo info;
+    info.mEndpointId = endpoint;
+
+    InteractionModelEngine::GetInstance()->GetReportingEngine().SetDirty(info);
+    InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
+}
@@ -99,6 +99,12 @@ uint16_t emberAfEndpointCount(void)
     return ArraySize(endpoints);
 }
 
+uint32_t emberAfMetadataStructureGeneration(void)
+{
+    // The mock endpoint/cluster/attribute metadata never changes.
+    return 0;
+}
+
 uint16_t emberAfIndexFromEndpoint(chip::EndpointId endpoint)
 {
     for (uint16_t i = 0; i < ArraySize(endpoints); i++)
@@ -0,0 +1,237 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Standalone microbenchmark driver for a handful of hot paths: TLV
+ *      encode/decode, packet buffer allocation, message payload encryption
+ *      and secure session lookup.  Results are printed as a JSON array so
+ *      CI and on-device runs can trend the numbers over time.
+ *
+ *      These benchmarks deliberately stay below the message layer so the
+ *      binary links against only the core libraries and can run without any
+ *      network or platform event loop.
+ */
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+#include <system/SystemPacketBuffer.h>
+#include <transport/CryptoContext.h>
+#include <transport/SecureSessionTable.h>
+
+namespace {
+
+using namespace chip;
+
+constexpr uint32_t kDefaultIterations = 100000;
+
+// A benchmark runs its whole iteration loop internally so the per-iteration
+// cost is not dominated by the harness' indirect call.
+typedef CHIP_ERROR (*BenchmarkFn)(uint32_t iterations);
+
+struct Benchmark
+{
+    const char * name;
+    BenchmarkFn fn;
+};
+
+CHIP_ERROR BenchmarkTlvEncode(uint32_t iterations)
+{
+    uint8_t payload[32];
+    uint8_t buf[128];
+    memset(payload, 0xa5, sizeof(payload));
+
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        TLV::TLVWriter writer;
+        TLV::TLVType outerType;
+        writer.Init(buf, sizeof(buf));
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, outerType));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(0), i));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(1), static_cast<uint64_t>(i) << 32));
+        ReturnErrorOnFailure(writer.PutBytes(TLV::ContextTag(2), payload, sizeof(payload)));
+        ReturnErrorOnFailure(writer.EndContainer(outerType));
+        ReturnErrorOnFailure(writer.Finalize());
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BenchmarkTlvDecode(uint32_t iterations)
+{
+    uint8_t payload[32];
+    uint8_t buf[128];
+    uint32_t encodedLen;
+    memset(payload, 0xa5, sizeof(payload));
+
+    // Encode one element outside the timed loop; the loop measures decode only.
+    {
+        TLV::TLVWriter writer;
+        TLV::TLVType outerType;
+        writer.Init(buf, sizeof(buf));
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, outerType));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(0), static_cast<uint32_t>(1)));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(1), static_cast<uint64_t>(2)));
+        ReturnErrorOnFailure(writer.PutBytes(TLV::ContextTag(2), payload, sizeof(payload)));
+        ReturnErrorOnFailure(writer.EndContainer(outerType));
+        ReturnErrorOnFailure(writer.Finalize());
+        encodedLen = writer.GetLengthWritten();
+    }
+
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        TLV::TLVReader reader;
+        TLV::TLVType outerType;
+        reader.Init(buf, encodedLen);
+        ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag));
+        ReturnErrorOnFailure(reader.EnterContainer(outerType));
+
+        CHIP_ERROR err;
+        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        {
+        }
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        ReturnErrorOnFailure(reader.ExitContainer(outerType));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BenchmarkPacketBufferAllocFree(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        System::PacketBufferHandle handle = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+        VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BenchmarkCryptoContextEncrypt(uint32_t iterations)
+{
+    CryptoContext context;
+    const uint8_t secret[] = "benchmark shared secret material";
+    const uint8_t salt[]   = "benchmark salt";
+    uint8_t plainText[128];
+    uint8_t cipherText[128];
+    memset(plainText, 0x5a, sizeof(plainText));
+
+    ReturnErrorOnFailure(context.InitFromSecret(ByteSpan(secret), ByteSpan(salt), CryptoContext::SessionInfoType::kSessionEstablishment,
+                                                CryptoContext::SessionRole::kInitiator));
+
+    PacketHeader packetHeader;
+    packetHeader.SetSessionId(1);
+    MessageAuthenticationCode mac;
+
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        packetHeader.SetMessageCounter(i);
+        ReturnErrorOnFailure(context.Encrypt(plainText, sizeof(plainText), cipherText, packetHeader, mac));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BenchmarkSessionLookup(uint32_t iterations)
+{
+    constexpr size_t kSessionCount = 16;
+    Transport::SecureSessionTable<kSessionCount> sessions;
+
+    for (uint16_t i = 0; i < kSessionCount; i++)
+    {
+        Transport::SecureSession * session =
+            sessions.CreateNewSecureSession(Transport::SecureSession::Type::kPASE, static_cast<uint16_t>(i + 1),
+                                            static_cast<NodeId>(i + 1), CATValues{}, static_cast<uint16_t>(i + 1),
+                                            0 /* fabricIndex */, gDefaultMRPConfig);
+        VerifyOrReturnError(session != nullptr, CHIP_ERROR_NO_MEMORY);
+    }
+
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        uint16_t localSessionId = static_cast<uint16_t>((i % kSessionCount) + 1);
+        VerifyOrReturnError(sessions.FindSecureSessionByLocalKey(localSessionId) != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+const Benchmark sBenchmarks[] = {
+    { "TlvEncode", BenchmarkTlvEncode },
+    { "TlvDecode", BenchmarkTlvDecode },
+    { "PacketBufferAllocFree", BenchmarkPacketBufferAllocFree },
+    { "CryptoContextEncrypt", BenchmarkCryptoContextEncrypt },
+    { "SessionLookup", BenchmarkSessionLookup },
+};
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    uint32_t iterations = kDefaultIterations;
+    if (argc > 1)
+    {
+        iterations = static_cast<uint32_t>(atoi(argv[1]));
+        if (iterations == 0)
+        {
+            fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (chip::Platform::MemoryInit() != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "FAILED to initialize memory\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("[\n");
+
+    size_t benchmarkCount = ArraySize(sBenchmarks);
+    for (size_t i = 0; i < benchmarkCount; i++)
+    {
+        auto start     = std::chrono::steady_clock::now();
+        CHIP_ERROR err = sBenchmarks[i].fn(iterations);
+        auto end       = std::chrono::steady_clock::now();
+
+        if (err != CHIP_NO_ERROR)
+        {
+            fprintf(stderr, "Benchmark %s FAILED: %" CHIP_ERROR_FORMAT "\n", sBenchmarks[i].name, err.Format());
+            chip::Platform::MemoryShutdown();
+            return EXIT_FAILURE;
+        }
+
+        uint64_t totalNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        printf("  { \"name\": \"%s\", \"iterations\": %" PRIu32 ", \"ns_per_op\": %.1f }%s\n", sBenchmarks[i].name, iterations,
+               static_cast<double>(totalNs) / iterations, (i + 1 < benchmarkCount) ? "," : "");
+    }
+
+    printf("]\n");
+
+    chip::Platform::MemoryShutdown();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,175 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Traffic-replay training workload for profile-guided optimization.
+ *      Drives loopback messaging through the real SessionManager at scale,
+ *      exercising the hot transmit and receive paths -- message encrypt,
+ *      raw transport dispatch, decrypt, session lookup and
+ *      SessionManager::OnMessageReceived delivery -- so that an
+ *      instrumented build records a representative execution profile.
+ *
+ *      Typical flow with clang:
+ *
+ *        gn gen out/pgo --args='chip_pgo_instrument=true'
+ *        ninja -C out/pgo chip_pgo_workload
+ *        (cd out/pgo && ./chip_pgo_workload)
+ *        llvm-profdata merge -output=chip.profdata out/pgo/default_*.profraw
+ *        gn gen out/opt --args='chip_pgo_profile="/abs/path/chip.profdata"'
+ *
+ *      With gcc, skip the merge step and point chip_pgo_profile at the
+ *      directory holding the emitted .gcda files.
+ */
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <lib/core/CHIPCore.h>
+#include <lib/support/CodeUtils.h>
+#include <protocols/Protocols.h>
+#include <protocols/echo/Echo.h>
+#include <protocols/secure_channel/MessageCounterManager.h>
+#include <protocols/secure_channel/PASESession.h>
+#include <transport/SessionManager.h>
+#include <transport/TransportMgr.h>
+#include <transport/raw/tests/NetworkTestHelpers.h>
+
+namespace {
+
+using namespace chip;
+
+constexpr uint32_t kDefaultMessageCount = 200000;
+constexpr NodeId kSourceNodeId          = 123654;
+constexpr NodeId kDestinationNodeId     = 111222333;
+
+const char kPayload[] = "PGO training payload: representative echo message body";
+
+class CountingMessageDelegate : public SessionMessageDelegate
+{
+public:
+    void OnMessageReceived(const PacketHeader & header, const PayloadHeader & payloadHeader, const SessionHandle & session,
+                           const Transport::PeerAddress & source, DuplicateMessage isDuplicate,
+                           System::PacketBufferHandle && msgBuf) override
+    {
+        mReceivedCount++;
+    }
+
+    uint32_t mReceivedCount = 0;
+};
+
+CHIP_ERROR RunWorkload(Test::IOContext & ioContext, uint32_t messageCount, uint32_t & outReceivedCount)
+{
+    TransportMgr<Test::LoopbackTransport> transportMgr;
+    SessionManager sessionManager;
+    secure_channel::MessageCounterManager messageCounterManager;
+    CountingMessageDelegate delegate;
+
+    ReturnErrorOnFailure(transportMgr.Init("LOOPBACK"));
+    ReturnErrorOnFailure(sessionManager.Init(&ioContext.GetSystemLayer(), &transportMgr, &messageCounterManager));
+    sessionManager.SetMessageDelegate(&delegate);
+
+    Inet::IPAddress addr;
+    Inet::IPAddress::FromString("::1", addr);
+    Optional<Transport::PeerAddress> peer(Transport::PeerAddress::UDP(addr, CHIP_PORT));
+
+    SessionHolder remoteToLocalSession;
+    SessionHolder localToRemoteSession;
+
+    SecurePairingUsingTestSecret pairing1(1, 2);
+    ReturnErrorOnFailure(sessionManager.NewPairing(remoteToLocalSession, peer, kSourceNodeId, &pairing1,
+                                                   CryptoContext::SessionRole::kInitiator, 1));
+
+    SecurePairingUsingTestSecret pairing2(2, 1);
+    ReturnErrorOnFailure(sessionManager.NewPairing(localToRemoteSession, peer, kDestinationNodeId, &pairing2,
+                                                   CryptoContext::SessionRole::kResponder, 0));
+
+    SessionHandle session = localToRemoteSession.Get();
+
+    for (uint32_t i = 0; i < messageCount; i++)
+    {
+        System::PacketBufferHandle buffer = MessagePacketBuffer::NewWithData(kPayload, sizeof(kPayload) - 1);
+        VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+        PayloadHeader payloadHeader;
+        payloadHeader.SetExchangeID(static_cast<uint16_t>(i));
+        payloadHeader.SetMessageType(Protocols::Echo::MsgType::EchoRequest);
+
+        EncryptedPacketBufferHandle preparedMessage;
+        ReturnErrorOnFailure(sessionManager.PrepareMessage(session, payloadHeader, std::move(buffer), preparedMessage));
+        ReturnErrorOnFailure(sessionManager.SendPreparedMessage(session, preparedMessage));
+    }
+
+    outReceivedCount = delegate.mReceivedCount;
+
+    sessionManager.Shutdown();
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    uint32_t messageCount = kDefaultMessageCount;
+    if (argc > 1)
+    {
+        messageCount = static_cast<uint32_t>(atoi(argv[1]));
+        if (messageCount == 0)
+        {
+            fprintf(stderr, "Usage: %s [message count]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    chip::Test::IOContext ioContext;
+    if (ioContext.Init() != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "FAILED to initialize the IO context\n");
+        return EXIT_FAILURE;
+    }
+
+    uint32_t receivedCount = 0;
+
+    auto start     = std::chrono::steady_clock::now();
+    CHIP_ERROR err = RunWorkload(ioContext, messageCount, receivedCount);
+    auto end       = std::chrono::steady_clock::now();
+
+    if (err != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Workload FAILED: %" CHIP_ERROR_FORMAT "\n", err.Format());
+        ioContext.Shutdown();
+        return EXIT_FAILURE;
+    }
+
+    if (receivedCount != messageCount)
+    {
+        fprintf(stderr, "Workload FAILED: sent %" PRIu32 " messages but received %" PRIu32 "\n", messageCount, receivedCount);
+        ioContext.Shutdown();
+        return EXIT_FAILURE;
+    }
+
+    uint64_t totalNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    printf("{ \"name\": \"SessionManagerLoopback\", \"messages\": %" PRIu32 ", \"ns_per_message\": %.1f }\n", messageCount,
+           static_cast<double>(totalNs) / messageCount);
+
+    ioContext.Shutdown();
+    return EXIT_SUCCESS;
+}
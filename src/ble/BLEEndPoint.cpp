@@ -96,6 +96,10 @@
 #define BTP_WINDOW_NO_ACK_SEND_THRESHOLD                         1 // Data fragments may only be sent without piggybacked
                                                                    // acks if receiver's window size is above this threshold.
 
+#define BTP_BULK_RX_INTERARRIVAL_MS                            250 // Receive-side fragment interarrival (EWMA) at or below
+                                                                   // which the peer is considered to be streaming a bulk
+                                                                   // transfer, enabling the early stand-alone ack threshold.
+
 // clang-format on
 
 namespace chip {
@@ -577,6 +581,8 @@ CHIP_ERROR BLEEndPoint::Init(BleLayer * bleLayer, BLE_CONNECTION_OBJECT connObj,
     mReceiveWindowMaxSize    = 0;
     mSendQueue               = nullptr;
     mAckToSend               = nullptr;
+    mLastFragmentRxTime      = System::Clock::kZero;
+    mFragmentInterarrivalMs  = 0;
 
     ChipLogDebugBleEndPoint(Ble, "initialized local rx window, size = %u", mLocalReceiveWindowSize);
 
@@ -832,7 +838,7 @@ CHIP_ERROR BLEEndPoint::HandleHandshakeConfirmationReceived()
         {
             // If local receive window size has shrunk to or below immediate ack threshold, AND a message fragment is not
             // pending on which to piggyback an ack, send immediate stand-alone ack.
-            if (mLocalReceiveWindowSize <= BLE_CONFIG_IMMEDIATE_ACK_WINDOW_THRESHOLD && mSendQueue.IsNull())
+            if (mLocalReceiveWindowSize <= GetImmediateAckThreshold() && mSendQueue.IsNull())
             {
                 err = DriveStandAloneAck(); // Encode stand-alone ack and drive sending.
                 SuccessOrExit(err);
@@ -897,7 +903,7 @@ CHIP_ERROR BLEEndPoint::HandleFragmentConfirmationReceived()
     // This check covers the case where the local receive window has shrunk between transmission and confirmation of
     // the stand-alone ack, and also the case where a window size < the immediate ack threshold was detected in
     // Receive(), but the stand-alone ack was deferred due to a pending outbound message fragment.
-    if (mLocalReceiveWindowSize <= BLE_CONFIG_IMMEDIATE_ACK_WINDOW_THRESHOLD && mSendQueue.IsNull() &&
+    if (mLocalReceiveWindowSize <= GetImmediateAckThreshold() && mSendQueue.IsNull() &&
         mBtpEngine.TxState() != BtpEngine::kState_InProgress)
     {
         err = DriveStandAloneAck(); // Encode stand-alone ack and drive sending.
@@ -1203,6 +1209,45 @@ SequenceNumber_t BLEEndPoint::AdjustRemoteReceiveWindow(SequenceNumber_t lastRec
     return static_cast<uint8_t>(newRemoteWindowBoundary - newestUnackedSentSeqNum);
 }
 
+void BLEEndPoint::UpdateFragmentArrivalStats()
+{
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+
+    if (mLastFragmentRxTime != System::Clock::kZero)
+    {
+        const uint32_t sample = static_cast<uint32_t>(
+            chip::min<System::Clock::Timestamp::rep>((now - mLastFragmentRxTime).count(), BTP_ACK_SEND_TIMEOUT_MS));
+        if (mFragmentInterarrivalMs == 0)
+        {
+            mFragmentInterarrivalMs = sample;
+        }
+        else
+        {
+            mFragmentInterarrivalMs = (3 * mFragmentInterarrivalMs + sample) / 4;
+        }
+    }
+
+    mLastFragmentRxTime = now;
+}
+
+SequenceNumber_t BLEEndPoint::GetImmediateAckThreshold() const
+{
+    // During a bulk transfer, ack at half the window so the sender's pipeline refills before
+    // it drains; early acks are wasted effort on sparse traffic, so fall back to the static
+    // threshold there. The threshold must stay at least 2 below the window max or immediate
+    // acks would be sent forever in response to one another (see BLE_MAX_RECEIVE_WINDOW_SIZE).
+    if (mFragmentInterarrivalMs != 0 && mFragmentInterarrivalMs <= BTP_BULK_RX_INTERARRIVAL_MS)
+    {
+        const SequenceNumber_t half = static_cast<SequenceNumber_t>(mReceiveWindowMaxSize / 2);
+        if (half > BLE_CONFIG_IMMEDIATE_ACK_WINDOW_THRESHOLD &&
+            half <= static_cast<SequenceNumber_t>(mReceiveWindowMaxSize - 2))
+        {
+            return half;
+        }
+    }
+    return BLE_CONFIG_IMMEDIATE_ACK_WINDOW_THRESHOLD;
+}
+
 CHIP_ERROR BLEEndPoint::Receive(PacketBufferHandle && data)
 {
     ChipLogDebugBleEndPoint(Ble, "+++++++++++++++++++++ entered receive");
@@ -1288,6 +1333,9 @@ CHIP_ERROR BLEEndPoint::Receive(PacketBufferHandle && data)
     mLocalReceiveWindowSize = static_cast<SequenceNumber_t>(mLocalReceiveWindowSize - 1);
     ChipLogDebugBleEndPoint(Ble, "decremented local rx window, new size = %u", mLocalReceiveWindowSize);
 
+    // Track fragment interarrival time to detect bulk transfers, which raise the immediate ack threshold.
+    UpdateFragmentArrivalStats();
+
     // Respond to received ack, if any.
     if (didReceiveAck)
     {
@@ -1344,7 +1392,7 @@ CHIP_ERROR BLEEndPoint::Receive(PacketBufferHandle && data)
     // this threshold again when the GATT operation is confirmed.
     if (mBtpEngine.HasUnackedData())
     {
-        if (mLocalReceiveWindowSize <= BLE_CONFIG_IMMEDIATE_ACK_WINDOW_THRESHOLD &&
+        if (mLocalReceiveWindowSize <= GetImmediateAckThreshold() &&
             !mConnStateFlags.Has(ConnectionStateFlag::kGattOperationInFlight))
         {
             ChipLogDebugBleEndPoint(Ble, "sending immediate ack");
@@ -164,6 +164,11 @@ private:
     SequenceNumber_t mLocalReceiveWindowSize;
     SequenceNumber_t mRemoteReceiveWindowSize;
     SequenceNumber_t mReceiveWindowMaxSize;
+
+    // Receive-side fragment arrival tracking, used to scale the immediate stand-alone ack
+    // threshold up during bulk transfers so the sender's window refills before it drains.
+    System::Clock::Timestamp mLastFragmentRxTime;
+    uint32_t mFragmentInterarrivalMs; // EWMA; 0 until two fragments have been observed.
 #if CHIP_ENABLE_CHIPOBLE_TEST
     chip::System::Mutex mTxQueueMutex; // For MT-safe Tx queuing
 #endif
@@ -200,6 +205,8 @@ private:
     CHIP_ERROR HandleCapabilitiesResponseReceived(PacketBufferHandle && data);
     SequenceNumber_t AdjustRemoteReceiveWindow(SequenceNumber_t lastReceivedAck, SequenceNumber_t maxRemoteWindowSize,
                                                SequenceNumber_t newestUnackedSentSeqNum);
+    void UpdateFragmentArrivalStats();
+    SequenceNumber_t GetImmediateAckThreshold() const;
 
     // Timer control functions:
     CHIP_ERROR StartConnectTimer();           // Start connect timer.
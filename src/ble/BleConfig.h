@@ -172,6 +172,20 @@
 #error "BLE_MAX_RECEIVE_WINDOW_SIZE must be greater than 2 for BLE transport protocol stability."
 #endif
 
+/**
+ *  @def BLE_MAX_FRAGMENT_SIZE
+ *
+ *  @brief
+ *    This is the upper bound on the BTP fragment size negotiated at connect time. The negotiated size is the lesser
+ *    of this value and (ATT MTU - 3), so the default of 244 fills a 247-byte ATT MTU. Platforms whose BLE stacks
+ *    negotiate a larger ATT MTU (e.g. via data length extension) may raise this value to move more payload per
+ *    GATT operation; it is never exceeded regardless of the MTU the peer reports.
+ *
+ */
+#ifndef BLE_MAX_FRAGMENT_SIZE
+#define BLE_MAX_FRAGMENT_SIZE 244
+#endif // BLE_MAX_FRAGMENT_SIZE
+
 /**
  *  @def BLE_CONFIG_ERROR_MIN
  *
@@ -283,6 +283,9 @@ CHIP_ERROR BleLayer::Init(BlePlatformDelegate * platformDelegate, BleConnectionD
 
     memset(&sBLEEndPointPool, 0, sizeof(sBLEEndPointPool));
 
+    mPendingConnectionsHead  = 0;
+    mPendingConnectionsCount = 0;
+
     mState = kState_Initialized;
 
 #if CHIP_ENABLE_CHIPOBLE_TEST
@@ -371,6 +374,11 @@ CHIP_ERROR BleLayer::CancelBleIncompleteConnection()
     {
         ChipLogError(Ble, "BleConnectionDelegate::CancelConnection is not implemented.");
     }
+
+    // Drop any connection attempts still queued behind the one just canceled.
+    mPendingConnectionsHead  = 0;
+    mPendingConnectionsCount = 0;
+
     return err;
 }
 
@@ -382,14 +390,84 @@ CHIP_ERROR BleLayer::NewBleConnectionByDiscriminator(uint16_t connDiscriminator,
     VerifyOrReturnError(mConnectionDelegate != nullptr, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mBleTransport != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    mConnectionDelegate->OnConnectionComplete = onSuccess;
-    mConnectionDelegate->OnConnectionError    = onError;
+    VerifyOrReturnError(mPendingConnectionsCount < BLE_LAYER_NUM_BLE_ENDPOINTS, CHIP_ERROR_NO_MEMORY);
 
-    mConnectionDelegate->NewConnection(this, appState == nullptr ? this : appState, connDiscriminator);
+    PendingConnection & entry = mPendingConnections[(mPendingConnectionsHead + mPendingConnectionsCount) % BLE_LAYER_NUM_BLE_ENDPOINTS];
+    entry.mDiscriminator      = connDiscriminator;
+    entry.mAppState           = appState == nullptr ? this : appState;
+    entry.mOnSuccess          = onSuccess;
+    entry.mOnError            = onError;
+    mPendingConnectionsCount++;
+
+    // If no other connection attempt is in flight, start this one immediately.
+    // Otherwise it is started once the attempts ahead of it settle; queueing
+    // keeps each caller's completion callbacks distinct instead of letting a
+    // second concurrent request overwrite the delegate's callback pointers.
+    if (mPendingConnectionsCount == 1)
+    {
+        StartPendingConnection();
+    }
 
     return CHIP_NO_ERROR;
 }
 
+void BleLayer::StartPendingConnection()
+{
+    PendingConnection & entry = mPendingConnections[mPendingConnectionsHead];
+
+    mConnectionDelegate->OnConnectionComplete = OnPendingConnectionComplete;
+    mConnectionDelegate->OnConnectionError    = OnPendingConnectionError;
+
+    mConnectionDelegate->NewConnection(this, this, entry.mDiscriminator);
+}
+
+void BleLayer::OnPendingConnectionComplete(void * appState, BLE_CONNECTION_OBJECT connObj)
+{
+    BleLayer * ble = static_cast<BleLayer *>(appState);
+
+    if (ble->mPendingConnectionsCount == 0)
+    {
+        // Late completion of an attempt that has since been canceled. Wrap the
+        // connection in an end point anyway so it is not leaked.
+        OnConnectionComplete(ble, connObj);
+        return;
+    }
+
+    PendingConnection entry      = ble->mPendingConnections[ble->mPendingConnectionsHead];
+    ble->mPendingConnectionsHead = (ble->mPendingConnectionsHead + 1) % BLE_LAYER_NUM_BLE_ENDPOINTS;
+    ble->mPendingConnectionsCount--;
+
+    if (ble->mPendingConnectionsCount > 0)
+    {
+        ble->StartPendingConnection();
+    }
+
+    entry.mOnSuccess(entry.mAppState, connObj);
+}
+
+void BleLayer::OnPendingConnectionError(void * appState, CHIP_ERROR err)
+{
+    BleLayer * ble = static_cast<BleLayer *>(appState);
+
+    if (ble->mPendingConnectionsCount == 0)
+    {
+        ChipLogError(Ble, "BLE connection error with no attempt outstanding: %s", ErrorStr(err));
+        return;
+    }
+
+    PendingConnection entry      = ble->mPendingConnections[ble->mPendingConnectionsHead];
+    ble->mPendingConnectionsHead = (ble->mPendingConnectionsHead + 1) % BLE_LAYER_NUM_BLE_ENDPOINTS;
+    ble->mPendingConnectionsCount--;
+
+    // A failed discovery does not block the attempts queued behind it.
+    if (ble->mPendingConnectionsCount > 0)
+    {
+        ble->StartPendingConnection();
+    }
+
+    entry.mOnError(entry.mAppState, err);
+}
+
 CHIP_ERROR BleLayer::NewBleConnectionByObject(BLE_CONNECTION_OBJECT connObj)
 {
     VerifyOrReturnError(mState == kState_Initialized, CHIP_ERROR_INCORRECT_STATE);
@@ -337,7 +337,25 @@ private:
     BleApplicationDelegate * mApplicationDelegate;
     chip::System::Layer * mSystemLayer;
 
+    // The platform connection delegate runs a single discovery scan at a time,
+    // so connection attempts beyond the active one are queued here and started
+    // in order as the attempts ahead of them complete or fail. BTP sessions on
+    // connections that have already been established proceed in parallel on
+    // their own end points.
+    struct PendingConnection
+    {
+        uint16_t mDiscriminator;
+        void * mAppState;
+        BleConnectionDelegate::OnConnectionCompleteFunct mOnSuccess;
+        BleConnectionDelegate::OnConnectionErrorFunct mOnError;
+    };
+
+    PendingConnection mPendingConnections[BLE_LAYER_NUM_BLE_ENDPOINTS];
+    size_t mPendingConnectionsHead  = 0;
+    size_t mPendingConnectionsCount = 0;
+
     // Private functions:
+    void StartPendingConnection();
     void HandleAckReceived(BLE_CONNECTION_OBJECT connObj);
     void DriveSending();
     CHIP_ERROR HandleBleTransportConnectionInitiated(BLE_CONNECTION_OBJECT connObj, System::PacketBufferHandle && pBuf);
@@ -346,6 +364,9 @@ private:
 
     static void OnConnectionComplete(void * appState, BLE_CONNECTION_OBJECT connObj);
     static void OnConnectionError(void * appState, CHIP_ERROR err);
+
+    static void OnPendingConnectionComplete(void * appState, BLE_CONNECTION_OBJECT connObj);
+    static void OnPendingConnectionError(void * appState, CHIP_ERROR err);
 };
 
 } /* namespace Ble */
@@ -25,31 +25,104 @@
 namespace chip {
 namespace Controller {
 
+namespace {
+
+// 64-bit FNV-1a accumulator used to fingerprint discovered node records, so change
+// detection costs one hash per answer instead of a field-by-field comparison.
+class NodeDataFingerprint
+{
+public:
+    void Add(const void * data, size_t size)
+    {
+        const uint8_t * bytes = static_cast<const uint8_t *>(data);
+        for (size_t i = 0; i < size; i++)
+        {
+            mHash = (mHash ^ bytes[i]) * 0x100000001b3ULL;
+        }
+    }
+
+    template <typename T>
+    void Add(T value)
+    {
+        Add(&value, sizeof(value));
+    }
+
+    uint64_t Value() const { return mHash; }
+
+private:
+    uint64_t mHash = 0xcbf29ce484222325ULL;
+};
+
+uint64_t ComputeFingerprint(const chip::Dnssd::DiscoveredNodeData & nodeData)
+{
+    // All fixed-size arrays below are fully zeroed by Reset() before the resolver fills
+    // them, so hashing the whole array is deterministic.
+    NodeDataFingerprint fingerprint;
+    fingerprint.Add(nodeData.hostName, sizeof(nodeData.hostName));
+    fingerprint.Add(nodeData.instanceName, sizeof(nodeData.instanceName));
+    fingerprint.Add(nodeData.longDiscriminator);
+    fingerprint.Add(nodeData.vendorId);
+    fingerprint.Add(nodeData.productId);
+    fingerprint.Add(nodeData.commissioningMode);
+    fingerprint.Add(nodeData.deviceType);
+    fingerprint.Add(nodeData.deviceName, sizeof(nodeData.deviceName));
+    fingerprint.Add(nodeData.rotatingId, sizeof(nodeData.rotatingId));
+    fingerprint.Add(nodeData.rotatingIdLen);
+    fingerprint.Add(nodeData.pairingHint);
+    fingerprint.Add(nodeData.pairingInstruction, sizeof(nodeData.pairingInstruction));
+    fingerprint.Add(nodeData.supportsTcp);
+    fingerprint.Add(nodeData.mrpRetryIntervalIdle.HasValue());
+    fingerprint.Add(nodeData.mrpRetryIntervalIdle.ValueOr(System::Clock::Milliseconds32(0)).count());
+    fingerprint.Add(nodeData.mrpRetryIntervalActive.HasValue());
+    fingerprint.Add(nodeData.mrpRetryIntervalActive.ValueOr(System::Clock::Milliseconds32(0)).count());
+    fingerprint.Add(nodeData.port);
+    fingerprint.Add(nodeData.numIPs);
+    for (int i = 0; i < nodeData.numIPs && i < Dnssd::DiscoveredNodeData::kMaxIPAddresses; i++)
+    {
+        fingerprint.Add(nodeData.ipAddress[i].Addr, sizeof(nodeData.ipAddress[i].Addr));
+    }
+    return fingerprint.Value();
+}
+
+} // namespace
+
 void AbstractDnssdDiscoveryController::OnNodeDiscoveryComplete(const chip::Dnssd::DiscoveredNodeData & nodeData)
 {
-    auto discoveredNodes = GetDiscoveredNodes();
-    for (auto & discoveredNode : discoveredNodes)
+    auto discoveredNodes     = GetDiscoveredNodes();
+    const uint64_t newRecord = ComputeFingerprint(nodeData);
+
+    for (size_t idx = 0; idx < discoveredNodes.size(); idx++)
     {
+        auto & discoveredNode = discoveredNodes.data()[idx];
         if (!discoveredNode.IsValid())
         {
             continue;
         }
         if (strcmp(discoveredNode.hostName, nodeData.hostName) == 0)
         {
-            discoveredNode = nodeData;
+            // Repeated answers with no changes are the common case while browsing
+            // continuously; consume them here without copying or notifying.
+            if (mDiscoveredNodeFingerprints[idx] == newRecord)
+            {
+                return;
+            }
+            discoveredNode                   = nodeData;
+            mDiscoveredNodeFingerprints[idx] = newRecord;
             if (mDeviceDiscoveryDelegate != nullptr)
             {
-                mDeviceDiscoveryDelegate->OnDiscoveredDevice(nodeData);
+                mDeviceDiscoveryDelegate->OnDiscoveredDeviceUpdated(nodeData);
             }
             return;
         }
     }
     // Node not yet in the list
-    for (auto & discoveredNode : discoveredNodes)
+    for (size_t idx = 0; idx < discoveredNodes.size(); idx++)
     {
+        auto & discoveredNode = discoveredNodes.data()[idx];
         if (!discoveredNode.IsValid())
         {
-            discoveredNode = nodeData;
+            discoveredNode                   = nodeData;
+            mDiscoveredNodeFingerprints[idx] = newRecord;
             if (mDeviceDiscoveryDelegate != nullptr)
             {
                 mDeviceDiscoveryDelegate->OnDiscoveredDevice(nodeData);
@@ -67,6 +140,7 @@ CHIP_ERROR AbstractDnssdDiscoveryController::SetUpNodeDiscovery()
     {
         discoveredNode.Reset();
     }
+    memset(mDiscoveredNodeFingerprints, 0, sizeof(mDiscoveredNodeFingerprints));
     return CHIP_NO_ERROR;
 }
 
@@ -51,6 +51,13 @@ protected:
     virtual DiscoveredNodeList GetDiscoveredNodes()    = 0;
     DeviceDiscoveryDelegate * mDeviceDiscoveryDelegate = nullptr;
     Dnssd::ResolverProxy mDNSResolver;
+
+private:
+    // Fingerprints of the entries in GetDiscoveredNodes(), used to detect whether a
+    // re-announcement actually changed anything before copying it and notifying the
+    // delegate; continuous browsing otherwise turns every repeated mDNS answer into a
+    // full delegate refresh.
+    uint64_t mDiscoveredNodeFingerprints[CHIP_DEVICE_CONFIG_MAX_DISCOVERED_NODES] = {};
 };
 
 } // namespace Controller
@@ -0,0 +1,192 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <controller/AsyncDeviceAttestationVerifier.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <string.h>
+
+namespace chip {
+namespace Controller {
+
+#if CHIP_CONFIG_DEVICE_ATTESTATION_WORKER_POOL_SIZE > 0
+
+CHIP_ERROR AsyncDeviceAttestationVerifier::Init()
+{
+    VerifyOrReturnError(!mRunning, CHIP_ERROR_INCORRECT_STATE);
+
+    mRunning = true;
+    for (auto & worker : mWorkers)
+    {
+        worker = std::thread(&AsyncDeviceAttestationVerifier::WorkerMain, this);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void AsyncDeviceAttestationVerifier::Shutdown()
+{
+    VerifyOrReturn(mRunning);
+
+    {
+        std::lock_guard<std::mutex> lock(mQueueLock);
+        mRunning = false;
+    }
+    mQueueCondition.notify_all();
+
+    for (auto & worker : mWorkers)
+    {
+        worker.join();
+    }
+
+    // Discard whatever the workers did not get to; completion is not
+    // guaranteed across Shutdown.
+    while (mQueueHead != nullptr)
+    {
+        VerificationRequest * request = mQueueHead;
+        mQueueHead                    = request->mNext;
+        Platform::Delete(request);
+    }
+    mQueueTail = nullptr;
+}
+
+CHIP_ERROR AsyncDeviceAttestationVerifier::CopySpan(const ByteSpan & source, Platform::ScopedMemoryBuffer<uint8_t> & destination,
+                                                    size_t & length)
+{
+    length = source.size();
+    VerifyOrReturnError(length > 0, CHIP_NO_ERROR);
+    VerifyOrReturnError(destination.Alloc(length), CHIP_ERROR_NO_MEMORY);
+    memcpy(destination.Get(), source.data(), length);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AsyncDeviceAttestationVerifier::VerifyAttestationInformation(
+    Credentials::DeviceAttestationVerifier * verifier, const ByteSpan & attestationInfoBuffer,
+    const ByteSpan & attestationChallengeBuffer, const ByteSpan & attestationSignatureBuffer, const ByteSpan & paiDerBuffer,
+    const ByteSpan & dacDerBuffer, const ByteSpan & attestationNonce,
+    Callback::Callback<OnAttestationVerificationComplete> * onComplete)
+{
+    VerifyOrReturnError(verifier != nullptr && onComplete != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mRunning, CHIP_ERROR_INCORRECT_STATE);
+
+    VerificationRequest * request = Platform::New<VerificationRequest>();
+    VerifyOrReturnError(request != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    request->mVerifier   = verifier;
+    request->mOnComplete = onComplete;
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    SuccessOrExit(err = CopySpan(attestationInfoBuffer, request->mAttestationInfo, request->mAttestationInfoLen));
+    SuccessOrExit(err = CopySpan(attestationChallengeBuffer, request->mAttestationChallenge, request->mAttestationChallengeLen));
+    SuccessOrExit(err = CopySpan(attestationSignatureBuffer, request->mAttestationSignature, request->mAttestationSignatureLen));
+    SuccessOrExit(err = CopySpan(paiDerBuffer, request->mPaiDer, request->mPaiDerLen));
+    SuccessOrExit(err = CopySpan(dacDerBuffer, request->mDacDer, request->mDacDerLen));
+    SuccessOrExit(err = CopySpan(attestationNonce, request->mAttestationNonce, request->mAttestationNonceLen));
+
+    {
+        std::lock_guard<std::mutex> lock(mQueueLock);
+        if (mQueueTail != nullptr)
+        {
+            mQueueTail->mNext = request;
+        }
+        else
+        {
+            mQueueHead = request;
+        }
+        mQueueTail = request;
+    }
+    mQueueCondition.notify_one();
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        Platform::Delete(request);
+    }
+    return err;
+}
+
+void AsyncDeviceAttestationVerifier::WorkerMain()
+{
+    for (;;)
+    {
+        VerificationRequest * request = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mQueueLock);
+            mQueueCondition.wait(lock, [this] { return !mRunning || mQueueHead != nullptr; });
+            if (!mRunning)
+            {
+                return;
+            }
+            request    = mQueueHead;
+            mQueueHead = request->mNext;
+            if (mQueueHead == nullptr)
+            {
+                mQueueTail = nullptr;
+            }
+        }
+
+        request->mResult = request->mVerifier->VerifyAttestationInformation(
+            ByteSpan(request->mAttestationInfo.Get(), request->mAttestationInfoLen),
+            ByteSpan(request->mAttestationChallenge.Get(), request->mAttestationChallengeLen),
+            ByteSpan(request->mAttestationSignature.Get(), request->mAttestationSignatureLen),
+            ByteSpan(request->mPaiDer.Get(), request->mPaiDerLen), ByteSpan(request->mDacDer.Get(), request->mDacDerLen),
+            ByteSpan(request->mAttestationNonce.Get(), request->mAttestationNonceLen));
+
+        DeviceLayer::PlatformMgr().ScheduleWork(NotifyComplete, reinterpret_cast<intptr_t>(request));
+    }
+}
+
+void AsyncDeviceAttestationVerifier::NotifyComplete(intptr_t arg)
+{
+    VerificationRequest * request = reinterpret_cast<VerificationRequest *>(arg);
+
+    request->mOnComplete->mCall(request->mOnComplete->mContext, request->mResult);
+    Platform::Delete(request);
+}
+
+#else // CHIP_CONFIG_DEVICE_ATTESTATION_WORKER_POOL_SIZE > 0
+
+CHIP_ERROR AsyncDeviceAttestationVerifier::Init()
+{
+    return CHIP_NO_ERROR;
+}
+
+void AsyncDeviceAttestationVerifier::Shutdown() {}
+
+CHIP_ERROR AsyncDeviceAttestationVerifier::VerifyAttestationInformation(
+    Credentials::DeviceAttestationVerifier * verifier, const ByteSpan & attestationInfoBuffer,
+    const ByteSpan & attestationChallengeBuffer, const ByteSpan & attestationSignatureBuffer, const ByteSpan & paiDerBuffer,
+    const ByteSpan & dacDerBuffer, const ByteSpan & attestationNonce,
+    Callback::Callback<OnAttestationVerificationComplete> * onComplete)
+{
+    VerifyOrReturnError(verifier != nullptr && onComplete != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // No worker pool configured: verify inline and complete before returning.
+    Credentials::AttestationVerificationResult result =
+        verifier->VerifyAttestationInformation(attestationInfoBuffer, attestationChallengeBuffer, attestationSignatureBuffer,
+                                               paiDerBuffer, dacDerBuffer, attestationNonce);
+    onComplete->mCall(onComplete->mContext, result);
+    return CHIP_NO_ERROR;
+}
+
+#endif // CHIP_CONFIG_DEVICE_ATTESTATION_WORKER_POOL_SIZE > 0
+
+} // namespace Controller
+} // namespace chip
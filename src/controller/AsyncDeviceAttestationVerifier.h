@@ -0,0 +1,140 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <credentials/DeviceAttestationVerifier.h>
+#include <lib/core/CHIPCallback.h>
+#include <lib/support/ScopedBuffer.h>
+
+#if CHIP_CONFIG_DEVICE_ATTESTATION_WORKER_POOL_SIZE > 0
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace chip {
+namespace Controller {
+
+/**
+ * @brief
+ *   Runs device attestation chain validation off the Matter event loop.
+ *
+ *   PAA/PAI/DAC validation is CPU bound (on the order of 100 ms of cert math
+ *   per device); commissioning many devices back to back would serialize that
+ *   work on the event loop. When
+ *   #CHIP_CONFIG_DEVICE_ATTESTATION_WORKER_POOL_SIZE is non-zero, submitted
+ *   verifications are copied onto a queue served by a pool of worker threads
+ *   and the result is posted back to the Matter thread via
+ *   PlatformManager::ScheduleWork, so the completion callback always runs on
+ *   the event loop.
+ *
+ *   When the pool size is zero (the default, suitable for constrained
+ *   devices), verification runs synchronously in VerifyAttestationInformation
+ *   and the callback is invoked inline before the call returns.
+ */
+class AsyncDeviceAttestationVerifier
+{
+public:
+    typedef void (*OnAttestationVerificationComplete)(void * context, Credentials::AttestationVerificationResult result);
+
+    AsyncDeviceAttestationVerifier() = default;
+    ~AsyncDeviceAttestationVerifier() { Shutdown(); }
+
+    // Not copyable: owns worker threads and queued requests.
+    AsyncDeviceAttestationVerifier(const AsyncDeviceAttestationVerifier &) = delete;
+    AsyncDeviceAttestationVerifier & operator=(const AsyncDeviceAttestationVerifier &) = delete;
+
+    /**
+     * Start the worker pool. Must be called after InitChipStack so that
+     * ScheduleWork is available to the workers. No-op when the pool size is
+     * configured to zero.
+     */
+    CHIP_ERROR Init();
+
+    /**
+     * Stop the worker pool. Requests still queued are discarded without their
+     * completion callback being invoked; callers must not rely on completion
+     * after Shutdown.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Verify an attestation information payload against a DAC/PAI chain.
+     *
+     * The input spans are copied before this call returns; the caller's
+     * buffers need not outlive the call. On CHIP_NO_ERROR the completion
+     * callback is guaranteed to be invoked on the Matter thread (or inline,
+     * in the synchronous configuration). On error the callback is never
+     * invoked.
+     *
+     * @param[in] verifier   The verifier to run; must remain valid until completion.
+     * @param[in] onComplete Completion callback, invoked with the verification result.
+     *
+     * Remaining parameters match DeviceAttestationVerifier::VerifyAttestationInformation.
+     */
+    CHIP_ERROR VerifyAttestationInformation(Credentials::DeviceAttestationVerifier * verifier,
+                                            const ByteSpan & attestationInfoBuffer, const ByteSpan & attestationChallengeBuffer,
+                                            const ByteSpan & attestationSignatureBuffer, const ByteSpan & paiDerBuffer,
+                                            const ByteSpan & dacDerBuffer, const ByteSpan & attestationNonce,
+                                            Callback::Callback<OnAttestationVerificationComplete> * onComplete);
+
+private:
+#if CHIP_CONFIG_DEVICE_ATTESTATION_WORKER_POOL_SIZE > 0
+    /**
+     * A queued verification request, holding owned copies of every input span.
+     */
+    struct VerificationRequest
+    {
+        Credentials::DeviceAttestationVerifier * mVerifier = nullptr;
+        Callback::Callback<OnAttestationVerificationComplete> * mOnComplete = nullptr;
+        Credentials::AttestationVerificationResult mResult = Credentials::AttestationVerificationResult::kInternalError;
+
+        Platform::ScopedMemoryBuffer<uint8_t> mAttestationInfo;
+        size_t mAttestationInfoLen = 0;
+        Platform::ScopedMemoryBuffer<uint8_t> mAttestationChallenge;
+        size_t mAttestationChallengeLen = 0;
+        Platform::ScopedMemoryBuffer<uint8_t> mAttestationSignature;
+        size_t mAttestationSignatureLen = 0;
+        Platform::ScopedMemoryBuffer<uint8_t> mPaiDer;
+        size_t mPaiDerLen = 0;
+        Platform::ScopedMemoryBuffer<uint8_t> mDacDer;
+        size_t mDacDerLen = 0;
+        Platform::ScopedMemoryBuffer<uint8_t> mAttestationNonce;
+        size_t mAttestationNonceLen = 0;
+
+        VerificationRequest * mNext = nullptr;
+    };
+
+    static CHIP_ERROR CopySpan(const ByteSpan & source, Platform::ScopedMemoryBuffer<uint8_t> & destination, size_t & length);
+
+    void WorkerMain();
+
+    // Runs on the Matter thread (scheduled by a worker) to deliver a result.
+    static void NotifyComplete(intptr_t arg);
+
+    std::mutex mQueueLock;
+    std::condition_variable mQueueCondition;
+    VerificationRequest * mQueueHead = nullptr;
+    VerificationRequest * mQueueTail = nullptr;
+    std::thread mWorkers[CHIP_CONFIG_DEVICE_ATTESTATION_WORKER_POOL_SIZE];
+    bool mRunning = false;
+#endif // CHIP_CONFIG_DEVICE_ATTESTATION_WORKER_POOL_SIZE > 0
+};
+
+} // namespace Controller
+} // namespace chip
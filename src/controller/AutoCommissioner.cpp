@@ -59,6 +59,8 @@ CommissioningStage AutoCommissioner::GetNextCommissioningStage(CommissioningStag
     case CommissioningStage::kSecurePairing:
         return CommissioningStage::kArmFailsafe;
     case CommissioningStage::kArmFailsafe:
+        return CommissioningStage::kReadCommissioningInfo;
+    case CommissioningStage::kReadCommissioningInfo:
         return CommissioningStage::kConfigRegulatory;
     case CommissioningStage::kConfigRegulatory:
         return CommissioningStage::kDeviceAttestation;
@@ -46,6 +46,7 @@
 #include <app/InteractionModelEngine.h>
 #include <app/OperationalDeviceProxy.h>
 #include <app/util/error-mapping.h>
+#include <controller/CommissionableNodeDiscoveryCache.h>
 #include <credentials/CHIPCert.h>
 #include <credentials/DeviceAttestationCredsProvider.h>
 #include <crypto/CHIPCryptoPAL.h>
@@ -166,10 +167,21 @@ CHIP_ERROR DeviceController::Init(ControllerInitParams params)
 #else
         .dnsResolver = nullptr,
 #endif
+        .persistedAddressCache    = (mStorageDelegate != nullptr) ? &mPersistedAddressCache : nullptr,
+        .sessionResumptionStorage = mStorageDelegate,
     };
 
+    // With storage attached, reconnections after a controller restart start from the
+    // persisted peer addresses and CASE resumption state instead of a fresh DNS-SD
+    // resolution and full CASE handshake for every device.
+    if (mStorageDelegate != nullptr)
+    {
+        ReturnErrorOnFailure(mPersistedAddressCache.Init(mStorageDelegate));
+    }
+
     mCASESessionManager = chip::Platform::New<CASESessionManager>(sessionManagerConfig);
     VerifyOrReturnError(mCASESessionManager != nullptr, CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(mCASESessionManager->Init());
 
     mSystemState = params.systemState->Retain();
     mState       = State::Initialized;
@@ -609,7 +621,9 @@ DeviceCommissioner::DeviceCommissioner() :
     mOnAttestationFailureCallback(OnAttestationFailureResponse, this), mOnCSRFailureCallback(OnCSRFailureResponse, this),
     mOnCertFailureCallback(OnAddNOCFailureResponse, this), mOnRootCertFailureCallback(OnRootCertFailureResponse, this),
     mOnDeviceConnectedCallback(OnDeviceConnectedFn, this), mOnDeviceConnectionFailureCallback(OnDeviceConnectionFailureFn, this),
-    mDeviceNOCChainCallback(OnDeviceNOCChainGeneration, this), mSetUpCodePairer(this), mAutoCommissioner(this)
+    mDeviceNOCChainCallback(OnDeviceNOCChainGeneration, this),
+    mAttestationVerificationCallback(OnAttestationVerificationResult, this), mSetUpCodePairer(this), mAutoCommissioner(this),
+    mCommissioningReadCallback(this)
 {
     mPairingDelegate         = nullptr;
     mPairedDevicesUpdated    = false;
@@ -656,6 +670,9 @@ CHIP_ERROR DeviceCommissioner::Init(CommissionerInitParams params)
 #if CONFIG_NETWORK_LAYER_BLE
     mSetUpCodePairer.SetBleLayer(mSystemState->BleLayer());
 #endif // CONFIG_NETWORK_LAYER_BLE
+
+    ReturnErrorOnFailure(mAsyncAttestationVerifier.Init());
+
     return CHIP_NO_ERROR;
 }
 
@@ -680,6 +697,8 @@ CHIP_ERROR DeviceCommissioner::Shutdown()
     }
 #endif // CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY
 
+    mAsyncAttestationVerifier.Shutdown();
+
     DeviceController::Shutdown();
     return CHIP_NO_ERROR;
 }
@@ -998,6 +1017,10 @@ void DeviceCommissioner::OnSessionEstablishmentError(CHIP_ERROR err)
         ReleaseCommissioneeDevice(mDeviceBeingCommissioned);
         mDeviceBeingCommissioned = nullptr;
     }
+
+    // If the pairing was initiated from a setup code, let the pairer race any
+    // other candidates it has discovered.
+    mSetUpCodePairer.OnPairingComplete(err);
 }
 
 void DeviceCommissioner::OnSessionEstablished()
@@ -1021,6 +1044,8 @@ void DeviceCommissioner::OnSessionEstablished()
 
     ChipLogDetail(Controller, "Remote device completed SPAKE2+ handshake");
 
+    mSetUpCodePairer.OnPairingComplete(CHIP_NO_ERROR);
+
     // TODO: Add code to receive OpCSR from the device, and process the signing request
     // For IP rendezvous, this is sent as part of the state machine.
     if (mRunCommissioningAfterConnection)
@@ -1156,7 +1181,14 @@ void DeviceCommissioner::OnAttestationResponse(void * context, chip::ByteSpan at
     commissioner->mAttestationResponseCallback.Cancel();
     commissioner->mOnAttestationFailureCallback.Cancel();
 
-    commissioner->HandleAttestationResult(commissioner->ValidateAttestationInfo(attestationElements, signature));
+    CHIP_ERROR err = commissioner->ValidateAttestationInfo(attestationElements, signature);
+    if (err != CHIP_NO_ERROR)
+    {
+        // Verification could not even be started; report the failure.
+        // Otherwise OnAttestationVerificationResult advances the flow once the
+        // verifier completes.
+        commissioner->HandleAttestationResult(err);
+    }
 }
 
 CHIP_ERROR DeviceCommissioner::ValidateAttestationInfo(const ByteSpan & attestationElements, const ByteSpan & signature)
@@ -1174,8 +1206,20 @@ CHIP_ERROR DeviceCommissioner::ValidateAttestationInfo(const ByteSpan & attestat
                                         ->GetCryptoContext()
                                         .GetAttestationChallenge();
 
-    AttestationVerificationResult result = dac_verifier->VerifyAttestationInformation(
-        attestationElements, attestationChallenge, signature, device->GetPAI(), device->GetDAC(), device->GetAttestationNonce());
+    // Validation is CPU bound; hand it to the attestation worker pool (when one
+    // is configured) so that the event loop stays responsive, and advance the
+    // commissioning flow from OnAttestationVerificationResult.
+    return mAsyncAttestationVerifier.VerifyAttestationInformation(dac_verifier, attestationElements, attestationChallenge,
+                                                                  signature, device->GetPAI(), device->GetDAC(),
+                                                                  device->GetAttestationNonce(),
+                                                                  &mAttestationVerificationCallback);
+}
+
+void DeviceCommissioner::OnAttestationVerificationResult(void * context, AttestationVerificationResult result)
+{
+    DeviceCommissioner * commissioner = reinterpret_cast<DeviceCommissioner *>(context);
+    CHIP_ERROR err                    = CHIP_NO_ERROR;
+
     if (result != AttestationVerificationResult::kSuccess)
     {
         if (result == AttestationVerificationResult::kNotImplemented)
@@ -1183,7 +1227,7 @@ CHIP_ERROR DeviceCommissioner::ValidateAttestationInfo(const ByteSpan & attestat
             ChipLogError(Controller,
                          "Failed in verifying 'Attestation Information' command received from the device due to default "
                          "DeviceAttestationVerifier Class not being overriden by a real implementation.");
-            return CHIP_ERROR_NOT_IMPLEMENTED;
+            err = CHIP_ERROR_NOT_IMPLEMENTED;
         }
         else
         {
@@ -1193,15 +1237,17 @@ CHIP_ERROR DeviceCommissioner::ValidateAttestationInfo(const ByteSpan & attestat
                          static_cast<uint16_t>(result));
             // Go look at AttestationVerificationResult enum in src/credentials/DeviceAttestationVerifier.h to understand the
             // errors.
-            return CHIP_ERROR_INTERNAL;
+            err = CHIP_ERROR_INTERNAL;
         }
     }
+    else
+    {
+        ChipLogProgress(Controller, "Successfully validated 'Attestation Information' command received from the device.");
 
-    ChipLogProgress(Controller, "Successfully validated 'Attestation Information' command received from the device.");
-
-    // TODO: Validate Firmware Information
+        // TODO: Validate Firmware Information
+    }
 
-    return CHIP_NO_ERROR;
+    commissioner->HandleAttestationResult(err);
 }
 
 void DeviceCommissioner::HandleAttestationResult(CHIP_ERROR err)
@@ -1503,6 +1549,14 @@ CHIP_ERROR DeviceCommissioner::OnOperationalCredentialsProvisioningCompletion(Co
     mPairedDevices.Insert(device->GetDeviceId());
     mPairedDevicesUpdated = true;
 
+    // The device will shortly begin advertising operationally on the fabric it just joined;
+    // pre-resolve its address in the background so the first operational interaction does
+    // not pay DNS-SD resolution latency.
+    if (mFabricInfo != nullptr)
+    {
+        LogErrorOnFailure(mCASESessionManager->RequestPreResolution(mFabricInfo->GetPeerIdForNode(device->GetDeviceId())));
+    }
+
     if (mPairingDelegate != nullptr)
     {
         mPairingDelegate->OnStatusUpdate(DevicePairingDelegate::SecurePairingSuccess);
@@ -1544,7 +1598,14 @@ void DeviceCommissioner::OnSessionEstablishmentTimeoutCallback(System::Layer * a
 CHIP_ERROR DeviceCommissioner::DiscoverCommissionableNodes(Dnssd::DiscoveryFilter filter)
 {
     ReturnErrorOnFailure(SetUpNodeDiscovery());
-    return mDNSResolver.FindCommissionableNodes(filter);
+    ReturnErrorOnFailure(mDNSResolver.FindCommissionableNodes(filter));
+
+    // Replay fresh matches another controller instance in this process already
+    // browsed up, so callers are not gated on mDNS browse latency for nodes
+    // that are already known.  The browse above still runs and refreshes them.
+    CommissionableNodeDiscoveryCache::GetInstance().ForEachFreshNode(
+        filter, [this](const Dnssd::DiscoveredNodeData & nodeData) { OnNodeDiscoveryComplete(nodeData); });
+    return CHIP_NO_ERROR;
 }
 
 const Dnssd::DiscoveredNodeData * DeviceCommissioner::GetDiscoveredDevice(int idx)
@@ -1597,6 +1658,7 @@ void DeviceCommissioner::OnNodeDiscoveryComplete(const chip::Dnssd::DiscoveredNo
         mUdcServer->OnCommissionableNodeFound(nodeData);
     }
 #endif // CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY
+    CommissionableNodeDiscoveryCache::GetInstance().OnNodeDiscovered(nodeData);
     AbstractDnssdDiscoveryController::OnNodeDiscoveryComplete(nodeData);
     mSetUpCodePairer.NotifyCommissionableDeviceDiscovered(nodeData);
 }
@@ -1698,6 +1760,66 @@ void DeviceCommissioner::OnDeviceConnectionFailureFn(void * context, PeerId peer
     commissioner->mPairingDelegate->OnCommissioningComplete(peerId.GetNodeId(), error);
 }
 
+CHIP_ERROR DeviceCommissioner::SendCommissioningReadRequest(DeviceProxy * proxy)
+{
+    VerifyOrReturnError(proxy != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(proxy->GetSecureSession().HasValue(), CHIP_ERROR_INCORRECT_STATE);
+
+    // Everything later stages need from the commissionee is fetched in one read
+    // interaction here and answered from the cache afterwards, instead of one
+    // round trip per value. The paths are only referenced while the request is
+    // being encoded, so stack storage is sufficient.
+    app::AttributePathParams readPaths[] = {
+        // Network commissioning features (WiFi/Thread/Ethernet support)
+        app::AttributePathParams(kRootEndpointId, app::Clusters::NetworkCommissioning::Id,
+                                 app::Clusters::NetworkCommissioning::Attributes::FeatureMap::Id),
+        // Regulatory configuration and commissioning timing info
+        app::AttributePathParams(kRootEndpointId, app::Clusters::GeneralCommissioning::Id,
+                                 app::Clusters::GeneralCommissioning::Attributes::RegulatoryConfig::Id),
+        app::AttributePathParams(kRootEndpointId, app::Clusters::GeneralCommissioning::Id,
+                                 app::Clusters::GeneralCommissioning::Attributes::LocationCapability::Id),
+        app::AttributePathParams(kRootEndpointId, app::Clusters::GeneralCommissioning::Id,
+                                 app::Clusters::GeneralCommissioning::Attributes::BasicCommissioningInfoList::Id),
+        // Vendor and product identity, for cross-checks during attestation
+        app::AttributePathParams(kRootEndpointId, app::Clusters::Basic::Id, app::Clusters::Basic::Attributes::VendorID::Id),
+        app::AttributePathParams(kRootEndpointId, app::Clusters::Basic::Id, app::Clusters::Basic::Attributes::ProductID::Id),
+    };
+
+    auto attributeCache = Platform::MakeUnique<app::AttributeCache>(mCommissioningReadCallback);
+    VerifyOrReturnError(attributeCache != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    app::ReadPrepareParams readParams(proxy->GetSecureSession().Value());
+    readParams.mpAttributePathParamsList    = readPaths;
+    readParams.mAttributePathParamsListSize = ArraySize(readPaths);
+
+    app::ReadClient * readClient = nullptr;
+    ReturnErrorOnFailure(app::InteractionModelEngine::GetInstance()->NewReadClient(&readClient, app::ReadClient::InteractionType::Read,
+                                                                                   &attributeCache->GetBufferedCallback()));
+
+    CHIP_ERROR err = readClient->SendRequest(readParams);
+    if (err != CHIP_NO_ERROR)
+    {
+        readClient->Shutdown();
+        return err;
+    }
+
+    mAttributeCache = std::move(attributeCache);
+    return CHIP_NO_ERROR;
+}
+
+void CommissioningReadCallback::OnError(const app::ReadClient * apReadClient, CHIP_ERROR aError)
+{
+    // The cached values are an optimization, not a requirement: stages that
+    // find the cache empty fall back to their own interactions, so a failed
+    // read logs and lets OnDone advance commissioning as usual.
+    ChipLogError(Controller, "Failed to read commissioning information: err %s", ErrorStr(aError));
+}
+
+void CommissioningReadCallback::OnDone(app::ReadClient * apReadClient)
+{
+    mCommissioner->CommissioningStageComplete(CHIP_NO_ERROR);
+}
+
 void DeviceCommissioner::PerformCommissioningStep(DeviceProxy * proxy, CommissioningStage step, CommissioningParameters & params,
                                                   CommissioningDelegate * delegate)
 {
@@ -1727,6 +1849,17 @@ void DeviceCommissioner::PerformCommissioningStep(DeviceProxy * proxy, Commissio
         genCom.ArmFailSafe(mSuccess.Cancel(), mFailure.Cancel(), commissioningExpirySeconds, breadcrumb, kCommandTimeoutMs);
     }
     break;
+    case CommissioningStage::kReadCommissioningInfo: {
+        ChipLogProgress(Controller, "Sending read request for commissioning information");
+        CHIP_ERROR status = SendCommissioningReadRequest(proxy);
+        if (status != CHIP_NO_ERROR)
+        {
+            ChipLogError(Controller, "Failed in sending commissioning information read request: err %s", ErrorStr(status));
+            OnSessionEstablishmentError(status);
+            return;
+        }
+    }
+    break;
     case CommissioningStage::kConfigRegulatory: {
         // To set during config phase:
         // UTC time
@@ -28,6 +28,7 @@
 
 #pragma once
 
+#include <app/AttributeCache.h>
 #include <app/CASEClientPool.h>
 #include <app/CASESessionManager.h>
 #include <app/DeviceControllerInteractionModelDelegate.h>
@@ -36,6 +37,7 @@
 #include <app/OperationalDeviceProxyPool.h>
 #include <controller-clusters/zap-generated/CHIPClientCallbacks.h>
 #include <controller/AbstractDnssdDiscoveryController.h>
+#include <controller/AsyncDeviceAttestationVerifier.h>
 #include <controller/AutoCommissioner.h>
 #include <controller/CHIPDeviceControllerSystemState.h>
 #include <controller/CommissioneeDeviceProxy.h>
@@ -48,6 +50,8 @@
 #include <lib/core/CHIPCore.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/core/CHIPTLV.h>
+#include <lib/dnssd/PersistedAddressCache.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/DLLUtil.h>
 #include <lib/support/Pool.h>
 #include <lib/support/SerializableIntegerSet.h>
@@ -337,6 +341,7 @@ protected:
     CASESessionManager * mCASESessionManager = nullptr;
 
     Dnssd::DnssdCache<CHIP_CONFIG_MDNS_CACHE_SIZE> mDNSCache;
+    Dnssd::PersistedAddressCache mPersistedAddressCache;
     CASEClientPool<CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_CASE_CLIENTS> mCASEClientPool;
     OperationalDeviceProxyPool<CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_DEVICES> mDevicePool;
 
@@ -418,6 +423,25 @@ private:
     uint16_t mPAKEVerifierID = 1;
 };
 
+class DeviceCommissioner;
+
+/**
+ * @brief
+ *   Receives the AttributeCache callbacks for the batched commissioning
+ *   information read and reports stage completion back to the commissioner.
+ */
+class CommissioningReadCallback : public app::AttributeCache::Callback
+{
+public:
+    CommissioningReadCallback(DeviceCommissioner * commissioner) : mCommissioner(commissioner) {}
+
+private:
+    void OnError(const app::ReadClient * apReadClient, CHIP_ERROR aError) override;
+    void OnDone(app::ReadClient * apReadClient) override;
+
+    DeviceCommissioner * mCommissioner;
+};
+
 /**
  * @brief
  *   The commissioner applications can use this class to pair new/unpaired CHIP devices. The application is
@@ -565,6 +589,14 @@ public:
 
     void CommissioningStageComplete(CHIP_ERROR err);
 
+    /**
+     * @brief
+     *   Commissioning information fetched from the commissionee by the batched
+     *   kReadCommissioningInfo read, available to later commissioning stages.
+     *   Returns nullptr before that stage has run.
+     */
+    app::AttributeCache * GetAttributeCache() { return mAttributeCache.get(); }
+
 #if CONFIG_NETWORK_LAYER_BLE
     /**
      * @brief
@@ -725,6 +757,13 @@ private:
     static void OnAttestationFailureResponse(void * context, uint8_t status);
     static void OnAttestationResponse(void * context, chip::ByteSpan attestationElements, chip::ByteSpan signature);
 
+    /**
+     * @brief
+     *   This function is called (on the Matter thread) once the attestation
+     *   verifier has finished validating the Attestation Information.
+     */
+    static void OnAttestationVerificationResult(void * context, Credentials::AttestationVerificationResult result);
+
     /**
      * @brief
      *   This function is called by the IM layer when the commissioner receives the CSR from the device.
@@ -783,6 +822,10 @@ private:
     CommissioneeDeviceProxy * FindCommissioneeDevice(NodeId id);
     void ReleaseCommissioneeDevice(CommissioneeDeviceProxy * device);
 
+    /* This function sends the single batched read request that fetches all the
+       commissioning information needed by later stages into mAttributeCache. */
+    CHIP_ERROR SendCommissioningReadRequest(DeviceProxy * proxy);
+
     // Cluster callbacks for advancing commissioning flows
     Callback::Callback<BasicSuccessCallback> mSuccess;
     Callback::Callback<BasicFailureCallback> mFailure;
@@ -804,9 +847,14 @@ private:
     Callback::Callback<OnDeviceConnectionFailure> mOnDeviceConnectionFailureCallback;
 
     Callback::Callback<OnNOCChainGeneration> mDeviceNOCChainCallback;
+    Callback::Callback<AsyncDeviceAttestationVerifier::OnAttestationVerificationComplete> mAttestationVerificationCallback;
+    AsyncDeviceAttestationVerifier mAsyncAttestationVerifier;
     SetUpCodePairer mSetUpCodePairer;
     AutoCommissioner mAutoCommissioner;
     CommissioningDelegate * mCommissioningDelegate = nullptr;
+
+    CommissioningReadCallback mCommissioningReadCallback;
+    Platform::UniquePtr<app::AttributeCache> mAttributeCache;
 };
 
 } // namespace Controller
@@ -0,0 +1,98 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+// module header, comes first
+#include <controller/CommissionableNodeDiscoveryCache.h>
+
+#include <string.h>
+
+namespace chip {
+namespace Controller {
+
+CommissionableNodeDiscoveryCache & CommissionableNodeDiscoveryCache::GetInstance()
+{
+    static CommissionableNodeDiscoveryCache sInstance;
+    return sInstance;
+}
+
+void CommissionableNodeDiscoveryCache::OnNodeDiscovered(const Dnssd::DiscoveredNodeData & nodeData)
+{
+    if (!nodeData.IsValid())
+    {
+        return;
+    }
+
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+
+    Entry * victim = nullptr;
+    for (auto & entry : mEntries)
+    {
+        if (entry.mNodeData.IsValid() && strcmp(entry.mNodeData.instanceName, nodeData.instanceName) == 0)
+        {
+            victim = &entry;
+            break;
+        }
+        // Fall back to the least recently refreshed slot; invalid slots have a
+        // zero timestamp and are picked up first.
+        if (victim == nullptr || entry.mUpdateTime < victim->mUpdateTime)
+        {
+            victim = &entry;
+        }
+    }
+
+    victim->mNodeData   = nodeData;
+    victim->mUpdateTime = now;
+}
+
+void CommissionableNodeDiscoveryCache::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        entry.mNodeData.Reset();
+        entry.mUpdateTime = System::Clock::kZero;
+    }
+}
+
+bool CommissionableNodeDiscoveryCache::NodeMatchesFilter(const Dnssd::DiscoveredNodeData & nodeData,
+                                                         const Dnssd::DiscoveryFilter & filter)
+{
+    switch (filter.type)
+    {
+    case Dnssd::DiscoveryFilterType::kNone:
+        return true;
+    case Dnssd::DiscoveryFilterType::kShortDiscriminator:
+        return ((nodeData.longDiscriminator >> 8) & 0x0F) == filter.code;
+    case Dnssd::DiscoveryFilterType::kLongDiscriminator:
+        return nodeData.longDiscriminator == filter.code;
+    case Dnssd::DiscoveryFilterType::kVendorId:
+        return nodeData.vendorId == filter.code;
+    case Dnssd::DiscoveryFilterType::kDeviceType:
+        return nodeData.deviceType == filter.code;
+    case Dnssd::DiscoveryFilterType::kCommissioningMode:
+        return nodeData.commissioningMode == filter.code;
+    case Dnssd::DiscoveryFilterType::kInstanceName:
+        return filter.instanceName != nullptr && strcmp(nodeData.instanceName, filter.instanceName) == 0;
+    default:
+        // Filters that key on data the commissionable browse does not carry
+        // (e.g. compressed fabric id) can never be answered from the cache.
+        return false;
+    }
+}
+
+} // namespace Controller
+} // namespace chip
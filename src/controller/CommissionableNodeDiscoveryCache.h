@@ -0,0 +1,93 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/dnssd/Resolver.h>
+#include <platform/CHIPDeviceConfig.h>
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace Controller {
+
+/**
+ * @brief
+ *   Process-wide cache of commissionable nodes seen by any controller's mDNS
+ *   browse.  Deployments that run several controller instances in one process
+ *   would otherwise pay full browse latency per instance for nodes another
+ *   instance has already found; with the cache, a new discovery request is
+ *   answered immediately from fresh entries while its own browse runs in the
+ *   background.
+ *
+ *   All controllers run on the Matter event loop, so access is not locked.
+ */
+class CommissionableNodeDiscoveryCache
+{
+public:
+    static CommissionableNodeDiscoveryCache & GetInstance();
+
+    /// Insert or refresh the cache entry for the given node, keyed by its
+    /// DNS-SD instance name.
+    void OnNodeDiscovered(const Dnssd::DiscoveredNodeData & nodeData);
+
+    /**
+     * Invoke the visitor for every cached entry that matches the filter and is
+     * younger than kEntryLifetime.  Returns the number of entries visited.
+     */
+    template <typename Visitor>
+    size_t ForEachFreshNode(const Dnssd::DiscoveryFilter & filter, Visitor visitor)
+    {
+        const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+        size_t matches                     = 0;
+        for (auto & entry : mEntries)
+        {
+            if (!entry.mNodeData.IsValid() || (now - entry.mUpdateTime > kEntryLifetime) ||
+                !NodeMatchesFilter(entry.mNodeData, filter))
+            {
+                continue;
+            }
+            matches++;
+            visitor(entry.mNodeData);
+        }
+        return matches;
+    }
+
+    /// Drop all cached entries.
+    void Clear();
+
+    static bool NodeMatchesFilter(const Dnssd::DiscoveredNodeData & nodeData, const Dnssd::DiscoveryFilter & filter);
+
+    static constexpr size_t kCacheSize = CHIP_DEVICE_CONFIG_MAX_DISCOVERED_NODES;
+
+    // mDNS answers for commissionable nodes are re-announced well within this
+    // window while a commissioning window is open; anything older may describe
+    // a closed window or stale address and is ignored.
+    static constexpr System::Clock::Timeout kEntryLifetime = System::Clock::Milliseconds32(30 * 1000);
+
+private:
+    struct Entry
+    {
+        Dnssd::DiscoveredNodeData mNodeData;
+        System::Clock::Timestamp mUpdateTime = System::Clock::kZero;
+    };
+
+    Entry mEntries[kCacheSize];
+};
+
+} // namespace Controller
+} // namespace chip
@@ -0,0 +1,152 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/CommissioningBatchScheduler.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace Controller {
+
+CHIP_ERROR CommissioningBatchScheduler::Init(DeviceCommissioner * commissioner, DevicePairingDelegate * appDelegate,
+                                             uint8_t maxConcurrentDevices)
+{
+    VerifyOrReturnError(commissioner != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(maxConcurrentDevices > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mCommissioner         = commissioner;
+    mAppDelegate          = appDelegate;
+    mMaxConcurrentDevices = maxConcurrentDevices < kMaxSupportedConcurrency ? maxConcurrentDevices : kMaxSupportedConcurrency;
+    mQueueHead            = 0;
+    mQueuedCount          = 0;
+    mInFlightCount        = 0;
+    mInFlightDeviceId     = kUndefinedNodeId;
+
+    mCommissioner->RegisterPairingDelegate(this);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CommissioningBatchScheduler::Enqueue(NodeId remoteDeviceId, const RendezvousParameters & rendezvousParams,
+                                                const CommissioningParameters & commissioningParams)
+{
+    VerifyOrReturnError(mCommissioner != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mQueuedCount < kMaxQueuedDevices, CHIP_ERROR_NO_MEMORY);
+
+    QueuedDevice & entry       = mQueue[(mQueueHead + mQueuedCount) % kMaxQueuedDevices];
+    entry.mRemoteDeviceId      = remoteDeviceId;
+    entry.mRendezvousParams    = rendezvousParams;
+    entry.mCommissioningParams = commissioningParams;
+    mQueuedCount++;
+
+    AdmitQueuedDevices();
+    return CHIP_NO_ERROR;
+}
+
+void CommissioningBatchScheduler::ClearQueue()
+{
+    mQueuedCount = 0;
+}
+
+void CommissioningBatchScheduler::AdmitQueuedDevices()
+{
+    while (mQueuedCount > 0 && mInFlightCount < mMaxConcurrentDevices)
+    {
+        QueuedDevice & entry = mQueue[mQueueHead];
+        mQueueHead           = (mQueueHead + 1) % kMaxQueuedDevices;
+        mQueuedCount--;
+
+        ChipLogProgress(Controller, "Starting commissioning of queued device 0x" ChipLogFormatX64 " (%u still queued)",
+                        ChipLogValueX64(entry.mRemoteDeviceId), static_cast<unsigned>(mQueuedCount));
+
+        CHIP_ERROR err = mCommissioner->PairDevice(entry.mRemoteDeviceId, entry.mRendezvousParams, entry.mCommissioningParams);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Controller, "Failed to start commissioning of device 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueX64(entry.mRemoteDeviceId), err.Format());
+            if (mAppDelegate != nullptr)
+            {
+                mAppDelegate->OnCommissioningComplete(entry.mRemoteDeviceId, err);
+            }
+            continue;
+        }
+
+        mInFlightCount++;
+        mInFlightDeviceId = entry.mRemoteDeviceId;
+    }
+}
+
+void CommissioningBatchScheduler::DeviceFinished(NodeId deviceId, CHIP_ERROR error)
+{
+    VerifyOrReturn(mInFlightCount > 0);
+
+    mInFlightCount--;
+    mInFlightDeviceId = kUndefinedNodeId;
+
+    if (error != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Commissioning of device 0x" ChipLogFormatX64 " failed: %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(deviceId), error.Format());
+    }
+
+    AdmitQueuedDevices();
+}
+
+void CommissioningBatchScheduler::OnStatusUpdate(DevicePairingDelegate::Status status)
+{
+    if (mAppDelegate != nullptr)
+    {
+        mAppDelegate->OnStatusUpdate(status);
+    }
+}
+
+void CommissioningBatchScheduler::OnPairingComplete(CHIP_ERROR error)
+{
+    if (mAppDelegate != nullptr)
+    {
+        mAppDelegate->OnPairingComplete(error);
+    }
+
+    // A failed PASE session means OnCommissioningComplete will never be
+    // delivered for this device; retire it so the next queued device starts.
+    if (error != CHIP_NO_ERROR)
+    {
+        DeviceFinished(mInFlightDeviceId, error);
+    }
+}
+
+void CommissioningBatchScheduler::OnPairingDeleted(CHIP_ERROR error)
+{
+    if (mAppDelegate != nullptr)
+    {
+        mAppDelegate->OnPairingDeleted(error);
+    }
+}
+
+void CommissioningBatchScheduler::OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error)
+{
+    if (mAppDelegate != nullptr)
+    {
+        mAppDelegate->OnCommissioningComplete(deviceId, error);
+    }
+
+    DeviceFinished(deviceId, error);
+}
+
+} // namespace Controller
+} // namespace chip
@@ -0,0 +1,119 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+#include <controller/CHIPDeviceController.h>
+#include <controller/CommissioningDelegate.h>
+#include <protocols/secure_channel/RendezvousParameters.h>
+
+namespace chip {
+namespace Controller {
+
+/**
+ * @brief
+ *   Schedules commissioning of a batch of devices through a DeviceCommissioner.
+ *
+ *   Applications that onboard many devices per job enqueue all of them up front;
+ *   the scheduler admits up to a configurable number of devices at a time and
+ *   starts the next queued device as soon as one finishes (with success or
+ *   error), so the commissioner is never idle between devices.
+ *
+ *   The scheduler registers itself as the commissioner's pairing delegate and
+ *   forwards every notification to the application delegate passed to Init.
+ */
+class CommissioningBatchScheduler : public DevicePairingDelegate
+{
+public:
+    // Maximum number of devices that may be queued at any one time.
+    static constexpr size_t kMaxQueuedDevices = 64;
+
+    // The commissioner tracks a single device being commissioned and routes all
+    // session-establishment callbacks to it, so only one device can be in
+    // flight at a time.  The admission limit passed to Init is clamped to this;
+    // raising it here requires the commissioner to support multiple
+    // concurrent commissionees first.
+    static constexpr uint8_t kMaxSupportedConcurrency = 1;
+
+    /**
+     * @brief
+     *   Attach the scheduler to a commissioner.  Replaces the commissioner's
+     *   pairing delegate; appDelegate (if not null) continues to receive all
+     *   pairing notifications through the scheduler.
+     *
+     * @param[in] commissioner         The commissioner to drive.  Must outlive the scheduler.
+     * @param[in] appDelegate          The application's pairing delegate, may be nullptr.
+     * @param[in] maxConcurrentDevices Requested admission limit; clamped to
+     *                                 kMaxSupportedConcurrency.  Must be non-zero.
+     */
+    CHIP_ERROR Init(DeviceCommissioner * commissioner, DevicePairingDelegate * appDelegate, uint8_t maxConcurrentDevices);
+
+    /**
+     * @brief
+     *   Queue a device for commissioning.  Commissioning starts immediately if
+     *   the admission limit allows, otherwise when an in-flight device finishes.
+     *
+     *   As with DeviceCommissioner::PairDevice, the memory referenced by the
+     *   ByteSpans inside the parameters must remain valid until the device has
+     *   been admitted (i.e. until its OnCommissioningComplete notification).
+     *
+     * @retval #CHIP_ERROR_NO_MEMORY If kMaxQueuedDevices devices are already queued.
+     */
+    CHIP_ERROR Enqueue(NodeId remoteDeviceId, const RendezvousParameters & rendezvousParams,
+                       const CommissioningParameters & commissioningParams);
+
+    /**
+     * @brief
+     *   Drop all queued devices.  Devices already in flight are not affected.
+     */
+    void ClearQueue();
+
+    size_t GetQueuedDeviceCount() const { return mQueuedCount; }
+    size_t GetInFlightDeviceCount() const { return mInFlightCount; }
+
+    //////////// DevicePairingDelegate Implementation ///////////////
+    void OnStatusUpdate(DevicePairingDelegate::Status status) override;
+    void OnPairingComplete(CHIP_ERROR error) override;
+    void OnPairingDeleted(CHIP_ERROR error) override;
+    void OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error) override;
+
+private:
+    struct QueuedDevice
+    {
+        NodeId mRemoteDeviceId = kUndefinedNodeId;
+        RendezvousParameters mRendezvousParams;
+        CommissioningParameters mCommissioningParams;
+    };
+
+    // Start queued devices until the admission limit is reached or the queue is empty.
+    void AdmitQueuedDevices();
+    void DeviceFinished(NodeId deviceId, CHIP_ERROR error);
+
+    DeviceCommissioner * mCommissioner     = nullptr;
+    DevicePairingDelegate * mAppDelegate   = nullptr;
+    uint8_t mMaxConcurrentDevices          = kMaxSupportedConcurrency;
+
+    // FIFO of devices waiting for admission.
+    QueuedDevice mQueue[kMaxQueuedDevices];
+    size_t mQueueHead   = 0;
+    size_t mQueuedCount = 0;
+
+    size_t mInFlightCount    = 0;
+    NodeId mInFlightDeviceId = kUndefinedNodeId;
+};
+
+} // namespace Controller
+} // namespace chip
@@ -28,6 +28,7 @@ enum CommissioningStage : uint8_t
     kError,
     kSecurePairing,
     kArmFailsafe,
+    kReadCommissioningInfo,
     // kConfigTime,  // NOT YET IMPLEMENTED
     // kConfigTimeZone,  // NOT YET IMPLEMENTED
     // kConfigDST,  // NOT YET IMPLEMENTED
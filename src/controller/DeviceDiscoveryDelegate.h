@@ -29,7 +29,16 @@ class DLL_EXPORT DeviceDiscoveryDelegate
 {
 public:
     virtual ~DeviceDiscoveryDelegate() {}
+
+    /// Invoked when a node is seen for the first time since discovery started.
     virtual void OnDiscoveredDevice(const chip::Dnssd::DiscoveredNodeData & nodeData) = 0;
+
+    /// Invoked when an already reported node re-announces with different data
+    /// (new address, port, commissioning state, ...). Re-announcements that carry
+    /// no changes are filtered out and reported through neither callback.
+    /// Defaults to forwarding to OnDiscoveredDevice for delegates that do not
+    /// distinguish additions from updates.
+    virtual void OnDiscoveredDeviceUpdated(const chip::Dnssd::DiscoveredNodeData & nodeData) { OnDiscoveredDevice(nodeData); }
 };
 
 } // namespace Controller
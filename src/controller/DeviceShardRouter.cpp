@@ -0,0 +1,61 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/DeviceShardRouter.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace Controller {
+
+CHIP_ERROR DeviceShardRouter::Init(uint16_t shardCount)
+{
+    VerifyOrReturnError(shardCount >= 1 && shardCount <= kMaxShards, CHIP_ERROR_INVALID_ARGUMENT);
+    mShardCount = shardCount;
+    return CHIP_NO_ERROR;
+}
+
+uint64_t DeviceShardRouter::ShardWeight(NodeId nodeId, uint16_t shard)
+{
+    // SplitMix64 finalizer over the combined key.  The quality requirement here is only
+    // that weights be well distributed and identical on every host; this mixer is cheap
+    // and has no platform-dependent behavior.
+    uint64_t z = nodeId + (static_cast<uint64_t>(shard) + 1) * 0x9E3779B97F4A7C15ULL;
+    z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z          = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+uint16_t DeviceShardRouter::GetShardForDevice(NodeId nodeId) const
+{
+    uint16_t bestShard  = 0;
+    uint64_t bestWeight = ShardWeight(nodeId, 0);
+    for (uint16_t shard = 1; shard < mShardCount; shard++)
+    {
+        const uint64_t weight = ShardWeight(nodeId, shard);
+        if (weight > bestWeight)
+        {
+            bestWeight = weight;
+            bestShard  = shard;
+        }
+    }
+    return bestShard;
+}
+
+} // namespace Controller
+} // namespace chip
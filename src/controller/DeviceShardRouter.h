@@ -0,0 +1,76 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/NodeId.h>
+
+namespace chip {
+namespace Controller {
+
+/**
+ * @brief
+ *   Deterministic device-to-shard mapping for deployments that run several
+ *   controller instances ("shards") against one device population.
+ *
+ *   The CHIP stack's platform and system layers are process-wide singletons, so
+ *   a shard is one controller process with its own event loop, UDP endpoints
+ *   (the operational port is shared between shards via SO_REUSEPORT, set when
+ *   UDP endpoints bind), and session tables.  Every shard and every front-end
+ *   routing traffic to the shards constructs a router with the same shard
+ *   count and gets the same answer for every device, with no shared state and
+ *   no coordination.
+ *
+ *   The mapping uses rendezvous (highest-random-weight) hashing: each device
+ *   is assigned to the shard with the highest hash of (node id, shard index).
+ *   Changing the shard count from N to N+1 therefore remaps only ~1/(N+1) of
+ *   the devices, instead of nearly all of them as a modulo mapping would.
+ */
+class DeviceShardRouter
+{
+public:
+    // Upper bound on the shard count; one shard per core is the intended shape.
+    static constexpr uint16_t kMaxShards = 256;
+
+    /**
+     * @brief
+     *   Set the number of shards devices are distributed over.
+     *
+     * @param[in] shardCount Number of shards; must be in [1, kMaxShards].
+     */
+    CHIP_ERROR Init(uint16_t shardCount);
+
+    uint16_t GetShardCount() const { return mShardCount; }
+
+    /**
+     * @brief
+     *   The shard responsible for the given device, in [0, shard count).
+     *   Stable across processes and runs for a given shard count.
+     */
+    uint16_t GetShardForDevice(NodeId nodeId) const;
+
+private:
+    // 64-bit mix of the node id and shard index used as the rendezvous weight.
+    static uint64_t ShardWeight(NodeId nodeId, uint16_t shard);
+
+    uint16_t mShardCount = 1;
+};
+
+} // namespace Controller
+} // namespace chip
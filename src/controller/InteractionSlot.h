@@ -0,0 +1,85 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/support/CodeUtils.h>
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace chip {
+namespace Controller {
+
+/*
+ * A caller-owned, reusable storage slot for the callback adapter objects (TypedReadAttributeCallback,
+ * TypedCommandCallback, ...) that the typed interaction helpers otherwise heap-allocate per call.
+ *
+ * Orchestration code that stitches long sequences of interactions together (read, then decide, then
+ * invoke, then verify) can embed one slot per concurrent step in a long-lived object and pass it to
+ * the slot-taking overloads in ReadInteraction.h / InvokeInteraction.h. Each step then placement-news
+ * its callback into the slot and returns it on completion, so driving many devices through such
+ * sequences costs no allocator traffic at steady state.
+ *
+ * The slot must outlive any interaction it was handed to; a slot is returned through the interaction's
+ * OnDone path, at which point it may be reused for the next step. Acquire() on a busy slot fails, which
+ * the slot-taking overloads surface the same way as an allocation failure.
+ */
+template <typename CallbackType>
+class InteractionSlot
+{
+public:
+    InteractionSlot() {}
+    ~InteractionSlot() { VerifyOrDie(!mBusy); }
+
+    InteractionSlot(const InteractionSlot &) = delete;
+    InteractionSlot & operator=(const InteractionSlot &) = delete;
+
+    /**
+     * Construct a callback object in the slot, passing the provided arguments through to its
+     * constructor. Returns nullptr if the slot is still occupied by an in-flight interaction.
+     */
+    template <typename... Args>
+    CallbackType * Acquire(Args &&... args)
+    {
+        VerifyOrReturnError(!mBusy, nullptr);
+        mBusy = true;
+        return new (&mStorage) CallbackType(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Destroy the callback object previously handed out by Acquire() and make the slot available
+     * for reuse.
+     */
+    void Release(CallbackType * callback)
+    {
+        VerifyOrDie(mBusy && callback == reinterpret_cast<CallbackType *>(&mStorage));
+        callback->~CallbackType();
+        mBusy = false;
+    }
+
+    bool IsBusy() const { return mBusy; }
+
+private:
+    typename std::aligned_storage<sizeof(CallbackType), alignof(CallbackType)>::type mStorage;
+    bool mBusy = false;
+};
+
+} // namespace Controller
+} // namespace chip
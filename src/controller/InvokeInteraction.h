@@ -19,12 +19,20 @@
 #pragma once
 
 #include <controller/CommandSenderAllocator.h>
+#include <controller/InteractionSlot.h>
 #include <controller/TypedCommandCallback.h>
 #include <lib/core/Optional.h>
 
 namespace chip {
 namespace Controller {
 
+/*
+ * Caller-owned storage for the response decoder of a single command invocation. See InteractionSlot.h
+ * for lifetime requirements.
+ */
+template <typename ResponseType>
+using CommandCallbackSlot = InteractionSlot<TypedCommandCallback<ResponseType>>;
+
 /*
  * A typed command invocation function that takes as input a cluster-object representation of a command request and
  * callbacks for success and failure and either returns a decoded cluster-object representation of the response through
@@ -89,6 +97,72 @@ InvokeCommandRequest(Messaging::ExchangeManager * aExchangeMgr, const SessionHan
     return CHIP_NO_ERROR;
 }
 
+/*
+ * Variant of InvokeCommandRequest that constructs the response decoder in a caller-owned slot
+ * instead of heap-allocating it, so orchestration code issuing many sequential invokes can reuse
+ * a single slot across steps. The slot must outlive the interaction and is made available for
+ * reuse once the CommandSender's OnDone callback has run. Returns CHIP_ERROR_NO_MEMORY if the
+ * slot is still occupied by an in-flight interaction.
+ */
+template <typename RequestObjectT>
+CHIP_ERROR
+InvokeCommandRequest(Messaging::ExchangeManager * aExchangeMgr, const SessionHandle & sessionHandle, chip::EndpointId endpointId,
+                     const RequestObjectT & requestCommandData,
+                     typename TypedCommandCallback<typename RequestObjectT::ResponseType>::OnSuccessCallbackType onSuccessCb,
+                     typename TypedCommandCallback<typename RequestObjectT::ResponseType>::OnErrorCallbackType onErrorCb,
+                     const Optional<uint16_t> & timedInvokeTimeoutMs,
+                     CommandCallbackSlot<typename RequestObjectT::ResponseType> & callbackSlot)
+{
+    app::CommandPathParams commandPath = { endpointId, 0, RequestObjectT::GetClusterId(), RequestObjectT::GetCommandId(),
+                                           (app::CommandPathFlags::kEndpointIdValid) };
+
+    auto * decoder = callbackSlot.Acquire(onSuccessCb, onErrorCb);
+    VerifyOrReturnError(decoder != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    //
+    // Upon successful completion of SendCommandRequest below, the CommandSender frees itself and the
+    // decoder hands its slot back in the OnDone callback.
+    //
+    auto onDone = [&callbackSlot, decoder](app::CommandSender * commandSender) {
+        chip::Platform::Delete(commandSender);
+        callbackSlot.Release(decoder);
+    };
+
+    decoder->SetOnDoneCallback(onDone);
+
+    auto commandSender = chip::Platform::MakeUnique<app::CommandSender>(decoder, aExchangeMgr, timedInvokeTimeoutMs.HasValue());
+    if (commandSender == nullptr)
+    {
+        callbackSlot.Release(decoder);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    CHIP_ERROR err = commandSender->AddRequestData(commandPath, requestCommandData, timedInvokeTimeoutMs);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = commandSender->SendCommandRequest(sessionHandle);
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        //
+        // OnDone is only invoked once the request has been handed to the CommandSender successfully,
+        // so on failure the slot has to be handed back here (the CommandSender itself is still owned
+        // by the handle above and gets cleaned up with it).
+        //
+        callbackSlot.Release(decoder);
+        return err;
+    }
+
+    //
+    // Ownership of the CommandSender transfers to the exchange; it and the slot come back through
+    // the OnDone callback above.
+    //
+    commandSender.release();
+
+    return CHIP_NO_ERROR;
+}
+
 template <typename RequestObjectT>
 CHIP_ERROR
 InvokeCommandRequest(Messaging::ExchangeManager * exchangeMgr, const SessionHandle & sessionHandle, chip::EndpointId endpointId,
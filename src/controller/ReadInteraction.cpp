@@ -0,0 +1,42 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/ReadInteraction.h>
+
+namespace chip {
+namespace Controller {
+namespace detail {
+
+CHIP_ERROR LaunchReport(app::ReadPrepareParams & readParams, app::ReadClient::InteractionType reportType,
+                        app::ReadClient::Callback * callback)
+{
+    app::ReadClient * readClient = nullptr;
+
+    ReturnErrorOnFailure(app::InteractionModelEngine::GetInstance()->NewReadClient(&readClient, reportType, callback));
+
+    CHIP_ERROR err = readClient->SendRequest(readParams);
+    if (err != CHIP_NO_ERROR)
+    {
+        readClient->Shutdown();
+    }
+    return err;
+}
+
+} // namespace detail
+} // namespace Controller
+} // namespace chip
@@ -21,12 +21,30 @@
 #include <app/AttributePathParams.h>
 #include <app/InteractionModelEngine.h>
 #include <app/ReadPrepareParams.h>
+#include <controller/InteractionSlot.h>
 #include <controller/TypedReadCallback.h>
 
 namespace chip {
 namespace Controller {
+
+/*
+ * Caller-owned storage for the callback adapter of a single read or subscribe interaction. See
+ * InteractionSlot.h for lifetime requirements.
+ */
+template <typename DecodableAttributeType>
+using ReadAttributeCallbackSlot = InteractionSlot<TypedReadAttributeCallback<DecodableAttributeType>>;
+
 namespace detail {
 
+/*
+ * Type-erased tail shared by the heap-allocating report launchers below: hand
+ * the prepared callback adapter to a new read client and send the request,
+ * shutting the client down again if the send fails.  Compiled once instead of
+ * per attribute/event type.
+ */
+CHIP_ERROR LaunchReport(app::ReadPrepareParams & readParams, app::ReadClient::InteractionType reportType,
+                        app::ReadClient::Callback * callback);
+
 template <typename DecodableAttributeType>
 struct ReportAttributeParams : public app::ReadPrepareParams
 {
@@ -46,9 +64,6 @@ CHIP_ERROR ReportAttribute(Messaging::ExchangeManager * exchangeMgr, EndpointId
                            AttributeId attributeId, ReportAttributeParams<DecodableAttributeType> && readParams)
 {
     app::AttributePathParams attributePath(endpointId, clusterId, attributeId);
-    app::ReadClient * readClient         = nullptr;
-    app::InteractionModelEngine * engine = app::InteractionModelEngine::GetInstance();
-    CHIP_ERROR err                       = CHIP_NO_ERROR;
 
     readParams.mpAttributePathParamsList    = &attributePath;
     readParams.mAttributePathParamsListSize = 1;
@@ -61,22 +76,66 @@ CHIP_ERROR ReportAttribute(Messaging::ExchangeManager * exchangeMgr, EndpointId
         clusterId, attributeId, readParams.mOnReportCb, readParams.mOnErrorCb, onDone, readParams.mOnSubscriptionEstablishedCb);
     VerifyOrReturnError(callback != nullptr, CHIP_ERROR_NO_MEMORY);
 
-    ReturnErrorOnFailure(engine->NewReadClient(&readClient, readParams.mReportType, &(callback->GetBufferedCallback())));
+    ReturnErrorOnFailure(LaunchReport(readParams, readParams.mReportType, &(callback->GetBufferedCallback())));
+
+    //
+    // At this point, we'll get a callback through the OnDone callback above regardless of success or failure
+    // of the read operation to permit us to free up the callback object. So, release ownership of the callback
+    // object now to prevent it from being reclaimed at the end of this scoped block.
+    //
+    callback.release();
+    return CHIP_NO_ERROR;
+}
+
+/*
+ * Variant of ReportAttribute that constructs the callback adapter in a caller-owned slot instead of
+ * heap-allocating it, so repeated interactions driven from the same orchestration state reuse one
+ * piece of storage. The slot must outlive the interaction; it is returned through the OnDone path.
+ */
+template <typename DecodableAttributeType>
+CHIP_ERROR ReportAttribute(Messaging::ExchangeManager * exchangeMgr, EndpointId endpointId, ClusterId clusterId,
+                           AttributeId attributeId, ReportAttributeParams<DecodableAttributeType> && readParams,
+                           ReadAttributeCallbackSlot<DecodableAttributeType> & callbackSlot)
+{
+    app::AttributePathParams attributePath(endpointId, clusterId, attributeId);
+    app::ReadClient * readClient         = nullptr;
+    app::InteractionModelEngine * engine = app::InteractionModelEngine::GetInstance();
+    CHIP_ERROR err                       = CHIP_NO_ERROR;
+
+    readParams.mpAttributePathParamsList    = &attributePath;
+    readParams.mAttributePathParamsListSize = 1;
+
+    auto onDone = [&callbackSlot](app::ReadClient * apReadClient, TypedReadAttributeCallback<DecodableAttributeType> * callback) {
+        callbackSlot.Release(callback);
+    };
+
+    auto * callback = callbackSlot.Acquire(clusterId, attributeId, readParams.mOnReportCb, readParams.mOnErrorCb, onDone,
+                                           readParams.mOnSubscriptionEstablishedCb);
+    VerifyOrReturnError(callback != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    err = engine->NewReadClient(&readClient, readParams.mReportType, &(callback->GetBufferedCallback()));
+    if (err != CHIP_NO_ERROR)
+    {
+        callbackSlot.Release(callback);
+        return err;
+    }
 
     err = readClient->SendRequest(readParams);
 
     if (err != CHIP_NO_ERROR)
     {
+        //
+        // Shutdown below invokes the OnDone callback on the registered callback object, which hands
+        // the slot back for us; there is nothing further to release here.
+        //
         readClient->Shutdown();
         return err;
     }
 
     //
     // At this point, we'll get a callback through the OnDone callback above regardless of success or failure
-    // of the read operation to permit us to free up the callback object. So, release ownership of the callback
-    // object now to prevent it from being reclaimed at the end of this scoped block.
+    // of the read operation, and the slot is returned there.
     //
-    callback.release();
     return err;
 }
 
@@ -118,6 +177,27 @@ ReadAttribute(Messaging::ExchangeManager * exchangeMgr, const SessionHandle & se
                                                                     AttributeTypeInfo::GetAttributeId(), onSuccessCb, onErrorCb);
 }
 
+/*
+ * Allocation-free variant of ReadAttribute: the callback adapter is constructed in the provided
+ * caller-owned slot rather than on the heap, so orchestration code issuing many sequential reads
+ * can reuse a single slot across steps. The slot must outlive the interaction and is made
+ * available for reuse once the interaction's OnDone callback has run. Returns CHIP_ERROR_NO_MEMORY
+ * if the slot is still occupied by an in-flight interaction.
+ */
+template <typename AttributeTypeInfo>
+CHIP_ERROR
+ReadAttribute(Messaging::ExchangeManager * exchangeMgr, const SessionHandle & sessionHandle, EndpointId endpointId,
+              typename TypedReadAttributeCallback<typename AttributeTypeInfo::DecodableType>::OnSuccessCallbackType onSuccessCb,
+              typename TypedReadAttributeCallback<typename AttributeTypeInfo::DecodableType>::OnErrorCallbackType onErrorCb,
+              ReadAttributeCallbackSlot<typename AttributeTypeInfo::DecodableType> & callbackSlot)
+{
+    detail::ReportAttributeParams<typename AttributeTypeInfo::DecodableType> params(sessionHandle);
+    params.mOnReportCb = onSuccessCb;
+    params.mOnErrorCb  = onErrorCb;
+    return detail::ReportAttribute(exchangeMgr, endpointId, AttributeTypeInfo::GetClusterId(), AttributeTypeInfo::GetAttributeId(),
+                                   std::move(params), callbackSlot);
+}
+
 // Helper for SubscribeAttribute to reduce the amount of code generated.
 template <typename DecodableAttributeType>
 CHIP_ERROR SubscribeAttribute(Messaging::ExchangeManager * exchangeMgr, const SessionHandle & sessionHandle, EndpointId endpointId,
@@ -177,9 +257,6 @@ CHIP_ERROR ReportEvent(Messaging::ExchangeManager * apExchangeMgr, EndpointId en
     ClusterId clusterId = DecodableEventType::GetClusterId();
     EventId eventId     = DecodableEventType::GetEventId();
     app::EventPathParams eventPath(endpointId, clusterId, eventId);
-    app::ReadClient * readClient         = nullptr;
-    app::InteractionModelEngine * engine = app::InteractionModelEngine::GetInstance();
-    CHIP_ERROR err                       = CHIP_NO_ERROR;
 
     readParams.mpEventPathParamsList    = &eventPath;
     readParams.mEventPathParamsListSize = 1;
@@ -193,14 +270,7 @@ CHIP_ERROR ReportEvent(Messaging::ExchangeManager * apExchangeMgr, EndpointId en
 
     VerifyOrReturnError(callback != nullptr, CHIP_ERROR_NO_MEMORY);
 
-    ReturnErrorOnFailure(engine->NewReadClient(&readClient, readParams.mReportType, callback.get()));
-
-    err = readClient->SendRequest(readParams);
-    if (err != CHIP_NO_ERROR)
-    {
-        readClient->Shutdown();
-        return err;
-    }
+    ReturnErrorOnFailure(LaunchReport(readParams, readParams.mReportType, callback.get()));
 
     //
     // At this point, we'll get a callback through the OnDone callback above regardless of success or failure
@@ -208,7 +278,7 @@ CHIP_ERROR ReportEvent(Messaging::ExchangeManager * apExchangeMgr, EndpointId en
     // object now to prevent it from being reclaimed at the end of this scoped block.
     //
     callback.release();
-    return err;
+    return CHIP_NO_ERROR;
 }
 
 } // namespace detail
@@ -29,6 +29,7 @@
 #include <controller/CHIPDeviceController.h>
 #include <lib/dnssd/Resolver.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/ErrorStr.h>
 
 namespace chip {
 namespace Controller {
@@ -52,6 +53,10 @@ CHIP_ERROR SetUpCodePairer::Connect(RendezvousInformationFlag rendezvousInformat
     CHIP_ERROR err = CHIP_NO_ERROR;
     bool isRunning = false;
 
+    mDiscoveredParametersCount = 0;
+    mPairingInProgress         = false;
+    mRunning                   = true;
+
     bool searchOverAll = rendezvousInformation == RendezvousInformationFlag::kNone;
     if (searchOverAll || rendezvousInformation == RendezvousInformationFlag::kBLE)
     {
@@ -135,15 +140,69 @@ CHIP_ERROR SetUpCodePairer::StopConnectOverSoftAP()
 
 void SetUpCodePairer::OnDeviceDiscovered(RendezvousParameters & params)
 {
-    LogErrorOnFailure(mCommissioner->PairDevice(mRemoteId, params.SetSetupPINCode(mSetUpPINCode)));
+    // Keep discovery running on the other transports: candidates race each
+    // other, and the first one whose PASE handshake completes wins.
+    if (mDiscoveredParametersCount >= kMaxDiscoveredParameters)
+    {
+        ChipLogProgress(Controller, "Too many discovered rendezvous candidates, dropping one");
+        return;
+    }
+    mDiscoveredParameters[mDiscoveredParametersCount++] = params.SetSetupPINCode(mSetUpPINCode);
+
+    TryNextRendezvousParameters();
 }
 
-#if CONFIG_NETWORK_LAYER_BLE
-void SetUpCodePairer::OnDiscoveredDeviceOverBle(BLE_CONNECTION_OBJECT connObj)
+void SetUpCodePairer::TryNextRendezvousParameters()
+{
+    // The commissioner supports a single in-flight PASE session; the attempt's
+    // completion (OnPairingComplete) re-enters here if more candidates remain.
+    while (!mPairingInProgress && mDiscoveredParametersCount > 0)
+    {
+        RendezvousParameters params = mDiscoveredParameters[0];
+        for (size_t i = 1; i < mDiscoveredParametersCount; i++)
+        {
+            mDiscoveredParameters[i - 1] = mDiscoveredParameters[i];
+        }
+        mDiscoveredParametersCount--;
+
+        mPairingInProgress = true;
+        CHIP_ERROR err     = mCommissioner->PairDevice(mRemoteId, params);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Controller, "Failed to start pairing on discovered candidate: %s", ErrorStr(err));
+            mPairingInProgress = false;
+        }
+    }
+}
+
+void SetUpCodePairer::OnPairingComplete(CHIP_ERROR error)
 {
+    VerifyOrReturn(mRunning && mPairingInProgress);
+    mPairingInProgress = false;
+
+    if (error == CHIP_NO_ERROR)
+    {
+        // This candidate won the race; abort discovery on the other transports.
+        StopAllDiscovery();
+        mDiscoveredParametersCount = 0;
+        mRunning                   = false;
+        return;
+    }
+
+    ChipLogProgress(Controller, "Pairing attempt failed: %s, trying next discovered candidate", ErrorStr(error));
+    TryNextRendezvousParameters();
+}
+
+void SetUpCodePairer::StopAllDiscovery()
+{
+    LogErrorOnFailure(StopConnectOverBle());
     LogErrorOnFailure(StopConnectOverIP());
     LogErrorOnFailure(StopConnectOverSoftAP());
+}
 
+#if CONFIG_NETWORK_LAYER_BLE
+void SetUpCodePairer::OnDiscoveredDeviceOverBle(BLE_CONNECTION_OBJECT connObj)
+{
     Transport::PeerAddress peerAddress = Transport::PeerAddress::BLE();
     RendezvousParameters params        = RendezvousParameters().SetPeerAddress(peerAddress).SetConnectionObject(connObj);
     OnDeviceDiscovered(params);
@@ -182,9 +241,6 @@ void SetUpCodePairer::NotifyCommissionableDeviceDiscovered(const Dnssd::Discover
     {
         return;
     }
-    LogErrorOnFailure(StopConnectOverBle());
-    LogErrorOnFailure(StopConnectOverIP());
-    LogErrorOnFailure(StopConnectOverSoftAP());
 
     Inet::InterfaceId interfaceId = nodeData.ipAddress[0].IsIPv6LinkLocal() ? nodeData.interfaceId[0] : Inet::InterfaceId::Null();
     Transport::PeerAddress peerAddress = Transport::PeerAddress::UDP(nodeData.ipAddress[0], nodeData.port, interfaceId);
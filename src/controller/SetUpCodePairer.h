@@ -55,6 +55,11 @@ public:
 
     CHIP_ERROR PairDevice(chip::NodeId remoteId, const char * setUpCode);
 
+    // Called by the DeviceCommissioner when a PASE attempt this pairer initiated
+    // completes. On failure the next discovered candidate, if any, is tried
+    // immediately instead of waiting out the failed transport's timeout.
+    void OnPairingComplete(CHIP_ERROR error);
+
 // Called by the DeviceCommissioner to notify that we have discovered a new device.
 #if CHIP_DEVICE_CONFIG_ENABLE_DNSSD
     void NotifyCommissionableDeviceDiscovered(const chip::Dnssd::DiscoveredNodeData & nodeData);
@@ -74,6 +79,8 @@ private:
     CHIP_ERROR StopConnectOverSoftAP();
 
     void OnDeviceDiscovered(RendezvousParameters & params);
+    void TryNextRendezvousParameters();
+    void StopAllDiscovery();
 
 #if CONFIG_NETWORK_LAYER_BLE
     Ble::BleLayer * mBleLayer = nullptr;
@@ -91,6 +98,16 @@ private:
     DeviceCommissioner * mCommissioner = nullptr;
     chip::NodeId mRemoteId;
     uint32_t mSetUpPINCode = 0;
+
+    // Candidates discovered on the various transports race each other: they
+    // are queued here as they come in and tried one PASE attempt at a time
+    // (the commissioner supports a single in-flight PASE session), failing
+    // over to the next queued candidate as soon as an attempt errors out.
+    static constexpr size_t kMaxDiscoveredParameters = 8;
+    RendezvousParameters mDiscoveredParameters[kMaxDiscoveredParameters];
+    size_t mDiscoveredParametersCount = 0;
+    bool mRunning                     = false;
+    bool mPairingInProgress           = false;
 };
 
 } // namespace Controller
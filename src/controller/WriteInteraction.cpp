@@ -0,0 +1,57 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/WriteInteraction.h>
+
+namespace chip {
+namespace Controller {
+namespace detail {
+
+CHIP_ERROR WriteAttribute(const SessionHandle & sessionHandle, EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
+                          const void * requestData, WritePayloadEncoderFunct encoder,
+                          WriteCallback::OnSuccessCallbackType onSuccessCb, WriteCallback::OnErrorCallbackType onErrorCb,
+                          const Optional<uint16_t> & aTimedWriteTimeoutMs, WriteCallback::OnDoneCallbackType onDoneCb)
+{
+    app::WriteClientHandle handle;
+
+    auto callback = Platform::MakeUnique<WriteCallback>(onSuccessCb, onErrorCb, onDoneCb);
+    VerifyOrReturnError(callback != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    ReturnErrorOnFailure(app::InteractionModelEngine::GetInstance()->NewWriteClient(handle, callback.get(), aTimedWriteTimeoutMs));
+
+    // At this point the handle will ensure our callback's OnDone is always
+    // called.
+    callback.release();
+
+    if (sessionHandle.IsGroupSession())
+    {
+        ReturnErrorOnFailure(encoder(handle, app::AttributePathParams(clusterId, attributeId), requestData));
+    }
+    else
+    {
+        ReturnErrorOnFailure(encoder(handle, app::AttributePathParams(endpointId, clusterId, attributeId), requestData));
+    }
+
+    ReturnErrorOnFailure(handle.SendWriteRequest(sessionHandle));
+
+    return CHIP_NO_ERROR;
+}
+
+} // namespace detail
+} // namespace Controller
+} // namespace chip
@@ -88,11 +88,35 @@ private:
     OnDoneCallbackType mOnDone       = nullptr;
 };
 
+namespace detail {
+
+/*
+ * Encodes the (type-erased) request data for a single attribute into the write client's payload.
+ * Instantiated once per attribute type by WriteAttribute() below.
+ */
+using WritePayloadEncoderFunct = CHIP_ERROR (*)(app::WriteClientHandle & handle, const app::AttributePathParams & attributePath,
+                                                const void * requestData);
+
+/*
+ * Type-erased core of WriteAttribute(): everything that does not depend on the
+ * attribute type (callback adapter allocation, write client setup, path
+ * construction and the send) lives here, compiled once, so each attribute type
+ * only instantiates its payload encoder.
+ */
+CHIP_ERROR WriteAttribute(const SessionHandle & sessionHandle, EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
+                          const void * requestData, WritePayloadEncoderFunct encoder,
+                          WriteCallback::OnSuccessCallbackType onSuccessCb, WriteCallback::OnErrorCallbackType onErrorCb,
+                          const Optional<uint16_t> & aTimedWriteTimeoutMs, WriteCallback::OnDoneCallbackType onDoneCb);
+
+} // namespace detail
+
 /**
  * Functions for writing attributes.  We have lots of different AttributeInfo
  * but a fairly small set of types that get written.  So we want to keep the
  * template on AttributeInfo very small, and put all the work in the template
- * with a small number of instantiations (one per type).
+ * with a small number of instantiations (one per type).  The per-type
+ * instantiation in turn is only the payload encoder; the rest of the work is
+ * the shared type-erased kernel in the detail namespace.
  */
 template <typename AttrType>
 CHIP_ERROR WriteAttribute(const SessionHandle & sessionHandle, chip::EndpointId endpointId, ClusterId clusterId,
@@ -100,31 +124,12 @@ CHIP_ERROR WriteAttribute(const SessionHandle & sessionHandle, chip::EndpointId
                           WriteCallback::OnErrorCallbackType onErrorCb, const Optional<uint16_t> & aTimedWriteTimeoutMs,
                           WriteCallback::OnDoneCallbackType onDoneCb = nullptr)
 {
-    app::WriteClientHandle handle;
-
-    auto callback = Platform::MakeUnique<WriteCallback>(onSuccessCb, onErrorCb, onDoneCb);
-    VerifyOrReturnError(callback != nullptr, CHIP_ERROR_NO_MEMORY);
-
-    ReturnErrorOnFailure(app::InteractionModelEngine::GetInstance()->NewWriteClient(handle, callback.get(), aTimedWriteTimeoutMs));
-
-    // At this point the handle will ensure our callback's OnDone is always
-    // called.
-    callback.release();
-
-    if (sessionHandle.IsGroupSession())
-    {
-        ReturnErrorOnFailure(
-            handle.EncodeAttributeWritePayload(chip::app::AttributePathParams(clusterId, attributeId), requestData));
-    }
-    else
-    {
-        ReturnErrorOnFailure(
-            handle.EncodeAttributeWritePayload(chip::app::AttributePathParams(endpointId, clusterId, attributeId), requestData));
-    }
-
-    ReturnErrorOnFailure(handle.SendWriteRequest(sessionHandle));
-
-    return CHIP_NO_ERROR;
+    return detail::WriteAttribute(
+        sessionHandle, endpointId, clusterId, attributeId, &requestData,
+        [](app::WriteClientHandle & handle, const app::AttributePathParams & attributePath, const void * data) {
+            return handle.EncodeAttributeWritePayload(attributePath, *static_cast<const AttrType *>(data));
+        },
+        onSuccessCb, onErrorCb, aTimedWriteTimeoutMs, onDoneCb);
 }
 
 template <typename AttributeInfo>
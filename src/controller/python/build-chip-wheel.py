@@ -31,6 +31,8 @@ import json
 import os
 import platform
 import shutil
+import subprocess
+import sys
 
 
 parser = argparse.ArgumentParser(
@@ -114,6 +116,20 @@ try:
         os.rename(os.path.join(tmpDir, script.name),
                   os.path.join(tmpDir, script.installName))
 
+    # Pre-build the cluster schema index cache inside the package so that the
+    # first process to import the installed bindings already finds it, instead
+    # of every test process paying for reflection over the generated cluster
+    # objects. Best effort: if the build environment lacks the runtime
+    # dependencies needed to import the package, the cache is simply built
+    # lazily by the first process to initialize the bindings.
+    try:
+        subprocess.check_call(
+            [sys.executable, '-c',
+             'from chip.clusters import ClusterIndexCache; ClusterIndexCache.GenerateCache()'],
+            cwd=tmpDir)
+    except subprocess.CalledProcessError:
+        print("Unable to pre-build the cluster index cache; it will be built on first use.")
+
     # Define a custom version of the bdist_wheel command that configures the
     # resultant wheel as platform-specific (i.e. not "pure").
     class bdist_wheel_override(bdist_wheel):
@@ -197,6 +213,11 @@ try:
             packageName: [
                 # Include the wrapper DLL as package data in the "chip" package.
                 chipDLLName
+            ],
+            packageName + '.clusters': [
+                # Include the pre-built cluster schema index cache, if the
+                # pre-build step above was able to produce one.
+                'zap-cluster-index.cache'
             ]
         },
         scripts=[name for name in map(
@@ -25,13 +25,12 @@ from typing import Tuple, Type, Union, List, Any, Callable, Dict, Set
 from ctypes import CFUNCTYPE, c_char_p, c_size_t, c_void_p, c_uint64, c_uint32,  c_uint16, c_uint8, py_object, c_uint64
 from rich.pretty import pprint
 
+from . import ClusterIndexCache
 from .ClusterObjects import Cluster, ClusterAttributeDescriptor, ClusterEvent
 import chip.exceptions
 import chip.interaction_model
 import chip.tlv
 from enum import Enum, unique
-import inspect
-import sys
 import logging
 import threading
 import builtins
@@ -255,35 +254,25 @@ _EventIndex = {}
 _ClusterIndex = {}
 
 
-def _BuildAttributeIndex():
-    ''' Build internal attribute index for locating the corresponding cluster object by path in the future.
+def _LoadSchemaIndexes():
+    ''' Populate the internal indexes used for locating the corresponding cluster object by path in the future.
     We do this because this operation will take a long time when there are lots of attributes, it takes about 300ms for a single query.
     This is acceptable during init, but unacceptable when the server returns lots of attributes at the same time.
+
+    The indexes are loaded from the persistent cache built at wheel build time (or by the first
+    process to initialize the bindings); reflection over chip.clusters.Objects is only the
+    fallback when no valid cache exists for the current generated schema.
     '''
-    for clusterName, obj in inspect.getmembers(sys.modules['chip.clusters.Objects']):
-        if ('chip.clusters.Objects' in str(obj)) and inspect.isclass(obj):
-            for objName, subclass in inspect.getmembers(obj):
-                if inspect.isclass(subclass) and (('Attributes') in str(subclass)):
-                    for attributeName, attribute in inspect.getmembers(subclass):
-                        if inspect.isclass(attribute):
-                            base_classes = inspect.getmro(attribute)
-
-                            # Only match on classes that extend the ClusterAttributeDescriptor class
-                            matched = [
-                                value for value in base_classes if 'ClusterAttributeDescriptor' in str(value)]
-                            if (matched == []):
-                                continue
-
-                            _AttributeIndex[(attribute.cluster_id, attribute.attribute_id)] = (eval(
-                                'chip.clusters.Objects.' + clusterName + '.Attributes.' + attributeName), obj)
-
-
-def _BuildClusterIndex():
-    ''' Build internal cluster index for locating the corresponding cluster object by path in the future.
-    '''
-    for clusterName, obj in inspect.getmembers(sys.modules['chip.clusters.Objects']):
-        if ('chip.clusters.Objects' in str(obj)) and inspect.isclass(obj):
-            _ClusterIndex[obj.id] = obj
+    indexes = ClusterIndexCache.LoadIndexes()
+    if indexes is None:
+        nameIndexes = ClusterIndexCache.BuildNameIndexes()
+        ClusterIndexCache.StoreIndexes(nameIndexes)
+        indexes = ClusterIndexCache.ResolveNameIndexes(nameIndexes)
+
+    _ClusterIndex.update(indexes['clusters'])
+    _AttributeIndex.update(indexes['attributes'])
+    for (clusterId, eventId), eventType in indexes['events'].items():
+        _EventIndex[str(EventPath(ClusterId=clusterId, EventId=eventId))] = eventType
 
 
 @dataclass
@@ -479,29 +468,6 @@ def DefaultEventChangeCallback(data: EventReadResult, transaction: SubscriptionT
     pprint(data, expand_all=True)
 
 
-def _BuildEventIndex():
-    ''' Build internal event index for locating the corresponding cluster object by path in the future.
-    We do this because this operation will take a long time when there are lots of events, it takes about 300ms for a single query.
-    This is acceptable during init, but unacceptable when the server returns lots of events at the same time.
-    '''
-    for clusterName, obj in inspect.getmembers(sys.modules['chip.clusters.Objects']):
-        if ('chip.clusters.Objects' in str(obj)) and inspect.isclass(obj):
-            for objName, subclass in inspect.getmembers(obj):
-                if inspect.isclass(subclass) and (('Events' == objName)):
-                    for eventName, event in inspect.getmembers(subclass):
-                        if inspect.isclass(event):
-                            base_classes = inspect.getmro(event)
-
-                            # Only match on classes that extend the ClusterEventescriptor class
-                            matched = [
-                                value for value in base_classes if 'ClusterEvent' in str(value)]
-                            if (matched == []):
-                                continue
-
-                            _EventIndex[str(EventPath(ClusterId=event.cluster_id, EventId=event.event_id))] = eval(
-                                'chip.clusters.Objects.' + clusterName + '.Events.' + eventName)
-
-
 class TransactionType(Enum):
     READ_EVENTS = 1
     READ_ATTRIBUTES = 2
@@ -864,6 +830,4 @@ def Init():
         _OnReadAttributeDataCallback, _OnReadEventDataCallback, _OnSubscriptionEstablishedCallback, _OnReadErrorCallback, _OnReadDoneCallback,
         _OnReportBeginCallback, _OnReportEndCallback)
 
-    _BuildAttributeIndex()
-    _BuildClusterIndex()
-    _BuildEventIndex()
+    _LoadSchemaIndexes()
@@ -0,0 +1,178 @@
+#
+#    Copyright (c) 2021 Project CHIP Authors
+#    All rights reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+'''Persistent cache of the cluster/attribute/event schema indexes.
+
+Building the indexes by reflecting over chip.clusters.Objects takes on the
+order of a second and is paid by every process that initializes the bindings,
+which adds up quickly when a test harness spawns thousands of short-lived
+processes. This module persists the indexes as qualified class names keyed by
+a digest of the generated Objects.py, so that subsequent processes resolve
+them with plain attribute lookups instead of reflection.
+
+The cache file is written next to the package when that directory is
+writable, and into the system temporary directory otherwise. A stale or
+corrupt cache is simply ignored and rebuilt.
+'''
+
+import hashlib
+import inspect
+import logging
+import os
+import pickle
+import sys
+import tempfile
+
+from . import ClusterObjects
+
+LOGGER = logging.getLogger(__name__)
+
+_CACHE_BASENAME = 'zap-cluster-index.cache'
+_CACHE_FORMAT_VERSION = 1
+
+
+def _SchemaDigest() -> str:
+    ''' Digest of the generated cluster objects source, used to detect a cache
+        built against a different ZAP revision.
+    '''
+    import chip.clusters.Objects as Objects
+
+    sourcePath = os.path.splitext(Objects.__file__)[0] + '.py'
+    with open(sourcePath, 'rb') as source:
+        return hashlib.sha256(source.read()).hexdigest()
+
+
+def _CachePaths():
+    ''' Candidate cache locations, in load/store preference order. '''
+    return [
+        os.path.join(os.path.dirname(__file__), _CACHE_BASENAME),
+        os.path.join(tempfile.gettempdir(),
+                     'chip-{}-{}'.format(os.getuid() if hasattr(os, 'getuid') else 0, _CACHE_BASENAME)),
+    ]
+
+
+def BuildNameIndexes():
+    ''' Build the schema indexes by reflection, keyed by qualified class name
+        rather than class object so they can be persisted.
+    '''
+    import chip.clusters.Objects as Objects
+
+    indexes = {
+        'version': _CACHE_FORMAT_VERSION,
+        'digest': _SchemaDigest(),
+        'clusters': {},
+        'attributes': {},
+        'events': {},
+    }
+
+    for clusterName in dir(Objects):
+        cluster = getattr(Objects, clusterName)
+        if not (inspect.isclass(cluster) and issubclass(cluster, ClusterObjects.Cluster) and cluster is not ClusterObjects.Cluster):
+            continue
+
+        indexes['clusters'][cluster.id] = cluster.__qualname__
+
+        attributes = getattr(cluster, 'Attributes', None)
+        if attributes is not None:
+            for attributeName in dir(attributes):
+                attribute = getattr(attributes, attributeName)
+                if inspect.isclass(attribute) and issubclass(attribute, ClusterObjects.ClusterAttributeDescriptor):
+                    indexes['attributes'][(attribute.cluster_id, attribute.attribute_id)] = (
+                        attribute.__qualname__, cluster.__qualname__)
+
+        events = getattr(cluster, 'Events', None)
+        if events is not None:
+            for eventName in dir(events):
+                event = getattr(events, eventName)
+                if inspect.isclass(event) and issubclass(event, ClusterObjects.ClusterEvent):
+                    indexes['events'][(event.cluster_id, event.event_id)] = event.__qualname__
+
+    return indexes
+
+
+def _ResolveQualName(qualName):
+    import chip.clusters.Objects as Objects
+
+    obj = Objects
+    for name in qualName.split('.'):
+        obj = getattr(obj, name)
+    return obj
+
+
+def ResolveNameIndexes(nameIndexes):
+    ''' Turn the persisted name-keyed indexes back into class-valued ones. '''
+    return {
+        'clusters': {clusterId: _ResolveQualName(name)
+                     for clusterId, name in nameIndexes['clusters'].items()},
+        'attributes': {path: (_ResolveQualName(attributeName), _ResolveQualName(clusterName))
+                       for path, (attributeName, clusterName) in nameIndexes['attributes'].items()},
+        'events': {path: _ResolveQualName(name)
+                   for path, name in nameIndexes['events'].items()},
+    }
+
+
+def LoadIndexes():
+    ''' Load and resolve the cached indexes, or return None if no valid cache
+        exists for the current schema.
+    '''
+    for path in _CachePaths():
+        try:
+            with open(path, 'rb') as cacheFile:
+                nameIndexes = pickle.load(cacheFile)
+            if nameIndexes.get('version') != _CACHE_FORMAT_VERSION:
+                continue
+            if nameIndexes.get('digest') != _SchemaDigest():
+                continue
+            return ResolveNameIndexes(nameIndexes)
+        except (OSError, IOError):
+            continue
+        except Exception:
+            LOGGER.warning('Ignoring corrupt cluster index cache at %s', path)
+            continue
+    return None
+
+
+def StoreIndexes(nameIndexes):
+    ''' Persist the name-keyed indexes, best effort. The write goes through a
+        temporary file and an atomic rename so that concurrently starting
+        processes never observe a partial cache.
+    '''
+    for path in _CachePaths():
+        try:
+            handle, tempPath = tempfile.mkstemp(dir=os.path.dirname(path))
+            try:
+                with os.fdopen(handle, 'wb') as cacheFile:
+                    pickle.dump(nameIndexes, cacheFile, protocol=pickle.HIGHEST_PROTOCOL)
+                os.replace(tempPath, path)
+            except BaseException:
+                os.unlink(tempPath)
+                raise
+            return path
+        except (OSError, IOError):
+            continue
+    LOGGER.warning('Unable to persist the cluster index cache; startup will keep rebuilding it')
+    return None
+
+
+def GenerateCache():
+    ''' Build and persist the indexes. Invoked at wheel build time so that the
+        first process to import the installed bindings already finds a cache.
+    '''
+    path = StoreIndexes(BuildNameIndexes())
+    if path is not None:
+        print('Cluster index cache written to {}'.format(path))
+    return path
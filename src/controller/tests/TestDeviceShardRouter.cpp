@@ -0,0 +1,115 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/DeviceShardRouter.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::Controller;
+
+namespace {
+
+constexpr uint16_t kShardCount  = 8;
+constexpr NodeId kFirstNodeId   = 0x18B4300000000001ULL;
+constexpr size_t kDeviceCount   = 4096;
+
+void TestInvalidShardCount(nlTestSuite * inSuite, void * inContext)
+{
+    DeviceShardRouter router;
+    NL_TEST_ASSERT(inSuite, router.Init(0) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, router.Init(DeviceShardRouter::kMaxShards + 1) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, router.Init(1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, router.GetShardForDevice(kFirstNodeId) == 0);
+}
+
+void TestMappingIsStableAndBounded(nlTestSuite * inSuite, void * inContext)
+{
+    DeviceShardRouter router;
+    DeviceShardRouter other;
+    NL_TEST_ASSERT(inSuite, router.Init(kShardCount) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, other.Init(kShardCount) == CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < kDeviceCount; i++)
+    {
+        const NodeId nodeId  = kFirstNodeId + i;
+        const uint16_t shard = router.GetShardForDevice(nodeId);
+        NL_TEST_ASSERT(inSuite, shard < kShardCount);
+        // Two routers with the same shard count agree, as shard processes must.
+        NL_TEST_ASSERT(inSuite, other.GetShardForDevice(nodeId) == shard);
+    }
+}
+
+void TestDistributionIsBalanced(nlTestSuite * inSuite, void * inContext)
+{
+    DeviceShardRouter router;
+    NL_TEST_ASSERT(inSuite, router.Init(kShardCount) == CHIP_NO_ERROR);
+
+    size_t perShard[kShardCount] = {};
+    for (size_t i = 0; i < kDeviceCount; i++)
+    {
+        perShard[router.GetShardForDevice(kFirstNodeId + i)]++;
+    }
+
+    // With 4096 devices over 8 shards the expected load is 512 per shard; allow a
+    // generous 50% imbalance before calling the hash degenerate.
+    for (uint16_t shard = 0; shard < kShardCount; shard++)
+    {
+        NL_TEST_ASSERT(inSuite, perShard[shard] > kDeviceCount / kShardCount / 2);
+        NL_TEST_ASSERT(inSuite, perShard[shard] < kDeviceCount / kShardCount * 3 / 2);
+    }
+}
+
+void TestMinimalRemapOnGrowth(nlTestSuite * inSuite, void * inContext)
+{
+    DeviceShardRouter before;
+    DeviceShardRouter after;
+    NL_TEST_ASSERT(inSuite, before.Init(kShardCount) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, after.Init(kShardCount + 1) == CHIP_NO_ERROR);
+
+    size_t moved = 0;
+    for (size_t i = 0; i < kDeviceCount; i++)
+    {
+        const NodeId nodeId = kFirstNodeId + i;
+        if (before.GetShardForDevice(nodeId) != after.GetShardForDevice(nodeId))
+        {
+            // Rendezvous hashing only ever moves devices onto the new shard.
+            NL_TEST_ASSERT(inSuite, after.GetShardForDevice(nodeId) == kShardCount);
+            moved++;
+        }
+    }
+
+    // Expected remap fraction is 1/(N+1) = 1/9 of the devices; double it as the bound.
+    NL_TEST_ASSERT(inSuite, moved < 2 * kDeviceCount / (kShardCount + 1));
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("TestInvalidShardCount", TestInvalidShardCount),
+                          NL_TEST_DEF("TestMappingIsStableAndBounded", TestMappingIsStableAndBounded),
+                          NL_TEST_DEF("TestDistributionIsBalanced", TestDistributionIsBalanced),
+                          NL_TEST_DEF("TestMinimalRemapOnGrowth", TestMinimalRemapOnGrowth), NL_TEST_SENTINEL() };
+
+} // namespace
+
+int TestDeviceShardRouter()
+{
+    nlTestSuite theSuite = { "DeviceShardRouter", &sTests[0], nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestDeviceShardRouter)
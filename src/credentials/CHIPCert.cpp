@@ -206,10 +206,15 @@ CHIP_ERROR ChipCertificateSet::LoadCert(TLVReader & reader, BitFlags<CertDecodeF
         cert.mCertFlags.Set(CertFlags::kIsTrustAnchor);
     }
 
+    return LoadCert(cert);
+}
+
+CHIP_ERROR ChipCertificateSet::LoadCert(const ChipCertificateData & certData)
+{
     // Check if this cert matches any currently loaded certificates
     for (uint32_t i = 0; i < mCertCount; i++)
     {
-        if (cert.IsEqual(mCerts[i]))
+        if (certData.IsEqual(mCerts[i]))
         {
             // This cert is already loaded. Let's skip adding this cert.
             return CHIP_NO_ERROR;
@@ -219,7 +224,7 @@ CHIP_ERROR ChipCertificateSet::LoadCert(TLVReader & reader, BitFlags<CertDecodeF
     // Verify we have room for the new certificate.
     VerifyOrReturnError(mCertCount < mMaxCerts, CHIP_ERROR_NO_MEMORY);
 
-    new (&mCerts[mCertCount]) ChipCertificateData(cert);
+    new (&mCerts[mCertCount]) ChipCertificateData(certData);
     mCertCount++;
 
     return CHIP_NO_ERROR;
@@ -230,6 +235,16 @@ CHIP_ERROR ChipCertificateSet::ReleaseLastCert()
     ChipCertificateData * lastCert = (mCertCount > 0) ? &mCerts[mCertCount - 1] : nullptr;
     VerifyOrReturnError(lastCert != nullptr, CHIP_ERROR_INTERNAL);
 
+    // Invalidate cached signature verification results for any remaining certificate that chains to the
+    // certificate being released.
+    for (uint8_t i = 0; i < mCertCount - 1; i++)
+    {
+        if (mCerts[i].mAuthKeyId.data_equal(lastCert->mSubjectKeyId))
+        {
+            mCerts[i].mCertFlags.Clear(CertFlags::kSignatureVerified);
+        }
+    }
+
     lastCert->~ChipCertificateData();
     --mCertCount;
 
@@ -411,8 +426,18 @@ CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, Va
 
     // Verify signature of the current certificate against public key of the CA certificate. If signature verification
     // succeeds, the current certificate is valid.
-    err = VerifySignature(cert, caCert);
-    SuccessOrExit(err);
+    //
+    // The result is cached on the certificate so that repeated validations against the same set (e.g. the CA portion of
+    // the chain being re-walked for every leaf certificate validated) pay for each ECDSA operation only once. The cache
+    // is invalidated when the signing certificate is released from the set.
+    if (!cert->mCertFlags.Has(CertFlags::kSignatureVerified))
+    {
+        err = VerifySignature(cert, caCert);
+        SuccessOrExit(err);
+
+        // The public entry points guarantee that cert is a member of mCerts, so it is safe to update its cached state.
+        const_cast<ChipCertificateData *>(cert)->mCertFlags.Set(CertFlags::kSignatureVerified);
+    }
 
 exit:
     return err;
@@ -492,13 +517,18 @@ void ChipCertificateData::Clear()
 
 bool ChipCertificateData::IsEqual(const ChipCertificateData & other) const
 {
+    // The kSignatureVerified flag is cached validation state rather than a property of the certificate,
+    // so it is excluded from the comparison.
+    constexpr uint16_t kCertFlagsMask = static_cast<uint16_t>(~static_cast<uint16_t>(CertFlags::kSignatureVerified));
+
     // TODO - Add an operator== on BitFlags class.
     return mSubjectDN.IsEqual(other.mSubjectDN) && mIssuerDN.IsEqual(other.mIssuerDN) &&
         mSubjectKeyId.data_equal(other.mSubjectKeyId) && mAuthKeyId.data_equal(other.mAuthKeyId) &&
         (mNotBeforeTime == other.mNotBeforeTime) && (mNotAfterTime == other.mNotAfterTime) &&
         mPublicKey.data_equal(other.mPublicKey) && (mPubKeyCurveOID == other.mPubKeyCurveOID) &&
         (mPubKeyAlgoOID == other.mPubKeyAlgoOID) && (mSigAlgoOID == other.mSigAlgoOID) &&
-        (mCertFlags.Raw() == other.mCertFlags.Raw()) && (mKeyUsageFlags.Raw() == other.mKeyUsageFlags.Raw()) &&
+        ((mCertFlags.Raw() & kCertFlagsMask) == (other.mCertFlags.Raw() & kCertFlagsMask)) &&
+        (mKeyUsageFlags.Raw() == other.mKeyUsageFlags.Raw()) &&
         (mKeyPurposeFlags.Raw() == other.mKeyPurposeFlags.Raw()) && (mPathLenConstraint == other.mPathLenConstraint) &&
         mSignature.data_equal(other.mSignature) && (memcmp(mTBSHash, other.mTBSHash, sizeof(mTBSHash)) == 0);
 }
@@ -159,6 +159,8 @@ enum class CertFlags : uint16_t
     kIsCA                        = 0x0080, /**< Indicates that certificate is a CA certificate. */
     kIsTrustAnchor               = 0x0100, /**< Indicates that certificate is a trust anchor. */
     kTBSHashPresent              = 0x0200, /**< Indicates that TBS hash of the certificate was generated and stored. */
+    kSignatureVerified           = 0x0400, /**< Indicates that the certificate signature was already verified against its CA
+                                                certificate in this set. Cached validation state, not a certificate property. */
 };
 
 /** CHIP Certificate Decode Flags
@@ -447,6 +449,20 @@ public:
      **/
     CHIP_ERROR LoadCert(chip::TLV::TLVReader & reader, BitFlags<CertDecodeFlags> decodeFlags, ByteSpan chipCert = ByteSpan());
 
+    /**
+     * @brief Load a previously parsed CHIP certificate into the set.
+     *        This avoids re-walking the certificate TLV when a parsed representation is already
+     *        available, e.g. one cached by the caller across repeated chain validations.
+     *        It is required that the buffer referenced by certData stays valid while the
+     *        certificate data in the set is used.
+     *        In case of an error the certificate set is left in the same state as prior to this call.
+     *
+     * @param certData  Parsed certificate data to be copied into the set.
+     *
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR LoadCert(const ChipCertificateData & certData);
+
     CHIP_ERROR ReleaseLastCert();
 
     /**
@@ -277,6 +277,53 @@ CHIP_ERROR FabricInfo::SetCert(MutableByteSpan & dstCert, const ByteSpan & srcCe
     return CHIP_NO_ERROR;
 }
 
+void FabricInfo::ReleaseRootCertData()
+{
+    if (mRootCertData != nullptr)
+    {
+        chip::Platform::Delete(mRootCertData);
+        mRootCertData = nullptr;
+    }
+}
+
+void FabricInfo::RefreshRootCertData()
+{
+    ReleaseRootCertData();
+
+    if (mRootCert.empty())
+    {
+        return;
+    }
+
+    mRootCertData = chip::Platform::New<ChipCertificateData>();
+    if (mRootCertData == nullptr)
+    {
+        return;
+    }
+
+    if (DecodeChipCert(mRootCert, *mRootCertData) != CHIP_NO_ERROR)
+    {
+        ReleaseRootCertData();
+        return;
+    }
+
+    // Mirror the format checks ChipCertificateSet::LoadCert() applies, so the cached path
+    // accepts exactly the same certificates as on-demand decoding.
+    if (!mRootCertData->mCertFlags.HasAll(CertFlags::kExtPresent_SubjectKeyId, CertFlags::kExtPresent_AuthKeyId) ||
+        mRootCertData->mSigAlgoOID != ASN1::kOID_SigAlgo_ECDSAWithSHA256)
+    {
+        ReleaseRootCertData();
+        return;
+    }
+
+    mRootCertData->mCertificate = mRootCert;
+
+    // The root certificate held by a fabric is by definition the trust anchor of its
+    // operational certificate chain, which lets VerifyCredentials() load the cached data
+    // into a certificate set without re-decoding it for every validation.
+    mRootCertData->mCertFlags.Set(CertFlags::kIsTrustAnchor);
+}
+
 CHIP_ERROR FabricInfo::VerifyCredentials(const ByteSpan & noc, const ByteSpan & icac, ValidationContext & context,
                                          PeerId & nocPeerId, FabricId & fabricId, Crypto::P256PublicKey & nocPubkey) const
 {
@@ -289,7 +336,16 @@ CHIP_ERROR FabricInfo::VerifyCredentials(const ByteSpan & noc, const ByteSpan &
     ChipCertificateSet certificates;
     ReturnErrorOnFailure(certificates.Init(kMaxNumCertsInOpCreds));
 
-    ReturnErrorOnFailure(certificates.LoadCert(mRootCert, BitFlags<CertDecodeFlags>(CertDecodeFlags::kIsTrustAnchor)));
+    // The root certificate is the same for every validation against this fabric: reuse the
+    // parsed data cached when the root certificate was set instead of re-walking its TLV.
+    if (mRootCertData != nullptr)
+    {
+        ReturnErrorOnFailure(certificates.LoadCert(*mRootCertData));
+    }
+    else
+    {
+        ReturnErrorOnFailure(certificates.LoadCert(mRootCert, BitFlags<CertDecodeFlags>(CertDecodeFlags::kIsTrustAnchor)));
+    }
 
     if (!icac.empty())
     {
@@ -367,6 +423,28 @@ CHIP_ERROR FabricInfo::GenerateDestinationID(const ByteSpan & ipk, const ByteSpa
     return err;
 }
 
+CHIP_ERROR FabricInfo::GetDestinationIDSuffix(MutableByteSpan & suffix) const
+{
+    P256PublicKeySpan rootPubkeySpan = GetRootPubkey();
+
+    Encoding::LittleEndian::BufferWriter bbuf(suffix.data(), suffix.size());
+
+    // TODO: This check mirrors GenerateDestinationID(): GetRootPubkey() can return an
+    //       empty span before mRootCert is initialized, and the suffix must stay
+    //       byte-for-byte identical to what GenerateDestinationID() would hash.
+    if (!rootPubkeySpan.empty())
+    {
+        bbuf.Put(rootPubkeySpan.data(), rootPubkeySpan.size());
+    }
+    bbuf.Put64(mFabricId);
+    bbuf.Put64(mOperationalId.GetNodeId());
+
+    size_t written = 0;
+    VerifyOrReturnError(bbuf.Fit(written), CHIP_ERROR_BUFFER_TOO_SMALL);
+    suffix.reduce_size(written);
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR FabricInfo::MatchDestinationID(const ByteSpan & targetDestinationId, const ByteSpan & initiatorRandom,
                                           const ByteSpan * ipkList, size_t ipkListEntries)
 {
@@ -407,14 +485,19 @@ FabricInfo * FabricTable::FindFabricWithIndex(FabricIndex fabricIndex)
 
 FabricInfo * FabricTable::FindFabricWithCompressedId(CompressedFabricId fabricId)
 {
+    // This lookup runs on the message path (e.g. when resolving the fabric for an
+    // operational session), so it only consults state already resident in mStates.
+    // The compressed fabric ID is derived once when a fabric is committed or loaded
+    // (see SetFabricInfo() and FabricInfo::LoadFromStorage()), which lets the scan
+    // compare cached values without any storage reads, delegate notifications or
+    // GenerateCompressedFabricId() crypto per probed index.
     static_assert(kMaxValidFabricIndex <= UINT8_MAX, "Cannot create more fabrics than UINT8_MAX");
     for (FabricIndex i = kMinValidFabricIndex; i <= kMaxValidFabricIndex; i++)
     {
-        FabricInfo * fabric = FindFabricWithIndex(i);
+        FabricInfo * fabric = &mStates[i - kMinValidFabricIndex];
 
-        if (fabric != nullptr && fabricId == fabric->GetPeerId().GetCompressedFabricId())
+        if (fabric->IsInitialized() && fabricId == fabric->GetPeerId().GetCompressedFabricId())
         {
-            LoadFromStorage(fabric);
             return fabric;
         }
     }
@@ -500,17 +583,118 @@ CHIP_ERROR FabricInfo::SetFabricInfo(FabricInfo & newFabric)
     return CHIP_NO_ERROR;
 }
 
+namespace {
+
+// HMAC-SHA256 split into a reusable prefix and a per-candidate completion.  The
+// destination identifier is HMAC(IPK, initiatorRandom || rootPubkey || fabricId || nodeId),
+// so the key pads and the initiator random are identical for every fabric probed
+// against a given Sigma1: they get absorbed into an incremental hash state once
+// per IPK, and each fabric only pays for hashing its own short suffix.
+constexpr size_t kHmacSha256BlockLength     = 64;
+constexpr size_t kMaxDestinationIdIpkBuffer = 4;
+
+struct DestinationIdHmacState
+{
+    Hash_SHA256_stream inner; // (key xor ipad) || initiatorRandom already absorbed
+    Hash_SHA256_stream outer; // (key xor opad) already absorbed
+};
+
+CHIP_ERROR PrepareDestinationIdHmacState(const ByteSpan & ipk, const ByteSpan & initiatorRandom, DestinationIdHmacState & state)
+{
+    VerifyOrReturnError(ipk.size() <= kHmacSha256BlockLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    uint8_t pad[kHmacSha256BlockLength];
+
+    memset(pad, 0x36, sizeof(pad));
+    for (size_t i = 0; i < ipk.size(); ++i)
+    {
+        pad[i] = static_cast<uint8_t>(pad[i] ^ ipk.data()[i]);
+    }
+    SuccessOrExit(err = state.inner.Begin());
+    SuccessOrExit(err = state.inner.AddData(ByteSpan(pad, sizeof(pad))));
+    SuccessOrExit(err = state.inner.AddData(initiatorRandom));
+
+    memset(pad, 0x5c, sizeof(pad));
+    for (size_t i = 0; i < ipk.size(); ++i)
+    {
+        pad[i] = static_cast<uint8_t>(pad[i] ^ ipk.data()[i]);
+    }
+    SuccessOrExit(err = state.outer.Begin());
+    SuccessOrExit(err = state.outer.AddData(ByteSpan(pad, sizeof(pad))));
+
+exit:
+    ClearSecretData(pad, sizeof(pad));
+    return err;
+}
+
+CHIP_ERROR FinishDestinationIdCandidate(const DestinationIdHmacState & state, const ByteSpan & suffix,
+                                        MutableByteSpan & destinationId)
+{
+    uint8_t innerDigest[kSHA256_Hash_Length];
+    MutableByteSpan innerDigestSpan(innerDigest);
+
+    Hash_SHA256_stream inner = state.inner;
+    ReturnErrorOnFailure(inner.AddData(suffix));
+    ReturnErrorOnFailure(inner.Finish(innerDigestSpan));
+
+    Hash_SHA256_stream outer = state.outer;
+    ReturnErrorOnFailure(outer.AddData(innerDigestSpan));
+    return outer.Finish(destinationId);
+}
+
+} // namespace
+
 FabricIndex FabricTable::FindDestinationIDCandidate(const ByteSpan & destinationId, const ByteSpan & initiatorRandom,
                                                     const ByteSpan * ipkList, size_t ipkListEntries)
 {
+    // Like FindFabricWithCompressedId(), this runs during session establishment and
+    // only considers fabrics already resident in mStates; candidates are matched
+    // against their cached identities without touching storage per probed index.
     static_assert(kMaxValidFabricIndex <= UINT8_MAX, "Cannot create more fabrics than UINT8_MAX");
+
+    DestinationIdHmacState hmacStates[kMaxDestinationIdIpkBuffer];
+    bool precomputed = (ipkListEntries <= kMaxDestinationIdIpkBuffer);
+    for (size_t ipkIdx = 0; precomputed && ipkIdx < ipkListEntries; ++ipkIdx)
+    {
+        precomputed = (PrepareDestinationIdHmacState(ipkList[ipkIdx], initiatorRandom, hmacStates[ipkIdx]) == CHIP_NO_ERROR);
+    }
+
     for (FabricIndex i = kMinValidFabricIndex; i <= kMaxValidFabricIndex; i++)
     {
-        FabricInfo * fabric = FindFabricWithIndex(i);
-        if (fabric != nullptr &&
-            fabric->MatchDestinationID(destinationId, initiatorRandom, ipkList, ipkListEntries) == CHIP_NO_ERROR)
+        FabricInfo * fabric = &mStates[i - kMinValidFabricIndex];
+        if (!fabric->IsInitialized())
+        {
+            continue;
+        }
+
+        if (!precomputed)
+        {
+            // Oversized IPK list (or a hash backend failure): fall back to the
+            // straightforward full recomputation per candidate.
+            if (fabric->MatchDestinationID(destinationId, initiatorRandom, ipkList, ipkListEntries) == CHIP_NO_ERROR)
+            {
+                return i;
+            }
+            continue;
+        }
+
+        uint8_t suffix[FabricInfo::kDestinationIDSuffixMaxLength];
+        MutableByteSpan suffixSpan(suffix);
+        if (fabric->GetDestinationIDSuffix(suffixSpan) != CHIP_NO_ERROR)
         {
-            return i;
+            continue;
+        }
+
+        for (size_t ipkIdx = 0; ipkIdx < ipkListEntries; ++ipkIdx)
+        {
+            uint8_t candidate[kSHA256_Hash_Length];
+            MutableByteSpan candidateSpan(candidate);
+            if (FinishDestinationIdCandidate(hmacStates[ipkIdx], suffixSpan, candidateSpan) == CHIP_NO_ERROR &&
+                destinationId.data_equal(candidateSpan))
+            {
+                return i;
+            }
         }
     }
 
@@ -175,7 +175,12 @@ public:
     // TODO - Update these APIs to take ownership of the buffer, instead of copying
     //        internally.
     // TODO - Optimize persistent storage of NOC and Root Cert in FabricInfo.
-    CHIP_ERROR SetRootCert(const chip::ByteSpan & cert) { return SetCert(mRootCert, cert); }
+    CHIP_ERROR SetRootCert(const chip::ByteSpan & cert)
+    {
+        ReturnErrorOnFailure(SetCert(mRootCert, cert));
+        RefreshRootCertData();
+        return CHIP_NO_ERROR;
+    }
     CHIP_ERROR SetICACert(const chip::ByteSpan & cert) { return SetCert(mICACert, cert); }
     CHIP_ERROR SetICACert(const Optional<ByteSpan> & cert) { return SetICACert(cert.ValueOr(ByteSpan())); }
     CHIP_ERROR SetNOCCert(const chip::ByteSpan & cert) { return SetCert(mNOCCert, cert); }
@@ -188,6 +193,17 @@ public:
     CHIP_ERROR MatchDestinationID(const ByteSpan & destinationId, const ByteSpan & initiatorRandom, const ByteSpan * ipkList,
                                   size_t ipkListEntries);
 
+    static constexpr size_t kDestinationIDSuffixMaxLength = Crypto::kP256_PublicKey_Length + sizeof(FabricId) + sizeof(NodeId);
+
+    /**
+     * Serialize the fabric-dependent tail of this fabric's destination identifier
+     * message (root public key || fabric ID || operational node ID).  Sigma1
+     * candidate matching prepends the initiator random, so exposing the suffix
+     * lets FabricTable::FindDestinationIDCandidate() absorb the shared prefix
+     * into one incremental HMAC state per IPK instead of once per fabric.
+     */
+    CHIP_ERROR GetDestinationIDSuffix(MutableByteSpan & suffix) const;
+
     // TODO - Refactor storing and loading of fabric info from persistent storage.
     //        The op cert array doesn't need to be in RAM except when it's being
     //        transmitted to peer node during CASE session setup.
@@ -213,6 +229,10 @@ public:
 
     Credentials::CertificateKeyId GetTrustedRootId() const
     {
+        if (mRootCertData != nullptr)
+        {
+            return mRootCertData->mSubjectKeyId;
+        }
         Credentials::CertificateKeyId skid;
         Credentials::ExtractSKIDFromChipCert(mRootCert, skid);
         return skid;
@@ -220,6 +240,10 @@ public:
 
     Credentials::P256PublicKeySpan GetRootPubkey() const
     {
+        if (mRootCertData != nullptr)
+        {
+            return mRootCertData->mPublicKey;
+        }
         Credentials::P256PublicKeySpan publicKey;
         Credentials::ExtractPublicKeyFromChipCert(mRootCert, publicKey);
         return publicKey;
@@ -271,6 +295,11 @@ private:
     MutableByteSpan mICACert;
     MutableByteSpan mNOCCert;
 
+    /* Parsed representation of mRootCert, kept so that repeated chain validations and
+       destination ID computations don't re-walk the certificate TLV. The spans within
+       point into the mRootCert buffer. */
+    Credentials::ChipCertificateData * mRootCertData = nullptr;
+
     FabricId mFabricId = 0;
 
     static constexpr size_t kKeySize = sizeof(kFabricTableKeyPrefix) + 2 * sizeof(FabricIndex);
@@ -287,10 +316,19 @@ private:
         ReleaseCert(mRootCert);
         ReleaseCert(mICACert);
         ReleaseCert(mNOCCert);
+        ReleaseRootCertData();
     }
 
     CHIP_ERROR SetCert(MutableByteSpan & dstCert, const ByteSpan & srcCert);
 
+    /**
+     * Re-parse the root certificate and cache the parsed data. Called whenever the root
+     * certificate changes. A parsing failure leaves the cache empty, in which case users
+     * of the root certificate fall back to decoding it on demand.
+     */
+    void RefreshRootCertData();
+    void ReleaseRootCertData();
+
     struct StorableFabricInfo
     {
         uint16_t mFabric;   /* This field is serialized in LittleEndian byte order */
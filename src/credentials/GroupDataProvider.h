@@ -286,6 +286,15 @@ public:
     // General
     virtual CHIP_ERROR Decrypt(PacketHeader packetHeader, PayloadHeader & payloadHeader, System::PacketBufferHandle & msg) = 0;
 
+    /**
+     *  Checks whether the given group session ID matches any operational group key
+     *  currently installed, so that incoming group messages which cannot possibly be
+     *  decrypted are dropped before any decryption is attempted. Implementations that
+     *  do not track session IDs must return true, so callers fall back to trial
+     *  decryption.
+     */
+    virtual bool IsGroupSessionId(uint16_t session_id) { return true; }
+
     // Listener
     void SetListener(GroupListener * listener) { mListener = listener; };
     void RemoveListener() { mListener = nullptr; };
@@ -14,7 +14,9 @@
  *    See the License for the specific language governing permissions and
  *    limitations under the License.
  */
+#include <credentials/FabricTable.h>
 #include <credentials/GroupDataProviderImpl.h>
+#include <lib/core/CHIPEncoding.h>
 #include <lib/core/CHIPTLV.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
@@ -86,6 +88,30 @@ struct PersistentData
     }
 };
 
+// Brackets a mutator that issues several Save/Delete calls with the storage
+// delegate's transaction hints, so that backends which commit each write
+// individually (e.g. flash) can coalesce the batch into a single commit. On
+// delegates with the default no-op hooks this has no effect.
+class StorageTransaction
+{
+public:
+    StorageTransaction(chip::PersistentStorageDelegate & storage) : mStorage(storage)
+    {
+        mBegun = (CHIP_NO_ERROR == mStorage.SyncBeginTransaction());
+    }
+    ~StorageTransaction()
+    {
+        if (mBegun)
+        {
+            LogErrorOnFailure(mStorage.SyncCommitTransaction());
+        }
+    }
+
+private:
+    chip::PersistentStorageDelegate & mStorage;
+    bool mBegun = false;
+};
+
 struct LinkedData : public PersistentData<kPersistentBufferMax>
 {
     static constexpr uint16_t kMinLinkId = 1;
@@ -123,10 +149,13 @@ struct FabricData : public PersistentData<kPersistentBufferMax>
     CHIP_ERROR UpdateKey(DefaultStorageKeyAllocator & key) override
     {
         VerifyOrReturnError(kUndefinedFabricIndex != fabric_index, CHIP_ERROR_INVALID_FABRIC_ID);
-        key.FabricGroups(fabric_index);
+        fabric_prefix.Sync(fabric_index);
+        key.FabricGroups(fabric_prefix);
         return CHIP_NO_ERROR;
     }
 
+    FabricStorageKeyPrefix fabric_prefix;
+
     void Clear() override
     {
         first_group  = kUndefinedGroupId;
@@ -199,10 +228,13 @@ struct GroupData : public GroupDataProvider::GroupInfo, LinkedData
     CHIP_ERROR UpdateKey(DefaultStorageKeyAllocator & key) override
     {
         VerifyOrReturnError(kUndefinedFabricIndex != fabric_index, CHIP_ERROR_INVALID_FABRIC_ID);
-        key.FabricGroup(fabric_index, id);
+        fabric_prefix.Sync(fabric_index);
+        key.FabricGroup(fabric_prefix, id);
         return CHIP_NO_ERROR;
     }
 
+    FabricStorageKeyPrefix fabric_prefix;
+
     void Clear() override
     {
         group_id = kUndefinedGroupId;
@@ -333,10 +365,13 @@ struct KeyMapData : public GroupDataProvider::GroupKey, LinkedData
     CHIP_ERROR UpdateKey(DefaultStorageKeyAllocator & key) override
     {
         VerifyOrReturnError(kUndefinedFabricIndex != fabric_index, CHIP_ERROR_INVALID_FABRIC_ID);
-        key.FabricGroupKey(fabric_index, id);
+        fabric_prefix.Sync(fabric_index);
+        key.FabricGroupKey(fabric_prefix, id);
         return CHIP_NO_ERROR;
     }
 
+    FabricStorageKeyPrefix fabric_prefix;
+
     void Clear() override {}
 
     CHIP_ERROR Serialize(TLV::TLVWriter & writer) const override
@@ -450,10 +485,13 @@ struct EndpointData : GroupDataProvider::GroupEndpoint, LinkedData
     CHIP_ERROR UpdateKey(DefaultStorageKeyAllocator & key) override
     {
         VerifyOrReturnError(kUndefinedFabricIndex != fabric_index, CHIP_ERROR_INVALID_FABRIC_ID);
-        key.FabricGroupEndpoint(fabric_index, group_link_id, id);
+        fabric_prefix.Sync(fabric_index);
+        key.FabricGroupEndpoint(fabric_prefix, group_link_id, id);
         return CHIP_NO_ERROR;
     }
 
+    FabricStorageKeyPrefix fabric_prefix;
+
     void Clear() override { next = kInvalidEndpointId; }
 
     CHIP_ERROR Serialize(TLV::TLVWriter & writer) const override
@@ -544,10 +582,13 @@ struct KeySetData : public GroupDataProvider::KeySet, PersistentData<kPersistent
     {
         VerifyOrReturnError(kUndefinedFabricIndex != fabric_index, CHIP_ERROR_INVALID_FABRIC_ID);
         VerifyOrReturnError(kUndefinedFabricIndex != fabric_index, CHIP_ERROR_INVALID_KEY_ID);
-        key.FabricKeyset(fabric_index, keyset_id);
+        fabric_prefix.Sync(fabric_index);
+        key.FabricKeyset(fabric_prefix, keyset_id);
         return CHIP_NO_ERROR;
     }
 
+    FabricStorageKeyPrefix fabric_prefix;
+
     void Clear() override
     {
         policy        = KeySet::SecurityPolicy::kStandard;
@@ -677,6 +718,8 @@ constexpr size_t GroupDataProviderImpl::kIteratorsMax;
 CHIP_ERROR GroupDataProviderImpl::Init()
 {
     mInitialized = true;
+    // Rebuild the group session ID filter table from the persisted keysets.
+    LoadGroupSessionIds();
     return CHIP_NO_ERROR;
 }
 
@@ -687,6 +730,11 @@ void GroupDataProviderImpl::Finish()
     mGroupKeyIterators.ReleaseAll();
     mEndpointIterators.ReleaseAll();
     mKeySetIterators.ReleaseAll();
+    for (GroupSessionEntry & entry : mGroupSessionIds)
+    {
+        entry.fabric_index = kUndefinedFabricIndex;
+    }
+    mGroupSessionIdsIncomplete = false;
 }
 
 //
@@ -747,6 +795,7 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupInfoAt(chip::FabricIndex fabric_index,
 {
     VerifyOrReturnError(mInitialized, CHIP_ERROR_INTERNAL);
 
+    StorageTransaction transaction(mStorage);
     FabricData fabric(fabric_index);
     GroupData group;
 
@@ -826,6 +875,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfoAt(chip::FabricIndex fabric_ind
 {
     VerifyOrReturnError(mInitialized, CHIP_ERROR_INTERNAL);
 
+    StorageTransaction transaction(mStorage);
     FabricData fabric(fabric_index);
     GroupData group;
 
@@ -889,6 +939,7 @@ CHIP_ERROR GroupDataProviderImpl::AddEndpoint(chip::FabricIndex fabric_index, ch
 {
     VerifyOrReturnError(mInitialized, CHIP_ERROR_INTERNAL);
 
+    StorageTransaction transaction(mStorage);
     FabricData fabric(fabric_index);
     GroupData group;
 
@@ -947,6 +998,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index,
 {
     VerifyOrReturnError(mInitialized, CHIP_ERROR_INTERNAL);
 
+    StorageTransaction transaction(mStorage);
     FabricData fabric(fabric_index);
     GroupData group;
     EndpointData endpoint;
@@ -982,6 +1034,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index,
 {
     VerifyOrReturnError(mInitialized, CHIP_ERROR_INTERNAL);
 
+    StorageTransaction transaction(mStorage);
     FabricData fabric(fabric_index);
 
     ReturnErrorOnFailure(fabric.Load(mStorage));
@@ -1174,6 +1227,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
 {
     VerifyOrReturnError(mInitialized, CHIP_ERROR_INTERNAL);
 
+    StorageTransaction transaction(mStorage);
     FabricData fabric(fabric_index);
     GroupData group;
 
@@ -1204,6 +1258,7 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index,
 {
     VerifyOrReturnError(mInitialized, CHIP_ERROR_INTERNAL);
 
+    StorageTransaction transaction(mStorage);
     FabricData fabric(fabric_index);
     KeyMapData map(fabric_index);
 
@@ -1269,6 +1324,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
 {
     VerifyOrReturnError(mInitialized, CHIP_ERROR_INTERNAL);
 
+    StorageTransaction transaction(mStorage);
     FabricData fabric(fabric_index);
     KeyMapData map;
 
@@ -1347,10 +1403,126 @@ void GroupDataProviderImpl::GroupKeyIteratorImpl::Release()
 
 constexpr size_t GroupDataProvider::EpochKey::kLengthBytes;
 
+namespace {
+
+// Computes the "Group Key Hash" of an operational group key: the big-endian
+// first 16 bits of CHIP_Crypto_KDF(key, salt = nil, info = "GroupKeyHash").
+// Group messages carry this value as their session ID.
+CHIP_ERROR DeriveGroupSessionId(const uint8_t * key, uint16_t & session_id)
+{
+    static const uint8_t kGroupKeyHashInfo[] = { 'G', 'r', 'o', 'u', 'p', 'K', 'e', 'y', 'H', 'a', 's', 'h' };
+    uint8_t hash[sizeof(uint16_t)];
+    Crypto::HKDF_sha crypto;
+    ReturnErrorOnFailure(crypto.HKDF_SHA256(key, GroupDataProvider::EpochKey::kLengthBytes, nullptr, 0, kGroupKeyHashInfo,
+                                            sizeof(kGroupKeyHashInfo), hash, sizeof(hash)));
+    session_id = Encoding::BigEndian::Get16(hash);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+void GroupDataProviderImpl::AddKeySetSessionIds(chip::FabricIndex fabric_index, const KeySet & keyset)
+{
+    for (uint8_t i = 0; i < keyset.num_keys_used; i++)
+    {
+        uint16_t session_id = 0;
+        if (CHIP_NO_ERROR != DeriveGroupSessionId(keyset.epoch_keys[i].key, session_id))
+        {
+            mGroupSessionIdsIncomplete = true;
+            return;
+        }
+        GroupSessionEntry * free_entry = nullptr;
+        for (GroupSessionEntry & entry : mGroupSessionIds)
+        {
+            if (kUndefinedFabricIndex == entry.fabric_index)
+            {
+                free_entry = &entry;
+                break;
+            }
+        }
+        if (nullptr == free_entry)
+        {
+            // A missing entry would cause decryptable messages to be dropped, so
+            // an overflowing table disables the filter instead.
+            ChipLogError(Support, "Group session ID table full, group message filtering disabled");
+            mGroupSessionIdsIncomplete = true;
+            return;
+        }
+        free_entry->fabric_index = fabric_index;
+        free_entry->keyset_id    = keyset.keyset_id;
+        free_entry->session_id   = session_id;
+    }
+}
+
+void GroupDataProviderImpl::RemoveKeySetSessionIds(chip::FabricIndex fabric_index, chip::KeysetId keyset_id)
+{
+    for (GroupSessionEntry & entry : mGroupSessionIds)
+    {
+        if ((entry.fabric_index == fabric_index) && (entry.keyset_id == keyset_id))
+        {
+            entry.fabric_index = kUndefinedFabricIndex;
+        }
+    }
+}
+
+void GroupDataProviderImpl::RemoveFabricSessionIds(chip::FabricIndex fabric_index)
+{
+    for (GroupSessionEntry & entry : mGroupSessionIds)
+    {
+        if (entry.fabric_index == fabric_index)
+        {
+            entry.fabric_index = kUndefinedFabricIndex;
+        }
+    }
+}
+
+void GroupDataProviderImpl::LoadGroupSessionIds()
+{
+    for (chip::FabricIndex fabric_index = kMinValidFabricIndex; fabric_index <= kMaxValidFabricIndex; fabric_index++)
+    {
+        FabricData fabric(fabric_index);
+        if (CHIP_NO_ERROR != fabric.Load(mStorage))
+        {
+            continue;
+        }
+
+        KeySetData keyset(fabric_index, fabric.first_keyset);
+        size_t keyset_count = 0;
+
+        // Loop the keysets associated with the fabric
+        while (keyset_count < fabric.keyset_count)
+        {
+            if (CHIP_NO_ERROR != keyset.Load(mStorage))
+            {
+                break;
+            }
+            AddKeySetSessionIds(fabric_index, keyset);
+            keyset.keyset_id = keyset.next;
+            keyset_count++;
+        }
+    }
+}
+
+bool GroupDataProviderImpl::IsGroupSessionId(uint16_t session_id)
+{
+    VerifyOrReturnError(mInitialized, true);
+    // An incomplete table cannot prove a negative, accept everything
+    VerifyOrReturnError(!mGroupSessionIdsIncomplete, true);
+    for (const GroupSessionEntry & entry : mGroupSessionIds)
+    {
+        if ((kUndefinedFabricIndex != entry.fabric_index) && (entry.session_id == session_id))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, const KeySet & in_keyset)
 {
     VerifyOrReturnError(mInitialized, CHIP_ERROR_INTERNAL);
 
+    StorageTransaction transaction(mStorage);
     FabricData fabric(fabric_index);
     KeySetData keyset;
 
@@ -1369,7 +1541,7 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
     if (found)
     {
         // Update existing keyset info, keep next
-        return keyset.Save(mStorage);
+        ReturnErrorOnFailure(keyset.Save(mStorage));
     }
     else
     {
@@ -1379,8 +1551,13 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
         // Update fabric
         fabric.keyset_count++;
         fabric.first_keyset = in_keyset.keyset_id;
-        return fabric.Save(mStorage);
+        ReturnErrorOnFailure(fabric.Save(mStorage));
     }
+
+    // Refresh the precomputed session IDs for this keyset
+    RemoveKeySetSessionIds(fabric_index, in_keyset.keyset_id);
+    AddKeySetSessionIds(fabric_index, keyset);
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint16_t target_id, KeySet & out_keyset)
@@ -1406,12 +1583,14 @@ CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, u
 {
     VerifyOrReturnError(mInitialized, CHIP_ERROR_INTERNAL);
 
+    StorageTransaction transaction(mStorage);
     FabricData fabric(fabric_index);
     KeySetData keyset;
 
     ReturnErrorOnFailure(fabric.Load(mStorage));
     VerifyOrReturnError(keyset.Find(mStorage, fabric, target_id), CHIP_ERROR_NOT_FOUND);
     ReturnErrorOnFailure(keyset.Delete(mStorage));
+    RemoveKeySetSessionIds(fabric_index, target_id);
 
     if (keyset.first)
     {
@@ -1484,6 +1663,7 @@ void GroupDataProviderImpl::KeySetIteratorImpl::Release()
 
 CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 {
+    StorageTransaction transaction(mStorage);
     FabricData fabric(fabric_index);
 
     // Fabric data defaults to zero, so if not entry is found, no mappings, or keys are removed
@@ -1522,6 +1702,9 @@ CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
         keyset_count++;
     }
 
+    // Drop any session IDs still cached for this fabric
+    RemoveFabricSessionIds(fabric_index);
+
     // Remove fabric
     return fabric.Delete(mStorage);
 }
@@ -78,6 +78,7 @@ public:
 
     // General
     CHIP_ERROR Decrypt(PacketHeader packetHeader, PayloadHeader & payloadHeader, System::PacketBufferHandle & msg) override;
+    bool IsGroupSessionId(uint16_t session_id) override;
 
 private:
     class GroupInfoIteratorImpl : public GroupInfoIterator
@@ -149,8 +150,28 @@ private:
     };
     CHIP_ERROR RemoveEndpoints(chip::FabricIndex fabric_index, chip::GroupId group_id);
 
+    // Precomputed "Group Key Hash" session IDs of every installed operational
+    // group key, so group messages with an unknown session ID can be rejected
+    // with a table scan instead of trial decryption.
+    struct GroupSessionEntry
+    {
+        chip::FabricIndex fabric_index = kUndefinedFabricIndex;
+        chip::KeysetId keyset_id       = 0;
+        uint16_t session_id            = 0;
+    };
+    static constexpr size_t kMaxGroupSessionIds = CHIP_CONFIG_MAX_DEVICE_ADMINS * kMaxGroupKeysPerFabric * 3;
+
+    void LoadGroupSessionIds();
+    void AddKeySetSessionIds(chip::FabricIndex fabric_index, const KeySet & keyset);
+    void RemoveKeySetSessionIds(chip::FabricIndex fabric_index, chip::KeysetId keyset_id);
+    void RemoveFabricSessionIds(chip::FabricIndex fabric_index);
+
     chip::PersistentStorageDelegate & mStorage;
     bool mInitialized = false;
+    GroupSessionEntry mGroupSessionIds[kMaxGroupSessionIds];
+    // Set when the table could not be fully populated; the filter then accepts
+    // every session ID rather than risk dropping decryptable messages.
+    bool mGroupSessionIdsIncomplete = false;
     BitMapObjectPool<GroupInfoIteratorImpl, kIteratorsMax> mGroupInfoIterators;
     BitMapObjectPool<GroupKeyIteratorImpl, kIteratorsMax> mGroupKeyIterators;
     BitMapObjectPool<EndpointIteratorImpl, kIteratorsMax> mEndpointIterators;
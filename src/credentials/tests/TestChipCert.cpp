@@ -598,6 +598,60 @@ static void TestChipCert_CertUsage(nlTestSuite * inSuite, void * inContext)
     certSet.Release();
 }
 
+static void TestChipCert_ValidationCache(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err;
+    ChipCertificateSet certSet;
+    ValidationContext validContext;
+
+    err = certSet.Init(kStandardCertsCount);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // Load the node certificate before the ICA so that the ICA is the last certificate in the set.
+    err = LoadTestCert(certSet, TestCert::kRoot01, sNullLoadFlag, sTrustAnchorFlag);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = LoadTestCert(certSet, TestCert::kNode01_01, sNullLoadFlag, sGenTBSHashFlag);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = LoadTestCert(certSet, TestCert::kICA01, sNullLoadFlag, sGenTBSHashFlag);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // A successful validation caches the signature verification result on each certificate in the chain.
+    validContext.Reset();
+    err = SetEffectiveTime(validContext, 2020, 10, 16);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = certSet.ValidateCert(&certSet.GetCertSet()[1], validContext);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, certSet.GetCertSet()[1].mCertFlags.Has(CertFlags::kSignatureVerified));
+    NL_TEST_ASSERT(inSuite, certSet.GetCertSet()[2].mCertFlags.Has(CertFlags::kSignatureVerified));
+
+    // Repeated validation succeeds through the cached results.
+    validContext.Reset();
+    err = SetEffectiveTime(validContext, 2020, 10, 16);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = certSet.ValidateCert(&certSet.GetCertSet()[1], validContext);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // Releasing the ICA invalidates the cached result of the node certificate it signed.
+    err = certSet.ReleaseLastCert();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !certSet.GetCertSet()[1].mCertFlags.Has(CertFlags::kSignatureVerified));
+
+    // Reloading the ICA restores a fully verifiable chain.
+    err = LoadTestCert(certSet, TestCert::kICA01, sNullLoadFlag, sGenTBSHashFlag);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    validContext.Reset();
+    err = SetEffectiveTime(validContext, 2020, 10, 16);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = certSet.ValidateCert(&certSet.GetCertSet()[1], validContext);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    certSet.Release();
+}
+
 static void TestChipCert_CertType(nlTestSuite * inSuite, void * inContext)
 {
     CHIP_ERROR err;
@@ -728,6 +782,39 @@ static void TestChipCert_LoadDuplicateCerts(nlTestSuite * inSuite, void * inCont
     NL_TEST_ASSERT(inSuite, certSet.GetCertCount() == 3);
 }
 
+static void TestChipCert_LoadParsedCert(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err;
+    ChipCertificateSet certSet;
+    ChipCertificateData certData;
+    ByteSpan cert;
+
+    err = certSet.Init(kStandardCertsCount);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = GetTestCert(TestCert::kRoot01, sNullLoadFlag, cert);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = DecodeChipCert(cert, certData);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // Loading previously parsed certificate data should add the certificate to the set.
+    err = certSet.LoadCert(certData);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, certSet.GetCertCount() == 1);
+    NL_TEST_ASSERT(inSuite, certSet.FindCert(certData.mSubjectKeyId) != nullptr);
+
+    // Loading the same parsed certificate again should not add a duplicate entry.
+    err = certSet.LoadCert(certData);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, certSet.GetCertCount() == 1);
+
+    // Loading the same certificate from its encoded form should also be recognized as a duplicate.
+    err = certSet.LoadCert(cert, sNullDecodeFlag);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, certSet.GetCertCount() == 1);
+}
+
 static void TestChipCert_GenerateRootCert(nlTestSuite * inSuite, void * inContext)
 {
     // Generate a new keypair for cert signing
@@ -1263,9 +1350,11 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test CHIP Certificate Validation", TestChipCert_CertValidation),
     NL_TEST_DEF("Test CHIP Certificate Validation time", TestChipCert_CertValidTime),
     NL_TEST_DEF("Test CHIP Certificate Usage", TestChipCert_CertUsage),
+    NL_TEST_DEF("Test CHIP Certificate Validation Cache", TestChipCert_ValidationCache),
     NL_TEST_DEF("Test CHIP Certificate Type", TestChipCert_CertType),
     NL_TEST_DEF("Test CHIP Certificate ID", TestChipCert_CertId),
     NL_TEST_DEF("Test Loading Duplicate Certificates", TestChipCert_LoadDuplicateCerts),
+    NL_TEST_DEF("Test Loading Parsed Certificate Data", TestChipCert_LoadParsedCert),
     NL_TEST_DEF("Test CHIP Generate Root Certificate", TestChipCert_GenerateRootCert),
     NL_TEST_DEF("Test CHIP Generate Root Certificate with Fabric", TestChipCert_GenerateRootFabCert),
     NL_TEST_DEF("Test CHIP Generate ICA Certificate", TestChipCert_GenerateICACert),
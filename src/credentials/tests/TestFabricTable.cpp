@@ -73,6 +73,37 @@ void TestGetCompressedFabricID(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, compressedId.GetNodeId() == 0xdeed);
 }
 
+void TestDestinationIDSuffix(nlTestSuite * inSuite, void * inContext)
+{
+    FabricInfo fabricInfo;
+
+    NL_TEST_ASSERT(inSuite, fabricInfo.SetRootCert(ByteSpan(sTestRootCert)) == CHIP_NO_ERROR);
+
+    uint8_t suffix[FabricInfo::kDestinationIDSuffixMaxLength];
+    MutableByteSpan suffixSpan(suffix);
+    NL_TEST_ASSERT(inSuite, fabricInfo.GetDestinationIDSuffix(suffixSpan) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, suffixSpan.size() == FabricInfo::kDestinationIDSuffixMaxLength);
+
+    // Sigma1 candidate matching hashes initiatorRandom || suffix, so the suffix must
+    // lead with the root public key to stay in step with GenerateDestinationID().
+    Credentials::P256PublicKeySpan rootPubkey = fabricInfo.GetRootPubkey();
+    NL_TEST_ASSERT(inSuite, memcmp(suffixSpan.data(), rootPubkey.data(), rootPubkey.size()) == 0);
+
+    // A buffer that cannot hold the full message must be rejected.
+    MutableByteSpan shortSpan(suffix, rootPubkey.size());
+    NL_TEST_ASSERT(inSuite, fabricInfo.GetDestinationIDSuffix(shortSpan) == CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
+void TestFindFabricWithCompressedId(nlTestSuite * inSuite, void * inContext)
+{
+    FabricTable fabricTable;
+
+    // The lookup must work purely from the in-memory fabric state: no storage has been
+    // configured for this table, and an empty table matches nothing.
+    NL_TEST_ASSERT(inSuite, fabricTable.FindFabricWithCompressedId(0x090F17C67be7b663) == nullptr);
+    NL_TEST_ASSERT(inSuite, fabricTable.FindFabricWithCompressedId(0) == nullptr);
+}
+
 // Test Suite
 
 /**
@@ -82,6 +113,8 @@ void TestGetCompressedFabricID(nlTestSuite * inSuite, void * inContext)
 static const nlTest sTests[] =
 {
     NL_TEST_DEF("Compressed Fabric ID",    TestGetCompressedFabricID),
+    NL_TEST_DEF("Destination ID suffix",    TestDestinationIDSuffix),
+    NL_TEST_DEF("Find fabric with compressed ID",    TestFindFabricWithCompressedId),
     NL_TEST_SENTINEL()
 };
 // clang-format on
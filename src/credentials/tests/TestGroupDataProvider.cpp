@@ -682,6 +682,22 @@ void TestKeySets(nlTestSuite * apSuite, void * apContext)
     NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetKeySet(kFabric2, kKeySet2));
     NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetKeySet(kFabric2, kKeySet1));
 
+    // Session ID filter: the test epoch keys are all zero-filled, so every
+    // keyset derives the same group session ID.
+    uint16_t session_id = 0;
+    {
+        static const uint8_t kGroupKeyHashInfo[] = { 'G', 'r', 'o', 'u', 'p', 'K', 'e', 'y', 'H', 'a', 's', 'h' };
+        uint8_t hash[sizeof(uint16_t)];
+        chip::Crypto::HKDF_sha crypto;
+        NL_TEST_ASSERT(apSuite,
+                       CHIP_NO_ERROR ==
+                           crypto.HKDF_SHA256(kKeySet0.epoch_keys[0].key, EpochKey::kLengthBytes, nullptr, 0, kGroupKeyHashInfo,
+                                              sizeof(kGroupKeyHashInfo), hash, sizeof(hash)));
+        session_id = static_cast<uint16_t>((hash[0] << 8) + hash[1]);
+    }
+    NL_TEST_ASSERT(apSuite, provider->IsGroupSessionId(session_id));
+    NL_TEST_ASSERT(apSuite, !provider->IsGroupSessionId(static_cast<uint16_t>(session_id + 1)));
+
     // Get KeySets
 
     NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->GetKeySet(kFabric1, kKeysetId3, keyset));
@@ -744,6 +760,9 @@ void TestKeySets(nlTestSuite * apSuite, void * apContext)
     NL_TEST_ASSERT(apSuite, CHIP_ERROR_NOT_FOUND == provider->GetKeySet(kFabric2, kKeysetId2, keyset));
     NL_TEST_ASSERT(apSuite, CHIP_ERROR_NOT_FOUND == provider->GetKeySet(kFabric2, kKeysetId1, keyset));
     NL_TEST_ASSERT(apSuite, CHIP_ERROR_NOT_FOUND == provider->GetKeySet(kFabric2, kKeysetId0, keyset));
+
+    // With every keyset removed, the session ID must no longer match
+    NL_TEST_ASSERT(apSuite, !provider->IsGroupSessionId(session_id));
 }
 
 void TestKeySetIterator(nlTestSuite * apSuite, void * apContext)
@@ -657,5 +657,63 @@ CHIP_ERROR GenerateCompressedFabricId(const Crypto::P256PublicKey & root_public_
     return status;
 }
 
+CHIP_ERROR ECDSA_validate_signatures_batch(ECDSABatchVerifyEntry * entries, size_t num_entries)
+{
+    VerifyOrReturnError(entries != nullptr || num_entries == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    CHIP_ERROR overall_result = CHIP_NO_ERROR;
+    for (size_t i = 0; i < num_entries; ++i)
+    {
+        ECDSABatchVerifyEntry & entry = entries[i];
+        VerifyOrReturnError(entry.public_key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(entry.signature != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+        entry.result = entry.public_key->ECDSA_validate_msg_signature(entry.msg.data(), entry.msg.size(), *entry.signature);
+        if (entry.result != CHIP_NO_ERROR && overall_result == CHIP_NO_ERROR)
+        {
+            overall_result = entry.result;
+        }
+    }
+
+    return overall_result;
+}
+
+CHIP_ERROR ECDSA_validate_signatures_batch_async(ECDSABatchVerifyEntry * entries, size_t num_entries,
+                                                 ECDSABatchVerifyCallback callback, void * context)
+{
+    VerifyOrReturnError(callback != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    callback(context, ECDSA_validate_signatures_batch(entries, num_entries));
+    return CHIP_NO_ERROR;
+}
+
+namespace {
+const CryptoPrimitiveOverrides * gCryptoPrimitiveOverrides = nullptr;
+} // namespace
+
+CHIP_ERROR SetCryptoPrimitiveOverrides(const CryptoPrimitiveOverrides * overrides)
+{
+    if (overrides != nullptr)
+    {
+        // The AES-CCM context entries manage backend-opaque state inside
+        // AesCcmContext and must be overridden as a unit.
+        const bool anyContextEntry = (overrides->aes_ccm_context_init != nullptr) ||
+            (overrides->aes_ccm_context_release != nullptr) || (overrides->aes_ccm_context_encrypt != nullptr) ||
+            (overrides->aes_ccm_context_decrypt != nullptr);
+        const bool allContextEntries = (overrides->aes_ccm_context_init != nullptr) &&
+            (overrides->aes_ccm_context_release != nullptr) && (overrides->aes_ccm_context_encrypt != nullptr) &&
+            (overrides->aes_ccm_context_decrypt != nullptr);
+        VerifyOrReturnError(!anyContextEntry || allContextEntries, CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    gCryptoPrimitiveOverrides = overrides;
+    return CHIP_NO_ERROR;
+}
+
+const CryptoPrimitiveOverrides * GetCryptoPrimitiveOverrides()
+{
+    return gCryptoPrimitiveOverrides;
+}
+
 } // namespace Crypto
 } // namespace chip
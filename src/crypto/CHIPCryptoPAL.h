@@ -86,6 +86,7 @@ constexpr size_t kAES_CCM256_Block_Length = kAES_CCM256_Key_Length;
  */
 constexpr size_t kMAX_Spake2p_Context_Size     = 1024;
 constexpr size_t kMAX_P256Keypair_Context_Size = 512;
+constexpr size_t kMAX_AesCcm_Context_Size      = 256;
 
 constexpr size_t kEmitDerIntegerWithoutTagOverhead = 1; // 1 sign stuffer
 constexpr size_t kEmitDerIntegerOverhead           = 3; // Tag + Length byte + 1 sign stuffer
@@ -278,6 +279,44 @@ private:
     uint8_t bytes[kP256_PublicKey_Length];
 };
 
+/**
+ * @brief A single signature verification within a batch.
+ */
+struct ECDSABatchVerifyEntry
+{
+    const P256PublicKey * public_key = nullptr;     ///< Key to verify against
+    ByteSpan msg;                                   ///< Message over which the signature was computed
+    const P256ECDSASignature * signature = nullptr; ///< Signature in raw <r,s> point form (see SEC1)
+    CHIP_ERROR result = CHIP_ERROR_INTERNAL;        ///< Per-entry verification result (output)
+};
+
+/**
+ * @brief Verify a batch of ECDSA signatures.
+ *
+ * Every entry is verified, even if an earlier one fails, and the per-entry outcome is
+ * recorded in that entry's `result` field.  The default implementation verifies entries
+ * sequentially; backends may substitute a batched or parallel implementation when the
+ * underlying library supports it.
+ *
+ * @return CHIP_NO_ERROR if every signature verified, otherwise the result of the first
+ *         entry that failed.
+ */
+CHIP_ERROR ECDSA_validate_signatures_batch(ECDSABatchVerifyEntry * entries, size_t num_entries);
+
+/** @brief Completion callback for ECDSA_validate_signatures_batch_async. */
+typedef void (*ECDSABatchVerifyCallback)(void * context, CHIP_ERROR overall_result);
+
+/**
+ * @brief Asynchronous form of ECDSA_validate_signatures_batch.
+ *
+ * The callback is invoked with the overall result once all entries have been verified.
+ * The default implementation completes synchronously before returning, but callers must
+ * not rely on that: backends with crypto offload may invoke the callback out of line.
+ * The entries must remain valid until the callback runs.
+ */
+CHIP_ERROR ECDSA_validate_signatures_batch_async(ECDSABatchVerifyEntry * entries, size_t num_entries,
+                                                 ECDSABatchVerifyCallback callback, void * context);
+
 template <typename PK, typename Secret, typename Sig>
 class ECPKeypair
 {
@@ -543,6 +582,148 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                            const uint8_t * tag, size_t tag_length, const uint8_t * key, size_t key_length, const uint8_t * iv,
                            size_t iv_length, uint8_t * plaintext);
 
+/**
+ * Opaque backend-defined storage for a reusable AES-CCM cipher context.
+ * Initialize with AES_CCM_context_init() and release with AES_CCM_context_release().
+ */
+struct alignas(size_t) AesCcmContext
+{
+    uint8_t mBytes[kMAX_AesCcm_Context_Size];
+};
+
+/**
+ * @brief Prepare a reusable AES-CCM cipher context for a key
+ *
+ * The returned context carries whatever per-key state the backend can compute
+ * once and reuse across messages (e.g. an expanded key schedule, or a binding
+ * to a hardware crypto engine), so that the per-message AES_CCM_encrypt() and
+ * AES_CCM_decrypt() overloads below avoid re-scheduling the key. The caller
+ * owns the context and must release it with AES_CCM_context_release() once
+ * done; the key buffer does not need to outlive this call.
+ *
+ * @param key Encryption key
+ * @param key_length Length of encryption key (in bytes)
+ * @param context Context storage to initialize
+ * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+ * */
+CHIP_ERROR AES_CCM_context_init(const uint8_t * key, size_t key_length, AesCcmContext & context);
+
+/**
+ * @brief Release a cipher context initialized with AES_CCM_context_init()
+ *
+ * Clears any key material held by the context. Releasing a context that was
+ * never successfully initialized is a no-op.
+ *
+ * @param context Context to release
+ * */
+void AES_CCM_context_release(AesCcmContext & context);
+
+/**
+ * @brief AES-CCM encryption using a prepared cipher context
+ *
+ * Identical to the raw-key AES_CCM_encrypt() except that the key is taken from
+ * a context prepared with AES_CCM_context_init().
+ *
+ * @param context Cipher context holding the encryption key
+ * @param plaintext Plaintext to encrypt
+ * @param plaintext_length Length of plain_text
+ * @param aad Additional authentication data
+ * @param aad_length Length of additional authentication data
+ * @param iv Initial vector
+ * @param iv_length Length of initial vector
+ * @param ciphertext Buffer to write ciphertext into. Caller must ensure this is large enough to hold the ciphertext
+ * @param tag Buffer to write tag into. Caller must ensure this is large enough to hold the tag
+ * @param tag_length Expected length of tag
+ * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+ * */
+CHIP_ERROR AES_CCM_encrypt(AesCcmContext & context, const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad,
+                           size_t aad_length, const uint8_t * iv, size_t iv_length, uint8_t * ciphertext, uint8_t * tag,
+                           size_t tag_length);
+
+/**
+ * @brief AES-CCM decryption using a prepared cipher context
+ *
+ * Identical to the raw-key AES_CCM_decrypt() except that the key is taken from
+ * a context prepared with AES_CCM_context_init().
+ *
+ * @param context Cipher context holding the decryption key
+ * @param ciphertext Ciphertext to decrypt
+ * @param ciphertext_length Length of ciphertext
+ * @param aad Additional authentical data.
+ * @param aad_length Length of additional authentication data
+ * @param tag Tag to use to decrypt
+ * @param tag_length Length of tag
+ * @param iv Initial vector
+ * @param iv_length Length of initial vector
+ * @param plaintext Buffer to write plaintext into
+ * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+ **/
+CHIP_ERROR AES_CCM_decrypt(AesCcmContext & context, const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad,
+                           size_t aad_length, const uint8_t * tag, size_t tag_length, const uint8_t * iv, size_t iv_length,
+                           uint8_t * plaintext);
+
+/**
+ * @brief Per-primitive override table for the crypto PAL
+ *
+ * The build still selects exactly one backend (see crypto.gni), but individual
+ * primitives can be rerouted at runtime to an alternate implementation -- for
+ * example a hardware AES/SHA engine on a platform whose ECC engine is slower
+ * than the software implementation. Any entry left null falls through to the
+ * build-time backend, so an override table only needs to populate the
+ * primitives it accelerates.
+ *
+ * The aes_ccm_context_* entries manage backend-opaque state inside
+ * AesCcmContext and therefore must be overridden as a unit: either all four
+ * are set, or none of them. SetCryptoPrimitiveOverrides() rejects tables that
+ * violate this.
+ *
+ * The p256_ecdsa_validate_hash_signature entry receives the uncompressed
+ * public key bytes and a raw (r || s) signature.
+ */
+struct CryptoPrimitiveOverrides
+{
+    CHIP_ERROR (*aes_ccm_encrypt)(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                  const uint8_t * key, size_t key_length, const uint8_t * iv, size_t iv_length,
+                                  uint8_t * ciphertext, uint8_t * tag, size_t tag_length) = nullptr;
+    CHIP_ERROR (*aes_ccm_decrypt)(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                  const uint8_t * tag, size_t tag_length, const uint8_t * key, size_t key_length,
+                                  const uint8_t * iv, size_t iv_length, uint8_t * plaintext) = nullptr;
+    CHIP_ERROR (*aes_ccm_context_init)(const uint8_t * key, size_t key_length, AesCcmContext & context) = nullptr;
+    void (*aes_ccm_context_release)(AesCcmContext & context)                                            = nullptr;
+    CHIP_ERROR (*aes_ccm_context_encrypt)(AesCcmContext & context, const uint8_t * plaintext, size_t plaintext_length,
+                                          const uint8_t * aad, size_t aad_length, const uint8_t * iv, size_t iv_length,
+                                          uint8_t * ciphertext, uint8_t * tag, size_t tag_length) = nullptr;
+    CHIP_ERROR (*aes_ccm_context_decrypt)(AesCcmContext & context, const uint8_t * ciphertext, size_t ciphertext_length,
+                                          const uint8_t * aad, size_t aad_length, const uint8_t * tag, size_t tag_length,
+                                          const uint8_t * iv, size_t iv_length, uint8_t * plaintext) = nullptr;
+    CHIP_ERROR (*hash_sha256)(const uint8_t * data, size_t data_length, uint8_t * out_buffer)        = nullptr;
+    CHIP_ERROR (*hkdf_sha256)(const uint8_t * secret, size_t secret_length, const uint8_t * salt, size_t salt_length,
+                              const uint8_t * info, size_t info_length, uint8_t * out_buffer, size_t out_length) = nullptr;
+    CHIP_ERROR (*p256_ecdsa_validate_hash_signature)(const uint8_t * public_key, size_t public_key_length, const uint8_t * hash,
+                                                     size_t hash_length, const uint8_t * signature,
+                                                     size_t signature_length) = nullptr;
+};
+
+/**
+ * @brief Install a per-primitive override table
+ *
+ * The table must outlive all crypto operations performed while it is
+ * installed; passing nullptr restores the build-time backend for everything.
+ * Must be called before any traffic uses the overridden primitives (typically
+ * right after platform init); installation is not synchronized against
+ * in-flight operations.
+ *
+ * @param overrides Table to install, or nullptr to remove the current table
+ * @return CHIP_ERROR_INVALID_ARGUMENT if the aes_ccm_context_* entries are
+ *         only partially populated, CHIP_NO_ERROR otherwise
+ */
+CHIP_ERROR SetCryptoPrimitiveOverrides(const CryptoPrimitiveOverrides * overrides);
+
+/**
+ * @brief Fetch the currently installed override table, or nullptr if none
+ */
+const CryptoPrimitiveOverrides * GetCryptoPrimitiveOverrides();
+
 /**
  * @brief Verify the Certificate Signing Request (CSR). If successfully verified, it outputs the public key from the CSR.
  * @param csr CSR in DER format
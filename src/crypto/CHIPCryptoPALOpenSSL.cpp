@@ -126,6 +126,13 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
                            const uint8_t * key, size_t key_length, const uint8_t * iv, size_t iv_length, uint8_t * ciphertext,
                            uint8_t * tag, size_t tag_length)
 {
+    const CryptoPrimitiveOverrides * overrides = GetCryptoPrimitiveOverrides();
+    if ((overrides != nullptr) && (overrides->aes_ccm_encrypt != nullptr))
+    {
+        return overrides->aes_ccm_encrypt(plaintext, plaintext_length, aad, aad_length, key, key_length, iv, iv_length, ciphertext,
+                                          tag, tag_length);
+    }
+
     EVP_CIPHER_CTX * context = nullptr;
     int bytesWritten         = 0;
     size_t ciphertext_length = 0;
@@ -238,6 +245,13 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                            const uint8_t * tag, size_t tag_length, const uint8_t * key, size_t key_length, const uint8_t * iv,
                            size_t iv_length, uint8_t * plaintext)
 {
+    const CryptoPrimitiveOverrides * overrides = GetCryptoPrimitiveOverrides();
+    if ((overrides != nullptr) && (overrides->aes_ccm_decrypt != nullptr))
+    {
+        return overrides->aes_ccm_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, key, key_length, iv,
+                                          iv_length, plaintext);
+    }
+
     EVP_CIPHER_CTX * context = nullptr;
     CHIP_ERROR error         = CHIP_NO_ERROR;
     int bytesOutput          = 0;
@@ -342,8 +356,98 @@ exit:
     return error;
 }
 
+namespace {
+
+// The OpenSSL EVP interface for CCM sets up its cipher state per message, so
+// the reusable context here only retains a validated copy of the key; the
+// per-message cost is unchanged relative to the raw-key primitives.
+struct AesCcmContextOpenSSL
+{
+    uint8_t mKey[kAES_CCM256_Key_Length];
+    size_t mKeyLength;
+};
+
+inline AesCcmContextOpenSSL * to_ccm_context(AesCcmContext * context)
+{
+    return SafePointerCast<AesCcmContextOpenSSL *>(context);
+}
+
+} // namespace
+
+CHIP_ERROR AES_CCM_context_init(const uint8_t * key, size_t key_length, AesCcmContext & context)
+{
+    const CryptoPrimitiveOverrides * overrides = GetCryptoPrimitiveOverrides();
+    if ((overrides != nullptr) && (overrides->aes_ccm_context_init != nullptr))
+    {
+        return overrides->aes_ccm_context_init(key, key_length, context);
+    }
+
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidKeyLength(key_length), CHIP_ERROR_UNSUPPORTED_ENCRYPTION_TYPE);
+
+    AesCcmContextOpenSSL * ccm_context = to_ccm_context(&context);
+    memcpy(ccm_context->mKey, key, key_length);
+    ccm_context->mKeyLength = key_length;
+
+    return CHIP_NO_ERROR;
+}
+
+void AES_CCM_context_release(AesCcmContext & context)
+{
+    const CryptoPrimitiveOverrides * overrides = GetCryptoPrimitiveOverrides();
+    if ((overrides != nullptr) && (overrides->aes_ccm_context_release != nullptr))
+    {
+        overrides->aes_ccm_context_release(context);
+        return;
+    }
+
+    AesCcmContextOpenSSL * ccm_context = to_ccm_context(&context);
+    ClearSecretData(ccm_context->mKey, sizeof(ccm_context->mKey));
+    ccm_context->mKeyLength = 0;
+}
+
+CHIP_ERROR AES_CCM_encrypt(AesCcmContext & context, const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad,
+                           size_t aad_length, const uint8_t * iv, size_t iv_length, uint8_t * ciphertext, uint8_t * tag,
+                           size_t tag_length)
+{
+    const CryptoPrimitiveOverrides * overrides = GetCryptoPrimitiveOverrides();
+    if ((overrides != nullptr) && (overrides->aes_ccm_context_encrypt != nullptr))
+    {
+        return overrides->aes_ccm_context_encrypt(context, plaintext, plaintext_length, aad, aad_length, iv, iv_length, ciphertext,
+                                                  tag, tag_length);
+    }
+
+    AesCcmContextOpenSSL * ccm_context = to_ccm_context(&context);
+    VerifyOrReturnError(ccm_context->mKeyLength != 0, CHIP_ERROR_INCORRECT_STATE);
+    return AES_CCM_encrypt(plaintext, plaintext_length, aad, aad_length, ccm_context->mKey, ccm_context->mKeyLength, iv, iv_length,
+                           ciphertext, tag, tag_length);
+}
+
+CHIP_ERROR AES_CCM_decrypt(AesCcmContext & context, const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad,
+                           size_t aad_length, const uint8_t * tag, size_t tag_length, const uint8_t * iv, size_t iv_length,
+                           uint8_t * plaintext)
+{
+    const CryptoPrimitiveOverrides * overrides = GetCryptoPrimitiveOverrides();
+    if ((overrides != nullptr) && (overrides->aes_ccm_context_decrypt != nullptr))
+    {
+        return overrides->aes_ccm_context_decrypt(context, ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, iv,
+                                                  iv_length, plaintext);
+    }
+
+    AesCcmContextOpenSSL * ccm_context = to_ccm_context(&context);
+    VerifyOrReturnError(ccm_context->mKeyLength != 0, CHIP_ERROR_INCORRECT_STATE);
+    return AES_CCM_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, ccm_context->mKey,
+                           ccm_context->mKeyLength, iv, iv_length, plaintext);
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
+    const CryptoPrimitiveOverrides * overrides = GetCryptoPrimitiveOverrides();
+    if ((overrides != nullptr) && (overrides->hash_sha256 != nullptr))
+    {
+        return overrides->hash_sha256(data, data_length, out_buffer);
+    }
+
     // zero data length hash is supported.
     VerifyOrReturnError(data != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(out_buffer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
@@ -435,6 +539,12 @@ void Hash_SHA256_stream::Clear()
 CHIP_ERROR HKDF_sha::HKDF_SHA256(const uint8_t * secret, const size_t secret_length, const uint8_t * salt, const size_t salt_length,
                                  const uint8_t * info, const size_t info_length, uint8_t * out_buffer, size_t out_length)
 {
+    const CryptoPrimitiveOverrides * overrides = GetCryptoPrimitiveOverrides();
+    if ((overrides != nullptr) && (overrides->hkdf_sha256 != nullptr))
+    {
+        return overrides->hkdf_sha256(secret, secret_length, salt, salt_length, info, info_length, out_buffer, out_length);
+    }
+
     CHIP_ERROR error = CHIP_NO_ERROR;
     int result       = 1;
 
@@ -678,6 +788,13 @@ CHIP_ERROR P256PublicKey::ECDSA_validate_msg_signature(const uint8_t * msg, cons
 CHIP_ERROR P256PublicKey::ECDSA_validate_hash_signature(const uint8_t * hash, const size_t hash_length,
                                                         const P256ECDSASignature & signature) const
 {
+    const CryptoPrimitiveOverrides * overrides = GetCryptoPrimitiveOverrides();
+    if ((overrides != nullptr) && (overrides->p256_ecdsa_validate_hash_signature != nullptr))
+    {
+        return overrides->p256_ecdsa_validate_hash_signature(ConstBytes(), Length(), hash, hash_length, signature.ConstBytes(),
+                                                             signature.Length());
+    }
+
     ERR_clear_error();
     CHIP_ERROR error     = CHIP_ERROR_INTERNAL;
     int nid              = NID_undef;
@@ -107,6 +107,13 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
                            const uint8_t * key, size_t key_length, const uint8_t * iv, size_t iv_length, uint8_t * ciphertext,
                            uint8_t * tag, size_t tag_length)
 {
+    const CryptoPrimitiveOverrides * overrides = GetCryptoPrimitiveOverrides();
+    if ((overrides != nullptr) && (overrides->aes_ccm_encrypt != nullptr))
+    {
+        return overrides->aes_ccm_encrypt(plaintext, plaintext_length, aad, aad_length, key, key_length, iv, iv_length, ciphertext,
+                                          tag, tag_length);
+    }
+
     CHIP_ERROR error = CHIP_NO_ERROR;
     int result       = 1;
 
@@ -148,6 +155,13 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_len, co
                            const uint8_t * tag, size_t tag_length, const uint8_t * key, size_t key_length, const uint8_t * iv,
                            size_t iv_length, uint8_t * plaintext)
 {
+    const CryptoPrimitiveOverrides * overrides = GetCryptoPrimitiveOverrides();
+    if ((overrides != nullptr) && (overrides->aes_ccm_decrypt != nullptr))
+    {
+        return overrides->aes_ccm_decrypt(ciphertext, ciphertext_len, aad, aad_len, tag, tag_length, key, key_length, iv,
+                                          iv_length, plaintext);
+    }
+
     CHIP_ERROR error = CHIP_NO_ERROR;
     int result       = 1;
 
@@ -185,8 +199,124 @@ exit:
     return error;
 }
 
+static inline mbedtls_ccm_context * to_ccm_context(AesCcmContext * context)
+{
+    return SafePointerCast<mbedtls_ccm_context *>(context);
+}
+
+CHIP_ERROR AES_CCM_context_init(const uint8_t * key, size_t key_length, AesCcmContext & context)
+{
+    const CryptoPrimitiveOverrides * overrides = GetCryptoPrimitiveOverrides();
+    if ((overrides != nullptr) && (overrides->aes_ccm_context_init != nullptr))
+    {
+        return overrides->aes_ccm_context_init(key, key_length, context);
+    }
+
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidKeyLength(key_length), CHIP_ERROR_UNSUPPORTED_ENCRYPTION_TYPE);
+
+    mbedtls_ccm_context * ccm_context = to_ccm_context(&context);
+    mbedtls_ccm_init(ccm_context);
+
+    // The key schedule is expanded once here (or the key is bound to a
+    // hardware engine with an alternative CCM implementation) and reused for
+    // every message encrypted or decrypted with this context.
+    // Size of key = key_length * number of bits in a byte (8)
+    // Cast is safe because we called _isValidKeyLength above.
+    const int result =
+        mbedtls_ccm_setkey(ccm_context, MBEDTLS_CIPHER_ID_AES, Uint8::to_const_uchar(key), static_cast<unsigned int>(key_length * 8));
+    _log_mbedTLS_error(result);
+    if (result != 0)
+    {
+        mbedtls_ccm_free(ccm_context);
+        return CHIP_ERROR_INTERNAL;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void AES_CCM_context_release(AesCcmContext & context)
+{
+    const CryptoPrimitiveOverrides * overrides = GetCryptoPrimitiveOverrides();
+    if ((overrides != nullptr) && (overrides->aes_ccm_context_release != nullptr))
+    {
+        overrides->aes_ccm_context_release(context);
+        return;
+    }
+
+    mbedtls_ccm_free(to_ccm_context(&context));
+}
+
+CHIP_ERROR AES_CCM_encrypt(AesCcmContext & context, const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad,
+                           size_t aad_length, const uint8_t * iv, size_t iv_length, uint8_t * ciphertext, uint8_t * tag,
+                           size_t tag_length)
+{
+    const CryptoPrimitiveOverrides * overrides = GetCryptoPrimitiveOverrides();
+    if ((overrides != nullptr) && (overrides->aes_ccm_context_encrypt != nullptr))
+    {
+        return overrides->aes_ccm_context_encrypt(context, plaintext, plaintext_length, aad, aad_length, iv, iv_length, ciphertext,
+                                                  tag, tag_length);
+    }
+
+    VerifyOrReturnError(plaintext != nullptr || plaintext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr || plaintext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+    if (aad_length > 0)
+    {
+        VerifyOrReturnError(aad != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    const int result = mbedtls_ccm_encrypt_and_tag(to_ccm_context(&context), plaintext_length, Uint8::to_const_uchar(iv), iv_length,
+                                                   Uint8::to_const_uchar(aad), aad_length, Uint8::to_const_uchar(plaintext),
+                                                   Uint8::to_uchar(ciphertext), Uint8::to_uchar(tag), tag_length);
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM_decrypt(AesCcmContext & context, const uint8_t * ciphertext, size_t ciphertext_len, const uint8_t * aad,
+                           size_t aad_len, const uint8_t * tag, size_t tag_length, const uint8_t * iv, size_t iv_length,
+                           uint8_t * plaintext)
+{
+    const CryptoPrimitiveOverrides * overrides = GetCryptoPrimitiveOverrides();
+    if ((overrides != nullptr) && (overrides->aes_ccm_context_decrypt != nullptr))
+    {
+        return overrides->aes_ccm_context_decrypt(context, ciphertext, ciphertext_len, aad, aad_len, tag, tag_length, iv,
+                                                  iv_length, plaintext);
+    }
+
+    VerifyOrReturnError(plaintext != nullptr || ciphertext_len == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr || ciphertext_len == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    if (aad_len > 0)
+    {
+        VerifyOrReturnError(aad != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    const int result = mbedtls_ccm_auth_decrypt(to_ccm_context(&context), ciphertext_len, Uint8::to_const_uchar(iv), iv_length,
+                                                Uint8::to_const_uchar(aad), aad_len, Uint8::to_const_uchar(ciphertext),
+                                                Uint8::to_uchar(plaintext), Uint8::to_const_uchar(tag), tag_length);
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
+    const CryptoPrimitiveOverrides * overrides = GetCryptoPrimitiveOverrides();
+    if ((overrides != nullptr) && (overrides->hash_sha256 != nullptr))
+    {
+        return overrides->hash_sha256(data, data_length, out_buffer);
+    }
+
     // zero data length hash is supported.
     VerifyOrReturnError(data != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(out_buffer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
@@ -286,6 +416,12 @@ void Hash_SHA256_stream::Clear(void)
 CHIP_ERROR HKDF_sha::HKDF_SHA256(const uint8_t * secret, const size_t secret_length, const uint8_t * salt, const size_t salt_length,
                                  const uint8_t * info, const size_t info_length, uint8_t * out_buffer, size_t out_length)
 {
+    const CryptoPrimitiveOverrides * overrides = GetCryptoPrimitiveOverrides();
+    if ((overrides != nullptr) && (overrides->hkdf_sha256 != nullptr))
+    {
+        return overrides->hkdf_sha256(secret, secret_length, salt, salt_length, info, info_length, out_buffer, out_length);
+    }
+
     VerifyOrReturnError(secret != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(secret_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
 
@@ -549,6 +685,13 @@ CHIP_ERROR P256PublicKey::ECDSA_validate_hash_signature(const uint8_t * hash, co
                                                         const P256ECDSASignature & signature) const
 {
 #if defined(MBEDTLS_ECDSA_C)
+    const CryptoPrimitiveOverrides * overrides = GetCryptoPrimitiveOverrides();
+    if ((overrides != nullptr) && (overrides->p256_ecdsa_validate_hash_signature != nullptr))
+    {
+        return overrides->p256_ecdsa_validate_hash_signature(ConstBytes(), Length(), hash, hash_length, signature.ConstBytes(),
+                                                             signature.Length());
+    }
+
     VerifyOrReturnError(hash != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(hash_length == kSHA256_Hash_Length, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(signature.Length() == kP256_ECDSA_Signature_Length_Raw, CHIP_ERROR_INVALID_ARGUMENT);
@@ -467,6 +467,53 @@ static void TestAES_CCM_128DecryptTestVectors(nlTestSuite * inSuite, void * inCo
     NL_TEST_ASSERT(inSuite, numOfTestsRan > 0);
 }
 
+static void TestAES_CCM_128ContextTestVectors(nlTestSuite * inSuite, void * inContext)
+{
+    HeapChecker heapChecker(inSuite);
+    int numOfTestVectors = ArraySize(ccm_128_test_vectors);
+    int numOfTestsRan    = 0;
+    for (int vectorIndex = 0; vectorIndex < numOfTestVectors; vectorIndex++)
+    {
+        const ccm_128_test_vector * vector = ccm_128_test_vectors[vectorIndex];
+        if (vector->pt_len > 0 && vector->result == CHIP_NO_ERROR)
+        {
+            numOfTestsRan++;
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_ct;
+            out_ct.Alloc(vector->ct_len);
+            NL_TEST_ASSERT(inSuite, out_ct);
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_tag;
+            out_tag.Alloc(vector->tag_len);
+            NL_TEST_ASSERT(inSuite, out_tag);
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_pt;
+            out_pt.Alloc(vector->pt_len);
+            NL_TEST_ASSERT(inSuite, out_pt);
+
+            AesCcmContext context;
+            CHIP_ERROR err = AES_CCM_context_init(vector->key, vector->key_len, context);
+            NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+            // The same context must be reusable across messages: encrypt and
+            // decrypt the vector twice and match the raw-key results each time.
+            for (int pass = 0; pass < 2; pass++)
+            {
+                err = AES_CCM_encrypt(context, vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->iv, vector->iv_len,
+                                      out_ct.Get(), out_tag.Get(), vector->tag_len);
+                NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+                NL_TEST_ASSERT(inSuite, memcmp(out_ct.Get(), vector->ct, vector->ct_len) == 0);
+                NL_TEST_ASSERT(inSuite, memcmp(out_tag.Get(), vector->tag, vector->tag_len) == 0);
+
+                err = AES_CCM_decrypt(context, vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag,
+                                      vector->tag_len, vector->iv, vector->iv_len, out_pt.Get());
+                NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+                NL_TEST_ASSERT(inSuite, memcmp(out_pt.Get(), vector->pt, vector->pt_len) == 0);
+            }
+
+            AES_CCM_context_release(context);
+        }
+    }
+    NL_TEST_ASSERT(inSuite, numOfTestsRan > 0);
+}
+
 static void TestAES_CCM_128EncryptNilKey(nlTestSuite * inSuite, void * inContext)
 {
     HeapChecker heapChecker(inSuite);
@@ -950,6 +997,41 @@ static void TestECDSA_Signing_SHA256_Msg(nlTestSuite * inSuite, void * inContext
     NL_TEST_ASSERT(inSuite, validation_error == CHIP_NO_ERROR);
 }
 
+static void TestECDSA_ValidateSignaturesBatch(nlTestSuite * inSuite, void * inContext)
+{
+    HeapChecker heapChecker(inSuite);
+    const char * msg1 = "Hello World!";
+    const char * msg2 = "Hello Matter!";
+
+    Test_P256Keypair keypair1;
+    Test_P256Keypair keypair2;
+    NL_TEST_ASSERT(inSuite, keypair1.Initialize() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, keypair2.Initialize() == CHIP_NO_ERROR);
+
+    P256ECDSASignature signature1;
+    P256ECDSASignature signature2;
+    NL_TEST_ASSERT(inSuite, keypair1.ECDSA_sign_msg(reinterpret_cast<const uint8_t *>(msg1), strlen(msg1), signature1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, keypair2.ECDSA_sign_msg(reinterpret_cast<const uint8_t *>(msg2), strlen(msg2), signature2) == CHIP_NO_ERROR);
+
+    ECDSABatchVerifyEntry entries[2];
+    entries[0].public_key = &keypair1.Pubkey();
+    entries[0].msg        = ByteSpan(reinterpret_cast<const uint8_t *>(msg1), strlen(msg1));
+    entries[0].signature  = &signature1;
+    entries[1].public_key = &keypair2.Pubkey();
+    entries[1].msg        = ByteSpan(reinterpret_cast<const uint8_t *>(msg2), strlen(msg2));
+    entries[1].signature  = &signature2;
+
+    NL_TEST_ASSERT(inSuite, ECDSA_validate_signatures_batch(entries, 2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, entries[0].result == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, entries[1].result == CHIP_NO_ERROR);
+
+    // Swapping a signature must fail that entry, and every entry must still be verified.
+    entries[0].signature = &signature2;
+    NL_TEST_ASSERT(inSuite, ECDSA_validate_signatures_batch(entries, 2) != CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, entries[0].result != CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, entries[1].result == CHIP_NO_ERROR);
+}
+
 static void TestECDSA_Signing_SHA256_Hash(nlTestSuite * inSuite, void * inContext)
 {
     HeapChecker heapChecker(inSuite);
@@ -2116,6 +2198,64 @@ static void TestPID_x509Extraction(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+static uint32_t gs_override_sha256_called = 0;
+static CHIP_ERROR test_override_sha256(const uint8_t * data, size_t data_length, uint8_t * out_buffer)
+{
+    gs_override_sha256_called++;
+    memset(out_buffer, 0xAB, kSHA256_Hash_Length);
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR test_override_ccm_context_init(const uint8_t * key, size_t key_length, AesCcmContext & context)
+{
+    return CHIP_NO_ERROR;
+}
+
+static void TestCryptoPrimitiveOverrides(nlTestSuite * inSuite, void * inContext)
+{
+    HeapChecker heapChecker(inSuite);
+
+    uint8_t digest[kSHA256_Hash_Length];
+    const uint8_t message[] = { 1, 2, 3, 4 };
+
+    // A table that overrides only part of the AES-CCM context family must be rejected.
+    {
+        CryptoPrimitiveOverrides partial;
+        partial.aes_ccm_context_init = test_override_ccm_context_init;
+        NL_TEST_ASSERT(inSuite, SetCryptoPrimitiveOverrides(&partial) == CHIP_ERROR_INVALID_ARGUMENT);
+        NL_TEST_ASSERT(inSuite, GetCryptoPrimitiveOverrides() == nullptr);
+    }
+
+    CryptoPrimitiveOverrides overrides;
+    overrides.hash_sha256 = test_override_sha256;
+
+    NL_TEST_ASSERT(inSuite, SetCryptoPrimitiveOverrides(&overrides) == CHIP_NO_ERROR);
+
+    // The overridden primitive routes to the table.
+    gs_override_sha256_called = 0;
+    NL_TEST_ASSERT(inSuite, Hash_SHA256(message, sizeof(message), digest) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, gs_override_sha256_called == 1);
+    for (size_t i = 0; i < sizeof(digest); i++)
+    {
+        NL_TEST_ASSERT(inSuite, digest[i] == 0xAB);
+    }
+
+    // Primitives left null in the table fall through to the build-time backend.
+    {
+        uint8_t out_buffer[32];
+        TestHKDF_sha hkdf;
+        CHIP_ERROR err = hkdf.HKDF_SHA256(message, sizeof(message), nullptr, 0, nullptr, 0, out_buffer, sizeof(out_buffer));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+
+    // Removing the table restores the backend implementation.
+    NL_TEST_ASSERT(inSuite, SetCryptoPrimitiveOverrides(nullptr) == CHIP_NO_ERROR);
+
+    gs_override_sha256_called = 0;
+    NL_TEST_ASSERT(inSuite, Hash_SHA256(message, sizeof(message), digest) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, gs_override_sha256_called == 0);
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
@@ -2124,6 +2264,7 @@ static const nlTest sTests[] = {
 
     NL_TEST_DEF("Test encrypting AES-CCM-128 test vectors", TestAES_CCM_128EncryptTestVectors),
     NL_TEST_DEF("Test decrypting AES-CCM-128 test vectors", TestAES_CCM_128DecryptTestVectors),
+    NL_TEST_DEF("Test AES-CCM-128 reusable cipher context", TestAES_CCM_128ContextTestVectors),
     NL_TEST_DEF("Test encrypting AES-CCM-128 using nil key", TestAES_CCM_128EncryptNilKey),
     NL_TEST_DEF("Test encrypting AES-CCM-128 using invalid IV", TestAES_CCM_128EncryptInvalidIVLen),
     NL_TEST_DEF("Test encrypting AES-CCM-128 using invalid tag", TestAES_CCM_128EncryptInvalidTagLen),
@@ -2141,6 +2282,7 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test Integer to ASN.1 DER conversion", TestRawIntegerToDerValidCases),
     NL_TEST_DEF("Test Integer to ASN.1 DER conversion error cases", TestRawIntegerToDerInvalidCases),
     NL_TEST_DEF("Test ECDSA signing and validation message using SHA256", TestECDSA_Signing_SHA256_Msg),
+    NL_TEST_DEF("Test ECDSA batch signature validation", TestECDSA_ValidateSignaturesBatch),
     NL_TEST_DEF("Test ECDSA signing and validation SHA256 Hash", TestECDSA_Signing_SHA256_Hash),
     NL_TEST_DEF("Test ECDSA signature validation fail - Different msg", TestECDSA_ValidationFailsDifferentMessage),
     NL_TEST_DEF("Test ECDSA signature validation fail - Different hash", TestECDSA_ValidationFailsDifferentHash),
@@ -2154,6 +2296,7 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test Hash SHA 256 Stream", TestHash_SHA256_Stream),
     NL_TEST_DEF("Test HKDF SHA 256", TestHKDF_SHA256),
     NL_TEST_DEF("Test HMAC SHA 256", TestHMAC_SHA256),
+    NL_TEST_DEF("Test per-primitive crypto overrides", TestCryptoPrimitiveOverrides),
     NL_TEST_DEF("Test DRBG invalid inputs", TestDRBG_InvalidInputs),
     NL_TEST_DEF("Test DRBG output", TestDRBG_Output),
     NL_TEST_DEF("Test ECDH derive shared secret", TestECDH_EstablishSecret),
@@ -91,6 +91,20 @@
 #define CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE 100
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_BACKGROUND_WORK_POOL_SIZE
+ *
+ * The number of worker threads backing PlatformManager::ScheduleBackgroundWork().
+ *
+ * When zero (the default), no threads are created and background work is
+ * queued onto the event loop via PlatformManager::ScheduleWork(), preserving
+ * single-threaded behavior on constrained platforms. Non-zero values require
+ * a platform with std::thread support.
+ */
+#ifndef CHIP_DEVICE_CONFIG_BACKGROUND_WORK_POOL_SIZE
+#define CHIP_DEVICE_CONFIG_BACKGROUND_WORK_POOL_SIZE 0
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_ENABLE_FACTORY_PROVISIONING
  *
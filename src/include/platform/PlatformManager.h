@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <lib/support/ThreadSafetyAnnotations.h>
 #include <platform/CHIPDeviceBuildConfig.h>
 #include <platform/CHIPDeviceEvent.h>
 #include <platform/LabelList.h>
@@ -90,8 +91,14 @@ public:
 /**
  * Provides features for initializing and interacting with the chip network
  * stack on a chip-enabled device.
+ *
+ * PlatformManager doubles as the capability for the chip stack lock in
+ * clang's thread safety analysis: stack state may be declared
+ * CHIP_GUARDED_BY(::chip::DeviceLayer::PlatformMgr()) and entry points
+ * CHIP_REQUIRES(::chip::DeviceLayer::PlatformMgr()) to have -Wthread-safety
+ * flag access without the lock held.
  */
-class PlatformManager
+class CHIP_CAPABILITY("chip stack") PlatformManager
 {
     using ImplClass = ::chip::DeviceLayer::PlatformManagerImpl;
 
@@ -100,6 +107,17 @@ public:
 
     typedef void (*EventHandlerFunct)(const ChipDeviceEvent * event, intptr_t arg);
 
+    /**
+     * Priority classes for ScheduleBackgroundWork().  High priority work is
+     * dequeued ahead of normal priority work; within a class, work runs in
+     * submission order.
+     */
+    enum class BackgroundWorkPriority : uint8_t
+    {
+        kNormal = 0,
+        kHigh   = 1,
+    };
+
     /**
      * InitChipStack() initializes the PlatformManager.  After calling that, a
      * consumer is allowed to call either StartEventLoopTask or RunEventLoop to
@@ -125,6 +143,26 @@ public:
      */
     void ScheduleWork(AsyncWorkFunct workFunct, intptr_t arg = 0);
 
+    /**
+     * ScheduleBackgroundWork schedules CPU-bound work (certificate validation,
+     * SPAKE2+ math, large TLV processing and the like) on the stack's
+     * background worker pool instead of the event loop, so that such work does
+     * not stall event processing on multi-core hardware.
+     *
+     * The work function runs without the stack lock held: it must not touch
+     * stack state directly, and should deliver its result by posting a
+     * completion onto the event loop with ScheduleWork().
+     *
+     * When CHIP_DEVICE_CONFIG_BACKGROUND_WORK_POOL_SIZE is zero (the default)
+     * no worker threads exist and the work is queued onto the event loop via
+     * ScheduleWork() instead, preserving single-threaded behavior on
+     * constrained platforms.
+     *
+     * Can be called safely on any thread once InitChipStack has been called.
+     */
+    CHIP_ERROR ScheduleBackgroundWork(AsyncWorkFunct workFunct, intptr_t arg = 0,
+                                      BackgroundWorkPriority priority = BackgroundWorkPriority::kNormal);
+
     /**
      * Process work items until StopEventLoopTask is called.  RunEventLoop will
      * not return until work item processing is stopped.  Once it returns it
@@ -169,9 +207,17 @@ public:
      * returns.
      */
     CHIP_ERROR StopEventLoopTask();
-    void LockChipStack();
-    bool TryLockChipStack();
-    void UnlockChipStack();
+
+    /**
+     * The chip stack lock.  Application threads other than the chip event
+     * loop must hold it across any interaction with the stack; the event
+     * loop holds it implicitly while dispatching work.  It is the outermost
+     * lock in the system: acquire it before, and never while holding, any
+     * application-level lock.
+     */
+    void LockChipStack() CHIP_ACQUIRE();
+    bool TryLockChipStack() CHIP_TRY_ACQUIRE(true);
+    void UnlockChipStack() CHIP_RELEASE();
     CHIP_ERROR Shutdown();
 
 #if CHIP_STACK_LOCK_TRACKING_ENABLED
@@ -259,12 +305,12 @@ extern PlatformManagerImpl & PlatformMgrImpl();
  * RAII locking for PlatformManager to simplify management of
  * LockChipStack()/UnlockChipStack calls.
  */
-class StackLock
+class CHIP_SCOPED_CAPABILITY StackLock
 {
 public:
-    StackLock() { PlatformMgr().LockChipStack(); }
+    StackLock() CHIP_ACQUIRE(PlatformMgr()) { PlatformMgr().LockChipStack(); }
 
-    ~StackLock() { PlatformMgr().UnlockChipStack(); }
+    ~StackLock() CHIP_RELEASE() { PlatformMgr().UnlockChipStack(); }
 };
 
 /**
@@ -272,11 +318,11 @@ public:
  * RAII unlocking for PlatformManager to simplify management of
  * LockChipStack()/UnlockChipStack calls.
  */
-class StackUnlock
+class CHIP_SCOPED_CAPABILITY StackUnlock
 {
 public:
-    StackUnlock() { PlatformMgr().UnlockChipStack(); }
-    ~StackUnlock() { PlatformMgr().LockChipStack(); }
+    StackUnlock() CHIP_RELEASE(PlatformMgr()) { PlatformMgr().UnlockChipStack(); }
+    ~StackUnlock() CHIP_ACQUIRE() { PlatformMgr().LockChipStack(); }
 };
 
 } // namespace DeviceLayer
@@ -336,6 +382,11 @@ inline void PlatformManager::ScheduleWork(AsyncWorkFunct workFunct, intptr_t arg
     static_cast<ImplClass *>(this)->_ScheduleWork(workFunct, arg);
 }
 
+inline CHIP_ERROR PlatformManager::ScheduleBackgroundWork(AsyncWorkFunct workFunct, intptr_t arg, BackgroundWorkPriority priority)
+{
+    return static_cast<ImplClass *>(this)->_ScheduleBackgroundWork(workFunct, arg, priority);
+}
+
 inline void PlatformManager::RunEventLoop()
 {
     static_cast<ImplClass *>(this)->_RunEventLoop();
@@ -386,17 +437,19 @@ inline CHIP_ERROR PlatformManager::Shutdown()
     return err;
 }
 
-inline void PlatformManager::LockChipStack()
+// The lock itself lives in the platform implementation, which the analysis
+// cannot see into; these dispatch wrappers are trusted via their annotations.
+CHIP_NO_THREAD_SAFETY_ANALYSIS inline void PlatformManager::LockChipStack()
 {
     static_cast<ImplClass *>(this)->_LockChipStack();
 }
 
-inline bool PlatformManager::TryLockChipStack()
+CHIP_NO_THREAD_SAFETY_ANALYSIS inline bool PlatformManager::TryLockChipStack()
 {
     return static_cast<ImplClass *>(this)->_TryLockChipStack();
 }
 
-inline void PlatformManager::UnlockChipStack()
+CHIP_NO_THREAD_SAFETY_ANALYSIS inline void PlatformManager::UnlockChipStack()
 {
     static_cast<ImplClass *>(this)->_UnlockChipStack();
 }
@@ -122,6 +122,12 @@ CHIP_ERROR GenericPlatformManagerImpl<ImplClass>::_InitChipStack()
 
     // TODO Initialize the Software Update Manager object.
 
+#if CHIP_DEVICE_CONFIG_BACKGROUND_WORK_POOL_SIZE > 0
+    // Start the background worker pool backing ScheduleBackgroundWork().
+    err = StartBackgroundWorkers();
+    SuccessOrExit(err);
+#endif
+
 exit:
     return err;
 }
@@ -130,6 +136,12 @@ template <class ImplClass>
 CHIP_ERROR GenericPlatformManagerImpl<ImplClass>::_Shutdown()
 {
     CHIP_ERROR err;
+
+#if CHIP_DEVICE_CONFIG_BACKGROUND_WORK_POOL_SIZE > 0
+    // Stop the workers before the layers they may post completions to.
+    StopBackgroundWorkers();
+#endif
+
     ChipLogError(DeviceLayer, "Inet Layer shutdown");
     err = UDPEndPointManager()->Shutdown();
 
@@ -208,6 +220,161 @@ void GenericPlatformManagerImpl<ImplClass>::_ScheduleWork(AsyncWorkFunct workFun
     }
 }
 
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl<ImplClass>::_ScheduleBackgroundWork(AsyncWorkFunct workFunct, intptr_t arg,
+                                                                          PlatformManager::BackgroundWorkPriority priority)
+{
+    VerifyOrReturnError(workFunct != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+#if CHIP_DEVICE_CONFIG_BACKGROUND_WORK_POOL_SIZE > 0
+    BackgroundWorkItem * item = Platform::New<BackgroundWorkItem>();
+    VerifyOrReturnError(item != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    item->WorkFunct = workFunct;
+    item->Arg       = arg;
+    item->Next      = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(mBackgroundQueueLock);
+
+        if (!mBackgroundWorkersRunning)
+        {
+            Platform::Delete(item);
+            return CHIP_ERROR_INCORRECT_STATE;
+        }
+
+        const size_t queue = static_cast<size_t>(priority);
+        if (mBackgroundQueueTail[queue] != nullptr)
+        {
+            mBackgroundQueueTail[queue]->Next = item;
+        }
+        else
+        {
+            mBackgroundQueueHead[queue] = item;
+        }
+        mBackgroundQueueTail[queue] = item;
+    }
+
+    mBackgroundQueueCondition.notify_one();
+    return CHIP_NO_ERROR;
+#else  // CHIP_DEVICE_CONFIG_BACKGROUND_WORK_POOL_SIZE > 0
+    // Without a worker pool, background work degrades to ordinary event loop
+    // work; the completion contract (callback posted via ScheduleWork) holds
+    // either way.
+    Impl()->_ScheduleWork(workFunct, arg);
+    return CHIP_NO_ERROR;
+#endif // CHIP_DEVICE_CONFIG_BACKGROUND_WORK_POOL_SIZE > 0
+}
+
+#if CHIP_DEVICE_CONFIG_BACKGROUND_WORK_POOL_SIZE > 0
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl<ImplClass>::StartBackgroundWorkers()
+{
+    std::lock_guard<std::mutex> lock(mBackgroundQueueLock);
+
+    VerifyOrReturnError(!mBackgroundWorkersRunning, CHIP_NO_ERROR);
+    mBackgroundWorkersRunning = true;
+
+    for (auto & worker : mBackgroundWorkers)
+    {
+        worker = std::thread(&GenericPlatformManagerImpl::BackgroundWorkerMain, this);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl<ImplClass>::StopBackgroundWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(mBackgroundQueueLock);
+        VerifyOrReturn(mBackgroundWorkersRunning);
+        mBackgroundWorkersRunning = false;
+    }
+
+    mBackgroundQueueCondition.notify_all();
+
+    for (auto & worker : mBackgroundWorkers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+
+    // Work still queued at shutdown is discarded without running.
+    for (size_t queue = 0; queue < kNumBackgroundWorkPriorities; queue++)
+    {
+        BackgroundWorkItem * item = mBackgroundQueueHead[queue];
+        while (item != nullptr)
+        {
+            BackgroundWorkItem * next = item->Next;
+            Platform::Delete(item);
+            item = next;
+        }
+        mBackgroundQueueHead[queue] = nullptr;
+        mBackgroundQueueTail[queue] = nullptr;
+    }
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl<ImplClass>::BackgroundWorkerMain()
+{
+    std::unique_lock<std::mutex> lock(mBackgroundQueueLock);
+
+    while (true)
+    {
+        mBackgroundQueueCondition.wait(lock, [this] {
+            if (!mBackgroundWorkersRunning)
+            {
+                return true;
+            }
+            for (size_t queue = 0; queue < kNumBackgroundWorkPriorities; queue++)
+            {
+                if (mBackgroundQueueHead[queue] != nullptr)
+                {
+                    return true;
+                }
+            }
+            return false;
+        });
+
+        if (!mBackgroundWorkersRunning)
+        {
+            return;
+        }
+
+        // Serve the highest priority class with queued work.
+        BackgroundWorkItem * item = nullptr;
+        for (size_t queue = kNumBackgroundWorkPriorities; queue-- > 0;)
+        {
+            item = mBackgroundQueueHead[queue];
+            if (item != nullptr)
+            {
+                mBackgroundQueueHead[queue] = item->Next;
+                if (mBackgroundQueueHead[queue] == nullptr)
+                {
+                    mBackgroundQueueTail[queue] = nullptr;
+                }
+                break;
+            }
+        }
+
+        if (item == nullptr)
+        {
+            continue;
+        }
+
+        lock.unlock();
+        item->WorkFunct(item->Arg);
+        Platform::Delete(item);
+        lock.lock();
+    }
+}
+
+#endif // CHIP_DEVICE_CONFIG_BACKGROUND_WORK_POOL_SIZE > 0
+
 template <class ImplClass>
 void GenericPlatformManagerImpl<ImplClass>::_DispatchEvent(const ChipDeviceEvent * event)
 {
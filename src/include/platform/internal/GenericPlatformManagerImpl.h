@@ -24,6 +24,12 @@
 
 #pragma once
 
+#if CHIP_DEVICE_CONFIG_BACKGROUND_WORK_POOL_SIZE > 0
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
 namespace chip {
 namespace DeviceLayer {
 namespace Internal {
@@ -56,6 +62,7 @@ protected:
     CHIP_ERROR _AddEventHandler(PlatformManager::EventHandlerFunct handler, intptr_t arg);
     void _RemoveEventHandler(PlatformManager::EventHandlerFunct handler, intptr_t arg);
     void _ScheduleWork(AsyncWorkFunct workFunct, intptr_t arg);
+    CHIP_ERROR _ScheduleBackgroundWork(AsyncWorkFunct workFunct, intptr_t arg, PlatformManager::BackgroundWorkPriority priority);
     void _DispatchEvent(const ChipDeviceEvent * event);
 
     CHIP_ERROR _GetFixedLabelList(EndpointId endpoint,
@@ -72,6 +79,32 @@ protected:
 private:
     bool mMsgLayerWasActive;
 
+#if CHIP_DEVICE_CONFIG_BACKGROUND_WORK_POOL_SIZE > 0
+    /**
+     * A queued unit of background work; one priority-ordered FIFO exists per
+     * PlatformManager::BackgroundWorkPriority class.
+     */
+    struct BackgroundWorkItem
+    {
+        AsyncWorkFunct WorkFunct;
+        intptr_t Arg;
+        BackgroundWorkItem * Next;
+    };
+
+    static constexpr size_t kNumBackgroundWorkPriorities = 2;
+
+    CHIP_ERROR StartBackgroundWorkers();
+    void StopBackgroundWorkers();
+    void BackgroundWorkerMain();
+
+    std::mutex mBackgroundQueueLock;
+    std::condition_variable mBackgroundQueueCondition;
+    BackgroundWorkItem * mBackgroundQueueHead[kNumBackgroundWorkPriorities] = {};
+    BackgroundWorkItem * mBackgroundQueueTail[kNumBackgroundWorkPriorities] = {};
+    std::thread mBackgroundWorkers[CHIP_DEVICE_CONFIG_BACKGROUND_WORK_POOL_SIZE];
+    bool mBackgroundWorkersRunning = false;
+#endif // CHIP_DEVICE_CONFIG_BACKGROUND_WORK_POOL_SIZE > 0
+
     ImplClass * Impl() { return static_cast<ImplClass *>(this); }
 };
 
@@ -311,7 +311,7 @@ public:
      *
      * @return  A reference to this object.
      */
-    IPAddress & operator=(const IPAddress & other);
+    IPAddress & operator=(const IPAddress & other) = default;
 
     /**
      * @brief   Emit the IP address in conventional text presentation format.
@@ -115,6 +115,65 @@
 #define INET_CONFIG_NUM_UDP_ENDPOINTS                       64
 #endif // INET_CONFIG_NUM_UDP_ENDPOINTS
 
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_MMSG_RECEIVE
+ *
+ *  @brief
+ *    This defines whether (1) or not (0) socket-based UDP endpoints drain
+ *    multiple datagrams per event-loop wakeup with a single recvmmsg(2)
+ *    call, instead of one recvmsg(2) call per wakeup.
+ *
+ *    Only meaningful on platforms that provide recvmmsg(2).
+ *
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_MMSG_RECEIVE
+#define INET_CONFIG_UDP_SOCKET_MMSG_RECEIVE                 0
+#endif // INET_CONFIG_UDP_SOCKET_MMSG_RECEIVE
+
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE
+ *
+ *  @brief
+ *    The maximum number of datagrams received per recvmmsg(2) call when
+ *    INET_CONFIG_UDP_SOCKET_MMSG_RECEIVE is enabled.  A packet buffer is
+ *    allocated per slot up front, so larger batches trade memory for
+ *    fewer syscalls under bursty traffic.
+ *
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE              16
+#endif // INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE
+
+/**
+ *  @def INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE
+ *
+ *  @brief
+ *    This defines whether (1) or not (0) socket-based TCP endpoints keep
+ *    reading until the kernel receive queue is drained (EAGAIN) on each
+ *    event-loop wakeup, scattering each readv(2) call across the tail of
+ *    the receive queue and a pre-allocated spare buffer, instead of
+ *    issuing one recv(2) call per wakeup.
+ *
+ *    Only meaningful on platforms that provide readv(2).
+ *
+ */
+#ifndef INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE
+#define INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE                0
+#endif // INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE
+
+/**
+ *  @def INET_CONFIG_TCP_SOCKET_DRAIN_LIMIT
+ *
+ *  @brief
+ *    The maximum number of bytes received per event-loop wakeup when
+ *    INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE is enabled, bounding the time
+ *    one busy connection can keep the event loop from servicing others.
+ *
+ */
+#ifndef INET_CONFIG_TCP_SOCKET_DRAIN_LIMIT
+#define INET_CONFIG_TCP_SOCKET_DRAIN_LIMIT                  (32 * 1024)
+#endif // INET_CONFIG_TCP_SOCKET_DRAIN_LIMIT
+
 /**
  *  @def INET_TCP_IDLE_CHECK_INTERVAL
  *
@@ -97,12 +97,8 @@ public:
     constexpr InterfaceId() : mPlatformInterface(kPlatformNull) {}
     explicit constexpr InterfaceId(PlatformType interface) : mPlatformInterface(interface) {}
 
-    constexpr InterfaceId(const InterfaceId & other) : mPlatformInterface(other.mPlatformInterface) {}
-    constexpr InterfaceId & operator=(const InterfaceId & other)
-    {
-        mPlatformInterface = other.mPlatformInterface;
-        return *this;
-    }
+    constexpr InterfaceId(const InterfaceId & other) = default;
+    InterfaceId & operator=(const InterfaceId & other) = default;
 
     static constexpr InterfaceId Null() { return InterfaceId(); }
 
@@ -43,6 +43,10 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#if INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE
+#include <sys/uio.h>
+#endif // INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE
+
 // SOCK_CLOEXEC not defined on all platforms, e.g. iOS/macOS:
 #ifndef SOCK_CLOEXEC
 #define SOCK_CLOEXEC 0
@@ -916,140 +920,202 @@ void TCPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
 
 void TCPEndPointImplSockets::ReceiveData()
 {
-    System::PacketBufferHandle rcvBuf;
-    bool isNewBuf = true;
+#if INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE
+    size_t totalReceived = 0;
+#endif // INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE
+    bool receiveMore = true;
 
-    if (mRcvQueue.IsNull())
-    {
-        rcvBuf = System::PacketBufferHandle::New(kMaxReceiveMessageSize, 0);
-    }
-    else
+    while (receiveMore)
     {
-        rcvBuf = mRcvQueue->Last();
-        if (rcvBuf->AvailableDataLength() == 0)
+        // A single pass is taken by default; in drain mode, receiveMore is re-armed
+        // below while the kernel receive queue still appears to hold data.
+        receiveMore = false;
+
+        System::PacketBufferHandle rcvBuf;
+        bool isNewBuf = true;
+
+        if (mRcvQueue.IsNull())
         {
             rcvBuf = System::PacketBufferHandle::New(kMaxReceiveMessageSize, 0);
         }
         else
         {
-            isNewBuf = false;
-            rcvBuf->CompactHead();
+            rcvBuf = mRcvQueue->Last();
+            if (rcvBuf->AvailableDataLength() == 0)
+            {
+                rcvBuf = System::PacketBufferHandle::New(kMaxReceiveMessageSize, 0);
+            }
+            else
+            {
+                isNewBuf = false;
+                rcvBuf->CompactHead();
+            }
         }
-    }
 
-    if (rcvBuf.IsNull())
-    {
-        DoClose(CHIP_ERROR_NO_MEMORY, false);
-        return;
-    }
+        if (rcvBuf.IsNull())
+        {
+            DoClose(CHIP_ERROR_NO_MEMORY, false);
+            return;
+        }
+
+#if INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE
+        // Scatter the read across the tail of the receive queue and a pre-allocated
+        // spare buffer, so that a single syscall can return more than one buffer's
+        // worth of kernel-queued data.  If the spare cannot be allocated, fall back
+        // to filling just the tail buffer.
+        System::PacketBufferHandle spareBuf = System::PacketBufferHandle::New(kMaxReceiveMessageSize, 0);
+        struct iovec iov[2];
+        int iovCount    = 1;
+        iov[0].iov_base = rcvBuf->Start() + rcvBuf->DataLength();
+        iov[0].iov_len  = rcvBuf->AvailableDataLength();
+        if (!spareBuf.IsNull())
+        {
+            iov[1].iov_base = spareBuf->Start();
+            iov[1].iov_len  = spareBuf->AvailableDataLength();
+            iovCount        = 2;
+        }
+        const size_t requestedLen = iov[0].iov_len + ((iovCount == 2) ? iov[1].iov_len : 0);
 
-    // Attempt to receive data from the socket.
-    ssize_t rcvLen = recv(mSocket, rcvBuf->Start() + rcvBuf->DataLength(), rcvBuf->AvailableDataLength(), 0);
+        ssize_t rcvLen = readv(mSocket, iov, iovCount);
+#else  // INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE
+        // Attempt to receive data from the socket.
+        ssize_t rcvLen = recv(mSocket, rcvBuf->Start() + rcvBuf->DataLength(), rcvBuf->AvailableDataLength(), 0);
+#endif // INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE
 
 #if INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
-    CHIP_ERROR err;
-    bool isProgressing = false;
+        CHIP_ERROR err;
+        bool isProgressing = false;
 
-    err = CheckConnectionProgress(isProgressing);
-    if (err != CHIP_NO_ERROR)
-    {
-        DoClose(err, false);
+        err = CheckConnectionProgress(isProgressing);
+        if (err != CHIP_NO_ERROR)
+        {
+            DoClose(err, false);
 
-        return;
-    }
+            return;
+        }
 
-    if (mLastTCPKernelSendQueueLen == 0)
-    {
-        // If the output queue has been flushed then stop the timer.
+        if (mLastTCPKernelSendQueueLen == 0)
+        {
+            // If the output queue has been flushed then stop the timer.
 
-        StopTCPUserTimeoutTimer();
+            StopTCPUserTimeoutTimer();
 
 #if INET_CONFIG_ENABLE_TCP_SEND_IDLE_CALLBACKS
-        // Notify up if all outstanding data has been acknowledged
+            // Notify up if all outstanding data has been acknowledged
 
-        if (mSendQueue.IsNull())
-        {
-            SetTCPSendIdleAndNotifyChange(true);
-        }
+            if (mSendQueue.IsNull())
+            {
+                SetTCPSendIdleAndNotifyChange(true);
+            }
 #endif // INET_CONFIG_ENABLE_TCP_SEND_IDLE_CALLBACKS
-    }
-    else if (isProgressing && mUserTimeoutTimerRunning)
-    {
-        // Progress is being made. So, shift the timer
-        // forward if it was started.
-        RestartTCPUserTimeoutTimer();
-    }
-#endif // INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
-    // If an error occurred, abort the connection.
-    if (rcvLen < 0)
-    {
-        int systemErrno = errno;
-        if (systemErrno == EAGAIN)
+        }
+        else if (isProgressing && mUserTimeoutTimerRunning)
         {
-            // Note: in this case, we opt to not retry the recv call,
-            // and instead we expect that the read flags will get
-            // reset correctly upon a subsequent return from the
-            // select call.
-            ChipLogError(Inet, "recv: EAGAIN, will retry");
-
-            return;
+            // Progress is being made. So, shift the timer
+            // forward if it was started.
+            RestartTCPUserTimeoutTimer();
         }
-
-        DoClose(CHIP_ERROR_POSIX(systemErrno), false);
-    }
-
-    else
-    {
-        // Mark the connection as being active.
-        MarkActive();
-
-        // If the peer closed their end of the connection...
-        if (rcvLen == 0)
+#endif // INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
+        // If an error occurred, abort the connection.
+        if (rcvLen < 0)
         {
-            // If in the Connected state and the app has provided an OnPeerClose callback,
-            // enter the ReceiveShutdown state.  Providing an OnPeerClose callback allows
-            // the app to decide whether to keep the send side of the connection open after
-            // the peer has closed. If no OnPeerClose is provided, we assume that the app
-            // wants to close both directions and automatically enter the Closing state.
-            if (mState == State::kConnected && OnPeerClose != nullptr)
+            int systemErrno = errno;
+            if (systemErrno == EAGAIN)
             {
-                mState = State::kReceiveShutdown;
-            }
-            else
-            {
-                mState = State::kClosing;
-            }
-            // Do not wait for ability to read on this endpoint.
-            (void) static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingRead(mWatch);
-            // Call the app's OnPeerClose.
-            if (OnPeerClose != nullptr)
-            {
-                OnPeerClose(this);
+#if INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE
+                // The kernel receive queue is drained; deliver whatever the earlier
+                // passes queued up.
+                break;
+#else  // INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE
+                // Note: in this case, we opt to not retry the recv call,
+                // and instead we expect that the read flags will get
+                // reset correctly upon a subsequent return from the
+                // select call.
+                ChipLogError(Inet, "recv: EAGAIN, will retry");
+
+                return;
+#endif // INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE
             }
+
+            DoClose(CHIP_ERROR_POSIX(systemErrno), false);
         }
 
-        // Otherwise, add the new data onto the receive queue.
         else
         {
-            VerifyOrDie(rcvLen > 0);
-            size_t newDataLength = rcvBuf->DataLength() + static_cast<size_t>(rcvLen);
-            VerifyOrDie(CanCastTo<uint16_t>(newDataLength));
-            if (isNewBuf)
+            // Mark the connection as being active.
+            MarkActive();
+
+            // If the peer closed their end of the connection...
+            if (rcvLen == 0)
             {
-                rcvBuf->SetDataLength(static_cast<uint16_t>(newDataLength));
-                rcvBuf.RightSize();
-                if (mRcvQueue.IsNull())
+                // If in the Connected state and the app has provided an OnPeerClose callback,
+                // enter the ReceiveShutdown state.  Providing an OnPeerClose callback allows
+                // the app to decide whether to keep the send side of the connection open after
+                // the peer has closed. If no OnPeerClose is provided, we assume that the app
+                // wants to close both directions and automatically enter the Closing state.
+                if (mState == State::kConnected && OnPeerClose != nullptr)
                 {
-                    mRcvQueue = std::move(rcvBuf);
+                    mState = State::kReceiveShutdown;
                 }
                 else
                 {
-                    mRcvQueue->AddToEnd(std::move(rcvBuf));
+                    mState = State::kClosing;
+                }
+                // Do not wait for ability to read on this endpoint.
+                (void) static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingRead(mWatch);
+                // Call the app's OnPeerClose.
+                if (OnPeerClose != nullptr)
+                {
+                    OnPeerClose(this);
                 }
             }
+
+            // Otherwise, add the new data onto the receive queue.
             else
             {
-                rcvBuf->SetDataLength(static_cast<uint16_t>(newDataLength), mRcvQueue);
+                VerifyOrDie(rcvLen > 0);
+#if INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE
+                const size_t tailLen = min(static_cast<size_t>(rcvLen), static_cast<size_t>(iov[0].iov_len));
+#else  // INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE
+                const size_t tailLen = static_cast<size_t>(rcvLen);
+#endif // INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE
+                size_t newDataLength = rcvBuf->DataLength() + tailLen;
+                VerifyOrDie(CanCastTo<uint16_t>(newDataLength));
+                if (isNewBuf)
+                {
+                    rcvBuf->SetDataLength(static_cast<uint16_t>(newDataLength));
+                    rcvBuf.RightSize();
+                    if (mRcvQueue.IsNull())
+                    {
+                        mRcvQueue = std::move(rcvBuf);
+                    }
+                    else
+                    {
+                        mRcvQueue->AddToEnd(std::move(rcvBuf));
+                    }
+                }
+                else
+                {
+                    rcvBuf->SetDataLength(static_cast<uint16_t>(newDataLength), mRcvQueue);
+                }
+
+#if INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE
+                // Any overflow from the scatter read landed in the spare buffer.
+                const size_t spareLen = static_cast<size_t>(rcvLen) - tailLen;
+                if (spareLen != 0)
+                {
+                    VerifyOrDie(CanCastTo<uint16_t>(spareLen));
+                    spareBuf->SetDataLength(static_cast<uint16_t>(spareLen));
+                    spareBuf.RightSize();
+                    mRcvQueue->AddToEnd(std::move(spareBuf));
+                }
+
+                // Keep draining while the kernel filled everything we asked for, but
+                // bound the bytes consumed per wakeup so one busy connection cannot
+                // starve the other endpoints sharing the event loop.
+                totalReceived += static_cast<size_t>(rcvLen);
+                receiveMore = (static_cast<size_t>(rcvLen) == requestedLen) && (totalReceived < INET_CONFIG_TCP_SOCKET_DRAIN_LIMIT);
+#endif // INET_CONFIG_TCP_SOCKET_DRAIN_RECEIVE
             }
         }
     }
@@ -121,6 +121,32 @@ CHIP_ERROR UDPEndPoint::SendMsg(const IPPacketInfo * pktInfo, System::PacketBuff
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR UDPEndPoint::SendMsgs(const IPPacketInfo * pktInfos, System::PacketBufferHandle * msgs, size_t msgCount)
+{
+    INET_FAULT_INJECT(FaultInjection::kFault_Send, return INET_ERROR_UNKNOWN_INTERFACE;);
+    INET_FAULT_INJECT(FaultInjection::kFault_SendNonCritical, return CHIP_ERROR_NO_MEMORY;);
+
+    ReturnErrorOnFailure(SendMsgsImpl(pktInfos, msgs, msgCount));
+
+    CHIP_SYSTEM_FAULT_INJECT_ASYNC_EVENT();
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR UDPEndPoint::SendMsgsImpl(const IPPacketInfo * pktInfos, System::PacketBufferHandle * msgs, size_t msgCount)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    for (size_t i = 0; i < msgCount; i++)
+    {
+        CHIP_ERROR sendErr = SendMsgImpl(&pktInfos[i], std::move(msgs[i]));
+        if (err == CHIP_NO_ERROR)
+        {
+            err = sendErr;
+        }
+    }
+    return err;
+}
+
 void UDPEndPoint::Close()
 {
     if (mState != State::kClosed)
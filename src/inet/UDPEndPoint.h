@@ -183,6 +183,14 @@ public:
      */
     CHIP_ERROR Listen(OnMessageReceivedFunct onMessageReceived, OnReceiveErrorFunct onReceiveError, void * appState = nullptr);
 
+    /**
+     * Assign the endpoint's socket to an event loop dispatch lane (see System::SocketWatchPriority).
+     *
+     *  Valid only once the endpoint has a socket, i.e. after a successful Listen(). A no-op hint on
+     *  platforms whose event dispatch is not priority-ordered.
+     */
+    virtual CHIP_ERROR SetSocketWatchPriority(System::SocketWatchPriority priority) { return CHIP_NO_ERROR; }
+
     /**
      * Send a UDP message to the specified destination address.
      *
@@ -225,6 +233,24 @@ public:
      */
     CHIP_ERROR SendMsg(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg);
 
+    /**
+     * Send several UDP messages in one call, each to its own destination.
+     *
+     *  Semantically equivalent to calling SendMsg once per (packet info,
+     *  buffer) pair; implementations that can hand multiple datagrams to the
+     *  network stack in one system call do so. All buffers are consumed, and
+     *  the first failure is returned after the remaining messages have been
+     *  attempted.
+     *
+     * @param[in]   pktInfos    Source and destination information, one entry per message.
+     * @param[in]   msgs        Packet buffers containing the UDP messages, parallel to \c pktInfos.
+     * @param[in]   msgCount    The number of messages to send.
+     *
+     * @retval  CHIP_NO_ERROR   Success: every message is queued for transmit.
+     * @retval  other           The error from the first message that failed to send.
+     */
+    CHIP_ERROR SendMsgs(const IPPacketInfo * pktInfos, chip::System::PacketBufferHandle * msgs, size_t msgCount);
+
     /**
      * Close the endpoint.
      *
@@ -287,6 +313,12 @@ protected:
     virtual CHIP_ERROR ListenImpl()                                                                                           = 0;
     virtual CHIP_ERROR SendMsgImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg)                     = 0;
     virtual void CloseImpl()                                                                                                  = 0;
+
+    /**
+     * Default SendMsgs implementation sending one message at a time; overridden
+     * by implementations with a batched send path.
+     */
+    virtual CHIP_ERROR SendMsgsImpl(const IPPacketInfo * pktInfos, chip::System::PacketBufferHandle * msgs, size_t msgCount);
 };
 
 template <>
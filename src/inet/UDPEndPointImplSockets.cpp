@@ -275,6 +275,12 @@ uint16_t UDPEndPointImplSockets::GetBoundPort() const
     return mBoundPort;
 }
 
+CHIP_ERROR UDPEndPointImplSockets::SetSocketWatchPriority(System::SocketWatchPriority priority)
+{
+    VerifyOrReturnError(mSocket != kInvalidSocketFd, CHIP_ERROR_INCORRECT_STATE);
+    return static_cast<System::LayerSockets *>(&GetSystemLayer())->SetWatchPriority(mWatch, priority);
+}
+
 CHIP_ERROR UDPEndPointImplSockets::ListenImpl()
 {
     // Wait for ability to read on this endpoint.
@@ -299,11 +305,6 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     msgIOV.iov_base = msg->Start();
     msgIOV.iov_len  = msg->DataLength();
 
-#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-    uint8_t controlData[256];
-    memset(controlData, 0, sizeof(controlData));
-#endif // defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-
     struct msghdr msgHeader;
     memset(&msgHeader, 0, sizeof(msgHeader));
     msgHeader.msg_iov    = &msgIOV;
@@ -352,75 +353,255 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     if (intf.IsPresent() || aPktInfo->SrcAddress.Type() != IPAddressType::kAny)
     {
 #if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-        msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+        // Rebuild the control message only when the (interface, source address) pair
+        // changes; steady-state traffic reuses the bytes built for the previous send.
+        if (mPktInfoControlLen == 0 || mPktInfoAddrType != mAddrType || mPktInfoIntf != intf ||
+            mPktInfoSrcAddress != aPktInfo->SrcAddress)
+        {
+            ReturnErrorOnFailure(BuildPktInfoControl(intf, aPktInfo->SrcAddress));
+        }
 
-        struct cmsghdr * controlHdr      = CMSG_FIRSTHDR(&msgHeader);
-        InterfaceId::PlatformType intfId = intf.GetPlatformInterface();
+        msgHeader.msg_control    = mPktInfoControl;
+        msgHeader.msg_controllen = mPktInfoControlLen;
+#else  // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
+        return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
+    }
 
-#if INET_CONFIG_ENABLE_IPV4
+    // Send IP packet.
+    const ssize_t lenSent = sendmsg(mSocket, &msgHeader, 0);
+    if (lenSent == -1)
+    {
+        return CHIP_ERROR_POSIX(errno);
+    }
+    if (lenSent != msg->DataLength())
+    {
+        return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
+    }
+    return CHIP_NO_ERROR;
+}
 
-        if (mAddrType == IPAddressType::kIPv4)
+CHIP_ERROR UDPEndPointImplSockets::SendMsgsImpl(const IPPacketInfo * aPktInfos, System::PacketBufferHandle * aMsgs, size_t aMsgCount)
+{
+#if !defined(__linux__)
+    // sendmmsg() is not portable; send one datagram at a time elsewhere.
+    return UDPEndPoint::SendMsgsImpl(aPktInfos, aMsgs, aMsgCount);
+#else  // defined(__linux__)
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    size_t consumed = 0;
+    while (consumed < aMsgCount)
+    {
+        constexpr size_t kMaxChunkSize = 16;
+        struct mmsghdr mmsgHeaders[kMaxChunkSize];
+        struct iovec msgIOVs[kMaxChunkSize];
+        SockAddr peerSockAddrs[kMaxChunkSize];
+
+        memset(mmsgHeaders, 0, sizeof(mmsgHeaders));
+        memset(peerSockAddrs, 0, sizeof(peerSockAddrs));
+
+        // The cached pktinfo control message is shared by a whole chunk, so a
+        // chunk ends where the effective (interface, source address) pair of
+        // its messages changes.
+        InterfaceId chunkIntf = aPktInfos[consumed].Interface.IsPresent() ? aPktInfos[consumed].Interface : mBoundIntfId;
+        const IPAddress chunkSrcAddress = aPktInfos[consumed].SrcAddress;
+
+        size_t chunkSize = 0;
+        while (consumed + chunkSize < aMsgCount && chunkSize < kMaxChunkSize)
         {
-#if defined(IP_PKTINFO)
-            controlHdr->cmsg_level = IPPROTO_IP;
-            controlHdr->cmsg_type  = IP_PKTINFO;
-            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in_pktinfo));
+            const IPPacketInfo & pktInfo = aPktInfos[consumed + chunkSize];
+
+            InterfaceId intf = pktInfo.Interface.IsPresent() ? pktInfo.Interface : mBoundIntfId;
+            if (intf != chunkIntf || pktInfo.SrcAddress != chunkSrcAddress)
+            {
+                break;
+            }
 
-            auto * pktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-            if (!CanCastTo<decltype(pktInfo->ipi_ifindex)>(intfId))
+            // Messages the batch cannot express (wrong address type, chained
+            // buffer) go through the single-message path so they produce the
+            // same errors they always have.
+            if (GetSocket(pktInfo.DestAddress.Type()) != CHIP_NO_ERROR || mAddrType != pktInfo.DestAddress.Type() ||
+                aMsgs[consumed + chunkSize]->HasChainedBuffer())
             {
-                return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+                break;
             }
 
-            pktInfo->ipi_ifindex  = static_cast<decltype(pktInfo->ipi_ifindex)>(intfId);
-            pktInfo->ipi_spec_dst = aPktInfo->SrcAddress.ToIPv4();
+            System::PacketBufferHandle & msg = aMsgs[consumed + chunkSize];
 
-            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in_pktinfo));
-#else  // !defined(IP_PKTINFO)
-            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif // !defined(IP_PKTINFO)
-        }
+            msgIOVs[chunkSize].iov_base = msg->Start();
+            msgIOVs[chunkSize].iov_len  = msg->DataLength();
+
+            struct msghdr & msgHeader = mmsgHeaders[chunkSize].msg_hdr;
+            msgHeader.msg_iov         = &msgIOVs[chunkSize];
+            msgHeader.msg_iovlen      = 1;
+            msgHeader.msg_name        = &peerSockAddrs[chunkSize];
 
+            SockAddr & peerSockAddr = peerSockAddrs[chunkSize];
+            if (mAddrType == IPAddressType::kIPv6)
+            {
+                peerSockAddr.in6.sin6_family     = AF_INET6;
+                peerSockAddr.in6.sin6_port       = htons(pktInfo.DestPort);
+                peerSockAddr.in6.sin6_addr       = pktInfo.DestAddress.ToIPv6();
+                InterfaceId::PlatformType intfId = pktInfo.Interface.GetPlatformInterface();
+                VerifyOrReturnError(CanCastTo<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId), CHIP_ERROR_INCORRECT_STATE);
+                peerSockAddr.in6.sin6_scope_id = static_cast<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId);
+                msgHeader.msg_namelen          = sizeof(sockaddr_in6);
+            }
+#if INET_CONFIG_ENABLE_IPV4
+            else
+            {
+                peerSockAddr.in.sin_family = AF_INET;
+                peerSockAddr.in.sin_port   = htons(pktInfo.DestPort);
+                peerSockAddr.in.sin_addr   = pktInfo.DestAddress.ToIPv4();
+                msgHeader.msg_namelen      = sizeof(sockaddr_in);
+            }
 #endif // INET_CONFIG_ENABLE_IPV4
 
-        if (mAddrType == IPAddressType::kIPv6)
+            chunkSize++;
+        }
+
+        if (chunkSize == 0)
         {
-#if defined(IPV6_PKTINFO)
-            controlHdr->cmsg_level = IPPROTO_IPV6;
-            controlHdr->cmsg_type  = IPV6_PKTINFO;
-            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in6_pktinfo));
+            // The first pending message cannot join a batch; send it alone.
+            CHIP_ERROR sendErr = SendMsgImpl(&aPktInfos[consumed], std::move(aMsgs[consumed]));
+            if (err == CHIP_NO_ERROR)
+            {
+                err = sendErr;
+            }
+            consumed++;
+            continue;
+        }
 
-            auto * pktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-            if (!CanCastTo<decltype(pktInfo->ipi6_ifindex)>(intfId))
+        if (chunkIntf.IsPresent() || chunkSrcAddress.Type() != IPAddressType::kAny)
+        {
+#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
+            if (mPktInfoControlLen == 0 || mPktInfoAddrType != mAddrType || mPktInfoIntf != chunkIntf ||
+                mPktInfoSrcAddress != chunkSrcAddress)
             {
-                return CHIP_ERROR_UNEXPECTED_EVENT;
+                ReturnErrorOnFailure(BuildPktInfoControl(chunkIntf, chunkSrcAddress));
             }
-            pktInfo->ipi6_ifindex = static_cast<decltype(pktInfo->ipi6_ifindex)>(intfId);
-            pktInfo->ipi6_addr    = aPktInfo->SrcAddress.ToIPv6();
 
-            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in6_pktinfo));
-#else  // !defined(IPV6_PKTINFO)
+            for (size_t i = 0; i < chunkSize; i++)
+            {
+                mmsgHeaders[i].msg_hdr.msg_control    = mPktInfoControl;
+                mmsgHeaders[i].msg_hdr.msg_controllen = mPktInfoControlLen;
+            }
+#else  // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
             return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif // !defined(IPV6_PKTINFO)
+#endif // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
         }
 
-#else  // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
-        return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
+        // Hand the whole chunk to the kernel; retry the tail after a partial
+        // acceptance, since sendmmsg() may stop early without an error.
+        size_t sent = 0;
+        while (sent < chunkSize)
+        {
+            const int rv = sendmmsg(mSocket, mmsgHeaders + sent, static_cast<unsigned int>(chunkSize - sent), 0);
+            if (rv == -1)
+            {
+                if (err == CHIP_NO_ERROR)
+                {
+                    err = CHIP_ERROR_POSIX(errno);
+                }
+                break;
+            }
+            sent += static_cast<size_t>(rv);
+        }
+
+        for (size_t i = 0; i < sent; i++)
+        {
+            if (mmsgHeaders[i].msg_len != aMsgs[consumed + i]->DataLength() && err == CHIP_NO_ERROR)
+            {
+                err = CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
+            }
+        }
+
+        for (size_t i = 0; i < chunkSize; i++)
+        {
+            aMsgs[consumed + i] = nullptr;
+        }
+
+        consumed += chunkSize;
     }
 
-    // Send IP packet.
-    const ssize_t lenSent = sendmsg(mSocket, &msgHeader, 0);
-    if (lenSent == -1)
+    return err;
+#endif // defined(__linux__)
+}
+
+CHIP_ERROR UDPEndPointImplSockets::BuildPktInfoControl(InterfaceId aIntf, const IPAddress & aSrcAddress)
+{
+    mPktInfoControlLen = 0;
+
+#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
+    memset(mPktInfoControl, 0, sizeof(mPktInfoControl));
+
+    // Use a throwaway msghdr so the CMSG_* macros can lay out the control message.
+    struct msghdr msgHeader;
+    memset(&msgHeader, 0, sizeof(msgHeader));
+    msgHeader.msg_control    = mPktInfoControl;
+    msgHeader.msg_controllen = sizeof(mPktInfoControl);
+
+    struct cmsghdr * controlHdr      = CMSG_FIRSTHDR(&msgHeader);
+    InterfaceId::PlatformType intfId = aIntf.GetPlatformInterface();
+
+#if INET_CONFIG_ENABLE_IPV4
+
+    if (mAddrType == IPAddressType::kIPv4)
     {
-        return CHIP_ERROR_POSIX(errno);
+#if defined(IP_PKTINFO)
+        static_assert(sizeof(mPktInfoControl) >= CMSG_SPACE(sizeof(in_pktinfo)), "pktinfo control buffer too small");
+
+        controlHdr->cmsg_level = IPPROTO_IP;
+        controlHdr->cmsg_type  = IP_PKTINFO;
+        controlHdr->cmsg_len   = CMSG_LEN(sizeof(in_pktinfo));
+
+        auto * pktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+        if (!CanCastTo<decltype(pktInfo->ipi_ifindex)>(intfId))
+        {
+            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+        }
+
+        pktInfo->ipi_ifindex  = static_cast<decltype(pktInfo->ipi_ifindex)>(intfId);
+        pktInfo->ipi_spec_dst = aSrcAddress.ToIPv4();
+
+        mPktInfoControlLen = CMSG_SPACE(sizeof(in_pktinfo));
+#else  // !defined(IP_PKTINFO)
+        return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !defined(IP_PKTINFO)
     }
-    if (lenSent != msg->DataLength())
+
+#endif // INET_CONFIG_ENABLE_IPV4
+
+    if (mAddrType == IPAddressType::kIPv6)
     {
-        return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
+#if defined(IPV6_PKTINFO)
+        static_assert(sizeof(mPktInfoControl) >= CMSG_SPACE(sizeof(in6_pktinfo)), "pktinfo control buffer too small");
+
+        controlHdr->cmsg_level = IPPROTO_IPV6;
+        controlHdr->cmsg_type  = IPV6_PKTINFO;
+        controlHdr->cmsg_len   = CMSG_LEN(sizeof(in6_pktinfo));
+
+        auto * pktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+        if (!CanCastTo<decltype(pktInfo->ipi6_ifindex)>(intfId))
+        {
+            return CHIP_ERROR_UNEXPECTED_EVENT;
+        }
+        pktInfo->ipi6_ifindex = static_cast<decltype(pktInfo->ipi6_ifindex)>(intfId);
+        pktInfo->ipi6_addr    = aSrcAddress.ToIPv6();
+
+        mPktInfoControlLen = CMSG_SPACE(sizeof(in6_pktinfo));
+#else  // !defined(IPV6_PKTINFO)
+        return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !defined(IPV6_PKTINFO)
     }
+
+    mPktInfoAddrType   = mAddrType;
+    mPktInfoIntf       = aIntf;
+    mPktInfoSrcAddress = aSrcAddress;
     return CHIP_NO_ERROR;
+#else  // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
+    return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
 }
 
 void UDPEndPointImplSockets::CloseImpl()
@@ -569,6 +750,170 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events, intptr
     reinterpret_cast<UDPEndPointImplSockets *>(data)->HandlePendingIO(events);
 }
 
+namespace {
+
+/**
+ * Extract the source address/port and, from the received control data, the destination
+ * address and arrival interface of a single datagram.
+ */
+CHIP_ERROR ExtractPacketInfo(struct msghdr & msgHeader, const SockAddr & peerSockAddr, uint16_t boundPort,
+                             IPPacketInfo & packetInfo)
+{
+    packetInfo.Clear();
+    packetInfo.DestPort = boundPort;
+
+    if (peerSockAddr.any.sa_family == AF_INET6)
+    {
+        packetInfo.SrcAddress = IPAddress(peerSockAddr.in6.sin6_addr);
+        packetInfo.SrcPort    = ntohs(peerSockAddr.in6.sin6_port);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else if (peerSockAddr.any.sa_family == AF_INET)
+    {
+        packetInfo.SrcAddress = IPAddress(peerSockAddr.in.sin_addr);
+        packetInfo.SrcPort    = ntohs(peerSockAddr.in.sin_port);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+    {
+#if INET_CONFIG_ENABLE_IPV4
+#ifdef IP_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
+            {
+                return CHIP_ERROR_INCORRECT_STATE;
+            }
+            packetInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
+            packetInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
+            continue;
+        }
+#endif // defined(IP_PKTINFO)
+#endif // INET_CONFIG_ENABLE_IPV4
+
+#ifdef IPV6_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
+            {
+                return CHIP_ERROR_INCORRECT_STATE;
+            }
+            packetInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
+            packetInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
+            continue;
+        }
+#endif // defined(IPV6_PKTINFO)
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+} // anonymous namespace
+
+#if INET_CONFIG_UDP_SOCKET_MMSG_RECEIVE
+
+void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
+{
+    if (mState != State::kListening || OnMessageReceived == nullptr || !events.Has(System::SocketEventFlags::kRead))
+    {
+        return;
+    }
+
+    constexpr unsigned int kBatchSize = INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE;
+
+    System::PacketBufferHandle buffers[kBatchSize];
+    struct mmsghdr msgHeaders[kBatchSize];
+    struct iovec msgIOVs[kBatchSize];
+    SockAddr peerSockAddrs[kBatchSize];
+    uint8_t controlData[kBatchSize][256];
+
+    memset(msgHeaders, 0, sizeof(msgHeaders));
+    memset(peerSockAddrs, 0, sizeof(peerSockAddrs));
+
+    unsigned int slots = 0;
+    for (; slots < kBatchSize; slots++)
+    {
+        buffers[slots] = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+        if (buffers[slots].IsNull())
+        {
+            break;
+        }
+
+        msgIOVs[slots].iov_base = buffers[slots]->Start();
+        msgIOVs[slots].iov_len  = buffers[slots]->AvailableDataLength();
+
+        struct msghdr & msgHeader = msgHeaders[slots].msg_hdr;
+        msgHeader.msg_name        = &peerSockAddrs[slots];
+        msgHeader.msg_namelen     = sizeof(peerSockAddrs[slots]);
+        msgHeader.msg_iov         = &msgIOVs[slots];
+        msgHeader.msg_iovlen      = 1;
+        msgHeader.msg_control     = controlData[slots];
+        msgHeader.msg_controllen  = sizeof(controlData[slots]);
+    }
+
+    if (slots == 0)
+    {
+        if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, CHIP_ERROR_NO_MEMORY, nullptr);
+        }
+        return;
+    }
+
+    int received = recvmmsg(mSocket, msgHeaders, slots, MSG_DONTWAIT, nullptr);
+
+    if (received < 0)
+    {
+        if (OnReceiveError != nullptr && errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+            OnReceiveError(this, CHIP_ERROR_POSIX(errno), nullptr);
+        }
+        return;
+    }
+
+    // A callback may close (and release) this endpoint; hold a reference and re-check
+    // state while draining the batch.
+    Retain();
+
+    for (int i = 0; i < received && mState == State::kListening; i++)
+    {
+        CHIP_ERROR lStatus = CHIP_NO_ERROR;
+        IPPacketInfo lPacketInfo;
+
+        if (msgHeaders[i].msg_len > buffers[i]->AvailableDataLength())
+        {
+            lStatus = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
+        }
+        else
+        {
+            buffers[i]->SetDataLength(static_cast<uint16_t>(msgHeaders[i].msg_len));
+            lStatus = ExtractPacketInfo(msgHeaders[i].msg_hdr, peerSockAddrs[i], mBoundPort, lPacketInfo);
+        }
+
+        if (lStatus == CHIP_NO_ERROR)
+        {
+            buffers[i].RightSize();
+            OnMessageReceived(this, std::move(buffers[i]), &lPacketInfo);
+        }
+        else if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, lStatus, nullptr);
+        }
+    }
+
+    Release();
+}
+
+#else // INET_CONFIG_UDP_SOCKET_MMSG_RECEIVE
+
 void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
 {
     if (mState != State::kListening || OnMessageReceived == nullptr || !events.Has(System::SocketEventFlags::kRead))
@@ -580,9 +925,6 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
     IPPacketInfo lPacketInfo;
     System::PacketBufferHandle lBuffer;
 
-    lPacketInfo.Clear();
-    lPacketInfo.DestPort = mBoundPort;
-
     lBuffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
 
     if (!lBuffer.IsNull())
@@ -620,61 +962,7 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         {
             lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
 
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
-#if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
-#endif // INET_CONFIG_ENABLE_IPV4
-            else
-            {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
-            }
-        }
-
-        if (lStatus == CHIP_NO_ERROR)
-        {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
-            {
-#if INET_CONFIG_ENABLE_IPV4
-#ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
-                    continue;
-                }
-#endif // defined(IP_PKTINFO)
-#endif // INET_CONFIG_ENABLE_IPV4
-
-#ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
-                    continue;
-                }
-#endif // defined(IPV6_PKTINFO)
-            }
+            lStatus = ExtractPacketInfo(msgHeader, lPeerSockAddr, mBoundPort, lPacketInfo);
         }
     }
     else
@@ -696,6 +984,8 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
     }
 }
 
+#endif // INET_CONFIG_UDP_SOCKET_MMSG_RECEIVE
+
 #if IP_MULTICAST_LOOP || IPV6_MULTICAST_LOOP
 static CHIP_ERROR SocketsSetMulticastLoopback(int aSocket, bool aLoopback, int aProtocol, int aOption)
 {
@@ -44,6 +44,7 @@ public:
     CHIP_ERROR SetMulticastLoopback(IPVersion aIPVersion, bool aLoopback) override;
     InterfaceId GetBoundInterface() const override;
     uint16_t GetBoundPort() const override;
+    CHIP_ERROR SetSocketWatchPriority(System::SocketWatchPriority priority) override;
     void Free() override;
 
 private:
@@ -56,15 +57,32 @@ private:
     CHIP_ERROR BindInterfaceImpl(IPAddressType addressType, InterfaceId interfaceId) override;
     CHIP_ERROR ListenImpl() override;
     CHIP_ERROR SendMsgImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg) override;
+    CHIP_ERROR SendMsgsImpl(const IPPacketInfo * pktInfos, chip::System::PacketBufferHandle * msgs, size_t msgCount) override;
     void CloseImpl() override;
 
     CHIP_ERROR GetSocket(IPAddressType addressType);
     void HandlePendingIO(System::SocketEvents events);
     static void HandlePendingIO(System::SocketEvents events, intptr_t data);
 
+    /**
+     * Rebuild the cached IP_PKTINFO/IPV6_PKTINFO control message for sends over aIntf
+     * with source address aSrcAddress.
+     */
+    CHIP_ERROR BuildPktInfoControl(InterfaceId aIntf, const IPAddress & aSrcAddress);
+
     InterfaceId mBoundIntfId;
     uint16_t mBoundPort;
 
+    // Prebuilt pktinfo control message for the most recent (interface, source address)
+    // pair, so steady-state traffic towards one destination does not zero and rebuild
+    // identical control data for every datagram.
+    static constexpr size_t kPktInfoControlSize = 64;
+    uint8_t mPktInfoControl[kPktInfoControlSize];
+    size_t mPktInfoControlLen = 0;
+    InterfaceId mPktInfoIntf  = InterfaceId::Null();
+    IPAddress mPktInfoSrcAddress;
+    IPAddressType mPktInfoAddrType = IPAddressType::kUnknown;
+
 #if CHIP_SYSTEM_CONFIG_USE_DISPATCH
     dispatch_source_t mReadableSource = nullptr;
 #endif // CHIP_SYSTEM_CONFIG_USE_DISPATCH
@@ -0,0 +1,235 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/AsyncPersistentStorageDelegate.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string.h>
+
+namespace chip {
+
+CHIP_ERROR AsyncPersistentStorageDelegate::Init(PersistentStorageDelegate * backend, System::Layer * systemLayer)
+{
+    VerifyOrReturnError(backend != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    mBackend        = backend;
+    mSystemLayer    = systemLayer;
+    mPendingCount   = 0;
+    mDrainScheduled = false;
+    return CHIP_NO_ERROR;
+}
+
+void AsyncPersistentStorageDelegate::Shutdown()
+{
+    VerifyOrReturn(mBackend != nullptr);
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(DrainHandler, this);
+    }
+    mDrainScheduled = false;
+    LogErrorOnFailure(Flush());
+    mBackend     = nullptr;
+    mSystemLayer = nullptr;
+}
+
+CHIP_ERROR AsyncPersistentStorageDelegate::Flush()
+{
+    VerifyOrReturnError(mBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_ERROR firstError = CHIP_NO_ERROR;
+    while (mPendingCount > 0)
+    {
+        CHIP_ERROR err = ApplyOldest();
+        if (firstError == CHIP_NO_ERROR)
+        {
+            firstError = err;
+        }
+    }
+    return firstError;
+}
+
+CHIP_ERROR AsyncPersistentStorageDelegate::DrainOne()
+{
+    VerifyOrReturnError(mBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mPendingCount > 0, CHIP_NO_ERROR);
+    return ApplyOldest();
+}
+
+CHIP_ERROR AsyncPersistentStorageDelegate::SyncGetKeyValue(const char * key, void * buffer, uint16_t & size)
+{
+    VerifyOrReturnError(mBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    // Read-your-writes: pending entries shadow the backend.
+    if (PendingWrite * entry = FindPending(key))
+    {
+        VerifyOrReturnError(!entry->isDelete, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+        if (entry->valueSize > size)
+        {
+            size = entry->valueSize;
+            return CHIP_ERROR_BUFFER_TOO_SMALL;
+        }
+        size = entry->valueSize;
+        memcpy(buffer, entry->value, size);
+        return CHIP_NO_ERROR;
+    }
+
+    return mBackend->SyncGetKeyValue(key, buffer, size);
+}
+
+CHIP_ERROR AsyncPersistentStorageDelegate::SyncSetKeyValue(const char * key, const void * value, uint16_t size)
+{
+    VerifyOrReturnError(mBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key != nullptr && (value != nullptr || size == 0), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Values too large to queue are written through, after draining pending
+    // writes so ordering relative to them is preserved.
+    if (strlen(key) > kMaxKeyLength || size > kMaxValueSize)
+    {
+        ReturnErrorOnFailure(Flush());
+        return mBackend->SyncSetKeyValue(key, value, size);
+    }
+
+    return Enqueue(key, value, size, /* isDelete = */ false);
+}
+
+CHIP_ERROR AsyncPersistentStorageDelegate::SyncDeleteKeyValue(const char * key)
+{
+    VerifyOrReturnError(mBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (strlen(key) > kMaxKeyLength)
+    {
+        ReturnErrorOnFailure(Flush());
+        return mBackend->SyncDeleteKeyValue(key);
+    }
+
+    return Enqueue(key, nullptr, 0, /* isDelete = */ true);
+}
+
+CHIP_ERROR AsyncPersistentStorageDelegate::SyncBeginTransaction()
+{
+    VerifyOrReturnError(mBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    return mBackend->SyncBeginTransaction();
+}
+
+CHIP_ERROR AsyncPersistentStorageDelegate::SyncCommitTransaction()
+{
+    VerifyOrReturnError(mBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    return mBackend->SyncCommitTransaction();
+}
+
+AsyncPersistentStorageDelegate::PendingWrite * AsyncPersistentStorageDelegate::FindPending(const char * key)
+{
+    for (size_t i = 0; i < mPendingCount; i++)
+    {
+        if (strcmp(mPending[i].key, key) == 0)
+        {
+            return &mPending[i];
+        }
+    }
+    return nullptr;
+}
+
+CHIP_ERROR AsyncPersistentStorageDelegate::Enqueue(const char * key, const void * value, uint16_t size, bool isDelete)
+{
+    PendingWrite * entry = FindPending(key);
+    if (entry == nullptr)
+    {
+        // A full queue falls back to write-through of the oldest entry, so the
+        // caller at worst pays one backend commit instead of queue-length many.
+        if (mPendingCount == kMaxPendingWrites)
+        {
+            ReturnErrorOnFailure(ApplyOldest());
+        }
+        entry = &mPending[mPendingCount];
+        strncpy(entry->key, key, sizeof(entry->key));
+        entry->key[kMaxKeyLength] = '\0';
+        mPendingCount++;
+    }
+
+    entry->isDelete  = isDelete;
+    entry->valueSize = size;
+    if (size > 0)
+    {
+        memcpy(entry->value, value, size);
+    }
+
+    ScheduleDrain();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AsyncPersistentStorageDelegate::ApplyOldest()
+{
+    VerifyOrReturnError(mPendingCount > 0, CHIP_ERROR_INCORRECT_STATE);
+
+    PendingWrite & entry = mPending[0];
+    CHIP_ERROR err;
+    if (entry.isDelete)
+    {
+        err = mBackend->SyncDeleteKeyValue(entry.key);
+        if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+        {
+            err = CHIP_NO_ERROR;
+        }
+    }
+    else
+    {
+        err = mBackend->SyncSetKeyValue(entry.key, entry.value, entry.valueSize);
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Support, "Deferred storage commit for key '%s' failed: %s", entry.key, ErrorStr(err));
+    }
+    if (mCommitCallback != nullptr)
+    {
+        mCommitCallback(entry.key, err, mCommitCallbackContext);
+    }
+
+    mPendingCount--;
+    memmove(&mPending[0], &mPending[1], mPendingCount * sizeof(PendingWrite));
+    return err;
+}
+
+void AsyncPersistentStorageDelegate::ScheduleDrain()
+{
+    VerifyOrReturn(mSystemLayer != nullptr && !mDrainScheduled);
+    CHIP_ERROR err = mSystemLayer->ScheduleWork(DrainHandler, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Support, "Failed to schedule storage drain: %s", ErrorStr(err));
+        return;
+    }
+    mDrainScheduled = true;
+}
+
+void AsyncPersistentStorageDelegate::DrainHandler(System::Layer * systemLayer, void * appState)
+{
+    auto * self = static_cast<AsyncPersistentStorageDelegate *>(appState);
+
+    self->mDrainScheduled = false;
+    LogErrorOnFailure(self->DrainOne());
+
+    // One commit per work slice: let the loop service traffic before the next.
+    if (self->mPendingCount > 0)
+    {
+        self->ScheduleDrain();
+    }
+}
+
+} // namespace chip
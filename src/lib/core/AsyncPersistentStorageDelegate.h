@@ -0,0 +1,125 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <system/SystemLayer.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * Asynchronous write-queue decorator over a PersistentStorageDelegate.
+ *
+ * Backends with slow commits (tens of milliseconds on NAND-backed storage)
+ * stall the event loop for the duration of every SyncSetKeyValue() call made
+ * from it.  This decorator acknowledges Set/Delete operations immediately,
+ * queues them in RAM and applies them one per scheduled work slice, so the
+ * loop returns to servicing traffic between backend commits.  Consumers that
+ * take a PersistentStorageDelegate — FabricTable, group data providers,
+ * counters — adopt it by being handed the decorator instead of the backend.
+ *
+ * Reads consult the pending queue first, so callers always observe their own
+ * writes.  Operations that do not fit the queue (oversized values, queue
+ * full) are written through synchronously, preserving ordering.  Because the
+ * backend result is no longer available at the original call site, an
+ * optional completion callback reports each queued operation's key and final
+ * status as it lands.
+ *
+ * Queued writes are lost on power failure until drained; call Flush() on
+ * orderly shutdown.  All methods must be called from the event loop thread.
+ */
+class DLL_EXPORT AsyncPersistentStorageDelegate : public PersistentStorageDelegate
+{
+public:
+    static constexpr size_t kMaxPendingWrites = 8;
+    static constexpr size_t kMaxKeyLength     = 40;  // DefaultStorageKeyAllocator::kKeyLengthMax
+    static constexpr uint16_t kMaxValueSize   = 256; // larger values are written through
+
+    /// Reports the final backend status of a queued operation as it lands.
+    using CommitCompleteCallback = void (*)(const char * key, CHIP_ERROR status, void * context);
+
+    AsyncPersistentStorageDelegate() {}
+
+    /**
+     * Wires the backend and the system layer used to schedule background
+     * drains.  A null system layer disables self-scheduling; the owner must
+     * then drain via DrainOne() or Flush().
+     */
+    CHIP_ERROR Init(PersistentStorageDelegate * backend, System::Layer * systemLayer);
+
+    /// Cancels any scheduled drain and applies all pending writes synchronously.
+    void Shutdown();
+
+    void SetCommitCompleteCallback(CommitCompleteCallback callback, void * context)
+    {
+        mCommitCallback        = callback;
+        mCommitCallbackContext = context;
+    }
+
+    /// Applies all pending writes to the backend synchronously.
+    CHIP_ERROR Flush();
+
+    /// Applies the oldest pending write to the backend. Safe to call when
+    /// nothing is pending.
+    CHIP_ERROR DrainOne();
+
+    bool HasPendingWrites() const { return mPendingCount != 0; }
+    size_t GetPendingWriteCount() const { return mPendingCount; }
+
+    // PersistentStorageDelegate
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override;
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override;
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override;
+    CHIP_ERROR SyncBeginTransaction() override;
+    CHIP_ERROR SyncCommitTransaction() override;
+
+private:
+    struct PendingWrite
+    {
+        char key[kMaxKeyLength + 1];
+        uint16_t valueSize;
+        bool isDelete;
+        uint8_t value[kMaxValueSize];
+    };
+
+    PendingWrite * FindPending(const char * key);
+
+    /// Queues an operation, coalescing repeated writes to the same key, and
+    /// schedules a background drain.
+    CHIP_ERROR Enqueue(const char * key, const void * value, uint16_t size, bool isDelete);
+
+    /// Applies one pending write and reports its status to the commit callback.
+    CHIP_ERROR ApplyOldest();
+
+    void ScheduleDrain();
+    static void DrainHandler(System::Layer * systemLayer, void * appState);
+
+    PersistentStorageDelegate * mBackend   = nullptr;
+    System::Layer * mSystemLayer           = nullptr;
+    CommitCompleteCallback mCommitCallback = nullptr;
+    void * mCommitCallbackContext          = nullptr;
+
+    PendingWrite mPending[kMaxPendingWrites];
+    size_t mPendingCount = 0;
+    bool mDrainScheduled = false;
+};
+
+} // namespace chip
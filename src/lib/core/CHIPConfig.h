@@ -510,6 +510,23 @@
 #define CHIP_CONFIG_MEMORY_DEBUG_DMALLOC 0
 #endif // CHIP_CONFIG_MEMORY_DEBUG_DMALLOC
 
+/**
+ *  @def CHIP_CONFIG_MEMORY_ACCOUNTING
+ *
+ *  @brief
+ *    Enable (1) or disable (0) per-subsystem accounting of heap
+ *    allocations made through the MemoryAllocTagged() family. When
+ *    enabled, each tagged allocation carries a small header so live
+ *    bytes, block counts, high watermarks, and an allocation-size
+ *    histogram are tracked per tag; see MemoryGetTagStatistics() and
+ *    MemoryDumpTagStatistics(). When disabled, the tagged functions
+ *    compile down to the plain allocation functions with no overhead.
+ *
+ */
+#ifndef CHIP_CONFIG_MEMORY_ACCOUNTING
+#define CHIP_CONFIG_MEMORY_ACCOUNTING 0
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
+
 /**
  *  @name chip Security Manager Time-Consuming Crypto Alerts.
  *
@@ -1025,6 +1042,125 @@
 #define CHIP_CONFIG_MAX_INCOMING_TCP_CON_FROM_SINGLE_IP 2
 #endif // CHIP_CONFIG_MAX_INCOMING_TCP_CON_FROM_SINGLE_IP
 
+/**
+ *  @def CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK_BYTES
+ *
+ *  @brief
+ *    Maximum number of unsent bytes allowed to accumulate in the send
+ *    queue of a single TCP connection.
+ *
+ *    Once a connection's queue exceeds this watermark, further sends to
+ *    that peer fail with #CHIP_ERROR_SENDING_BLOCKED until the peer
+ *    drains the queue, so one stalled connection cannot exhaust the
+ *    shared packet buffer pool.
+ */
+#ifndef CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK_BYTES
+#define CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK_BYTES 8192
+#endif // CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK_BYTES
+
+/**
+ *  @def CHIP_CONFIG_TCP_COALESCE_THRESHOLD_BYTES
+ *
+ *  @brief
+ *    Messages of at most this size are queued rather than pushed when a
+ *    TCP connection already has unsent data, letting them ride in the
+ *    same segment as the queued bytes instead of going out one send()
+ *    each. Set to 0 to always push immediately.
+ */
+#ifndef CHIP_CONFIG_TCP_COALESCE_THRESHOLD_BYTES
+#define CHIP_CONFIG_TCP_COALESCE_THRESHOLD_BYTES 128
+#endif // CHIP_CONFIG_TCP_COALESCE_THRESHOLD_BYTES
+
+/**
+ *  @def CHIP_CONFIG_TCP_KEEPALIVE_INTERVAL_SECS
+ *
+ *  @brief
+ *    Interval, in seconds, between TCP keep-alive probes on idle CHIP
+ *    connections.
+ *
+ *    Keep-alive probes detect peers that disappeared without closing the
+ *    connection, so a dead connection is torn down within
+ *    #CHIP_CONFIG_TCP_KEEPALIVE_TIMEOUT_COUNT probe intervals instead of
+ *    stalling the next send.  Set to 0 to disable keep-alive.
+ */
+#ifndef CHIP_CONFIG_TCP_KEEPALIVE_INTERVAL_SECS
+#define CHIP_CONFIG_TCP_KEEPALIVE_INTERVAL_SECS 30
+#endif // CHIP_CONFIG_TCP_KEEPALIVE_INTERVAL_SECS
+
+/**
+ *  @def CHIP_CONFIG_TCP_KEEPALIVE_TIMEOUT_COUNT
+ *
+ *  @brief
+ *    Number of unanswered TCP keep-alive probes after which a connection
+ *    is considered dead and aborted.
+ */
+#ifndef CHIP_CONFIG_TCP_KEEPALIVE_TIMEOUT_COUNT
+#define CHIP_CONFIG_TCP_KEEPALIVE_TIMEOUT_COUNT 3
+#endif // CHIP_CONFIG_TCP_KEEPALIVE_TIMEOUT_COUNT
+
+/**
+ *  @def CHIP_CONFIG_GROUP_SEND_INTER_PACKET_GAP_MS
+ *
+ *  @brief
+ *    Minimum gap, in milliseconds, between paced group/multicast datagrams
+ *    once a fan-out exceeds #CHIP_CONFIG_GROUP_SEND_BURST_SIZE back-to-back
+ *    sends.  Pacing keeps large group fan-outs (e.g. scenes spanning many
+ *    groups) from overflowing access point queues.  0 disables pacing and
+ *    sends every datagram immediately.
+ */
+#ifndef CHIP_CONFIG_GROUP_SEND_INTER_PACKET_GAP_MS
+#define CHIP_CONFIG_GROUP_SEND_INTER_PACKET_GAP_MS 5
+#endif // CHIP_CONFIG_GROUP_SEND_INTER_PACKET_GAP_MS
+
+/**
+ *  @def CHIP_CONFIG_GROUP_SEND_BURST_SIZE
+ *
+ *  @brief
+ *    Number of group datagrams that may be sent back-to-back before pacing
+ *    defers further sends by #CHIP_CONFIG_GROUP_SEND_INTER_PACKET_GAP_MS.
+ *    The budget refills once the sender has been idle for one gap interval.
+ */
+#ifndef CHIP_CONFIG_GROUP_SEND_BURST_SIZE
+#define CHIP_CONFIG_GROUP_SEND_BURST_SIZE 8
+#endif // CHIP_CONFIG_GROUP_SEND_BURST_SIZE
+
+/**
+ *  @def CHIP_CONFIG_GROUP_SEND_QUEUE_SIZE
+ *
+ *  @brief
+ *    Number of group datagrams that can be queued awaiting a paced send.
+ *    Sends beyond the queue capacity fail with CHIP_ERROR_SENDING_BLOCKED.
+ */
+#ifndef CHIP_CONFIG_GROUP_SEND_QUEUE_SIZE
+#define CHIP_CONFIG_GROUP_SEND_QUEUE_SIZE 16
+#endif // CHIP_CONFIG_GROUP_SEND_QUEUE_SIZE
+
+/**
+ *  @def CHIP_CONFIG_ATTRIBUTE_WRITE_COALESCING_POOL_SIZE
+ *
+ *  @brief
+ *    Number of per-attribute last-value slots available to coalesced attribute
+ *    writes (emberAfWriteServerAttributeCoalesced).  Writes to attributes beyond
+ *    this many distinct paths fall back to immediate writes.  0 removes the
+ *    coalescing layer entirely and makes coalesced writes immediate.
+ */
+#ifndef CHIP_CONFIG_ATTRIBUTE_WRITE_COALESCING_POOL_SIZE
+#define CHIP_CONFIG_ATTRIBUTE_WRITE_COALESCING_POOL_SIZE 16
+#endif // CHIP_CONFIG_ATTRIBUTE_WRITE_COALESCING_POOL_SIZE
+
+/**
+ *  @def CHIP_CONFIG_ATTRIBUTE_WRITE_COALESCING_FLUSH_INTERVAL_MS
+ *
+ *  @brief
+ *    Interval, in milliseconds, at which pending coalesced attribute writes are
+ *    flushed to the attribute store and the reporting engine.  Bounds the
+ *    staleness a coalesced write can introduce; attributes matched by an active
+ *    subscription with a zero minimum interval are never coalesced.
+ */
+#ifndef CHIP_CONFIG_ATTRIBUTE_WRITE_COALESCING_FLUSH_INTERVAL_MS
+#define CHIP_CONFIG_ATTRIBUTE_WRITE_COALESCING_FLUSH_INTERVAL_MS 50
+#endif // CHIP_CONFIG_ATTRIBUTE_WRITE_COALESCING_FLUSH_INTERVAL_MS
+
 /**
  *  @def CHIP_CONFIG_MAX_SESSION_KEYS
  *
@@ -1226,6 +1362,24 @@
 #define CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS 16
 #endif // CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
 
+/**
+ *  @def CHIP_CONFIG_EXCHANGE_CONTEXT_RECYCLE_POOL_SIZE
+ *
+ *  @brief
+ *    Maximum number of completed exchange contexts the ExchangeManager parks
+ *    for reuse by later exchanges on the same session.
+ *
+ *    Recycled contexts keep their session registration and message dispatch
+ *    warm, making repeated request/response interactions on a busy session
+ *    allocation-free.  Parked contexts occupy slots in the exchange context
+ *    pool, but are reclaimed on demand if the pool would otherwise run out.
+ *    Set to 0 to disable recycling.
+ *
+ */
+#ifndef CHIP_CONFIG_EXCHANGE_CONTEXT_RECYCLE_POOL_SIZE
+#define CHIP_CONFIG_EXCHANGE_CONTEXT_RECYCLE_POOL_SIZE 4
+#endif // CHIP_CONFIG_EXCHANGE_CONTEXT_RECYCLE_POOL_SIZE
+
 /**
  *  @def CHIP_CONFIG_MAX_ACTIVE_CHANNELS
  *
@@ -1274,9 +1428,16 @@
  *  @brief
  *    Max number of messages behind message window can be accepted.
  *
+ *  @note
+ *    This bounds how far a legitimate message may be reordered behind the
+ *    newest counter seen before it is dropped and must be retransmitted by
+ *    MRP. On lossy links (e.g. Wi-Fi under contention) a small window causes
+ *    spurious retransmits, so the default is sized generously; the cost is
+ *    one bit of RAM per window slot for each peer counter. Constrained
+ *    platforms may override this with a smaller value.
  */
 #ifndef CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE
-#define CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE 32
+#define CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE 256
 #endif // CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE
 
 /**
@@ -1910,6 +2071,150 @@
 #define CHIP_CONFIG_MSG_COUNTER_SYNC_RESP_TIMEOUT 2000
 #endif // CHIP_CONFIG_MSG_COUNTER_SYNC_RESP_TIMEOUT
 
+/**
+ *  @def CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE
+ *
+ *  @brief
+ *    If asserted (1), the secure message codec records every encrypted and
+ *    decrypted message into a runtime ring buffer for latency attribution.
+ *    See chip::trace::MessageTraceBuffer.
+ *
+ */
+#ifndef CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE
+#define CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE 0
+#endif // CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE
+
+/**
+ *  @def CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE_SIZE
+ *
+ *  @brief
+ *    Number of entries held by the message trace ring buffer when
+ *    CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE is enabled. Once full, the oldest
+ *    entries are overwritten.
+ *
+ */
+#ifndef CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE_SIZE
+#define CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE_SIZE 128
+#endif // CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE_SIZE
+
+/**
+ *  @def CHIP_CONFIG_SESSION_STATS
+ *
+ *  @brief
+ *    If asserted (1), the secure message path maintains cumulative per-session
+ *    and global counters for encrypt/decrypt time and bytes, MIC failures and
+ *    message-counter drops, surfaced via the `session-stats` shell command.
+ *    See chip::Transport::SessionStatCounters.
+ *
+ */
+#ifndef CHIP_CONFIG_SESSION_STATS
+#define CHIP_CONFIG_SESSION_STATS 0
+#endif // CHIP_CONFIG_SESSION_STATS
+
+/**
+ *  @def CHIP_CONFIG_IM_LATENCY_STATS
+ *
+ *  @brief
+ *    If asserted (1), CommandSender and ReadClient timestamp each request at
+ *    the exchange level and record the send-to-response round trip into
+ *    per-peer latency histograms (chip::app::InteractionLatencyStats),
+ *    surfaced via the `im-latency` shell command. Measuring at the exchange
+ *    level includes stack-internal queuing that application-level callback
+ *    timing misses.
+ *
+ */
+#ifndef CHIP_CONFIG_IM_LATENCY_STATS
+#define CHIP_CONFIG_IM_LATENCY_STATS 0
+#endif // CHIP_CONFIG_IM_LATENCY_STATS
+
+/**
+ *  @def CHIP_CONFIG_IM_LATENCY_STATS_MAX_PEERS
+ *
+ *  @brief
+ *    Number of distinct peers that get their own latency histogram when
+ *    CHIP_CONFIG_IM_LATENCY_STATS is enabled. Round trips of later peers are
+ *    folded into the global histogram only.
+ *
+ */
+#ifndef CHIP_CONFIG_IM_LATENCY_STATS_MAX_PEERS
+#define CHIP_CONFIG_IM_LATENCY_STATS_MAX_PEERS 8
+#endif // CHIP_CONFIG_IM_LATENCY_STATS_MAX_PEERS
+
+/**
+ *  @def CHIP_CONFIG_IM_MAX_INCOMING_TLV_DEPTH
+ *
+ *  @brief
+ *    Maximum TLV container nesting accepted in incoming Interaction Model
+ *    payloads.  Payloads that fail a single-pass well-formedness check, or
+ *    that nest deeper than this, are rejected at ingress before any handler
+ *    object is allocated (see TLV::Utilities::Validate()).
+ *
+ */
+#ifndef CHIP_CONFIG_IM_MAX_INCOMING_TLV_DEPTH
+#define CHIP_CONFIG_IM_MAX_INCOMING_TLV_DEPTH 16
+#endif // CHIP_CONFIG_IM_MAX_INCOMING_TLV_DEPTH
+
+/**
+ *  @def CHIP_CONFIG_IM_WRITE_CHUNK_ACK_WINDOW
+ *
+ *  @brief
+ *    Number of chunked WriteRequest messages a WriteHandler absorbs before
+ *    acknowledging progress with a StatusResponse.  Intermediate chunks within
+ *    the window get no application-level reply (reliable messaging still
+ *    acknowledges them), so a bulk write spanning many chunks costs one round
+ *    trip per window instead of one per chunk.
+ *
+ */
+#ifndef CHIP_CONFIG_IM_WRITE_CHUNK_ACK_WINDOW
+#define CHIP_CONFIG_IM_WRITE_CHUNK_ACK_WINDOW 8
+#endif // CHIP_CONFIG_IM_WRITE_CHUNK_ACK_WINDOW
+
+/**
+ *  @def CHIP_CONFIG_TRANSPORT_RX_QUEUE
+ *
+ *  @brief
+ *    If asserted (1), TransportMgrBase accepts received messages from
+ *    dedicated transport RX threads through a lock-free queue
+ *    (TransportMgrBase::HandleMessageReceivedFromThread). Decryption and
+ *    dispatch still run on the CHIP event loop, which is the only thread
+ *    allowed to touch session state; the RX thread is limited to socket
+ *    reads and buffer handoff.
+ *
+ */
+#ifndef CHIP_CONFIG_TRANSPORT_RX_QUEUE
+#define CHIP_CONFIG_TRANSPORT_RX_QUEUE 0
+#endif // CHIP_CONFIG_TRANSPORT_RX_QUEUE
+
+/**
+ *  @def CHIP_CONFIG_TRANSPORT_RX_QUEUE_SIZE
+ *
+ *  @brief
+ *    Capacity of the cross-thread transport receive queue when
+ *    CHIP_CONFIG_TRANSPORT_RX_QUEUE is enabled. Must be a power of two.
+ *    Messages arriving while the queue is full are dropped, as they would
+ *    be by a full socket receive buffer.
+ *
+ */
+#ifndef CHIP_CONFIG_TRANSPORT_RX_QUEUE_SIZE
+#define CHIP_CONFIG_TRANSPORT_RX_QUEUE_SIZE 64
+#endif // CHIP_CONFIG_TRANSPORT_RX_QUEUE_SIZE
+
+/**
+ *  @def CHIP_CONFIG_TRANSPORT_SEND_BATCH_SIZE
+ *
+ *  @brief
+ *    Maximum number of outgoing messages gathered inside a TransportMgrBase
+ *    send batch window (TransportMgrBase::BeginSendBatch /
+ *    TransportMgrBase::EndSendBatch) before they are handed to the transport
+ *    as one batch. On platforms with a batched socket send path this turns a
+ *    fan-out burst of N small messages into a single system call. If 0, send
+ *    batch windows are no-ops and every message is sent immediately.
+ *
+ */
+#ifndef CHIP_CONFIG_TRANSPORT_SEND_BATCH_SIZE
+#define CHIP_CONFIG_TRANSPORT_SEND_BATCH_SIZE 0
+#endif // CHIP_CONFIG_TRANSPORT_SEND_BATCH_SIZE
+
 /**
  *  @def CHIP_CONFIG_TEST
  *
@@ -2177,9 +2482,13 @@
  *  @brief
  *    The group key message counter persisted storage epoch.
  *
+ *  Each persisted reservation covers this many counter values; unused values
+ *  are skipped after a restart.  A large stride keeps reservation writes rare
+ *  at the cost of burning through the 32-bit counter space faster on
+ *  frequent reboots.
  */
 #ifndef CHIP_CONFIG_PERSISTED_STORAGE_ENC_MSG_CNTR_EPOCH
-#define CHIP_CONFIG_PERSISTED_STORAGE_ENC_MSG_CNTR_EPOCH 0x1000
+#define CHIP_CONFIG_PERSISTED_STORAGE_ENC_MSG_CNTR_EPOCH 0x10000
 #endif // CHIP_CONFIG_PERSISTED_STORAGE_ENC_MSG_CNTR_EPOCH
 
 /**
@@ -2240,6 +2549,17 @@
 #define CHIP_CONFIG_ENABLE_ARG_PARSER_SANTIY_CHECK 1
 #endif
 
+/**
+ * @def CHIP_CONFIG_ARG_PARSER_MAX_STACK_OPTIONS
+ *
+ * @brief Number of option definitions the argument parser handles without heap
+ *        allocation.  The getopt() tables for up to this many options are built
+ *        in stack buffers; larger option sets fall back to the heap.
+ */
+#ifndef CHIP_CONFIG_ARG_PARSER_MAX_STACK_OPTIONS
+#define CHIP_CONFIG_ARG_PARSER_MAX_STACK_OPTIONS 64
+#endif
+
 /**
  * @def CHIP_CONFIG_SERVICE_PROV_RESPONSE_TIMEOUT
  *
@@ -2414,6 +2734,35 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #ifndef CHIP_CONFIG_MDNS_CACHE_SIZE
 #define CHIP_CONFIG_MDNS_CACHE_SIZE 20
 #endif
+
+/**
+ * @def CHIP_CONFIG_CASE_WARM_POOL_SIZE
+ *
+ * @brief
+ *      Maximum number of peers a controller may declare in its CASE warm pool
+ *      working set (see CASESessionManager::SetWarmPeerSet).
+ *
+ *      Warm peers have their CASE sessions established in the background and
+ *      re-established when they drop, so that the first command to such a peer
+ *      does not pay handshake latency.  Each warm peer occupies an entry in the
+ *      operational device proxy pool while its session is up.
+ */
+#ifndef CHIP_CONFIG_CASE_WARM_POOL_SIZE
+#define CHIP_CONFIG_CASE_WARM_POOL_SIZE 8
+#endif
+
+/**
+ *  @def CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_ENTRIES
+ *
+ *  @brief
+ *    Defines the number of serialized mDNS replies the minimal mDNS ResponseSender keeps so
+ *    that repeat unicast queries can be answered from a prebuilt packet instead of rebuilding
+ *    the reply from the query responder records.  Each entry holds one reply packet (up to
+ *    512 bytes).  Zero (the default) disables the cache.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_ENTRIES
+#define CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_ENTRIES 0
+#endif
 /**
  *  @name Interaction Model object pool configuration.
  *
@@ -2450,6 +2799,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_NUM_READ_HANDLER 4
 #endif
 
+/**
+ * @def CHIP_IM_MAX_NUM_SUBSCRIPTIONS_PER_FABRIC
+ *
+ * @brief Defines the maximum number of concurrent subscriptions a single fabric may hold.
+ *        A fabric at its quota sheds its own cheapest-to-lose subscription to admit a new
+ *        one, so one misbehaving controller cannot exhaust the ReadHandler pool for the
+ *        other fabrics on a multi-admin device. 0 disables the quota.
+ */
+#ifndef CHIP_IM_MAX_NUM_SUBSCRIPTIONS_PER_FABRIC
+#define CHIP_IM_MAX_NUM_SUBSCRIPTIONS_PER_FABRIC 0
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_READ_CLIENT
  *
@@ -2468,6 +2829,58 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_REPORTS_IN_FLIGHT 4
 #endif
 
+/**
+ * @def CHIP_IM_MAX_NUM_CAPTURED_ATTRIBUTE_VALUES
+ *
+ * @brief Defines the number of pooled entries holding attribute values captured at change
+ *        time, so that report generation can encode externally stored attributes from the
+ *        value the change callback supplied instead of re-invoking the application's read
+ *        callback.  Only fixed-size scalar values are captured.  0 disables value capture.
+ */
+#ifndef CHIP_IM_MAX_NUM_CAPTURED_ATTRIBUTE_VALUES
+#define CHIP_IM_MAX_NUM_CAPTURED_ATTRIBUTE_VALUES 8
+#endif
+
+/**
+ * @def CHIP_IM_DEFAULT_REPORT_COALESCING_WINDOW_MS
+ *
+ * @brief Defines the default report coalescing window, in milliseconds, applied to subscription
+ *        reports.  When non-zero, the report triggered by a dirty attribute is held back for this
+ *        long so that other attributes dirtied in the meantime are delivered in the same ReportData
+ *        message rather than one message each.  Zero disables coalescing.
+ */
+#ifndef CHIP_IM_DEFAULT_REPORT_COALESCING_WINDOW_MS
+#define CHIP_IM_DEFAULT_REPORT_COALESCING_WINDOW_MS 0
+#endif
+
+/**
+ * @def CHIP_IM_REPORT_RUN_BUDGET_MS
+ *
+ * @brief Defines the time budget, in milliseconds, for a single pass of the reporting engine's
+ *        run loop.  When building reports for the reportable handlers exceeds the budget, the
+ *        remaining handlers are deferred to a freshly scheduled pass so that report generation
+ *        does not monopolize the event loop at the expense of other queued work (e.g. inbound
+ *        commands).  Zero removes the bound.
+ */
+#ifndef CHIP_IM_REPORT_RUN_BUDGET_MS
+#define CHIP_IM_REPORT_RUN_BUDGET_MS 2
+#endif
+
+/**
+ * @def CHIP_IM_REPORT_SCHEDULING_QUANTUM_BYTES
+ *
+ * @brief Defines the per-handler byte quantum for deficit round-robin report scheduling.
+ *        A read handler only builds reports while its byte credit is positive; every report
+ *        sent is charged against the sending handler's credit, and credit is replenished
+ *        once each handler with remaining credit has had its turn.  This lets a small
+ *        subscription report ahead of a large wildcard read that has already used its share
+ *        of a pass, bounding cross-subscription latency interference.  Zero disables the
+ *        accounting and restores plain round-robin.
+ */
+#ifndef CHIP_IM_REPORT_SCHEDULING_QUANTUM_BYTES
+#define CHIP_IM_REPORT_SCHEDULING_QUANTUM_BYTES 2048
+#endif
+
 /**
  * @def CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS
  *
@@ -2477,6 +2890,29 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS 8
 #endif
 
+/**
+ * @def CHIP_IM_ATTRIBUTE_PATH_EXPANSION_CACHE_ENTRIES
+ *
+ * @brief Defines the number of wildcard attribute paths whose expanded path list is cached between
+ *        report generation passes.  Each cached expansion is reused until the endpoint/cluster
+ *        metadata changes (e.g. a dynamic endpoint is added or removed), turning repeated wildcard
+ *        expansion into an array walk.  Zero (the default) disables the cache; bridges serving
+ *        wildcard subscriptions over many dynamic endpoints benefit the most from enabling it.
+ */
+#ifndef CHIP_IM_ATTRIBUTE_PATH_EXPANSION_CACHE_ENTRIES
+#define CHIP_IM_ATTRIBUTE_PATH_EXPANSION_CACHE_ENTRIES 0
+#endif
+
+/**
+ * @def CHIP_IM_ATTRIBUTE_PATH_EXPANSION_CACHE_PATHS_PER_ENTRY
+ *
+ * @brief Defines the maximum number of concrete paths a single cached wildcard expansion may hold.
+ *        Wildcard paths that expand to more concrete paths than this are expanded live as before.
+ */
+#ifndef CHIP_IM_ATTRIBUTE_PATH_EXPANSION_CACHE_PATHS_PER_ENTRY
+#define CHIP_IM_ATTRIBUTE_PATH_EXPANSION_CACHE_PATHS_PER_ENTRY 128
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -2770,6 +3206,23 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD 512
 #endif /* CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD */
 
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_CLUSTER_INDEX_SIZE
+ *
+ * @brief The number of (endpoint, cluster) pairs the event log tracks
+ *   event number ranges for.
+ *
+ * The index lets EventManagement::FetchEventsSince() prove that no event a
+ * subscriber is interested in has been logged at or past its starting event
+ * number, skipping the TLV walk of the log entirely.  If a device logs
+ * events from more distinct (endpoint, cluster) pairs than this, the index
+ * disables itself and every fetch falls back to a full scan.  Set to 0 to
+ * disable the index.
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_CLUSTER_INDEX_SIZE
+#define CHIP_CONFIG_EVENT_LOGGING_CLUSTER_INDEX_SIZE 8
+#endif /* CHIP_CONFIG_EVENT_LOGGING_CLUSTER_INDEX_SIZE */
+
 /**
  * @def CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
  *
@@ -2778,6 +3231,101 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #ifndef CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
 #define CHIP_CONFIG_ENABLE_SERVER_IM_EVENT 1
 #endif
+
+/**
+ * @def CHIP_CONFIG_DEVICE_ATTESTATION_WORKER_POOL_SIZE
+ *
+ * @brief Number of worker threads used to run device attestation chain
+ *   validation off the Matter event loop during commissioning.
+ *
+ * When zero (the default), attestation verification runs synchronously on
+ * the event loop, which keeps constrained platforms free of any threading
+ * requirement. Commissioners that onboard devices in bulk can set this to a
+ * small positive value to keep the event loop responsive while certificate
+ * chains are validated; results are posted back to the Matter thread via
+ * PlatformManager::ScheduleWork.
+ */
+#ifndef CHIP_CONFIG_DEVICE_ATTESTATION_WORKER_POOL_SIZE
+#define CHIP_CONFIG_DEVICE_ATTESTATION_WORKER_POOL_SIZE 0
+#endif // CHIP_CONFIG_DEVICE_ATTESTATION_WORKER_POOL_SIZE
+
+/**
+ * @def CHIP_CONFIG_DEFERRED_LOGGING
+ *
+ * @brief Enable deferred log emission on a background thread.
+ *
+ * When enabled and activated with chip::Logging::SetDeferredLogging(true),
+ * log messages are formatted into a fixed lock-free ring on the calling
+ * thread and handed to a background thread that performs the actual
+ * emission (platform backend or redirect callback, with their timestamping,
+ * stream locking and write syscalls), keeping that work off the event loop.
+ * When the ring fills, detail-category messages are shed first and error
+ * messages fall back to synchronous emission so they are never lost.
+ *
+ * Disabled by default: it adds a threading requirement and the ring's
+ * static footprint, neither of which is appropriate for constrained
+ * platforms.
+ */
+#ifndef CHIP_CONFIG_DEFERRED_LOGGING
+#define CHIP_CONFIG_DEFERRED_LOGGING 0
+#endif // CHIP_CONFIG_DEFERRED_LOGGING
+
+/**
+ * @def CHIP_CONFIG_DEFERRED_LOGGING_QUEUE_SIZE
+ *
+ * @brief Capacity (a power of two) of the deferred logging ring.
+ */
+#ifndef CHIP_CONFIG_DEFERRED_LOGGING_QUEUE_SIZE
+#define CHIP_CONFIG_DEFERRED_LOGGING_QUEUE_SIZE 256
+#endif // CHIP_CONFIG_DEFERRED_LOGGING_QUEUE_SIZE
+
+/**
+ * @def CHIP_CONFIG_DEFERRED_LOGGING_MESSAGE_SIZE
+ *
+ * @brief Maximum formatted message length (including NUL) captured per
+ *   deferred log entry; longer messages are truncated.
+ */
+#ifndef CHIP_CONFIG_DEFERRED_LOGGING_MESSAGE_SIZE
+#define CHIP_CONFIG_DEFERRED_LOGGING_MESSAGE_SIZE 160
+#endif // CHIP_CONFIG_DEFERRED_LOGGING_MESSAGE_SIZE
+
+/**
+ * @def CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_MAX_PER_WINDOW
+ *
+ * @brief Maximum number of unsolicited session establishment messages (PASE
+ *   PBKDFParamRequest, CASE Sigma1) accepted from a single source IP address
+ *   within one rate limit window.
+ *
+ * Messages beyond the budget are dropped before any handshake state is
+ * allocated, so a handshake flood from a LAN scanner or misbehaving
+ * controller cannot exhaust session establishment resources.  Set to 0 to
+ * disable rate limiting entirely.
+ */
+#ifndef CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_MAX_PER_WINDOW
+#define CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_MAX_PER_WINDOW 6
+#endif // CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_MAX_PER_WINDOW
+
+/**
+ * @def CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_WINDOW_MS
+ *
+ * @brief Length, in milliseconds, of the fixed window over which
+ *   CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_MAX_PER_WINDOW is applied.
+ */
+#ifndef CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_WINDOW_MS
+#define CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_WINDOW_MS 10000
+#endif // CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_WINDOW_MS
+
+/**
+ * @def CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_SOURCES
+ *
+ * @brief Number of distinct source IP addresses the session establishment
+ *   rate limiter tracks concurrently.  When the table is full, the entry
+ *   with the oldest window is recycled.
+ */
+#ifndef CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_SOURCES
+#define CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_SOURCES 4
+#endif // CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_SOURCES
+
 /**
  * @}
  */
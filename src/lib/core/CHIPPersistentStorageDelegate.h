@@ -65,6 +65,26 @@ public:
      * @param[in] key Key to be deleted
      */
     virtual CHIP_ERROR SyncDeleteKeyValue(const char * key) = 0;
+
+    /**
+     * @brief
+     *   Hints that a batch of related writes is starting. Backends that commit
+     *   each write individually (e.g. flash page programming) may buffer
+     *   Set/Delete operations issued between this call and the matching
+     *   SyncCommitTransaction() and flush them as a single commit.
+     *
+     *   Begin/Commit pairs may nest; implementations must tolerate nesting and
+     *   only flush when the outermost transaction commits. The default
+     *   implementation is a no-op, which preserves write-through behavior.
+     */
+    virtual CHIP_ERROR SyncBeginTransaction() { return CHIP_NO_ERROR; }
+
+    /**
+     * @brief
+     *   Ends a batch of related writes started with SyncBeginTransaction(),
+     *   flushing any buffered operations to storage.
+     */
+    virtual CHIP_ERROR SyncCommitTransaction() { return CHIP_NO_ERROR; }
 };
 
 } // namespace chip
@@ -647,6 +647,34 @@ public:
      */
     CHIP_ERROR GetDataPtr(const uint8_t *& data);
 
+    /**
+     * Get the value of the current byte or UTF8 string element as a set of spans over the
+     * underlying input buffers, without copying the data.
+     *
+     * Unlike GetDataPtr(), this method succeeds when the string value straddles multiple
+     * discontiguous buffers (e.g. a chain of packet buffers): each contiguous segment of the
+     * value is returned as one entry in the caller-provided span array.  The spans point
+     * directly into the underlying buffers and remain valid only as long as the configured
+     * TLVBackingStore keeps those buffers alive.
+     *
+     * On success the reader is advanced past the string value, as if GetBytes() had been called.
+     *
+     * @param[out]    spans                 Caller-provided array to receive the value segments.
+     * @param[in]     maxSpans              The capacity of @p spans.
+     * @param[out]    spanCount             The number of entries of @p spans populated on success.
+     *
+     * @retval #CHIP_NO_ERROR              If the method succeeded.
+     * @retval #CHIP_ERROR_WRONG_TLV_TYPE  If the current element is not a TLV byte or UTF8 string, or the
+     *                                      reader is not positioned on an element.
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL
+     *                                      If the value spans more than @p maxSpans contiguous segments.
+     * @retval #CHIP_ERROR_TLV_UNDERRUN    If the underlying TLV encoding ended prematurely.
+     * @retval other                        Other CHIP or platform error codes returned by the configured
+     *                                      TLVBackingStore.
+     *
+     */
+    CHIP_ERROR GetByteSpans(ByteSpan * spans, size_t maxSpans, size_t & spanCount);
+
     /**
      * Prepares a TLVReader object for reading the members of TLV container element.
      *
@@ -883,6 +911,27 @@ public:
      */
     CHIP_ERROR FindElementWithTag(Tag tagInApiForm, TLVReader & destReader) const;
 
+    /**
+     * Advance this reader to the next element with the given tag within the current container context.
+     *
+     * Unlike iterating Next() and inspecting GetTag(), intervening container elements are skipped in a
+     * single pass that only examines element heads and tracks nesting depth, rather than entering and
+     * exiting each container in turn.  This is the preferred way to locate a known field in a large
+     * structure when the intervening elements are of no interest.
+     *
+     * On success the reader is positioned on the located element.  If no matching element is found the
+     * reader is positioned at the end of the current container (or the end of the underlying buffer
+     * when no container is open).
+     *
+     * @param[in] tag                      The tag of the element to locate.
+     *
+     * @retval #CHIP_NO_ERROR              If the reader was successfully positioned on a matching element.
+     * @retval #CHIP_END_OF_TLV            If no matching element was found.
+     * @retval other                       Other CHIP or platform error codes returned by the configured
+     *                                     TLVBackingStore.
+     */
+    CHIP_ERROR FastSkipToTag(Tag tag);
+
     /**
      * Count how many elements remain in the currently-open container.  Will
      * fail with CHIP_ERROR_INCORRECT_STATE if not currently in a container.
@@ -1131,14 +1180,20 @@ public:
     /**
      * Reserve some buffer for encoding future fields.
      *
+     * The reservation counts against both the space remaining in the current
+     * buffer and the writer's maximum length, so it limits the total encoding
+     * size even when the backing store supplies additional buffers.
+     *
      * @retval #CHIP_NO_ERROR        Successfully reserved required buffer size.
      * @retval #CHIP_ERROR_NO_MEMORY The reserved buffer size cannot fits into the remaining buffer size.
      */
     CHIP_ERROR ReserveBuffer(uint32_t aBufferSize)
     {
         VerifyOrReturnError(mRemainingLen >= aBufferSize, CHIP_ERROR_NO_MEMORY);
+        VerifyOrReturnError(mMaxLen - mLenWritten >= aBufferSize, CHIP_ERROR_NO_MEMORY);
         mReservedSize += aBufferSize;
         mRemainingLen -= aBufferSize;
+        mMaxLen -= aBufferSize;
         return CHIP_NO_ERROR;
     }
 
@@ -1153,6 +1208,7 @@ public:
         VerifyOrReturnError(mReservedSize >= aBufferSize, CHIP_ERROR_NO_MEMORY);
         mReservedSize -= aBufferSize;
         mRemainingLen += aBufferSize;
+        mMaxLen += aBufferSize;
         return CHIP_NO_ERROR;
     }
 
@@ -1990,6 +2046,36 @@ public:
      */
     CHIP_ERROR PutPreEncodedContainer(Tag tag, TLVType containerType, const uint8_t * data, uint32_t dataLen);
 
+    /**
+     * Appends pre-encoded TLV elements to the container currently being written.
+     *
+     * The PutPreEncodedElements() method copies a buffer of zero or more fully-encoded TLV elements
+     * into the output directly, without re-encoding them element by element.  The writer must be
+     * positioned inside an open container (i.e. between matching StartContainer() and EndContainer()
+     * calls), and the supplied elements must carry tags appropriate for that container type.  The
+     * buffer must NOT include an end-of-container marker.
+     *
+     * No validation of the supplied encoding is performed; the caller is responsible for supplying
+     * well-formed elements.
+     *
+     * @param[in]   data            A pointer to a buffer containing zero or more encoded TLV elements.
+     * @param[in]   dataLen         The number of bytes in the @p data buffer.
+     *
+     * @retval #CHIP_NO_ERROR      If the method succeeded.
+     * @retval #CHIP_ERROR_INCORRECT_STATE
+     *                              If the writer is not currently positioned inside a container.
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL
+     *                              If writing the value would exceed the limit on the maximum number of
+     *                              bytes specified when the writer was initialized.
+     * @retval #CHIP_ERROR_NO_MEMORY
+     *                              If an attempt to allocate an output buffer failed due to lack of
+     *                              memory.
+     * @retval other                Other CHIP or platform-specific errors returned by the configured
+     *                              TLVBackingStore.
+     *
+     */
+    CHIP_ERROR PutPreEncodedElements(const uint8_t * data, uint32_t dataLen);
+
     /**
      * Copies a TLV container element from TLVReader object
      *
@@ -0,0 +1,165 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the memory-mapped ring file TLV capture sink.
+ */
+
+#include <lib/core/CHIPTLVCapture.h>
+
+#include <lib/support/CodeUtils.h>
+#include <system/SystemClock.h>
+#include <system/SystemConfig.h>
+
+#include <string.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace chip {
+namespace TLV {
+namespace Debug {
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
+CHIP_ERROR Capture::Open(const char * path, uint32_t capacityBytes)
+{
+    VerifyOrReturnError(path != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!IsOpen(), CHIP_ERROR_INCORRECT_STATE);
+
+    if (capacityBytes < kMinCapacity)
+    {
+        capacityBytes = kMinCapacity;
+    }
+
+    const size_t fileSize = sizeof(FileHeader) + capacityBytes;
+
+    mFd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_POSIX(errno));
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    void * mapping = MAP_FAILED;
+
+    VerifyOrExit(ftruncate(mFd, static_cast<off_t>(fileSize)) == 0, err = CHIP_ERROR_POSIX(errno));
+
+    mapping = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, mFd, 0);
+    VerifyOrExit(mapping != MAP_FAILED, err = CHIP_ERROR_POSIX(errno));
+
+    mHeader   = static_cast<FileHeader *>(mapping);
+    mRing     = reinterpret_cast<uint8_t *>(mHeader + 1);
+    mCapacity = capacityBytes;
+
+    memset(mHeader, 0, sizeof(FileHeader));
+    mHeader->mMagic    = kMagic;
+    mHeader->mVersion  = kVersion;
+    mHeader->mCapacity = capacityBytes;
+
+    return CHIP_NO_ERROR;
+
+exit:
+    close(mFd);
+    mFd = -1;
+    return err;
+}
+
+void Capture::Close()
+{
+    if (mHeader != nullptr)
+    {
+        munmap(mHeader, sizeof(FileHeader) + mCapacity);
+        mHeader = nullptr;
+        mRing   = nullptr;
+    }
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+    mCapacity = 0;
+}
+
+CHIP_ERROR Capture::Record(uint16_t context, const ByteSpan & tlv)
+{
+    VerifyOrReturnError(IsOpen(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(tlv.size() <= UINT32_MAX - sizeof(RecordHeader), CHIP_ERROR_MESSAGE_TOO_LONG);
+
+    const uint32_t total = static_cast<uint32_t>(sizeof(RecordHeader) + tlv.size());
+    if (total > mCapacity)
+    {
+        mHeader->mDropped++;
+        return CHIP_ERROR_MESSAGE_TOO_LONG;
+    }
+
+    RecordHeader record;
+    record.mSync            = kRecordSync;
+    record.mSize            = static_cast<uint32_t>(tlv.size());
+    record.mTimestampMicros = System::SystemClock().GetMonotonicMicroseconds64().count();
+    record.mContext         = context;
+    record.mReserved        = 0;
+
+    PutBytes(reinterpret_cast<const uint8_t *>(&record), sizeof(record));
+    PutBytes(tlv.data(), record.mSize);
+    return CHIP_NO_ERROR;
+}
+
+void Capture::PutBytes(const uint8_t * data, uint32_t size)
+{
+    uint32_t offset = mHeader->mWriteOffset;
+
+    const uint32_t untilEnd = mCapacity - offset;
+    if (size < untilEnd)
+    {
+        memcpy(mRing + offset, data, size);
+        offset += size;
+    }
+    else
+    {
+        memcpy(mRing + offset, data, untilEnd);
+        memcpy(mRing, data + untilEnd, size - untilEnd);
+        offset            = size - untilEnd;
+        mHeader->mWrapped = 1;
+    }
+
+    mHeader->mWriteOffset = offset;
+}
+
+#else // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
+CHIP_ERROR Capture::Open(const char * path, uint32_t capacityBytes)
+{
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+}
+
+void Capture::Close() {}
+
+CHIP_ERROR Capture::Record(uint16_t context, const ByteSpan & tlv)
+{
+    return CHIP_ERROR_INCORRECT_STATE;
+}
+
+void Capture::PutBytes(const uint8_t * data, uint32_t size) {}
+
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
+} // namespace Debug
+} // namespace TLV
+} // namespace chip
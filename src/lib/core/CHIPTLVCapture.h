@@ -0,0 +1,119 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares a high-throughput binary TLV capture sink. Unlike the
+ *      callback-per-element printf dump in CHIPTLVDebug, the hot path here only
+ *      appends the raw TLV span plus a small metadata header to a memory-mapped
+ *      ring file; rendering is done offline (see src/tools/chip-tlv-decode).
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+
+namespace chip {
+namespace TLV {
+namespace Debug {
+
+/**
+ * Appends raw TLV spans to a memory-mapped ring file for offline decoding.
+ *
+ * The file starts with a FileHeader followed by a ring of variable-size records,
+ * each a RecordHeader immediately followed by the raw TLV bytes. The write
+ * cursor lives in the mapped header, so a capture interrupted by a crash is
+ * still parseable up to the last completed record. When the ring wraps, the
+ * oldest records are overwritten.
+ *
+ * Recording is a couple of memcpys into the mapping; the kernel writes pages
+ * back asynchronously. The class is not thread-safe: record from one thread
+ * (normally the event loop).
+ *
+ * Only available on platforms with POSIX file mappings; elsewhere Open()
+ * returns CHIP_ERROR_NOT_IMPLEMENTED.
+ */
+class Capture
+{
+public:
+    static constexpr uint32_t kMagic    = 0x43544C56; // 'CTLV'
+    static constexpr uint16_t kVersion  = 1;
+    static constexpr uint32_t kMinCapacity = 4096;
+
+    struct FileHeader
+    {
+        uint32_t mMagic;
+        uint16_t mVersion;
+        uint16_t mReserved;
+        uint32_t mCapacity;    ///< Size of the record ring (excludes this header).
+        uint32_t mWriteOffset; ///< Next write position within the ring.
+        uint32_t mWrapped;     ///< Nonzero once the ring has wrapped at least once.
+        uint32_t mDropped;     ///< Records larger than the ring, not captured.
+    };
+
+    struct RecordHeader
+    {
+        uint32_t mSync; ///< kRecordSync; lets the decoder resynchronize after a ring wrap.
+        uint32_t mSize; ///< Size of the TLV payload following this header.
+        uint64_t mTimestampMicros;
+        uint16_t mContext; ///< Caller-defined tag (e.g. message type) carried to the decoder.
+        uint16_t mReserved;
+    };
+
+    static constexpr uint32_t kRecordSync = 0x52435244; // 'RCRD'
+
+    Capture() = default;
+    ~Capture() { Close(); }
+
+    Capture(const Capture &) = delete;
+    Capture & operator=(const Capture &) = delete;
+
+    /**
+     * Create (or truncate) the capture file at @a path and map a ring of
+     * @a capacityBytes for records. Capacity is clamped up to kMinCapacity.
+     */
+    CHIP_ERROR Open(const char * path, uint32_t capacityBytes);
+
+    /**
+     * Unmap and close the capture file. Safe to call when not open.
+     */
+    void Close();
+
+    bool IsOpen() const { return mRing != nullptr; }
+
+    /**
+     * Append one TLV span to the ring. @a context is opaque to the capture and
+     * is handed back to the offline decoder alongside the span.
+     */
+    CHIP_ERROR Record(uint16_t context, const ByteSpan & tlv);
+
+private:
+    void PutBytes(const uint8_t * data, uint32_t size);
+
+    FileHeader * mHeader = nullptr;
+    uint8_t * mRing      = nullptr;
+    uint32_t mCapacity   = 0;
+    int mFd              = -1;
+};
+
+} // namespace Debug
+} // namespace TLV
+} // namespace chip
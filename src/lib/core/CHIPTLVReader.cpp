@@ -413,6 +413,46 @@ CHIP_ERROR TLVReader::GetDataPtr(const uint8_t *& data)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TLVReader::GetByteSpans(ByteSpan * spans, size_t maxSpans, size_t & spanCount)
+{
+    CHIP_ERROR err;
+
+    if (!TLVTypeIsString(ElementType()))
+        return CHIP_ERROR_WRONG_TLV_TYPE;
+
+    uint32_t dataLen = static_cast<uint32_t>(mElemLenOrVal);
+
+    spanCount = 0;
+
+    // Walk the value the same way ReadData() does, but hand back a span over each
+    // contiguous segment instead of copying it out.
+    while (dataLen > 0)
+    {
+        err = EnsureData(CHIP_ERROR_TLV_UNDERRUN);
+        if (err != CHIP_NO_ERROR)
+            return err;
+
+        uint32_t remainingLen = static_cast<decltype(mMaxLen)>(mBufEnd - mReadPoint);
+
+        uint32_t segLen = dataLen;
+        if (segLen > remainingLen)
+            segLen = remainingLen;
+
+        if (spanCount == maxSpans)
+            return CHIP_ERROR_BUFFER_TOO_SMALL;
+
+        spans[spanCount++] = ByteSpan(mReadPoint, segLen);
+
+        mReadPoint += segLen;
+        mLenRead += segLen;
+        dataLen -= segLen;
+    }
+
+    mElemLenOrVal = 0;
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR TLVReader::OpenContainer(TLVReader & containerReader)
 {
     TLVElementType elemType = ElementType();
@@ -646,6 +686,48 @@ CHIP_ERROR TLVReader::SkipToEndOfContainer()
     }
 }
 
+CHIP_ERROR TLVReader::FastSkipToTag(Tag tag)
+{
+    CHIP_ERROR err;
+    TLVType outerContainerType = mContainerType;
+    uint32_t nestLevel         = 0;
+
+    // As in SkipToEndOfContainer(), a pending OpenContainer() is implicitly closed
+    // by scanning past the container element.
+    SetContainerOpen(false);
+
+    while (true)
+    {
+        TLVElementType elemType = ElementType();
+
+        if (elemType == TLVElementType::EndOfContainer)
+        {
+            if (nestLevel == 0)
+                return CHIP_END_OF_TLV;
+
+            nestLevel--;
+            mContainerType = (nestLevel == 0) ? outerContainerType : kTLVType_UnknownContainer;
+        }
+
+        else if (TLVTypeIsContainer(elemType))
+        {
+            nestLevel++;
+            mContainerType = static_cast<TLVType>(elemType);
+        }
+
+        err = SkipData();
+        if (err != CHIP_NO_ERROR)
+            return err;
+
+        err = ReadElement();
+        if (err != CHIP_NO_ERROR)
+            return err;
+
+        if (nestLevel == 0 && ElementType() != TLVElementType::EndOfContainer && mElemTag == tag)
+            return CHIP_NO_ERROR;
+    }
+}
+
 CHIP_ERROR TLVReader::ReadElement()
 {
     CHIP_ERROR err;
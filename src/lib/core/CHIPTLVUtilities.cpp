@@ -413,6 +413,64 @@ CHIP_ERROR Find(const TLVReader & aReader, IterateHandler aPredicate, void * aCo
     return retval;
 }
 
+/**
+ *  Verify in a single pass that the TLV encoding referenced by @a aReader is
+ *  well-formed: every element parses, element lengths stay within the
+ *  underlying buffer, every container is terminated, and containers nest no
+ *  deeper than @a aMaxDepth.  Memory use is constant (one reader plus a fixed
+ *  container stack) and no element data is copied or interpreted, making the
+ *  check suitable as an ingress filter ahead of protocol-level parsers.
+ *
+ *  @param[in] aReader     A reference to a TLV reader positioned before the
+ *                         first element to validate.  The reader itself is not
+ *                         advanced.
+ *  @param[in] aMaxDepth   Maximum accepted container nesting, at most
+ *                         #kMaxValidationDepth.
+ *
+ *  @retval  #CHIP_NO_ERROR                     The encoding is well-formed.
+ *
+ *  @retval  #CHIP_ERROR_INVALID_TLV_ELEMENT    Containers nest deeper than @a aMaxDepth.
+ *
+ *  @retval  other                              The error the reader reported for
+ *                                              the first malformed element.
+ *
+ */
+CHIP_ERROR Validate(const TLVReader & aReader, size_t aMaxDepth)
+{
+    TLVReader reader;
+    TLVType containers[kMaxValidationDepth];
+    size_t depth = 0;
+
+    VerifyOrReturnError(aMaxDepth <= kMaxValidationDepth, CHIP_ERROR_INVALID_ARGUMENT);
+
+    reader.Init(aReader);
+
+    while (true)
+    {
+        CHIP_ERROR err = reader.Next();
+
+        if (err == CHIP_END_OF_TLV)
+        {
+            if (depth == 0)
+            {
+                return CHIP_NO_ERROR;
+            }
+
+            ReturnErrorOnFailure(reader.ExitContainer(containers[depth - 1]));
+            depth--;
+            continue;
+        }
+        ReturnErrorOnFailure(err);
+
+        if (TLVTypeIsContainer(reader.GetType()))
+        {
+            VerifyOrReturnError(depth < aMaxDepth, CHIP_ERROR_INVALID_TLV_ELEMENT);
+            ReturnErrorOnFailure(reader.EnterContainer(containers[depth]));
+            depth++;
+        }
+    }
+}
+
 } // namespace Utilities
 
 } // namespace TLV
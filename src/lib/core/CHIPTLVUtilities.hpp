@@ -59,6 +59,14 @@ extern CHIP_ERROR Find(const TLVReader & aReader, const Tag & aTag, TLVReader &
 
 extern CHIP_ERROR Find(const TLVReader & aReader, IterateHandler aHandler, void * aContext, TLVReader & aResult);
 extern CHIP_ERROR Find(const TLVReader & aReader, IterateHandler aHandler, void * aContext, TLVReader & aResult, bool aRecurse);
+
+/**
+ *  The deepest container nesting Validate() can track; aMaxDepth values above
+ *  this are rejected.
+ */
+constexpr size_t kMaxValidationDepth = 32;
+
+extern CHIP_ERROR Validate(const TLVReader & aReader, size_t aMaxDepth);
 } // namespace Utilities
 
 } // namespace TLV
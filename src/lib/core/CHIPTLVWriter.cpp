@@ -74,9 +74,14 @@ CHIP_ERROR TLVWriter::Init(TLVBackingStore & backingStore, uint32_t maxLen)
     if (err != CHIP_NO_ERROR)
         return err;
 
-    mWritePoint    = mBufStart;
-    mLenWritten    = 0;
-    mMaxLen        = maxLen;
+    mWritePoint = mBufStart;
+    mLenWritten = 0;
+    mMaxLen     = maxLen;
+    // Keep the remaining length within the writer's total budget, so a buffer
+    // larger than maxLen cannot be overrun past the budget by writes that are
+    // only bounded by mRemainingLen.
+    if (mRemainingLen > mMaxLen)
+        mRemainingLen = mMaxLen;
     mContainerType = kTLVType_NotSpecified;
     mReservedSize  = 0;
     SetContainerOpen(false);
@@ -569,6 +574,17 @@ CHIP_ERROR TLVWriter::PutPreEncodedContainer(Tag tag, TLVType containerType, con
     return WriteData(data, dataLen);
 }
 
+CHIP_ERROR TLVWriter::PutPreEncodedElements(const uint8_t * data, uint32_t dataLen)
+{
+    if (!TLVTypeIsContainer(mContainerType))
+        return CHIP_ERROR_INCORRECT_STATE;
+
+    if (IsContainerOpen())
+        return CHIP_ERROR_TLV_CONTAINER_OPEN;
+
+    return WriteData(data, dataLen);
+}
+
 CHIP_ERROR TLVWriter::CopyContainer(TLVReader & container)
 {
     return CopyContainer(container.GetTag(), container);
@@ -773,6 +789,12 @@ CHIP_ERROR TLVWriter::WriteData(const uint8_t * p, uint32_t len)
 
             mWritePoint = mBufStart;
 
+            // Carry any outstanding reservation into the new buffer, so writes of
+            // previously reserved data remain guaranteed to succeed without
+            // requiring yet another buffer from the backing store.
+            VerifyOrReturnError(mRemainingLen >= mReservedSize, CHIP_ERROR_NO_MEMORY);
+            mRemainingLen -= mReservedSize;
+
             if (mRemainingLen > (mMaxLen - mLenWritten))
                 mRemainingLen = (mMaxLen - mLenWritten);
         }
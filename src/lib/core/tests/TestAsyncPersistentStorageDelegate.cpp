@@ -0,0 +1,160 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/AsyncPersistentStorageDelegate.h>
+
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+#include <string.h>
+
+using namespace chip;
+
+namespace {
+
+struct CommitRecord
+{
+    size_t count           = 0;
+    CHIP_ERROR lastStatus  = CHIP_NO_ERROR;
+    char lastKey[48]       = {};
+};
+
+void OnCommitComplete(const char * key, CHIP_ERROR status, void * context)
+{
+    auto * record = static_cast<CommitRecord *>(context);
+    record->count++;
+    record->lastStatus = status;
+    strncpy(record->lastKey, key, sizeof(record->lastKey) - 1);
+}
+
+void TestQueueAndDrain(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistentStorageDelegate backend;
+    AsyncPersistentStorageDelegate storage;
+
+    // No system layer: drains are driven manually.
+    NL_TEST_ASSERT(inSuite, storage.Init(&backend, nullptr) == CHIP_NO_ERROR);
+
+    const uint8_t value[] = { 1, 2, 3, 4 };
+    NL_TEST_ASSERT(inSuite, storage.SyncSetKeyValue("k1", value, sizeof(value)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.GetPendingWriteCount() == 1);
+
+    // The write is visible through the decorator but has not reached the backend.
+    uint8_t buffer[8];
+    uint16_t size = sizeof(buffer);
+    NL_TEST_ASSERT(inSuite, storage.SyncGetKeyValue("k1", buffer, size) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, size == sizeof(value) && memcmp(buffer, value, size) == 0);
+    size = sizeof(buffer);
+    NL_TEST_ASSERT(inSuite, backend.SyncGetKeyValue("k1", buffer, size) == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    // Draining lands it in the backend and empties the queue.
+    NL_TEST_ASSERT(inSuite, storage.DrainOne() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !storage.HasPendingWrites());
+    size = sizeof(buffer);
+    NL_TEST_ASSERT(inSuite, backend.SyncGetKeyValue("k1", buffer, size) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, size == sizeof(value) && memcmp(buffer, value, size) == 0);
+}
+
+void TestCoalescingAndDeleteShadow(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistentStorageDelegate backend;
+    AsyncPersistentStorageDelegate storage;
+    NL_TEST_ASSERT(inSuite, storage.Init(&backend, nullptr) == CHIP_NO_ERROR);
+
+    const uint8_t v1[] = { 1 };
+    const uint8_t v2[] = { 2, 2 };
+
+    // Repeated writes to the same key collapse into one pending entry.
+    NL_TEST_ASSERT(inSuite, storage.SyncSetKeyValue("k1", v1, sizeof(v1)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.SyncSetKeyValue("k1", v2, sizeof(v2)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.GetPendingWriteCount() == 1);
+
+    // A pending delete shadows the backend value.
+    NL_TEST_ASSERT(inSuite, backend.SyncSetKeyValue("k2", v1, sizeof(v1)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.SyncDeleteKeyValue("k2") == CHIP_NO_ERROR);
+    uint8_t buffer[8];
+    uint16_t size = sizeof(buffer);
+    NL_TEST_ASSERT(inSuite, storage.SyncGetKeyValue("k2", buffer, size) == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    NL_TEST_ASSERT(inSuite, storage.Flush() == CHIP_NO_ERROR);
+    size = sizeof(buffer);
+    NL_TEST_ASSERT(inSuite, backend.SyncGetKeyValue("k1", buffer, size) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, size == sizeof(v2) && memcmp(buffer, v2, size) == 0);
+    size = sizeof(buffer);
+    NL_TEST_ASSERT(inSuite, backend.SyncGetKeyValue("k2", buffer, size) == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+}
+
+void TestCommitCallback(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistentStorageDelegate backend;
+    AsyncPersistentStorageDelegate storage;
+    NL_TEST_ASSERT(inSuite, storage.Init(&backend, nullptr) == CHIP_NO_ERROR);
+
+    CommitRecord record;
+    storage.SetCommitCompleteCallback(OnCommitComplete, &record);
+
+    const uint8_t value[] = { 7 };
+    NL_TEST_ASSERT(inSuite, storage.SyncSetKeyValue("k1", value, sizeof(value)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, record.count == 0);
+
+    NL_TEST_ASSERT(inSuite, storage.DrainOne() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, record.count == 1);
+    NL_TEST_ASSERT(inSuite, record.lastStatus == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, strcmp(record.lastKey, "k1") == 0);
+}
+
+void TestQueueOverflowWritesThrough(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistentStorageDelegate backend;
+    AsyncPersistentStorageDelegate storage;
+    NL_TEST_ASSERT(inSuite, storage.Init(&backend, nullptr) == CHIP_NO_ERROR);
+
+    char key[8];
+    const uint8_t value[] = { 9 };
+    for (size_t i = 0; i < AsyncPersistentStorageDelegate::kMaxPendingWrites + 1; i++)
+    {
+        snprintf(key, sizeof(key), "k%u", static_cast<unsigned>(i));
+        NL_TEST_ASSERT(inSuite, storage.SyncSetKeyValue(key, value, sizeof(value)) == CHIP_NO_ERROR);
+    }
+
+    // The overflowing write pushed the oldest entry through to the backend.
+    NL_TEST_ASSERT(inSuite, storage.GetPendingWriteCount() == AsyncPersistentStorageDelegate::kMaxPendingWrites);
+    uint8_t buffer[8];
+    uint16_t size = sizeof(buffer);
+    NL_TEST_ASSERT(inSuite, backend.SyncGetKeyValue("k0", buffer, size) == CHIP_NO_ERROR);
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("Queue and drain", TestQueueAndDrain),
+    NL_TEST_DEF("Coalescing and delete shadowing", TestCoalescingAndDeleteShadow),
+    NL_TEST_DEF("Commit completion callback", TestCommitCallback),
+    NL_TEST_DEF("Queue overflow writes through", TestQueueOverflowWritesThrough),
+    NL_TEST_SENTINEL(),
+};
+
+} // namespace
+
+int TestAsyncPersistentStorageDelegate()
+{
+    nlTestSuite theSuite = { "AsyncPersistentStorageDelegate", &sTests[0], nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestAsyncPersistentStorageDelegate)
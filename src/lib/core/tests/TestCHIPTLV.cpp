@@ -2725,6 +2725,44 @@ void CheckCHIPTLVByteSpan(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, memcmp(readerSpan.data(), bytesBuffer, sizeof(bytesBuffer)) == 0);
 }
 
+void CheckCHIPTLVGetByteSpans(nlTestSuite * inSuite, void * inContext)
+{
+    const size_t bufSize  = 14;
+    uint8_t bytesBuffer[] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 };
+    uint8_t backingStore[bufSize];
+    TLVWriter writer;
+    TLVReader reader;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    writer.Init(backingStore);
+
+    err = writer.Put(ProfileTag(TestProfile_1, 1), ByteSpan(bytesBuffer));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // A value contained in a single buffer comes back as exactly one span over that buffer.
+    reader.Init(backingStore, writer.GetLengthWritten());
+    err = reader.Next();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    chip::ByteSpan spans[2];
+    size_t spanCount = 0;
+    err              = reader.GetByteSpans(spans, 2, spanCount);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, spanCount == 1);
+    NL_TEST_ASSERT(inSuite, spans[0].data_equal(ByteSpan(bytesBuffer)));
+
+    // Insufficient span capacity is reported rather than truncated.
+    reader.Init(backingStore, writer.GetLengthWritten());
+    err = reader.Next();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = reader.GetByteSpans(spans, 0, spanCount);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
 void CheckCHIPTLVSkipCircular(nlTestSuite * inSuite, void * inContext)
 {
     const size_t bufsize = 40; // large enough s.t. 2 elements fit, 3rd causes eviction
@@ -2805,6 +2843,81 @@ void CheckBufferOverflow(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+/**
+ *  Test chained-buffer writing with a fixed segment size, a total-length cap
+ *  spanning the chain, reservations carried across segment boundaries, and
+ *  rollback of the writer across a segment boundary.
+ */
+void CheckChainedBufferWriter(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint16_t kSegmentSize = 64;
+    constexpr uint32_t kMaxLen      = 200;
+    constexpr uint32_t kReserve     = 3;
+    CHIP_ERROR err                  = CHIP_NO_ERROR;
+    uint8_t pattern[50];
+
+    for (size_t i = 0; i < sizeof(pattern); i++)
+    {
+        pattern[i] = static_cast<uint8_t>(i);
+    }
+
+    System::PacketBufferHandle buf = System::PacketBufferHandle::New(kSegmentSize, 0);
+    NL_TEST_ASSERT(inSuite, !buf.IsNull());
+
+    System::PacketBufferTLVWriter writer;
+    writer.Init(buf.Retain(), /* useChainedBuffers = */ true, kMaxLen, kSegmentSize);
+
+    NL_TEST_ASSERT(inSuite, writer.ReserveBuffer(kReserve) == CHIP_NO_ERROR);
+
+    // Three 50-byte strings overflow both the first and the second segment.
+    for (int i = 0; i < 3; i++)
+    {
+        err = writer.PutBytes(AnonymousTag, pattern, sizeof(pattern));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+
+    // A fourth write must fail against the total-length cap, even though new
+    // segments could still be chained.  Roll back to discard its element head.
+    {
+        TLVWriter checkpoint = writer;
+        err                  = writer.PutBytes(AnonymousTag, pattern, sizeof(pattern));
+        NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_BUFFER_TOO_SMALL);
+        static_cast<TLVWriter &>(writer) = checkpoint;
+    }
+
+    // The reservation was carried into the current segment, so releasing it
+    // guarantees this small element fits with no further allocation.
+    NL_TEST_ASSERT(inSuite, writer.UnreserveBuffer(kReserve) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(AnonymousTag, static_cast<uint8_t>(7)) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, writer.Finalize(&buf) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, buf->HasChainedBuffer());
+    NL_TEST_ASSERT(inSuite, buf->TotalLength() == 3 * (2 + sizeof(pattern)) + 2);
+
+    // Now verify that rolling a writer back across a segment boundary discards
+    // the data written past the checkpoint.
+    buf = System::PacketBufferHandle::New(kSegmentSize, 0);
+    NL_TEST_ASSERT(inSuite, !buf.IsNull());
+    writer.Init(buf.Retain(), /* useChainedBuffers = */ true, kMaxLen, kSegmentSize);
+
+    err = writer.PutBytes(AnonymousTag, pattern, sizeof(pattern));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    TLVWriter checkpoint = writer;
+
+    // Cross into a second segment, then roll back to the checkpoint.
+    err = writer.PutBytes(AnonymousTag, pattern, sizeof(pattern));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    static_cast<TLVWriter &>(writer) = checkpoint;
+
+    // Write again after the rollback; the previously chained segment is reused.
+    err = writer.PutBytes(AnonymousTag, pattern, sizeof(pattern));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, writer.Finalize(&buf) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, buf->TotalLength() == 2 * (2 + sizeof(pattern)));
+}
+
 /**
  * Test case to verify the correctness of TLVReader::GetTag()
  *
@@ -4339,6 +4452,124 @@ static void CheckCHIPTLVScopedBuffer(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+static void CheckFastSkipToTag(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buf[256];
+    TLVWriter writer;
+    TLVReader reader;
+    TLVType outerContainer;
+    CHIP_ERROR err;
+    uint32_t val;
+
+    writer.Init(buf);
+
+    err = writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainer);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.Put(ContextTag(1), static_cast<uint32_t>(1));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // An intervening container whose members must be scanned over, including one
+    // carrying the tag we will later be searching for.
+    TLVType innerContainer;
+    err = writer.StartContainer(ContextTag(2), kTLVType_Structure, innerContainer);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Put(ContextTag(7), static_cast<uint32_t>(99));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.EndContainer(innerContainer);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.Put(ContextTag(7), static_cast<uint32_t>(42));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.EndContainer(outerContainer);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    reader.Init(buf, writer.GetLengthWritten());
+
+    err = reader.Next(kTLVType_Structure, AnonymousTag);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = reader.EnterContainer(outerContainer);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // The matching element inside the nested container must not be returned;
+    // only the sibling at the current nesting level matches.
+    err = reader.FastSkipToTag(ContextTag(7));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.GetTag() == ContextTag(7));
+
+    err = reader.Get(val);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, val == 42);
+
+    // No further matching sibling exists.
+    err = reader.FastSkipToTag(ContextTag(7));
+    NL_TEST_ASSERT(inSuite, err == CHIP_END_OF_TLV);
+
+    err = reader.ExitContainer(outerContainer);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+}
+
+static void CheckValidate(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buf[256];
+    TLVWriter writer;
+    TLVReader reader;
+    CHIP_ERROR err;
+
+    // A well-formed nested encoding validates at a depth limit that accommodates it.
+    writer.Init(buf);
+    {
+        TLVType outerContainer, innerContainer;
+        err = writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainer);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.Put(ContextTag(1), static_cast<uint32_t>(1));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.StartContainer(ContextTag(2), kTLVType_Array, innerContainer);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.PutString(AnonymousTag, "hello");
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.EndContainer(innerContainer);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.EndContainer(outerContainer);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.Finalize();
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+
+    reader.Init(buf, writer.GetLengthWritten());
+    NL_TEST_ASSERT(inSuite, chip::TLV::Utilities::Validate(reader, 4) == CHIP_NO_ERROR);
+
+    // The same encoding is rejected when it nests deeper than the limit allows,
+    // and the caller's reader is left unmoved in both cases.
+    NL_TEST_ASSERT(inSuite, chip::TLV::Utilities::Validate(reader, 1) == CHIP_ERROR_INVALID_TLV_ELEMENT);
+    NL_TEST_ASSERT(inSuite, reader.GetLengthRead() == 0);
+
+    // A truncated encoding is rejected.
+    reader.Init(buf, writer.GetLengthWritten() - 1);
+    NL_TEST_ASSERT(inSuite, chip::TLV::Utilities::Validate(reader, 4) != CHIP_NO_ERROR);
+
+    // An element whose length runs past the end of the buffer is rejected.
+    writer.Init(buf);
+    err = writer.PutString(AnonymousTag, "hello");
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    buf[1] = 0xFF; // Corrupt the string length octet.
+    reader.Init(buf, writer.GetLengthWritten());
+    NL_TEST_ASSERT(inSuite, chip::TLV::Utilities::Validate(reader, 4) != CHIP_NO_ERROR);
+
+    // A depth limit beyond what Validate() can track is refused outright.
+    reader.Init(buf, writer.GetLengthWritten());
+    NL_TEST_ASSERT(inSuite,
+                   chip::TLV::Utilities::Validate(reader, chip::TLV::Utilities::kMaxValidationDepth + 1) ==
+                       CHIP_ERROR_INVALID_ARGUMENT);
+}
+
 // Test Suite
 
 /**
@@ -4350,6 +4581,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Simple Write Read Test",              CheckSimpleWriteRead),
     NL_TEST_DEF("Inet Buffer Test",                    CheckPacketBuffer),
     NL_TEST_DEF("Buffer Overflow Test",                CheckBufferOverflow),
+    NL_TEST_DEF("Chained Buffer Writer Test",          CheckChainedBufferWriter),
     NL_TEST_DEF("Pretty Print Test",                   CheckPrettyPrinter),
     NL_TEST_DEF("Data Macro Test",                     CheckDataMacro),
     NL_TEST_DEF("Strict Aliasing Test",                CheckStrictAliasing),
@@ -4368,12 +4600,15 @@ static const nlTest sTests[] =
     NL_TEST_DEF("CHIP TLV Printf, Circular TLV buf",   CheckCHIPTLVPutStringFCircular),
     NL_TEST_DEF("CHIP TLV Skip non-contiguous",        CheckCHIPTLVSkipCircular),
     NL_TEST_DEF("CHIP TLV ByteSpan",                   CheckCHIPTLVByteSpan),
+    NL_TEST_DEF("CHIP TLV GetByteSpans",               CheckCHIPTLVGetByteSpans),
     NL_TEST_DEF("CHIP TLV Scoped Buffer",              CheckCHIPTLVScopedBuffer),
     NL_TEST_DEF("CHIP TLV Check reserve",              CheckCloseContainerReserve),
     NL_TEST_DEF("CHIP TLV Reader Fuzz Test",           TLVReaderFuzzTest),
     NL_TEST_DEF("CHIP TLV GetStringView Test",         CheckGetStringView),
     NL_TEST_DEF("CHIP TLV GetByteView Test",           CheckGetByteView),
     NL_TEST_DEF("Int Min/Max Test",                    TestIntMinMax),
+    NL_TEST_DEF("CHIP TLV FastSkipToTag Test",         CheckFastSkipToTag),
+    NL_TEST_DEF("CHIP TLV Validate Test",              CheckValidate),
 
     NL_TEST_SENTINEL()
 };
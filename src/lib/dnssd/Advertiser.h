@@ -326,6 +326,16 @@ public:
      */
     virtual CHIP_ERROR GetCommissionableInstanceName(char * instanceName, size_t maxLength) = 0;
 
+    /**
+     * Enables or disables passive advertising.
+     *
+     * A passive advertiser keeps answering queries for its records but sends no
+     * gratuitous announcements when they change, keeping multicast background
+     * load down on networks dense with CHIP nodes.  Implementations that do not
+     * control their own announcement schedule may ignore the setting.
+     */
+    virtual void SetPassiveMode(bool passive) {}
+
     /// Provides the system-wide implementation of the service advertiser
     static ServiceAdvertiser & Instance();
 };
@@ -36,6 +36,8 @@
 #include <lib/support/BytesToHex.h>
 #include <lib/support/CHIPMem.h>
 #include <lib/support/StringBuilder.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
 
 // Enable detailed mDNS logging for received queries
 #undef DETAIL_LOGGING
@@ -98,6 +100,87 @@ void LogQuery(const QueryData & data)
 void LogQuery(const QueryData & data) {}
 #endif
 
+/// 64-bit FNV-1a over the advertised parameters, used to detect no-op
+/// re-advertisements so that stable records are not rebuilt or re-announced.
+class AdvertisingFingerprint
+{
+public:
+    void Add(const void * data, size_t size)
+    {
+        auto * bytes = static_cast<const uint8_t *>(data);
+        for (size_t i = 0; i < size; i++)
+        {
+            mHash = (mHash ^ bytes[i]) * 0x100000001B3ULL;
+        }
+    }
+
+    template <typename T>
+    void Add(const T & value)
+    {
+        Add(&value, sizeof(value));
+    }
+
+    void Add(const char * value) { Add(value, strlen(value) + 1); }
+
+    template <typename T>
+    void Add(const chip::Optional<T> & value)
+    {
+        Add(value.HasValue());
+        if (value.HasValue())
+        {
+            Add(value.Value());
+        }
+    }
+
+    uint64_t Value() const { return mHash; }
+
+private:
+    uint64_t mHash = 0xCBF29CE484222325ULL;
+};
+
+template <class Derived>
+void AddCommonFields(AdvertisingFingerprint & fingerprint, const BaseAdvertisingParams<Derived> & params)
+{
+    fingerprint.Add(params.GetPort());
+    fingerprint.Add(params.IsIPv4Enabled());
+    fingerprint.Add(params.GetMac().size());
+    fingerprint.Add(params.GetMac().data(), params.GetMac().size());
+    fingerprint.Add(params.GetMRPConfig().HasValue());
+    if (params.GetMRPConfig().HasValue())
+    {
+        fingerprint.Add(params.GetMRPConfig().Value().mIdleRetransTimeout.count());
+        fingerprint.Add(params.GetMRPConfig().Value().mActiveRetransTimeout.count());
+    }
+    fingerprint.Add(params.GetTcpSupported());
+}
+
+uint64_t Fingerprint(const OperationalAdvertisingParameters & params)
+{
+    AdvertisingFingerprint fingerprint;
+    fingerprint.Add(params.GetPeerId().GetCompressedFabricId());
+    fingerprint.Add(params.GetPeerId().GetNodeId());
+    AddCommonFields(fingerprint, params);
+    return fingerprint.Value();
+}
+
+uint64_t Fingerprint(const CommissionAdvertisingParameters & params)
+{
+    AdvertisingFingerprint fingerprint;
+    fingerprint.Add(params.GetCommissionAdvertiseMode());
+    fingerprint.Add(params.GetShortDiscriminator());
+    fingerprint.Add(params.GetLongDiscriminator());
+    fingerprint.Add(params.GetCommissioningMode());
+    fingerprint.Add(params.GetVendorId());
+    fingerprint.Add(params.GetProductId());
+    fingerprint.Add(params.GetDeviceType());
+    fingerprint.Add(params.GetDeviceName());
+    fingerprint.Add(params.GetRotatingDeviceId());
+    fingerprint.Add(params.GetPairingHint());
+    fingerprint.Add(params.GetPairingInstruction());
+    AddCommonFields(fingerprint, params);
+    return fingerprint.Value();
+}
+
 class AdvertiserMinMdns : public ServiceAdvertiser,
                           public MdnsPacketDelegate, // receive query packets
                           public ParserDelegate      // parses queries
@@ -121,14 +204,37 @@ public:
     CHIP_ERROR RemoveServices() override;
     CHIP_ERROR Advertise(const OperationalAdvertisingParameters & params) override;
     CHIP_ERROR Advertise(const CommissionAdvertisingParameters & params) override;
-    CHIP_ERROR FinalizeServiceUpdate() override { return CHIP_NO_ERROR; }
+    CHIP_ERROR FinalizeServiceUpdate() override
+    {
+        // Announcements deferred from Advertise() are broadcast here, so that a
+        // multi-fabric update produces a single shared announcement batch
+        // instead of one full batch per Advertise() call.
+        if (mPendingAnnounce)
+        {
+            mPendingAnnounce = false;
+            StartAnnouncing();
+        }
+        return CHIP_NO_ERROR;
+    }
     CHIP_ERROR GetCommissionableInstanceName(char * instanceName, size_t maxLength) override;
+    void SetPassiveMode(bool passive) override
+    {
+        mPassiveMode = passive;
+        if (mPassiveMode && (mSystemLayer != nullptr))
+        {
+            mSystemLayer->CancelTimer(HandleAnnounceTimer, this);
+        }
+    }
 
     // MdnsPacketDelegate
     void OnMdnsPacketData(const BytesRange & data, const chip::Inet::IPPacketInfo * info) override;
 
     // ParserDelegate
-    void OnHeader(ConstHeaderRef & header) override { mMessageId = header.GetMessageId(); }
+    void OnHeader(ConstHeaderRef & header) override
+    {
+        mMessageId            = header.GetMessageId();
+        mQueryHasKnownAnswers = header.GetAnswerCount() > 0;
+    }
     void OnResource(ResourceType type, const ResourceData & data) override {}
     void OnQuery(const QueryData & data) override;
 
@@ -138,6 +244,17 @@ private:
     /// Usable as boot-time advertisement of available SRV records.
     void AdvertiseRecords();
 
+    /// Broadcast the full record set once and schedule the remaining
+    /// exponentially spaced announcements required by RFC 6762 8.3.
+    ///
+    /// Called whenever the advertised record set changes.  No-op in passive
+    /// mode, where queries are still answered but gratuitous announcements
+    /// are suppressed.
+    void StartAnnouncing();
+
+    void ScheduleNextAnnounce();
+    static void HandleAnnounceTimer(System::Layer * systemLayer, void * appState);
+
     /// Determine if advertisement on the specified interface/address is ok given the
     /// interfaces on which the mDNS server is listening
     bool ShouldAdvertiseOn(const chip::Inet::InterfaceId id, const chip::Inet::IPAddress & addr);
@@ -232,9 +349,28 @@ private:
     ResponseSender mResponseSender;
     uint8_t mCommissionableInstanceName[sizeof(uint64_t)];
 
+    // Announcement scheduling: after a record change the full record set is
+    // broadcast a limited number of times with doubling intervals, then the
+    // advertiser goes silent until the next change.
+    static constexpr int kMaxAnnounceCount                        = 4;
+    static constexpr System::Clock::Timeout kInitialAnnounceDelay = System::Clock::Seconds16(1);
+
+    System::Layer * mSystemLayer          = nullptr;
+    System::Clock::Timeout mAnnounceDelay = kInitialAnnounceDelay;
+    int mAnnounceCount                    = 0;
+    bool mPassiveMode                     = false;
+    bool mPendingAnnounce                 = false;
+
+    // Fingerprints of the advertising parameters that built each record set,
+    // used to skip rebuild and re-announcement when nothing changed.
+    uint64_t mOperationalFingerprint[kMaxOperationalNetworks] = {};
+    uint64_t mCommissionableFingerprint                       = 0;
+    uint64_t mCommissionerFingerprint                         = 0;
+
     // current request handling
     const chip::Inet::IPPacketInfo * mCurrentSource = nullptr;
     uint32_t mMessageId                             = 0;
+    bool mQueryHasKnownAnswers                      = false;
 
     const char * mEmptyTextEntries[1] = {
         "=",
@@ -249,6 +385,13 @@ void AdvertiserMinMdns::OnMdnsPacketData(const BytesRange & data, const chip::In
     ChipLogDetail(Discovery, "Received an mDNS query from %s", srcAddressString);
 #endif
 
+    // Most mDNS traffic on a busy LAN is for unrelated services; skip full
+    // parsing when no question label can possibly match our records.
+    if (!mResponseSender.QuestionsMayMatch(data))
+    {
+        return;
+    }
+
     mCurrentSource = info;
     if (!ParsePacket(data, this))
     {
@@ -267,7 +410,7 @@ void AdvertiserMinMdns::OnQuery(const QueryData & data)
 
     LogQuery(data);
 
-    CHIP_ERROR err = mResponseSender.Respond(mMessageId, data, mCurrentSource);
+    CHIP_ERROR err = mResponseSender.Respond(mMessageId, data, mCurrentSource, mQueryHasKnownAnswers);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Discovery, "Failed to reply to query: %s", ErrorStr(err));
@@ -287,15 +430,21 @@ CHIP_ERROR AdvertiserMinMdns::Init(chip::Inet::EndPointManager<chip::Inet::UDPEn
 
     ReturnErrorOnFailure(GlobalMinimalMdnsServer::Instance().StartServer(udpEndPointManager, kMdnsPort));
 
+    mSystemLayer = &udpEndPointManager->SystemLayer();
+
     ChipLogProgress(Discovery, "CHIP minimal mDNS started advertising.");
 
-    AdvertiseRecords();
+    StartAnnouncing();
 
     return CHIP_NO_ERROR;
 }
 
 void AdvertiserMinMdns::Shutdown()
 {
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(HandleAnnounceTimer, this);
+    }
     GlobalMinimalMdnsServer::Server().Shutdown();
 }
 
@@ -307,6 +456,14 @@ CHIP_ERROR AdvertiserMinMdns::RemoveServices()
     }
     mQueryResponderAllocatorCommissionable.Clear();
     mQueryResponderAllocatorCommissioner.Clear();
+    mResponseSender.FlushResponseCache();
+
+    for (auto & fingerprint : mOperationalFingerprint)
+    {
+        fingerprint = 0;
+    }
+    mCommissionableFingerprint = 0;
+    mCommissionerFingerprint   = 0;
     return CHIP_NO_ERROR;
 }
 
@@ -342,11 +499,20 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const OperationalAdvertisingParameters &
     /// need to set server name
     ReturnErrorOnFailure(MakeInstanceName(nameBuffer, sizeof(nameBuffer), params.GetPeerId()));
 
+    const uint64_t fingerprint = Fingerprint(params);
+
     QNamePart nameCheckParts[]  = { nameBuffer, kOperationalServiceName, kOperationalProtocol, kLocalDomain };
     FullQName nameCheck         = FullQName(nameCheckParts);
     auto * operationalAllocator = FindOperationalAllocator(nameCheck);
     if (operationalAllocator != nullptr)
     {
+        // The records being served already match these parameters: keep them
+        // as-is and stay silent instead of rebuilding and re-announcing.
+        if (mOperationalFingerprint[operationalAllocator - mQueryResponderAllocatorOperational] == fingerprint)
+        {
+            ChipLogDetail(Discovery, "Operational advertisement unchanged, not re-announcing");
+            return CHIP_NO_ERROR;
+        }
         operationalAllocator->Clear();
     }
     else
@@ -358,6 +524,8 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const OperationalAdvertisingParameters &
             return CHIP_ERROR_NO_MEMORY;
         }
     }
+    mOperationalFingerprint[operationalAllocator - mQueryResponderAllocatorOperational] = 0;
+    mResponseSender.FlushResponseCache();
 
     FullQName serviceName = operationalAllocator->AllocateQName(kOperationalServiceName, kOperationalProtocol, kLocalDomain);
     FullQName instanceName =
@@ -428,9 +596,12 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const OperationalAdvertisingParameters &
 
     ChipLogProgress(Discovery, "CHIP minimal mDNS configured as 'Operational device'.");
 
-    // Advertise the records we just added as required by RFC 6762.
-    // TODO - Don't announce records that haven't been updated.
-    AdvertiseRecords();
+    mOperationalFingerprint[operationalAllocator - mQueryResponderAllocatorOperational] = fingerprint;
+
+    // RFC 6762 requires announcing the records we just added; the announcement
+    // is deferred to FinalizeServiceUpdate() so that advertising several
+    // fabrics back to back broadcasts one combined batch.
+    mPendingAnnounce = true;
 
     return CHIP_NO_ERROR;
 }
@@ -448,6 +619,20 @@ CHIP_ERROR AdvertiserMinMdns::GetCommissionableInstanceName(char * instanceName,
 
 CHIP_ERROR AdvertiserMinMdns::Advertise(const CommissionAdvertisingParameters & params)
 {
+    const uint64_t fingerprint = Fingerprint(params);
+    uint64_t & storedFingerprint = params.GetCommissionAdvertiseMode() == CommssionAdvertiseMode::kCommissionableNode
+        ? mCommissionableFingerprint
+        : mCommissionerFingerprint;
+
+    // The records being served already match these parameters: keep them
+    // as-is and stay silent instead of rebuilding and re-announcing.
+    if (storedFingerprint == fingerprint)
+    {
+        ChipLogDetail(Discovery, "Commission advertisement unchanged, not re-announcing");
+        return CHIP_NO_ERROR;
+    }
+    storedFingerprint = 0;
+
     if (params.GetCommissionAdvertiseMode() == CommssionAdvertiseMode::kCommissionableNode)
     {
         mQueryResponderAllocatorCommissionable.Clear();
@@ -456,6 +641,7 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const CommissionAdvertisingParameters &
     {
         mQueryResponderAllocatorCommissioner.Clear();
     }
+    mResponseSender.FlushResponseCache();
 
     // TODO: need to detect colisions here
     char nameBuffer[64] = "";
@@ -617,9 +803,11 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const CommissionAdvertisingParameters &
         ChipLogProgress(Discovery, "CHIP minimal mDNS configured as 'Commissioner device'.");
     }
 
-    // Advertise the records we just added as required by RFC 6762.
-    // TODO - Don't announce records that haven't been updated.
-    AdvertiseRecords();
+    storedFingerprint = fingerprint;
+
+    // RFC 6762 requires announcing the records we just added; deferred to
+    // FinalizeServiceUpdate() so back to back updates announce once.
+    mPendingAnnounce = true;
 
     return CHIP_NO_ERROR;
 }
@@ -818,6 +1006,42 @@ void AdvertiserMinMdns::AdvertiseRecords()
     mQueryResponderAllocatorCommissioner.GetQueryResponder()->ClearBroadcastThrottle();
 }
 
+void AdvertiserMinMdns::StartAnnouncing()
+{
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(HandleAnnounceTimer, this);
+    }
+
+    if (mPassiveMode)
+    {
+        return;
+    }
+
+    AdvertiseRecords();
+
+    mAnnounceCount = 1;
+    mAnnounceDelay = kInitialAnnounceDelay;
+    ScheduleNextAnnounce();
+}
+
+void AdvertiserMinMdns::ScheduleNextAnnounce()
+{
+    VerifyOrReturn((mSystemLayer != nullptr) && (mAnnounceCount < kMaxAnnounceCount));
+    LogErrorOnFailure(mSystemLayer->StartTimer(mAnnounceDelay, HandleAnnounceTimer, this));
+}
+
+void AdvertiserMinMdns::HandleAnnounceTimer(System::Layer * systemLayer, void * appState)
+{
+    auto * advertiser = static_cast<AdvertiserMinMdns *>(appState);
+
+    advertiser->AdvertiseRecords();
+
+    advertiser->mAnnounceCount++;
+    advertiser->mAnnounceDelay = System::Clock::Timeout(advertiser->mAnnounceDelay.count() * 2);
+    advertiser->ScheduleNextAnnounce();
+}
+
 AdvertiserMinMdns gAdvertiser;
 } // namespace
 
@@ -36,67 +36,99 @@
 namespace chip {
 namespace Dnssd {
 
+/**
+ * Fixed-capacity cache of resolved node data, indexed two ways:
+ *
+ *  - a hash table keyed by PeerId, so Lookup() cost is independent of the
+ *    cache size (the controller consults the cache before every session
+ *    establishment);
+ *  - an expiry timing wheel, so expired entries are reclaimed by sweeping the
+ *    wheel slots that the clock has passed instead of checking every entry's
+ *    expiry time on each operation.
+ *
+ * The wheel is advanced at the start of each public operation.  An entry may
+ * therefore outlive its expiry time by up to one wheel tick (one second),
+ * which is well inside the slack of mDNS TTLs.
+ */
 template <size_t CACHE_SIZE>
 class DnssdCache
 {
 public:
-    DnssdCache() : elementsUsed(CACHE_SIZE)
+    DnssdCache()
     {
-        for (ResolvedNodeData & e : mLookupTable)
+        for (size_t i = 0; i < CACHE_SIZE; i++)
+        {
+            mEntries[i].mHashNext = static_cast<uint16_t>(i + 1);
+        }
+        mEntries[CACHE_SIZE - 1].mHashNext = kInvalidIndex;
+        mFreeHead                          = 0;
+
+        for (uint16_t & head : mHashHeads)
+        {
+            head = kInvalidIndex;
+        }
+        for (uint16_t & head : mWheelHeads)
         {
-            // each unused entry decrements the count
-            MarkEntryUnused(e);
+            head = kInvalidIndex;
         }
         MdnsLogProgress(Discovery, "construct mdns cache of size %ld", CACHE_SIZE);
     }
 
     // insert this entry into the cache.
     // return error if cache is full
-    // TODO:   have an eviction policy so if the cache is full, an entry may be deleted.
-    //         One policy may be Least-time-to-live
     CHIP_ERROR Insert(const ResolvedNodeData & nodeData)
     {
-        const System::Clock::Timestamp currentTime = System::SystemClock().GetMonotonicTimestamp();
-
-        ResolvedNodeData * entry;
+        ExpireOldEntries();
 
-        entry = FindPeerId(nodeData.mPeerId, currentTime);
-        if (entry)
+        uint16_t index = FindIndex(nodeData.mPeerId);
+        if (index != kInvalidIndex)
         {
-            *entry = nodeData;
+            // Refresh in place.  The expiry time may have moved, so re-home
+            // the entry in the wheel (unlink while the old expiry still
+            // determines its slot).
+            WheelUnlink(index);
+            mEntries[index].mNodeData = nodeData;
+            WheelLink(index);
             return CHIP_NO_ERROR;
         }
 
-        VerifyOrReturnError(entry = findSlot(currentTime), CHIP_ERROR_TOO_MANY_KEYS);
+        VerifyOrReturnError(mFreeHead != kInvalidIndex, CHIP_ERROR_TOO_MANY_KEYS);
+        index     = mFreeHead;
+        mFreeHead = mEntries[index].mHashNext;
 
-        // have a free slot for this entry
-        *entry = nodeData;
-        elementsUsed++;
+        Entry & entry   = mEntries[index];
+        entry.mNodeData = nodeData;
+        entry.mInUse    = true;
+
+        const size_t bucket = Bucket(nodeData.mPeerId);
+        entry.mHashNext     = mHashHeads[bucket];
+        mHashHeads[bucket]  = index;
+        WheelLink(index);
 
+        elementsUsed++;
         return CHIP_NO_ERROR;
     }
 
     CHIP_ERROR Delete(PeerId peerId)
     {
-        ResolvedNodeData * pentry;
-        const System::Clock::Timestamp currentTime = System::SystemClock().GetMonotonicTimestamp();
+        ExpireOldEntries();
 
-        VerifyOrReturnError(pentry = FindPeerId(peerId, currentTime), CHIP_ERROR_KEY_NOT_FOUND);
+        uint16_t index = FindIndex(peerId);
+        VerifyOrReturnError(index != kInvalidIndex, CHIP_ERROR_KEY_NOT_FOUND);
 
-        MarkEntryUnused(*pentry);
+        Remove(index);
         return CHIP_NO_ERROR;
     }
 
     // given a peerId, find the parameters if its in the cache, or return error
     CHIP_ERROR Lookup(PeerId peerId, ResolvedNodeData & nodeData)
     {
-        ResolvedNodeData * pentry;
-        const System::Clock::Timestamp currentTime = System::SystemClock().GetMonotonicTimestamp();
-
-        VerifyOrReturnError(pentry = FindPeerId(peerId, currentTime), CHIP_ERROR_KEY_NOT_FOUND);
+        ExpireOldEntries();
 
-        nodeData = *pentry;
+        uint16_t index = FindIndex(peerId);
+        VerifyOrReturnError(index != kInvalidIndex, CHIP_ERROR_KEY_NOT_FOUND);
 
+        nodeData = mEntries[index].mNodeData;
         return CHIP_NO_ERROR;
     }
 
@@ -106,20 +138,20 @@ public:
         int i = 0;
 
         MdnsLogProgress(Discovery, "cache size = %d", elementsUsed);
-        for (ResolvedNodeData & e : mLookupTable)
+        for (Entry & e : mEntries)
         {
-            if (e.mPeerId == nullPeerId)
+            if (!e.mInUse)
             {
                 MdnsLogProgress(Discovery, "Entry %d unused", i);
             }
             else
             {
-                MdnsLogProgress(Discovery, "Entry %d: node %lx fabric %lx, port = %d", i, e.mPeerId.GetNodeId(),
-                                e.peerId.GetFabricId(), e.port);
-                for (size_t j = 0; j < e.mNumIPs; ++j)
+                MdnsLogProgress(Discovery, "Entry %d: node %lx fabric %lx, port = %d", i, e.mNodeData.mPeerId.GetNodeId(),
+                                e.mNodeData.mPeerId.GetCompressedFabricId(), e.mNodeData.mPort);
+                for (size_t j = 0; j < e.mNodeData.mNumIPs; ++j)
                 {
                     char address[Inet::IPAddress::kMaxStringLength];
-                    e.mAddress[i].ToString(address);
+                    e.mNodeData.mAddress[j].ToString(address);
                     MdnsLogProgress(Discovery, "    address %d: %s", j, address);
                 }
             }
@@ -128,56 +160,145 @@ public:
     }
 
 private:
-    PeerId nullPeerId; // indicates a cache entry is unused
-    int elementsUsed;  // running count of how many entries are used -- for a sanity check
+    static constexpr uint16_t kInvalidIndex = UINT16_MAX;
+    static_assert(CACHE_SIZE > 0 && CACHE_SIZE < kInvalidIndex, "cache indices are uint16_t");
 
-    ResolvedNodeData mLookupTable[CACHE_SIZE];
+    static constexpr size_t NextPowerOfTwo(size_t n, size_t p = 1) { return (p >= n) ? p : NextPowerOfTwo(n, p * 2); }
 
-    ResolvedNodeData * findSlot(System::Clock::Timestamp currentTime)
+    // Buckets sized for a load factor of at most one half, so chains stay
+    // short even at full occupancy.
+    static constexpr size_t kHashBuckets = NextPowerOfTwo(2 * CACHE_SIZE);
+    static constexpr size_t kWheelSlots  = 32;
+    static constexpr uint64_t kWheelTickMs = 1000;
+
+    struct Entry
     {
-        for (ResolvedNodeData & entry : mLookupTable)
-        {
-            if (entry.mPeerId == nullPeerId)
-                return &entry;
+        ResolvedNodeData mNodeData;
+        uint16_t mHashNext;  // next entry in the hash bucket chain, or next free entry
+        uint16_t mWheelNext; // next entry in the expiry wheel slot
+        uint16_t mWheelPrev; // previous entry in the expiry wheel slot
+        bool mInUse = false;
+    };
+
+    static size_t Bucket(PeerId peerId)
+    {
+        uint64_t h = peerId.GetNodeId() ^ (peerId.GetCompressedFabricId() * 0x9E3779B97F4A7C15ULL);
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 33;
+        return static_cast<size_t>(h) & (kHashBuckets - 1);
+    }
+
+    static size_t WheelSlot(System::Clock::Timestamp expiryTime)
+    {
+        return static_cast<size_t>(expiryTime.count() / kWheelTickMs) & (kWheelSlots - 1);
+    }
 
-            if (entry.mExpiryTime <= currentTime)
+    uint16_t FindIndex(PeerId peerId) const
+    {
+        for (uint16_t index = mHashHeads[Bucket(peerId)]; index != kInvalidIndex; index = mEntries[index].mHashNext)
+        {
+            if (mEntries[index].mNodeData.mPeerId == peerId)
             {
-                MarkEntryUnused(entry);
-                return &entry;
+                return index;
             }
         }
-        return nullptr;
+        return kInvalidIndex;
+    }
+
+    void WheelLink(uint16_t index)
+    {
+        const size_t slot      = WheelSlot(mEntries[index].mNodeData.mExpiryTime);
+        mEntries[index].mWheelPrev = kInvalidIndex;
+        mEntries[index].mWheelNext = mWheelHeads[slot];
+        if (mWheelHeads[slot] != kInvalidIndex)
+        {
+            mEntries[mWheelHeads[slot]].mWheelPrev = index;
+        }
+        mWheelHeads[slot] = index;
     }
 
-    ResolvedNodeData * FindPeerId(PeerId peerId, System::Clock::Timestamp current_time)
+    void WheelUnlink(uint16_t index)
     {
-        for (ResolvedNodeData & entry : mLookupTable)
+        Entry & entry = mEntries[index];
+        if (entry.mWheelPrev != kInvalidIndex)
         {
-            if (entry.mPeerId == peerId)
+            mEntries[entry.mWheelPrev].mWheelNext = entry.mWheelNext;
+        }
+        else
+        {
+            mWheelHeads[WheelSlot(entry.mNodeData.mExpiryTime)] = entry.mWheelNext;
+        }
+        if (entry.mWheelNext != kInvalidIndex)
+        {
+            mEntries[entry.mWheelNext].mWheelPrev = entry.mWheelPrev;
+        }
+    }
+
+    void Remove(uint16_t index)
+    {
+        // Unlink from the hash bucket chain.
+        uint16_t * link = &mHashHeads[Bucket(mEntries[index].mNodeData.mPeerId)];
+        while (*link != index)
+        {
+            link = &mEntries[*link].mHashNext;
+        }
+        *link = mEntries[index].mHashNext;
+
+        WheelUnlink(index);
+
+        mEntries[index].mInUse    = false;
+        mEntries[index].mHashNext = mFreeHead;
+        mFreeHead                 = index;
+        elementsUsed--;
+    }
+
+    // Sweep the wheel slots the clock has passed since the last sweep,
+    // removing entries whose expiry time has been reached.  Entries whose
+    // expiry maps to a swept slot but lies a full wheel revolution (or more)
+    // in the future are left for a later round.
+    void ExpireOldEntries()
+    {
+        const System::Clock::Timestamp currentTime = System::SystemClock().GetMonotonicTimestamp();
+
+        const uint64_t nowTick = currentTime.count() / kWheelTickMs;
+        if (nowTick <= mLastTick)
+        {
+            return;
+        }
+
+        uint64_t steps = nowTick - mLastTick;
+        if (steps > kWheelSlots)
+        {
+            // One full revolution visits every slot.
+            steps = kWheelSlots;
+        }
+
+        for (uint64_t s = 1; s <= steps; s++)
+        {
+            const size_t slot = static_cast<size_t>(mLastTick + s) & (kWheelSlots - 1);
+            uint16_t index    = mWheelHeads[slot];
+            while (index != kInvalidIndex)
             {
-                if (entry.mExpiryTime < current_time)
+                const uint16_t next = mEntries[index].mWheelNext;
+                if (mEntries[index].mNodeData.mExpiryTime <= currentTime)
                 {
-                    MarkEntryUnused(entry);
-                    break; // return nullptr
+                    Remove(index);
                 }
-                else
-                    return &entry;
-            }
-            if (entry.mPeerId != nullPeerId && entry.mExpiryTime < current_time)
-            {
-                MarkEntryUnused(entry);
+                index = next;
             }
         }
 
-        return nullptr;
+        mLastTick = nowTick;
     }
 
-    // have a method to mark ununused --  so its easy to change
-    void MarkEntryUnused(ResolvedNodeData & pentry)
-    {
-        pentry.mPeerId = nullPeerId;
-        elementsUsed--;
-    }
+    int elementsUsed = 0; // running count of how many entries are used -- for a sanity check
+
+    Entry mEntries[CACHE_SIZE];
+    uint16_t mHashHeads[kHashBuckets];
+    uint16_t mWheelHeads[kWheelSlots];
+    uint16_t mFreeHead;
+    uint64_t mLastTick = 0;
 };
 
 #ifndef MDNS_LOGGING
@@ -0,0 +1,143 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "PersistedAddressCache.h"
+
+#include <lib/support/BufferReader.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+
+namespace chip {
+namespace Dnssd {
+
+constexpr System::Clock::Seconds32 PersistedAddressCache::kStaleAge;
+
+namespace {
+
+// Returns the current real time in epoch seconds, or 0 when the platform has
+// no synchronized real-time clock.
+uint32_t GetRealTimeSeconds()
+{
+    System::Clock::Microseconds64 now;
+    if (System::SystemClock().GetClock_RealTime(now) != CHIP_NO_ERROR)
+    {
+        return 0;
+    }
+    return static_cast<uint32_t>(std::chrono::duration_cast<System::Clock::Seconds32>(now).count());
+}
+
+} // namespace
+
+CHIP_ERROR PersistedAddressCache::Store(const ResolvedNodeData & nodeData)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(nodeData.mNumIPs > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Prefer a routable address: link-local addresses are only usable with the
+    // interface they were learned on, which is not stable across restarts.
+    Inet::IPAddress address = nodeData.mAddress[0];
+    for (size_t i = 0; i < nodeData.mNumIPs; i++)
+    {
+        if (!nodeData.mAddress[i].IsIPv6LinkLocal())
+        {
+            address = nodeData.mAddress[i];
+            break;
+        }
+    }
+
+    uint8_t buffer[kEntrySize];
+    Encoding::LittleEndian::BufferWriter writer(buffer, sizeof(buffer));
+
+    writer.Put8(kEntryVersion);
+    writer.Put16(nodeData.mPort);
+    writer.Put32(nodeData.GetMrpRetryIntervalIdle().HasValue() ? nodeData.GetMrpRetryIntervalIdle().Value().count()
+                                                               : kNoMrpInterval);
+    writer.Put32(nodeData.GetMrpRetryIntervalActive().HasValue() ? nodeData.GetMrpRetryIntervalActive().Value().count()
+                                                                 : kNoMrpInterval);
+    writer.Put32(GetRealTimeSeconds());
+
+    uint8_t addressBytes[16];
+    uint8_t * cursor = addressBytes;
+    address.WriteAddress(cursor);
+    writer.Put(addressBytes, sizeof(addressBytes));
+
+    VerifyOrReturnError(writer.Fit(), CHIP_ERROR_INTERNAL);
+
+    DefaultStorageKeyAllocator key;
+    return mStorage->SyncSetKeyValue(key.PersistedNodeAddress(nodeData.mPeerId.GetCompressedFabricId(),
+                                                              nodeData.mPeerId.GetNodeId()),
+                                     buffer, static_cast<uint16_t>(writer.Needed()));
+}
+
+CHIP_ERROR PersistedAddressCache::Lookup(const PeerId & peerId, ResolvedNodeData & nodeData, bool & isStale)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    uint8_t buffer[kEntrySize];
+    uint16_t size = sizeof(buffer);
+
+    DefaultStorageKeyAllocator key;
+    ReturnErrorOnFailure(
+        mStorage->SyncGetKeyValue(key.PersistedNodeAddress(peerId.GetCompressedFabricId(), peerId.GetNodeId()), buffer, size));
+
+    uint8_t version;
+    uint16_t port;
+    uint32_t mrpIdle;
+    uint32_t mrpActive;
+    uint32_t storeTime;
+
+    uint8_t addressBytes[16];
+    Encoding::LittleEndian::Reader reader(buffer, size);
+    reader.Read8(&version).Read16(&port).Read32(&mrpIdle).Read32(&mrpActive).Read32(&storeTime);
+    reader.ReadBytes(addressBytes, sizeof(addressBytes));
+    ReturnErrorOnFailure(reader.StatusCode());
+    VerifyOrReturnError(version == kEntryVersion, CHIP_ERROR_VERSION_MISMATCH);
+
+    nodeData          = ResolvedNodeData();
+    nodeData.mPeerId  = peerId;
+    nodeData.mNumIPs  = 1;
+    nodeData.mPort    = port;
+    const uint8_t * addressCursor = addressBytes;
+    Inet::IPAddress::ReadAddress(addressCursor, nodeData.mAddress[0]);
+    nodeData.mInterfaceId = Inet::InterfaceId::Null();
+    if (mrpIdle != kNoMrpInterval)
+    {
+        nodeData.mMrpRetryIntervalIdle.SetValue(System::Clock::Milliseconds32(mrpIdle));
+    }
+    if (mrpActive != kNoMrpInterval)
+    {
+        nodeData.mMrpRetryIntervalActive.SetValue(System::Clock::Milliseconds32(mrpActive));
+    }
+
+    const uint32_t now = GetRealTimeSeconds();
+    isStale            = (storeTime == kUnknownStoreTime) || (now == kUnknownStoreTime) || (now < storeTime) ||
+        (now - storeTime > kStaleAge.count());
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistedAddressCache::Delete(const PeerId & peerId)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    DefaultStorageKeyAllocator key;
+    return mStorage->SyncDeleteKeyValue(key.PersistedNodeAddress(peerId.GetCompressedFabricId(), peerId.GetNodeId()));
+}
+
+} // namespace Dnssd
+} // namespace chip
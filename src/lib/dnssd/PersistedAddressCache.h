@@ -0,0 +1,89 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/core/PeerId.h>
+#include <lib/dnssd/Resolver.h>
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace Dnssd {
+
+/**
+ * Persists the last known good operational address of peer nodes.
+ *
+ * The in-memory DnssdCache empties on restart, forcing every reconnection
+ * after a controller reboot to wait for a fresh DNS-SD resolution. This cache
+ * keeps one address per peer in persistent storage so that connection attempts
+ * can start immediately from the last known good address, with DNS-SD used to
+ * revalidate stale entries or recover when the cached address no longer works.
+ *
+ * Only a single (preferably non-link-local) address is stored per peer, since
+ * interface identifiers are not stable across restarts.
+ */
+class PersistedAddressCache
+{
+public:
+    /**
+     * Entries whose last store is older than this are reported as stale by
+     * Lookup(), as are all entries on platforms without a synchronized
+     * real-time clock. Stale entries are still usable as connection hints.
+     */
+    static constexpr System::Clock::Seconds32 kStaleAge = System::Clock::Seconds32(24 * 60 * 60);
+
+    CHIP_ERROR Init(PersistentStorageDelegate * storage)
+    {
+        VerifyOrReturnError(storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        mStorage = storage;
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * Persist the address, port and MRP intervals from a fresh resolution,
+     * replacing any previous entry for the same peer.
+     */
+    CHIP_ERROR Store(const ResolvedNodeData & nodeData);
+
+    /**
+     * Load the persisted entry for the given peer, if any.
+     *
+     * On success `nodeData` carries a single address with a null interface id,
+     * and `isStale` indicates whether the entry is old enough (or of unknown
+     * age) that the caller should revalidate it via DNS-SD.
+     */
+    CHIP_ERROR Lookup(const PeerId & peerId, ResolvedNodeData & nodeData, bool & isStale);
+
+    CHIP_ERROR Delete(const PeerId & peerId);
+
+private:
+    // Serialized entry: version, port, MRP idle/active intervals, last store
+    // time and the raw IPv6 address bytes.
+    static constexpr uint8_t kEntryVersion = 1;
+    static constexpr size_t kEntrySize     = sizeof(uint8_t) + sizeof(uint16_t) + 3 * sizeof(uint32_t) + 16;
+
+    // Sentinel values for fields that may be absent.
+    static constexpr uint32_t kNoMrpInterval    = UINT32_MAX;
+    static constexpr uint32_t kUnknownStoreTime = 0;
+
+    PersistentStorageDelegate * mStorage = nullptr;
+};
+
+} // namespace Dnssd
+} // namespace chip
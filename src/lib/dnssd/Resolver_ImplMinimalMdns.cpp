@@ -64,16 +64,31 @@ private:
 constexpr size_t kMdnsMaxPacketSize = 1024;
 constexpr uint16_t kMdnsPort        = 5353;
 
+// Lifetime of cached resolutions used for the unicast query fast path.  Kept
+// at the common operational SRV record TTL: the cached address only seeds a
+// query, so a stale entry costs one wasted unicast packet, not a bad address
+// handed to a caller.
+constexpr System::Clock::Timeout kDnssdCacheEntryLifetime = System::Clock::Seconds16(120);
+
 using namespace mdns::Minimal;
 using DnssdCacheType = Dnssd::DnssdCache<CHIP_CONFIG_MDNS_CACHE_SIZE>;
 
+// Upper bound on the wire size of a single operational instance question: the
+// serialized QNAME (length-prefixed labels plus the root label) followed by
+// QTYPE and QCLASS.
+constexpr size_t kMaxOperationalQueryWireSize = kMaxOperationalServiceNameSize + 1 + 2 * sizeof(uint16_t);
+
+// Number of operational node id questions guaranteed to fit into a single
+// query packet, so that coalescing queries never overflows the builder.
+constexpr size_t kMaxQueriesPerPacket = (kMdnsMaxPacketSize - HeaderRef::kSizeBytes) / kMaxOperationalQueryWireSize;
+
 class PacketDataReporter : public ParserDelegate
 {
 public:
     PacketDataReporter(ResolverDelegate * delegate, chip::Inet::InterfaceId interfaceId, DiscoveryType discoveryType,
                        const BytesRange & packet, DnssdCacheType & mdnsCache) :
         mDelegate(delegate),
-        mDiscoveryType(discoveryType), mPacketRange(packet)
+        mDiscoveryType(discoveryType), mPacketRange(packet), mMdnsCache(mdnsCache)
     {
         mInterfaceId = interfaceId;
     }
@@ -95,6 +110,7 @@ private:
     DiscoveredNodeData mDiscoveredNodeData;
     chip::Inet::InterfaceId mInterfaceId;
     BytesRange mPacketRange;
+    DnssdCacheType & mMdnsCache;
 
     bool mValid       = false;
     bool mHasNodePort = false;
@@ -330,6 +346,13 @@ void PacketDataReporter::OnComplete(ActiveResolveAttempts & activeAttempts)
     {
         activeAttempts.Complete(mNodeData.mPeerId);
 
+        // Remember the resolved addresses so a later resolve of the same peer can
+        // start with a unicast question to the last known address.  Record TTLs
+        // are not tracked by this reporter, so a fixed conservative lifetime is
+        // used; a full cache merely disables the fast path for this peer.
+        mNodeData.mExpiryTime = System::SystemClock().GetMonotonicTimestamp() + kDnssdCacheEntryLifetime;
+        (void) mMdnsCache.Insert(mNodeData);
+
         mNodeData.LogNodeIdResolved();
         mDelegate->OnNodeIdResolved(mNodeData);
     }
@@ -359,6 +382,10 @@ private:
     DiscoveryType mDiscoveryType = DiscoveryType::kUnknown;
     System::Layer * mSystemLayer = nullptr;
     ActiveResolveAttempts mActiveResolves;
+    InstanceNameCache mInstanceNames;
+    // Shared by the two single-question query builders; both produce packets
+    // of essentially the same shape and size.
+    System::PacketBufferSizeEstimator mQuerySizeEstimator;
 
     CHIP_ERROR SendPendingResolveQueries();
     CHIP_ERROR ScheduleResolveRetries();
@@ -366,6 +393,7 @@ private:
     static void ResolveRetryCallback(System::Layer *, void * self);
 
     CHIP_ERROR SendQuery(mdns::Minimal::FullQName qname, mdns::Minimal::QType type);
+    CHIP_ERROR SendUnicastQuery(const PeerId & peerId, const chip::Inet::IPAddress & address, chip::Inet::InterfaceId interfaceId);
     CHIP_ERROR BrowseNodes(DiscoveryType type, DiscoveryFilter subtype);
     template <typename... Args>
     mdns::Minimal::FullQName CheckAndAllocateQName(Args &&... parts)
@@ -420,26 +448,89 @@ CHIP_ERROR MinMdnsResolver::Init(chip::Inet::EndPointManager<chip::Inet::UDPEndP
 
 void MinMdnsResolver::Shutdown()
 {
+    mInstanceNames.Clear();
     GlobalMinimalMdnsServer::Instance().ShutdownServer();
 }
 
 CHIP_ERROR MinMdnsResolver::SendQuery(mdns::Minimal::FullQName qname, mdns::Minimal::QType type)
 {
-    System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
-    ReturnErrorCodeIf(buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+    // Single-question query packets are a small fraction of the maximum mdns
+    // packet size; allocate from what recent queries needed, retrying with the
+    // full size if the right-sized guess does not fit.
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        const uint16_t allocationSize = (attempt == 0) ? mQuerySizeEstimator.SuggestedSize(kMdnsMaxPacketSize) : kMdnsMaxPacketSize;
+
+        System::PacketBufferHandle buffer = System::PacketBufferHandle::New(allocationSize);
+        ReturnErrorCodeIf(buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+        QueryBuilder builder(std::move(buffer));
+        builder.Header().SetMessageId(0);
+
+        mdns::Minimal::Query query(qname);
+        query.SetType(type).SetClass(mdns::Minimal::QClass::IN);
+        query.SetAnswerViaUnicast(true);
+
+        builder.AddQuery(query);
+
+        if (!builder.Ok())
+        {
+            mQuerySizeEstimator.ReportUndersized();
+            continue;
+        }
+
+        System::PacketBufferHandle packet = builder.ReleasePacket();
+        mQuerySizeEstimator.ReportFinalSize(packet->TotalLength());
+
+        return GlobalMinimalMdnsServer::Server().BroadcastUnicastQuery(std::move(packet), kMdnsPort);
+    }
+
+    return CHIP_ERROR_INTERNAL;
+}
+
+CHIP_ERROR MinMdnsResolver::SendUnicastQuery(const PeerId & peerId, const chip::Inet::IPAddress & address,
+                                             chip::Inet::InterfaceId interfaceId)
+{
+    const char * instanceName = mInstanceNames.Get(peerId);
+    ReturnErrorCodeIf(instanceName == nullptr, CHIP_ERROR_NO_MEMORY);
+
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        const uint16_t allocationSize = (attempt == 0) ? mQuerySizeEstimator.SuggestedSize(kMdnsMaxPacketSize) : kMdnsMaxPacketSize;
 
-    QueryBuilder builder(std::move(buffer));
-    builder.Header().SetMessageId(0);
+        System::PacketBufferHandle buffer = System::PacketBufferHandle::New(allocationSize);
+        ReturnErrorCodeIf(buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+        QueryBuilder builder(std::move(buffer));
+        builder.Header().SetMessageId(0);
+
+        const char * instanceQName[] = { instanceName, kOperationalServiceName, kOperationalProtocol, kLocalDomain };
+        Query query(instanceQName);
+
+        // Same question shape as the multicast path (see SendPendingResolveQueries
+        // for why the type is ANY), with the QU bit set so the single addressed
+        // responder replies directly.
+        query
+            .SetClass(QClass::IN)      //
+            .SetType(QType::ANY)       //
+            .SetAnswerViaUnicast(true) //
+            ;
 
-    mdns::Minimal::Query query(qname);
-    query.SetType(type).SetClass(mdns::Minimal::QClass::IN);
-    query.SetAnswerViaUnicast(true);
+        builder.AddQuery(query);
 
-    builder.AddQuery(query);
+        if (!builder.Ok())
+        {
+            mQuerySizeEstimator.ReportUndersized();
+            continue;
+        }
+
+        System::PacketBufferHandle packet = builder.ReleasePacket();
+        mQuerySizeEstimator.ReportFinalSize(packet->TotalLength());
 
-    ReturnErrorCodeIf(!builder.Ok(), CHIP_ERROR_INTERNAL);
+        return GlobalMinimalMdnsServer::Server().DirectSend(std::move(packet), address, kMdnsPort, interfaceId);
+    }
 
-    return GlobalMinimalMdnsServer::Server().BroadcastUnicastQuery(builder.ReleasePacket(), kMdnsPort);
+    return CHIP_ERROR_INTERNAL;
 }
 
 CHIP_ERROR MinMdnsResolver::FindCommissionableNodes(DiscoveryFilter filter)
@@ -510,6 +601,22 @@ CHIP_ERROR MinMdnsResolver::ResolveNodeId(const PeerId & peerId, Inet::IPAddress
     mDiscoveryType = DiscoveryType::kOperational;
     mActiveResolves.MarkPending(peerId);
 
+    // Latency fast path: when a previous resolution of this peer is cached,
+    // question its last known address directly instead of waiting out
+    // multicast convergence.  A device that moved simply does not answer and
+    // the multicast schedule takes over after kUnicastFallbackDelay.
+    if (dnssdCacheBypass == Resolver::CacheBypass::Off)
+    {
+        ResolvedNodeData cachedData;
+        if (sDnssdCache.Lookup(peerId, cachedData) == CHIP_NO_ERROR && cachedData.mNumIPs > 0)
+        {
+            if (SendUnicastQuery(peerId, cachedData.mAddress[0], cachedData.mInterfaceId) == CHIP_NO_ERROR)
+            {
+                mActiveResolves.MarkInitialUnicastAttempt(peerId);
+            }
+        }
+    }
+
     return SendPendingResolveQueries();
 }
 
@@ -535,28 +642,31 @@ void MinMdnsResolver::ResolveRetryCallback(System::Layer *, void * self)
 
 CHIP_ERROR MinMdnsResolver::SendPendingResolveQueries()
 {
-    while (true)
-    {
-        Optional<PeerId> peerId = mActiveResolves.NextScheduledPeer();
-
-        if (!peerId.HasValue())
-        {
-            break;
-        }
+    Optional<PeerId> peerId = mActiveResolves.NextScheduledPeer();
 
+    while (peerId.HasValue())
+    {
         System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
         ReturnErrorCodeIf(buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
 
         QueryBuilder builder(std::move(buffer));
         builder.Header().SetMessageId(0);
 
+        // Coalesce as many outstanding questions as are guaranteed to fit into
+        // a single packet: a controller resolving many operational node ids at
+        // once would otherwise send one multicast packet per node. Every
+        // responder answers its own question independently, so replies still
+        // arrive one node per packet.
+        size_t queriesInPacket = 0;
+        while (peerId.HasValue() && queriesInPacket < kMaxQueriesPerPacket)
         {
-            char nameBuffer[kMaxOperationalServiceNameSize] = "";
-
-            // Node and fabricid are encoded in server names.
-            ReturnErrorOnFailure(MakeInstanceName(nameBuffer, sizeof(nameBuffer), peerId.Value()));
+            // Node and fabricid are encoded in server names.  Repeated retries
+            // for the same peer reuse the interned name instead of formatting
+            // the 16-hex-digit pair again.
+            const char * instanceName = mInstanceNames.Get(peerId.Value());
+            ReturnErrorCodeIf(instanceName == nullptr, CHIP_ERROR_NO_MEMORY);
 
-            const char * instanceQName[] = { nameBuffer, kOperationalServiceName, kOperationalProtocol, kLocalDomain };
+            const char * instanceQName[] = { instanceName, kOperationalServiceName, kOperationalProtocol, kLocalDomain };
             Query query(instanceQName);
 
             query
@@ -579,6 +689,9 @@ CHIP_ERROR MinMdnsResolver::SendPendingResolveQueries()
             // would be needed to resolve the host name to an IP address
 
             builder.AddQuery(query);
+            queriesInPacket++;
+
+            peerId = mActiveResolves.NextScheduledPeer();
         }
 
         ReturnErrorCodeIf(!builder.Ok(), CHIP_ERROR_INTERNAL);
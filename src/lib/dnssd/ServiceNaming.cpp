@@ -41,6 +41,52 @@ CHIP_ERROR MakeInstanceName(char * buffer, size_t bufferLen, const PeerId & peer
     return CHIP_NO_ERROR;
 }
 
+const char * InstanceNameCache::Get(const PeerId & peerId)
+{
+    if (peerId.GetNodeId() != kUndefinedNodeId)
+    {
+        for (auto & entry : mEntries)
+        {
+            if (entry.peerId == peerId)
+            {
+                return entry.name;
+            }
+        }
+    }
+
+    Entry & victim = mEntries[mNextVictim];
+    mNextVictim    = (mNextVictim + 1) % kCacheSize;
+
+    if (MakeInstanceName(victim.name, sizeof(victim.name), peerId) != CHIP_NO_ERROR)
+    {
+        victim.peerId = PeerId();
+        return nullptr;
+    }
+
+    victim.peerId = peerId;
+    return victim.name;
+}
+
+void InstanceNameCache::Invalidate(const PeerId & peerId)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.peerId == peerId)
+        {
+            entry.peerId = PeerId();
+            return;
+        }
+    }
+}
+
+void InstanceNameCache::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        entry.peerId = PeerId();
+    }
+}
+
 CHIP_ERROR ExtractIdFromInstanceName(const char * name, PeerId * peerId)
 {
     ReturnErrorCodeIf(name == nullptr, CHIP_ERROR_INVALID_ARGUMENT);
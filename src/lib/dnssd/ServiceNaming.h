@@ -51,6 +51,42 @@ constexpr size_t kMaxOperationalServiceNameSize =
 /// builds the MDNS advertising name for a given fabric + nodeid pair
 CHIP_ERROR MakeInstanceName(char * buffer, size_t bufferLen, const PeerId & peerId);
 
+/// Interned formatted instance names for recently used peers.
+///
+/// Resolution and advertising paths format the same peer's 33-character hex
+/// instance name over and over; this cache hands back a pointer to a
+/// previously formatted name instead of re-running snprintf on every use.
+/// Entries are matched by full PeerId, so a stale entry can never be returned
+/// for a different peer; Invalidate() drops a peer eagerly when fabric or
+/// peer membership changes.
+class InstanceNameCache
+{
+public:
+    static constexpr size_t kCacheSize = 8;
+
+    /// Returns the formatted instance name for the peer, formatting and
+    /// interning it on first use.  The returned pointer remains valid until
+    /// the entry is evicted by later insertions, invalidated or cleared.
+    const char * Get(const PeerId & peerId);
+
+    /// Drop the cached name for the given peer, if any.
+    void Invalidate(const PeerId & peerId);
+
+    /// Drop all cached names.
+    void Clear();
+
+private:
+    struct Entry
+    {
+        // Free entries are marked by having NodeId == kUndefinedNodeId
+        PeerId peerId;
+        char name[Operational::kInstanceNameMaxLength + 1] = "";
+    };
+
+    Entry mEntries[kCacheSize];
+    size_t mNextVictim = 0;
+};
+
 /// Inverse of MakeInstanceName.  Will return errors on non-spec-compliant ids,
 /// _except_ for allowing lowercase hex, not just the spec-defined uppercase
 /// hex.  The part of "name" up to the first '.' (or end of string, whichever
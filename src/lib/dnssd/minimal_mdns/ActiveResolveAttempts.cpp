@@ -27,6 +27,7 @@ namespace mdns {
 namespace Minimal {
 
 constexpr chip::System::Clock::Timeout ActiveResolveAttempts::kMaxRetryDelay;
+constexpr chip::System::Clock::Timeout ActiveResolveAttempts::kUnicastFallbackDelay;
 
 void ActiveResolveAttempts::Reset()
 
@@ -123,6 +124,18 @@ void ActiveResolveAttempts::MarkPending(const PeerId & peerId)
     entryToUse->nextRetryDelay = System::Clock::Seconds16(1);
 }
 
+void ActiveResolveAttempts::MarkInitialUnicastAttempt(const PeerId & peerId)
+{
+    for (auto & entry : mRetryQueue)
+    {
+        if (entry.peerId == peerId)
+        {
+            entry.queryDueTime = mClock->GetMonotonicTimestamp() + kUnicastFallbackDelay;
+            return;
+        }
+    }
+}
+
 Optional<System::Clock::Timeout> ActiveResolveAttempts::GetTimeUntilNextExpectedResponse() const
 {
     Optional<System::Clock::Timeout> minDelay = Optional<System::Clock::Timeout>::Missing();
@@ -41,6 +41,10 @@ public:
     static constexpr size_t kRetryQueueSize                      = 4;
     static constexpr chip::System::Clock::Timeout kMaxRetryDelay = chip::System::Clock::Seconds16(16);
 
+    // How long a unicast query to a cached address is given to answer before
+    // the regular multicast schedule takes over.
+    static constexpr chip::System::Clock::Timeout kUnicastFallbackDelay = chip::System::Clock::Milliseconds32(250);
+
     ActiveResolveAttempts(chip::System::Clock::ClockBase * clock) : mClock(clock) { Reset(); }
 
     /// Clear out the internal queue
@@ -55,6 +59,15 @@ public:
     /// by NextScheduledPeer (potentially with others as well)
     void MarkPending(const chip::PeerId & peerId);
 
+    /// Mark that the initial query for a pending resolution was sent unicast
+    /// to a cached address instead of multicast.
+    ///
+    /// The first multicast query is rescheduled kUnicastFallbackDelay from now:
+    /// it is not a successive multicast query, so it is not bound by the
+    /// RFC 6762 one-second multicast retry interval, and a stale cached address
+    /// should fall back to multicast quickly.
+    void MarkInitialUnicastAttempt(const chip::PeerId & peerId);
+
     // Get minimum time until the next pending reply is required.
     //
     // Returns missing if no actively tracked elements exist.
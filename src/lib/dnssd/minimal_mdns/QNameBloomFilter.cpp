@@ -0,0 +1,152 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/dnssd/minimal_mdns/QNameBloomFilter.h>
+
+#include <lib/dnssd/minimal_mdns/core/DnsHeader.h>
+
+#include <string.h>
+
+namespace mdns {
+namespace Minimal {
+
+namespace {
+
+// Labels present in essentially every mDNS name on the network; inserting
+// them would make every packet pass the filter.
+const char * const kGenericLabels[] = { "local", "_tcp", "_udp", "_sub" };
+
+inline uint8_t ToLower(uint8_t c)
+{
+    return (c >= 'A' && c <= 'Z') ? static_cast<uint8_t>(c - 'A' + 'a') : c;
+}
+
+} // namespace
+
+bool QNameBloomFilter::IsGenericLabel(const char * label)
+{
+    for (const char * generic : kGenericLabels)
+    {
+        if (strcasecmp(label, generic) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t QNameBloomFilter::HashLabel(const uint8_t * label, size_t length)
+{
+    // FNV-1a over the lowercased label; DNS names compare case-insensitively.
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= ToLower(label[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+void QNameBloomFilter::AddHash(uint32_t hash)
+{
+    // Two probes derived from independent halves of the 32-bit hash.
+    uint32_t bit1 = hash & 127;
+    uint32_t bit2 = (hash >> 16) & 127;
+    mBits[bit1 / 64] |= (UINT64_C(1) << (bit1 % 64));
+    mBits[bit2 / 64] |= (UINT64_C(1) << (bit2 % 64));
+}
+
+bool QNameBloomFilter::ContainsHash(uint32_t hash) const
+{
+    uint32_t bit1 = hash & 127;
+    uint32_t bit2 = (hash >> 16) & 127;
+    return ((mBits[bit1 / 64] & (UINT64_C(1) << (bit1 % 64))) != 0) && ((mBits[bit2 / 64] & (UINT64_C(1) << (bit2 % 64))) != 0);
+}
+
+void QNameBloomFilter::AddQName(const FullQName & name)
+{
+    for (size_t i = 0; i < name.nameCount; i++)
+    {
+        if (IsGenericLabel(name.names[i]))
+        {
+            continue;
+        }
+        AddHash(HashLabel(reinterpret_cast<const uint8_t *>(name.names[i]), strlen(name.names[i])));
+    }
+}
+
+bool QNameBloomFilter::ContainsLabel(const uint8_t * label, size_t length) const
+{
+    return ContainsHash(HashLabel(label, length));
+}
+
+bool QNameBloomFilter::QuestionsMayMatch(const BytesRange & packet) const
+{
+    if (IsEmpty())
+    {
+        return true;
+    }
+
+    if (packet.Size() < ConstHeaderRef::kSizeBytes)
+    {
+        return true; // let the full parser reject it
+    }
+
+    ConstHeaderRef header(packet.Start());
+    const uint8_t * p   = packet.Start() + ConstHeaderRef::kSizeBytes;
+    const uint8_t * end = packet.End();
+
+    for (uint16_t question = 0; question < header.GetQueryCount(); question++)
+    {
+        // Walk the length-prefixed QNAME labels.
+        while (true)
+        {
+            if (p >= end)
+            {
+                return true; // truncated; defer to the full parser
+            }
+
+            uint8_t length = *p++;
+            if (length == 0)
+            {
+                break; // end of this name
+            }
+            if ((length & 0xC0) != 0)
+            {
+                // Compressed name: resolving pointers is the full parser's job.
+                return true;
+            }
+            if (p + length > end)
+            {
+                return true;
+            }
+
+            if (ContainsLabel(p, length))
+            {
+                return true;
+            }
+            p += length;
+        }
+
+        p += 4; // QTYPE and QCLASS
+    }
+
+    return false;
+}
+
+} // namespace Minimal
+} // namespace mdns
@@ -0,0 +1,79 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/dnssd/minimal_mdns/core/BytesRange.h>
+#include <lib/dnssd/minimal_mdns/core/QName.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace mdns {
+namespace Minimal {
+
+/// A small Bloom filter over the labels of the QNames served by a responder,
+/// used to drop unrelated multicast DNS traffic (printers, media players, ...)
+/// before full packet parsing.
+///
+/// Generic labels shared by almost all mDNS names ("local", "_tcp", "_udp",
+/// "_sub") are not inserted, so a query passes the filter only when it carries
+/// at least one label that is distinctive for a served name. False positives
+/// merely cost a full parse; false negatives cannot occur since every label of
+/// a served name that a matching query must contain is either inserted or
+/// generic-and-skipped.
+class QNameBloomFilter
+{
+public:
+    QNameBloomFilter() { Clear(); }
+
+    void Clear()
+    {
+        mBits[0] = 0;
+        mBits[1] = 0;
+    }
+
+    bool IsEmpty() const { return (mBits[0] == 0) && (mBits[1] == 0); }
+
+    /// Inserts all non-generic labels of the given name.
+    void AddQName(const FullQName & name);
+
+    /// Cheaply scans the question section of a raw DNS packet.
+    ///
+    /// Returns true if any question name contains a label present in the
+    /// filter, if the filter is empty, or if the packet cannot be scanned
+    /// without full parsing (malformed or using name compression); the full
+    /// parser stays the authority on such packets.
+    bool QuestionsMayMatch(const BytesRange & packet) const;
+
+    /// Checks a single label (not nul-terminated), ignoring DNS name case.
+    bool ContainsLabel(const uint8_t * label, size_t length) const;
+
+private:
+    static bool IsGenericLabel(const char * label);
+    static uint32_t HashLabel(const uint8_t * label, size_t length);
+
+    void AddHash(uint32_t hash);
+    bool ContainsHash(uint32_t hash) const;
+
+    // 128 bits with 2 probes per label keeps the false positive rate low for
+    // the dozen or so distinctive labels a device typically serves.
+    uint64_t mBits[2];
+};
+
+} // namespace Minimal
+} // namespace mdns
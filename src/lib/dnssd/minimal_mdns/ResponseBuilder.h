@@ -63,6 +63,9 @@ public:
         return *this;
     }
 
+    /// Provides read access to the packet being built, e.g. to clone its serialized form.
+    const chip::System::PacketBufferHandle & GetPacket() const { return mPacket; }
+
     CHECK_RETURN_VALUE
     chip::System::PacketBufferHandle ReleasePacket()
     {
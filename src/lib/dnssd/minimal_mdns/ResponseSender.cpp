@@ -19,6 +19,8 @@
 
 #include "QueryReplyFilter.h"
 
+#include <cstring>
+
 #include <system/SystemClock.h>
 
 #define RETURN_IF_ERROR(err)                                                                                                       \
@@ -44,6 +46,42 @@ constexpr uint16_t kMdnsStandardPort = 5353;
 //    the header.
 constexpr uint16_t kPacketSizeBytes = 512;
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_ENTRIES > 0
+
+// Cached replies expire after a short while even without an explicit flush, so that replies
+// embedding interface addresses do not outlive an address change for long.  Record TTLs are
+// orders of magnitude larger than this, so the cached TTL values need no patching.
+constexpr chip::System::Clock::Timestamp kResponseCacheValidity = chip::System::Clock::Seconds32(5);
+
+/// Flattens a (possibly compressed) serialized QName into length-prefixed labels, so that it
+/// can be stored and compared independently of the packet it was parsed from.
+///
+/// Returns false if the name does not fit (or fails to parse), in which case it is not cacheable.
+bool CopyQName(SerializedQNameIterator name, uint8_t * dest, size_t destSize, uint16_t & outSize)
+{
+    size_t used = 0;
+    while (name.Next())
+    {
+        const char * label = name.Value();
+        size_t labelSize   = strlen(label);
+        if (used + labelSize + 1 > destSize)
+        {
+            return false;
+        }
+        dest[used++] = static_cast<uint8_t>(labelSize);
+        memcpy(dest + used, label, labelSize);
+        used += labelSize;
+    }
+    if (!name.IsValid())
+    {
+        return false;
+    }
+    outSize = static_cast<uint16_t>(used);
+    return true;
+}
+
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_ENTRIES > 0
+
 } // namespace
 namespace Internal {
 
@@ -66,16 +104,64 @@ CHIP_ERROR ResponseSender::AddQueryResponder(QueryResponderBase * queryResponder
         if (mResponder[i] == nullptr || mResponder[i] == queryResponder)
         {
             mResponder[i] = queryResponder;
+            FlushResponseCache();
             return CHIP_NO_ERROR;
         }
     }
     return CHIP_ERROR_NO_MEMORY;
 }
 
-CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * querySource)
+void ResponseSender::FlushResponseCache()
+{
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_ENTRIES > 0
+    for (auto & entry : mResponseCache)
+    {
+        entry.mPacket = nullptr;
+    }
+#endif
+    RebuildQueryPrefilter();
+}
+
+void ResponseSender::RebuildQueryPrefilter()
+{
+    mQueryPrefilter.Clear();
+    for (size_t i = 0; i < kMaxQueryResponders; ++i)
+    {
+        if (mResponder[i] == nullptr)
+        {
+            continue;
+        }
+
+        QueryResponderRecordFilter noFilter;
+        for (auto it = mResponder[i]->begin(&noFilter); it != mResponder[i]->end(); it++)
+        {
+            mQueryPrefilter.AddQName(it->responder->GetQName());
+        }
+    }
+}
+
+CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * querySource,
+                                   bool hasKnownAnswers)
 {
     mSendState.Reset(messageId, query, querySource);
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_ENTRIES > 0
+    mReplyWasSplit = false;
+
+    // Only unicast replies are cached: multicast replies update the per-record multicast
+    // throttling state, so they must always be built live.  Queries carrying known answers
+    // are not answered from the cache either, see Respond() documentation.
+    const bool cacheable = mSendState.SendUnicast() && !hasKnownAnswers;
+    if (cacheable)
+    {
+        CachedResponse * cached = FindCachedResponse(query);
+        if (cached != nullptr)
+        {
+            return SendCachedResponse(*cached);
+        }
+    }
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_ENTRIES > 0
+
     // Responder has a stateful 'additional replies required' that is used within the response
     // loop. 'no additionals required' is set at the start and additionals are marked as the query
     // reply is built.
@@ -87,6 +173,9 @@ CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query,
         }
     }
 
+    // The reply is built fresh, so no host address records have been encoded yet.
+    mSentAddressNameCount = 0;
+
     // send all 'Answer' replies
     {
         const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
@@ -112,10 +201,13 @@ CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query,
             }
             for (auto it = mResponder[i]->begin(&responseFilter); it != mResponder[i]->end(); it++)
             {
-                it->responder->AddAllResponses(querySource, this);
-                ReturnErrorOnFailure(mSendState.GetError());
+                if (!ShouldSuppressAddressRecords(*it->responder))
+                {
+                    it->responder->AddAllResponses(querySource, this);
+                    ReturnErrorOnFailure(mSendState.GetError());
 
-                mResponder[i]->MarkAdditionalRepliesFor(it);
+                    mResponder[i]->MarkAdditionalRepliesFor(it);
+                }
 
                 if (!mSendState.SendUnicast())
                 {
@@ -145,15 +237,139 @@ CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query,
             }
             for (auto it = mResponder[i]->begin(&responseFilter); it != mResponder[i]->end(); it++)
             {
+                if (ShouldSuppressAddressRecords(*it->responder))
+                {
+                    continue;
+                }
                 it->responder->AddAllResponses(querySource, this);
                 ReturnErrorOnFailure(mSendState.GetError());
             }
         }
     }
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_ENTRIES > 0
+    // Replies that were split over several packets are not cacheable: all but the last
+    // packet have already been sent.
+    if (cacheable && !mReplyWasSplit && mResponseBuilder.HasPacketBuffer() && mResponseBuilder.HasResponseRecords())
+    {
+        StoreCachedResponse(query);
+    }
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_ENTRIES > 0
+
     return FlushReply();
 }
 
+bool ResponseSender::ShouldSuppressAddressRecords(const Responder & responder)
+{
+    const QType qtype = responder.GetQType();
+    if ((qtype != QType::A) && (qtype != QType::AAAA))
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < mSentAddressNameCount; ++i)
+    {
+        if ((mSentAddressNames[i].qtype == qtype) && (mSentAddressNames[i].qname == responder.GetQName()))
+        {
+            return true;
+        }
+    }
+
+    // If more distinct names are served than can be tracked, the extra ones are simply
+    // not deduplicated; duplicate records are valid, just wasteful.
+    if (mSentAddressNameCount < kMaxQueryResponders)
+    {
+        mSentAddressNames[mSentAddressNameCount].qtype = qtype;
+        mSentAddressNames[mSentAddressNameCount].qname = responder.GetQName();
+        mSentAddressNameCount++;
+    }
+
+    return false;
+}
+
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_ENTRIES > 0
+
+ResponseSender::CachedResponse * ResponseSender::FindCachedResponse(const QueryData & query)
+{
+    uint8_t qname[kResponseCacheMaxQNameSize];
+    uint16_t qnameSize;
+    if (!CopyQName(query.GetName(), qname, sizeof(qname), qnameSize))
+    {
+        return nullptr;
+    }
+
+    const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
+    for (auto & entry : mResponseCache)
+    {
+        if (entry.mPacket.IsNull())
+        {
+            continue;
+        }
+        if (kTimeNow - entry.mBuiltAt > kResponseCacheValidity)
+        {
+            entry.mPacket = nullptr;
+            continue;
+        }
+        if (entry.mType == query.GetType() && entry.mClass == query.GetClass() &&
+            entry.mUnicastRequested == query.RequestedUnicastAnswer() && entry.mIncludesQuery == mSendState.IncludeQuery() &&
+            entry.mInterfaceId == mSendState.GetSourceInterfaceId() &&
+            entry.mAddressType == mSendState.GetSourceAddress().Type() && entry.mQNameSize == qnameSize &&
+            memcmp(entry.mQName, qname, qnameSize) == 0)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void ResponseSender::StoreCachedResponse(const QueryData & query)
+{
+    CachedResponse & entry = mResponseCache[mResponseCacheNextEviction];
+
+    if (!CopyQName(query.GetName(), entry.mQName, sizeof(entry.mQName), entry.mQNameSize))
+    {
+        return;
+    }
+
+    chip::System::PacketBufferHandle copy = mResponseBuilder.GetPacket().CloneData();
+    if (copy.IsNull())
+    {
+        entry.mPacket = nullptr;
+        return;
+    }
+
+    entry.mPacket           = std::move(copy);
+    entry.mBuiltAt          = chip::System::SystemClock().GetMonotonicTimestamp();
+    entry.mInterfaceId      = mSendState.GetSourceInterfaceId();
+    entry.mAddressType      = mSendState.GetSourceAddress().Type();
+    entry.mType             = query.GetType();
+    entry.mClass            = query.GetClass();
+    entry.mUnicastRequested = query.RequestedUnicastAnswer();
+    entry.mIncludesQuery    = mSendState.IncludeQuery();
+
+    mResponseCacheNextEviction = (mResponseCacheNextEviction + 1) % CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_ENTRIES;
+}
+
+CHIP_ERROR ResponseSender::SendCachedResponse(const CachedResponse & response)
+{
+    chip::System::PacketBufferHandle copy = response.mPacket.CloneData();
+    ReturnErrorCodeIf(copy.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    // The reply is byte-for-byte reusable except for the message id, which must echo the
+    // query being answered.
+    HeaderRef(copy->Start()).SetMessageId(static_cast<uint16_t>(mSendState.GetMessageId()));
+
+    char srcAddressString[chip::Inet::IPAddress::kMaxStringLength];
+    VerifyOrDie(mSendState.GetSourceAddress().ToString(srcAddressString) != nullptr);
+    ChipLogDetail(Discovery, "Replying to mDns query from %s on port %d from the response cache", srcAddressString,
+                  mSendState.GetSourcePort());
+
+    return mServer->DirectSend(std::move(copy), mSendState.GetSourceAddress(), mSendState.GetSourcePort(),
+                               mSendState.GetSourceInterfaceId());
+}
+
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_ENTRIES > 0
+
 CHIP_ERROR ResponseSender::FlushReply()
 {
     ReturnErrorCodeIf(!mResponseBuilder.HasPacketBuffer(), CHIP_NO_ERROR); // nothing to flush
@@ -198,6 +414,29 @@ CHIP_ERROR ResponseSender::PrepareNewReplyPacket()
 }
 
 void ResponseSender::AddResponse(const ResourceRecord & record)
+{
+    // RFC 6762 10.2: unique records in gratuitous announcements carry the
+    // cache-flush bit so peers replace stale data immediately.  PTR records
+    // are shared and never set it, and ordinary query replies leave the bit
+    // alone.  The record objects are only ever used on the CHIP thread, so
+    // the bit is toggled around serialization and restored afterwards.
+    const bool setCacheFlush = (mSendState.GetQuery() != nullptr) && mSendState.GetQuery()->IsBootAdvertising() &&
+        (record.GetType() != QType::PTR) && !record.GetCacheFlush();
+
+    if (setCacheFlush)
+    {
+        const_cast<ResourceRecord &>(record).SetCacheFlush(true);
+    }
+
+    AddResponseRecord(record);
+
+    if (setCacheFlush)
+    {
+        const_cast<ResourceRecord &>(record).SetCacheFlush(false);
+    }
+}
+
+void ResponseSender::AddResponseRecord(const ResourceRecord & record)
 {
     RETURN_IF_ERROR(mSendState.GetError());
 
@@ -222,6 +461,10 @@ void ResponseSender::AddResponse(const ResourceRecord & record)
     {
         mResponseBuilder.Header().SetFlags(mResponseBuilder.Header().GetFlags().SetTruncated(true));
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_ENTRIES > 0
+        mReplyWasSplit = true;
+#endif
+
         RETURN_IF_ERROR(mSendState.SetError(FlushReply()));
         RETURN_IF_ERROR(mSendState.SetError(PrepareNewReplyPacket()));
 
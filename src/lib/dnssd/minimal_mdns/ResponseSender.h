@@ -21,8 +21,11 @@
 #include "ResponseBuilder.h"
 #include "Server.h"
 
+#include <lib/core/CHIPConfig.h>
+#include <lib/dnssd/minimal_mdns/QNameBloomFilter.h>
 #include <lib/dnssd/minimal_mdns/responders/QueryResponder.h>
 
+#include <system/SystemClock.h>
 #include <system/SystemPacketBuffer.h>
 
 namespace mdns {
@@ -95,7 +98,22 @@ public:
     CHIP_ERROR AddQueryResponder(QueryResponderBase * queryResponder);
 
     /// Send back the response to a particular query
-    CHIP_ERROR Respond(uint32_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * querySource);
+    ///
+    /// [hasKnownAnswers] marks that the query carried records in its answer section.  Such
+    /// queries bypass the serialized response cache, since the correct reply may omit records
+    /// the querier already holds.
+    CHIP_ERROR Respond(uint32_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * querySource,
+                       bool hasKnownAnswers = false);
+
+    /// Drops any cached serialized replies and rebuilds the query prefilter.
+    ///
+    /// Must be called whenever the records served by the registered query responders change.
+    void FlushResponseCache();
+
+    /// Cheap pre-parse check of a raw mDNS packet against the labels of all
+    /// served records; packets for which this returns false cannot produce a
+    /// reply, so full parsing can be skipped.
+    bool QuestionsMayMatch(const BytesRange & packet) const { return mQueryPrefilter.QuestionsMayMatch(packet); }
 
     // Implementation of ResponderDelegate
     void AddResponse(const ResourceRecord & record) override;
@@ -103,15 +121,69 @@ public:
     void SetServer(ServerBase * server) { mServer = server; }
 
 private:
+    void AddResponseRecord(const ResourceRecord & record);
+
     CHIP_ERROR FlushReply();
     CHIP_ERROR PrepareNewReplyPacket();
 
+    void RebuildQueryPrefilter();
+
+    /// Check whether [responder] serves host address (A/AAAA) records whose name was
+    /// already encoded in the reply being built, recording the name otherwise.
+    ///
+    /// Each query responder allocator registers its own A/AAAA responders, all under the
+    /// device hostname, so a reply spanning several allocators (e.g. several operational
+    /// fabrics) would otherwise carry one copy of every address record per allocator.
+    bool ShouldSuppressAddressRecords(const Responder & responder);
+
     ServerBase * mServer;
     QueryResponderBase * mResponder[kMaxQueryResponders] = {};
+    QNameBloomFilter mQueryPrefilter;
+
+    // Names of host address records already encoded in the reply being built, tracked
+    // per record type so that duplicates across query responder allocators are encoded
+    // only once.  Reset at the start of each Respond() call.
+    struct SentAddressName
+    {
+        QType qtype;
+        FullQName qname;
+    };
+    SentAddressName mSentAddressNames[kMaxQueryResponders] = {};
+    size_t mSentAddressNameCount                           = 0;
 
     /// Current send state
     ResponseBuilder mResponseBuilder;          // packet being built
     Internal::ResponseSendingState mSendState; // sending state
+
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_ENTRIES > 0
+    // A/AAAA answers depend on the interface a query arrived on, so cached replies are keyed
+    // by the query contents as well as the reply destination properties.  The qname is stored
+    // flattened (length-prefixed labels) since the original may use compression pointers into
+    // the query packet.
+    static constexpr size_t kResponseCacheMaxQNameSize = 128;
+
+    struct CachedResponse
+    {
+        chip::System::PacketBufferHandle mPacket; // prebuilt reply; null marks an unused entry
+        chip::System::Clock::Timestamp mBuiltAt;
+        chip::Inet::InterfaceId mInterfaceId;
+        chip::Inet::IPAddressType mAddressType;
+        QType mType;
+        QClass mClass;
+        bool mUnicastRequested;
+        bool mIncludesQuery;
+        uint16_t mQNameSize;
+        uint8_t mQName[kResponseCacheMaxQNameSize];
+    };
+
+    CachedResponse * FindCachedResponse(const QueryData & query);
+    void StoreCachedResponse(const QueryData & query);
+    CHIP_ERROR SendCachedResponse(const CachedResponse & response);
+
+    CachedResponse mResponseCache[CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_ENTRIES];
+    size_t mResponseCacheNextEviction = 0; // round-robin eviction
+    bool mReplyWasSplit               = false;
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_ENTRIES > 0
 };
 
 } // namespace Minimal
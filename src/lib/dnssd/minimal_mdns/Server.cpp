@@ -234,6 +234,9 @@ CHIP_ERROR ServerBase::Listen(chip::Inet::EndPointManager<chip::Inet::UDPEndPoin
 
         ReturnErrorOnFailure(listenUdp->Listen(OnUdpPacketReceived, nullptr /*OnReceiveError*/, this));
 
+        // mDNS chatter is latency-tolerant; keep it off the lanes used by Matter traffic.
+        ReturnErrorOnFailure(listenUdp->SetSocketWatchPriority(chip::System::SocketWatchPriority::kBackground));
+
         CHIP_ERROR err = JoinMulticastGroup(interfaceId, listenUdp, addressType);
         if (err != CHIP_NO_ERROR)
         {
@@ -255,6 +258,7 @@ CHIP_ERROR ServerBase::Listen(chip::Inet::EndPointManager<chip::Inet::UDPEndPoin
         std::unique_ptr<chip::Inet::UDPEndPoint, EndpointInfo::EndPointDeletor> endPointHolderUnicast(unicastQueryUdp, {});
         ReturnErrorOnFailure(unicastQueryUdp->Bind(addressType, chip::Inet::IPAddress::Any, 0, interfaceId));
         ReturnErrorOnFailure(unicastQueryUdp->Listen(OnUdpPacketReceived, nullptr /*OnReceiveError*/, this));
+        ReturnErrorOnFailure(unicastQueryUdp->SetSocketWatchPriority(chip::System::SocketWatchPriority::kBackground));
 #endif
 
 #if CHIP_MINMDNS_USE_EPHEMERAL_UNICAST_PORT
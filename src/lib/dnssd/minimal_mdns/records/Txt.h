@@ -19,6 +19,7 @@
 
 #include <string.h>
 
+#include <lib/dnssd/minimal_mdns/core/BytesRange.h>
 #include <lib/dnssd/minimal_mdns/records/ResourceRecord.h>
 
 namespace mdns {
@@ -33,6 +34,7 @@ public:
         ResourceRecord(QType::TXT, qName), mEntries(entries), mEntryCount(entryCount)
     {
         SetTtl(kDefaultTtl);
+        RenderEntries();
     }
 
     template <size_t N>
@@ -40,6 +42,7 @@ public:
         ResourceRecord(QType::TXT, qName), mEntries(entries), mEntryCount(N)
     {
         SetTtl(kDefaultTtl);
+        RenderEntries();
     }
 
     // A FullQName is a holder of a string array.
@@ -47,6 +50,7 @@ public:
         ResourceRecord(QType::TXT, qName), mEntries(entries.names), mEntryCount(entries.nameCount)
     {
         SetTtl(kDefaultTtl);
+        RenderEntries();
     }
     size_t GetNumEntries() const { return mEntryCount; }
     const char * const * GetEntries() const { return mEntries; }
@@ -54,6 +58,16 @@ public:
 protected:
     bool WriteData(RecordWriter & out) const override
     {
+        // Common case: the RDATA was rendered once when the record was built (i.e.
+        // at advertise time), so serving a query is a single copy. TXT data never
+        // contains qnames, so the rendered bytes are position-independent and can
+        // be replayed into any response.
+        if (mRenderedLength > 0 || mEntryCount == 0)
+        {
+            out.Put(BytesRange(mRenderedData, mRenderedData + mRenderedLength));
+            return out.Fit();
+        }
+
         for (size_t i = 0; i < mEntryCount; i++)
         {
             size_t len = strlen(mEntries[i]);
@@ -68,10 +82,35 @@ protected:
     }
 
 private:
+    /// Pre-renders the length-prefixed entry list so that per-query serialization
+    /// does not re-walk the strings. Leaves mRenderedLength at 0 (deferring to the
+    /// per-entry path in WriteData) if the entries do not fit the internal buffer.
+    void RenderEntries()
+    {
+        size_t offset = 0;
+        for (size_t i = 0; i < mEntryCount; i++)
+        {
+            size_t len = strlen(mEntries[i]);
+            if ((len > kMaxTxtRecordLength) || (offset + len + 1 > sizeof(mRenderedData)))
+            {
+                mRenderedLength = 0;
+                return;
+            }
+            mRenderedData[offset++] = static_cast<uint8_t>(len);
+            memcpy(&mRenderedData[offset], mEntries[i], len);
+            offset += len;
+        }
+        mRenderedLength = offset;
+    }
+
     const char * const * mEntries;
     const size_t mEntryCount;
 
     static constexpr size_t kMaxTxtRecordLength = 63;
+    static constexpr size_t kMaxRenderedLength  = 256;
+
+    uint8_t mRenderedData[kMaxRenderedLength];
+    size_t mRenderedLength = 0;
 };
 
 } // namespace Minimal
@@ -68,9 +68,36 @@ void TestTxt(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, memcmp(dataBuffer, expectedOutput, sizeof(expectedOutput)) == 0);
 }
 
+void TestTxtTooLongEntry(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t headerBuffer[HeaderRef::kSizeBytes];
+    uint8_t dataBuffer[256];
+
+    const QNamePart kName[] = { "some", "test", "local" };
+
+    // Entries longer than 63 bytes are not valid TXT data and must be rejected
+    // rather than written truncated.
+    const char * kData[] = {
+        "a=b",
+        "x=0123456789012345678901234567890123456789012345678901234567890123456789",
+    };
+
+    HeaderRef header(headerBuffer);
+
+    BigEndian::BufferWriter output(dataBuffer, sizeof(dataBuffer));
+    RecordWriter writer(&output);
+
+    TxtResourceRecord record(kName, kData);
+
+    header.Clear();
+
+    NL_TEST_ASSERT(inSuite, !record.Append(header, ResourceType::kAdditional, writer));
+}
+
 const nlTest sTests[] = {
-    NL_TEST_DEF("TestTxt", TestTxt), //
-    NL_TEST_SENTINEL()               //
+    NL_TEST_DEF("TestTxt", TestTxt),                         //
+    NL_TEST_DEF("TestTxtTooLongEntry", TestTxtTooLongEntry), //
+    NL_TEST_SENTINEL()                                       //
 };
 
 } // namespace
@@ -25,6 +25,7 @@
 #include <lib/dnssd/MinimalMdnsServer.h>
 #include <lib/dnssd/minimal_mdns/RecordData.h>
 #include <lib/dnssd/minimal_mdns/Server.h>
+#include <lib/dnssd/minimal_mdns/records/IP.h>
 #include <lib/dnssd/minimal_mdns/records/Ptr.h>
 #include <lib/dnssd/minimal_mdns/records/Srv.h>
 #include <lib/dnssd/minimal_mdns/records/Txt.h>
@@ -260,6 +261,16 @@ public:
         }
         info->target = srv->GetServerName();
     }
+    void AddExpectedRecord(IPResourceRecord * ip)
+    {
+        RecordInfo * info = AddExpectedRecordBase(ip);
+        NL_TEST_ASSERT(mInSuite, info != nullptr);
+        if (info == nullptr)
+        {
+            return;
+        }
+        info->target = kIgnoreQname;
+    }
     void AddExpectedRecord(TxtResourceRecord * txt)
     {
         RecordInfo * info = AddExpectedRecordBase(txt);
@@ -107,6 +107,33 @@ void TestRescheduleSamePeerId(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, attempts.GetTimeUntilNextExpectedResponse() == Optional<Timeout>(1000_ms32));
 }
 
+void TestInitialUnicastAttempt(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock mockClock;
+    mdns::Minimal::ActiveResolveAttempts attempts(&mockClock);
+
+    mockClock.AdvanceMonotonic(4321_ms32);
+
+    // A pending peer whose initial query went unicast is not due immediately;
+    // the multicast fallback is scheduled kUnicastFallbackDelay out.
+    attempts.MarkPending(MakePeerId(1));
+    attempts.MarkInitialUnicastAttempt(MakePeerId(1));
+
+    NL_TEST_ASSERT(inSuite, attempts.GetTimeUntilNextExpectedResponse() == Optional<Timeout>(250_ms32));
+    NL_TEST_ASSERT(inSuite, !attempts.NextScheduledPeer().HasValue());
+
+    // Once the fallback delay elapses, the regular multicast schedule takes
+    // over: first query now, next retry after one second.
+    mockClock.AdvanceMonotonic(250_ms32);
+    NL_TEST_ASSERT(inSuite, attempts.NextScheduledPeer() == Optional<PeerId>::Value(MakePeerId(1)));
+    NL_TEST_ASSERT(inSuite, !attempts.NextScheduledPeer().HasValue());
+    NL_TEST_ASSERT(inSuite, attempts.GetTimeUntilNextExpectedResponse() == Optional<Timeout>(1000_ms32));
+
+    // Marking an unknown peer is a no-op.
+    attempts.MarkInitialUnicastAttempt(MakePeerId(2));
+    NL_TEST_ASSERT(inSuite, attempts.GetTimeUntilNextExpectedResponse() == Optional<Timeout>(1000_ms32));
+}
+
 void TestLRU(nlTestSuite * inSuite, void * inContext)
 {
     // validates that the LRU logic is working
@@ -238,11 +265,12 @@ void TestNextPeerOrdering(nlTestSuite * inSuite, void * inContext)
 }
 
 const nlTest sTests[] = {
-    NL_TEST_DEF("TestSinglePeerAddRemove", TestSinglePeerAddRemove),   //
-    NL_TEST_DEF("TestRescheduleSamePeerId", TestRescheduleSamePeerId), //
-    NL_TEST_DEF("TestLRU", TestLRU),                                   //
-    NL_TEST_DEF("TestNextPeerOrdering", TestNextPeerOrdering),         //
-    NL_TEST_SENTINEL()                                                 //
+    NL_TEST_DEF("TestSinglePeerAddRemove", TestSinglePeerAddRemove),     //
+    NL_TEST_DEF("TestRescheduleSamePeerId", TestRescheduleSamePeerId),   //
+    NL_TEST_DEF("TestInitialUnicastAttempt", TestInitialUnicastAttempt), //
+    NL_TEST_DEF("TestLRU", TestLRU),                                     //
+    NL_TEST_DEF("TestNextPeerOrdering", TestNextPeerOrdering),           //
+    NL_TEST_SENTINEL()                                                   //
 };
 
 } // namespace
@@ -0,0 +1,170 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <lib/dnssd/minimal_mdns/QNameBloomFilter.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+#include <string.h>
+
+namespace {
+
+using namespace mdns::Minimal;
+
+const QNamePart kMatterCommissionName[] = { "_matterc", "_udp", "local" };
+const QNamePart kOperationalName[]      = { "ABCD1234-5678DEF0", "_matter", "_tcp", "local" };
+const QNamePart kDnsSdName[]            = { "_services", "_dns-sd", "_udp", "local" };
+
+/// Builds a single-question query packet for the given serialized qname.
+template <size_t N>
+size_t BuildQueryPacket(const uint8_t (&qname)[N], uint8_t * packet, size_t packetSize)
+{
+    memset(packet, 0, packetSize);
+    packet[5] = 1; // QDCOUNT = 1
+    memcpy(packet + 12, qname, N);
+    packet[12 + N + 1] = 255; // QTYPE = ANY
+    packet[12 + N + 3] = 1;   // QCLASS = IN
+    return 12 + N + 4;
+}
+
+void TestEmptyFilterPassesEverything(nlTestSuite * inSuite, void * inContext)
+{
+    QNameBloomFilter filter;
+    NL_TEST_ASSERT(inSuite, filter.IsEmpty());
+
+    const uint8_t qname[] = {
+        9, '_', 'a', 'i', 'r', 'p', 'l', 'a', 'y', //
+        4, '_', 't', 'c', 'p',                     //
+        5, 'l', 'o', 'c', 'a', 'l',                //
+        0                                          //
+    };
+    uint8_t packet[64];
+    size_t size = BuildQueryPacket(qname, packet, sizeof(packet));
+
+    NL_TEST_ASSERT(inSuite, filter.QuestionsMayMatch(BytesRange(packet, packet + size)));
+}
+
+void TestMatchingQueriesPass(nlTestSuite * inSuite, void * inContext)
+{
+    QNameBloomFilter filter;
+    filter.AddQName(FullQName(kMatterCommissionName));
+    filter.AddQName(FullQName(kOperationalName));
+    filter.AddQName(FullQName(kDnsSdName));
+    NL_TEST_ASSERT(inSuite, !filter.IsEmpty());
+
+    const uint8_t commissionQuery[] = {
+        8, '_', 'm', 'a', 't', 't', 'e', 'r', 'c', //
+        4, '_', 'u', 'd', 'p',                     //
+        5, 'l', 'o', 'c', 'a', 'l',                //
+        0                                          //
+    };
+    // Case differences must not affect matching.
+    const uint8_t commissionQueryUpper[] = {
+        8, '_', 'M', 'A', 'T', 'T', 'E', 'R', 'C', //
+        4, '_', 'U', 'D', 'P',                     //
+        5, 'L', 'O', 'C', 'A', 'L',                //
+        0                                          //
+    };
+    const uint8_t dnsSdQuery[] = {
+        9, '_', 's', 'e', 'r', 'v', 'i', 'c', 'e', 's',     //
+        7, '_', 'd', 'n', 's', '-', 's', 'd',               //
+        4, '_', 'u', 'd', 'p',                              //
+        5, 'l', 'o', 'c', 'a', 'l',                         //
+        0                                                   //
+    };
+
+    uint8_t packet[96];
+    size_t size = BuildQueryPacket(commissionQuery, packet, sizeof(packet));
+    NL_TEST_ASSERT(inSuite, filter.QuestionsMayMatch(BytesRange(packet, packet + size)));
+
+    size = BuildQueryPacket(commissionQueryUpper, packet, sizeof(packet));
+    NL_TEST_ASSERT(inSuite, filter.QuestionsMayMatch(BytesRange(packet, packet + size)));
+
+    size = BuildQueryPacket(dnsSdQuery, packet, sizeof(packet));
+    NL_TEST_ASSERT(inSuite, filter.QuestionsMayMatch(BytesRange(packet, packet + size)));
+}
+
+void TestUnrelatedQueriesDrop(nlTestSuite * inSuite, void * inContext)
+{
+    QNameBloomFilter filter;
+    filter.AddQName(FullQName(kMatterCommissionName));
+    filter.AddQName(FullQName(kOperationalName));
+    filter.AddQName(FullQName(kDnsSdName));
+
+    // Typical LAN noise: only generic labels overlap with our names.
+    const uint8_t chromecastQuery[] = {
+        11, '_', 'g', 'o', 'o', 'g', 'l', 'e', 'c', 'a', 's', 't', //
+        4,  '_', 't', 'c', 'p',                                    //
+        5,  'l', 'o', 'c', 'a', 'l',                               //
+        0                                                          //
+    };
+    const uint8_t printerQuery[] = {
+        4, '_', 'i', 'p', 'p',      //
+        4, '_', 't', 'c', 'p',      //
+        5, 'l', 'o', 'c', 'a', 'l', //
+        0                           //
+    };
+
+    uint8_t packet[96];
+    size_t size = BuildQueryPacket(chromecastQuery, packet, sizeof(packet));
+    NL_TEST_ASSERT(inSuite, !filter.QuestionsMayMatch(BytesRange(packet, packet + size)));
+
+    size = BuildQueryPacket(printerQuery, packet, sizeof(packet));
+    NL_TEST_ASSERT(inSuite, !filter.QuestionsMayMatch(BytesRange(packet, packet + size)));
+}
+
+void TestUnparseablePacketsPass(nlTestSuite * inSuite, void * inContext)
+{
+    QNameBloomFilter filter;
+    filter.AddQName(FullQName(kMatterCommissionName));
+
+    // Too short for a DNS header.
+    const uint8_t shortPacket[] = { 1, 2, 3 };
+    NL_TEST_ASSERT(inSuite, filter.QuestionsMayMatch(BytesRange(shortPacket, shortPacket + sizeof(shortPacket))));
+
+    // Compressed qname: the prefilter must defer to the full parser.
+    const uint8_t compressedQname[] = { 0xC0, 0x0C };
+    uint8_t packet[64];
+    size_t size = BuildQueryPacket(compressedQname, packet, sizeof(packet));
+    NL_TEST_ASSERT(inSuite, filter.QuestionsMayMatch(BytesRange(packet, packet + size)));
+
+    // Truncated mid-label.
+    uint8_t truncated[16];
+    memset(truncated, 0, sizeof(truncated));
+    truncated[5]  = 1;  // QDCOUNT = 1
+    truncated[12] = 30; // label length runs past the end of the packet
+    NL_TEST_ASSERT(inSuite, filter.QuestionsMayMatch(BytesRange(truncated, truncated + sizeof(truncated))));
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestEmptyFilterPassesEverything", TestEmptyFilterPassesEverything), //
+    NL_TEST_DEF("TestMatchingQueriesPass", TestMatchingQueriesPass),                 //
+    NL_TEST_DEF("TestUnrelatedQueriesDrop", TestUnrelatedQueriesDrop),               //
+    NL_TEST_DEF("TestUnparseablePacketsPass", TestUnparseablePacketsPass),           //
+    NL_TEST_SENTINEL()                                                               //
+};
+
+} // namespace
+
+int TestQNameBloomFilter(void)
+{
+    nlTestSuite theSuite = { "QNameBloomFilter", sTests, nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestQNameBloomFilter)
@@ -22,6 +22,7 @@
 #include <lib/dnssd/minimal_mdns/RecordData.h>
 #include <lib/dnssd/minimal_mdns/core/FlatAllocatedQName.h>
 #include <lib/dnssd/minimal_mdns/core/RecordWriter.h>
+#include <lib/dnssd/minimal_mdns/records/IP.h>
 #include <lib/dnssd/minimal_mdns/responders/Ptr.h>
 #include <lib/dnssd/minimal_mdns/responders/Srv.h>
 #include <lib/dnssd/minimal_mdns/responders/Txt.h>
@@ -339,6 +340,61 @@ void PtrSrvTxtMultipleRespondersToServiceListing(nlTestSuite * inSuite, void * i
     NL_TEST_ASSERT(inSuite, common1.server.GetHeaderFound());
 }
 
+/// Serves a fixed AAAA record, standing in for IPv6Responder whose records depend on
+/// the host machine's interface configuration.
+class FixedAddressResponder : public RecordResponder
+{
+public:
+    FixedAddressResponder(const FullQName & qname, const IPResourceRecord & record) :
+        RecordResponder(QType::AAAA, qname), mRecord(record)
+    {}
+
+    void AddAllResponses(const Inet::IPPacketInfo * source, ResponderDelegate * delegate) override
+    {
+        delegate->AddResponse(mRecord);
+    }
+
+private:
+    const IPResourceRecord & mRecord;
+};
+
+void DuplicateAddressRecordsSentOnce(nlTestSuite * inSuite, void * inContext)
+{
+    CommonTestElements common1(inSuite, "test1");
+    CommonTestElements common2(inSuite, "test2");
+
+    Inet::IPAddress addr;
+    NL_TEST_ASSERT(inSuite, Inet::IPAddress::FromString("fe80::1", addr));
+
+    // Both query responders serve address records under the SAME host name, as happens
+    // when several operational fabrics advertise through separate allocators.
+    IPResourceRecord addressRecord(common1.host, addr);
+    FixedAddressResponder addressResponder1(common1.host, addressRecord);
+    FixedAddressResponder addressResponder2(common1.host, addressRecord);
+
+    // Just use the server from common1.
+    ResponseSender responseSender(&common1.server);
+
+    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&common1.queryResponder) == CHIP_NO_ERROR);
+    common1.queryResponder.AddResponder(&addressResponder1);
+
+    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&common2.queryResponder) == CHIP_NO_ERROR);
+    common2.queryResponder.AddResponder(&addressResponder2);
+
+    // Build a query for the host name.
+    common1.recordWriter.WriteQName(common1.host);
+    QueryData queryData = QueryData(QType::AAAA, QClass::IN, false, common1.requestNameStart, common1.requestBytesRange);
+
+    // Expect the address record exactly once; CheckOnlyServer verifies the total
+    // record count, so a duplicate would fail the test.
+    common1.server.AddExpectedRecord(&addressRecord);
+
+    responseSender.Respond(1, queryData, &common1.packetInfo);
+
+    NL_TEST_ASSERT(inSuite, common1.server.GetSendCalled());
+    NL_TEST_ASSERT(inSuite, common1.server.GetHeaderFound());
+}
+
 const nlTest sTests[] = {
     NL_TEST_DEF("SrvAnyResponseToInstance", SrvAnyResponseToInstance),                                       //
     NL_TEST_DEF("SrvTxtAnyResponseToInstance", SrvTxtAnyResponseToInstance),                                 //
@@ -350,6 +406,7 @@ const nlTest sTests[] = {
     NL_TEST_DEF("AddManyQueryResponders", AddManyQueryResponders),                                           //
     NL_TEST_DEF("PtrSrvTxtMultipleRespondersToInstance", PtrSrvTxtMultipleRespondersToInstance),             //
     NL_TEST_DEF("PtrSrvTxtMultipleRespondersToServiceListing", PtrSrvTxtMultipleRespondersToServiceListing), //
+    NL_TEST_DEF("DuplicateAddressRecordsSentOnce", DuplicateAddressRecordsSentOnce),                         //
 
     NL_TEST_SENTINEL() //
 };
@@ -0,0 +1,127 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <nlunit-test.h>
+
+#include <inet/IPAddress.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/PeerId.h>
+#include <lib/dnssd/PersistedAddressCache.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/UnitTestRegistration.h>
+
+using namespace chip;
+using namespace chip::Dnssd;
+
+namespace {
+
+constexpr uint64_t kKnownFabric = 0x100;
+constexpr NodeId kKnownNode     = 0x200;
+
+PeerId KnownPeer()
+{
+    PeerId peerId;
+    peerId.SetCompressedFabricId(kKnownFabric);
+    peerId.SetNodeId(kKnownNode);
+    return peerId;
+}
+
+void TestStoreAndLookup(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistentStorageDelegate storage;
+    PersistedAddressCache cache;
+
+    NL_TEST_ASSERT(inSuite, cache.Init(&storage) == CHIP_NO_ERROR);
+
+    ResolvedNodeData nodeData;
+    nodeData.mPeerId = KnownPeer();
+    nodeData.mPort   = 11097;
+    NL_TEST_ASSERT(inSuite, Inet::IPAddress::FromString("fd00::1234", nodeData.mAddress[nodeData.mNumIPs++]));
+    nodeData.mMrpRetryIntervalIdle.SetValue(System::Clock::Milliseconds32(5000));
+
+    NL_TEST_ASSERT(inSuite, cache.Store(nodeData) == CHIP_NO_ERROR);
+
+    ResolvedNodeData nodeDataOut;
+    bool isStale = false;
+    NL_TEST_ASSERT(inSuite, cache.Lookup(KnownPeer(), nodeDataOut, isStale) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, nodeDataOut.mPeerId == KnownPeer());
+    NL_TEST_ASSERT(inSuite, nodeDataOut.mNumIPs == 1);
+    NL_TEST_ASSERT(inSuite, nodeDataOut.mAddress[0] == nodeData.mAddress[0]);
+    NL_TEST_ASSERT(inSuite, nodeDataOut.mPort == nodeData.mPort);
+    NL_TEST_ASSERT(inSuite, nodeDataOut.mMrpRetryIntervalIdle.HasValue());
+    NL_TEST_ASSERT(inSuite, nodeDataOut.mMrpRetryIntervalIdle.Value() == System::Clock::Milliseconds32(5000));
+    NL_TEST_ASSERT(inSuite, !nodeDataOut.mMrpRetryIntervalActive.HasValue());
+}
+
+void TestPrefersRoutableAddress(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistentStorageDelegate storage;
+    PersistedAddressCache cache;
+
+    NL_TEST_ASSERT(inSuite, cache.Init(&storage) == CHIP_NO_ERROR);
+
+    ResolvedNodeData nodeData;
+    nodeData.mPeerId = KnownPeer();
+    nodeData.mPort   = 11097;
+    NL_TEST_ASSERT(inSuite, Inet::IPAddress::FromString("fe80::1", nodeData.mAddress[nodeData.mNumIPs++]));
+    NL_TEST_ASSERT(inSuite, Inet::IPAddress::FromString("fd00::1234", nodeData.mAddress[nodeData.mNumIPs++]));
+
+    NL_TEST_ASSERT(inSuite, cache.Store(nodeData) == CHIP_NO_ERROR);
+
+    ResolvedNodeData nodeDataOut;
+    bool isStale = false;
+    NL_TEST_ASSERT(inSuite, cache.Lookup(KnownPeer(), nodeDataOut, isStale) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, nodeDataOut.mAddress[0] == nodeData.mAddress[1]);
+}
+
+void TestMissAndDelete(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistentStorageDelegate storage;
+    PersistedAddressCache cache;
+
+    NL_TEST_ASSERT(inSuite, cache.Init(&storage) == CHIP_NO_ERROR);
+
+    ResolvedNodeData nodeDataOut;
+    bool isStale = false;
+    NL_TEST_ASSERT(inSuite, cache.Lookup(KnownPeer(), nodeDataOut, isStale) != CHIP_NO_ERROR);
+
+    ResolvedNodeData nodeData;
+    nodeData.mPeerId = KnownPeer();
+    nodeData.mPort   = 11097;
+    NL_TEST_ASSERT(inSuite, Inet::IPAddress::FromString("fd00::1234", nodeData.mAddress[nodeData.mNumIPs++]));
+    NL_TEST_ASSERT(inSuite, cache.Store(nodeData) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, cache.Delete(KnownPeer()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.Lookup(KnownPeer(), nodeDataOut, isStale) != CHIP_NO_ERROR);
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("TestStoreAndLookup", TestStoreAndLookup),
+                          NL_TEST_DEF("TestPrefersRoutableAddress", TestPrefersRoutableAddress),
+                          NL_TEST_DEF("TestMissAndDelete", TestMissAndDelete), NL_TEST_SENTINEL() };
+
+} // namespace
+
+int TestPersistedAddressCache(void)
+{
+    nlTestSuite theSuite = { "PersistedAddressCache", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestPersistedAddressCache)
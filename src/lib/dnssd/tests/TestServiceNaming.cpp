@@ -54,6 +54,52 @@ void TestMakeInstanceName(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, MakeInstanceName(buffer, kMinBufferSize, PeerId()) == CHIP_NO_ERROR);
 }
 
+void TestInstanceNameCache(nlTestSuite * inSuite, void * inContext)
+{
+    InstanceNameCache cache;
+
+    const PeerId kPeer1 = PeerId().SetCompressedFabricId(0x1234).SetNodeId(0x5678);
+    const PeerId kPeer2 = PeerId().SetCompressedFabricId(0x1122334455667788ULL).SetNodeId(0x123456789abcdefULL);
+
+    // Formatted names match MakeInstanceName output
+    const char * name1 = cache.Get(kPeer1);
+    NL_TEST_ASSERT(inSuite, name1 != nullptr);
+    NL_TEST_ASSERT(inSuite, strcmp(name1, "0000000000001234-0000000000005678") == 0);
+
+    const char * name2 = cache.Get(kPeer2);
+    NL_TEST_ASSERT(inSuite, name2 != nullptr);
+    NL_TEST_ASSERT(inSuite, strcmp(name2, "1122334455667788-0123456789ABCDEF") == 0);
+
+    // Repeated lookups are interned: same pointer, no re-formatting
+    NL_TEST_ASSERT(inSuite, cache.Get(kPeer1) == name1);
+    NL_TEST_ASSERT(inSuite, cache.Get(kPeer2) == name2);
+
+    // Invalidation drops the entry; the next lookup re-formats correctly
+    cache.Invalidate(kPeer1);
+    const char * name1again = cache.Get(kPeer1);
+    NL_TEST_ASSERT(inSuite, name1again != nullptr);
+    NL_TEST_ASSERT(inSuite, strcmp(name1again, "0000000000001234-0000000000005678") == 0);
+
+    // Filling the cache beyond capacity still returns correct names
+    for (NodeId node = 1; node <= InstanceNameCache::kCacheSize + 1; node++)
+    {
+        const char * name = cache.Get(PeerId().SetCompressedFabricId(0x1234).SetNodeId(node));
+        NL_TEST_ASSERT(inSuite, name != nullptr);
+
+        char expected[Operational::kInstanceNameMaxLength + 1];
+        NL_TEST_ASSERT(inSuite,
+                       MakeInstanceName(expected, sizeof(expected), PeerId().SetCompressedFabricId(0x1234).SetNodeId(node)) ==
+                           CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, strcmp(name, expected) == 0);
+    }
+
+    // Clearing drops everything; lookups still work
+    cache.Clear();
+    const char * name2again = cache.Get(kPeer2);
+    NL_TEST_ASSERT(inSuite, name2again != nullptr);
+    NL_TEST_ASSERT(inSuite, strcmp(name2again, "1122334455667788-0123456789ABCDEF") == 0);
+}
+
 void TestExtractIdFromInstanceName(nlTestSuite * inSuite, void * inContext)
 {
     PeerId peerId;
@@ -271,6 +317,7 @@ void TestMakeServiceTypeName(nlTestSuite * inSuite, void * inContext)
 
 const nlTest sTests[] = {
     NL_TEST_DEF("MakeInstanceName", TestMakeInstanceName),                             //
+    NL_TEST_DEF("InstanceNameCache", TestInstanceNameCache),                           //
     NL_TEST_DEF("ExtractIdFromInstandceName", TestExtractIdFromInstanceName),          //
     NL_TEST_DEF("TestMakeServiceNameSubtype", TestMakeServiceNameSubtype),             //
     NL_TEST_DEF("TestMakeCommisisonableNodeServiceTypeName", TestMakeServiceTypeName), //
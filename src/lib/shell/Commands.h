@@ -44,6 +44,12 @@ void RegisterMetaCommands();
  */
 void RegisterConfigCommands();
 
+/**
+ * This function registers the heap and resource statistics commands.
+ *
+ */
+void RegisterHeapCommands();
+
 /**
  * This function registers the device management commands.
  *
@@ -62,6 +68,30 @@ void RegisterOtaCommands();
  */
 void RegisterOnboardingCodesCommands();
 
+/**
+ * This function registers the event loop profiler commands.
+ *
+ */
+void RegisterProfilerCommands();
+
+/**
+ * This function registers the transport message trace commands.
+ *
+ */
+void RegisterMsgTraceCommands();
+
+/**
+ * This function registers the interaction latency statistics commands.
+ *
+ */
+void RegisterInteractionLatencyCommands();
+
+/**
+ * This function registers the secure session statistics commands.
+ *
+ */
+void RegisterSessionStatsCommands();
+
 /**
  * This function registers the wifi commands.
  *
@@ -0,0 +1,134 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <inttypes.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/shell/Commands.h>
+#include <lib/shell/Engine.h>
+#include <lib/shell/commands/Help.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <system/SystemStats.h>
+
+namespace chip {
+namespace Shell {
+
+static chip::Shell::Engine sShellHeapSubcommands;
+
+CHIP_ERROR HeapHelpHandler(int argc, char ** argv)
+{
+    sShellHeapSubcommands.ForEachCommand(PrintCommandHelp, nullptr);
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR HeapDumpHandler(int argc, char ** argv)
+{
+    streamer_t * sout = streamer_get();
+
+    Platform::HeapStatistics stats;
+    CHIP_ERROR err = Platform::MemoryGetHeapStatistics(stats);
+    if (err == CHIP_ERROR_NOT_IMPLEMENTED)
+    {
+        streamer_printf(sout, "Heap statistics are not available with the configured allocator\r\n");
+    }
+    else if (err != CHIP_NO_ERROR)
+    {
+        return err;
+    }
+    else
+    {
+        streamer_printf(sout, "free=%" PRIu32 " used=%" PRIu32 " largest-free=%" PRIu32 " free-blocks=%" PRIu32
+                              " used-blocks=%" PRIu32 "\r\n",
+                        stats.mFreeBytes, stats.mUsedBytes, stats.mLargestFreeBlockBytes, stats.mFreeBlockCount,
+                        stats.mUsedBlockCount);
+
+        // A heap whose free space is spread over many small blocks cannot serve large
+        // allocations; express that as the fraction of free space outside the largest block.
+        uint32_t fragmentationPercent = 0;
+        if (stats.mFreeBytes != 0)
+        {
+            fragmentationPercent = 100 - static_cast<uint32_t>((100 * static_cast<uint64_t>(stats.mLargestFreeBlockBytes)) /
+                                                               stats.mFreeBytes);
+        }
+        streamer_printf(sout, "fragmentation=%" PRIu32 "%% failed-allocations=%" PRIu32 "\r\n", fragmentationPercent,
+                        stats.mFailedAllocationCount);
+
+        streamer_printf(sout, "alloc-size histogram:");
+        size_t bucketLimit = Platform::HeapStatistics::kSizeBucketBase;
+        for (size_t i = 0; i < Platform::HeapStatistics::kNumSizeBuckets; i++)
+        {
+            if (i < Platform::HeapStatistics::kNumSizeBuckets - 1)
+            {
+                streamer_printf(sout, " <=%u:%" PRIu32, static_cast<unsigned>(bucketLimit), stats.mAllocationCount[i]);
+                bucketLimit *= 2;
+            }
+            else
+            {
+                streamer_printf(sout, " rest:%" PRIu32, stats.mAllocationCount[i]);
+            }
+        }
+        streamer_printf(sout, "\r\n");
+    }
+
+    streamer_printf(sout, "resource in-use watermark\r\n");
+    const System::Stats::Label * labels      = System::Stats::GetStrings();
+    const System::Stats::count_t * inUse     = System::Stats::GetResourcesInUse();
+    const System::Stats::count_t * watermark = System::Stats::GetHighWatermarks();
+    for (int i = 0; i < System::Stats::kNumEntries; i++)
+    {
+        streamer_printf(sout, "%s %" PRI_CHIP_SYS_STATS_COUNT " %" PRI_CHIP_SYS_STATS_COUNT "\r\n", labels[i], inUse[i],
+                        watermark[i]);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR HeapHandler(int argc, char ** argv)
+{
+    switch (argc)
+    {
+    case 0:
+        return HeapDumpHandler(argc, argv);
+    case 1:
+        if ((strcmp(argv[0], "help") == 0) || (strcmp(argv[0], "-h") == 0))
+        {
+            return HeapHelpHandler(argc, argv);
+        }
+    }
+    return sShellHeapSubcommands.ExecCommand(argc, argv);
+}
+
+void RegisterHeapCommands()
+{
+    static const shell_command_t sHeapComand = { &HeapHandler, "heap",
+                                                 "Dump heap usage, fragmentation and allocation-size histogram along with "
+                                                 "per-subsystem resource watermarks. Usage: heap [dump]" };
+
+    static const shell_command_t sHeapSubCommands[] = {
+        { &HeapHelpHandler, "help", "Usage: heap <subcommand>" },
+        { &HeapDumpHandler, "dump", "Dump heap statistics and resource watermarks. Usage: heap dump" },
+    };
+
+    // Register `heap` subcommands with the local shell dispatcher.
+    sShellHeapSubcommands.RegisterCommands(sHeapSubCommands, ArraySize(sHeapSubCommands));
+
+    // Register the root `heap` command with the top-level shell.
+    Engine::Root().RegisterCommands(&sHeapComand, 1);
+}
+
+} // namespace Shell
+} // namespace chip
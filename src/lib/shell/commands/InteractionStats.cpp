@@ -0,0 +1,116 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <inttypes.h>
+
+#include <app/InteractionLatencyStats.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/shell/Commands.h>
+#include <lib/shell/Engine.h>
+#include <lib/shell/commands/Help.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace Shell {
+
+static chip::Shell::Engine sShellInteractionLatencySubcommands;
+
+CHIP_ERROR InteractionLatencyHelpHandler(int argc, char ** argv)
+{
+    sShellInteractionLatencySubcommands.ForEachCommand(PrintCommandHelp, nullptr);
+    return CHIP_NO_ERROR;
+}
+
+static void PrintHistogram(streamer_t * sout, const char * label, const app::LatencyHistogram & histogram)
+{
+    streamer_printf(sout, "%s: count=%" PRIu32 " p50=%" PRIu32 "ms p90=%" PRIu32 "ms p99=%" PRIu32 "ms max=%" PRIu32 "ms\r\n",
+                    label, histogram.mCount, histogram.GetPercentileMillis(50), histogram.GetPercentileMillis(90),
+                    histogram.GetPercentileMillis(99), histogram.mMaxMillis);
+}
+
+static CHIP_ERROR InteractionLatencyDumpHandler(int argc, char ** argv)
+{
+    streamer_t * sout = streamer_get();
+
+#if !CHIP_CONFIG_IM_LATENCY_STATS
+    streamer_printf(sout, "Interaction latency statistics are disabled; build with CHIP_CONFIG_IM_LATENCY_STATS=1\r\n");
+#endif
+
+    app::InteractionLatencyStats & stats = app::GlobalInteractionLatencyStats();
+
+    PrintHistogram(sout, "global", stats.GetGlobalHistogram());
+
+    for (size_t i = 0; const app::PeerLatencyStats * peer = stats.GetPeerStats(i); i++)
+    {
+        char label[32];
+        snprintf(label, sizeof(label), "peer 0x%016" PRIX64, peer->mPeerNodeId);
+        PrintHistogram(sout, label, peer->mHistogram);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR InteractionLatencyResetHandler(int argc, char ** argv)
+{
+    app::GlobalInteractionLatencyStats().Reset();
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR InteractionLatencyHandler(int argc, char ** argv)
+{
+    switch (argc)
+    {
+    case 0:
+        return InteractionLatencyDumpHandler(argc, argv);
+    case 1:
+        if (strcmp(argv[0], "dump") == 0)
+        {
+            return InteractionLatencyDumpHandler(argc - 1, argv + 1);
+        }
+        if (strcmp(argv[0], "reset") == 0)
+        {
+            return InteractionLatencyResetHandler(argc - 1, argv + 1);
+        }
+        break;
+    default:
+        break;
+    }
+    return sShellInteractionLatencySubcommands.ExecCommand(argc, argv);
+}
+
+void RegisterInteractionLatencyCommands()
+{
+    static const shell_command_t sInteractionLatencyCommand = { &InteractionLatencyHandler, "im-latency",
+                                                                "Dump or reset interaction round-trip latency histograms. "
+                                                                "Usage: im-latency [dump|reset]" };
+
+    static const shell_command_t sInteractionLatencySubCommands[] = {
+        { &InteractionLatencyHelpHandler, "help", "Usage: im-latency <subcommand>" },
+        { &InteractionLatencyDumpHandler, "dump", "Print global and per-peer latency percentiles. Usage: im-latency dump" },
+        { &InteractionLatencyResetHandler, "reset", "Reset all latency histograms. Usage: im-latency reset" },
+    };
+
+    // Register `im-latency` subcommands with the local shell dispatcher.
+    sShellInteractionLatencySubcommands.RegisterCommands(sInteractionLatencySubCommands,
+                                                         ArraySize(sInteractionLatencySubCommands));
+
+    // Register the root `im-latency` command with the top-level shell.
+    Engine::Root().RegisterCommands(&sInteractionLatencyCommand, 1);
+}
+
+} // namespace Shell
+} // namespace chip
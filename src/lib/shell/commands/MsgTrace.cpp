@@ -0,0 +1,110 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <inttypes.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/shell/Commands.h>
+#include <lib/shell/Engine.h>
+#include <lib/shell/commands/Help.h>
+#include <lib/support/Base64.h>
+#include <lib/support/CodeUtils.h>
+#include <transport/TraceMessage.h>
+
+namespace chip {
+namespace Shell {
+
+static chip::Shell::Engine sShellMsgTraceSubcommands;
+
+CHIP_ERROR MsgTraceHelpHandler(int argc, char ** argv)
+{
+    sShellMsgTraceSubcommands.ForEachCommand(PrintCommandHelp, nullptr);
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR MsgTraceDumpHandler(int argc, char ** argv)
+{
+    streamer_t * sout = streamer_get();
+
+#if !CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE
+    streamer_printf(sout, "Message tracing is disabled; build with CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE=1\r\n");
+#endif
+
+    trace::MessageTraceBuffer & buffer = trace::MessageTraceBuffer::Instance();
+
+    // Header line followed by one base64-encoded binary record per entry,
+    // oldest first; feed the output to scripts/tools/decode_message_trace.py.
+    streamer_printf(sout, "msgtrace v%u entries=%u total=%" PRIu32 "\r\n",
+                    static_cast<unsigned>(trace::MessageTraceBuffer::kBinaryFormatVersion),
+                    static_cast<unsigned>(buffer.GetEntryCount()), buffer.GetTotalRecorded());
+
+    for (size_t i = 0; i < buffer.GetEntryCount(); i++)
+    {
+        uint8_t record[trace::MessageTraceBuffer::kBinaryEntrySize];
+        char encoded[BASE64_ENCODED_LEN(trace::MessageTraceBuffer::kBinaryEntrySize) + 1];
+
+        trace::MessageTraceBuffer::SerializeEntry(buffer.GetEntry(i), record);
+        uint16_t encodedLen = Base64Encode(record, sizeof(record), encoded);
+        encoded[encodedLen] = '\0';
+
+        streamer_printf(sout, "%s\r\n", encoded);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR MsgTraceResetHandler(int argc, char ** argv)
+{
+    trace::MessageTraceBuffer::Instance().Clear();
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR MsgTraceHandler(int argc, char ** argv)
+{
+    switch (argc)
+    {
+    case 0:
+        return MsgTraceDumpHandler(argc, argv);
+    case 1:
+        if ((strcmp(argv[0], "help") == 0) || (strcmp(argv[0], "-h") == 0))
+        {
+            return MsgTraceHelpHandler(argc, argv);
+        }
+    }
+    return sShellMsgTraceSubcommands.ExecCommand(argc, argv);
+}
+
+void RegisterMsgTraceCommands()
+{
+    static const shell_command_t sMsgTraceComand = { &MsgTraceHandler, "msgtrace",
+                                                     "Dump or reset the transport message trace buffer. "
+                                                     "Usage: msgtrace [dump|reset]" };
+
+    static const shell_command_t sMsgTraceSubCommands[] = {
+        { &MsgTraceHelpHandler, "help", "Usage: msgtrace <subcommand>" },
+        { &MsgTraceDumpHandler, "dump", "Dump recorded message traces as base64 records. Usage: msgtrace dump" },
+        { &MsgTraceResetHandler, "reset", "Discard recorded message traces. Usage: msgtrace reset" },
+    };
+
+    // Register `msgtrace` subcommands with the local shell dispatcher.
+    sShellMsgTraceSubcommands.RegisterCommands(sMsgTraceSubCommands, ArraySize(sMsgTraceSubCommands));
+
+    // Register the root `msgtrace` command with the top-level shell.
+    Engine::Root().RegisterCommands(&sMsgTraceComand, 1);
+}
+
+} // namespace Shell
+} // namespace chip
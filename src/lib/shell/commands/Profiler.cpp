@@ -0,0 +1,120 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <inttypes.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/shell/Commands.h>
+#include <lib/shell/Engine.h>
+#include <lib/shell/commands/Help.h>
+#include <lib/support/CodeUtils.h>
+#include <system/SystemEventLoopProfiler.h>
+
+namespace chip {
+namespace Shell {
+
+static chip::Shell::Engine sShellProfilerSubcommands;
+
+CHIP_ERROR ProfilerHelpHandler(int argc, char ** argv)
+{
+    sShellProfilerSubcommands.ForEachCommand(PrintCommandHelp, nullptr);
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR ProfilerDumpHandler(int argc, char ** argv)
+{
+    streamer_t * sout = streamer_get();
+
+#if !CHIP_SYSTEM_CONFIG_EVENT_LOOP_PROFILING
+    streamer_printf(sout, "Event loop profiling is disabled; build with CHIP_SYSTEM_CONFIG_EVENT_LOOP_PROFILING=1\r\n");
+#endif
+
+    System::EventLoopProfiler & profiler = System::EventLoopProfiler::Instance();
+
+    streamer_printf(sout, "Bucket limits (us):");
+    for (size_t i = 0; i < System::EventLoopProfiler::kNumBuckets - 1; i++)
+    {
+        streamer_printf(sout, " <%" PRIu32, System::EventLoopProfiler::kBucketLimitsMicros[i]);
+    }
+    streamer_printf(sout, " rest\r\n");
+    streamer_printf(sout, "site kind count avg-us max-us histogram\r\n");
+
+    for (size_t i = 0; i < profiler.GetSiteCount(); i++)
+    {
+        const System::EventLoopProfiler::Site & site = profiler.GetSite(i);
+        const uint64_t avgMicros                     = (site.mCount != 0) ? site.mTotalMicros / site.mCount : 0;
+
+        streamer_printf(sout, "%p %s %" PRIu32 " %" PRIu64 " %" PRIu32, site.mCallback,
+                        (site.mKind == System::EventLoopProfiler::SiteKind::kTimer) ? "timer" : "socket", site.mCount, avgMicros,
+                        site.mMaxMicros);
+        for (size_t bucket = 0; bucket < System::EventLoopProfiler::kNumBuckets; bucket++)
+        {
+            streamer_printf(sout, " %" PRIu32, site.mBuckets[bucket]);
+        }
+        streamer_printf(sout, "\r\n");
+    }
+
+    if (profiler.GetDroppedDispatches() != 0)
+    {
+        streamer_printf(sout, "Dropped dispatches (site table full): %" PRIu32 "\r\n", profiler.GetDroppedDispatches());
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR ProfilerResetHandler(int argc, char ** argv)
+{
+    System::EventLoopProfiler::Instance().Reset();
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR ProfilerHandler(int argc, char ** argv)
+{
+    switch (argc)
+    {
+    case 0:
+        return ProfilerDumpHandler(argc, argv);
+    case 1:
+        if ((strcmp(argv[0], "help") == 0) || (strcmp(argv[0], "-h") == 0))
+        {
+            return ProfilerHelpHandler(argc, argv);
+        }
+    }
+    return sShellProfilerSubcommands.ExecCommand(argc, argv);
+}
+
+void RegisterProfilerCommands()
+{
+    static const shell_command_t sProfilerComand = { &ProfilerHandler, "profiler",
+                                                     "Dump or reset event loop dispatch latency histograms. Symbolize the "
+                                                     "reported site addresses against the binary to identify handlers. "
+                                                     "Usage: profiler [dump|reset]" };
+
+    static const shell_command_t sProfilerSubCommands[] = {
+        { &ProfilerHelpHandler, "help", "Usage: profiler <subcommand>" },
+        { &ProfilerDumpHandler, "dump", "Dump per-site dispatch latency histograms. Usage: profiler dump" },
+        { &ProfilerResetHandler, "reset", "Discard recorded dispatch statistics. Usage: profiler reset" },
+    };
+
+    // Register `profiler` subcommands with the local shell dispatcher.
+    sShellProfilerSubcommands.RegisterCommands(sProfilerSubCommands, ArraySize(sProfilerSubCommands));
+
+    // Register the root `profiler` command with the top-level shell.
+    Engine::Root().RegisterCommands(&sProfilerComand, 1);
+}
+
+} // namespace Shell
+} // namespace chip
@@ -0,0 +1,105 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <inttypes.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/shell/Commands.h>
+#include <lib/shell/Engine.h>
+#include <lib/shell/commands/Help.h>
+#include <lib/support/CodeUtils.h>
+#include <transport/SessionStats.h>
+
+namespace chip {
+namespace Shell {
+
+static chip::Shell::Engine sShellSessionStatsSubcommands;
+
+CHIP_ERROR SessionStatsHelpHandler(int argc, char ** argv)
+{
+    sShellSessionStatsSubcommands.ForEachCommand(PrintCommandHelp, nullptr);
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR SessionStatsDumpHandler(int argc, char ** argv)
+{
+    streamer_t * sout = streamer_get();
+
+#if !CHIP_CONFIG_SESSION_STATS
+    streamer_printf(sout, "Session statistics are disabled; build with CHIP_CONFIG_SESSION_STATS=1\r\n");
+#endif
+
+    const Transport::SessionStatCounters & stats = Transport::GlobalSessionStats();
+
+    streamer_printf(sout, "encrypt: msgs=%" PRIu64 " bytes=%" PRIu64 " micros=%" PRIu64 "\r\n", stats.mEncryptedMessages,
+                    stats.mEncryptedBytes, stats.mEncryptMicros);
+    streamer_printf(sout, "decrypt: msgs=%" PRIu64 " bytes=%" PRIu64 " micros=%" PRIu64 "\r\n", stats.mDecryptedMessages,
+                    stats.mDecryptedBytes, stats.mDecryptMicros);
+    streamer_printf(sout, "drops: mic-failures=%" PRIu64 " counter-window=%" PRIu64 " duplicates=%" PRIu64 "\r\n",
+                    stats.mDecryptFailures, stats.mCounterWindowDrops, stats.mDuplicateMessages);
+
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR SessionStatsResetHandler(int argc, char ** argv)
+{
+    Transport::GlobalSessionStats().Reset();
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR SessionStatsHandler(int argc, char ** argv)
+{
+    switch (argc)
+    {
+    case 0:
+        return SessionStatsDumpHandler(argc, argv);
+    case 1:
+        if (strcmp(argv[0], "dump") == 0)
+        {
+            return SessionStatsDumpHandler(argc - 1, argv + 1);
+        }
+        if (strcmp(argv[0], "reset") == 0)
+        {
+            return SessionStatsResetHandler(argc - 1, argv + 1);
+        }
+        break;
+    default:
+        break;
+    }
+    return sShellSessionStatsSubcommands.ExecCommand(argc, argv);
+}
+
+void RegisterSessionStatsCommands()
+{
+    static const shell_command_t sSessionStatsCommand = { &SessionStatsHandler, "session-stats",
+                                                          "Dump or reset secure session crypto counters. "
+                                                          "Usage: session-stats [dump|reset]" };
+
+    static const shell_command_t sSessionStatsSubCommands[] = {
+        { &SessionStatsHelpHandler, "help", "Usage: session-stats <subcommand>" },
+        { &SessionStatsDumpHandler, "dump", "Print global secure session counters. Usage: session-stats dump" },
+        { &SessionStatsResetHandler, "reset", "Reset global secure session counters. Usage: session-stats reset" },
+    };
+
+    // Register `session-stats` subcommands with the local shell dispatcher.
+    sShellSessionStatsSubcommands.RegisterCommands(sSessionStatsSubCommands, ArraySize(sSessionStatsSubCommands));
+
+    // Register the root `session-stats` command with the top-level shell.
+    Engine::Root().RegisterCommands(&sSessionStatsCommand, 1);
+}
+
+} // namespace Shell
+} // namespace chip
@@ -30,6 +30,14 @@
 #include <ctype.h>
 #include <stdint.h>
 
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define CHIP_BASE64_USE_SSSE3 1
+#elif defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define CHIP_BASE64_USE_NEON 1
+#endif
+
 namespace chip {
 
 // Convert a value in the range 0..63 to its equivalent base64 character.
@@ -114,10 +122,123 @@ static uint8_t Base64URLCharToVal(uint8_t c)
     return UINT8_MAX;
 }
 
+#if CHIP_BASE64_USE_SSSE3
+
+// Map a vector of sextet values (0..63) to their base-64 characters using the
+// offset technique from Mula & Lemire, "Faster Base64 Encoding and Decoding
+// using AVX2 Instructions": reduce each sextet to one of 13 alphabet ranges,
+// look up the ASCII offset of that range, and add it to the sextet.
+static __m128i Base64SextetsToChars(__m128i indices, bool base64Url)
+{
+    const __m128i shiftLUT = base64Url
+        ? _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                        '0' - 52, '-' - 62, '_' - 63, 'A', 0, 0)
+        : _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                        '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+    __m128i ranges      = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i lower = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    ranges              = _mm_or_si128(ranges, _mm_and_si128(lower, _mm_set1_epi8(13)));
+    return _mm_add_epi8(_mm_shuffle_epi8(shiftLUT, ranges), indices);
+}
+
+// Encode whole 12-byte groups of `in` to 16 base-64 characters at a time,
+// advancing the cursors past what was consumed; the scalar loop in
+// Base64Encode() handles the remainder and any padding.  Groups are only
+// consumed while at least 16 input bytes remain so the vector load never reads
+// past the end of the input.
+static void Base64EncodeBulk(const uint8_t *& in, uint16_t & inLen, char *& out, bool base64Url)
+{
+    while (inLen >= 16)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+
+        // Spread the 12 payload bytes so that each 32-bit lane holds one
+        // 3-byte group, then split each group into four sextets.
+        bytes            = _mm_shuffle_epi8(bytes, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+        const __m128i t0 = _mm_and_si128(bytes, _mm_set1_epi32(0x0fc0fc00));
+        const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        const __m128i t2 = _mm_and_si128(bytes, _mm_set1_epi32(0x003f03f0));
+        const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), Base64SextetsToChars(_mm_or_si128(t1, t3), base64Url));
+
+        in += 12;
+        inLen = static_cast<uint16_t>(inLen - 12);
+        out += 16;
+    }
+}
+
+#elif CHIP_BASE64_USE_NEON
+
+// NEON equivalent of the SSSE3 sextet-to-character mapping above.
+static uint8x16_t Base64SextetsToChars(uint8x16_t indices, const uint8x16_t shiftLUT)
+{
+    uint8x16_t ranges      = vqsubq_u8(indices, vdupq_n_u8(51));
+    const uint8x16_t lower = vcltq_u8(indices, vdupq_n_u8(26));
+    ranges                 = vorrq_u8(ranges, vandq_u8(lower, vdupq_n_u8(13)));
+    return vaddq_u8(vqtbl1q_u8(shiftLUT, ranges), indices);
+}
+
+// Encode whole 48-byte groups of `in` to 64 base-64 characters at a time; the
+// scalar loop in Base64Encode() handles the remainder and any padding.
+static void Base64EncodeBulk(const uint8_t *& in, uint16_t & inLen, char *& out, bool base64Url)
+{
+    const int8_t shiftBytes[16] = {
+        'a' - 26,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        static_cast<int8_t>(base64Url ? '-' - 62 : '+' - 62),
+        static_cast<int8_t>(base64Url ? '_' - 63 : '/' - 63),
+        'A',
+        0,
+        0,
+    };
+    const uint8x16_t shiftLUT = vreinterpretq_u8_s8(vld1q_s8(shiftBytes));
+
+    while (inLen >= 48)
+    {
+        const uint8x16x3_t groups = vld3q_u8(in);
+
+        uint8x16x4_t chars;
+        chars.val[0] = Base64SextetsToChars(vshrq_n_u8(groups.val[0], 2), shiftLUT);
+        chars.val[1] = Base64SextetsToChars(
+            vorrq_u8(vshlq_n_u8(vandq_u8(groups.val[0], vdupq_n_u8(0x03)), 4), vshrq_n_u8(groups.val[1], 4)), shiftLUT);
+        chars.val[2] = Base64SextetsToChars(
+            vorrq_u8(vshlq_n_u8(vandq_u8(groups.val[1], vdupq_n_u8(0x0F)), 2), vshrq_n_u8(groups.val[2], 6)), shiftLUT);
+        chars.val[3] = Base64SextetsToChars(vandq_u8(groups.val[2], vdupq_n_u8(0x3F)), shiftLUT);
+
+        vst4q_u8(reinterpret_cast<uint8_t *>(out), chars);
+
+        in += 48;
+        inLen = static_cast<uint16_t>(inLen - 48);
+        out += 64;
+    }
+}
+
+#endif // CHIP_BASE64_USE_NEON
+
 uint16_t Base64Encode(const uint8_t * in, uint16_t inLen, char * out, Base64ValToCharFunct valToCharFunct)
 {
     char * outStart = out;
 
+#if CHIP_BASE64_USE_SSSE3 || CHIP_BASE64_USE_NEON
+    // The vector path only knows the two standard alphabets; custom character
+    // mappings take the scalar loop for every byte.
+    if (valToCharFunct == Base64ValToChar || valToCharFunct == Base64URLValToChar)
+    {
+        Base64EncodeBulk(in, inLen, out, valToCharFunct == Base64URLValToChar);
+    }
+#endif
+
     while (inLen > 0)
     {
         uint8_t val1, val2, val3, val4;
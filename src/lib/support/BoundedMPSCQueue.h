@@ -0,0 +1,146 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Defines a bounded lock-free multi-producer single-consumer queue of
+ *      trivially copyable values.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace chip {
+
+/**
+ * A bounded lock-free multi-producer single-consumer queue.
+ *
+ * Any number of threads may call Enqueue() concurrently; Dequeue() must only be
+ * called from a single consumer thread.  Storage is a fixed array of value slots,
+ * so no allocation occurs after construction.  Based on the bounded MPMC queue
+ * design of D. Vyukov (per-slot sequence numbers), restricted to one consumer.
+ *
+ * @tparam T  The element type; must be trivially copyable since slots are reused in place.
+ * @tparam N  The queue capacity; must be a power of two.
+ */
+template <typename T, size_t N>
+class BoundedMPSCQueue
+{
+public:
+    static_assert(std::is_trivially_copyable<T>::value, "BoundedMPSCQueue elements must be trivially copyable");
+    static_assert(N != 0 && (N & (N - 1)) == 0, "BoundedMPSCQueue capacity must be a power of two");
+
+    BoundedMPSCQueue()
+    {
+        for (size_t i = 0; i < N; i++)
+        {
+            mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Append a value to the queue.  Safe to call from any thread.
+     *
+     * @param[in]  value      The value to copy into the queue.
+     * @param[out] wasEmpty   Set to true if the queue had no pending elements when the value
+     *                        was added; producers can use this to coalesce consumer wakeups.
+     *
+     * @return  true if the value was enqueued, false if the queue is full.
+     */
+    bool Enqueue(const T & value, bool & wasEmpty)
+    {
+        Slot * slot;
+        size_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            slot                 = &mSlots[pos & kMask];
+            const size_t seq     = slot->mSequence.load(std::memory_order_acquire);
+            const intptr_t delta = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+            if (delta == 0)
+            {
+                if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (delta < 0)
+            {
+                return false; // full
+            }
+            else
+            {
+                pos = mEnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->mValue = value;
+        slot->mSequence.store(pos + 1, std::memory_order_release);
+
+        wasEmpty = (mCount.fetch_add(1, std::memory_order_acq_rel) == 0);
+        return true;
+    }
+
+    /**
+     * Remove the oldest value from the queue.  Must only be called from the consumer thread.
+     *
+     * @return  true if a value was dequeued into @p value, false if the queue is empty.
+     */
+    bool Dequeue(T & value)
+    {
+        Slot * slot      = &mSlots[mDequeuePos & kMask];
+        const size_t seq = slot->mSequence.load(std::memory_order_acquire);
+
+        if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(mDequeuePos + 1) < 0)
+        {
+            return false; // empty
+        }
+
+        value = slot->mValue;
+        slot->mSequence.store(mDequeuePos + N, std::memory_order_release);
+        mDequeuePos++;
+
+        mCount.fetch_sub(1, std::memory_order_acq_rel);
+        return true;
+    }
+
+    /**
+     * Return an instantaneous estimate of the number of pending elements.
+     */
+    size_t Count() const { return mCount.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr size_t kMask = N - 1;
+
+    struct Slot
+    {
+        std::atomic<size_t> mSequence;
+        T mValue;
+    };
+
+    Slot mSlots[N];
+    std::atomic<size_t> mEnqueuePos{ 0 };
+    size_t mDequeuePos = 0; // consumer-only
+    std::atomic<size_t> mCount{ 0 };
+};
+
+} // namespace chip
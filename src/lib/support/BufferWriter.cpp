@@ -53,7 +53,10 @@ BufferWriter & BufferWriter::Put(uint8_t c)
     return *this;
 }
 
-LittleEndian::BufferWriter & LittleEndian::BufferWriter::EndianPut(uint64_t x, size_t size)
+// Out-of-line slow paths for values that do not (entirely) fit: bytes that fit are
+// written and mNeeded still accounts for the full value, matching Put() semantics.
+
+LittleEndian::BufferWriter & LittleEndian::BufferWriter::EndianPutPartial(uint64_t x, size_t size)
 {
     while (size > 0)
     {
@@ -65,7 +68,7 @@ LittleEndian::BufferWriter & LittleEndian::BufferWriter::EndianPut(uint64_t x, s
     return *this;
 }
 
-BigEndian::BufferWriter & BigEndian::BufferWriter::EndianPut(uint64_t x, size_t size)
+BigEndian::BufferWriter & BigEndian::BufferWriter::EndianPutPartial(uint64_t x, size_t size)
 {
     while (size-- > 0)
     {
@@ -127,7 +127,27 @@ public:
     BufferWriter(MutableByteSpan buf) : EndianBufferWriterBase<BufferWriter>(buf) {}
     BufferWriter(const BufferWriter & other) = default;
     BufferWriter & operator=(const BufferWriter & other) = default;
-    BufferWriter & EndianPut(uint64_t x, size_t size);
+
+    // `size` is a compile-time constant at every Put16/Put32/Put64 call site; with the
+    // definition visible there, the capacity is proven with a single check and the byte
+    // stores below inline into straight-line code instead of a per-byte checked loop.
+    BufferWriter & EndianPut(uint64_t x, size_t size)
+    {
+        if ((mNeeded <= mSize) && (size <= mSize - mNeeded))
+        {
+            uint8_t * p = mBuf + mNeeded;
+            for (size_t i = 0; i < size; i++, x >>= 8)
+            {
+                *p++ = static_cast<uint8_t>(x & 0xff);
+            }
+            mNeeded += size;
+            return *this;
+        }
+        return EndianPutPartial(x, size);
+    }
+
+private:
+    BufferWriter & EndianPutPartial(uint64_t x, size_t size);
 };
 
 } // namespace LittleEndian
@@ -141,7 +161,25 @@ public:
     BufferWriter(MutableByteSpan buf) : EndianBufferWriterBase<BufferWriter>(buf) {}
     BufferWriter(const BufferWriter & other) = default;
     BufferWriter & operator=(const BufferWriter & other) = default;
-    BufferWriter & EndianPut(uint64_t x, size_t size);
+
+    // See LittleEndian::BufferWriter::EndianPut for why this is defined inline.
+    BufferWriter & EndianPut(uint64_t x, size_t size)
+    {
+        if ((mNeeded <= mSize) && (size <= mSize - mNeeded))
+        {
+            uint8_t * p = mBuf + mNeeded;
+            for (size_t i = size; i > 0; i--)
+            {
+                *p++ = static_cast<uint8_t>((x >> ((i - 1) * 8)) & 0xff);
+            }
+            mNeeded += size;
+            return *this;
+        }
+        return EndianPutPartial(x, size);
+    }
+
+private:
+    BufferWriter & EndianPutPartial(uint64_t x, size_t size);
 };
 
 } // namespace BigEndian
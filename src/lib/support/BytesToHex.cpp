@@ -19,11 +19,69 @@
 
 #include <cstring>
 #include <stdio.h>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define CHIP_BYTES_TO_HEX_USE_SSSE3 1
+#elif defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define CHIP_BYTES_TO_HEX_USE_NEON 1
+#endif
+
 namespace chip {
 namespace Encoding {
 
 namespace {
 
+#if CHIP_BYTES_TO_HEX_USE_SSSE3
+
+// Convert whole 16-byte blocks of `src` to 32 hex characters at a time with a
+// nibble-indexed table lookup, advancing the cursors past what was consumed.
+// The scalar loop in BytesToHex() handles the remainder.
+void BytesToHexBulk(const uint8_t *& src, size_t & remaining, char *& dest, bool uppercase)
+{
+    const __m128i table = uppercase ? _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F')
+                                    : _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+
+    while (remaining >= 16)
+    {
+        __m128i bytes   = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        __m128i hiChars = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibbleMask));
+        __m128i loChars = _mm_shuffle_epi8(table, _mm_and_si128(bytes, nibbleMask));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), _mm_unpacklo_epi8(hiChars, loChars));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 16), _mm_unpackhi_epi8(hiChars, loChars));
+
+        src += 16;
+        dest += 32;
+        remaining -= 16;
+    }
+}
+
+#elif CHIP_BYTES_TO_HEX_USE_NEON
+
+// NEON equivalent of the SSSE3 bulk converter above.
+void BytesToHexBulk(const uint8_t *& src, size_t & remaining, char *& dest, bool uppercase)
+{
+    const uint8x16_t table = vld1q_u8(reinterpret_cast<const uint8_t *>(uppercase ? "0123456789ABCDEF" : "0123456789abcdef"));
+
+    while (remaining >= 16)
+    {
+        uint8x16_t bytes = vld1q_u8(src);
+        uint8x16x2_t chars;
+        chars.val[0] = vqtbl1q_u8(table, vshrq_n_u8(bytes, 4));
+        chars.val[1] = vqtbl1q_u8(table, vandq_u8(bytes, vdupq_n_u8(0x0F)));
+        vst2q_u8(reinterpret_cast<uint8_t *>(dest), chars);
+
+        src += 16;
+        dest += 32;
+        remaining -= 16;
+    }
+}
+
+#endif // CHIP_BYTES_TO_HEX_USE_NEON
+
 char NibbleToHex(uint8_t nibble, bool uppercase)
 {
     char x = static_cast<char>(nibble & 0xFu);
@@ -95,12 +153,19 @@ CHIP_ERROR BytesToHex(const uint8_t * src_bytes, size_t src_size, char * dest_he
         return CHIP_ERROR_BUFFER_TOO_SMALL;
     }
 
-    bool uppercase = flags.Has(HexFlags::kUppercase);
-    char * cursor  = dest_hex;
-    for (size_t byte_idx = 0; byte_idx < src_size; ++byte_idx)
+    bool uppercase      = flags.Has(HexFlags::kUppercase);
+    const uint8_t * src = src_bytes;
+    size_t remaining    = src_size;
+    char * cursor       = dest_hex;
+
+#if CHIP_BYTES_TO_HEX_USE_SSSE3 || CHIP_BYTES_TO_HEX_USE_NEON
+    BytesToHexBulk(src, remaining, cursor, uppercase);
+#endif
+
+    for (; remaining > 0; --remaining, ++src)
     {
-        *cursor++ = NibbleToHex((src_bytes[byte_idx] >> 4) & 0xFu, uppercase);
-        *cursor++ = NibbleToHex((src_bytes[byte_idx] >> 0) & 0xFu, uppercase);
+        *cursor++ = NibbleToHex((*src >> 4) & 0xFu, uppercase);
+        *cursor++ = NibbleToHex((*src >> 0) & 0xFu, uppercase);
     }
 
     if (nul_terminate)
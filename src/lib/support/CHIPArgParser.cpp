@@ -62,8 +62,8 @@ namespace ArgParser {
 
 using namespace chip;
 
-static char * MakeShortOptions(OptionSet ** optSets);
-static struct option * MakeLongOptions(OptionSet ** optSets);
+static char * MakeShortOptions(OptionSet ** optSets, char * stackBuf, size_t stackBufSize);
+static struct option * MakeLongOptions(OptionSet ** optSets, struct option * stackBuf, size_t stackBufCount);
 static int32_t SplitArgs(char * argStr, char **& argList, char * initialArg = nullptr);
 static bool GetNextArg(char *& parsePoint);
 static size_t CountOptionSets(OptionSet * optSets[]);
@@ -286,6 +286,8 @@ bool ParseArgs(const char * progName, int argc, char * argv[], OptionSet * optSe
     bool res = false;
     char optName[64];
     char * optArg;
+    char shortOptsBuf[2 + (CHIP_CONFIG_ARG_PARSER_MAX_STACK_OPTIONS * 3)];
+    struct option longOptsBuf[CHIP_CONFIG_ARG_PARSER_MAX_STACK_OPTIONS + 1];
     char * shortOpts         = nullptr;
     struct option * longOpts = nullptr;
     OptionSet * curOptSet;
@@ -317,7 +319,7 @@ bool ParseArgs(const char * progName, int argc, char * argv[], OptionSet * optSe
 #endif
 
     // Generate a short options string in the format expected by getopt_long().
-    shortOpts = MakeShortOptions(optSets);
+    shortOpts = MakeShortOptions(optSets, shortOptsBuf, sizeof(shortOptsBuf));
     if (shortOpts == nullptr)
     {
         PrintArgError("%s: Memory allocation failure\n", progName);
@@ -325,7 +327,7 @@ bool ParseArgs(const char * progName, int argc, char * argv[], OptionSet * optSe
     }
 
     // Generate a list of long option structures in the format expected by getopt_long().
-    longOpts = MakeLongOptions(optSets);
+    longOpts = MakeLongOptions(optSets, longOptsBuf, ArraySize(longOptsBuf));
     if (longOpts == nullptr)
     {
         PrintArgError("%s: Memory allocation failure\n", progName);
@@ -423,9 +425,9 @@ bool ParseArgs(const char * progName, int argc, char * argv[], OptionSet * optSe
 
 done:
 
-    if (shortOpts != nullptr)
+    if (shortOpts != nullptr && shortOpts != shortOptsBuf)
         chip::Platform::MemoryFree(shortOpts);
-    if (longOpts != nullptr)
+    if (longOpts != nullptr && longOpts != longOptsBuf)
         chip::Platform::MemoryFree(longOpts);
 
     gActiveOptionSets = nullptr;
@@ -1196,20 +1198,25 @@ bool OptionSetBase::CallHandleFunct(const char * progName, OptionSet * optSet, i
     return static_cast<OptionSetBase *>(optSet)->HandleOption(progName, optSet, id, name, arg);
 }
 
-static char * MakeShortOptions(OptionSet ** optSets)
+static char * MakeShortOptions(OptionSet ** optSets, char * stackBuf, size_t stackBufSize)
 {
     size_t i = 0;
 
     // Count the number of options.
     size_t totalOptions = CountAllOptions(optSets);
 
-    // Allocate a block of memory big enough to hold the maximum possible size short option string.
-    // The buffer needs to be big enough to hold up to 3 characters per short option plus an initial
-    // ":" and a terminating null.
+    // The string needs to be big enough to hold up to 3 characters per short option plus an initial
+    // ":" and a terminating null.  Argument parsing is on the process-start path of frequently
+    // invoked tools, so use the caller's stack buffer when the options fit and only fall back to
+    // the heap for unusually large option sets.
     size_t arraySize = 2 + (totalOptions * 3);
-    char * shortOpts = static_cast<char *>(chip::Platform::MemoryAlloc(arraySize));
-    if (shortOpts == nullptr)
-        return nullptr;
+    char * shortOpts = stackBuf;
+    if (arraySize > stackBufSize)
+    {
+        shortOpts = static_cast<char *>(chip::Platform::MemoryAlloc(arraySize));
+        if (shortOpts == nullptr)
+            return nullptr;
+    }
 
     // Prefix the string with ':'.  This tells getopt() to signal missing option arguments distinct
     // from unknown options.
@@ -1241,15 +1248,20 @@ static char * MakeShortOptions(OptionSet ** optSets)
     return shortOpts;
 }
 
-static struct option * MakeLongOptions(OptionSet ** optSets)
+static struct option * MakeLongOptions(OptionSet ** optSets, struct option * stackBuf, size_t stackBufCount)
 {
     size_t totalOptions = CountAllOptions(optSets);
 
-    // Allocate an array to hold the list of long options.
-    size_t arraySize         = (sizeof(struct option) * (totalOptions + 1));
-    struct option * longOpts = static_cast<struct option *>(chip::Platform::MemoryAlloc(arraySize));
-    if (longOpts == nullptr)
-        return nullptr;
+    // As with MakeShortOptions(), prefer the caller's stack buffer (which must hold
+    // totalOptions + 1 entries, the last being the terminator) over the heap.
+    struct option * longOpts = stackBuf;
+    if (totalOptions + 1 > stackBufCount)
+    {
+        size_t arraySize = (sizeof(struct option) * (totalOptions + 1));
+        longOpts         = static_cast<struct option *>(chip::Platform::MemoryAlloc(arraySize));
+        if (longOpts == nullptr)
+            return nullptr;
+    }
 
     // For each option set...
     size_t i = 0;
@@ -30,6 +30,28 @@ namespace {
 
 void * gPrivateHeap = nullptr;
 
+uint32_t gAllocationCount[HeapStatistics::kNumSizeBuckets] = {};
+uint32_t gFailedAllocationCount                            = 0;
+
+// Records an allocation request in the size histogram; must be called with the heap lock held.
+void RecordAllocation(size_t size, void * result)
+{
+    size_t bucket      = 0;
+    size_t bucketLimit = HeapStatistics::kSizeBucketBase;
+
+    while (bucket < HeapStatistics::kNumSizeBuckets - 1 && size > bucketLimit)
+    {
+        bucketLimit *= 2;
+        bucket++;
+    }
+    gAllocationCount[bucket]++;
+
+    if (result == nullptr)
+    {
+        gFailedAllocationCount++;
+    }
+}
+
 #if CHIP_SYSTEM_CONFIG_NO_LOCKING
 
 class HeapLocked
@@ -61,6 +83,9 @@ CHIP_ERROR MemoryAllocatorInit(void * buf, size_t bufSize)
     PrivateHeapInit(buf, bufSize);
     gPrivateHeap = buf;
 
+    memset(gAllocationCount, 0, sizeof(gAllocationCount));
+    gFailedAllocationCount = 0;
+
 #if CHIP_SYSTEM_CONFIG_NO_LOCKING
     return CHIP_NO_ERROR;
 #else
@@ -82,7 +107,9 @@ void * MemoryAlloc(size_t size)
         return nullptr;
     }
 
-    return PrivateHeapAlloc(gPrivateHeap, size);
+    void * result = PrivateHeapAlloc(gPrivateHeap, size);
+    RecordAllocation(size, result);
+    return result;
 }
 
 void * MemoryCalloc(size_t num, size_t size)
@@ -112,7 +139,12 @@ void * MemoryRealloc(void * p, size_t size)
         return nullptr;
     }
 
-    return PrivateHeapRealloc(gPrivateHeap, p, size);
+    void * result = PrivateHeapRealloc(gPrivateHeap, p, size);
+    if (size != 0)
+    {
+        RecordAllocation(size, result);
+    }
+    return result;
 }
 
 void MemoryFree(void * p)
@@ -126,5 +158,25 @@ void MemoryFree(void * p)
     PrivateHeapFree(p);
 }
 
+CHIP_ERROR MemoryGetHeapStatistics(HeapStatistics & stats)
+{
+    HeapLocked lock;
+
+    ReturnErrorCodeIf(gPrivateHeap == nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    PrivateHeapStatistics heapStats;
+    PrivateHeapGetStatistics(gPrivateHeap, &heapStats);
+
+    stats.mFreeBytes             = heapStats.freeBytes;
+    stats.mUsedBytes             = heapStats.usedBytes;
+    stats.mLargestFreeBlockBytes = heapStats.largestFreeBlockBytes;
+    stats.mFreeBlockCount        = heapStats.freeBlockCount;
+    stats.mUsedBlockCount        = heapStats.usedBlockCount;
+    memcpy(stats.mAllocationCount, gAllocationCount, sizeof(stats.mAllocationCount));
+    stats.mFailedAllocationCount = gFailedAllocationCount;
+
+    return CHIP_NO_ERROR;
+}
+
 } // namespace Platform
 } // namespace chip
@@ -26,9 +26,14 @@
 #include <lib/core/CHIPConfig.h>
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CHIPPlatformMemory.h>
+#include <lib/support/logging/CHIPLogging.h>
 
 #include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 namespace chip {
 namespace Platform {
@@ -63,5 +68,160 @@ void MemoryShutdown()
     }
 }
 
+// Default for allocators that do not track statistics (e.g. the C Standard Library allocator);
+// allocators that manage their own heap provide a strong definition.
+CHIP_ERROR __attribute__((weak)) MemoryGetHeapStatistics(HeapStatistics & stats)
+{
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+}
+
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+
+namespace {
+
+// Prepended to every tagged allocation so MemoryFreeTagged() can attribute the release
+// without a lookup table; padded to max_align_t so the caller's block keeps the alignment
+// the underlying allocator provided.
+struct alignas(alignof(max_align_t)) AllocationHeader
+{
+    uint32_t mSize;
+    uint8_t mTag;
+};
+
+struct TagCounters
+{
+    std::atomic<uint32_t> mLiveBytes{ 0 };
+    std::atomic<uint32_t> mLiveBlockCount{ 0 };
+    std::atomic<uint32_t> mHighWatermarkBytes{ 0 };
+    std::atomic<uint32_t> mAllocationCount[MemoryTagStatistics::kNumSizeBuckets] = {};
+};
+
+TagCounters gTagCounters[kMemoryTag_Count];
+
+const char * const sTagLabels[kMemoryTag_Count] = {
+    "General", "Crypto", "Dnssd", "InteractionModel", "Messaging", "TLV",
+};
+
+size_t SizeBucket(size_t size)
+{
+    size_t bucket      = 0;
+    size_t bucketLimit = MemoryTagStatistics::kSizeBucketBase;
+    while (bucket < MemoryTagStatistics::kNumSizeBuckets - 1 && size > bucketLimit)
+    {
+        bucket++;
+        bucketLimit <<= 1;
+    }
+    return bucket;
+}
+
+void RecordAllocation(MemoryTag tag, size_t size)
+{
+    TagCounters & counters = gTagCounters[tag];
+    counters.mAllocationCount[SizeBucket(size)]++;
+    counters.mLiveBlockCount++;
+    const uint32_t liveBytes = counters.mLiveBytes += static_cast<uint32_t>(size);
+    uint32_t watermark       = counters.mHighWatermarkBytes;
+    while (liveBytes > watermark && !counters.mHighWatermarkBytes.compare_exchange_weak(watermark, liveBytes))
+    {
+    }
+}
+
+void RecordRelease(MemoryTag tag, size_t size)
+{
+    TagCounters & counters = gTagCounters[tag];
+    counters.mLiveBlockCount--;
+    counters.mLiveBytes -= static_cast<uint32_t>(size);
+}
+
+} // namespace
+
+void * MemoryAllocTagged(size_t size, MemoryTag tag)
+{
+    if (tag >= kMemoryTag_Count)
+    {
+        tag = kMemoryTag_General;
+    }
+    if (size > UINT32_MAX - sizeof(AllocationHeader))
+    {
+        return nullptr;
+    }
+    AllocationHeader * header = static_cast<AllocationHeader *>(MemoryAlloc(sizeof(AllocationHeader) + size));
+    if (header == nullptr)
+    {
+        return nullptr;
+    }
+    header->mSize = static_cast<uint32_t>(size);
+    header->mTag  = tag;
+    RecordAllocation(tag, size);
+    return header + 1;
+}
+
+void * MemoryCallocTagged(size_t num, size_t size, MemoryTag tag)
+{
+    if (size != 0 && num > SIZE_MAX / size)
+    {
+        return nullptr;
+    }
+    void * p = MemoryAllocTagged(num * size, tag);
+    if (p != nullptr)
+    {
+        memset(p, 0, num * size);
+    }
+    return p;
+}
+
+void MemoryFreeTagged(void * p)
+{
+    if (p == nullptr)
+    {
+        return;
+    }
+    AllocationHeader * header = static_cast<AllocationHeader *>(p) - 1;
+    RecordRelease(static_cast<MemoryTag>(header->mTag), header->mSize);
+    MemoryFree(header);
+}
+
+CHIP_ERROR MemoryGetTagStatistics(MemoryTag tag, MemoryTagStatistics & stats)
+{
+    if (tag >= kMemoryTag_Count)
+    {
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+    const TagCounters & counters = gTagCounters[tag];
+    stats.mLiveBytes             = counters.mLiveBytes;
+    stats.mLiveBlockCount        = counters.mLiveBlockCount;
+    stats.mHighWatermarkBytes    = counters.mHighWatermarkBytes;
+    for (size_t i = 0; i < MemoryTagStatistics::kNumSizeBuckets; i++)
+    {
+        stats.mAllocationCount[i] = counters.mAllocationCount[i];
+    }
+    return CHIP_NO_ERROR;
+}
+
+const char * MemoryTagLabel(MemoryTag tag)
+{
+    return (tag < kMemoryTag_Count) ? sTagLabels[tag] : "";
+}
+
+void MemoryDumpTagStatistics()
+{
+    for (uint8_t tag = 0; tag < kMemoryTag_Count; tag++)
+    {
+        const TagCounters & counters = gTagCounters[tag];
+        char histogram[MemoryTagStatistics::kNumSizeBuckets * 11 + 1];
+        size_t written = 0;
+        for (size_t i = 0; i < MemoryTagStatistics::kNumSizeBuckets && written < sizeof(histogram); i++)
+        {
+            written += static_cast<size_t>(snprintf(histogram + written, sizeof(histogram) - written, "%s%" PRIu32, (i == 0) ? "" : "/",
+                                                    counters.mAllocationCount[i].load()));
+        }
+        ChipLogProgress(Support, "Heap[%s]: live %" PRIu32 " B in %" PRIu32 " blocks, high watermark %" PRIu32 " B, allocs %s",
+                        sTagLabels[tag], counters.mLiveBytes.load(), counters.mLiveBlockCount.load(),
+                        counters.mHighWatermarkBytes.load(), histogram);
+    }
+}
+
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
+
 } // namespace Platform
 } // namespace chip
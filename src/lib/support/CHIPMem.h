@@ -130,6 +130,141 @@ extern void * MemoryRealloc(void * p, size_t size);
  */
 extern void MemoryFree(void * p);
 
+/**
+ * Usage counters for the memory allocator, filled out by MemoryGetHeapStatistics().
+ *
+ * The allocation-size histogram counts every allocation request since MemoryInit() by its
+ * requested size; bucket i covers sizes up to kSizeBucketBase << i bytes, and the last
+ * bucket covers everything larger.
+ */
+struct HeapStatistics
+{
+    static constexpr size_t kNumSizeBuckets = 8;
+    static constexpr size_t kSizeBucketBase = 16;
+
+    uint32_t mFreeBytes                        = 0;  /**< Sum of all free block sizes. */
+    uint32_t mUsedBytes                        = 0;  /**< Sum of all allocated block sizes. */
+    uint32_t mLargestFreeBlockBytes            = 0;  /**< Size of the largest contiguous free block. */
+    uint32_t mFreeBlockCount                   = 0;
+    uint32_t mUsedBlockCount                   = 0;
+    uint32_t mAllocationCount[kNumSizeBuckets] = {}; /**< Allocation requests per size bucket. */
+    uint32_t mFailedAllocationCount            = 0;  /**< Allocation requests that returned nullptr. */
+};
+
+/**
+ * This function reports live usage statistics for the memory allocator, for runtime visibility
+ * into heap pressure and fragmentation (1 - mLargestFreeBlockBytes / mFreeBytes) from the field.
+ *
+ * Only allocators that manage their own heap can report these; the default implementation (used
+ * with the C Standard Library allocator and platform-specific allocators) returns
+ * CHIP_ERROR_NOT_IMPLEMENTED.
+ *
+ * @param[out] stats            Filled out with the current statistics on success.
+ *
+ * @retval  #CHIP_NO_ERROR              On success.
+ * @retval  #CHIP_ERROR_INCORRECT_STATE If the allocator has not been initialized.
+ * @retval  #CHIP_ERROR_NOT_IMPLEMENTED If the configured allocator does not track statistics.
+ *
+ */
+extern CHIP_ERROR MemoryGetHeapStatistics(HeapStatistics & stats);
+
+/**
+ * Subsystem tags for heap accounting via MemoryAllocTagged() and friends, so field reports
+ * can attribute heap growth to the subsystem responsible for it.
+ */
+enum MemoryTag : uint8_t
+{
+    kMemoryTag_General = 0, /**< Untagged or miscellaneous allocations. */
+    kMemoryTag_Crypto,
+    kMemoryTag_Dnssd,
+    kMemoryTag_InteractionModel,
+    kMemoryTag_Messaging,
+    kMemoryTag_TLV,
+
+    kMemoryTag_Count /**< Not a valid tag; number of tags. */
+};
+
+/**
+ * Per-tag usage counters, filled out by MemoryGetTagStatistics(). The allocation-size
+ * histogram uses the same bucketing as HeapStatistics: bucket i covers requested sizes up
+ * to kSizeBucketBase << i bytes, and the last bucket covers everything larger.
+ */
+struct MemoryTagStatistics
+{
+    static constexpr size_t kNumSizeBuckets = HeapStatistics::kNumSizeBuckets;
+    static constexpr size_t kSizeBucketBase = HeapStatistics::kSizeBucketBase;
+
+    uint32_t mLiveBytes                        = 0;  /**< Requested bytes currently allocated under this tag. */
+    uint32_t mLiveBlockCount                   = 0;  /**< Blocks currently allocated under this tag. */
+    uint32_t mHighWatermarkBytes               = 0;  /**< Largest value mLiveBytes has reached. */
+    uint32_t mAllocationCount[kNumSizeBuckets] = {}; /**< Allocation requests per size bucket. */
+};
+
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+
+/**
+ * These functions behave as MemoryAlloc()/MemoryCalloc()/MemoryFree(), but attribute the
+ * allocation to the given subsystem tag for accounting. A block allocated with a tagged
+ * function must be released with MemoryFreeTagged(), and vice versa; the tagged and plain
+ * families may not be mixed on the same block.
+ */
+extern void * MemoryAllocTagged(size_t size, MemoryTag tag);
+extern void * MemoryCallocTagged(size_t num, size_t size, MemoryTag tag);
+extern void MemoryFreeTagged(void * p);
+
+/**
+ * This function reports the accumulated counters for one tag.
+ *
+ * @param[in]  tag              The subsystem tag to query.
+ * @param[out] stats            Filled out with the tag's current counters on success.
+ *
+ * @retval  #CHIP_NO_ERROR              On success.
+ * @retval  #CHIP_ERROR_INVALID_ARGUMENT If \a tag is not a valid tag.
+ */
+extern CHIP_ERROR MemoryGetTagStatistics(MemoryTag tag, MemoryTagStatistics & stats);
+
+/**
+ * This function returns a human-readable label for the given tag, for logs and reports.
+ */
+extern const char * MemoryTagLabel(MemoryTag tag);
+
+/**
+ * This function logs one line per tag with live bytes and blocks, the high watermark, and
+ * the allocation-size histogram. Intended as a dump hook for field diagnostics.
+ */
+extern void MemoryDumpTagStatistics();
+
+#else // CHIP_CONFIG_MEMORY_ACCOUNTING
+
+inline void * MemoryAllocTagged(size_t size, MemoryTag)
+{
+    return MemoryAlloc(size);
+}
+
+inline void * MemoryCallocTagged(size_t num, size_t size, MemoryTag)
+{
+    return MemoryCalloc(num, size);
+}
+
+inline void MemoryFreeTagged(void * p)
+{
+    MemoryFree(p);
+}
+
+inline CHIP_ERROR MemoryGetTagStatistics(MemoryTag, MemoryTagStatistics &)
+{
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+}
+
+inline const char * MemoryTagLabel(MemoryTag)
+{
+    return "";
+}
+
+inline void MemoryDumpTagStatistics() {}
+
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
+
 /**
  * This function wraps the operator `new` with placement-new using MemoryAlloc().
  * Instead of
@@ -0,0 +1,256 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/ChunkedBlobStorage.h>
+
+#include <lib/support/BufferReader.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
+
+#include <stdio.h>
+#include <string.h>
+
+namespace chip {
+
+namespace {
+
+constexpr uint8_t kBlobHeaderVersion = 1;
+
+// version (u8) + chunk count (u16) + total length (u32)
+constexpr size_t kBlobHeaderSize = sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint32_t);
+
+} // namespace
+
+CHIP_ERROR ChunkedBlobStorage::Init(PersistentStorageDelegate * storage, const char * baseKey)
+{
+    VerifyOrReturnError(storage != nullptr && baseKey != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mState == State::kIdle, CHIP_ERROR_INCORRECT_STATE);
+
+    size_t keyLength = strlen(baseKey);
+    VerifyOrReturnError(keyLength > 0 && keyLength <= kMaxBaseKeyLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mStorage = storage;
+    memcpy(mBaseKey, baseKey, keyLength + 1);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChunkedBlobStorage::StartWrite(TLV::TLVWriter & writer)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::kIdle, CHIP_ERROR_INCORRECT_STATE);
+
+    // Remember how many chunks the current value occupies so that any trailing
+    // chunks the new value does not reuse can be deleted on finalize.  A
+    // missing or unreadable header just means there is nothing to clean up.
+    uint32_t previousLength = 0;
+    if (ReadHeader(mPreviousChunkCount, previousLength) != CHIP_NO_ERROR)
+    {
+        mPreviousChunkCount = 0;
+    }
+
+    mState           = State::kWriting;
+    mWriteChunkIndex = 0;
+    mWrittenLength   = 0;
+
+    CHIP_ERROR err = writer.Init(*this);
+    if (err != CHIP_NO_ERROR)
+    {
+        mState = State::kIdle;
+    }
+    return err;
+}
+
+CHIP_ERROR ChunkedBlobStorage::StartRead(TLV::TLVReader & reader)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::kIdle, CHIP_ERROR_INCORRECT_STATE);
+
+    ReturnErrorOnFailure(ReadHeader(mChunkCount, mTotalLength));
+
+    mReadChunkIndex = 0;
+    return reader.Init(*this, mTotalLength);
+}
+
+CHIP_ERROR ChunkedBlobStorage::Delete()
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::kIdle, CHIP_ERROR_INCORRECT_STATE);
+
+    uint16_t chunkCount  = 0;
+    uint32_t totalLength = 0;
+    ReturnErrorOnFailure(ReadHeader(chunkCount, totalLength));
+
+    for (uint16_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++)
+    {
+        char chunkKey[kMaxBaseKeyLength + 16];
+        FormatChunkKey(chunkKey, sizeof(chunkKey), chunkIndex);
+        LogErrorOnFailure(mStorage->SyncDeleteKeyValue(chunkKey));
+    }
+
+    return mStorage->SyncDeleteKeyValue(mBaseKey);
+}
+
+CHIP_ERROR ChunkedBlobStorage::OnInit(TLV::TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen)
+{
+    VerifyOrReturnError(mState == State::kIdle, CHIP_ERROR_INCORRECT_STATE);
+
+    if (mChunkCount == 0)
+    {
+        bufStart = mChunk;
+        bufLen   = 0;
+        return CHIP_NO_ERROR;
+    }
+
+    uint16_t chunkLength = 0;
+    ReturnErrorOnFailure(LoadChunk(0, chunkLength));
+    mReadChunkIndex = 1;
+
+    bufStart = mChunk;
+    bufLen   = chunkLength;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChunkedBlobStorage::GetNextBuffer(TLV::TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen)
+{
+    if (mReadChunkIndex >= mChunkCount)
+    {
+        bufLen = 0;
+        return CHIP_NO_ERROR;
+    }
+
+    uint16_t chunkLength = 0;
+    ReturnErrorOnFailure(LoadChunk(mReadChunkIndex, chunkLength));
+    mReadChunkIndex++;
+
+    bufStart = mChunk;
+    bufLen   = chunkLength;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChunkedBlobStorage::OnInit(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen)
+{
+    VerifyOrReturnError(mState == State::kWriting, CHIP_ERROR_INCORRECT_STATE);
+
+    bufStart = mChunk;
+    bufLen   = kChunkSize;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChunkedBlobStorage::GetNewBuffer(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen)
+{
+    VerifyOrReturnError(mState == State::kWriting, CHIP_ERROR_INCORRECT_STATE);
+
+    // On entry bufLen is the unused space in the current chunk, so the chunk
+    // holds kChunkSize - bufLen bytes of encoded TLV.
+    uint32_t chunkLength = kChunkSize - bufLen;
+    ReturnErrorOnFailure(FlushChunk(mWriteChunkIndex, mChunk, static_cast<uint16_t>(chunkLength)));
+    mWriteChunkIndex++;
+    mWrittenLength += chunkLength;
+
+    bufStart = mChunk;
+    bufLen   = kChunkSize;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChunkedBlobStorage::FinalizeBuffer(TLV::TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen)
+{
+    VerifyOrReturnError(mState == State::kWriting, CHIP_ERROR_INCORRECT_STATE);
+
+    uint16_t newChunkCount = mWriteChunkIndex;
+    if (bufLen > 0)
+    {
+        ReturnErrorOnFailure(FlushChunk(mWriteChunkIndex, bufStart, static_cast<uint16_t>(bufLen)));
+        mWrittenLength += bufLen;
+        newChunkCount = static_cast<uint16_t>(mWriteChunkIndex + 1);
+    }
+
+    ReturnErrorOnFailure(WriteHeader(newChunkCount, mWrittenLength));
+
+    // Drop chunks of the previous value that the new, shorter value no longer
+    // covers.  The header already describes the new value, so failure to clean
+    // up an orphaned chunk is not fatal.
+    for (uint16_t chunkIndex = newChunkCount; chunkIndex < mPreviousChunkCount; chunkIndex++)
+    {
+        char chunkKey[kMaxBaseKeyLength + 16];
+        FormatChunkKey(chunkKey, sizeof(chunkKey), chunkIndex);
+        LogErrorOnFailure(mStorage->SyncDeleteKeyValue(chunkKey));
+    }
+
+    mState = State::kIdle;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChunkedBlobStorage::ReadHeader(uint16_t & chunkCount, uint32_t & totalLength)
+{
+    uint8_t header[kBlobHeaderSize];
+    uint16_t headerSize = sizeof(header);
+    ReturnErrorOnFailure(mStorage->SyncGetKeyValue(mBaseKey, header, headerSize));
+    VerifyOrReturnError(headerSize == kBlobHeaderSize, CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+
+    Encoding::LittleEndian::Reader headerReader(header, headerSize);
+    uint8_t version = 0;
+    ReturnErrorOnFailure(headerReader.Read8(&version).Read16(&chunkCount).Read32(&totalLength).StatusCode());
+    VerifyOrReturnError(version == kBlobHeaderVersion, CHIP_ERROR_VERSION_MISMATCH);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChunkedBlobStorage::WriteHeader(uint16_t chunkCount, uint32_t totalLength)
+{
+    uint8_t header[kBlobHeaderSize];
+    Encoding::LittleEndian::BufferWriter headerWriter(header, sizeof(header));
+    headerWriter.Put8(kBlobHeaderVersion).Put16(chunkCount).Put32(totalLength);
+    VerifyOrReturnError(headerWriter.Fit(), CHIP_ERROR_INTERNAL);
+
+    return mStorage->SyncSetKeyValue(mBaseKey, header, static_cast<uint16_t>(headerWriter.Needed()));
+}
+
+CHIP_ERROR ChunkedBlobStorage::FlushChunk(uint16_t chunkIndex, const uint8_t * data, uint16_t length)
+{
+    char chunkKey[kMaxBaseKeyLength + 16];
+    FormatChunkKey(chunkKey, sizeof(chunkKey), chunkIndex);
+
+    // Skip the write if the stored chunk already holds these exact bytes, so a
+    // rewrite of a mostly unchanged blob only touches the chunks that differ.
+    if (chunkIndex < mPreviousChunkCount)
+    {
+        uint16_t storedLength = sizeof(mCompareChunk);
+        CHIP_ERROR err        = mStorage->SyncGetKeyValue(chunkKey, mCompareChunk, storedLength);
+        if (err == CHIP_NO_ERROR && storedLength == length && memcmp(mCompareChunk, data, length) == 0)
+        {
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    return mStorage->SyncSetKeyValue(chunkKey, data, length);
+}
+
+CHIP_ERROR ChunkedBlobStorage::LoadChunk(uint16_t chunkIndex, uint16_t & length)
+{
+    char chunkKey[kMaxBaseKeyLength + 16];
+    FormatChunkKey(chunkKey, sizeof(chunkKey), chunkIndex);
+
+    length = sizeof(mChunk);
+    return mStorage->SyncGetKeyValue(chunkKey, mChunk, length);
+}
+
+void ChunkedBlobStorage::FormatChunkKey(char * keyBuffer, size_t keyBufferSize, uint16_t chunkIndex) const
+{
+    snprintf(keyBuffer, keyBufferSize, "%s.c%u", mBaseKey, chunkIndex);
+}
+
+} // namespace chip
@@ -0,0 +1,125 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/core/CHIPTLV.h>
+
+namespace chip {
+
+/**
+ * @brief
+ *   Streams a large TLV blob to and from a PersistentStorageDelegate in
+ *   fixed-size chunks, so the blob never has to be materialized in RAM.
+ *
+ *   The blob is stored as a small header record under the caller's base key
+ *   (version, chunk count, total length) plus one storage entry per chunk
+ *   ("<baseKey>.c<n>").  Writing streams a TLVWriter through a single chunk
+ *   buffer that is flushed to storage as it fills; a chunk whose bytes are
+ *   unchanged from the previously stored copy is skipped, so a rewrite of a
+ *   mostly unchanged blob only touches the chunks that actually differ.
+ *   Reading streams a TLVReader chunk by chunk through the same buffer.
+ *
+ *   Usage, writing:
+ *     ChunkedBlobStorage blob;
+ *     ReturnErrorOnFailure(blob.Init(storage, "f/1/em"));
+ *     TLV::TLVWriter writer;
+ *     ReturnErrorOnFailure(blob.StartWrite(writer));
+ *     ... encode with writer ...
+ *     ReturnErrorOnFailure(writer.Finalize());
+ *
+ *   Usage, reading:
+ *     TLV::TLVReader reader;
+ *     ReturnErrorOnFailure(blob.StartRead(reader));
+ *     ... decode with reader ...
+ */
+class ChunkedBlobStorage : public TLV::TLVBackingStore
+{
+public:
+    // Base keys must leave room for the ".c<n>" chunk suffix within what the
+    // storage backends accept.
+    static constexpr size_t kMaxBaseKeyLength = 32;
+    static constexpr size_t kChunkSize        = 256;
+
+    CHIP_ERROR Init(PersistentStorageDelegate * storage, const char * baseKey);
+
+    /**
+     * Begin streaming a new value for the blob.  The previous value, if any,
+     * remains readable until the writer is finalized.  The write is complete
+     * once the writer's Finalize() returns success; on any earlier failure the
+     * stored header still describes the previous value.
+     */
+    CHIP_ERROR StartWrite(TLV::TLVWriter & writer);
+
+    /**
+     * Begin streaming the stored blob through the given reader.  The reader
+     * borrows this object's chunk buffer while it is being parsed, so a
+     * subsequent StartWrite() or StartRead() invalidates a reader that is
+     * still in progress.
+     */
+    CHIP_ERROR StartRead(TLV::TLVReader & reader);
+
+    /// Remove the blob and all of its chunks from storage.
+    CHIP_ERROR Delete();
+
+    // TLVBackingStore implementation, used by the reader/writer handed to
+    // StartRead()/StartWrite().
+    CHIP_ERROR OnInit(TLV::TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override;
+    CHIP_ERROR GetNextBuffer(TLV::TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override;
+    CHIP_ERROR OnInit(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
+    CHIP_ERROR GetNewBuffer(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
+    CHIP_ERROR FinalizeBuffer(TLV::TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override;
+
+private:
+    enum class State : uint8_t
+    {
+        kIdle = 0,
+        kWriting,
+    };
+
+    CHIP_ERROR ReadHeader(uint16_t & chunkCount, uint32_t & totalLength);
+    CHIP_ERROR WriteHeader(uint16_t chunkCount, uint32_t totalLength);
+    CHIP_ERROR FlushChunk(uint16_t chunkIndex, const uint8_t * data, uint16_t length);
+    CHIP_ERROR LoadChunk(uint16_t chunkIndex, uint16_t & length);
+    void FormatChunkKey(char * keyBuffer, size_t keyBufferSize, uint16_t chunkIndex) const;
+
+    PersistentStorageDelegate * mStorage = nullptr;
+    char mBaseKey[kMaxBaseKeyLength + 1] = { 0 };
+
+    State mState = State::kIdle;
+
+    // Write state: index of the chunk the writer is currently filling, bytes
+    // flushed so far, and how many chunks the previous value occupied (so stale
+    // trailing chunks can be deleted on finalize).
+    uint16_t mWriteChunkIndex    = 0;
+    uint32_t mWrittenLength      = 0;
+    uint16_t mPreviousChunkCount = 0;
+
+    // Read state: geometry from the header and the chunk currently being parsed.
+    uint16_t mReadChunkIndex = 0;
+    uint16_t mChunkCount     = 0;
+    uint32_t mTotalLength    = 0;
+
+    uint8_t mChunk[kChunkSize];
+    // Previously stored copy of the chunk being flushed, for skipping writes of
+    // unchanged chunks.
+    uint8_t mCompareChunk[kChunkSize];
+};
+
+} // namespace chip
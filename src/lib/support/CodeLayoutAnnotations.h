@@ -0,0 +1,42 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Hot/cold code placement annotations.
+ *
+ *      CHIP_HOT marks functions on the per-message fast path so the compiler
+ *      optimizes them more aggressively and groups them in the text section.
+ *      CHIP_COLD marks functions only reached on failure (error formatting,
+ *      drop diagnostics, fatal handlers); the compiler optimizes them for
+ *      size, moves them out of line, and treats every path leading to a call
+ *      as unlikely — which pushes error-handling blocks out of the i-cache
+ *      footprint of the hot code that contains them.
+ *
+ *      Annotate sparingly: a wrong CHIP_HOT merely wastes text locality, but
+ *      a wrong CHIP_COLD pessimizes every caller.
+ */
+
+#pragma once
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CHIP_HOT __attribute__((hot))
+#define CHIP_COLD __attribute__((cold))
+#else
+#define CHIP_HOT
+#define CHIP_COLD
+#endif
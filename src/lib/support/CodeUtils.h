@@ -456,7 +456,7 @@ constexpr inline const _T & max(const _T & a, const _T & b)
  *
  */
 #ifndef chipDie
-extern "C" void chipDie(void) __attribute((noreturn));
+extern "C" void chipDie(void) __attribute((noreturn, cold));
 
 inline void chipDie(void)
 {
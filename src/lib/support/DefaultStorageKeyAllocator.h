@@ -17,10 +17,50 @@
 #pragma once
 
 #include <app/util/basic-types.h>
+#include <inttypes.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <string.h>
 
 namespace chip {
 
+/**
+ * A fabric-scoped key prefix ("f/<fabric>/"), formatted once and reused, so
+ * that repeated per-fabric key constructions only append their suffix instead
+ * of re-formatting the fabric portion on every access.
+ */
+class FabricStorageKeyPrefix
+{
+public:
+    FabricStorageKeyPrefix() = default;
+    explicit FabricStorageKeyPrefix(chip::FabricIndex fabric) { Reset(fabric); }
+
+    void Reset(chip::FabricIndex fabric)
+    {
+        mFabric = fabric;
+        mLength = static_cast<size_t>(snprintf(mPrefix, sizeof(mPrefix), "f/%x/", fabric));
+    }
+
+    // Re-format only when the fabric changes; cheap to call on every key build.
+    void Sync(chip::FabricIndex fabric)
+    {
+        if (mFabric != fabric || mLength == 0)
+        {
+            Reset(fabric);
+        }
+    }
+
+    chip::FabricIndex GetFabricIndex() const { return mFabric; }
+    const char * Prefix() const { return mPrefix; }
+    size_t Length() const { return mLength; }
+    bool IsValid() const { return mLength > 0; }
+
+private:
+    // Long enough for "f/" + two hex digits + "/" + terminator.
+    char mPrefix[8]           = { 0 };
+    size_t mLength            = 0;
+    chip::FabricIndex mFabric = kUndefinedFabricIndex;
+};
+
 /**
  * This is the common key allocation policy for all classes using PersistentStorageDelegate storage
  */
@@ -45,8 +85,52 @@ public:
     }
     const char * FabricKeyset(chip::FabricIndex fabric, uint16_t keyset) { return Format("f/%x/k/%x", fabric, keyset); }
 
+    // Prefix-cached variants of the fabric-scoped keys above.  The fabric portion
+    // comes from the already formatted prefix, so only the suffix is built per call.
+
+    const char * FabricTable(const FabricStorageKeyPrefix & prefix) { return AppendSuffix(prefix, "t"); }
+    const char * FabricGroups(const FabricStorageKeyPrefix & prefix) { return AppendSuffix(prefix, "g"); }
+    const char * FabricGroup(const FabricStorageKeyPrefix & prefix, chip::GroupId group)
+    {
+        return AppendSuffixFormat(prefix, "g/%x", group);
+    }
+    const char * FabricGroupKey(const FabricStorageKeyPrefix & prefix, uint16_t index)
+    {
+        return AppendSuffixFormat(prefix, "gk/%x", index);
+    }
+    const char * FabricGroupEndpoint(const FabricStorageKeyPrefix & prefix, chip::GroupId group, chip::EndpointId endpoint)
+    {
+        return AppendSuffixFormat(prefix, "g/%x/e/%x", group, endpoint);
+    }
+    const char * FabricKeyset(const FabricStorageKeyPrefix & prefix, uint16_t keyset)
+    {
+        return AppendSuffixFormat(prefix, "k/%x", keyset);
+    }
+
+    // Access control list
+    const char * AccessControlEntry(size_t index) { return Format("g/acl/%x", static_cast<unsigned>(index)); }
+
+    // Subscription resumption
+    const char * SubscriptionResumption(uint16_t index) { return Format("g/su/%x", index); }
+
+    // Write-behind storage journal (see JournalingStorageDelegate)
+    const char * StorageJournal() { return Format("g/sj"); }
+
+    // CASE session resumption cache
+    const char * CaseResumptionEntry(uint16_t index) { return Format("g/crs/%x", index); }
+
+    // Persistent event log (see app/PersistentEventLog)
+    const char * EventLogState() { return Format("g/evl/s"); }
+    const char * EventLogSegment(uint16_t index) { return Format("g/evl/%x", index); }
+
+    // Operational node address cache
+    const char * PersistedNodeAddress(uint64_t compressedFabricId, uint64_t nodeId)
+    {
+        return Format("g/a/%" PRIX64 "/%" PRIX64, compressedFabricId, nodeId);
+    }
+
 private:
-    static const size_t kKeyLengthMax = 32;
+    static const size_t kKeyLengthMax = 40;
 
     const char * Format(const char * format...)
     {
@@ -57,6 +141,65 @@ private:
         return mKeyName;
     }
 
+    const char * AppendSuffix(const FabricStorageKeyPrefix & prefix, const char * suffix)
+    {
+        memcpy(mKeyName, prefix.Prefix(), prefix.Length());
+        strncpy(mKeyName + prefix.Length(), suffix, sizeof(mKeyName) - prefix.Length());
+        mKeyName[kKeyLengthMax] = '\0';
+        return mKeyName;
+    }
+
+    const char * AppendSuffixFormat(const FabricStorageKeyPrefix & prefix, const char * format...)
+    {
+        memcpy(mKeyName, prefix.Prefix(), prefix.Length());
+        va_list args;
+        va_start(args, format);
+        vsnprintf(mKeyName + prefix.Length(), sizeof(mKeyName) - prefix.Length(), format, args);
+        va_end(args);
+        return mKeyName;
+    }
+
+    char mKeyName[kKeyLengthMax + 1] = { 0 };
+};
+
+/**
+ * A view of a PersistentStorageDelegate namespaced under one fabric's key
+ * prefix.  Keys passed to the accessors are relative to "f/<fabric>/" and are
+ * joined to the precomputed prefix with a copy, so repeated per-fabric
+ * operations never re-format the fabric portion of the key.
+ */
+class FabricScopedStorageView
+{
+public:
+    FabricScopedStorageView(PersistentStorageDelegate & storage, chip::FabricIndex fabric) : mStorage(storage), mPrefix(fabric) {}
+
+    const FabricStorageKeyPrefix & GetPrefix() const { return mPrefix; }
+
+    CHIP_ERROR SyncGetKeyValue(const char * subKey, void * buffer, uint16_t & size)
+    {
+        return mStorage.SyncGetKeyValue(JoinKey(subKey), buffer, size);
+    }
+
+    CHIP_ERROR SyncSetKeyValue(const char * subKey, const void * value, uint16_t size)
+    {
+        return mStorage.SyncSetKeyValue(JoinKey(subKey), value, size);
+    }
+
+    CHIP_ERROR SyncDeleteKeyValue(const char * subKey) { return mStorage.SyncDeleteKeyValue(JoinKey(subKey)); }
+
+private:
+    static const size_t kKeyLengthMax = 40;
+
+    const char * JoinKey(const char * subKey)
+    {
+        memcpy(mKeyName, mPrefix.Prefix(), mPrefix.Length());
+        strncpy(mKeyName + mPrefix.Length(), subKey, sizeof(mKeyName) - mPrefix.Length());
+        mKeyName[kKeyLengthMax] = '\0';
+        return mKeyName;
+    }
+
+    PersistentStorageDelegate & mStorage;
+    FabricStorageKeyPrefix mPrefix;
     char mKeyName[kKeyLengthMax + 1] = { 0 };
 };
 
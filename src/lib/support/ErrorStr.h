@@ -28,6 +28,7 @@
 #include <stdint.h>
 
 #include <lib/core/CHIPError.h>
+#include <lib/support/CodeLayoutAnnotations.h>
 #include <lib/support/DLLUtil.h>
 
 namespace chip {
@@ -49,11 +50,13 @@ struct ErrorFormatter
     ErrorFormatter * Next;
 };
 
-extern const char * ErrorStr(CHIP_ERROR err);
+// Error formatting only runs on failure paths; marking it cold makes every
+// block that calls it cold too, keeping error handling out of the hot text.
+extern CHIP_COLD const char * ErrorStr(CHIP_ERROR err);
 extern void RegisterErrorFormatter(ErrorFormatter * errFormatter);
 extern void DeregisterErrorFormatter(ErrorFormatter * errFormatter);
-extern void FormatError(char * buf, uint16_t bufSize, const char * subsys, CHIP_ERROR err, const char * desc);
+extern CHIP_COLD void FormatError(char * buf, uint16_t bufSize, const char * subsys, CHIP_ERROR err, const char * desc);
 
-extern const char * StatusReportStr(uint32_t profileId, uint16_t statusCode);
+extern CHIP_COLD const char * StatusReportStr(uint32_t profileId, uint16_t statusCode);
 
 } // namespace chip
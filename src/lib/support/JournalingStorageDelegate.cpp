@@ -0,0 +1,286 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/JournalingStorageDelegate.h>
+
+#include <lib/support/BufferReader.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string.h>
+
+namespace chip {
+
+namespace {
+
+// Serialized entry: keyLen(1) | key | flags(1) | valueSize(2) | value
+constexpr size_t kEntryOverhead = 1 + 1 + 2;
+constexpr uint8_t kFlagDelete   = 0x01;
+
+constexpr size_t kMaxJournalSize =
+    JournalingStorageDelegate::kMaxPendingEntries *
+    (kEntryOverhead + JournalingStorageDelegate::kMaxKeyLength + JournalingStorageDelegate::kMaxValueSize);
+
+const char * JournalKey(DefaultStorageKeyAllocator & keys)
+{
+    return keys.StorageJournal();
+}
+
+} // namespace
+
+CHIP_ERROR JournalingStorageDelegate::Init(PersistentStorageDelegate * backend)
+{
+    VerifyOrReturnError(backend != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    mBackend          = backend;
+    mPendingCount     = 0;
+    mTransactionDepth = 0;
+
+    // Replay any journal left behind by a crash before serving traffic.
+    CHIP_ERROR err = LoadJournal();
+    if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        return CHIP_NO_ERROR;
+    }
+    ReturnErrorOnFailure(err);
+
+    ChipLogProgress(Support, "Replaying %u journaled storage operation(s)", static_cast<unsigned>(mPendingCount));
+    return Flush();
+}
+
+CHIP_ERROR JournalingStorageDelegate::Flush()
+{
+    VerifyOrReturnError(mBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mPendingCount > 0, CHIP_NO_ERROR);
+
+    ReturnErrorOnFailure(ApplyPending());
+    mPendingCount = 0;
+
+    DefaultStorageKeyAllocator keys;
+    CHIP_ERROR err = mBackend->SyncDeleteKeyValue(JournalKey(keys));
+    if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        err = CHIP_NO_ERROR;
+    }
+    return err;
+}
+
+CHIP_ERROR JournalingStorageDelegate::SyncGetKeyValue(const char * key, void * buffer, uint16_t & size)
+{
+    VerifyOrReturnError(mBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    // Read-your-writes: pending entries shadow the backend.
+    if (PendingEntry * entry = FindPending(key))
+    {
+        VerifyOrReturnError(!entry->isDelete, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+        if (entry->valueSize > size)
+        {
+            size = entry->valueSize;
+            return CHIP_ERROR_BUFFER_TOO_SMALL;
+        }
+        size = entry->valueSize;
+        memcpy(buffer, entry->value, size);
+        return CHIP_NO_ERROR;
+    }
+
+    return mBackend->SyncGetKeyValue(key, buffer, size);
+}
+
+CHIP_ERROR JournalingStorageDelegate::SyncSetKeyValue(const char * key, const void * value, uint16_t size)
+{
+    VerifyOrReturnError(mBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key != nullptr && (value != nullptr || size == 0), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Values too large to journal are written through, after flushing pending
+    // operations so ordering relative to them is preserved.
+    if (strlen(key) > kMaxKeyLength || size > kMaxValueSize)
+    {
+        ReturnErrorOnFailure(Flush());
+        return mBackend->SyncSetKeyValue(key, value, size);
+    }
+
+    return Record(key, value, size, /* isDelete = */ false);
+}
+
+CHIP_ERROR JournalingStorageDelegate::SyncDeleteKeyValue(const char * key)
+{
+    VerifyOrReturnError(mBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (strlen(key) > kMaxKeyLength)
+    {
+        ReturnErrorOnFailure(Flush());
+        return mBackend->SyncDeleteKeyValue(key);
+    }
+
+    return Record(key, nullptr, 0, /* isDelete = */ true);
+}
+
+CHIP_ERROR JournalingStorageDelegate::SyncBeginTransaction()
+{
+    VerifyOrReturnError(mBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    if (mTransactionDepth == 0)
+    {
+        ReturnErrorOnFailure(mBackend->SyncBeginTransaction());
+    }
+    mTransactionDepth++;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR JournalingStorageDelegate::SyncCommitTransaction()
+{
+    VerifyOrReturnError(mBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mTransactionDepth > 0, CHIP_ERROR_INCORRECT_STATE);
+
+    mTransactionDepth--;
+    if (mTransactionDepth > 0)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR err = Flush();
+    CHIP_ERROR commitErr = mBackend->SyncCommitTransaction();
+    return (err != CHIP_NO_ERROR) ? err : commitErr;
+}
+
+JournalingStorageDelegate::PendingEntry * JournalingStorageDelegate::FindPending(const char * key)
+{
+    for (size_t i = 0; i < mPendingCount; i++)
+    {
+        if (strcmp(mPending[i].key, key) == 0)
+        {
+            return &mPending[i];
+        }
+    }
+    return nullptr;
+}
+
+CHIP_ERROR JournalingStorageDelegate::Record(const char * key, const void * value, uint16_t size, bool isDelete)
+{
+    PendingEntry * entry = FindPending(key);
+    const bool isNewEntry = (entry == nullptr);
+    if (isNewEntry)
+    {
+        if (mPendingCount == kMaxPendingEntries)
+        {
+            ReturnErrorOnFailure(Flush());
+        }
+        entry = &mPending[mPendingCount];
+        strncpy(entry->key, key, sizeof(entry->key));
+        entry->key[kMaxKeyLength] = '\0';
+        mPendingCount++;
+    }
+
+    entry->isDelete  = isDelete;
+    entry->valueSize = size;
+    if (size > 0)
+    {
+        memcpy(entry->value, value, size);
+    }
+
+    // Persist the journal record before acknowledging, so the operation
+    // survives a crash even though its real key has not been written yet.
+    CHIP_ERROR err = PersistJournal();
+    if (err != CHIP_NO_ERROR)
+    {
+        // Drop the entry we failed to make durable and fall back to a direct
+        // write so the caller still gets correct semantics.
+        if (isNewEntry)
+        {
+            mPendingCount--;
+        }
+        return isDelete ? mBackend->SyncDeleteKeyValue(key) : mBackend->SyncSetKeyValue(key, value, size);
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR JournalingStorageDelegate::PersistJournal()
+{
+    uint8_t serialized[kMaxJournalSize];
+    Encoding::LittleEndian::BufferWriter writer(serialized, sizeof(serialized));
+
+    for (size_t i = 0; i < mPendingCount; i++)
+    {
+        const PendingEntry & entry = mPending[i];
+        size_t keyLen              = strlen(entry.key);
+        writer.Put8(static_cast<uint8_t>(keyLen));
+        writer.Put(entry.key, keyLen);
+        writer.Put8(entry.isDelete ? kFlagDelete : 0);
+        writer.Put16(entry.valueSize);
+        writer.Put(entry.value, entry.valueSize);
+    }
+    VerifyOrReturnError(writer.Fit(), CHIP_ERROR_INTERNAL);
+
+    DefaultStorageKeyAllocator keys;
+    return mBackend->SyncSetKeyValue(JournalKey(keys), serialized, static_cast<uint16_t>(writer.Needed()));
+}
+
+CHIP_ERROR JournalingStorageDelegate::ApplyPending()
+{
+    for (size_t i = 0; i < mPendingCount; i++)
+    {
+        const PendingEntry & entry = mPending[i];
+        if (entry.isDelete)
+        {
+            CHIP_ERROR err = mBackend->SyncDeleteKeyValue(entry.key);
+            if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+            {
+                return err;
+            }
+        }
+        else
+        {
+            ReturnErrorOnFailure(mBackend->SyncSetKeyValue(entry.key, entry.value, entry.valueSize));
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR JournalingStorageDelegate::LoadJournal()
+{
+    uint8_t serialized[kMaxJournalSize];
+    uint16_t size = sizeof(serialized);
+
+    DefaultStorageKeyAllocator keys;
+    ReturnErrorOnFailure(mBackend->SyncGetKeyValue(JournalKey(keys), serialized, size));
+
+    Encoding::LittleEndian::Reader reader(serialized, size);
+    mPendingCount = 0;
+    while (reader.Remaining() > 0)
+    {
+        VerifyOrReturnError(mPendingCount < kMaxPendingEntries, CHIP_ERROR_INVALID_ARGUMENT);
+        PendingEntry & entry = mPending[mPendingCount];
+
+        uint8_t keyLen;
+        uint8_t flags;
+        ReturnErrorOnFailure(reader.Read8(&keyLen).StatusCode());
+        VerifyOrReturnError(keyLen > 0 && keyLen <= kMaxKeyLength, CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(reader.ReadBytes(reinterpret_cast<uint8_t *>(entry.key), keyLen).StatusCode());
+        entry.key[keyLen] = '\0';
+
+        ReturnErrorOnFailure(reader.Read8(&flags).Read16(&entry.valueSize).StatusCode());
+        entry.isDelete = (flags & kFlagDelete) != 0;
+        VerifyOrReturnError(entry.valueSize <= kMaxValueSize, CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(reader.ReadBytes(entry.value, entry.valueSize).StatusCode());
+
+        mPendingCount++;
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace chip
@@ -0,0 +1,100 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * Write-behind journal over a PersistentStorageDelegate.
+ *
+ * Small Set/Delete operations are buffered in RAM and mirrored into a single
+ * compact journal record in the backend, so a burst of writes (commissioning,
+ * message counter epoch rollovers) rewrites one key instead of committing each
+ * target key individually. Repeated writes to the same key collapse into one
+ * pending entry. Buffered operations are applied to their real keys when:
+ *   - the journal fills up,
+ *   - the outermost SyncCommitTransaction() completes,
+ *   - Flush() is called explicitly, or
+ *   - a value too large to journal forces write-through ordering.
+ *
+ * Durability is preserved: the journal record is persisted before a mutation
+ * is acknowledged, and Init() replays any journal left behind by a crash
+ * before normal operation resumes. Reads consult pending entries first, so
+ * callers always observe their own writes.
+ */
+class JournalingStorageDelegate : public PersistentStorageDelegate
+{
+public:
+    static constexpr size_t kMaxPendingEntries = 8;
+    static constexpr size_t kMaxKeyLength      = 40;  // DefaultStorageKeyAllocator::kKeyLengthMax
+    static constexpr uint16_t kMaxValueSize    = 256; // larger values are written through
+
+    JournalingStorageDelegate() {}
+
+    /// Wires the backend and replays any journal record persisted before a
+    /// crash or unclean shutdown.
+    CHIP_ERROR Init(PersistentStorageDelegate * backend);
+
+    /// Applies all pending operations to their real keys and removes the
+    /// journal record. Safe to call when nothing is pending.
+    CHIP_ERROR Flush();
+
+    size_t GetPendingEntryCount() const { return mPendingCount; }
+
+    // PersistentStorageDelegate
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override;
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override;
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override;
+    CHIP_ERROR SyncBeginTransaction() override;
+    CHIP_ERROR SyncCommitTransaction() override;
+
+private:
+    struct PendingEntry
+    {
+        char key[kMaxKeyLength + 1];
+        uint16_t valueSize;
+        bool isDelete;
+        uint8_t value[kMaxValueSize];
+    };
+
+    PendingEntry * FindPending(const char * key);
+    CHIP_ERROR Record(const char * key, const void * value, uint16_t size, bool isDelete);
+
+    /// Serializes pending entries into the backend journal record (or deletes
+    /// the record when nothing is pending).
+    CHIP_ERROR PersistJournal();
+
+    /// Applies journal entries currently in mPending to their real keys.
+    CHIP_ERROR ApplyPending();
+
+    /// Loads a serialized journal record into mPending; returns
+    /// CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND when none exists.
+    CHIP_ERROR LoadJournal();
+
+    PersistentStorageDelegate * mBackend = nullptr;
+    PendingEntry mPending[kMaxPendingEntries];
+    size_t mPendingCount      = 0;
+    uint32_t mTransactionDepth = 0;
+};
+
+} // namespace chip
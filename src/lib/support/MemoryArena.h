@@ -0,0 +1,106 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace chip {
+
+/**
+ * Arena allocator over an embedded fixed-size buffer.
+ *
+ * Unlike FixedBufferAllocator, which hands out raw byte regions from a caller-provided
+ * buffer, this class owns its storage and supports aligned and typed allocations.  It is
+ * intended for transient state whose lifetime is bounded by some enclosing scope (for
+ * example a single interaction or exchange): individual objects are carved sequentially
+ * from the buffer and the entire arena is released at once via Reset().  Destructors are
+ * never run, so only trivially destructible types may be created in the arena.
+ */
+template <size_t kCapacity>
+class MemoryArena
+{
+public:
+    MemoryArena() = default;
+
+    /**
+     * Allocate a memory region of the given size and alignment.
+     *
+     * @param size       Number of bytes to allocate.
+     * @param alignment  Required alignment of the returned region; must be a power of two.
+     * @return           Pointer to the allocated region or nullptr if the arena is exhausted.
+     */
+    void * Allocate(size_t size, size_t alignment = alignof(max_align_t))
+    {
+        size_t offset = (mUsed + alignment - 1) & ~(alignment - 1);
+        if (size > kCapacity - offset || offset > kCapacity)
+        {
+            return nullptr;
+        }
+        mUsed = offset + size;
+        if (mUsed > mHighWatermark)
+        {
+            mHighWatermark = mUsed;
+        }
+        return &mBuffer[offset];
+    }
+
+    /**
+     * Construct an object of type T in the arena.
+     *
+     * @return  Pointer to the constructed object or nullptr if the arena is exhausted.
+     */
+    template <typename T, typename... Args>
+    T * New(Args &&... args)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "MemoryArena never runs destructors");
+        void * ptr = Allocate(sizeof(T), alignof(T));
+        if (ptr == nullptr)
+        {
+            return nullptr;
+        }
+        return new (ptr) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Release all allocations made from the arena.  Any pointers previously returned by
+     * Allocate() or New() become invalid.
+     */
+    void Reset() { mUsed = 0; }
+
+    size_t Used() const { return mUsed; }
+    size_t Capacity() const { return kCapacity; }
+
+    /**
+     * Returns the largest number of bytes ever in use at once, for tuning the capacity.
+     */
+    size_t HighWatermark() const { return mHighWatermark; }
+
+private:
+    MemoryArena(const MemoryArena &) = delete;
+    void operator=(const MemoryArena &) = delete;
+
+    alignas(alignof(max_align_t)) uint8_t mBuffer[kCapacity];
+    size_t mUsed          = 0;
+    size_t mHighWatermark = 0;
+};
+
+} // namespace chip
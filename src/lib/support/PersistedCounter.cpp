@@ -75,6 +75,25 @@ PersistedCounter::Advance()
     return CHIP_NO_ERROR;
 }
 
+bool PersistedCounter::NeedsReservation()
+{
+    uint32_t value = GetValue();
+    return (value >= mNextEpoch) || (mNextEpoch - value <= mEpoch / 2);
+}
+
+CHIP_ERROR
+PersistedCounter::ReserveIfNeeded()
+{
+    VerifyOrReturnError(mId != chip::Platform::PersistedStorage::kEmptyKey, CHIP_ERROR_INCORRECT_STATE);
+
+    if (!NeedsReservation())
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    return PersistNextEpochStart(mNextEpoch + mEpoch);
+}
+
 CHIP_ERROR
 PersistedCounter::PersistNextEpochStart(uint32_t aStartValue)
 {
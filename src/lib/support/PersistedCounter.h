@@ -84,6 +84,28 @@ public:
      */
     CHIP_ERROR Advance() override;
 
+    /**
+     *  @brief
+     *    Whether the counter is within half an epoch of exhausting its
+     *    persisted reservation, i.e. whether ReserveIfNeeded() would write.
+     */
+    bool NeedsReservation();
+
+    /**
+     *  @brief
+     *    Persist the next epoch start if the counter is nearing the end of the
+     *    currently persisted reservation.
+     *
+     *  Owners can call this from outside their hot path (e.g. after a message
+     *  has been sent) so that Advance() finds the reservation already extended
+     *  and never has to wait on a storage write.  Unused reservation is simply
+     *  skipped after a restart, exactly as with the boundary-time persistence
+     *  in Advance().
+     *
+     *  @return Any error returned by a write to persisted storage.
+     */
+    CHIP_ERROR ReserveIfNeeded();
+
 private:
     /**
      *  @brief
@@ -260,6 +260,119 @@ private:
     } mData;
 };
 
+/**
+ * A fixed-size pool whose CreateObject() and ReleaseObject() are safe to call
+ * concurrently from multiple threads without external locking.
+ *
+ * Free slots are kept on a Treiber stack whose head packs the slot index with a
+ * generation tag to defeat the ABA problem, so allocation and release each cost
+ * a single compare-exchange in the uncontended case.
+ *
+ * Unlike BitMapObjectPool there is no iteration support: while other threads
+ * allocate and release concurrently no consistent snapshot of the active set
+ * exists.  Use this pool for objects that are only ever reached through the
+ * pointer returned by CreateObject(), e.g. callback state allocated from
+ * binding threads.
+ *
+ *  @tparam     T   type of element to be allocated.
+ *  @tparam     N   a positive integer max number of elements the pool provides.
+ */
+template <class T, size_t N>
+class LockFreeObjectPool : public internal::PoolCommon<T>
+{
+    static_assert(N > 0 && N < std::numeric_limits<uint32_t>::max(), "Pool size must fit in the freelist index");
+    static_assert(ATOMIC_LLONG_LOCK_FREE, "LockFreeObjectPool is not lock free");
+
+public:
+    LockFreeObjectPool()
+    {
+        for (uint32_t i = 0; i < N; i++)
+        {
+            mNext[i].store(i + 1, std::memory_order_relaxed);
+        }
+        mHead.store(MakeHead(0, 0), std::memory_order_relaxed);
+    }
+    ~LockFreeObjectPool() { VerifyOrDie(Allocated() == 0); }
+
+    template <typename... Args>
+    T * CreateObject(Args &&... args)
+    {
+        uint64_t head = mHead.load(std::memory_order_acquire);
+        for (;;)
+        {
+            const uint32_t index = HeadIndex(head);
+            if (index == N)
+            {
+                return nullptr; // freelist is empty
+            }
+            // The next-index read may be stale if another thread pops this slot
+            // concurrently, but then the head tag has moved on and the
+            // compare-exchange below fails without publishing the stale value.
+            const uint64_t updated = MakeHead(mNext[index].load(std::memory_order_relaxed), HeadTag(head) + 1);
+            if (mHead.compare_exchange_weak(head, updated, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                IncreaseUsage();
+                return new (At(index)) T(std::forward<Args>(args)...);
+            }
+        }
+    }
+
+    void ReleaseObject(T * element)
+    {
+        if (element == nullptr)
+            return;
+
+        element->~T();
+
+        const uint32_t index = static_cast<uint32_t>(element - reinterpret_cast<T *>(mData.mMemory));
+        uint64_t head        = mHead.load(std::memory_order_acquire);
+        for (;;)
+        {
+            mNext[index].store(HeadIndex(head), std::memory_order_relaxed);
+            const uint64_t updated = MakeHead(index, HeadTag(head) + 1);
+            if (mHead.compare_exchange_weak(head, updated, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                mAllocated.fetch_sub(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    size_t Capacity() const { return N; }
+    size_t Allocated() const { return mAllocated.load(std::memory_order_relaxed); }
+    size_t HighWaterMark() const { return mHighWaterMark.load(std::memory_order_relaxed); }
+    bool Exhausted() const { return Allocated() == N; }
+
+private:
+    static constexpr uint64_t MakeHead(uint32_t index, uint32_t tag) { return (static_cast<uint64_t>(tag) << 32) | index; }
+    static constexpr uint32_t HeadIndex(uint64_t head) { return static_cast<uint32_t>(head & 0xFFFFFFFF); }
+    static constexpr uint32_t HeadTag(uint64_t head) { return static_cast<uint32_t>(head >> 32); }
+
+    void * At(size_t index) { return mData.mMemory + sizeof(T) * index; }
+
+    void IncreaseUsage()
+    {
+        const size_t allocated = mAllocated.fetch_add(1, std::memory_order_relaxed) + 1;
+        size_t highWaterMark   = mHighWaterMark.load(std::memory_order_relaxed);
+        while (allocated > highWaterMark &&
+               !mHighWaterMark.compare_exchange_weak(highWaterMark, allocated, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    std::atomic<uint64_t> mHead;        // (generation tag << 32) | index of first free slot; N means empty
+    std::atomic<uint32_t> mNext[N];     // per-slot freelist link, only meaningful while the slot is free
+    std::atomic<size_t> mAllocated{ 0 };
+    std::atomic<size_t> mHighWaterMark{ 0 };
+    union Data
+    {
+        Data() {}
+        ~Data() {}
+        alignas(alignof(T)) uint8_t mMemory[N * sizeof(T)];
+        T mMemoryViewForDebug[N]; // Just for debugger
+    } mData;
+};
+
 #if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 /**
@@ -306,6 +306,33 @@ void * PrivateHeapRealloc(void * heap, void * ptr, size_t size)
     return largerCopy;
 }
 
+extern "C" void PrivateHeapGetStatistics(void * heap, PrivateHeapStatistics * stats)
+{
+    PrivateHeapBlockHeader * header = reinterpret_cast<PrivateHeapBlockHeader *>(heap);
+
+    memset(stats, 0, sizeof(*stats));
+
+    for (; header->nextBytes != kInvalidHeapBlockSize; header = NextHeader(header))
+    {
+        ValidateHeader(header);
+
+        if (header->state == kHeapBlockFree)
+        {
+            stats->freeBytes += header->nextBytes;
+            stats->freeBlockCount++;
+            if (header->nextBytes > stats->largestFreeBlockBytes)
+            {
+                stats->largestFreeBlockBytes = header->nextBytes;
+            }
+        }
+        else
+        {
+            stats->usedBytes += header->nextBytes;
+            stats->usedBlockCount++;
+        }
+    }
+}
+
 extern "C" void PrivateHeapDump(void * top)
 {
     PrivateHeapBlockHeader * header = reinterpret_cast<PrivateHeapBlockHeader *>(top);
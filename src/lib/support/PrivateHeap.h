@@ -46,6 +46,19 @@ void * PrivateHeapRealloc(void * heap, void * ptr, size_t size);
 
 void PrivateHeapDump(void * ptr);
 
+// Aggregated usage counters for a private heap, filled out by PrivateHeapGetStatistics.
+typedef struct PrivateHeapStatistics
+{
+    uint32_t freeBytes;             // sum of all free block payload sizes
+    uint32_t usedBytes;             // sum of all in-use block payload sizes
+    uint32_t largestFreeBlockBytes; // payload size of the largest free block
+    uint32_t freeBlockCount;
+    uint32_t usedBlockCount;
+} PrivateHeapStatistics;
+
+// Walks the heap and fills out the block/byte usage counters above.
+void PrivateHeapGetStatistics(void * heap, PrivateHeapStatistics * stats);
+
 #ifdef __cplusplus
 } // extern "C"
 
@@ -0,0 +1,77 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Wrappers for clang's thread safety analysis attributes
+ *      (https://clang.llvm.org/docs/ThreadSafetyAnalysis.html).
+ *
+ *      These expand to nothing on compilers without the attributes, so
+ *      annotated code stays portable.  Locking requirements expressed with
+ *      these macros are checked when building with clang and
+ *      -Wthread-safety; the primary user is the chip stack lock
+ *      (PlatformManager::LockChipStack()), which external threads must hold
+ *      around any call into the stack.
+ */
+
+#pragma once
+
+#if defined(__clang__) && defined(__has_attribute)
+#define CHIP_THREAD_ANNOTATION_ATTRIBUTE(x) __attribute__((x))
+#else
+#define CHIP_THREAD_ANNOTATION_ATTRIBUTE(x)
+#endif
+
+/// Marks a class whose instances can be held and released, e.g. a mutex or
+/// a lock-like facade such as PlatformManager.
+#define CHIP_CAPABILITY(name) CHIP_THREAD_ANNOTATION_ATTRIBUTE(capability(name))
+
+/// Marks an RAII class that acquires a capability in its constructor and
+/// releases it in its destructor.
+#define CHIP_SCOPED_CAPABILITY CHIP_THREAD_ANNOTATION_ATTRIBUTE(scoped_lockable)
+
+/// Declares that a data member is protected by the given capability.
+#define CHIP_GUARDED_BY(x) CHIP_THREAD_ANNOTATION_ATTRIBUTE(guarded_by(x))
+
+/// Declares that the pointed-to data is protected by the given capability.
+#define CHIP_PT_GUARDED_BY(x) CHIP_THREAD_ANNOTATION_ATTRIBUTE(pt_guarded_by(x))
+
+/// Declares that a function acquires the given capability and holds it on
+/// return.
+#define CHIP_ACQUIRE(...) CHIP_THREAD_ANNOTATION_ATTRIBUTE(acquire_capability(__VA_ARGS__))
+
+/// Declares that a function releases the given capability.
+#define CHIP_RELEASE(...) CHIP_THREAD_ANNOTATION_ATTRIBUTE(release_capability(__VA_ARGS__))
+
+/// Declares that a function attempts to acquire the given capability and
+/// returns `success` when it holds it.
+#define CHIP_TRY_ACQUIRE(...) CHIP_THREAD_ANNOTATION_ATTRIBUTE(try_acquire_capability(__VA_ARGS__))
+
+/// Declares that the caller must hold the given capability when calling the
+/// function.
+#define CHIP_REQUIRES(...) CHIP_THREAD_ANNOTATION_ATTRIBUTE(requires_capability(__VA_ARGS__))
+
+/// Declares that the caller must NOT hold the given capability when calling
+/// the function (e.g. functions that acquire it themselves).
+#define CHIP_EXCLUDES(...) CHIP_THREAD_ANNOTATION_ATTRIBUTE(locks_excluded(__VA_ARGS__))
+
+/// Declares that a function returns a reference to the given capability.
+#define CHIP_RETURN_CAPABILITY(x) CHIP_THREAD_ANNOTATION_ATTRIBUTE(lock_returned(x))
+
+/// Turns off analysis for one function, e.g. trusted wrappers that delegate
+/// the actual acquire/release to an unannotated implementation.
+#define CHIP_NO_THREAD_SAFETY_ANALYSIS CHIP_THREAD_ANNOTATION_ATTRIBUTE(no_thread_safety_analysis)
@@ -36,6 +36,15 @@
 
 #include <atomic>
 
+#if CHIP_CONFIG_DEFERRED_LOGGING
+#include <lib/support/BoundedMPSCQueue.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
 namespace chip {
 namespace Logging {
 
@@ -113,6 +122,187 @@ void SetLogRedirectCallback(LogRedirectCallback_t callback)
     sLogRedirectCallback.store(callback);
 }
 
+namespace {
+
+// Emit one message to the redirect callback or the platform backend.  Shared
+// by the synchronous path in LogV() and the deferred logging drain thread.
+void EmitV(uint8_t module, uint8_t category, const char * msg, va_list args)
+{
+    char moduleName[chip::Logging::kMaxModuleNameLen + 1];
+    GetModuleName(moduleName, sizeof(moduleName), module);
+
+    LogRedirectCallback_t redirect = sLogRedirectCallback.load();
+
+    if (redirect != nullptr)
+    {
+        redirect(moduleName, category, msg, args);
+    }
+    else
+    {
+        Platform::LogV(moduleName, category, msg, args);
+    }
+}
+
+#if CHIP_CONFIG_DEFERRED_LOGGING
+
+void EmitFormatted(uint8_t module, uint8_t category, const char * msg, ...) ENFORCE_FORMAT(3, 4);
+void EmitFormatted(uint8_t module, uint8_t category, const char * msg, ...)
+{
+    va_list v;
+    va_start(v, msg);
+    EmitV(module, category, msg, v);
+    va_end(v);
+}
+
+struct DeferredLogEntry
+{
+    uint8_t module;
+    uint8_t category;
+    char message[CHIP_CONFIG_DEFERRED_LOGGING_MESSAGE_SIZE];
+};
+
+/**
+ * Captures formatted log messages into a lock-free ring on the calling thread
+ * and emits them from a dedicated drain thread, so the emission cost
+ * (timestamping, stream locking, write syscalls in the platform backend) stays
+ * off the caller.  Detail-category messages are shed once the ring is nearly
+ * full; error messages fall back to synchronous emission rather than being
+ * dropped when the ring is full.
+ */
+class DeferredLogger
+{
+public:
+    static constexpr uint32_t kQueueSize = CHIP_CONFIG_DEFERRED_LOGGING_QUEUE_SIZE;
+    // Depth above which detail-category messages are shed, leaving headroom
+    // for higher-severity messages while the drain thread catches up.
+    static constexpr uint32_t kShedWatermark = kQueueSize - (kQueueSize / 4);
+
+    void SetEnabled(bool enabled)
+    {
+        std::unique_lock<std::mutex> lock(mLock);
+        if (enabled == mEnabled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        if (enabled)
+        {
+            mShutdown = false;
+            mEnabled.store(true, std::memory_order_release);
+            mThread = std::thread(&DeferredLogger::ThreadMain, this);
+        }
+        else
+        {
+            mEnabled.store(false, std::memory_order_release);
+            mShutdown = true;
+            mWake.notify_one();
+            lock.unlock();
+            mThread.join();
+            // Emit whatever producers managed to enqueue before they observed
+            // the disable.
+            Drain();
+        }
+    }
+
+    // Returns true if the message was captured (or deliberately shed); false
+    // if the caller must emit it synchronously.
+    bool Capture(uint8_t module, uint8_t category, const char * msg, va_list args)
+    {
+        if (!mEnabled.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        if (category >= kLogCategory_Detail && mDepth.load(std::memory_order_relaxed) >= kShedWatermark)
+        {
+            mShedCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        DeferredLogEntry entry;
+        entry.module   = module;
+        entry.category = category;
+
+        va_list argsCopy;
+        va_copy(argsCopy, args);
+        vsnprintf(entry.message, sizeof(entry.message), msg, argsCopy);
+        va_end(argsCopy);
+
+        bool wasEmpty = false;
+        if (!mQueue.Enqueue(entry, wasEmpty))
+        {
+            if (category == kLogCategory_Error)
+            {
+                return false;
+            }
+            mShedCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        mDepth.fetch_add(1, std::memory_order_relaxed);
+        if (wasEmpty)
+        {
+            std::lock_guard<std::mutex> guard(mLock);
+            mWake.notify_one();
+        }
+        return true;
+    }
+
+private:
+    void ThreadMain()
+    {
+        std::unique_lock<std::mutex> lock(mLock);
+        while (!mShutdown)
+        {
+            // The timeout bounds how long a message enqueued during a missed
+            // wakeup can sit in the ring.
+            mWake.wait_for(lock, std::chrono::milliseconds(100));
+            lock.unlock();
+            Drain();
+            lock.lock();
+        }
+    }
+
+    void Drain()
+    {
+        DeferredLogEntry entry;
+        while (mQueue.Dequeue(entry))
+        {
+            mDepth.fetch_sub(1, std::memory_order_relaxed);
+            EmitFormatted(entry.module, entry.category, "%s", entry.message);
+        }
+
+        uint32_t shed = mShedCount.exchange(0, std::memory_order_relaxed);
+        if (shed != 0)
+        {
+            EmitFormatted(kLogModule_Support, kLogCategory_Progress, "Deferred logging shed %u messages under load",
+                          static_cast<unsigned>(shed));
+        }
+    }
+
+    BoundedMPSCQueue<DeferredLogEntry, kQueueSize> mQueue;
+    std::atomic<uint32_t> mDepth{ 0 };
+    std::atomic<uint32_t> mShedCount{ 0 };
+    std::atomic<bool> mEnabled{ false };
+    bool mShutdown = false; // guarded by mLock
+    std::mutex mLock;
+    std::condition_variable mWake;
+    std::thread mThread;
+};
+
+DeferredLogger gDeferredLogger;
+
+#endif // CHIP_CONFIG_DEFERRED_LOGGING
+
+} // namespace
+
+#if CHIP_CONFIG_DEFERRED_LOGGING
+void SetDeferredLogging(bool enabled)
+{
+    gDeferredLogger.SetEnabled(enabled);
+}
+#endif // CHIP_CONFIG_DEFERRED_LOGGING
+
 /**
  * Log, to the platform-specified mechanism, the specified log
  * message, @a msg, for the specified module, @a module, in the
@@ -182,19 +372,14 @@ void LogV(uint8_t module, uint8_t category, const char * msg, va_list args)
         return;
     }
 
-    char moduleName[chip::Logging::kMaxModuleNameLen + 1];
-    GetModuleName(moduleName, sizeof(moduleName), module);
-
-    LogRedirectCallback_t redirect = sLogRedirectCallback.load();
-
-    if (redirect != nullptr)
+#if CHIP_CONFIG_DEFERRED_LOGGING
+    if (gDeferredLogger.Capture(module, category, msg, args))
     {
-        redirect(moduleName, category, msg, args);
-    }
-    else
-    {
-        Platform::LogV(moduleName, category, msg, args);
+        return;
     }
+#endif
+
+    EmitV(module, category, msg, args);
 }
 
 #if CHIP_LOG_FILTERING
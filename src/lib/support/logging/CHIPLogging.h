@@ -79,6 +79,20 @@ using LogRedirectCallback_t = void (*)(const char * module, uint8_t category, co
 
 void SetLogRedirectCallback(LogRedirectCallback_t callback);
 
+#if CHIP_CONFIG_DEFERRED_LOGGING
+/**
+ * Enable or disable deferred log emission.
+ *
+ * While enabled, messages are formatted into a lock-free ring on the calling
+ * thread and emitted (platform backend or redirect callback) from a background
+ * thread.  Enabling starts the thread; disabling drains the ring, emits any
+ * remaining messages and joins the thread.  Error-category messages fall back
+ * to synchronous emission if the ring is full; detail-category messages are
+ * shed once the ring is nearly full.
+ */
+void SetDeferredLogging(bool enabled);
+#endif // CHIP_CONFIG_DEFERRED_LOGGING
+
 /**
  * gcc and clang provide a way to warn for a custom formatter when formats don't
  * match arguments.  Use that for Log() so we catch mistakes.  The "format"
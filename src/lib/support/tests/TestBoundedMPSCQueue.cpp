@@ -0,0 +1,93 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/BoundedMPSCQueue.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+
+namespace {
+
+void TestBasicOrder(nlTestSuite * inSuite, void * inContext)
+{
+    BoundedMPSCQueue<int, 8> queue;
+    bool wasEmpty;
+    int value;
+
+    NL_TEST_ASSERT(inSuite, queue.Count() == 0);
+    NL_TEST_ASSERT(inSuite, !queue.Dequeue(value));
+
+    NL_TEST_ASSERT(inSuite, queue.Enqueue(1, wasEmpty));
+    NL_TEST_ASSERT(inSuite, wasEmpty);
+    NL_TEST_ASSERT(inSuite, queue.Enqueue(2, wasEmpty));
+    NL_TEST_ASSERT(inSuite, !wasEmpty);
+    NL_TEST_ASSERT(inSuite, queue.Count() == 2);
+
+    NL_TEST_ASSERT(inSuite, queue.Dequeue(value) && value == 1);
+    NL_TEST_ASSERT(inSuite, queue.Dequeue(value) && value == 2);
+    NL_TEST_ASSERT(inSuite, !queue.Dequeue(value));
+    NL_TEST_ASSERT(inSuite, queue.Count() == 0);
+}
+
+void TestFullAndWrap(nlTestSuite * inSuite, void * inContext)
+{
+    BoundedMPSCQueue<int, 4> queue;
+    bool wasEmpty;
+    int value;
+
+    for (int i = 0; i < 4; i++)
+    {
+        NL_TEST_ASSERT(inSuite, queue.Enqueue(i, wasEmpty));
+    }
+    NL_TEST_ASSERT(inSuite, !queue.Enqueue(4, wasEmpty));
+    NL_TEST_ASSERT(inSuite, queue.Count() == 4);
+
+    // Drain and refill several times to exercise sequence-number wraparound of the slots.
+    for (int round = 0; round < 5; round++)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            NL_TEST_ASSERT(inSuite, queue.Dequeue(value));
+            NL_TEST_ASSERT(inSuite, value == i);
+        }
+        NL_TEST_ASSERT(inSuite, !queue.Dequeue(value));
+
+        for (int i = 0; i < 4; i++)
+        {
+            NL_TEST_ASSERT(inSuite, queue.Enqueue(i, wasEmpty));
+            NL_TEST_ASSERT(inSuite, wasEmpty == (i == 0));
+        }
+    }
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("Test basic FIFO order", TestBasicOrder),
+                          NL_TEST_DEF("Test full queue and wraparound", TestFullAndWrap), NL_TEST_SENTINEL() };
+
+} // namespace
+
+int TestBoundedMPSCQueue()
+{
+    nlTestSuite theSuite = { "CHIP BoundedMPSCQueue tests", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestBoundedMPSCQueue)
@@ -121,13 +121,45 @@ static void TestMemAlloc_UniquePtr(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, destructorCalled == 1);
 }
 
+static void TestMemAlloc_Tagged(nlTestSuite * inSuite, void * inContext)
+{
+    char * p = static_cast<char *>(MemoryAllocTagged(64, kMemoryTag_TLV));
+    NL_TEST_ASSERT(inSuite, p != nullptr);
+
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+    MemoryTagStatistics stats;
+    NL_TEST_ASSERT(inSuite, MemoryGetTagStatistics(kMemoryTag_TLV, stats) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, stats.mLiveBytes >= 64);
+    NL_TEST_ASSERT(inSuite, stats.mLiveBlockCount >= 1);
+    uint32_t liveBytesBeforeFree = stats.mLiveBytes;
+#endif
+
+    MemoryFreeTagged(p);
+
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+    NL_TEST_ASSERT(inSuite, MemoryGetTagStatistics(kMemoryTag_TLV, stats) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, stats.mLiveBytes == liveBytesBeforeFree - 64);
+    NL_TEST_ASSERT(inSuite, MemoryGetTagStatistics(kMemoryTag_Count, stats) == CHIP_ERROR_INVALID_ARGUMENT);
+#endif
+
+    // Tagged calloc zero-initializes like MemoryCalloc().
+    p = static_cast<char *>(MemoryCallocTagged(16, 4, kMemoryTag_General));
+    NL_TEST_ASSERT(inSuite, p != nullptr);
+
+    for (int i = 0; i < 64; i++)
+        NL_TEST_ASSERT(inSuite, p[i] == 0);
+
+    MemoryFreeTagged(p);
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
 static const nlTest sTests[] = { NL_TEST_DEF("Test MemAlloc::Malloc", TestMemAlloc_Malloc),
                                  NL_TEST_DEF("Test MemAlloc::Calloc", TestMemAlloc_Calloc),
                                  NL_TEST_DEF("Test MemAlloc::Realloc", TestMemAlloc_Realloc),
-                                 NL_TEST_DEF("Test MemAlloc::UniquePtr", TestMemAlloc_UniquePtr), NL_TEST_SENTINEL() };
+                                 NL_TEST_DEF("Test MemAlloc::UniquePtr", TestMemAlloc_UniquePtr),
+                                 NL_TEST_DEF("Test MemAlloc::Tagged", TestMemAlloc_Tagged), NL_TEST_SENTINEL() };
 
 /**
  *  Set up the test suite.
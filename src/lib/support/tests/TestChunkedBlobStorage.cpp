@@ -0,0 +1,194 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/ChunkedBlobStorage.h>
+
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+#include <string.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::TLV;
+
+/// Backend that exposes key presence and counts writes, so tests can verify
+/// which chunks actually reached storage.
+class CountingStorageDelegate : public TestPersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override
+    {
+        mWriteCount++;
+        return TestPersistentStorageDelegate::SyncSetKeyValue(key, value, size);
+    }
+
+    bool HasKey(const char * key) const { return mStorage.find(key) != mStorage.end(); }
+    size_t GetWriteCount() const { return mWriteCount; }
+    void ResetWriteCount() { mWriteCount = 0; }
+
+private:
+    size_t mWriteCount = 0;
+};
+
+// Writes an anonymous array of byteCount octet strings, each tagged element
+// holding its index, so blobs of arbitrary size can be produced and checked.
+CHIP_ERROR WriteTestBlob(ChunkedBlobStorage & blob, size_t elementCount, uint8_t seed)
+{
+    TLVWriter writer;
+    ReturnErrorOnFailure(blob.StartWrite(writer));
+
+    TLVType outerType;
+    ReturnErrorOnFailure(writer.StartContainer(AnonymousTag, kTLVType_Array, outerType));
+    for (size_t i = 0; i < elementCount; i++)
+    {
+        uint8_t element[16];
+        memset(element, static_cast<uint8_t>(seed + i), sizeof(element));
+        ReturnErrorOnFailure(writer.PutBytes(AnonymousTag, element, sizeof(element)));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(outerType));
+    return writer.Finalize();
+}
+
+CHIP_ERROR ReadTestBlob(ChunkedBlobStorage & blob, size_t expectedElementCount, uint8_t seed)
+{
+    TLVReader reader;
+    ReturnErrorOnFailure(blob.StartRead(reader));
+
+    ReturnErrorOnFailure(reader.Next(kTLVType_Array, AnonymousTag));
+    TLVType outerType;
+    ReturnErrorOnFailure(reader.EnterContainer(outerType));
+
+    for (size_t i = 0; i < expectedElementCount; i++)
+    {
+        ReturnErrorOnFailure(reader.Next(kTLVType_ByteString, AnonymousTag));
+
+        uint8_t element[16];
+        VerifyOrReturnError(reader.GetLength() == sizeof(element), CHIP_ERROR_INVALID_TLV_ELEMENT);
+        ReturnErrorOnFailure(reader.GetBytes(element, sizeof(element)));
+
+        uint8_t expected[16];
+        memset(expected, static_cast<uint8_t>(seed + i), sizeof(expected));
+        VerifyOrReturnError(memcmp(element, expected, sizeof(expected)) == 0, CHIP_ERROR_INVALID_TLV_ELEMENT);
+    }
+
+    VerifyOrReturnError(reader.Next() == CHIP_END_OF_TLV, CHIP_ERROR_INVALID_TLV_ELEMENT);
+    ReturnErrorOnFailure(reader.ExitContainer(outerType));
+    return CHIP_NO_ERROR;
+}
+
+void TestMultiChunkRoundTrip(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorageDelegate backend;
+    ChunkedBlobStorage blob;
+    NL_TEST_ASSERT(inSuite, blob.Init(&backend, "t/blob") == CHIP_NO_ERROR);
+
+    // 64 elements of 16 bytes plus TLV overhead spans several 256-byte chunks.
+    NL_TEST_ASSERT(inSuite, WriteTestBlob(blob, 64, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, backend.HasKey("t/blob"));
+    NL_TEST_ASSERT(inSuite, backend.HasKey("t/blob.c0"));
+    NL_TEST_ASSERT(inSuite, backend.HasKey("t/blob.c4"));
+
+    NL_TEST_ASSERT(inSuite, ReadTestBlob(blob, 64, 0) == CHIP_NO_ERROR);
+}
+
+void TestMissingBlob(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorageDelegate backend;
+    ChunkedBlobStorage blob;
+    NL_TEST_ASSERT(inSuite, blob.Init(&backend, "t/blob") == CHIP_NO_ERROR);
+
+    TLVReader reader;
+    NL_TEST_ASSERT(inSuite, blob.StartRead(reader) == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+}
+
+void TestRewriteShorterDropsStaleChunks(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorageDelegate backend;
+    ChunkedBlobStorage blob;
+    NL_TEST_ASSERT(inSuite, blob.Init(&backend, "t/blob") == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, WriteTestBlob(blob, 64, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, backend.HasKey("t/blob.c4"));
+
+    // A much shorter value must delete the chunks it no longer covers.
+    NL_TEST_ASSERT(inSuite, WriteTestBlob(blob, 4, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, backend.HasKey("t/blob.c0"));
+    NL_TEST_ASSERT(inSuite, !backend.HasKey("t/blob.c1"));
+    NL_TEST_ASSERT(inSuite, !backend.HasKey("t/blob.c4"));
+
+    NL_TEST_ASSERT(inSuite, ReadTestBlob(blob, 4, 0) == CHIP_NO_ERROR);
+}
+
+void TestUnchangedChunksNotRewritten(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorageDelegate backend;
+    ChunkedBlobStorage blob;
+    NL_TEST_ASSERT(inSuite, blob.Init(&backend, "t/blob") == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, WriteTestBlob(blob, 64, 0) == CHIP_NO_ERROR);
+
+    // An identical rewrite should only touch the header, not any chunk.
+    backend.ResetWriteCount();
+    NL_TEST_ASSERT(inSuite, WriteTestBlob(blob, 64, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, backend.GetWriteCount() == 1);
+
+    // Changing the element contents dirties every chunk again.
+    backend.ResetWriteCount();
+    NL_TEST_ASSERT(inSuite, WriteTestBlob(blob, 64, 100) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, backend.GetWriteCount() > 1);
+
+    NL_TEST_ASSERT(inSuite, ReadTestBlob(blob, 64, 100) == CHIP_NO_ERROR);
+}
+
+void TestDelete(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorageDelegate backend;
+    ChunkedBlobStorage blob;
+    NL_TEST_ASSERT(inSuite, blob.Init(&backend, "t/blob") == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, WriteTestBlob(blob, 64, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, blob.Delete() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !backend.HasKey("t/blob"));
+    NL_TEST_ASSERT(inSuite, !backend.HasKey("t/blob.c0"));
+
+    TLVReader reader;
+    NL_TEST_ASSERT(inSuite, blob.StartRead(reader) == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestMultiChunkRoundTrip", TestMultiChunkRoundTrip),                           //
+    NL_TEST_DEF("TestMissingBlob", TestMissingBlob),                                           //
+    NL_TEST_DEF("TestRewriteShorterDropsStaleChunks", TestRewriteShorterDropsStaleChunks),     //
+    NL_TEST_DEF("TestUnchangedChunksNotRewritten", TestUnchangedChunksNotRewritten),           //
+    NL_TEST_DEF("TestDelete", TestDelete),                                                     //
+    NL_TEST_SENTINEL()                                                                         //
+};
+
+} // namespace
+
+int TestChunkedBlobStorage(void)
+{
+    nlTestSuite theSuite = { "ChunkedBlobStorage", sTests, nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestChunkedBlobStorage)
@@ -0,0 +1,119 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/DefaultStorageKeyAllocator.h>
+
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+#include <string.h>
+
+namespace {
+
+using namespace chip;
+
+void TestPrefixedKeysMatchPlainKeys(nlTestSuite * inSuite, void * inContext)
+{
+    DefaultStorageKeyAllocator plain;
+    DefaultStorageKeyAllocator prefixed;
+    char expected[64];
+
+    for (FabricIndex fabric : { static_cast<FabricIndex>(1), static_cast<FabricIndex>(0xab) })
+    {
+        FabricStorageKeyPrefix prefix(fabric);
+        NL_TEST_ASSERT(inSuite, prefix.IsValid());
+        NL_TEST_ASSERT(inSuite, prefix.GetFabricIndex() == fabric);
+
+        strcpy(expected, plain.FabricTable(fabric));
+        NL_TEST_ASSERT(inSuite, strcmp(prefixed.FabricTable(prefix), expected) == 0);
+
+        strcpy(expected, plain.FabricGroups(fabric));
+        NL_TEST_ASSERT(inSuite, strcmp(prefixed.FabricGroups(prefix), expected) == 0);
+
+        strcpy(expected, plain.FabricGroup(fabric, 0x1234));
+        NL_TEST_ASSERT(inSuite, strcmp(prefixed.FabricGroup(prefix, 0x1234), expected) == 0);
+
+        strcpy(expected, plain.FabricGroupKey(fabric, 7));
+        NL_TEST_ASSERT(inSuite, strcmp(prefixed.FabricGroupKey(prefix, 7), expected) == 0);
+
+        strcpy(expected, plain.FabricGroupEndpoint(fabric, 0x1234, 5));
+        NL_TEST_ASSERT(inSuite, strcmp(prefixed.FabricGroupEndpoint(prefix, 0x1234, 5), expected) == 0);
+
+        strcpy(expected, plain.FabricKeyset(fabric, 9));
+        NL_TEST_ASSERT(inSuite, strcmp(prefixed.FabricKeyset(prefix, 9), expected) == 0);
+    }
+}
+
+void TestPrefixSync(nlTestSuite * inSuite, void * inContext)
+{
+    FabricStorageKeyPrefix prefix;
+    NL_TEST_ASSERT(inSuite, !prefix.IsValid());
+
+    prefix.Sync(3);
+    NL_TEST_ASSERT(inSuite, prefix.IsValid());
+    NL_TEST_ASSERT(inSuite, strcmp(prefix.Prefix(), "f/3/") == 0);
+
+    // Syncing to the same fabric keeps the formatted prefix; a new fabric re-formats it.
+    prefix.Sync(3);
+    NL_TEST_ASSERT(inSuite, strcmp(prefix.Prefix(), "f/3/") == 0);
+    prefix.Sync(0x2a);
+    NL_TEST_ASSERT(inSuite, strcmp(prefix.Prefix(), "f/2a/") == 0);
+}
+
+void TestFabricScopedStorageView(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistentStorageDelegate storage;
+    FabricScopedStorageView view(storage, 5);
+    DefaultStorageKeyAllocator key;
+
+    const uint8_t value[] = { 1, 2, 3 };
+    NL_TEST_ASSERT(inSuite, view.SyncSetKeyValue("g", value, sizeof(value)) == CHIP_NO_ERROR);
+
+    // The view stores under the full fabric-scoped key.
+    uint8_t buffer[8];
+    uint16_t size = sizeof(buffer);
+    NL_TEST_ASSERT(inSuite, storage.SyncGetKeyValue(key.FabricGroups(5), buffer, size) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, size == sizeof(value) && memcmp(buffer, value, size) == 0);
+
+    size = sizeof(buffer);
+    NL_TEST_ASSERT(inSuite, view.SyncGetKeyValue("g", buffer, size) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, size == sizeof(value) && memcmp(buffer, value, size) == 0);
+
+    NL_TEST_ASSERT(inSuite, view.SyncDeleteKeyValue("g") == CHIP_NO_ERROR);
+    size = sizeof(buffer);
+    NL_TEST_ASSERT(inSuite, storage.SyncGetKeyValue(key.FabricGroups(5), buffer, size) != CHIP_NO_ERROR);
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestPrefixedKeysMatchPlainKeys", TestPrefixedKeysMatchPlainKeys), //
+    NL_TEST_DEF("TestPrefixSync", TestPrefixSync),                                 //
+    NL_TEST_DEF("TestFabricScopedStorageView", TestFabricScopedStorageView),       //
+    NL_TEST_SENTINEL()                                                             //
+};
+
+} // namespace
+
+int TestDefaultStorageKeyAllocator(void)
+{
+    nlTestSuite theSuite = { "DefaultStorageKeyAllocator", sTests, nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestDefaultStorageKeyAllocator)
@@ -0,0 +1,209 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/JournalingStorageDelegate.h>
+
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+#include <string.h>
+
+namespace {
+
+using namespace chip;
+
+/// Backend that exposes key presence and counts writes, so tests can verify
+/// what actually reached storage (as opposed to the journal's RAM shadow).
+class CountingStorageDelegate : public TestPersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override
+    {
+        mWriteCount++;
+        return TestPersistentStorageDelegate::SyncSetKeyValue(key, value, size);
+    }
+
+    bool HasKey(const char * key) const { return mStorage.find(key) != mStorage.end(); }
+    size_t GetWriteCount() const { return mWriteCount; }
+
+private:
+    size_t mWriteCount = 0;
+};
+
+void TestReadYourWrites(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorageDelegate backend;
+    JournalingStorageDelegate journal;
+    NL_TEST_ASSERT(inSuite, journal.Init(&backend) == CHIP_NO_ERROR);
+
+    const uint8_t value1[] = { 1, 2, 3 };
+    const uint8_t value2[] = { 4, 5, 6, 7 };
+    NL_TEST_ASSERT(inSuite, journal.SyncSetKeyValue("a/1", value1, sizeof(value1)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, journal.SyncSetKeyValue("a/1", value2, sizeof(value2)) == CHIP_NO_ERROR);
+
+    // Rewrites of one key collapse into a single pending entry; the real key
+    // has not been written yet.
+    NL_TEST_ASSERT(inSuite, journal.GetPendingEntryCount() == 1);
+    NL_TEST_ASSERT(inSuite, !backend.HasKey("a/1"));
+
+    uint8_t buffer[8];
+    uint16_t size = sizeof(buffer);
+    NL_TEST_ASSERT(inSuite, journal.SyncGetKeyValue("a/1", buffer, size) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, size == sizeof(value2));
+    NL_TEST_ASSERT(inSuite, memcmp(buffer, value2, size) == 0);
+
+    // Pending deletes shadow the backend too.
+    NL_TEST_ASSERT(inSuite, journal.SyncDeleteKeyValue("a/1") == CHIP_NO_ERROR);
+    size = sizeof(buffer);
+    NL_TEST_ASSERT(inSuite, journal.SyncGetKeyValue("a/1", buffer, size) == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+}
+
+void TestFlushAppliesToBackend(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorageDelegate backend;
+    JournalingStorageDelegate journal;
+    NL_TEST_ASSERT(inSuite, journal.Init(&backend) == CHIP_NO_ERROR);
+
+    const uint8_t value[] = { 0xAA, 0xBB };
+    NL_TEST_ASSERT(inSuite, journal.SyncSetKeyValue("a/1", value, sizeof(value)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, journal.SyncSetKeyValue("a/2", value, sizeof(value)) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, journal.Flush() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, journal.GetPendingEntryCount() == 0);
+    NL_TEST_ASSERT(inSuite, backend.HasKey("a/1"));
+    NL_TEST_ASSERT(inSuite, backend.HasKey("a/2"));
+
+    // The journal record is removed once entries land on their real keys.
+    DefaultStorageKeyAllocator keys;
+    NL_TEST_ASSERT(inSuite, !backend.HasKey(keys.StorageJournal()));
+}
+
+void TestCrashReplay(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorageDelegate backend;
+
+    {
+        // First "boot": buffer writes but never flush, simulating a crash.
+        JournalingStorageDelegate journal;
+        NL_TEST_ASSERT(inSuite, journal.Init(&backend) == CHIP_NO_ERROR);
+
+        const uint8_t value[] = { 0x11, 0x22, 0x33 };
+        NL_TEST_ASSERT(inSuite, journal.SyncSetKeyValue("a/1", value, sizeof(value)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, journal.SyncDeleteKeyValue("a/2") == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, !backend.HasKey("a/1"));
+    }
+
+    // Second "boot" over the same backend replays the journal.
+    JournalingStorageDelegate journal;
+    NL_TEST_ASSERT(inSuite, journal.Init(&backend) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, journal.GetPendingEntryCount() == 0);
+    NL_TEST_ASSERT(inSuite, backend.HasKey("a/1"));
+
+    uint8_t buffer[8];
+    uint16_t size = sizeof(buffer);
+    NL_TEST_ASSERT(inSuite, backend.SyncGetKeyValue("a/1", buffer, size) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, size == 3);
+
+    DefaultStorageKeyAllocator keys;
+    NL_TEST_ASSERT(inSuite, !backend.HasKey(keys.StorageJournal()));
+}
+
+void TestTransactionFlushesOnOutermostCommit(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorageDelegate backend;
+    JournalingStorageDelegate journal;
+    NL_TEST_ASSERT(inSuite, journal.Init(&backend) == CHIP_NO_ERROR);
+
+    const uint8_t value[] = { 0x42 };
+    NL_TEST_ASSERT(inSuite, journal.SyncBeginTransaction() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, journal.SyncBeginTransaction() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, journal.SyncSetKeyValue("a/1", value, sizeof(value)) == CHIP_NO_ERROR);
+
+    // Inner commit does not flush.
+    NL_TEST_ASSERT(inSuite, journal.SyncCommitTransaction() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !backend.HasKey("a/1"));
+
+    NL_TEST_ASSERT(inSuite, journal.SyncCommitTransaction() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, backend.HasKey("a/1"));
+    NL_TEST_ASSERT(inSuite, journal.GetPendingEntryCount() == 0);
+
+    // Unbalanced commit is rejected.
+    NL_TEST_ASSERT(inSuite, journal.SyncCommitTransaction() == CHIP_ERROR_INCORRECT_STATE);
+}
+
+void TestOversizeValueWritesThrough(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorageDelegate backend;
+    JournalingStorageDelegate journal;
+    NL_TEST_ASSERT(inSuite, journal.Init(&backend) == CHIP_NO_ERROR);
+
+    const uint8_t small[] = { 1 };
+    uint8_t large[JournalingStorageDelegate::kMaxValueSize + 1];
+    memset(large, 0x5A, sizeof(large));
+
+    NL_TEST_ASSERT(inSuite, journal.SyncSetKeyValue("a/1", small, sizeof(small)) == CHIP_NO_ERROR);
+
+    // The oversize write flushes pending entries first so ordering holds,
+    // then goes straight to the backend.
+    NL_TEST_ASSERT(inSuite, journal.SyncSetKeyValue("a/big", large, sizeof(large)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, journal.GetPendingEntryCount() == 0);
+    NL_TEST_ASSERT(inSuite, backend.HasKey("a/1"));
+    NL_TEST_ASSERT(inSuite, backend.HasKey("a/big"));
+}
+
+void TestJournalFillTriggersFlush(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorageDelegate backend;
+    JournalingStorageDelegate journal;
+    NL_TEST_ASSERT(inSuite, journal.Init(&backend) == CHIP_NO_ERROR);
+
+    char key[8];
+    const uint8_t value[] = { 7 };
+    for (size_t i = 0; i < JournalingStorageDelegate::kMaxPendingEntries + 1; i++)
+    {
+        snprintf(key, sizeof(key), "a/%u", static_cast<unsigned>(i));
+        NL_TEST_ASSERT(inSuite, journal.SyncSetKeyValue(key, value, sizeof(value)) == CHIP_NO_ERROR);
+    }
+
+    // The overflowing write flushed the full journal; only it remains pending.
+    NL_TEST_ASSERT(inSuite, journal.GetPendingEntryCount() == 1);
+    NL_TEST_ASSERT(inSuite, backend.HasKey("a/0"));
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestReadYourWrites", TestReadYourWrites),                                         //
+    NL_TEST_DEF("TestFlushAppliesToBackend", TestFlushAppliesToBackend),                           //
+    NL_TEST_DEF("TestCrashReplay", TestCrashReplay),                                               //
+    NL_TEST_DEF("TestTransactionFlushesOnOutermostCommit", TestTransactionFlushesOnOutermostCommit), //
+    NL_TEST_DEF("TestOversizeValueWritesThrough", TestOversizeValueWritesThrough),                 //
+    NL_TEST_DEF("TestJournalFillTriggersFlush", TestJournalFillTriggersFlush),                     //
+    NL_TEST_SENTINEL()                                                                            //
+};
+
+} // namespace
+
+int TestJournalingStorageDelegate(void)
+{
+    nlTestSuite theSuite = { "JournalingStorageDelegate", sTests, nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestJournalingStorageDelegate)
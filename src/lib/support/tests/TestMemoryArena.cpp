@@ -0,0 +1,71 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/MemoryArena.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+
+namespace {
+
+void TestAlignedAllocation(nlTestSuite * inSuite, void * inContext)
+{
+    MemoryArena<64> arena;
+
+    uint8_t * byte = static_cast<uint8_t *>(arena.Allocate(1, 1));
+    NL_TEST_ASSERT(inSuite, byte != nullptr);
+    NL_TEST_ASSERT(inSuite, arena.Used() == 1);
+
+    // The next allocation must be aligned even though the arena cursor is not.
+    uint32_t * word = arena.New<uint32_t>(0xDEADBEEF);
+    NL_TEST_ASSERT(inSuite, word != nullptr);
+    NL_TEST_ASSERT(inSuite, reinterpret_cast<uintptr_t>(word) % alignof(uint32_t) == 0);
+    NL_TEST_ASSERT(inSuite, *word == 0xDEADBEEF);
+    NL_TEST_ASSERT(inSuite, arena.Used() == alignof(uint32_t) + sizeof(uint32_t));
+}
+
+void TestExhaustionAndReset(nlTestSuite * inSuite, void * inContext)
+{
+    MemoryArena<16> arena;
+
+    NL_TEST_ASSERT(inSuite, arena.Allocate(16, 1) != nullptr);
+    NL_TEST_ASSERT(inSuite, arena.Allocate(1, 1) == nullptr);
+    NL_TEST_ASSERT(inSuite, arena.HighWatermark() == 16);
+
+    arena.Reset();
+    NL_TEST_ASSERT(inSuite, arena.Used() == 0);
+    NL_TEST_ASSERT(inSuite, arena.Allocate(16, 1) != nullptr);
+    NL_TEST_ASSERT(inSuite, arena.HighWatermark() == 16);
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("Test aligned allocation", TestAlignedAllocation),
+                          NL_TEST_DEF("Test exhaustion and reset", TestExhaustionAndReset), NL_TEST_SENTINEL() };
+
+} // namespace
+
+int TestMemoryArena()
+{
+    nlTestSuite theSuite = { "CHIP MemoryArena tests", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestMemoryArena)
@@ -165,6 +165,39 @@ static void CheckWriteNextCounterStart(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, value == 0x20000);
 }
 
+static void CheckReservation(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistedCounterContext * context = static_cast<TestPersistedCounterContext *>(inContext);
+    CHIP_ERROR err                        = CHIP_NO_ERROR;
+    chip::PersistedCounter counter, counter2;
+    const char * testKey = "testcounter";
+
+    InitializePersistedStorage(context);
+
+    err = counter.Init(testKey, 0x10000);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // A fresh counter has the whole reservation ahead of it.
+    NL_TEST_ASSERT(inSuite, !counter.NeedsReservation());
+    NL_TEST_ASSERT(inSuite, counter.ReserveIfNeeded() == CHIP_NO_ERROR);
+
+    // Consume past the half-way watermark; a top-up should then be wanted.
+    for (int32_t i = 0; i < 0x8000; i++)
+    {
+        err = counter.Advance();
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, counter.NeedsReservation());
+    NL_TEST_ASSERT(inSuite, counter.ReserveIfNeeded() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !counter.NeedsReservation());
+
+    // A "reboot" after a top-up must jump past everything the extended
+    // reservation could have vended.
+    err = counter2.Init(testKey, 0x10000);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counter2.GetValue() == 0x20000);
+}
+
 // Test Suite
 
 /**
@@ -174,6 +207,7 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Out of box Test", CheckOOB),                                 //
     NL_TEST_DEF("Reboot Test", CheckReboot),                                  //
     NL_TEST_DEF("Write Next Counter Start Test", CheckWriteNextCounterStart), //
+    NL_TEST_DEF("Reservation Test", CheckReservation),                        //
     NL_TEST_SENTINEL()                                                        //
 };
 
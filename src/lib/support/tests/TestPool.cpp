@@ -407,6 +407,72 @@ void TestPoolInterfaceDynamic(nlTestSuite * inSuite, void * inContext)
 }
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
+void TestLockFreeCreateRelease(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr const size_t kSize = 100;
+    LockFreeObjectPool<uint32_t, kSize> pool;
+    uint32_t * obj[kSize];
+
+    NL_TEST_ASSERT(inSuite, pool.Allocated() == 0);
+    NL_TEST_ASSERT(inSuite, pool.Capacity() == kSize);
+
+    pool.ReleaseObject(nullptr);
+    NL_TEST_ASSERT(inSuite, pool.Allocated() == 0);
+
+    for (size_t i = 0; i < kSize; ++i)
+    {
+        obj[i] = pool.CreateObject();
+        NL_TEST_ASSERT(inSuite, obj[i] != nullptr);
+        NL_TEST_ASSERT(inSuite, pool.Allocated() == i + 1);
+    }
+
+    uint32_t * fail = pool.CreateObject();
+    NL_TEST_ASSERT(inSuite, fail == nullptr);
+    NL_TEST_ASSERT(inSuite, pool.Exhausted());
+
+    // The freelist is a stack, so the most recently released slot is reused first.
+    pool.ReleaseObject(obj[55]);
+    NL_TEST_ASSERT(inSuite, !pool.Exhausted());
+    NL_TEST_ASSERT(inSuite, obj[55] == pool.CreateObject());
+    NL_TEST_ASSERT(inSuite, pool.Exhausted());
+
+    for (size_t i = 0; i < kSize; ++i)
+    {
+        pool.ReleaseObject(obj[i]);
+        NL_TEST_ASSERT(inSuite, pool.Allocated() == kSize - i - 1);
+    }
+
+    NL_TEST_ASSERT(inSuite, pool.HighWaterMark() == kSize);
+}
+
+void TestLockFreeCreateReleaseStruct(nlTestSuite * inSuite, void * inContext)
+{
+    struct S
+    {
+        S(std::set<S *> & set) : mSet(set) { mSet.insert(this); }
+        ~S() { mSet.erase(this); }
+        std::set<S *> & mSet;
+    };
+    std::set<S *> objs;
+
+    constexpr const size_t kSize = 10;
+    LockFreeObjectPool<S, kSize> pool;
+    S * obj[kSize];
+
+    for (size_t i = 0; i < kSize; ++i)
+    {
+        obj[i] = pool.CreateObject(objs);
+        NL_TEST_ASSERT(inSuite, obj[i] != nullptr);
+        NL_TEST_ASSERT(inSuite, objs.size() == i + 1);
+    }
+
+    for (size_t i = 0; i < kSize; ++i)
+    {
+        pool.ReleaseObject(obj[i]);
+        NL_TEST_ASSERT(inSuite, objs.size() == kSize - i - 1);
+    }
+}
+
 int Setup(void * inContext)
 {
     return ::chip::Platform::MemoryInit() == CHIP_NO_ERROR ? SUCCESS : FAILURE;
@@ -431,6 +497,8 @@ static const nlTest sTests[] = {
     NL_TEST_DEF_FN(TestCreateReleaseStructStatic),
     NL_TEST_DEF_FN(TestForEachActiveObjectStatic),
     NL_TEST_DEF_FN(TestPoolInterfaceStatic),
+    NL_TEST_DEF_FN(TestLockFreeCreateRelease),
+    NL_TEST_DEF_FN(TestLockFreeCreateReleaseStruct),
 #if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
     NL_TEST_DEF_FN(TestReleaseNullDynamic),
     NL_TEST_DEF_FN(TestCreateReleaseObjectDynamic),
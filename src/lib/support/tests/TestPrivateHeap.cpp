@@ -39,6 +39,7 @@ public:
     void * HeapAlloc(size_t size) { return PrivateHeapAlloc(mHeap.buffer, size); }
     void HeapFree(void * buffer) { PrivateHeapFree(buffer); }
     void * HeapRealloc(void * buffer, size_t size) { return PrivateHeapRealloc(mHeap.buffer, buffer, size); }
+    void HeapStatistics(PrivateHeapStatistics & stats) { PrivateHeapGetStatistics(mHeap.buffer, &stats); }
 
 private:
     struct alignas(kPrivateHeapAllocationAlignment)
@@ -338,6 +339,45 @@ void Realloc(nlTestSuite * inSuite, void * inContext)
     allocator.HeapFree(p3);
 }
 
+void Statistics(nlTestSuite * inSuite, void * inContext)
+{
+    PrivateHeapAllocator<7 * kBlockHeaderSize> allocator;
+    PrivateHeapStatistics stats;
+
+    allocator.HeapStatistics(stats);
+    NL_TEST_ASSERT(inSuite, stats.freeBytes == 5 * kBlockHeaderSize);
+    NL_TEST_ASSERT(inSuite, stats.usedBytes == 0);
+    NL_TEST_ASSERT(inSuite, stats.largestFreeBlockBytes == 5 * kBlockHeaderSize);
+    NL_TEST_ASSERT(inSuite, stats.freeBlockCount == 1);
+    NL_TEST_ASSERT(inSuite, stats.usedBlockCount == 0);
+
+    void * p1 = allocator.HeapAlloc(kBlockHeaderSize);
+    void * p2 = allocator.HeapAlloc(kBlockHeaderSize);
+    NL_TEST_ASSERT(inSuite, nullptr != p1);
+    NL_TEST_ASSERT(inSuite, nullptr != p2);
+
+    allocator.HeapStatistics(stats);
+    NL_TEST_ASSERT(inSuite, stats.usedBytes == 2 * kBlockHeaderSize);
+    NL_TEST_ASSERT(inSuite, stats.usedBlockCount == 2);
+    NL_TEST_ASSERT(inSuite, stats.freeBytes == kBlockHeaderSize);
+    NL_TEST_ASSERT(inSuite, stats.freeBlockCount == 1);
+
+    // Freeing p1 leaves the free space split in two by the still-allocated p2.
+    allocator.HeapFree(p1);
+    allocator.HeapStatistics(stats);
+    NL_TEST_ASSERT(inSuite, stats.freeBytes == 2 * kBlockHeaderSize);
+    NL_TEST_ASSERT(inSuite, stats.freeBlockCount == 2);
+    NL_TEST_ASSERT(inSuite, stats.largestFreeBlockBytes == kBlockHeaderSize);
+
+    // Freeing p2 merges everything back into one block.
+    allocator.HeapFree(p2);
+    allocator.HeapStatistics(stats);
+    NL_TEST_ASSERT(inSuite, stats.freeBytes == 5 * kBlockHeaderSize);
+    NL_TEST_ASSERT(inSuite, stats.freeBlockCount == 1);
+    NL_TEST_ASSERT(inSuite, stats.largestFreeBlockBytes == 5 * kBlockHeaderSize);
+    NL_TEST_ASSERT(inSuite, stats.usedBlockCount == 0);
+}
+
 const nlTest sTests[] = {
     NL_TEST_DEF("SingleHeapAllocAndFree", SingleHeapAllocAndFree),     //
     NL_TEST_DEF("SplitHeapAllocAndFree", SplitHeapAllocAndFree),       //
@@ -348,6 +388,7 @@ const nlTest sTests[] = {
     NL_TEST_DEF("ForwardFreeAndRealloc", ForwardFreeAndRealloc),       //
     NL_TEST_DEF("BackwardFreeAndRealloc", BackwardFreeAndRealloc),     //
     NL_TEST_DEF("Realloc", Realloc),                                   //
+    NL_TEST_DEF("Statistics", Statistics),                             //
     NL_TEST_SENTINEL()                                                 //
 };
 
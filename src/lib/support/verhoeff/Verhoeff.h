@@ -58,6 +58,13 @@ public:
     static bool ValidateCheckChar(const char * str);
     static bool ValidateCheckChar(const char * str, size_t strLen);
 
+    // Verify the trailing check character of each of numStrings strings in one
+    // pass, keeping the lookup tables hot across the batch.  strLens may be
+    // null, in which case each string is measured with strlen(); results may be
+    // null if only the count of valid strings is wanted.  Returns the number of
+    // strings whose check character validated.
+    static size_t ValidateCheckChars(const char * const * strings, const size_t * strLens, size_t numStrings, bool * results);
+
     // Convert between a character and its corresponding value.
     static int CharToVal(char ch);
     static char ValToChar(int val);
@@ -68,6 +75,7 @@ private:
 
     static const uint8_t sMultiplyTable[];
     static const uint8_t sPermTable[];
+    static const uint8_t sPermPowerTable[8][10];
 };
 
 // Verhoeff16 -- Implements Verhoeff's check-digit algorithm for base-16 (hex) strings.
@@ -40,6 +40,16 @@ const uint8_t Verhoeff10::sMultiplyTable[] = {
 
 const uint8_t Verhoeff10::sPermTable[] = { 1, 5, 7, 6, 2, 8, 3, 0, 9, 4 };
 
+// sPermTable applied k times (row k holds p^k).  The permutation has order 8,
+// so the position-dependent permutation of digit d at 1-based position i is
+// sPermPowerTable[i % 8][d], replacing the per-character iteration of
+// Verhoeff::Permute() with a single table lookup.
+const uint8_t Verhoeff10::sPermPowerTable[8][10] = {
+    { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }, { 1, 5, 7, 6, 2, 8, 3, 0, 9, 4 }, { 5, 8, 0, 3, 7, 9, 6, 1, 4, 2 },
+    { 8, 9, 1, 6, 0, 4, 3, 5, 2, 7 }, { 9, 4, 5, 3, 1, 2, 6, 8, 7, 0 }, { 4, 2, 8, 6, 5, 7, 3, 9, 0, 1 },
+    { 2, 7, 9, 3, 8, 0, 6, 4, 1, 5 }, { 7, 0, 4, 6, 9, 1, 3, 2, 5, 8 },
+};
+
 char Verhoeff10::ComputeCheckChar(const char * str)
 {
     return ComputeCheckChar(str, strlen(str));
@@ -57,7 +67,7 @@ char Verhoeff10::ComputeCheckChar(const char * str, size_t strLen)
         if (val < 0)
             return 0; // invalid character
 
-        int p = Verhoeff::Permute(val, sPermTable, Base, i);
+        int p = sPermPowerTable[i % 8][val];
 
 #ifdef VERHOEFF10_NO_MULTIPLY_TABLE
         c = Verhoeff::DihedralMultiply(c, p, PolygonSize);
@@ -93,6 +103,22 @@ bool Verhoeff10::ValidateCheckChar(const char * str, size_t strLen)
     return ValidateCheckChar(str[strLen - 1], str, strLen - 1);
 }
 
+size_t Verhoeff10::ValidateCheckChars(const char * const * strings, const size_t * strLens, size_t numStrings, bool * results)
+{
+    size_t numValid = 0;
+
+    for (size_t i = 0; i < numStrings; i++)
+    {
+        bool valid = ValidateCheckChar(strings[i], (strLens != nullptr) ? strLens[i] : strlen(strings[i]));
+        if (results != nullptr)
+            results[i] = valid;
+        if (valid)
+            numValid++;
+    }
+
+    return numValid;
+}
+
 int Verhoeff10::CharToVal(char ch)
 {
     if (ch >= '0' && ch <= '9')
@@ -42,6 +42,7 @@
 #include <messaging/ExchangeMgr.h>
 #include <protocols/Protocols.h>
 #include <protocols/secure_channel/Constants.h>
+#include <protocols/secure_channel/StatusReport.h>
 
 #if CONFIG_DEVICE_LAYER
 #include <platform/CHIPDeviceLayer.h>
@@ -256,6 +257,9 @@ ExchangeContext::ExchangeContext(ExchangeManager * em, uint16_t ExchangeId, cons
     mExchangeMgr = em;
     mExchangeId  = ExchangeId;
     mSession.Grab(session);
+    // Register with the underlying secure session (if any), so that its release
+    // notifies this exchange directly rather than via a pool-wide walk.
+    em->GetSessionManager()->AddSessionHolder(session, *this);
     mFlags.Set(Flags::kFlagInitiator, Initiator);
     mDelegate = delegate;
 
@@ -282,6 +286,8 @@ ExchangeContext::ExchangeContext(ExchangeManager * em, uint16_t ExchangeId, cons
     // Do not request Ack for multicast
     SetAutoRequestAck(!session.IsGroupSession());
 
+    em->RegisterContextForDispatch(this);
+
 #if defined(CHIP_EXCHANGE_CONTEXT_DETAIL_LOGGING)
     ChipLogDetail(ExchangeManager, "ec++ id: " ChipLogFormatExchange, ChipLogValueExchange(this));
 #endif
@@ -293,11 +299,20 @@ ExchangeContext::~ExchangeContext()
     VerifyOrDie(mExchangeMgr != nullptr && GetReferenceCount() == 0);
     VerifyOrDie(!IsAckPending());
 
+    // If the session outlives the exchange, drop our registration with it.  When
+    // the session went away first, OnSessionReleased already released mSession
+    // and unregistered us.
+    if (mSession)
+    {
+        mExchangeMgr->GetSessionManager()->RemoveSessionHolder(mSession.Get(), *this);
+    }
+
     // Ideally, in this scenario, the retransmit table should
     // be clear of any outstanding messages for this context and
     // the boolean parameter passed to DoClose() should not matter.
 
     DoClose(false);
+    mExchangeMgr->UnregisterContextForDispatch(this);
     mExchangeMgr = nullptr;
 
     if (mDispatch != nullptr)
@@ -312,6 +327,57 @@ ExchangeContext::~ExchangeContext()
     SYSTEM_STATS_DECREMENT(chip::System::Stats::kExchangeMgr_NumContexts);
 }
 
+void ExchangeContext::Park()
+{
+    // Mirrors the destructor, except that the session registration, message
+    // dispatch and exchange manager stay warm for the next interaction.
+    DoClose(false);
+    mExchangeMgr->UnregisterContextForDispatch(this);
+    mFlags.Set(Flags::kFlagParked);
+
+#if defined(CHIP_EXCHANGE_CONTEXT_DETAIL_LOGGING)
+    ChipLogDetail(ExchangeManager, "ec park id: " ChipLogFormatExchange, ChipLogValueExchange(this));
+#endif
+}
+
+void ExchangeContext::Rearm(uint16_t exchangeId, bool initiator, ExchangeDelegate * delegate)
+{
+    mExchangeId      = exchangeId;
+    mDelegate        = delegate;
+    mResponseTimeout = System::Clock::kZero;
+
+    mFlags.ClearAll();
+    mFlags.Set(Flags::kFlagInitiator, initiator);
+    // Parked contexts are never group exchanges, so always request acks.
+    SetAutoRequestAck(true);
+
+    // The new delegate may want a different dispatch than the parked one.
+    ExchangeMessageDispatch * dispatch = nullptr;
+    if (delegate != nullptr)
+    {
+        dispatch = delegate->GetMessageDispatch(mExchangeMgr->GetReliableMessageMgr(), mExchangeMgr->GetSessionManager());
+    }
+    if (dispatch == nullptr)
+    {
+        dispatch = &mExchangeMgr->mDefaultExchangeDispatch;
+    }
+    if (dispatch != mDispatch)
+    {
+        mDispatch->Release();
+        mDispatch = dispatch->Retain();
+    }
+
+    mExchangeMgr->RegisterContextForDispatch(this);
+
+    // Parked contexts sit at a reference count of zero; hand the consumer the
+    // same single reference a freshly-constructed context carries.
+    Retain();
+
+#if defined(CHIP_EXCHANGE_CONTEXT_DETAIL_LOGGING)
+    ChipLogDetail(ExchangeManager, "ec rearm id: " ChipLogFormatExchange, ChipLogValueExchange(this));
+#endif
+}
+
 bool ExchangeContext::MatchExchange(const SessionHandle & session, const PacketHeader & packetHeader,
                                     const PayloadHeader & payloadHeader)
 {
@@ -337,6 +403,21 @@ bool ExchangeContext::MatchExchange(const SessionHandle & session, const PacketH
 
 void ExchangeContext::OnConnectionExpired()
 {
+    // A parked context has no consumer left; with its session gone there is
+    // nothing to recycle, so hand the slot straight back to the pool.
+    if (mFlags.Has(Flags::kFlagParked))
+    {
+        if (mSession)
+        {
+            // No-op when the expiry notification already popped us from the
+            // session's holder list.
+            mExchangeMgr->GetSessionManager()->RemoveSessionHolder(mSession.Get(), *this);
+            mSession.Release();
+        }
+        mExchangeMgr->FreeParkedContext(this);
+        return;
+    }
+
     // Reset our mSession to a default-initialized (hence not matching any
     // connection state) value, because it's still referencing the now-expired
     // connection.  This will mean that no more messages can be sent via this
@@ -405,6 +486,35 @@ void ExchangeContext::NotifyResponseTimeout()
     MessageHandled();
 }
 
+namespace {
+
+/**
+ *  Check whether an incoming SecureChannel StatusReport is a Busy flow-control
+ *  signal from an overloaded peer, and if so extract its retry hint.  The hint
+ *  is clamped to CHIP_CONFIG_MRP_BUSY_RETRY_HINT_MAX_MS so a misbehaving peer
+ *  cannot stall retransmissions indefinitely.
+ */
+bool IsBusyStatusReport(const PacketBufferHandle & msgBuf, System::Clock::Timeout & retryHint)
+{
+    Protocols::SecureChannel::StatusReport report;
+    // ParseBorrowed inspects the message in place: the buffer still belongs to the normal
+    // dispatch path, so no defensive copy is needed for this peek.
+    VerifyOrReturnError(report.ParseBorrowed(msgBuf) == CHIP_NO_ERROR, false);
+    VerifyOrReturnError(report.GetGeneralCode() == Protocols::SecureChannel::GeneralStatusCode::kBusy, false);
+    VerifyOrReturnError(report.GetProtocolId() == Protocols::SecureChannel::Id.ToFullyQualifiedSpecForm(), false);
+    VerifyOrReturnError(report.GetProtocolCode() == Protocols::SecureChannel::kProtocolCodeBusy, false);
+
+    const ByteSpan hintData = report.GetProtocolDataSpan();
+    VerifyOrReturnError(hintData.size() >= sizeof(uint16_t), false);
+
+    uint16_t hintMs = LittleEndian::Get16(hintData.data());
+    retryHint       = System::Clock::Milliseconds32(
+        hintMs < CHIP_CONFIG_MRP_BUSY_RETRY_HINT_MAX_MS ? hintMs : CHIP_CONFIG_MRP_BUSY_RETRY_HINT_MAX_MS);
+    return true;
+}
+
+} // anonymous namespace
+
 CHIP_ERROR ExchangeContext::HandleMessage(uint32_t messageCounter, const PayloadHeader & payloadHeader,
                                           const Transport::PeerAddress & peerAddress, MessageFlags msgFlags,
                                           PacketBufferHandle && msgBuf)
@@ -423,6 +533,12 @@ CHIP_ERROR ExchangeContext::HandleMessage(uint32_t messageCounter, const Payload
     bool isStandaloneAck = payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::StandaloneAck);
     bool isDuplicate     = msgFlags.Has(MessageFlagValues::kDuplicateMessage);
 
+    // A Busy status report is MRP-level flow control from an overloaded peer,
+    // not an application-level message.
+    System::Clock::Timeout busyRetryHint = System::Clock::kZero;
+    bool isBusyStatusReport              = payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport) &&
+        IsBusyStatusReport(msgBuf, busyRetryHint);
+
     auto deferred = MakeDefer([&]() {
         // The alreadyHandlingMessage check is effectively a workaround for the fact that SendMessage() is not calling
         // MessageHandled() yet and will go away when we fix that.
@@ -439,7 +555,7 @@ CHIP_ERROR ExchangeContext::HandleMessage(uint32_t messageCounter, const Payload
         // since we don't interact with the application at that point.  That can happen when we are already closed (in which case
         // MessageHandled is a no-op) or if we were just created to send a standalone ack for this incoming message, in which case
         // we should treat it as an app-level message for purposes of our state.
-        if ((isStandaloneAck || isDuplicate) && mDelegate != nullptr)
+        if ((isStandaloneAck || isDuplicate || isBusyStatusReport) && mDelegate != nullptr)
         {
             return;
         }
@@ -468,6 +584,14 @@ CHIP_ERROR ExchangeContext::HandleMessage(uint32_t messageCounter, const Payload
         return CHIP_NO_ERROR;
     }
 
+    // The peer could not take our message right now; honor its retry hint by
+    // deferring the pending retransmission, and consume the report here.
+    if (isBusyStatusReport)
+    {
+        mExchangeMgr->GetReliableMessageMgr()->DeferRetransmission(GetReliableMessageContext(), busyRetryHint);
+        return CHIP_NO_ERROR;
+    }
+
     // Since the message is duplicate, let's not forward it up the stack
     if (isDuplicate)
     {
@@ -545,5 +669,16 @@ const ReliableMessageProtocolConfig & ExchangeContext::GetMRPConfig() const
     return GetSessionHandle().GetMRPConfig(GetExchangeMgr()->GetSessionManager());
 }
 
+System::Clock::Milliseconds32 ExchangeContext::GetIdleRetransmitTimeout() const
+{
+    return GetSessionHandle().GetAdaptiveRetransTimeout(GetExchangeMgr()->GetSessionManager(), GetMRPConfig().mIdleRetransTimeout);
+}
+
+System::Clock::Milliseconds32 ExchangeContext::GetActiveRetransmitTimeout() const
+{
+    return GetSessionHandle().GetAdaptiveRetransTimeout(GetExchangeMgr()->GetSessionManager(),
+                                                        GetMRPConfig().mActiveRetransTimeout);
+}
+
 } // namespace Messaging
 } // namespace chip
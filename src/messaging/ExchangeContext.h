@@ -25,6 +25,7 @@
 
 #include <lib/core/ReferenceCounted.h>
 #include <lib/support/BitFlags.h>
+#include <lib/support/CodeLayoutAnnotations.h>
 #include <lib/support/DLLUtil.h>
 #include <lib/support/ReferenceCountedHandle.h>
 #include <lib/support/TypeTraits.h>
@@ -55,7 +56,9 @@ public:
  *    It defines methods for encoding and communicating CHIP messages within an ExchangeContext
  *    over various transport mechanisms, for example, TCP, UDP, or CHIP Reliable Messaging.
  */
-class DLL_EXPORT ExchangeContext : public ReliableMessageContext, public ReferenceCounted<ExchangeContext, ExchangeContextDeletor>
+class DLL_EXPORT ExchangeContext : public ReliableMessageContext,
+                                   public ReferenceCounted<ExchangeContext, ExchangeContextDeletor>,
+                                   public SessionReleaseDelegate
 {
     friend class ExchangeManager;
     friend class ExchangeContextDeletor;
@@ -139,9 +142,9 @@ public:
      *  @retval  #CHIP_NO_ERROR                             if the CHIP layer successfully delivered the message up to the
      *                                                       protocol layer.
      */
-    CHIP_ERROR HandleMessage(uint32_t messageCounter, const PayloadHeader & payloadHeader,
-                             const Transport::PeerAddress & peerAddress, MessageFlags msgFlags,
-                             System::PacketBufferHandle && msgBuf);
+    CHIP_HOT CHIP_ERROR HandleMessage(uint32_t messageCounter, const PayloadHeader & payloadHeader,
+                                      const Transport::PeerAddress & peerAddress, MessageFlags msgFlags,
+                                      System::PacketBufferHandle && msgBuf);
 
     ExchangeDelegate * GetDelegate() const { return mDelegate; }
     void SetDelegate(ExchangeDelegate * delegate) { mDelegate = delegate; }
@@ -179,6 +182,13 @@ public:
     // Helper function for easily accessing MRP config
     const ReliableMessageProtocolConfig & GetMRPConfig() const;
 
+    /*
+     * Retransmission timeouts for the underlying session, adapted to its measured round-trip time once the session's RTT
+     * estimator has samples, and falling back to the session's static MRP intervals until then.
+     */
+    System::Clock::Milliseconds32 GetIdleRetransmitTimeout() const;
+    System::Clock::Milliseconds32 GetActiveRetransmitTimeout() const;
+
 private:
     Timeout mResponseTimeout{ 0 }; // Maximum time to wait for response (in milliseconds); 0 disables response timeout.
     ExchangeDelegate * mDelegate   = nullptr;
@@ -189,6 +199,31 @@ private:
     SessionHolder mSession; // The connection state
     uint16_t mExchangeId;   // Assigned exchange ID.
 
+    // Intrusive link chaining contexts whose exchange ids share a bucket in
+    // the ExchangeManager dispatch table; maintained by
+    // ExchangeManager::RegisterContextForDispatch() and
+    // UnregisterContextForDispatch().
+    ExchangeContext * mNextMatchCandidate = nullptr;
+
+    // Intrusive link chaining this context into the ExchangeManager recycle
+    // bin while it is parked between interactions.
+    ExchangeContext * mNextRecycled = nullptr;
+
+    /**
+     *  Tear the exchange down to the state a recycled context needs: closed and
+     *  out of the dispatch table, with the delegate and timers cleared but the
+     *  session registration and message dispatch kept warm.  Only
+     *  ExchangeManager::ParkContext() may call this, after checking that the
+     *  context is eligible for reuse.
+     */
+    void Park();
+
+    /**
+     *  Bring a parked context back to the freshly-constructed state for a new
+     *  exchange on the same session.
+     */
+    void Rearm(uint16_t exchangeId, bool initiator, ExchangeDelegate * delegate);
+
     /**
      *  Determine whether a response is currently expected for a message that was sent over
      *  this exchange.  While this is true, attempts to send other messages that expect a response
@@ -234,6 +269,13 @@ private:
      */
     void OnConnectionExpired();
 
+    /**
+     * Implement SessionReleaseDelegate.  The exchange registers itself with its
+     * secure session so that session eviction notifies exactly the exchanges on
+     * that session instead of walking the whole exchange pool.
+     */
+    void OnSessionReleased(const SessionHandle & session) override { OnConnectionExpired(); }
+
     /**
      * Notify our delegate, if any, that we have timed out waiting for a
      * response.
@@ -42,6 +42,8 @@
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
 #include <protocols/Protocols.h>
+#include <protocols/secure_channel/Constants.h>
+#include <protocols/secure_channel/StatusReport.h>
 
 using namespace chip::Encoding;
 using namespace chip::Inet;
@@ -83,7 +85,11 @@ CHIP_ERROR ExchangeManager::Init(SessionManager * sessionManager)
         handler.Reset();
     }
 
-    sessionManager->RegisterReleaseDelegate(*this);
+    for (auto & head : mProtocolDispatch)
+    {
+        head = nullptr;
+    }
+
     sessionManager->SetMessageDelegate(this);
 
     mReliableMessageMgr.Init(sessionManager->SystemLayer());
@@ -96,6 +102,10 @@ CHIP_ERROR ExchangeManager::Init(SessionManager * sessionManager)
 
 CHIP_ERROR ExchangeManager::Shutdown()
 {
+    // Parked contexts are not active exchanges; release them before checking
+    // that the pool has drained.
+    FlushRecycleBin();
+
     mReliableMessageMgr.Shutdown();
 
     mContextPool.ForEachActiveObject([](auto * ec) {
@@ -107,7 +117,6 @@ CHIP_ERROR ExchangeManager::Shutdown()
     if (mSessionManager != nullptr)
     {
         mSessionManager->SetMessageDelegate(nullptr);
-        mSessionManager->UnregisterReleaseDelegate(*this);
         mSessionManager = nullptr;
     }
 
@@ -118,7 +127,83 @@ CHIP_ERROR ExchangeManager::Shutdown()
 
 ExchangeContext * ExchangeManager::NewContext(const SessionHandle & session, ExchangeDelegate * delegate)
 {
-    return mContextPool.CreateObject(this, mNextExchangeId++, session, true, delegate);
+    ExchangeContext * ec = FindRecycledContext(session);
+    if (ec != nullptr)
+    {
+        ec->Rearm(mNextExchangeId++, true, delegate);
+        return ec;
+    }
+
+    ec = mContextPool.CreateObject(this, mNextExchangeId++, session, true, delegate);
+    if (ec == nullptr && mRecycleBinSize != 0)
+    {
+        // Contexts parked for other sessions are spare capacity, not active
+        // exchanges; reclaim them rather than failing the allocation.
+        FlushRecycleBin();
+        ec = mContextPool.CreateObject(this, mNextExchangeId++, session, true, delegate);
+    }
+    return ec;
+}
+
+ExchangeContext * ExchangeManager::FindRecycledContext(const SessionHandle & session)
+{
+    for (ExchangeContext ** link = &mRecycleBin; *link != nullptr; link = &(*link)->mNextRecycled)
+    {
+        ExchangeContext * ec = *link;
+        if (ec->mSession.Contains(session))
+        {
+            *link             = ec->mNextRecycled;
+            ec->mNextRecycled = nullptr;
+            mRecycleBinSize--;
+            return ec;
+        }
+    }
+    return nullptr;
+}
+
+bool ExchangeManager::ParkContext(ExchangeContext * ec)
+{
+    VerifyOrReturnError(mRecycleBinSize < kRecycleBinCapacity, false);
+    VerifyOrReturnError(mState == State::kState_Initialized, false);
+    // Only contexts whose session is still live and whose MRP state is
+    // quiescent can be handed to a later interaction as-is.
+    VerifyOrReturnError(ec->mSession, false);
+    VerifyOrReturnError(!ec->IsGroupExchangeContext(), false);
+    VerifyOrReturnError(!ec->IsAckPending(), false);
+    VerifyOrReturnError(!ec->IsMessageNotAcked(), false);
+
+    ec->Park();
+    ec->mNextRecycled = mRecycleBin;
+    mRecycleBin       = ec;
+    mRecycleBinSize++;
+    return true;
+}
+
+void ExchangeManager::FreeParkedContext(ExchangeContext * ec)
+{
+    for (ExchangeContext ** link = &mRecycleBin; *link != nullptr; link = &(*link)->mNextRecycled)
+    {
+        if (*link == ec)
+        {
+            *link             = ec->mNextRecycled;
+            ec->mNextRecycled = nullptr;
+            mRecycleBinSize--;
+            break;
+        }
+    }
+    mContextPool.ReleaseObject(ec);
+}
+
+void ExchangeManager::FlushRecycleBin()
+{
+    while (mRecycleBin != nullptr)
+    {
+        ExchangeContext * ec = mRecycleBin;
+        mRecycleBin          = ec->mNextRecycled;
+        ec->mNextRecycled    = nullptr;
+        mRecycleBinSize--;
+        mContextPool.ReleaseObject(ec);
+    }
 }
 
 CHIP_ERROR ExchangeManager::RegisterUnsolicitedMessageHandlerForProtocol(Protocols::Id protocolId, ExchangeDelegate * delegate)
@@ -167,6 +252,10 @@ CHIP_ERROR ExchangeManager::RegisterUMH(Protocols::Id protocolId, int16_t msgTyp
     selected->ProtocolId  = protocolId;
     selected->MessageType = msgType;
 
+    UnsolicitedMessageHandler *& head = mProtocolDispatch[ProtocolDispatchSlot(protocolId)];
+    selected->NextInProtocol          = head;
+    head                              = selected;
+
     SYSTEM_STATS_INCREMENT(chip::System::Stats::kExchangeMgr_NumUMHandlers);
 
     return CHIP_NO_ERROR;
@@ -174,11 +263,14 @@ CHIP_ERROR ExchangeManager::RegisterUMH(Protocols::Id protocolId, int16_t msgTyp
 
 CHIP_ERROR ExchangeManager::UnregisterUMH(Protocols::Id protocolId, int16_t msgType)
 {
-    for (auto & umh : UMHandlerPool)
+    for (UnsolicitedMessageHandler ** link = &mProtocolDispatch[ProtocolDispatchSlot(protocolId)]; *link != nullptr;
+         link = &(*link)->NextInProtocol)
     {
-        if (umh.IsInUse() && umh.Matches(protocolId, msgType))
+        UnsolicitedMessageHandler * umh = *link;
+        if (umh->IsInUse() && umh->Matches(protocolId, msgType))
         {
-            umh.Reset();
+            *link = umh->NextInProtocol;
+            umh->Reset();
             SYSTEM_STATS_DECREMENT(chip::System::Stats::kExchangeMgr_NumUMHandlers);
             return CHIP_NO_ERROR;
         }
@@ -205,13 +297,22 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
         msgFlags.Set(MessageFlagValues::kDuplicateMessage);
     }
 
+    // Any receive proves the peer is currently awake; bias MRP retransmissions to it
+    // toward the active retry interval for a window (matters for sleepy peers).
+    mReliableMessageMgr.RecordPeerActivity(session);
+
     // Skip retrieval of exchange for group message since no exchange is stored
     // for group msg (optimization)
     if (!packetHeader.IsGroupSession())
     {
-        // Search for an existing exchange that the message applies to. If a match is found...
+        // Search for an existing exchange that the message applies to.  Only contexts whose
+        // exchange id hashes to the same dispatch bucket need to be considered; the full
+        // match (role, session and encryption) still runs on each candidate.  If a match is
+        // found...
         bool found = false;
-        mContextPool.ForEachActiveObject([&](auto * ec) {
+        for (ExchangeContext * ec = mDispatchTable[GetDispatchBucket(payloadHeader.GetExchangeID())]; ec != nullptr;
+             ec = ec->mNextMatchCandidate)
+        {
             if (ec->MatchExchange(session, packetHeader, payloadHeader))
             {
                 // Found a matching exchange. Set flag for correct subsequent MRP
@@ -227,10 +328,9 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
                 // Matched ExchangeContext; send to message handler.
                 ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, source, msgFlags, std::move(msgBuf));
                 found = true;
-                return Loop::Break;
+                break;
             }
-            return Loop::Continue;
-        });
+        }
 
         if (found)
         {
@@ -252,18 +352,19 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
         // handle the message type over handlers that handle all messages for a profile.
         matchingUMH = nullptr;
 
-        for (auto & umh : UMHandlerPool)
+        for (UnsolicitedMessageHandler * umh = mProtocolDispatch[ProtocolDispatchSlot(payloadHeader.GetProtocolID())];
+             umh != nullptr; umh = umh->NextInProtocol)
         {
-            if (umh.IsInUse() && payloadHeader.HasProtocol(umh.ProtocolId))
+            if (payloadHeader.HasProtocol(umh->ProtocolId))
             {
-                if (umh.MessageType == payloadHeader.GetMessageType())
+                if (umh->MessageType == payloadHeader.GetMessageType())
                 {
-                    matchingUMH = &umh;
+                    matchingUMH = umh;
                     break;
                 }
 
-                if (umh.MessageType == kAnyMessageType)
-                    matchingUMH = &umh;
+                if (umh->MessageType == kAnyMessageType)
+                    matchingUMH = umh;
             }
         }
     }
@@ -285,11 +386,22 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
         // If rcvd msg is not from initiator then this exchange is created as Initiator.
         // Note that if matchingUMH is not null then rcvd msg if from initiator.
         // TODO: Figure out which channel to use for the received message
-        ExchangeContext * ec =
-            mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(), delegate);
+        ExchangeContext * ec = FindRecycledContext(session);
+        if (ec != nullptr)
+        {
+            ec->Rearm(payloadHeader.GetExchangeID(), !payloadHeader.IsInitiator(), delegate);
+        }
+        else
+        {
+            ec = mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(), delegate);
+        }
 
         if (ec == nullptr)
         {
+            // The exchange pool is exhausted: the node is already processing as
+            // much concurrent work as it can.  Tell the sender when to retry so
+            // it does not retransmit into the congestion.
+            SendBusyStatusReport(session, payloadHeader);
             // Using same error message for all errors to reduce code size.
             ChipLogError(ExchangeManager, "OnMessageReceived failed, err = %s", ErrorStr(CHIP_ERROR_NO_MEMORY));
             return;
@@ -314,9 +426,67 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
     }
 }
 
-void ExchangeManager::OnSessionReleased(const SessionHandle & session)
+void ExchangeManager::SendBusyStatusReport(const SessionHandle & session, const PayloadHeader & payloadHeader)
 {
-    ExpireExchangesForSession(session);
+#if CHIP_CONFIG_MRP_BUSY_RETRY_HINT_MS > 0
+    // The retry hint travels as the protocol-specific data of the status
+    // report: the retry delay in milliseconds as a little-endian uint16_t.
+    uint8_t retryHint[sizeof(uint16_t)];
+    Encoding::LittleEndian::Put16(retryHint, CHIP_CONFIG_MRP_BUSY_RETRY_HINT_MS);
+    System::PacketBufferHandle hintBuf = System::PacketBufferHandle::NewWithData(retryHint, sizeof(retryHint));
+    VerifyOrReturn(!hintBuf.IsNull());
+
+    Protocols::SecureChannel::StatusReport report(Protocols::SecureChannel::GeneralStatusCode::kBusy,
+                                                  Protocols::SecureChannel::Id.ToFullyQualifiedSpecForm(),
+                                                  Protocols::SecureChannel::kProtocolCodeBusy, std::move(hintBuf));
+
+    size_t msgSize = report.Size();
+    Encoding::LittleEndian::PacketBufferWriter bbuf(MessagePacketBuffer::New(msgSize), msgSize);
+    VerifyOrReturn(!bbuf.IsNull());
+    report.WriteToBuffer(bbuf);
+    System::PacketBufferHandle msg = bbuf.Finalize();
+    VerifyOrReturn(!msg.IsNull());
+
+    // The status report answers on the same exchange id the dropped message
+    // arrived on, so the sender's exchange context can match it.  It is sent
+    // without an exchange context of our own (we could not allocate one, which
+    // is the point) and without reliability: if it is lost, the sender simply
+    // retransmits on its normal schedule.
+    PayloadHeader busyHeader;
+    busyHeader.SetExchangeID(payloadHeader.GetExchangeID())
+        .SetMessageType(Protocols::SecureChannel::MsgType::StatusReport)
+        .SetInitiator(!payloadHeader.IsInitiator());
+
+    EncryptedPacketBufferHandle preparedMessage;
+    VerifyOrReturn(mSessionManager->PrepareMessage(session, busyHeader, std::move(msg), preparedMessage) == CHIP_NO_ERROR);
+    if (mSessionManager->SendPreparedMessage(session, preparedMessage) == CHIP_NO_ERROR)
+    {
+        ChipLogProgress(ExchangeManager, "Sent Busy status with %dms retry hint on exchange " ChipLogFormatExchangeId,
+                        CHIP_CONFIG_MRP_BUSY_RETRY_HINT_MS, ChipLogValueExchangeIdFromReceivedHeader(payloadHeader));
+    }
+#endif // CHIP_CONFIG_MRP_BUSY_RETRY_HINT_MS > 0
+}
+
+void ExchangeManager::RegisterContextForDispatch(ExchangeContext * ec)
+{
+    ExchangeContext *& head = mDispatchTable[GetDispatchBucket(ec->GetExchangeId())];
+
+    ec->mNextMatchCandidate = head;
+    head                    = ec;
+}
+
+void ExchangeManager::UnregisterContextForDispatch(ExchangeContext * ec)
+{
+    for (ExchangeContext ** link = &mDispatchTable[GetDispatchBucket(ec->GetExchangeId())]; *link != nullptr;
+         link = &(*link)->mNextMatchCandidate)
+    {
+        if (*link == ec)
+        {
+            *link                   = ec->mNextMatchCandidate;
+            ec->mNextMatchCandidate = nullptr;
+            return;
+        }
+    }
 }
 
 void ExchangeManager::ExpireExchangesForSession(const SessionHandle & session)
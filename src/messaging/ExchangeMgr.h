@@ -49,7 +49,7 @@ static constexpr int16_t kAnyMessageType = -1;
  *    It works on be behalf of higher layers, creating ExchangeContexts and
  *    handling the registration/unregistration of unsolicited message handlers.
  */
-class DLL_EXPORT ExchangeManager : public SessionMessageDelegate, public SessionReleaseDelegate
+class DLL_EXPORT ExchangeManager : public SessionMessageDelegate
 {
     friend class ExchangeContext;
 
@@ -98,10 +98,20 @@ public:
      *
      *  @return   A pointer to the created ExchangeContext object On success. Otherwise NULL if no object
      *            can be allocated or is available.
+     *
+     *  @note If a completed context has been parked for reuse on the same
+     *        session, it is re-armed and returned instead of allocating a new
+     *        one from the pool.
      */
     ExchangeContext * NewContext(const SessionHandle & session, ExchangeDelegate * delegate);
 
-    void ReleaseContext(ExchangeContext * ec) { mContextPool.ReleaseObject(ec); }
+    void ReleaseContext(ExchangeContext * ec)
+    {
+        if (!ParkContext(ec))
+        {
+            mContextPool.ReleaseObject(ec);
+        }
+    }
 
     /**
      *  Register an unsolicited message handler for a given protocol identifier. This handler would be
@@ -191,10 +201,11 @@ public:
 
     uint16_t GetNextKeyId() { return ++mNextKeyId; }
 
-    size_t GetNumActiveExchanges() { return mContextPool.Allocated(); }
+    size_t GetNumActiveExchanges() { return mContextPool.Allocated() - mRecycleBinSize; }
 
-    // TODO: this should be test only, after OnSessionReleased is move to SessionHandle within the exchange context
-    // Expire all exchanges associated with the given session
+    // Expire all exchanges associated with the given session.  Exchanges register
+    // with their secure session and are notified of its release directly, so this
+    // remains only for callers (mostly tests) that need to force the expiry.
     void ExpireExchangesForSession(const SessionHandle & session);
 
 private:
@@ -206,7 +217,7 @@ private:
 
     struct UnsolicitedMessageHandler
     {
-        UnsolicitedMessageHandler() : ProtocolId(Protocols::NotSpecified) {}
+        UnsolicitedMessageHandler() : ProtocolId(Protocols::NotSpecified), NextInProtocol(nullptr) {}
 
         constexpr void Reset() { Delegate = nullptr; }
         constexpr bool IsInUse() const { return Delegate != nullptr; }
@@ -223,6 +234,9 @@ private:
         // so need a type that can store both that and all valid message type
         // values.
         int16_t MessageType;
+        // Intrusive link chaining handlers that share a protocol dispatch
+        // slot; maintained by RegisterUMH() and UnregisterUMH().
+        UnsolicitedMessageHandler * NextInProtocol;
     };
 
     uint16_t mNextExchangeId;
@@ -238,16 +252,70 @@ private:
 
     BitMapObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> mContextPool;
 
+    // Dispatch table mapping exchange ids onto the contexts an inbound message
+    // may match, maintained as contexts are allocated and released.  Contexts
+    // whose ids collide share a bucket chain that is disambiguated with
+    // ExchangeContext::MatchExchange() (role, session and encryption) at
+    // dispatch time, so the cost of matching a message tracks the number of
+    // colliding exchanges instead of the size of the context pool.
+    static constexpr size_t kDispatchTableSize = CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS;
+    ExchangeContext * mDispatchTable[kDispatchTableSize] = {};
+
+    size_t GetDispatchBucket(uint16_t exchangeId) const { return exchangeId % kDispatchTableSize; }
+    void RegisterContextForDispatch(ExchangeContext * ec);
+    void UnregisterContextForDispatch(ExchangeContext * ec);
+
+    // Completed contexts parked for reuse on their still-live session, linked
+    // through ExchangeContext::mNextRecycled.  Parked contexts stay allocated
+    // in mContextPool, so the bin trades a bounded amount of idle pool capacity
+    // for allocation-free repeat interactions; NewContext() reclaims parked
+    // contexts before failing when the pool runs dry.
+    static constexpr size_t kRecycleBinCapacity = CHIP_CONFIG_EXCHANGE_CONTEXT_RECYCLE_POOL_SIZE;
+    ExchangeContext * mRecycleBin               = nullptr;
+    size_t mRecycleBinSize                      = 0;
+
+    // Pop a parked context matching the given session, or return nullptr.
+    ExchangeContext * FindRecycledContext(const SessionHandle & session);
+    // Park a context whose reference count reached zero; returns false (and
+    // leaves the context untouched) if it is not eligible or the bin is full.
+    bool ParkContext(ExchangeContext * ec);
+    // Return a parked context's pool slot, unlinking it from the bin if needed.
+    void FreeParkedContext(ExchangeContext * ec);
+    void FlushRecycleBin();
+
     UnsolicitedMessageHandler UMHandlerPool[CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS];
 
+    // Dispatch table mapping a message's protocol onto the handlers registered
+    // for it.  Each standard protocol (the ids allocated under VendorId::Common
+    // in Protocols.h) gets a dedicated slot computed at compile time from its
+    // protocol id, so finding the handlers for an unsolicited message — the
+    // first hop for every new inbound exchange — is an array index plus a walk
+    // of only that protocol's handlers instead of a scan of the whole pool.
+    // Handlers for vendor-specific protocols share the final overflow slot.
+    static constexpr size_t kStandardProtocolCount = 10; // SecureChannel .. TempZCL (0x0000 - 0x0009)
+    static constexpr size_t kProtocolDispatchSlots = kStandardProtocolCount + 1;
+
+    static constexpr size_t ProtocolDispatchSlot(Protocols::Id protocolId)
+    {
+        return (protocolId.GetVendorId() == VendorId::Common && protocolId.GetProtocolId() < kStandardProtocolCount)
+            ? protocolId.GetProtocolId()
+            : kStandardProtocolCount;
+    }
+
+    UnsolicitedMessageHandler * mProtocolDispatch[kProtocolDispatchSlots] = {};
+
     CHIP_ERROR RegisterUMH(Protocols::Id protocolId, int16_t msgType, ExchangeDelegate * delegate);
     CHIP_ERROR UnregisterUMH(Protocols::Id protocolId, int16_t msgType);
 
+    // Tell the sender of a message we had to drop for lack of an exchange
+    // context to back off, by sending a Busy status report carrying the
+    // CHIP_CONFIG_MRP_BUSY_RETRY_HINT_MS retry hint on the message's exchange.
+    // Sent unreliably and without an exchange; best effort.
+    void SendBusyStatusReport(const SessionHandle & session, const PayloadHeader & payloadHeader);
+
     void OnMessageReceived(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader, const SessionHandle & session,
                            const Transport::PeerAddress & source, DuplicateMessage isDuplicate,
                            System::PacketBufferHandle && msgBuf) override;
-
-    void OnSessionReleased(const SessionHandle & session) override;
 };
 
 } // namespace Messaging
@@ -39,7 +39,9 @@
 namespace chip {
 namespace Messaging {
 
-ReliableMessageContext::ReliableMessageContext() : mNextAckTime(0), mPendingPeerAckMessageCounter(0) {}
+ReliableMessageContext::ReliableMessageContext() :
+    mNextAckTime(0), mPendingPeerAckMessageCounter(0), mPendingRetransEntry(nullptr)
+{}
 
 bool ReliableMessageContext::AutoRequestAck() const
 {
@@ -42,6 +42,7 @@ class ChipMessageInfo;
 class ExchangeContext;
 enum class MessageFlagValues : uint32_t;
 class ReliableMessageMgr;
+struct RetransTableEntry;
 
 class ReliableMessageContext
 {
@@ -196,6 +197,11 @@ protected:
         kFlagHandlingMessage = (1u << 9),
         /// When set, we have had Close() or Abort() called on us already.
         kFlagClosed = (1u << 10),
+
+        /// When set, the context is parked in the ExchangeManager recycle bin,
+        /// keeping its session registration and dispatch warm for reuse by a
+        /// later exchange on the same session.
+        kFlagParked = (1u << 11),
     };
 
     BitFlags<Flags> mFlags; // Internal state flags
@@ -223,9 +229,15 @@ private:
     friend class ReliableMessageMgr;
     friend class ExchangeContext;
     friend class ExchangeMessageDispatch;
+    friend struct RetransTableEntry;
 
     System::Clock::Timestamp mNextAckTime; // Next time for triggering Solo Ack
     uint32_t mPendingPeerAckMessageCounter;
+
+    // The retransmission table entry tracking the un-acknowledged message on this
+    // exchange, if any.  Maintained by the entry itself, so the reliable message
+    // manager can match incoming acks without scanning the retransmission table.
+    RetransTableEntry * mPendingRetransEntry;
 };
 
 } // namespace Messaging
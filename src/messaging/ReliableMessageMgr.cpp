@@ -34,18 +34,22 @@
 #include <messaging/ExchangeMgr.h>
 #include <messaging/Flags.h>
 #include <messaging/ReliableMessageContext.h>
+#include <system/SystemStats.h>
 
 namespace chip {
 namespace Messaging {
 
-ReliableMessageMgr::RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
-    ec(*rc->GetExchangeContext()), retainedBuf(EncryptedPacketBufferHandle()), nextRetransTime(0), sendCount(0)
+RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
+    ec(*rc->GetExchangeContext()), retainedBuf(EncryptedPacketBufferHandle()), nextRetransTime(0),
+    firstSendTime(System::SystemClock().GetMonotonicTimestamp()), sendCount(0)
 {
     ec->SetMessageNotAcked(true);
+    rc->mPendingRetransEntry = this;
 }
 
-ReliableMessageMgr::RetransTableEntry::~RetransTableEntry()
+RetransTableEntry::~RetransTableEntry()
 {
+    ec->mPendingRetransEntry = nullptr;
     ec->SetMessageNotAcked(false);
 }
 
@@ -55,9 +59,32 @@ ReliableMessageMgr::ReliableMessageMgr(BitMapObjectPool<ExchangeContext, CHIP_CO
 
 ReliableMessageMgr::~ReliableMessageMgr() {}
 
+ReliableMessageStatCounters & GlobalReliableMessageStats()
+{
+    static ReliableMessageStatCounters sGlobalReliableMessageStats;
+    return sGlobalReliableMessageStats;
+}
+
+size_t WriteReliableMessageMetrics(char * buffer, size_t bufferSize)
+{
+    const ReliableMessageStatCounters & stats = GlobalReliableMessageStats();
+    size_t used                               = 0;
+
+    used += System::Stats::WriteMetricType(buffer + used, bufferSize - used, "chip_mrp_retransmits_total", "counter");
+    used += System::Stats::WriteMetricLine(buffer + used, bufferSize - used, "chip_mrp_retransmits_total", nullptr, nullptr,
+                                           stats.mRetransmits);
+    used += System::Stats::WriteMetricType(buffer + used, bufferSize - used, "chip_mrp_dropped_messages_total", "counter");
+    used += System::Stats::WriteMetricLine(buffer + used, bufferSize - used, "chip_mrp_dropped_messages_total", nullptr, nullptr,
+                                           stats.mDroppedMessages);
+
+    return used;
+}
+
 void ReliableMessageMgr::Init(chip::System::Layer * systemLayer)
 {
     mSystemLayer = systemLayer;
+
+    (void) System::Stats::RegisterMetricsEmitter(WriteReliableMessageMetrics);
 }
 
 void ReliableMessageMgr::Shutdown()
@@ -133,6 +160,7 @@ void ReliableMessageMgr::ExecuteActions()
 
             // Do not StartTimer, we will schedule the timer at the end of the timer handler.
             mRetransTable.ReleaseObject(entry);
+            GlobalReliableMessageStats().mDroppedMessages++;
             return Loop::Continue;
         }
 
@@ -140,8 +168,12 @@ void ReliableMessageMgr::ExecuteActions()
                       "Retransmitting MessageCounter:" ChipLogFormatMessageCounter " on exchange " ChipLogFormatExchange
                       " Send Cnt %d",
                       messageCounter, ChipLogValueExchange(&entry->ec.Get()), entry->sendCount);
-        // TODO: Choose active/idle timeout corresponding to the activity of exchanges of the session.
-        entry->nextRetransTime = System::SystemClock().GetMonotonicTimestamp() + entry->ec->GetMRPConfig().mActiveRetransTimeout;
+        // The base timeout adapts to the session's measured RTT when available, and each unsuccessful
+        // retransmission doubles the wait so a struggling peer is not hammered at a fixed rate.
+        const System::Clock::Milliseconds32 baseTimeout = GetBaseRetransmitTimeout(entry);
+        entry->nextRetransTime =
+            System::SystemClock().GetMonotonicTimestamp() + (baseTimeout * (static_cast<uint32_t>(1) << entry->sendCount));
+        GlobalReliableMessageStats().mRetransmits++;
         SendFromRetransTable(entry);
         // For test not using async IO loop, the entry may have been removed after send, do not use entry below
 
@@ -184,31 +216,119 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
 
 void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 {
-    // TODO: Choose active/idle timeout corresponding to the activity of exchanges of the session.
-    entry->nextRetransTime = System::SystemClock().GetMonotonicTimestamp() + entry->ec->GetMRPConfig().mIdleRetransTimeout;
+    entry->nextRetransTime = System::SystemClock().GetMonotonicTimestamp() + GetBaseRetransmitTimeout(entry);
     StartTimer();
 }
 
-bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, uint32_t ackMessageCounter)
+void ReliableMessageMgr::RecordPeerActivity(const SessionHandle & session)
 {
-    bool removed = false;
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc && entry->retainedBuf.GetMessageCounter() == ackMessageCounter)
+    const NodeId peer = session.GetPeerNodeId();
+    VerifyOrReturn(peer != kUndefinedNodeId);
+
+    const FabricIndex fabric           = session.GetFabricIndex();
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+
+    PeerActivityEntry * oldest = &mPeerActivityTable[0];
+    for (auto & entry : mPeerActivityTable)
+    {
+        if (entry.mPeerNodeId == peer && entry.mFabricIndex == fabric)
         {
-            // Clear the entry from the retransmision table.
-            ClearRetransTable(*entry);
-
-            ChipLogDetail(ExchangeManager,
-                          "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
-                          " from Retrans Table on exchange " ChipLogFormatExchange,
-                          ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
-            removed = true;
-            return Loop::Break;
+            entry.mLastActivityTime = now;
+            return;
         }
-        return Loop::Continue;
-    });
+        if (entry.mLastActivityTime < oldest->mLastActivityTime)
+        {
+            oldest = &entry;
+        }
+    }
 
-    return removed;
+    oldest->mPeerNodeId       = peer;
+    oldest->mFabricIndex      = fabric;
+    oldest->mLastActivityTime = now;
+}
+
+bool ReliableMessageMgr::IsPeerActive(NodeId peerNodeId, FabricIndex fabricIndex) const
+{
+    VerifyOrReturnError(peerNodeId != kUndefinedNodeId, false);
+
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    for (const auto & entry : mPeerActivityTable)
+    {
+        if (entry.mPeerNodeId == peerNodeId && entry.mFabricIndex == fabricIndex)
+        {
+            using namespace System::Clock::Literals;
+            return (now - entry.mLastActivityTime) <= CHIP_CONFIG_MRP_PEER_ACTIVE_WINDOW;
+        }
+    }
+    return false;
+}
+
+System::Clock::Milliseconds32 ReliableMessageMgr::GetBaseRetransmitTimeout(RetransTableEntry * entry)
+{
+    // A receive on this very exchange, or any recent receive from the peer on another
+    // exchange, proves the peer is awake.
+    if (entry->ec->HasRcvdMsgFromPeer())
+    {
+        return entry->ec->GetActiveRetransmitTimeout();
+    }
+    if (entry->ec->HasSessionHandle())
+    {
+        const SessionHandle session = entry->ec->GetSessionHandle();
+        if (IsPeerActive(session.GetPeerNodeId(), session.GetFabricIndex()))
+        {
+            return entry->ec->GetActiveRetransmitTimeout();
+        }
+    }
+    return entry->ec->GetIdleRetransmitTimeout();
+}
+
+bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, uint32_t ackMessageCounter)
+{
+    // Each exchange has at most one message awaiting an ack, and the context tracks its
+    // retransmission table entry directly, so no table scan is needed here.
+    RetransTableEntry * entry = rc->mPendingRetransEntry;
+    if (entry == nullptr || entry->retainedBuf.GetMessageCounter() != ackMessageCounter)
+    {
+        return false;
+    }
+
+    // A message acknowledged without any retransmission yields an unambiguous round-trip sample
+    // (Karn's algorithm); feed it to the session's RTT estimator so future retransmission
+    // timeouts reflect the actual link.
+    ExchangeContext * ec = rc->GetExchangeContext();
+    if (entry->sendCount == 0 && ec->HasSessionHandle() && ec->GetExchangeMgr() != nullptr)
+    {
+        const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+        ec->GetSessionHandle().AddRttSample(ec->GetExchangeMgr()->GetSessionManager(),
+                                            std::chrono::duration_cast<System::Clock::Milliseconds32>(now - entry->firstSendTime));
+    }
+
+    // Clear the entry from the retransmision table.
+    ClearRetransTable(*entry);
+
+    ChipLogDetail(ExchangeManager,
+                  "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
+                  " from Retrans Table on exchange " ChipLogFormatExchange,
+                  ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
+    return true;
+}
+
+void ReliableMessageMgr::DeferRetransmission(ReliableMessageContext * rc, System::Clock::Timeout delay)
+{
+    RetransTableEntry * entry = rc->mPendingRetransEntry;
+    VerifyOrReturn(entry != nullptr);
+
+    const System::Clock::Timestamp deferredTime = System::SystemClock().GetMonotonicTimestamp() + delay;
+    VerifyOrReturn(entry->nextRetransTime < deferredTime);
+
+    ChipLogDetail(ExchangeManager,
+                  "Peer is busy; deferring retransmission of MessageCounter:" ChipLogFormatMessageCounter
+                  " on exchange " ChipLogFormatExchange " by %" PRIu32 "ms",
+                  entry->retainedBuf.GetMessageCounter(), ChipLogValueExchange(rc->GetExchangeContext()),
+                  static_cast<uint32_t>(std::chrono::duration_cast<System::Clock::Milliseconds32>(delay).count()));
+
+    entry->nextRetransTime = deferredTime;
+    StartTimer();
 }
 
 CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
@@ -261,14 +381,10 @@ CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
 
 void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 {
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc)
-        {
-            ClearRetransTable(*entry);
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    if (rc->mPendingRetransEntry != nullptr)
+    {
+        ClearRetransTable(*rc->mPendingRetransEntry);
+    }
 }
 
 void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
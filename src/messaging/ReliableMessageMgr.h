@@ -44,30 +44,57 @@ using ExchangeHandle = ReferenceCountedHandle<ExchangeContext>;
 enum class SendMessageFlags : uint16_t;
 class ReliableMessageContext;
 
+/**
+ * Cumulative MRP counters aggregated across all exchanges, mirroring
+ * Transport::GlobalSessionStats().  All updates happen on the CHIP event loop
+ * thread, so plain fields suffice.
+ */
+struct ReliableMessageStatCounters
+{
+    uint64_t mRetransmits     = 0; /**< Messages re-sent after an ack timeout. */
+    uint64_t mDroppedMessages = 0; /**< Messages abandoned after the retry limit. */
+};
+
+/** Counters aggregated across all exchanges since boot. */
+ReliableMessageStatCounters & GlobalReliableMessageStats();
+
+/**
+ * Writes the MRP counters in the Prometheus text exposition format (see
+ * System::Stats::WriteMetrics()).  Registered as a metrics emitter by
+ * ReliableMessageMgr::Init().
+ */
+size_t WriteReliableMessageMetrics(char * buffer, size_t bufferSize);
+
+/**
+ *  @class RetransTableEntry
+ *
+ *  @brief
+ *    This class is part of the CHIP Reliable Messaging Protocol and is used
+ *    to keep track of CHIP messages that have been sent and are expecting an
+ *    acknowledgment back. If the acknowledgment is not received within a
+ *    specific timeout, the message would be retransmitted from this table.
+ *
+ *    While it exists, the entry registers itself with the ReliableMessageContext
+ *    it was created for, so the context's un-acknowledged message can be found
+ *    without scanning the retransmission table.
+ */
+struct RetransTableEntry
+{
+    RetransTableEntry(ReliableMessageContext * rc);
+    ~RetransTableEntry();
+
+    ExchangeHandle ec;                        /**< The context for the stored CHIP message. */
+    EncryptedPacketBufferHandle retainedBuf;  /**< The packet buffer holding the CHIP message. */
+    System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
+    System::Clock::Timestamp firstSendTime;   /**< Time of the initial transmission, for RTT measurement on ack. */
+    uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
+                                                   including both successfully and failure send. */
+};
+
 class ReliableMessageMgr
 {
 public:
-    /**
-     *  @class RetransTableEntry
-     *
-     *  @brief
-     *    This class is part of the CHIP Reliable Messaging Protocol and is used
-     *    to keep track of CHIP messages that have been sent and are expecting an
-     *    acknowledgment back. If the acknowledgment is not received within a
-     *    specific timeout, the message would be retransmitted from this table.
-     *
-     */
-    struct RetransTableEntry
-    {
-        RetransTableEntry(ReliableMessageContext * rc);
-        ~RetransTableEntry();
-
-        ExchangeHandle ec;                        /**< The context for the stored CHIP message. */
-        EncryptedPacketBufferHandle retainedBuf;  /**< The packet buffer holding the CHIP message. */
-        System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
-        uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
-                                                       including both successfully and failure send. */
-    };
+    using RetransTableEntry = Messaging::RetransTableEntry;
 
 public:
     ReliableMessageMgr(BitMapObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
@@ -122,6 +149,16 @@ public:
      */
     bool CheckAndRemRetransTable(ReliableMessageContext * rc, uint32_t ackMessageCounter);
 
+    /**
+     *  Push out the next retransmission of the context's un-acknowledged message,
+     *  in response to a Busy status report from the peer. The delay only ever
+     *  moves the retransmission later; the retry count is not affected.
+     *
+     *  @param[in]    rc       A pointer to the ExchangeContext object.
+     *  @param[in]    delay    How long the peer asked us to wait before retrying.
+     */
+    void DeferRetransmission(ReliableMessageContext * rc, System::Clock::Timeout delay);
+
     /**
      *  Send the specified entry from the retransmission table.
      *
@@ -162,6 +199,19 @@ public:
      */
     void StopTimer();
 
+    /**
+     * Record that a message was received from the peer on the given session. For
+     * CHIP_CONFIG_MRP_PEER_ACTIVE_WINDOW afterwards that peer is treated as awake, so
+     * retransmissions to it wait the active instead of the idle retry interval. This
+     * matters chiefly for sleepy peers: a report they just sent proves they are awake.
+     */
+    void RecordPeerActivity(const SessionHandle & session);
+
+    /**
+     * Whether a message was received from the given peer within the activity window.
+     */
+    bool IsPeerActive(NodeId peerNodeId, FabricIndex fabricIndex) const;
+
 #if CHIP_CONFIG_TEST
     // Functions for testing
     int TestGetCountRetransTable();
@@ -183,6 +233,21 @@ private:
 
     void TicklessDebugDumpRetransTable(const char * log);
 
+    // Base retransmission wait for the entry: the active retry interval when the peer is
+    // known (or assumed) awake, the idle retry interval otherwise.
+    System::Clock::Milliseconds32 GetBaseRetransmitTimeout(RetransTableEntry * entry);
+
+    // Recently heard-from peers, least-recently-active entry replaced when full. A miss
+    // is conservative: an untracked peer is simply treated as idle.
+    struct PeerActivityEntry
+    {
+        NodeId mPeerNodeId       = kUndefinedNodeId;
+        FabricIndex mFabricIndex = kUndefinedFabricIndex;
+        System::Clock::Timestamp mLastActivityTime{};
+    };
+    static constexpr size_t kPeerActivityTableSize = 16;
+    PeerActivityEntry mPeerActivityTable[kPeerActivityTableSize];
+
     // ReliableMessageProtocol Global tables for timer context
     BitMapObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
 };
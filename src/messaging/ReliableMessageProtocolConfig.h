@@ -59,6 +59,19 @@ namespace chip {
 #define CHIP_CONFIG_MRP_DEFAULT_IDLE_RETRY_INTERVAL (5000_ms32)
 #endif // CHIP_CONFIG_MRP_DEFAULT_IDLE_RETRY_INTERVAL
 
+/**
+ *  @def CHIP_CONFIG_MRP_PEER_ACTIVE_WINDOW
+ *
+ *  @brief
+ *    How long after any receive from a peer that peer is still assumed to be
+ *    awake, so retransmissions to it wait the active instead of the idle retry
+ *    interval (see ReliableMessageMgr::RecordPeerActivity).
+ *
+ */
+#ifndef CHIP_CONFIG_MRP_PEER_ACTIVE_WINDOW
+#define CHIP_CONFIG_MRP_PEER_ACTIVE_WINDOW (4000_ms32)
+#endif // CHIP_CONFIG_MRP_PEER_ACTIVE_WINDOW
+
 /**
  *  @def CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT
  *
@@ -100,6 +113,34 @@ namespace chip {
 #define CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS (3)
 #endif // CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS
 
+/**
+ *  @def CHIP_CONFIG_MRP_BUSY_RETRY_HINT_MS
+ *
+ *  @brief
+ *    The retry hint, in milliseconds, carried in the Busy status report an
+ *    overloaded node sends when it has to drop an incoming message because its
+ *    exchange pool is exhausted. A peer that honors the hint defers its
+ *    retransmissions for that long instead of retransmitting into the
+ *    congestion. A value of 0 disables sending the Busy status report.
+ *
+ */
+#ifndef CHIP_CONFIG_MRP_BUSY_RETRY_HINT_MS
+#define CHIP_CONFIG_MRP_BUSY_RETRY_HINT_MS 500
+#endif // CHIP_CONFIG_MRP_BUSY_RETRY_HINT_MS
+
+/**
+ *  @def CHIP_CONFIG_MRP_BUSY_RETRY_HINT_MAX_MS
+ *
+ *  @brief
+ *    Upper bound, in milliseconds, on the retry hint honored from a peer's
+ *    Busy status report, so a misbehaving peer cannot stall retransmissions
+ *    indefinitely.
+ *
+ */
+#ifndef CHIP_CONFIG_MRP_BUSY_RETRY_HINT_MAX_MS
+#define CHIP_CONFIG_MRP_BUSY_RETRY_HINT_MAX_MS 10000
+#endif // CHIP_CONFIG_MRP_BUSY_RETRY_HINT_MAX_MS
+
 /**
  *  @brief
  *    The ReliableMessageProtocol configuration.
@@ -119,4 +160,75 @@ struct ReliableMessageProtocolConfig
 
 extern const ReliableMessageProtocolConfig gDefaultMRPConfig;
 
+/**
+ *  @brief
+ *    Smoothed round-trip time estimator used to adapt MRP retransmission
+ *    timeouts to the measured link instead of the static defaults, so a
+ *    LAN-local peer is retried quickly while a slow peer is not retried
+ *    spuriously.
+ *
+ *    Follows the TCP algorithm from RFC 6298: SRTT and RTTVAR are kept as
+ *    exponentially weighted moving averages and the retransmission timeout is
+ *    SRTT + 4 * RTTVAR. Only messages that were acknowledged without any
+ *    retransmission may be sampled (Karn's algorithm); enforcing that is the
+ *    caller's responsibility.
+ */
+class PeerRttEstimator
+{
+public:
+    void AddSample(System::Clock::Milliseconds32 rtt)
+    {
+        const uint32_t sample = rtt.count();
+
+        if (!mHasEstimate)
+        {
+            mSmoothedRtt = sample;
+            mRttVariance = sample / 2;
+            mHasEstimate = true;
+            return;
+        }
+
+        const uint32_t absDiff = (mSmoothedRtt > sample) ? (mSmoothedRtt - sample) : (sample - mSmoothedRtt);
+        mRttVariance           = (3 * mRttVariance + absDiff) / 4;
+        mSmoothedRtt           = (7 * mSmoothedRtt + sample) / 8;
+    }
+
+    bool HasEstimate() const { return mHasEstimate; }
+
+    /**
+     * Retransmission timeout derived from the estimate (SRTT + 4 * RTTVAR), clamped to
+     * [kMinRetransTimeoutMs, kMaxRetransTimeoutMs]. Returns @a fallback until the first
+     * sample has been recorded.
+     */
+    System::Clock::Milliseconds32 GetRetransTimeout(System::Clock::Milliseconds32 fallback) const
+    {
+        if (!mHasEstimate)
+        {
+            return fallback;
+        }
+
+        uint32_t timeout = mSmoothedRtt + 4 * mRttVariance;
+        if (timeout < kMinRetransTimeoutMs)
+        {
+            timeout = kMinRetransTimeoutMs;
+        }
+        else if (timeout > kMaxRetransTimeoutMs)
+        {
+            timeout = kMaxRetransTimeoutMs;
+        }
+        return System::Clock::Milliseconds32(timeout);
+    }
+
+private:
+    // The lower bound guards against pathologically aggressive retransmits on
+    // same-host links; the upper bound keeps recovery workable if the estimate
+    // was inflated by a latency spike.
+    static constexpr uint32_t kMinRetransTimeoutMs = 50;
+    static constexpr uint32_t kMaxRetransTimeoutMs = 10000;
+
+    uint32_t mSmoothedRtt = 0;
+    uint32_t mRttVariance = 0;
+    bool mHasEstimate     = false;
+};
+
 } // namespace chip
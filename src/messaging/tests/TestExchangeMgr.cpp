@@ -113,6 +113,48 @@ void CheckNewContextTest(nlTestSuite * inSuite, void * inContext)
     ec2->Close();
 }
 
+void CheckContextRecycling(nlTestSuite * inSuite, void * inContext)
+{
+#if CHIP_CONFIG_EXCHANGE_CONTEXT_RECYCLE_POOL_SIZE > 0
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    MockAppDelegate mockAppDelegate;
+    ExchangeContext * ec1 = ctx.NewExchangeToBob(&mockAppDelegate);
+    NL_TEST_ASSERT(inSuite, ec1 != nullptr);
+    uint16_t firstExchangeId = ec1->GetExchangeId();
+    SessionHandle session    = ec1->GetSessionHandle();
+    size_t activeBefore      = ctx.GetExchangeManager().GetNumActiveExchanges();
+
+    // Closing the exchange parks it for its session instead of freeing it;
+    // parked contexts do not count as active.
+    ec1->Close();
+    NL_TEST_ASSERT(inSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == activeBefore - 1);
+
+    // A new exchange on the same session reuses the parked context with a fresh
+    // exchange id, reference and delegate.
+    ExchangeContext * ec2 = ctx.NewExchangeToBob(&mockAppDelegate);
+    NL_TEST_ASSERT(inSuite, ec2 == ec1);
+    NL_TEST_ASSERT(inSuite, ec2->GetExchangeId() != firstExchangeId);
+    NL_TEST_ASSERT(inSuite, ec2->IsInitiator());
+    NL_TEST_ASSERT(inSuite, ec2->GetReferenceCount() == 1);
+    NL_TEST_ASSERT(inSuite, ec2->GetDelegate() == &mockAppDelegate);
+    NL_TEST_ASSERT(inSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == activeBefore);
+
+    // A context parked for one session must not be handed to another session.
+    ec2->Close();
+    ExchangeContext * ec3 = ctx.NewExchangeToAlice(&mockAppDelegate);
+    NL_TEST_ASSERT(inSuite, ec3 != nullptr);
+    NL_TEST_ASSERT(inSuite, !(ec3->GetSessionHandle() == session));
+    ec3->Close();
+
+    // Expiring the session frees the contexts parked for it without disturbing
+    // the active count.
+    size_t activeAfterPark = ctx.GetExchangeManager().GetNumActiveExchanges();
+    ctx.GetExchangeManager().ExpireExchangesForSession(session);
+    NL_TEST_ASSERT(inSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == activeAfterPark);
+#endif // CHIP_CONFIG_EXCHANGE_CONTEXT_RECYCLE_POOL_SIZE > 0
+}
+
 void CheckSessionExpirationBasics(nlTestSuite * inSuite, void * inContext)
 {
     TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
@@ -230,6 +272,7 @@ void CheckExchangeMessages(nlTestSuite * inSuite, void * inContext)
 const nlTest sTests[] =
 {
     NL_TEST_DEF("Test ExchangeMgr::NewContext",               CheckNewContextTest),
+    NL_TEST_DEF("Test ExchangeMgr::CheckContextRecycling",    CheckContextRecycling),
     NL_TEST_DEF("Test ExchangeMgr::CheckUmhRegistrationTest", CheckUmhRegistrationTest),
     NL_TEST_DEF("Test ExchangeMgr::CheckExchangeMessages",    CheckExchangeMessages),
     NL_TEST_DEF("Test OnConnectionExpired basics",            CheckSessionExpirationBasics),
@@ -0,0 +1,108 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the MRP round-trip time estimator.
+ */
+
+#include <messaging/ReliableMessageProtocolConfig.h>
+
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+void TestFallbackBeforeFirstSample(nlTestSuite * inSuite, void * inContext)
+{
+    PeerRttEstimator estimator;
+
+    NL_TEST_ASSERT(inSuite, !estimator.HasEstimate());
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransTimeout(300_ms32) == 300_ms32);
+}
+
+void TestFastLinkShortensTimeout(nlTestSuite * inSuite, void * inContext)
+{
+    PeerRttEstimator estimator;
+
+    // A steady 10ms link should produce a timeout far below the conservative default.
+    for (int i = 0; i < 10; i++)
+    {
+        estimator.AddSample(10_ms32);
+    }
+
+    NL_TEST_ASSERT(inSuite, estimator.HasEstimate());
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransTimeout(5000_ms32) < 300_ms32);
+    // But never below the clamp floor
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransTimeout(5000_ms32) >= 50_ms32);
+}
+
+void TestSlowLinkLengthensTimeout(nlTestSuite * inSuite, void * inContext)
+{
+    PeerRttEstimator estimator;
+
+    // A slow, jittery link should produce a timeout above the default active interval.
+    for (int i = 0; i < 10; i++)
+    {
+        estimator.AddSample((i % 2 == 0) ? 800_ms32 : 1500_ms32);
+    }
+
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransTimeout(300_ms32) > 300_ms32);
+    // But never above the clamp ceiling
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransTimeout(300_ms32) <= 10000_ms32);
+}
+
+void TestEstimateTracksChange(nlTestSuite * inSuite, void * inContext)
+{
+    PeerRttEstimator estimator;
+
+    for (int i = 0; i < 20; i++)
+    {
+        estimator.AddSample(1000_ms32);
+    }
+    System::Clock::Milliseconds32 slowTimeout = estimator.GetRetransTimeout(300_ms32);
+
+    // After the link improves, the smoothed estimate should decay toward the new RTT.
+    for (int i = 0; i < 20; i++)
+    {
+        estimator.AddSample(20_ms32);
+    }
+
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransTimeout(300_ms32) < slowTimeout);
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("TestFallbackBeforeFirstSample", TestFallbackBeforeFirstSample),
+                          NL_TEST_DEF("TestFastLinkShortensTimeout", TestFastLinkShortensTimeout),
+                          NL_TEST_DEF("TestSlowLinkLengthensTimeout", TestSlowLinkLengthensTimeout),
+                          NL_TEST_DEF("TestEstimateTracksChange", TestEstimateTracksChange), NL_TEST_SENTINEL() };
+
+} // namespace
+
+int TestPeerRttEstimator(void)
+{
+    nlTestSuite theSuite = { "PeerRttEstimator", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestPeerRttEstimator)
@@ -191,6 +191,37 @@ void CheckAddClearRetrans(nlTestSuite * inSuite, void * inContext)
     exchange->Close();
 }
 
+void CheckDeferRetransmission(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    MockAppDelegate mockAppDelegate;
+    ExchangeContext * exchange = ctx.NewExchangeToAlice(&mockAppDelegate);
+    NL_TEST_ASSERT(inSuite, exchange != nullptr);
+
+    ReliableMessageMgr * rm     = ctx.GetExchangeManager().GetReliableMessageMgr();
+    ReliableMessageContext * rc = exchange->GetReliableMessageContext();
+    NL_TEST_ASSERT(inSuite, rm != nullptr);
+    NL_TEST_ASSERT(inSuite, rc != nullptr);
+
+    ReliableMessageMgr::RetransTableEntry * entry;
+    rm->AddToRetransTable(rc, &entry);
+    rm->StartRetransmision(entry);
+
+    // A Busy retry hint pushes the pending retransmission out to at least
+    // now + hint, and never moves it earlier.
+    const System::Clock::Timestamp before = System::SystemClock().GetMonotonicTimestamp();
+    rm->DeferRetransmission(rc, System::Clock::Milliseconds32(60000));
+    const System::Clock::Timestamp deferredTime = entry->nextRetransTime;
+    NL_TEST_ASSERT(inSuite, deferredTime >= before + System::Clock::Milliseconds32(60000));
+
+    rm->DeferRetransmission(rc, System::Clock::Milliseconds32(1));
+    NL_TEST_ASSERT(inSuite, entry->nextRetransTime == deferredTime);
+
+    rm->ClearRetransTable(*entry);
+    exchange->Close();
+}
+
 void CheckResendApplicationMessage(nlTestSuite * inSuite, void * inContext)
 {
     TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
@@ -1372,6 +1403,7 @@ void CheckLostStandaloneAck(nlTestSuite * inSuite, void * inContext)
 const nlTest sTests[] =
 {
     NL_TEST_DEF("Test ReliableMessageMgr::CheckAddClearRetrans", CheckAddClearRetrans),
+    NL_TEST_DEF("Test ReliableMessageMgr::CheckDeferRetransmission", CheckDeferRetransmission),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckResendApplicationMessage", CheckResendApplicationMessage),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckCloseExchangeAndResendApplicationMessage", CheckCloseExchangeAndResendApplicationMessage),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckFailedMessageRetainOnSend", CheckFailedMessageRetainOnSend),
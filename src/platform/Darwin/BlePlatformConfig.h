@@ -28,4 +28,9 @@
 
 // ========== Platform-specific Configuration Overrides =========
 
-/* none so far */
+// Hosts that run the device controller commission several BLE devices
+// concurrently, so give each its own BTP endpoint.  Peripheral-only
+// embedded platforms keep the default of 1.
+#ifndef BLE_LAYER_NUM_BLE_ENDPOINTS
+#define BLE_LAYER_NUM_BLE_ENDPOINTS 4
+#endif // BLE_LAYER_NUM_BLE_ENDPOINTS
@@ -181,7 +181,7 @@ private:
 
     enum
     {
-        kMaxConnections             = 1,  // TODO: right max connection
+        kMaxConnections             = BLE_LAYER_NUM_BLE_ENDPOINTS,
         kMaxDeviceNameLength        = 20, // TODO: right-size this
         kMaxAdvertismentDataSetSize = 31  // TODO: verify this
     };
@@ -147,6 +147,38 @@ static void TestPlatformMgr_RunEventLoopStopBeforeSleep(nlTestSuite * inSuite, v
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
 }
 
+static bool backgroundWorkRan;
+
+static void BackgroundWork(intptr_t)
+{
+    // May run on a worker thread or (with a pool size of zero) on the event
+    // loop; either way the completion is posted back to the loop.
+    backgroundWorkRan = true;
+    PlatformMgr().ScheduleWork(StopTheLoop);
+}
+
+static void TestPlatformMgr_ScheduleBackgroundWork(nlTestSuite * inSuite, void * inContext)
+{
+    stopRan           = false;
+    backgroundWorkRan = false;
+
+    CHIP_ERROR err = PlatformMgr().InitChipStack();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = PlatformMgr().ScheduleBackgroundWork(BackgroundWork);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = PlatformMgr().ScheduleBackgroundWork(nullptr);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INVALID_ARGUMENT);
+
+    PlatformMgr().RunEventLoop();
+    NL_TEST_ASSERT(inSuite, backgroundWorkRan);
+    NL_TEST_ASSERT(inSuite, stopRan);
+
+    err = PlatformMgr().Shutdown();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+}
+
 static void TestPlatformMgr_TryLockChipStack(nlTestSuite * inSuite, void * inContext)
 {
     bool locked = PlatformMgr().TryLockChipStack();
@@ -222,6 +254,7 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test basic PlatformMgr::RunEventLoop", TestPlatformMgr_BasicRunEventLoop),
     NL_TEST_DEF("Test PlatformMgr::RunEventLoop with two tasks", TestPlatformMgr_RunEventLoopTwoTasks),
     NL_TEST_DEF("Test PlatformMgr::RunEventLoop with stop before sleep", TestPlatformMgr_RunEventLoopStopBeforeSleep),
+    NL_TEST_DEF("Test PlatformMgr::ScheduleBackgroundWork", TestPlatformMgr_ScheduleBackgroundWork),
     NL_TEST_DEF("Test PlatformMgr::TryLockChipStack", TestPlatformMgr_TryLockChipStack),
     NL_TEST_DEF("Test PlatformMgr::AddEventHandler", TestPlatformMgr_AddEventHandler),
     NL_TEST_DEF("Test mock System::Layer", TestPlatformMgr_MockSystemLayer),
@@ -1,7 +1,8 @@
 /**
  *    @file
  *      Implementation for the TransferSession class.
- *      // TODO: Support Asynchronous mode. Currently, only Synchronous mode is supported.
+ *      In Async transfer control mode the sender pipelines up to kMaxBlocksInFlight Blocks, with cumulative BlockAcks
+ *      opening the window, so throughput scales with available bandwidth rather than one block per round trip.
  */
 
 #include <protocols/bdx/BdxTransferSession.h>
@@ -250,7 +251,9 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
 
     mState = TransferState::kTransferInProgress;
 
-    if ((mRole == TransferRole::kReceiver && mControlMode == TransferControlFlags::kSenderDrive) ||
+    // In Async mode the receiver passively awaits Blocks, just as it does in Sender Drive.
+    if ((mRole == TransferRole::kReceiver &&
+         (mControlMode == TransferControlFlags::kSenderDrive || mControlMode == TransferControlFlags::kAsync)) ||
         (mRole == TransferRole::kSender && mControlMode == TransferControlFlags::kReceiverDrive))
     {
         mAwaitingResponse = true;
@@ -321,7 +324,15 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
     VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mRole == TransferRole::kSender, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        // Blocks are pipelined in Async mode: more may be prepared as long as the send window has room.
+        VerifyOrReturnError(mNumBlocksInFlight < kMaxBlocksInFlight, CHIP_ERROR_INCORRECT_STATE);
+    }
+    else
+    {
+        VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    }
 
     // Verify non-zero data is provided and is no longer than MaxBlockSize (BlockEOF may contain 0 length data)
     VerifyOrReturnError((inData.Data != nullptr) && (inData.Length <= mTransferMaxBlockSize), CHIP_ERROR_INVALID_ARGUMENT);
@@ -345,8 +356,17 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
         mState = TransferState::kAwaitingEOFAck;
     }
 
-    mAwaitingResponse = true;
-    mLastBlockNum     = mNextBlockNum++;
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        mNumBlocksInFlight++;
+        // Only stop and wait for the peer when the window is exhausted or the final ack is outstanding.
+        mAwaitingResponse = (msgType == MessageType::BlockEOF) || (mNumBlocksInFlight == kMaxBlocksInFlight);
+    }
+    else
+    {
+        mAwaitingResponse = true;
+    }
+    mLastBlockNum = mNextBlockNum++;
 
     PrepareOutgoingMessageEvent(msgType, mPendingOutput, mMsgTypeData);
 
@@ -403,6 +423,78 @@ CHIP_ERROR TransferSession::AbortTransfer(StatusCode reason)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TransferSession::StartIncrementalDigest(uint32_t checkpointEveryNBlocks)
+{
+    VerifyOrReturnError(checkpointEveryNBlocks > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(mBlockDigest.Begin());
+    mDigestCheckpointInterval = checkpointEveryNBlocks;
+    mBlocksSinceCheckpoint    = 0;
+    mNumBytesDigested         = 0;
+    mDigestCheckpointValid    = false;
+    mFinalDigestReady         = false;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TransferSession::ResumeIncrementalDigest(const DigestCheckpoint & checkpoint, uint32_t checkpointEveryNBlocks)
+{
+    VerifyOrReturnError(checkpointEveryNBlocks > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mBlockDigest              = checkpoint.Hash;
+    mDigestCheckpointInterval = checkpointEveryNBlocks;
+    mBlocksSinceCheckpoint    = 0;
+    mNumBytesDigested         = checkpoint.Offset;
+    mDigestCheckpoint         = checkpoint;
+    mDigestCheckpointValid    = true;
+    mFinalDigestReady         = false;
+    return CHIP_NO_ERROR;
+}
+
+bool TransferSession::GetDigestCheckpoint(DigestCheckpoint & outCheckpoint) const
+{
+    VerifyOrReturnError(mDigestCheckpointValid, false);
+    outCheckpoint = mDigestCheckpoint;
+    return true;
+}
+
+CHIP_ERROR TransferSession::GetFinalDigest(MutableByteSpan & outDigest)
+{
+    VerifyOrReturnError(mFinalDigestReady, CHIP_ERROR_INCORRECT_STATE);
+    return CopySpanToMutableSpan(ByteSpan(mFinalDigest), outDigest);
+}
+
+void TransferSession::UpdateBlockDigest(const uint8_t * data, size_t length, bool isEof)
+{
+    VerifyOrReturn(mDigestCheckpointInterval > 0);
+
+    CHIP_ERROR err = mBlockDigest.AddData(ByteSpan(data, length));
+    if (err != CHIP_NO_ERROR)
+    {
+        // A hash failure must not fail the transfer itself; the caller will notice the
+        // missing final digest and fall back to whole-image verification.
+        ChipLogError(BDX, "Incremental digest update failed: %" CHIP_ERROR_FORMAT, err.Format());
+        mDigestCheckpointInterval = 0;
+        return;
+    }
+    mNumBytesDigested += length;
+
+    if (isEof)
+    {
+        MutableByteSpan digest(mFinalDigest);
+        err               = mBlockDigest.Finish(digest);
+        mFinalDigestReady = (err == CHIP_NO_ERROR);
+        return;
+    }
+
+    if (++mBlocksSinceCheckpoint >= mDigestCheckpointInterval)
+    {
+        mBlocksSinceCheckpoint   = 0;
+        mDigestCheckpoint.Hash   = mBlockDigest;
+        mDigestCheckpoint.Offset = mNumBytesDigested;
+        mDigestCheckpointValid   = true;
+    }
+}
+
 void TransferSession::Reset()
 {
     mPendingOutput = OutputEventType::kNone;
@@ -421,11 +513,19 @@ void TransferSession::Reset()
     mNextBlockNum      = 0;
     mLastQueryNum      = 0;
     mNextQueryNum      = 0;
+    mNumBlocksInFlight = 0;
 
     mTimeout                = System::Clock::kZero;
     mTimeoutStartTime       = System::Clock::kZero;
     mShouldInitTimeoutStart = true;
     mAwaitingResponse       = false;
+
+    mBlockDigest.Clear();
+    mDigestCheckpointInterval = 0;
+    mBlocksSinceCheckpoint    = 0;
+    mNumBytesDigested         = 0;
+    mDigestCheckpointValid    = false;
+    mFinalDigestReady         = false;
 }
 
 CHIP_ERROR TransferSession::HandleMessageReceived(const PayloadHeader & payloadHeader, System::PacketBufferHandle msg,
@@ -598,7 +698,8 @@ void TransferSession::HandleReceiveAccept(System::PacketBufferHandle msgData)
     mPendingMsgHandle = std::move(msgData);
     mPendingOutput    = OutputEventType::kAcceptReceived;
 
-    mAwaitingResponse = (mControlMode == TransferControlFlags::kSenderDrive);
+    // In Async mode the receiver passively awaits Blocks, just as it does in Sender Drive.
+    mAwaitingResponse = (mControlMode == TransferControlFlags::kSenderDrive || mControlMode == TransferControlFlags::kAsync);
     mState            = TransferState::kTransferInProgress;
 
 #if CHIP_AUTOMATION_LOGGING
@@ -716,7 +817,18 @@ void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
     mNumBytesProcessed += blockMsg.DataLength;
     mLastBlockNum = blockMsg.BlockCounter;
 
-    mAwaitingResponse = false;
+    UpdateBlockDigest(blockMsg.Data, blockMsg.DataLength, /* isEof = */ false);
+
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        // No queries are sent in Async mode: keep awaiting in-order Blocks, tracking the next expected counter in mLastQueryNum.
+        mLastQueryNum     = blockMsg.BlockCounter + 1;
+        mAwaitingResponse = true;
+    }
+    else
+    {
+        mAwaitingResponse = false;
+    }
 
 #if CHIP_AUTOMATION_LOGGING
     blockMsg.LogMessage(MessageType::Block);
@@ -747,6 +859,8 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
     mNumBytesProcessed += blockEOFMsg.DataLength;
     mLastBlockNum = blockEOFMsg.BlockCounter;
 
+    UpdateBlockDigest(blockEOFMsg.Data, blockEOFMsg.DataLength, /* isEof = */ true);
+
     mAwaitingResponse = false;
     mState            = TransferState::kReceivedEOF;
 
@@ -759,18 +873,34 @@ void TransferSession::HandleBlockAck(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     BlockAck ackMsg;
     const CHIP_ERROR err = ackMsg.Parse(std::move(msgData));
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
-    VerifyOrReturn(ackMsg.BlockCounter == mLastBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
 
-    mPendingOutput = OutputEventType::kAckReceived;
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        // Acks are cumulative in Async mode: receipt of counter N means every Block up to N arrived, so the window opens by
+        // however many Blocks the ack covers. A stale duplicate ack is ignored rather than shrinking the window.
+        VerifyOrReturn(ackMsg.BlockCounter < mNextBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+        const uint32_t stillInFlight = mNextBlockNum - ackMsg.BlockCounter - 1;
+        if (stillInFlight < mNumBlocksInFlight)
+        {
+            mNumBlocksInFlight = stillInFlight;
+        }
+        mAwaitingResponse = false;
+    }
+    else
+    {
+        VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+        VerifyOrReturn(ackMsg.BlockCounter == mLastBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
 
-    // In Receiver Drive, the Receiver can send a BlockAck to indicate receipt of the message and reset the timeout.
-    // In this case, the Sender should wait to receive a BlockQuery next.
-    mAwaitingResponse = (mControlMode == TransferControlFlags::kReceiverDrive);
+        // In Receiver Drive, the Receiver can send a BlockAck to indicate receipt of the message and reset the timeout.
+        // In this case, the Sender should wait to receive a BlockQuery next.
+        mAwaitingResponse = (mControlMode == TransferControlFlags::kReceiverDrive);
+    }
+
+    mPendingOutput = OutputEventType::kAckReceived;
 
 #if CHIP_AUTOMATION_LOGGING
     ackMsg.LogMessage(MessageType::BlockAck);
@@ -801,9 +931,9 @@ void TransferSession::HandleBlockAckEOF(System::PacketBufferHandle msgData)
 
 void TransferSession::ResolveTransferControlOptions(const BitFlags<TransferControlFlags> & proposed)
 {
-    // Must specify at least one synchronous option
+    // Must specify at least one supported transfer mode
     //
-    if (!proposed.HasAny(TransferControlFlags::kSenderDrive, TransferControlFlags::kReceiverDrive))
+    if (!proposed.HasAny(TransferControlFlags::kSenderDrive, TransferControlFlags::kReceiverDrive, TransferControlFlags::kAsync))
     {
         PrepareStatusReport(StatusCode::kTransferMethodNotSupported);
         return;
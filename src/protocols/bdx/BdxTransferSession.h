@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/CHIPError.h>
 #include <protocols/bdx/BdxMessages.h>
 #include <system/SystemPacketBuffer.h>
@@ -26,6 +27,14 @@ enum class TransferRole : uint8_t
 class DLL_EXPORT TransferSession
 {
 public:
+    /**
+     * In Async transfer control mode the sender may pipeline up to this many Block
+     * messages before it must stop and wait for a (cumulative) BlockAck from the
+     * receiver, so throughput over a high-latency link is no longer limited to one
+     * block per round trip.
+     */
+    static constexpr uint32_t kMaxBlocksInFlight = 8;
+
     enum class OutputEventType : uint16_t
     {
         kNone = 0,
@@ -105,6 +114,21 @@ public:
         uint64_t BytesToSkip = 0;
     };
 
+    /**
+     * @brief
+     *   A snapshot of incremental digest progress over received Block data.
+     *
+     *   The struct is plain data (Hash_SHA256_stream is safely copyable), so callers may
+     *   persist it verbatim and restore it after a reboot.  Offset is the number of image
+     *   bytes hashed when the snapshot was taken; on resume it is the StartOffset to
+     *   request from the sender before seeding the session with ResumeIncrementalDigest().
+     */
+    struct DigestCheckpoint
+    {
+        Crypto::Hash_SHA256_stream Hash;
+        uint64_t Offset = 0;
+    };
+
     /**
      * @brief
      *   All output data processed by the TransferSession object will be passed to the caller using this struct via PollOutput().
@@ -244,6 +268,9 @@ public:
      * @brief
      *   Prepare a Block message. The Block counter will be populated automatically.
      *
+     *   In Async transfer control mode, up to kMaxBlocksInFlight Blocks may be prepared without waiting for a BlockAck from the
+     *   peer; once the window is full this method will return an error until an ack is received.
+     *
      * @param inData Contains data for filling out the Block message
      *
      * @return CHIP_ERROR The result of the preparation of a Block message. May also indicate if the TransferSession object
@@ -255,6 +282,9 @@ public:
      * @brief
      *   Prepare a BlockAck message. The Block counter will be populated automatically.
      *
+     *   In Async transfer control mode the ack is cumulative: it acknowledges every Block up to and including the last one
+     *   received, and opens the sender's window by the same amount.
+     *
      * @return CHIP_ERROR The result of the preparation of a BlockAck message. May also indicate if the TransferSession object
      *                    is unable to handle this request.
      */
@@ -271,6 +301,48 @@ public:
      */
     CHIP_ERROR AbortTransfer(StatusCode reason);
 
+    /**
+     * @brief
+     *   Start computing a running SHA-256 digest over received Block payloads (receiver
+     *   role only).  The digest is updated as each Block is handled, so verification
+     *   completes with the last block instead of requiring a full re-read of the image,
+     *   and a checkpoint is snapshotted every checkpointEveryNBlocks blocks for the
+     *   caller to persist (see GetDigestCheckpoint()).
+     *
+     * @param checkpointEveryNBlocks How many Blocks to hash between checkpoint snapshots.
+     *
+     * @return CHIP_ERROR May indicate an invalid interval or a failure to initialize the
+     *                    underlying hash context.
+     */
+    CHIP_ERROR StartIncrementalDigest(uint32_t checkpointEveryNBlocks);
+
+    /**
+     * @brief
+     *   Seed the incremental digest from a previously persisted checkpoint, for a
+     *   transfer restarted with StartOffset equal to the checkpoint's Offset.
+     *
+     * @param checkpoint             The checkpoint to resume from.
+     * @param checkpointEveryNBlocks How many Blocks to hash between checkpoint snapshots.
+     */
+    CHIP_ERROR ResumeIncrementalDigest(const DigestCheckpoint & checkpoint, uint32_t checkpointEveryNBlocks);
+
+    /**
+     * @brief
+     *   Copy out the most recent digest checkpoint, if one has been taken.
+     *
+     * @return true if outCheckpoint was filled out, false if no checkpoint exists yet.
+     */
+    bool GetDigestCheckpoint(DigestCheckpoint & outCheckpoint) const;
+
+    /**
+     * @brief
+     *   Obtain the final SHA-256 digest of the received image.  Only valid after the
+     *   BlockEOF has been handled with the incremental digest enabled.
+     *
+     * @param outDigest Receives the digest; must be at least kSHA256_Hash_Length bytes.
+     */
+    CHIP_ERROR GetFinalDigest(MutableByteSpan & outDigest);
+
     /**
      * @brief
      *   Reset all TransferSession parameters. The TransferSession object must then be re-initialized with StartTransfer() or
@@ -344,6 +416,13 @@ private:
     void PrepareStatusReport(StatusCode code);
     bool IsTransferLengthDefinite();
 
+    /**
+     * @brief
+     *   Fold one received Block payload into the incremental digest, taking a checkpoint
+     *   or finalizing the digest as appropriate.  No-op unless digesting is enabled.
+     */
+    void UpdateBlockDigest(const uint8_t * data, size_t length, bool isEof);
+
     OutputEventType mPendingOutput = OutputEventType::kNone;
     TransferState mState           = TransferState::kUnitialized;
     TransferRole mRole;
@@ -375,10 +454,23 @@ private:
     uint32_t mLastQueryNum = 0;
     uint32_t mNextQueryNum = 0;
 
+    // Number of Blocks sent but not yet acknowledged. Only used in Async mode.
+    uint32_t mNumBlocksInFlight = 0;
+
     System::Clock::Timeout mTimeout            = System::Clock::kZero;
     System::Clock::Timestamp mTimeoutStartTime = System::Clock::kZero;
     bool mShouldInitTimeoutStart               = true;
     bool mAwaitingResponse                     = false;
+
+    // Incremental digest over received Block payloads (receiver role only).
+    Crypto::Hash_SHA256_stream mBlockDigest;
+    DigestCheckpoint mDigestCheckpoint;
+    uint32_t mDigestCheckpointInterval = 0; ///< Blocks between checkpoints; 0 means digesting is disabled
+    uint32_t mBlocksSinceCheckpoint    = 0;
+    uint64_t mNumBytesDigested         = 0;
+    bool mDigestCheckpointValid        = false;
+    bool mFinalDigestReady             = false;
+    uint8_t mFinalDigest[Crypto::kSHA256_Hash_Length];
 };
 
 } // namespace bdx
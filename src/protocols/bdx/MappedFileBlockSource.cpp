@@ -0,0 +1,98 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/bdx/MappedFileBlockSource.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace chip {
+namespace bdx {
+
+CHIP_ERROR MappedFileBlockSource::Open(const char * filepath)
+{
+    VerifyOrReturnError(filepath != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!IsOpen(), CHIP_ERROR_INCORRECT_STATE);
+
+    int fd = open(filepath, O_RDONLY);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_OPEN_FAILED);
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size < 0)
+    {
+        close(fd);
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+
+    void * mapped = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping holds its own reference to the file; the descriptor is no longer needed.
+    close(fd);
+    VerifyOrReturnError(mapped != MAP_FAILED, CHIP_ERROR_OPEN_FAILED);
+
+    // Let the kernel read ahead aggressively: blocks are served strictly in file order.
+    madvise(mapped, static_cast<size_t>(fileStat.st_size), MADV_SEQUENTIAL);
+
+    mMappedData = static_cast<const uint8_t *>(mapped);
+    mFileLength = static_cast<uint64_t>(fileStat.st_size);
+
+    return CHIP_NO_ERROR;
+}
+
+void MappedFileBlockSource::Close()
+{
+    if (mMappedData != nullptr)
+    {
+        munmap(const_cast<uint8_t *>(mMappedData), static_cast<size_t>(mFileLength));
+        mMappedData = nullptr;
+        mFileLength = 0;
+    }
+}
+
+CHIP_ERROR MappedFileBlockSource::GetBlock(uint64_t offset, uint16_t maxBlockSize, TransferSession::BlockData & blockData)
+{
+    VerifyOrReturnError(IsOpen(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(offset <= mFileLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const uint64_t remaining = mFileLength - offset;
+    const size_t blockLength = (remaining < maxBlockSize) ? static_cast<size_t>(remaining) : maxBlockSize;
+
+    blockData.Data   = mMappedData + offset;
+    blockData.Length = blockLength;
+    blockData.IsEof  = (offset + blockLength == mFileLength);
+
+    // Prefetch the region after this block so upcoming requests do not fault synchronously. madvise requires a
+    // page-aligned address, so round the prefetch start down to a page boundary.
+    const uint64_t prefetchStart = offset + blockLength;
+    if (prefetchStart < mFileLength)
+    {
+        const size_t pageSize      = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const uint64_t alignedOff  = prefetchStart & ~static_cast<uint64_t>(pageSize - 1);
+        const uint64_t prefetchLen = ::chip::min(static_cast<uint64_t>(kPrefetchBytes), mFileLength - alignedOff);
+        madvise(const_cast<uint8_t *>(mMappedData + alignedOff), static_cast<size_t>(prefetchLen), MADV_WILLNEED);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+} // namespace bdx
+} // namespace chip
@@ -0,0 +1,88 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *   This file defines a memory-mapped file source for BDX senders on POSIX platforms. It serves TransferSession::BlockData
+ *   directly from the mapped image, so block-serving callers (e.g. an OTA provider) avoid per-block file I/O and intermediate
+ *   read buffers.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <protocols/bdx/BdxTransferSession.h>
+
+namespace chip {
+namespace bdx {
+
+/**
+ * Maps a file (such as an OTA image) into memory and hands out BlockData entries that point directly into the mapped pages.
+ *
+ * The mapping is advised for sequential access so the kernel reads ahead of the transfer, and each block request prefetches the
+ * region following it, keeping page faults off the block-serving path. Block pointers remain valid until Close() is called, which
+ * is long enough for TransferSession::PrepareBlock() to serialize the Block message.
+ */
+class MappedFileBlockSource
+{
+public:
+    MappedFileBlockSource() = default;
+    ~MappedFileBlockSource() { Close(); }
+
+    // Not copyable: the destructor unmaps the file.
+    MappedFileBlockSource(const MappedFileBlockSource &) = delete;
+    MappedFileBlockSource & operator=(const MappedFileBlockSource &) = delete;
+
+    /**
+     * Map the given file read-only and prepare to serve blocks from it.
+     *
+     * @retval #CHIP_ERROR_INCORRECT_STATE if a file is already open.
+     * @retval #CHIP_ERROR_OPEN_FAILED if the file cannot be opened or mapped.
+     */
+    CHIP_ERROR Open(const char * filepath);
+
+    /**
+     * Unmap the file. Any BlockData previously handed out becomes invalid.
+     */
+    void Close();
+
+    bool IsOpen() const { return mMappedData != nullptr; }
+
+    /**
+     * Length of the mapped file in bytes.
+     */
+    uint64_t GetLength() const { return mFileLength; }
+
+    /**
+     * Fill out @a blockData with a pointer into the mapped file at @a offset, covering at most @a maxBlockSize bytes.
+     * IsEof is set when the block reaches the end of the file. The BlockCounter field is left for the caller.
+     *
+     * @retval #CHIP_ERROR_INCORRECT_STATE if no file is open.
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT if @a offset is past the end of the file.
+     */
+    CHIP_ERROR GetBlock(uint64_t offset, uint16_t maxBlockSize, TransferSession::BlockData & blockData);
+
+private:
+    // How far beyond the requested block to encourage the kernel to read ahead.
+    static constexpr size_t kPrefetchBytes = 256 * 1024;
+
+    const uint8_t * mMappedData = nullptr;
+    uint64_t mFileLength        = 0;
+};
+
+} // namespace bdx
+} // namespace chip
@@ -6,6 +6,7 @@
 
 #include <nlunit-test.h>
 
+#include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/CHIPTLV.h>
 #include <lib/support/BufferReader.h>
 #include <lib/support/CHIPMem.h>
@@ -523,6 +524,88 @@ void TestInitiatingSenderSenderDrive(nlTestSuite * inSuite, void * inContext)
     SendAndVerifyBlockAck(inSuite, inContext, initiatingSender, respondingReceiver, outEvent, true);
 }
 
+// Test Async mode: multiple Blocks may be pipelined without waiting for per-block acks, a single BlockAck is cumulative, and
+// the send window is bounded by kMaxBlocksInFlight.
+void TestAsyncModeWindowedTransfer(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingSender;
+    TransferSession respondingReceiver;
+
+    TransferControlFlags driveMode = TransferControlFlags::kAsync;
+
+    // Chosen arbitrarily for this test
+    uint16_t transferBlockSize     = 10;
+    System::Clock::Timeout timeout = System::Clock::Seconds16(24);
+
+    // Initialize respondingReceiver
+    BitFlags<TransferControlFlags> receiverOpts;
+    receiverOpts.Set(driveMode);
+
+    // Initialize struct with TransferInit parameters
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = driveMode;
+    initOptions.MaxBlockSize     = transferBlockSize;
+    char testFileDes[9]          = { "test.txt" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+
+    SendAndVerifyTransferInit(inSuite, inContext, outEvent, timeout, initiatingSender, TransferRole::kSender, initOptions,
+                              respondingReceiver, receiverOpts, transferBlockSize);
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode    = respondingReceiver.GetControlMode();
+    acceptData.MaxBlockSize   = transferBlockSize;
+    acceptData.StartOffset    = 0; // not used in SendAccept
+    acceptData.Length         = 0; // not used in SendAccept
+    acceptData.Metadata       = nullptr;
+    acceptData.MetadataLength = 0;
+
+    SendAndVerifyAcceptMsg(inSuite, inContext, outEvent, respondingReceiver, TransferRole::kReceiver, acceptData, initiatingSender,
+                           initOptions);
+
+    NL_TEST_ASSERT(inSuite, initiatingSender.GetControlMode() == TransferControlFlags::kAsync);
+
+    // Verify that several Blocks can be prepared back-to-back without any intervening BlockAck
+    uint32_t numBlocksSent = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        SendAndVerifyArbitraryBlock(inSuite, inContext, initiatingSender, respondingReceiver, outEvent, false, numBlocksSent);
+        numBlocksSent++;
+    }
+
+    // A single BlockAck is cumulative and acknowledges all three Blocks
+    SendAndVerifyBlockAck(inSuite, inContext, initiatingSender, respondingReceiver, outEvent, false);
+
+    // Fill the entire send window, then verify that one more Block cannot be prepared until an ack arrives
+    for (uint32_t i = 0; i < TransferSession::kMaxBlocksInFlight; i++)
+    {
+        SendAndVerifyArbitraryBlock(inSuite, inContext, initiatingSender, respondingReceiver, outEvent, false, numBlocksSent);
+        numBlocksSent++;
+    }
+
+    System::PacketBufferHandle fakeBuf = System::PacketBufferHandle::New(transferBlockSize);
+    TransferSession::BlockData windowFullBlock;
+    if (fakeBuf.IsNull())
+    {
+        NL_TEST_ASSERT(inSuite, false);
+        return;
+    }
+    windowFullBlock.Data   = fakeBuf->Start();
+    windowFullBlock.Length = transferBlockSize;
+    windowFullBlock.IsEof  = false;
+    err                    = initiatingSender.PrepareBlock(windowFullBlock);
+    NL_TEST_ASSERT(inSuite, err != CHIP_NO_ERROR);
+    VerifyNoMoreOutput(inSuite, inContext, initiatingSender);
+
+    // A cumulative ack reopens the window
+    SendAndVerifyBlockAck(inSuite, inContext, initiatingSender, respondingReceiver, outEvent, false);
+
+    SendAndVerifyArbitraryBlock(inSuite, inContext, initiatingSender, respondingReceiver, outEvent, true, numBlocksSent);
+    SendAndVerifyBlockAck(inSuite, inContext, initiatingSender, respondingReceiver, outEvent, true);
+}
+
 // Test that calls to AcceptTransfer() with bad parameters result in an error.
 void TestBadAcceptMessageFields(nlTestSuite * inSuite, void * inContext)
 {
@@ -724,6 +807,144 @@ void TestDuplicateBlockError(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+// Test that the receiver's incremental digest over Block payloads matches a digest computed over the whole payload at once, and
+// that a mid-transfer checkpoint can seed a second session that arrives at the same final digest.
+void TestIncrementalDigest(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingReceiver;
+    TransferSession respondingSender;
+
+    constexpr uint16_t blockSize          = 64;
+    constexpr uint32_t numBlocks          = 5;
+    constexpr uint32_t checkpointInterval = 2;
+    System::Clock::Timeout timeout        = System::Clock::Seconds16(24);
+
+    // Chosen specifically for this test
+    TransferControlFlags driveMode = TransferControlFlags::kReceiverDrive;
+
+    // Deterministic payload so the expected digest can be computed locally.
+    uint8_t payload[blockSize * numBlocks];
+    for (size_t i = 0; i < sizeof(payload); i++)
+    {
+        payload[i] = static_cast<uint8_t>(i);
+    }
+
+    uint8_t expectedDigest[Crypto::kSHA256_Hash_Length];
+    err = Crypto::Hash_SHA256(payload, sizeof(payload), expectedDigest);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // ReceiveInit parameters
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = driveMode;
+    initOptions.MaxBlockSize     = blockSize;
+    char testFileDes[9]          = { "test.txt" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+
+    // Initialize respondingSender and pass ReceiveInit message
+    BitFlags<TransferControlFlags> senderOpts;
+    senderOpts.Set(driveMode);
+
+    SendAndVerifyTransferInit(inSuite, inContext, outEvent, timeout, initiatingReceiver, TransferRole::kReceiver, initOptions,
+                              respondingSender, senderOpts, blockSize);
+
+    // Compose ReceiveAccept parameters struct and give to respondingSender
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode    = respondingSender.GetControlMode();
+    acceptData.StartOffset    = 0;
+    acceptData.Length         = 0;
+    acceptData.MaxBlockSize   = blockSize;
+    acceptData.Metadata       = nullptr;
+    acceptData.MetadataLength = 0;
+
+    SendAndVerifyAcceptMsg(inSuite, inContext, outEvent, respondingSender, TransferRole::kSender, acceptData, initiatingReceiver,
+                           initOptions);
+
+    err = initiatingReceiver.StartIncrementalDigest(checkpointInterval);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // No checkpoint exists until checkpointInterval blocks have been hashed, and no final digest until BlockEOF.
+    TransferSession::DigestCheckpoint checkpoint;
+    NL_TEST_ASSERT(inSuite, initiatingReceiver.GetDigestCheckpoint(checkpoint) == false);
+
+    for (uint32_t blockNum = 0; blockNum < numBlocks; blockNum++)
+    {
+        bool isEof = (blockNum == numBlocks - 1);
+
+        SendAndVerifyQuery(inSuite, inContext, respondingSender, initiatingReceiver, outEvent);
+
+        TransferSession::BlockData blockData;
+        blockData.Data   = &payload[blockNum * blockSize];
+        blockData.Length = blockSize;
+        blockData.IsEof  = isEof;
+
+        err = respondingSender.PrepareBlock(blockData);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+        VerifyBdxMessageToSend(inSuite, inContext, outEvent, isEof ? MessageType::BlockEOF : MessageType::Block);
+        VerifyNoMoreOutput(inSuite, inContext, respondingSender);
+
+        err = AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), initiatingReceiver);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        initiatingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+        NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kBlockReceived);
+        VerifyNoMoreOutput(inSuite, inContext, initiatingReceiver);
+    }
+
+    // The final digest must match one computed over the whole payload at once.
+    uint8_t digest[Crypto::kSHA256_Hash_Length];
+    MutableByteSpan digestSpan(digest);
+    err = initiatingReceiver.GetFinalDigest(digestSpan);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, digestSpan.size() == sizeof(expectedDigest));
+    NL_TEST_ASSERT(inSuite, !memcmp(digestSpan.data(), expectedDigest, sizeof(expectedDigest)));
+
+    // The last checkpoint covers the largest multiple of checkpointInterval blocks completed before the BlockEOF.
+    NL_TEST_ASSERT(inSuite, initiatingReceiver.GetDigestCheckpoint(checkpoint) == true);
+    NL_TEST_ASSERT(inSuite, checkpoint.Offset == static_cast<uint64_t>(4) * blockSize);
+
+    // Start a second transfer pair resuming at the checkpoint offset and verify it converges on the same final digest.
+    TransferSession resumingReceiver;
+    TransferSession resumingSender;
+
+    SendAndVerifyTransferInit(inSuite, inContext, outEvent, timeout, resumingReceiver, TransferRole::kReceiver, initOptions,
+                              resumingSender, senderOpts, blockSize);
+
+    acceptData.StartOffset = checkpoint.Offset;
+
+    SendAndVerifyAcceptMsg(inSuite, inContext, outEvent, resumingSender, TransferRole::kSender, acceptData, resumingReceiver,
+                           initOptions);
+
+    err = resumingReceiver.ResumeIncrementalDigest(checkpoint, checkpointInterval);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    SendAndVerifyQuery(inSuite, inContext, resumingSender, resumingReceiver, outEvent);
+
+    TransferSession::BlockData lastBlock;
+    lastBlock.Data   = &payload[checkpoint.Offset];
+    lastBlock.Length = sizeof(payload) - static_cast<size_t>(checkpoint.Offset);
+    lastBlock.IsEof  = true;
+
+    err = resumingSender.PrepareBlock(lastBlock);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    resumingSender.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyBdxMessageToSend(inSuite, inContext, outEvent, MessageType::BlockEOF);
+    VerifyNoMoreOutput(inSuite, inContext, resumingSender);
+
+    err = AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), resumingReceiver);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    resumingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kBlockReceived);
+    VerifyNoMoreOutput(inSuite, inContext, resumingReceiver);
+
+    MutableByteSpan resumedDigestSpan(digest);
+    err = resumingReceiver.GetFinalDigest(resumedDigestSpan);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !memcmp(resumedDigestSpan.data(), expectedDigest, sizeof(expectedDigest)));
+}
+
 // Test Suite
 
 /**
@@ -734,9 +955,11 @@ static const nlTest sTests[] =
 {
     NL_TEST_DEF("TestInitiatingReceiverReceiverDrive", TestInitiatingReceiverReceiverDrive),
     NL_TEST_DEF("TestInitiatingSenderSenderDrive", TestInitiatingSenderSenderDrive),
+    NL_TEST_DEF("TestAsyncModeWindowedTransfer", TestAsyncModeWindowedTransfer),
     NL_TEST_DEF("TestBadAcceptMessageFields", TestBadAcceptMessageFields),
     NL_TEST_DEF("TestTimeout", TestTimeout),
     NL_TEST_DEF("TestDuplicateBlockError", TestDuplicateBlockError),
+    NL_TEST_DEF("TestIncrementalDigest", TestIncrementalDigest),
     NL_TEST_SENTINEL()
 };
 // clang-format on
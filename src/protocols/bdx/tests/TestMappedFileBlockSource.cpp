@@ -0,0 +1,114 @@
+#include <protocols/bdx/MappedFileBlockSource.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <nlunit-test.h>
+
+#include <lib/support/UnitTestRegistration.h>
+
+using namespace ::chip;
+using namespace ::chip::bdx;
+
+namespace {
+
+constexpr size_t kTestFileSize = 1000;
+
+// Creates a temporary file filled with a predictable byte pattern. Returns false on failure.
+bool CreateTestFile(char * pathBuf, size_t pathBufSize, size_t fileSize)
+{
+    snprintf(pathBuf, pathBufSize, "/tmp/chip_bdx_test_XXXXXX");
+    int fd = mkstemp(pathBuf);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    bool ok = true;
+    for (size_t i = 0; i < fileSize && ok; i++)
+    {
+        uint8_t byte = static_cast<uint8_t>(i & 0xFF);
+        ok           = (write(fd, &byte, 1) == 1);
+    }
+    close(fd);
+    return ok;
+}
+
+void TestOpenAndLength(nlTestSuite * inSuite, void * inContext)
+{
+    char path[64];
+    NL_TEST_ASSERT(inSuite, CreateTestFile(path, sizeof(path), kTestFileSize));
+
+    MappedFileBlockSource source;
+    NL_TEST_ASSERT(inSuite, !source.IsOpen());
+    NL_TEST_ASSERT(inSuite, source.Open(path) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, source.IsOpen());
+    NL_TEST_ASSERT(inSuite, source.GetLength() == kTestFileSize);
+
+    // A second Open without Close should fail
+    NL_TEST_ASSERT(inSuite, source.Open(path) == CHIP_ERROR_INCORRECT_STATE);
+
+    source.Close();
+    NL_TEST_ASSERT(inSuite, !source.IsOpen());
+
+    unlink(path);
+}
+
+void TestOpenMissingFile(nlTestSuite * inSuite, void * inContext)
+{
+    MappedFileBlockSource source;
+    NL_TEST_ASSERT(inSuite, source.Open("/tmp/chip_bdx_test_does_not_exist") == CHIP_ERROR_OPEN_FAILED);
+    NL_TEST_ASSERT(inSuite, !source.IsOpen());
+}
+
+void TestGetBlock(nlTestSuite * inSuite, void * inContext)
+{
+    char path[64];
+    NL_TEST_ASSERT(inSuite, CreateTestFile(path, sizeof(path), kTestFileSize));
+
+    MappedFileBlockSource source;
+    NL_TEST_ASSERT(inSuite, source.Open(path) == CHIP_NO_ERROR);
+
+    constexpr uint16_t blockSize = 256;
+    uint64_t offset              = 0;
+    TransferSession::BlockData blockData;
+
+    // Full-size blocks until the tail of the file
+    while (offset + blockSize < kTestFileSize)
+    {
+        NL_TEST_ASSERT(inSuite, source.GetBlock(offset, blockSize, blockData) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, blockData.Length == blockSize);
+        NL_TEST_ASSERT(inSuite, !blockData.IsEof);
+        NL_TEST_ASSERT(inSuite, blockData.Data != nullptr);
+        NL_TEST_ASSERT(inSuite, blockData.Data[0] == static_cast<uint8_t>(offset & 0xFF));
+        offset += blockData.Length;
+    }
+
+    // Short final block is flagged EOF
+    NL_TEST_ASSERT(inSuite, source.GetBlock(offset, blockSize, blockData) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, blockData.Length == kTestFileSize - offset);
+    NL_TEST_ASSERT(inSuite, blockData.IsEof);
+
+    // An offset past the end of the file is rejected
+    NL_TEST_ASSERT(inSuite, source.GetBlock(kTestFileSize + 1, blockSize, blockData) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    source.Close();
+    unlink(path);
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("TestOpenAndLength", TestOpenAndLength),
+                          NL_TEST_DEF("TestOpenMissingFile", TestOpenMissingFile), NL_TEST_DEF("TestGetBlock", TestGetBlock),
+                          NL_TEST_SENTINEL() };
+
+} // namespace
+
+int TestMappedFileBlockSource(void)
+{
+    nlTestSuite theSuite = { "MappedFileBlockSource", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestMappedFileBlockSource)
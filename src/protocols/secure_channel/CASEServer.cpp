@@ -83,13 +83,76 @@ CHIP_ERROR CASEServer::InitCASEHandshake(Messaging::ExchangeContext * ec)
     return CHIP_NO_ERROR;
 }
 
+// If the initiator requested session resumption and we still have the matching state
+// cached, prime the session with it so the handshake completes with Sigma2Resume (one
+// HKDF) instead of full certificate validation and ECDH.
+CHIP_ERROR CASEServer::TryResumeSession(const System::PacketBufferHandle & payload)
+{
+    TLV::ContiguousBufferTLVReader tlvReader;
+    tlvReader.Init(payload->Start(), payload->DataLength());
+
+    ByteSpan initiatorRandom;
+    uint16_t initiatorSessionId;
+    ByteSpan destinationId;
+    ByteSpan initiatorEphPubKey;
+    bool resumptionRequested = false;
+    ByteSpan resumptionId;
+    ByteSpan initiatorResumeMIC;
+    ReturnErrorOnFailure(GetSession().ParseSigma1(tlvReader, initiatorRandom, initiatorSessionId, destinationId,
+                                                  initiatorEphPubKey, resumptionRequested, resumptionId, initiatorResumeMIC));
+    VerifyOrReturnError(resumptionRequested, CHIP_NO_ERROR);
+    VerifyOrReturnError(resumptionId.size() == kCASEResumptionIDSize, CHIP_ERROR_INVALID_CASE_PARAMETER);
+
+    CASESessionCachable cachedSession;
+    if (mCASESessionCache.Get(ResumptionID(resumptionId.data()), cachedSession) == CHIP_NO_ERROR)
+    {
+        ChipLogProgress(Inet, "CASE Server found cached state for resumption ID, attempting session resumption");
+        ReturnErrorOnFailure(GetSession().FromCachable(cachedSession));
+    }
+    return CHIP_NO_ERROR;
+}
+
+// Structurally validate an unsolicited Sigma1 without committing any handshake
+// state, so malformed floods are rejected before a session ID is allocated or
+// existing PASE pairings are expired.
+CHIP_ERROR CASEServer::ValidateSigma1(const System::PacketBufferHandle & payload)
+{
+    TLV::ContiguousBufferTLVReader tlvReader;
+    tlvReader.Init(payload->Start(), payload->DataLength());
+
+    ByteSpan initiatorRandom;
+    uint16_t initiatorSessionId;
+    ByteSpan destinationId;
+    ByteSpan initiatorEphPubKey;
+    bool resumptionRequested = false;
+    ByteSpan resumptionId;
+    ByteSpan initiatorResumeMIC;
+    return GetSession().ParseSigma1(tlvReader, initiatorRandom, initiatorSessionId, destinationId, initiatorEphPubKey,
+                                    resumptionRequested, resumptionId, initiatorResumeMIC);
+}
+
 CHIP_ERROR CASEServer::OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
                                          System::PacketBufferHandle && payload)
 {
+    // Gate the unsolicited Sigma1 before any handshake state is allocated:
+    // rate-limit per source and reject structurally invalid messages, so a
+    // handshake flood is shed with a table lookup and a payload scan instead
+    // of a full session setup.
+    const SessionHandle sessionHandle = ec->GetSessionHandle();
+    if (!sessionHandle.IsSecure() && !mRateLimiter.ShouldAccept(sessionHandle.GetUnauthenticatedSession()->GetPeerAddress()))
+    {
+        ChipLogProgress(Inet, "CASE Server dropping Sigma1: source exceeded the session establishment rate limit");
+        return CHIP_NO_ERROR;
+    }
+    ReturnErrorOnFailure(ValidateSigma1(payload));
+
     ChipLogProgress(Inet, "CASE Server received Sigma1 message. Starting handshake. EC %p", ec);
     CHIP_ERROR err = InitCASEHandshake(ec);
     SuccessOrExit(err);
 
+    // A failure to prime resumption state is not fatal: fall through to a full handshake.
+    TryResumeSession(payload);
+
     // TODO - Enable multiple concurrent CASE session establishment
     // https://github.com/project-chip/connectedhomeip/issues/8342
     ChipLogProgress(Inet, "CASE Server disabling CASE session setups");
@@ -139,6 +202,14 @@ void CASEServer::OnSessionEstablished()
         return;
     }
 
+    // Cache the established state so the peer can later resume with this session's
+    // resumption ID instead of a full handshake.
+    CASESessionCachable cachableSession;
+    if (GetSession().ToCachable(cachableSession) == CHIP_NO_ERROR)
+    {
+        mCASESessionCache.Add(cachableSession);
+    }
+
     ChipLogProgress(Inet, "CASE secure channel is available now.");
     Cleanup();
 }
@@ -21,6 +21,8 @@
 #include <messaging/ExchangeDelegate.h>
 #include <messaging/ExchangeMgr.h>
 #include <protocols/secure_channel/CASESession.h>
+#include <protocols/secure_channel/CASESessionCache.h>
+#include <protocols/secure_channel/SessionEstablishmentRateLimiter.h>
 #include <protocols/secure_channel/SessionIDAllocator.h>
 
 namespace chip {
@@ -71,6 +73,18 @@ private:
 
     SessionIDAllocator * mIDAllocator = nullptr;
 
+    // Cache of established session state, allowing initiators that present a known
+    // resumption ID in Sigma1 to skip the full sigma handshake.
+    CASESessionCache mCASESessionCache;
+
+    CHIP_ERROR TryResumeSession(const System::PacketBufferHandle & payload);
+
+    CHIP_ERROR ValidateSigma1(const System::PacketBufferHandle & payload);
+
+    // Per-source gate applied to unsolicited Sigma1 messages before any
+    // handshake state is allocated.
+    SessionEstablishmentRateLimiter mRateLimiter;
+
     void Cleanup();
 };
 
@@ -37,6 +37,7 @@
 #include <lib/support/TypeTraits.h>
 #include <protocols/Protocols.h>
 #include <protocols/secure_channel/StatusReport.h>
+#include <system/SystemClock.h>
 #include <system/TLVPacketBufferBackingStore.h>
 #include <transport/PairingSession.h>
 #include <transport/SessionManager.h>
@@ -106,6 +107,8 @@ void CASESession::Clear()
     // It's done so that no security related information will be leaked.
     mCommissioningHash.Clear();
     mCASESessionEstablished = false;
+    mPrecomputedSessionKeys.Reset();
+    mSessionKeysPrecomputed = false;
     PairingSession::Clear();
 
     mState = kInitialized;
@@ -210,7 +213,8 @@ CASESession::ListenForSessionEstablishment(uint16_t localSessionId, FabricTable
 
 CHIP_ERROR CASESession::EstablishSession(const Transport::PeerAddress peerAddress, FabricInfo * fabric, NodeId peerNodeId,
                                          uint16_t localSessionId, ExchangeContext * exchangeCtxt,
-                                         SessionEstablishmentDelegate * delegate, Optional<ReliableMessageProtocolConfig> mrpConfig)
+                                         SessionEstablishmentDelegate * delegate, Optional<ReliableMessageProtocolConfig> mrpConfig,
+                                         const CASESessionCachable * previousSession)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
@@ -235,6 +239,14 @@ CHIP_ERROR CASESession::EstablishSession(const Transport::PeerAddress peerAddres
     SetPeerAddress(peerAddress);
     SetPeerNodeId(peerNodeId);
 
+    // Prime the session with state from a previous establishment, if available, so that
+    // Sigma1 carries our resumption ID and the peer can short-circuit the handshake.
+    if (previousSession != nullptr)
+    {
+        err = FromCachable(*previousSession);
+        SuccessOrExit(err);
+    }
+
     err = SendSigma1();
     SuccessOrExit(err);
 
@@ -260,14 +272,29 @@ void CASESession::OnResponseTimeout(ExchangeContext * ec)
 }
 
 CHIP_ERROR CASESession::DeriveSecureSession(CryptoContext & session, CryptoContext::SessionRole role)
+{
+    VerifyOrReturnError(mCASESessionEstablished, CHIP_ERROR_INCORRECT_STATE);
+
+    // Fast path: the keys were already derived while this node was waiting for
+    // the peer's status report.  See PrecomputeSessionKeys().
+    if (mSessionKeysPrecomputed && role == mPrecomputedKeysRole)
+    {
+        session = mPrecomputedSessionKeys;
+        mPrecomputedSessionKeys.Reset();
+        mSessionKeysPrecomputed = false;
+        return CHIP_NO_ERROR;
+    }
+
+    return DeriveSessionKeys(session, role);
+}
+
+CHIP_ERROR CASESession::DeriveSessionKeys(CryptoContext & session, CryptoContext::SessionRole role)
 {
     size_t saltlen;
 
     (void) kKDFSEInfo;
     (void) kKDFSEInfoLength;
 
-    VerifyOrReturnError(mCASESessionEstablished, CHIP_ERROR_INCORRECT_STATE);
-
     // Generate Salt for Encryption keys
     saltlen = sizeof(mIPK) + kSHA256_Hash_Length;
 
@@ -287,6 +314,19 @@ CHIP_ERROR CASESession::DeriveSecureSession(CryptoContext & session, CryptoConte
     return CHIP_NO_ERROR;
 }
 
+void CASESession::PrecomputeSessionKeys(CryptoContext::SessionRole role)
+{
+    // Speculatively run the HKDF chain as soon as the key derivation inputs are
+    // final, overlapping it with the status report round trip instead of paying
+    // for it at session activation.  Failures here are ignored; activation will
+    // simply derive the keys inline as before.
+    mSessionKeysPrecomputed = false;
+    mPrecomputedSessionKeys.Reset();
+    VerifyOrReturn(DeriveSessionKeys(mPrecomputedSessionKeys, role) == CHIP_NO_ERROR);
+    mPrecomputedKeysRole    = role;
+    mSessionKeysPrecomputed = true;
+}
+
 CHIP_ERROR CASESession::SendSigma1()
 {
     const size_t mrpParamsSize = mLocalMRPConfig.HasValue() ? TLV::EstimateStructOverhead(sizeof(uint16_t), sizeof(uint16_t)) : 0;
@@ -690,8 +730,9 @@ CHIP_ERROR CASESession::HandleSigma2Resume(System::PacketBufferHandle && msg)
 
     SendStatusReport(mExchangeCtxt, kProtocolCodeSuccess);
 
-    // TODO: Set timestamp on the new session, to allow selecting a least-recently-used session for eviction
-    // on running out of session contexts.
+    // Record when this session was set up, so that the least-recently-established entry
+    // can be evicted from the resumption cache when it is full.
+    mSessionSetupTimeStamp = System::SystemClock().GetMonotonicTimestamp().count();
 
     mCASESessionEstablished = true;
 
@@ -998,6 +1039,10 @@ CHIP_ERROR CASESession::SendSigma3()
     err = mCommissioningHash.Finish(messageDigestSpan);
     SuccessOrExit(err);
 
+    // All key derivation inputs are final at this point; derive the session keys
+    // while Sigma3 and the peer's status report make their round trip.
+    PrecomputeSessionKeys(CryptoContext::SessionRole::kInitiator);
+
 exit:
 
     if (err != CHIP_NO_ERROR)
@@ -1128,8 +1173,9 @@ CHIP_ERROR CASESession::HandleSigma3(System::PacketBufferHandle && msg)
 
     SendStatusReport(mExchangeCtxt, kProtocolCodeSuccess);
 
-    // TODO: Set timestamp on the new session, to allow selecting a least-recently-used session for eviction
-    // on running out of session contexts.
+    // Record when this session was set up, so that the least-recently-established entry
+    // can be evicted from the resumption cache when it is full.
+    mSessionSetupTimeStamp = System::SystemClock().GetMonotonicTimestamp().count();
 
     mCASESessionEstablished = true;
 
@@ -1315,6 +1361,7 @@ CHIP_ERROR CASESession::SetEffectiveTime(void)
 void CASESession::OnSuccessStatusReport()
 {
     ChipLogProgress(SecureChannel, "Success status report received. Session was established");
+    mSessionSetupTimeStamp  = System::SystemClock().GetMonotonicTimestamp().count();
     mCASESessionEstablished = true;
 
     // Forget our exchange, as no additional messages are expected from the peer
@@ -104,13 +104,17 @@ public:
      * @param mySessionId                   Session ID to be assigned to the secure session on the peer node
      * @param exchangeCtxt                  The exchange context to send and receive messages with the peer
      * @param delegate                      Callback object
+     * @param previousSession               Cached state from a previous session with the peer, if available.
+     *                                      When provided, session resumption is requested in Sigma1 so that
+     *                                      the handshake can complete without certificate validation.
      *
      * @return CHIP_ERROR      The result of initialization
      */
     CHIP_ERROR
     EstablishSession(const Transport::PeerAddress peerAddress, FabricInfo * fabric, NodeId peerNodeId, uint16_t mySessionId,
                      Messaging::ExchangeContext * exchangeCtxt, SessionEstablishmentDelegate * delegate,
-                     Optional<ReliableMessageProtocolConfig> mrpConfig = Optional<ReliableMessageProtocolConfig>::Missing());
+                     Optional<ReliableMessageProtocolConfig> mrpConfig = Optional<ReliableMessageProtocolConfig>::Missing(),
+                     const CASESessionCachable * previousSession       = nullptr);
 
     /**
      * Parse a sigma1 message.  This function will return success only if the
@@ -204,6 +208,9 @@ private:
 
     CHIP_ERROR SendSigma2Resume(const ByteSpan & initiatorRandom);
 
+    CHIP_ERROR DeriveSessionKeys(CryptoContext & session, CryptoContext::SessionRole role);
+    void PrecomputeSessionKeys(CryptoContext::SessionRole role);
+
     CHIP_ERROR ConstructSaltSigma2(const ByteSpan & rand, const Crypto::P256PublicKey & pubkey, const ByteSpan & ipk,
                                    MutableByteSpan & salt);
     CHIP_ERROR Validate_and_RetrieveResponderID(const ByteSpan & responderNOC, const ByteSpan & responderICAC,
@@ -263,6 +270,12 @@ private:
     uint8_t mLocalFabricIndex       = 0;
     uint64_t mSessionSetupTimeStamp = 0;
 
+    // Session keys speculatively derived once the handshake inputs are final,
+    // so that session activation does not have to rerun the HKDF chain.
+    CryptoContext mPrecomputedSessionKeys;
+    CryptoContext::SessionRole mPrecomputedKeysRole = CryptoContext::SessionRole::kInitiator;
+    bool mSessionKeysPrecomputed                    = false;
+
     Optional<ReliableMessageProtocolConfig> mLocalMRPConfig;
 
 protected:
@@ -15,10 +15,25 @@
  *    limitations under the License.
  */
 
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/BufferReader.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/logging/CHIPLogging.h>
 #include <protocols/secure_channel/CASESessionCache.h>
 
 namespace chip {
 
+namespace {
+
+// Serialized entry: version, shared secret length and (fixed-size) bytes, local fabric
+// index, peer node id, peer CATs, resumption id and setup timestamp.
+constexpr uint8_t kEntryVersion = 1;
+constexpr size_t kEntrySize     = sizeof(uint8_t) + sizeof(uint16_t) + Crypto::kMax_ECDH_Secret_Length + sizeof(FabricIndex) +
+    sizeof(NodeId) + (kMaxSubjectCATAttributeCount * sizeof(CASEAuthTag)) + kCASEResumptionIDSize + sizeof(uint64_t);
+
+} // namespace
+
 CASESessionCache::CASESessionCache() {}
 
 CASESessionCache::~CASESessionCache()
@@ -44,6 +59,92 @@ CASESessionCachable * CASESessionCache::GetLRUSession()
     return lruSession;
 }
 
+CHIP_ERROR CASESessionCache::Init(PersistentStorageDelegate * storage)
+{
+    VerifyOrReturnError(storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    mStorage = storage;
+    return LoadFromStorage();
+}
+
+CHIP_ERROR CASESessionCache::LoadFromStorage()
+{
+    DefaultStorageKeyAllocator key;
+
+    for (uint16_t index = 0; index < CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE; index++)
+    {
+        uint8_t buffer[kEntrySize];
+        uint16_t size  = sizeof(buffer);
+        CHIP_ERROR err = mStorage->SyncGetKeyValue(key.CaseResumptionEntry(index), buffer, size);
+        if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+        {
+            // Entries are stored contiguously from index zero.
+            break;
+        }
+        ReturnErrorOnFailure(err);
+
+        CASESessionCachable entry;
+        uint8_t version;
+
+        Encoding::LittleEndian::Reader reader(buffer, size);
+        reader.Read8(&version).Read16(&entry.mSharedSecretLen);
+        reader.ReadBytes(entry.mSharedSecret, sizeof(entry.mSharedSecret));
+        reader.Read8(&entry.mLocalFabricIndex).Read64(&entry.mPeerNodeId);
+        for (auto & cat : entry.mPeerCATs.values)
+        {
+            reader.Read32(&cat);
+        }
+        reader.ReadBytes(entry.mResumptionId, sizeof(entry.mResumptionId));
+        reader.Read64(&entry.mSessionSetupTimeStamp);
+        ReturnErrorOnFailure(reader.StatusCode());
+        VerifyOrReturnError(version == kEntryVersion, CHIP_ERROR_VERSION_MISMATCH);
+        VerifyOrReturnError(entry.mSharedSecretLen <= sizeof(entry.mSharedSecret), CHIP_ERROR_INVALID_ARGUMENT);
+
+        mCachePool.CreateObject(entry);
+    }
+    return CHIP_NO_ERROR;
+}
+
+void CASESessionCache::PersistToStorage()
+{
+    VerifyOrReturn(mStorage != nullptr);
+
+    DefaultStorageKeyAllocator key;
+    uint16_t index = 0;
+
+    mCachePool.ForEachActiveObject([&](auto * ec) {
+        uint8_t buffer[kEntrySize];
+        Encoding::LittleEndian::BufferWriter writer(buffer, sizeof(buffer));
+
+        writer.Put8(kEntryVersion);
+        writer.Put16(ec->mSharedSecretLen);
+        writer.Put(ec->mSharedSecret, sizeof(ec->mSharedSecret));
+        writer.Put8(ec->mLocalFabricIndex);
+        writer.Put64(ec->mPeerNodeId);
+        for (auto cat : ec->mPeerCATs.values)
+        {
+            writer.Put32(cat);
+        }
+        writer.Put(ec->mResumptionId, sizeof(ec->mResumptionId));
+        writer.Put64(ec->mSessionSetupTimeStamp);
+
+        if (writer.Fit())
+        {
+            LogErrorOnFailure(
+                mStorage->SyncSetKeyValue(key.CaseResumptionEntry(index), buffer, static_cast<uint16_t>(writer.Needed())));
+            index++;
+        }
+        return Loop::Continue;
+    });
+
+    // Terminate the record sequence, so entries removed or evicted above do not get
+    // reloaded on the next start.
+    CHIP_ERROR err = mStorage->SyncDeleteKeyValue(key.CaseResumptionEntry(index));
+    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        ChipLogError(SecureChannel, "Failed to trim persisted CASE resumption entries: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
 CHIP_ERROR CASESessionCache::Add(CASESessionCachable & cachableSession)
 {
     // It's not an error if a device doesn't have cache for storing the sessions.
@@ -56,6 +157,7 @@ CHIP_ERROR CASESessionCache::Add(CASESessionCachable & cachableSession)
     }
 
     mCachePool.CreateObject(cachableSession);
+    PersistToStorage();
     return CHIP_NO_ERROR;
 }
 
@@ -71,6 +173,7 @@ CHIP_ERROR CASESessionCache::Remove(ResumptionID resumptionID)
         return Loop::Continue;
     });
 
+    PersistToStorage();
     return err;
 }
 
@@ -98,8 +201,26 @@ CHIP_ERROR CASESessionCache::Get(ResumptionID resumptionID, CASESessionCachable
 
 CHIP_ERROR CASESessionCache::Get(const PeerId & peer, CASESessionCachable & outSessionCachable)
 {
-    // TODO: Implement this based on peer id
-    return CHIP_NO_ERROR;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    bool found     = false;
+    // The cached peer node id is stored in little-endian byte order.
+    const NodeId peerNodeId = Encoding::LittleEndian::HostSwap64(peer.GetNodeId());
+    mCachePool.ForEachActiveObject([&](auto * ec) {
+        if (ec->mPeerNodeId == peerNodeId)
+        {
+            found              = true;
+            outSessionCachable = *ec;
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+
+    if (!found)
+    {
+        err = CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND;
+    }
+
+    return err;
 }
 
 } // namespace chip
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <lib/core/CHIPError.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/core/PeerId.h>
 #include <protocols/secure_channel/CASESession.h>
 
@@ -31,6 +32,13 @@ public:
     CASESessionCache();
     virtual ~CASESessionCache();
 
+    /**
+     * Attach persistent storage and load any previously persisted entries, so CASE
+     * resumption state survives a process restart. Once attached, additions and
+     * removals are written through to storage.
+     */
+    CHIP_ERROR Init(PersistentStorageDelegate * storage);
+
     CHIP_ERROR Add(CASESessionCachable & cachableSession);
     CHIP_ERROR Remove(ResumptionID resumptionID);
     CHIP_ERROR Get(ResumptionID resumptionID, CASESessionCachable & outCachableSession);
@@ -39,6 +47,11 @@ public:
 private:
     BitMapObjectPool<CASESessionCachable, CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE> mCachePool;
     CASESessionCachable * GetLRUSession();
+
+    CHIP_ERROR LoadFromStorage();
+    void PersistToStorage();
+
+    PersistentStorageDelegate * mStorage = nullptr;
 };
 
 } // namespace chip
@@ -69,6 +69,10 @@ enum class MsgType : uint8_t
     CASE_Sigma2Resume = 0x33,
 
     StatusReport = 0x40,
+
+    // In-place session key rotation Message Types
+    SessionRekeyRequest  = 0x50,
+    SessionRekeyResponse = 0x51,
 };
 
 // Placeholder value for the ProtocolCode field when the GeneralCode is Success or Continue.
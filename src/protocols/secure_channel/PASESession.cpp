@@ -103,6 +103,8 @@ void PASESession::Clear()
     mKeLen           = sizeof(mKe);
     mPairingComplete = false;
     mComputeVerifier = true;
+    mPrecomputedSessionKeys.Reset();
+    mSessionKeysPrecomputed = false;
     PairingSession::Clear();
     CloseExchange();
 }
@@ -353,10 +355,36 @@ void PASESession::OnResponseTimeout(ExchangeContext * ec)
 CHIP_ERROR PASESession::DeriveSecureSession(CryptoContext & session, CryptoContext::SessionRole role)
 {
     VerifyOrReturnError(mPairingComplete, CHIP_ERROR_INCORRECT_STATE);
+
+    // Fast path: the keys were already derived while this node was waiting for
+    // the peer's status report.  See PrecomputeSessionKeys().
+    if (mSessionKeysPrecomputed && role == mPrecomputedKeysRole)
+    {
+        session = mPrecomputedSessionKeys;
+        mPrecomputedSessionKeys.Reset();
+        mSessionKeysPrecomputed = false;
+        return CHIP_NO_ERROR;
+    }
+
     return session.InitFromSecret(ByteSpan(mKe, mKeLen), ByteSpan(nullptr, 0),
                                   CryptoContext::SessionInfoType::kSessionEstablishment, role);
 }
 
+void PASESession::PrecomputeSessionKeys(CryptoContext::SessionRole role)
+{
+    // Speculatively derive the session keys as soon as Ke is final, overlapping
+    // the derivation with the status report round trip instead of paying for it
+    // at session activation.  Failures here are ignored; activation will simply
+    // derive the keys inline as before.
+    mSessionKeysPrecomputed = false;
+    mPrecomputedSessionKeys.Reset();
+    VerifyOrReturn(mPrecomputedSessionKeys.InitFromSecret(ByteSpan(mKe, mKeLen), ByteSpan(nullptr, 0),
+                                                          CryptoContext::SessionInfoType::kSessionEstablishment,
+                                                          role) == CHIP_NO_ERROR);
+    mPrecomputedKeysRole    = role;
+    mSessionKeysPrecomputed = true;
+}
+
 CHIP_ERROR PASESession::SendPBKDFParamRequest()
 {
     ReturnErrorOnFailure(DRBG_get_bytes(mPBKDFLocalRandomData, sizeof(mPBKDFLocalRandomData)));
@@ -780,6 +808,10 @@ CHIP_ERROR PASESession::HandleMsg2_and_SendMsg3(System::PacketBufferHandle && ms
 
     ChipLogDetail(SecureChannel, "Sent spake2p msg3");
 
+    // Ke is final at this point; derive the session keys while msg3 and the
+    // peer's status report make their round trip.
+    PrecomputeSessionKeys(CryptoContext::SessionRole::kInitiator);
+
 exit:
 
     if (err != CHIP_NO_ERROR)
@@ -897,6 +929,22 @@ CHIP_ERROR PASESession::ValidateReceivedMessage(ExchangeContext * exchange, cons
 CHIP_ERROR PASESession::OnMessageReceived(ExchangeContext * exchange, const PayloadHeader & payloadHeader,
                                           System::PacketBufferHandle && msg)
 {
+    // Rate-limit handshake starts per source before any handshake state is
+    // touched.  This covers both the unsolicited first message and a
+    // PBKDFParamRequest arriving on a new exchange mid-handshake, either of
+    // which would otherwise restart or tear down the session.  Rate-limited
+    // messages are dropped silently so the in-progress handshake (if any) is
+    // unaffected.
+    if (payloadHeader.HasMessageType(MsgType::PBKDFParamRequest) && exchange != nullptr && exchange != mExchangeCtxt)
+    {
+        const SessionHandle sessionHandle = exchange->GetSessionHandle();
+        if (!sessionHandle.IsSecure() && !mRateLimiter.ShouldAccept(sessionHandle.GetUnauthenticatedSession()->GetPeerAddress()))
+        {
+            ChipLogProgress(SecureChannel, "Dropping PBKDFParamRequest: source exceeded the session establishment rate limit");
+            return CHIP_NO_ERROR;
+        }
+    }
+
     CHIP_ERROR err = ValidateReceivedMessage(exchange, payloadHeader, std::move(msg));
     SuccessOrExit(err);
 
@@ -37,6 +37,7 @@
 #include <protocols/secure_channel/Constants.h>
 #include <protocols/secure_channel/SessionEstablishmentDelegate.h>
 #include <protocols/secure_channel/SessionEstablishmentExchangeDispatch.h>
+#include <protocols/secure_channel/SessionEstablishmentRateLimiter.h>
 #include <system/SystemPacketBuffer.h>
 #include <transport/CryptoContext.h>
 #include <transport/PairingSession.h>
@@ -267,6 +268,8 @@ private:
     void OnSuccessStatusReport() override;
     CHIP_ERROR OnFailureStatusReport(Protocols::SecureChannel::GeneralStatusCode generalCode, uint16_t protocolCode) override;
 
+    void PrecomputeSessionKeys(CryptoContext::SessionRole role);
+
     void CloseExchange();
 
     SessionEstablishmentDelegate * mDelegate = nullptr;
@@ -302,8 +305,19 @@ private:
 
     SessionEstablishmentExchangeDispatch mMessageDispatch;
 
+    // Per-source gate applied to unsolicited PBKDFParamRequest messages on the
+    // responder before any handshake state is touched.  Deliberately not reset
+    // by Clear(), so a flood that fails handshakes cannot refill its budget.
+    SessionEstablishmentRateLimiter mRateLimiter;
+
     Optional<ReliableMessageProtocolConfig> mLocalMRPConfig;
 
+    // Session keys speculatively derived once Ke is final, so that session
+    // activation does not have to rerun the key derivation.
+    CryptoContext mPrecomputedSessionKeys;
+    CryptoContext::SessionRole mPrecomputedKeysRole = CryptoContext::SessionRole::kInitiator;
+    bool mSessionKeysPrecomputed                    = false;
+
     struct Spake2pErrorMsg
     {
         Spake2pErrorType error;
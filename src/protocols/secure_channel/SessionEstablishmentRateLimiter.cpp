@@ -0,0 +1,81 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/secure_channel/SessionEstablishmentRateLimiter.h>
+
+namespace chip {
+
+bool SessionEstablishmentRateLimiter::ShouldAccept(const Transport::PeerAddress & source)
+{
+#if CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_MAX_PER_WINDOW > 0
+    // Only IP-based transports are limited.  A BLE peer is bound to a
+    // dedicated connection and cannot spoof additional sources.
+    if (source.GetTransportType() != Transport::Type::kUdp && source.GetTransportType() != Transport::Type::kTcp)
+    {
+        return true;
+    }
+
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+
+    SourceEntry * entry = FindOrAllocateEntry(source.GetIPAddress());
+    if (now - entry->windowStart >= System::Clock::Milliseconds32(CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_WINDOW_MS))
+    {
+        entry->windowStart = now;
+        entry->count       = 0;
+    }
+
+    if (entry->count >= CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_MAX_PER_WINDOW)
+    {
+        return false;
+    }
+
+    entry->count++;
+#endif // CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_MAX_PER_WINDOW > 0
+    return true;
+}
+
+void SessionEstablishmentRateLimiter::Reset()
+{
+    for (SourceEntry & entry : mSources)
+    {
+        entry = SourceEntry();
+    }
+}
+
+SessionEstablishmentRateLimiter::SourceEntry * SessionEstablishmentRateLimiter::FindOrAllocateEntry(const Inet::IPAddress & address)
+{
+    SourceEntry * oldest = &mSources[0];
+    for (SourceEntry & entry : mSources)
+    {
+        if (entry.address == address)
+        {
+            return &entry;
+        }
+        if (entry.windowStart < oldest->windowStart)
+        {
+            oldest = &entry;
+        }
+    }
+
+    // Not tracked: recycle the entry with the oldest window.
+    oldest->address     = address;
+    oldest->windowStart = System::Clock::kZero;
+    oldest->count       = 0;
+    return oldest;
+}
+
+} // namespace chip
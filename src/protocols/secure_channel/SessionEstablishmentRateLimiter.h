@@ -0,0 +1,85 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Per-source rate limiter for unsolicited session establishment
+ *      messages (PASE PBKDFParamRequest, CASE Sigma1).
+ */
+
+#pragma once
+
+#include <inet/IPAddress.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/DataModelTypes.h>
+#include <system/SystemClock.h>
+#include <transport/raw/PeerAddress.h>
+
+namespace chip {
+
+/**
+ * @brief
+ *   Fixed-window, per-source rate limiter applied to unsolicited session
+ *   establishment messages before any handshake state is touched.
+ *
+ *   Handshake initiation is expensive relative to the first message that
+ *   triggers it (state machine setup, session ID allocation, SPAKE2+ / sigma
+ *   crypto), so a scanner or misbehaving controller spraying first messages
+ *   can exhaust memory and CPU on an always-commissionable device.  This
+ *   limiter tracks a small fixed table of recent source IP addresses and
+ *   rejects sources that start handshakes faster than the configured budget,
+ *   so floods are shed with a table lookup instead of a handshake.
+ *
+ *   Source ports are deliberately ignored when matching entries: a flooder
+ *   cycling ephemeral ports still aggregates into a single entry.  When the
+ *   table is full the entry with the oldest window is recycled, so a flood
+ *   from many distinct addresses degrades to admitting roughly one handshake
+ *   per table slot per window rather than tracking every source.
+ */
+class SessionEstablishmentRateLimiter
+{
+public:
+    /**
+     * Record a session establishment attempt from the given source and
+     * indicate whether it should be processed.
+     *
+     * @return false when the source has exceeded
+     *         CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_MAX_PER_WINDOW
+     *         attempts within the current window.  Sources without an IP
+     *         address (e.g. BLE) are never limited.
+     */
+    bool ShouldAccept(const Transport::PeerAddress & source);
+
+    /**
+     * Forget all tracked sources, e.g. when a new commissioning window opens.
+     */
+    void Reset();
+
+private:
+    struct SourceEntry
+    {
+        Inet::IPAddress address              = Inet::IPAddress::Any;
+        System::Clock::Timestamp windowStart = System::Clock::kZero;
+        uint16_t count                       = 0;
+    };
+
+    SourceEntry * FindOrAllocateEntry(const Inet::IPAddress & address);
+
+    SourceEntry mSources[CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_SOURCES];
+};
+
+} // namespace chip
@@ -0,0 +1,204 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the secure channel re-key protocol.
+ *
+ */
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeMgr.h>
+#include <messaging/Flags.h>
+#include <protocols/Protocols.h>
+#include <protocols/secure_channel/Constants.h>
+#include <protocols/secure_channel/SessionRekey.h>
+#include <transport/SecureSession.h>
+
+namespace chip {
+namespace secure_channel {
+
+constexpr System::Clock::Timeout SessionRekey::kRekeyTimeout;
+
+CHIP_ERROR SessionRekey::Init(Messaging::ExchangeManager * exchangeMgr)
+{
+    VerifyOrReturnError(exchangeMgr != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    mExchangeMgr = exchangeMgr;
+
+    ReturnErrorOnFailure(
+        mExchangeMgr->RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::SessionRekeyRequest, this));
+
+    return CHIP_NO_ERROR;
+}
+
+void SessionRekey::Shutdown()
+{
+    if (mExchangeMgr != nullptr)
+    {
+        mExchangeMgr->UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::SessionRekeyRequest);
+        mExchangeMgr->CloseAllContextsForDelegate(this);
+        mExchangeMgr = nullptr;
+    }
+}
+
+CHIP_ERROR SessionRekey::StartRekey(const SessionHandle & session)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    Messaging::ExchangeContext * exchangeContext = nullptr;
+    System::PacketBufferHandle msgBuf;
+    Messaging::SendFlags sendFlags;
+
+    Transport::SecureSession * state = mExchangeMgr->GetSessionManager()->GetSecureSession(session);
+    VerifyOrExit(state != nullptr, err = CHIP_ERROR_NOT_CONNECTED);
+
+    exchangeContext = mExchangeMgr->NewContext(session, this);
+    VerifyOrExit(exchangeContext != nullptr, err = CHIP_ERROR_NO_MEMORY);
+
+    msgBuf = MessagePacketBuffer::New(kSaltSize);
+    VerifyOrExit(!msgBuf.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+
+    // Generate the random salt both sides will feed into the next epoch's key derivation.
+    SuccessOrExit(err = Crypto::DRBG_get_bytes(msgBuf->Start(), kSaltSize));
+
+    msgBuf->SetDataLength(kSaltSize);
+
+    // Prepare the next epoch before the request goes out: the responder
+    // switches to the new keys as soon as it processes the request, and its
+    // traffic must remain decryptable here while we wait for the response.
+    SuccessOrExit(err = state->GetCryptoContext().PrepareRekey(ByteSpan(msgBuf->Start(), kSaltSize)));
+
+    sendFlags.Set(Messaging::SendMessageFlags::kExpectResponse);
+
+    // Arm a timer to enforce that a SessionRekeyResponse is received before kRekeyTimeout.
+    exchangeContext->SetResponseTimeout(kRekeyTimeout);
+
+    SuccessOrExit(
+        err = exchangeContext->SendMessage(Protocols::SecureChannel::MsgType::SessionRekeyRequest, std::move(msgBuf), sendFlags));
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        if (exchangeContext != nullptr)
+        {
+            exchangeContext->Close();
+        }
+        ChipLogError(SecureChannel, "Failed to send session re-key request with error:%s", ErrorStr(err));
+    }
+
+    return err;
+}
+
+CHIP_ERROR SessionRekey::OnMessageReceived(Messaging::ExchangeContext * exchangeContext, const PayloadHeader & payloadHeader,
+                                           System::PacketBufferHandle && msgBuf)
+{
+    if (payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::SessionRekeyRequest))
+    {
+        return HandleRekeyReq(exchangeContext, std::move(msgBuf));
+    }
+    else if (payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::SessionRekeyResponse))
+    {
+        return HandleRekeyRsp(exchangeContext, std::move(msgBuf));
+    }
+    return CHIP_NO_ERROR;
+}
+
+void SessionRekey::OnResponseTimeout(Messaging::ExchangeContext * exchangeContext)
+{
+    // Deliberately keep the prepared epoch: the responder may have committed
+    // to it even though its response was lost, and the prepared keys are what
+    // keeps such a peer's traffic decryptable.  The session stays usable on
+    // the epochs both sides hold; the next StartRekey attempt reports
+    // CHIP_ERROR_INCORRECT_STATE and the caller falls back to session
+    // re-establishment.
+    ChipLogError(SecureChannel, "Timed out waiting for session re-key response.");
+}
+
+CHIP_ERROR SessionRekey::HandleRekeyReq(Messaging::ExchangeContext * exchangeContext, System::PacketBufferHandle && msgBuf)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    Transport::SecureSession * state = nullptr;
+    System::PacketBufferHandle respBuf;
+
+    const uint8_t * req = msgBuf->Start();
+    size_t reqlen       = msgBuf->DataLength();
+
+    ChipLogDetail(SecureChannel, "Received SessionRekeyRequest");
+
+    VerifyOrExit(req != nullptr, err = CHIP_ERROR_MESSAGE_INCOMPLETE);
+    VerifyOrExit(reqlen == kSaltSize, err = CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+
+    state = mExchangeMgr->GetSessionManager()->GetSecureSession(exchangeContext->GetSessionHandle());
+    VerifyOrExit(state != nullptr, err = CHIP_ERROR_NOT_CONNECTED);
+
+    // Derive the next epoch from the peer's salt.  A rotation already in
+    // progress (e.g. both peers initiating at once) fails here; the peer's
+    // request then times out and the session keeps working on the epochs
+    // both sides hold.
+    SuccessOrExit(err = state->GetCryptoContext().PrepareRekey(ByteSpan(req, reqlen)));
+
+    respBuf = MessagePacketBuffer::New(0);
+    VerifyOrExit(!respBuf.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+
+    // The response is the last message sent under the outgoing epoch; commit
+    // only after it is encrypted and queued.
+    SuccessOrExit(err = exchangeContext->SendMessage(Protocols::SecureChannel::MsgType::SessionRekeyResponse, std::move(respBuf)));
+
+    err = state->GetCryptoContext().CommitRekey();
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Failed to handle SessionRekeyRequest message with error:%s", ErrorStr(err));
+    }
+
+    return err;
+}
+
+CHIP_ERROR SessionRekey::HandleRekeyRsp(Messaging::ExchangeContext * exchangeContext, System::PacketBufferHandle && msgBuf)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    Transport::SecureSession * state = nullptr;
+
+    ChipLogDetail(SecureChannel, "Received SessionRekeyResponse");
+
+    VerifyOrExit(msgBuf->DataLength() == 0, err = CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+
+    state = mExchangeMgr->GetSessionManager()->GetSecureSession(exchangeContext->GetSessionHandle());
+    VerifyOrExit(state != nullptr, err = CHIP_ERROR_NOT_CONNECTED);
+
+    SuccessOrExit(err = state->GetCryptoContext().CommitRekey());
+
+    ChipLogProgress(SecureChannel, "Session keys rotated in place");
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Failed to handle SessionRekeyResponse message with error:%s", ErrorStr(err));
+    }
+
+    return err;
+}
+
+} // namespace secure_channel
+} // namespace chip
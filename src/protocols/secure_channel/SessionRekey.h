@@ -0,0 +1,89 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+/**
+ *    @file
+ *      This file defines the secure channel re-key protocol, which rotates the
+ *      keys of an established secure session in place instead of tearing the
+ *      session down for a full re-establishment.
+ *
+ */
+
+#pragma once
+
+#include <messaging/ExchangeDelegate.h>
+#include <messaging/ExchangeMgr.h>
+#include <system/SystemPacketBuffer.h>
+
+namespace chip {
+namespace secure_channel {
+
+/**
+ * Rotates the keys of established secure sessions in place.
+ *
+ * Long-lived sessions (e.g. those carrying subscriptions) would otherwise have
+ * to be torn down and re-established by CASE whenever the key usage policy
+ * calls for fresh keys.  This protocol replaces that with two messages on the
+ * existing session: the initiator sends a random salt, both peers derive the
+ * next epoch's keys from the current keys via CryptoContext::PrepareRekey(),
+ * and each side switches over with CryptoContext::CommitRekey().  The crypto
+ * context keeps accepting the adjacent epoch for decryption, so traffic in
+ * flight across the switchover is not dropped.
+ */
+class SessionRekey : public Messaging::ExchangeDelegate
+{
+public:
+    static constexpr uint16_t kSaltSize                   = 32;
+    static constexpr System::Clock::Timeout kRekeyTimeout = System::Clock::Seconds16(10);
+
+    SessionRekey() : mExchangeMgr(nullptr) {}
+    ~SessionRekey() override {}
+
+    CHIP_ERROR Init(Messaging::ExchangeManager * exchangeMgr);
+    void Shutdown();
+
+    /**
+     * Initiate key rotation for the given established secure session.
+     * A SessionRekeyRequest carrying a fresh random salt is sent on a newly
+     * created exchange; the session switches to the new keys when the peer's
+     * SessionRekeyResponse arrives.
+     *
+     * If a previous rotation attempt on this session never completed, this
+     * returns CHIP_ERROR_INCORRECT_STATE and the caller should fall back to
+     * re-establishing the session.
+     *
+     * @param[in]  session  The secure session whose keys should be rotated.
+     *
+     * @retval  #CHIP_ERROR_NOT_CONNECTED  If the session has no secure session state.
+     * @retval  #CHIP_ERROR_NO_MEMORY      If memory could not be allocated for the new
+     *                                      exchange context or new message buffer.
+     * @retval  #CHIP_NO_ERROR             On success.
+     */
+    CHIP_ERROR StartRekey(const SessionHandle & session);
+
+private:
+    Messaging::ExchangeManager * mExchangeMgr; // [READ ONLY] Associated Exchange Manager object.
+
+    CHIP_ERROR HandleRekeyReq(Messaging::ExchangeContext * exchangeContext, System::PacketBufferHandle && msgBuf);
+    CHIP_ERROR HandleRekeyRsp(Messaging::ExchangeContext * exchangeContext, System::PacketBufferHandle && msgBuf);
+    CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * exchangeContext, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && payload) override;
+
+    void OnResponseTimeout(Messaging::ExchangeContext * exchangeContext) override;
+};
+
+} // namespace secure_channel
+} // namespace chip
@@ -67,15 +67,36 @@ CHIP_ERROR StatusReport::Parse(System::PacketBufferHandle buf)
         {
             return CHIP_ERROR_NO_MEMORY;
         }
+        mProtocolDataSpan = ByteSpan(mProtocolData->Start(), mProtocolData->DataLength());
     }
     else
     {
-        mProtocolData = nullptr;
+        mProtocolData     = nullptr;
+        mProtocolDataSpan = ByteSpan();
     }
 
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR StatusReport::ParseBorrowed(const System::PacketBufferHandle & buf)
+{
+    uint16_t tempGeneralCode = 0;
+
+    ReturnErrorCodeIf(buf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    LittleEndian::Reader bufReader(buf->Start(), buf->DataLength());
+
+    ReturnErrorOnFailure(bufReader.Read16(&tempGeneralCode).Read32(&mProtocolId).Read16(&mProtocolCode).StatusCode());
+    mGeneralCode = static_cast<GeneralStatusCode>(tempGeneralCode);
+
+    // Any data after the required fields is protocol-specific; expose it in place rather
+    // than copying it into a fresh buffer.
+    mProtocolData     = nullptr;
+    mProtocolDataSpan = ByteSpan(buf->Start() + bufReader.OctetsRead(), buf->DataLength() - bufReader.OctetsRead());
+
+    return CHIP_NO_ERROR;
+}
+
 Encoding::LittleEndian::BufferWriter & StatusReport::WriteToBuffer(Encoding::LittleEndian::BufferWriter & buf) const
 {
     buf.Put16(to_underlying(mGeneralCode)).Put32(mProtocolId).Put16(mProtocolCode);
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <lib/support/BufferWriter.h>
+#include <lib/support/Span.h>
 #include <system/SystemPacketBuffer.h>
 
 namespace chip {
@@ -73,6 +74,23 @@ public:
      */
     CHIP_ERROR Parse(System::PacketBufferHandle buf);
 
+    /**
+     *  Read the contents of a StatusReport message from a borrowed \c PacketBuffer, without taking
+     *  ownership of the buffer or copying its contents.
+     *
+     *  Unlike \c Parse(), no allocation is performed and the caller keeps the buffer, so dispatch
+     *  paths that inspect a message before handing the same buffer onward need no defensive copy.
+     *  Protocol-specific data is exposed through \c GetProtocolDataSpan(), which points into
+     *  @a buf and is only valid while that buffer is alive — a caller that needs the data to
+     *  outlive the buffer must copy it, or retain the buffer with \c PacketBufferHandle::Retain().
+     *  \c GetProtocolData() returns null after this method.
+     *
+     *  @param[in] buf A \c PacketBufferHandle whose \c Start() points to the StatusReport data.
+     *
+     *  @return CHIP_ERROR Return an error if the message is malformed or buf is \c NULL
+     */
+    CHIP_ERROR ParseBorrowed(const System::PacketBufferHandle & buf);
+
     /**
      *  Write the StatusReport contents into a buffer using a \c BufferWriter
      *
@@ -92,12 +110,20 @@ public:
     uint16_t GetProtocolCode() const { return mProtocolCode; }
     const System::PacketBufferHandle & GetProtocolData() const { return mProtocolData; }
 
+    /**
+     *  Returns the protocol-specific data as a span, or an empty span if there is none.
+     *  After \c Parse() the span points into the report's own copy of the data; after
+     *  \c ParseBorrowed() it points into the caller's buffer and shares its lifetime.
+     */
+    ByteSpan GetProtocolDataSpan() const { return mProtocolDataSpan; }
+
 private:
     GeneralStatusCode mGeneralCode;
     uint32_t mProtocolId;
     uint16_t mProtocolCode;
 
     System::PacketBufferHandle mProtocolData;
+    ByteSpan mProtocolDataSpan;
 };
 
 } // namespace SecureChannel
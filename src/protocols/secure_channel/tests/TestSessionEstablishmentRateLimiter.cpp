@@ -0,0 +1,134 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/UnitTestRegistration.h>
+#include <protocols/secure_channel/SessionEstablishmentRateLimiter.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::Transport;
+
+namespace {
+
+PeerAddress MakeUDPSource(const char * ip, uint16_t port)
+{
+    Inet::IPAddress addr;
+    Inet::IPAddress::FromString(ip, addr);
+    return PeerAddress::UDP(addr, port);
+}
+
+} // namespace
+
+void TestRateLimiter_PerSourceBudget(nlTestSuite * inSuite, void * inContext)
+{
+    SessionEstablishmentRateLimiter limiter;
+
+    const PeerAddress source = MakeUDPSource("fe80::1", 11095);
+
+    for (int i = 0; i < CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_MAX_PER_WINDOW; i++)
+    {
+        NL_TEST_ASSERT(inSuite, limiter.ShouldAccept(source));
+    }
+
+    // The budget is exhausted for the rest of the window.
+    NL_TEST_ASSERT(inSuite, !limiter.ShouldAccept(source));
+
+    // Cycling source ports does not refill the budget.
+    NL_TEST_ASSERT(inSuite, !limiter.ShouldAccept(MakeUDPSource("fe80::1", 11096)));
+
+    // An unrelated source has its own budget.
+    NL_TEST_ASSERT(inSuite, limiter.ShouldAccept(MakeUDPSource("fe80::2", 11095)));
+
+    limiter.Reset();
+    NL_TEST_ASSERT(inSuite, limiter.ShouldAccept(source));
+}
+
+void TestRateLimiter_NonIPSourcesUnlimited(nlTestSuite * inSuite, void * inContext)
+{
+    SessionEstablishmentRateLimiter limiter;
+
+    const PeerAddress source = PeerAddress::BLE();
+
+    for (int i = 0; i < 2 * CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_MAX_PER_WINDOW; i++)
+    {
+        NL_TEST_ASSERT(inSuite, limiter.ShouldAccept(source));
+    }
+}
+
+void TestRateLimiter_TableRecycling(nlTestSuite * inSuite, void * inContext)
+{
+    SessionEstablishmentRateLimiter limiter;
+
+    // Exhaust the budget for one source, then run enough distinct sources
+    // through the limiter to recycle its entry: the original source must be
+    // admitted again rather than tracked forever.
+    const PeerAddress source = MakeUDPSource("fe80::100", 11095);
+
+    for (int i = 0; i < CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_MAX_PER_WINDOW; i++)
+    {
+        NL_TEST_ASSERT(inSuite, limiter.ShouldAccept(source));
+    }
+    NL_TEST_ASSERT(inSuite, !limiter.ShouldAccept(source));
+
+    char ip[Inet::IPAddress::kMaxStringLength];
+    for (int i = 0; i < CHIP_CONFIG_SESSION_ESTABLISHMENT_RATE_LIMIT_SOURCES; i++)
+    {
+        snprintf(ip, sizeof(ip), "fe80::%x", 0x200 + i);
+        NL_TEST_ASSERT(inSuite, limiter.ShouldAccept(MakeUDPSource(ip, 11095)));
+    }
+
+    NL_TEST_ASSERT(inSuite, limiter.ShouldAccept(source));
+}
+
+// Test Suite
+
+/**
+ *  Test Suite that lists all the test functions.
+ */
+// clang-format off
+static const nlTest sTests[] =
+{
+    NL_TEST_DEF("SessionEstablishmentRateLimiter_PerSourceBudget", TestRateLimiter_PerSourceBudget),
+    NL_TEST_DEF("SessionEstablishmentRateLimiter_NonIPSourcesUnlimited", TestRateLimiter_NonIPSourcesUnlimited),
+    NL_TEST_DEF("SessionEstablishmentRateLimiter_TableRecycling", TestRateLimiter_TableRecycling),
+
+    NL_TEST_SENTINEL()
+};
+
+static nlTestSuite sSuite =
+{
+    "Test-CHIP-SessionEstablishmentRateLimiter",
+    &sTests[0],
+    nullptr,
+    nullptr
+};
+// clang-format on
+
+/**
+ *  Main
+ */
+int TestSessionEstablishmentRateLimiter()
+{
+    // Run test suit against one context
+    nlTestRunner(&sSuite, nullptr);
+
+    return (nlTestRunnerStats(&sSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSessionEstablishmentRateLimiter)
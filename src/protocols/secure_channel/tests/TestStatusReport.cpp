@@ -91,6 +91,46 @@ void TestStatusReport_WithData(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, !memcmp(rcvData->Start(), data, dataLen));
 }
 
+void TestStatusReport_ParseBorrowed(nlTestSuite * inSuite, void * inContext)
+{
+    GeneralStatusCode generalCode      = GeneralStatusCode::kBusy;
+    uint32_t protocolId                = SecureChannel::Id.ToFullyQualifiedSpecForm();
+    uint16_t protocolCode              = kProtocolCodeBusy;
+    uint8_t data[2]                    = { 0xf4, 0x01 };
+    const uint16_t dataLen             = 2;
+    System::PacketBufferHandle dataBuf = System::PacketBufferHandle::NewWithData(data, dataLen);
+
+    StatusReport testReport(generalCode, protocolId, protocolCode, std::move(dataBuf));
+
+    size_t msgSize = testReport.Size();
+    Encoding::LittleEndian::PacketBufferWriter bbuf(System::PacketBufferHandle::New(msgSize));
+    testReport.WriteToBuffer(bbuf);
+
+    System::PacketBufferHandle msgBuf = bbuf.Finalize();
+    NL_TEST_ASSERT(inSuite, !msgBuf.IsNull());
+
+    StatusReport reportToParse;
+    CHIP_ERROR err = reportToParse.ParseBorrowed(msgBuf);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reportToParse.GetGeneralCode() == generalCode);
+    NL_TEST_ASSERT(inSuite, reportToParse.GetProtocolId() == protocolId);
+    NL_TEST_ASSERT(inSuite, reportToParse.GetProtocolCode() == protocolCode);
+
+    // The caller keeps the buffer, and the protocol data span aliases it rather than a copy.
+    NL_TEST_ASSERT(inSuite, !msgBuf.IsNull());
+    NL_TEST_ASSERT(inSuite, reportToParse.GetProtocolData().IsNull());
+    ByteSpan span = reportToParse.GetProtocolDataSpan();
+    NL_TEST_ASSERT(inSuite, span.size() == dataLen);
+    NL_TEST_ASSERT(inSuite, !memcmp(span.data(), data, dataLen));
+    NL_TEST_ASSERT(inSuite, span.data() >= msgBuf->Start() && span.data() < msgBuf->Start() + msgBuf->DataLength());
+
+    StatusReport badReport;
+    System::PacketBufferHandle badMsg = System::PacketBufferHandle::New(10);
+    NL_TEST_ASSERT(inSuite, badReport.ParseBorrowed(badMsg) != CHIP_NO_ERROR);
+    badMsg = nullptr;
+    NL_TEST_ASSERT(inSuite, badReport.ParseBorrowed(badMsg) != CHIP_NO_ERROR);
+}
+
 void TestBadStatusReport(nlTestSuite * inSuite, void * inContext)
 {
     StatusReport report;
@@ -114,6 +154,7 @@ static const nlTest sTests[] =
 {
     NL_TEST_DEF("TestStatusReport_NoData", TestStatusReport_NoData),
     NL_TEST_DEF("TestStatusReport_WithData", TestStatusReport_WithData),
+    NL_TEST_DEF("TestStatusReport_ParseBorrowed", TestStatusReport_ParseBorrowed),
     NL_TEST_DEF("TestBadStatusReport", TestBadStatusReport),
 
     NL_TEST_SENTINEL()
@@ -25,64 +25,66 @@
 
 namespace {
 
+static constexpr uint8_t kBogus = 255;
+
+// map of base38 charater to numeric value
+// subtract 45 from the charater, then index into this array, if possible
+static constexpr uint8_t kDecodes[] = {
+    36,     // '-', =45
+    37,     // '.', =46
+    kBogus, // '/', =47
+    0,      // '0', =48
+    1,      // '1', =49
+    2,      // '2', =50
+    3,      // '3', =51
+    4,      // '4', =52
+    5,      // '5', =53
+    6,      // '6', =54
+    7,      // '7', =55
+    8,      // '8', =56
+    9,      // '9', =57
+    kBogus, // ':', =58
+    kBogus, // ';', =59
+    kBogus, // '<', =50
+    kBogus, // '=', =61
+    kBogus, // '>', =62
+    kBogus, // '?', =63
+    kBogus, // '@', =64
+    10,     // 'A', =65
+    11,     // 'B', =66
+    12,     // 'C', =67
+    13,     // 'D', =68
+    14,     // 'E', =69
+    15,     // 'F', =70
+    16,     // 'G', =71
+    17,     // 'H', =72
+    18,     // 'I', =73
+    19,     // 'J', =74
+    20,     // 'K', =75
+    21,     // 'L', =76
+    22,     // 'M', =77
+    23,     // 'N', =78
+    24,     // 'O', =79
+    25,     // 'P', =80
+    26,     // 'Q', =81
+    27,     // 'R', =82
+    28,     // 'S', =83
+    29,     // 'T', =84
+    30,     // 'U', =85
+    31,     // 'V', =86
+    32,     // 'W', =87
+    33,     // 'X', =88
+    34,     // 'Y', =89
+    35,     // 'Z', =90
+};
+
 static inline CHIP_ERROR decodeChar(char c, uint8_t & value)
 {
-    static const int kBogus = 255;
-    // map of base38 charater to numeric value
-    // subtract 45 from the charater, then index into this array, if possible
-    const uint8_t decodes[] = {
-        36,     // '-', =45
-        37,     // '.', =46
-        kBogus, // '/', =47
-        0,      // '0', =48
-        1,      // '1', =49
-        2,      // '2', =50
-        3,      // '3', =51
-        4,      // '4', =52
-        5,      // '5', =53
-        6,      // '6', =54
-        7,      // '7', =55
-        8,      // '8', =56
-        9,      // '9', =57
-        kBogus, // ':', =58
-        kBogus, // ';', =59
-        kBogus, // '<', =50
-        kBogus, // '=', =61
-        kBogus, // '>', =62
-        kBogus, // '?', =63
-        kBogus, // '@', =64
-        10,     // 'A', =65
-        11,     // 'B', =66
-        12,     // 'C', =67
-        13,     // 'D', =68
-        14,     // 'E', =69
-        15,     // 'F', =70
-        16,     // 'G', =71
-        17,     // 'H', =72
-        18,     // 'I', =73
-        19,     // 'J', =74
-        20,     // 'K', =75
-        21,     // 'L', =76
-        22,     // 'M', =77
-        23,     // 'N', =78
-        24,     // 'O', =79
-        25,     // 'P', =80
-        26,     // 'Q', =81
-        27,     // 'R', =82
-        28,     // 'S', =83
-        29,     // 'T', =84
-        30,     // 'U', =85
-        31,     // 'V', =86
-        32,     // 'W', =87
-        33,     // 'X', =88
-        34,     // 'Y', =89
-        35,     // 'Z', =90
-    };
     if (c < '-' || c > 'Z')
     {
         return CHIP_ERROR_INVALID_INTEGER_VALUE;
     }
-    uint8_t v = decodes[c - '-'];
+    uint8_t v = kDecodes[c - '-'];
     if (v == kBogus)
     {
         return CHIP_ERROR_INVALID_INTEGER_VALUE;
@@ -95,11 +97,11 @@ static inline CHIP_ERROR decodeChar(char c, uint8_t & value)
 
 namespace chip {
 
-CHIP_ERROR base38Decode(std::string base38, std::vector<uint8_t> & result)
+CHIP_ERROR base38Decode(const CharSpan & base38, MutableByteSpan & out_buf)
 {
-    result.clear();
+    size_t out_idx = 0;
 
-    int base38CharactersNumber  = static_cast<int>(base38.length());
+    int base38CharactersNumber  = static_cast<int>(base38.size());
     int decodedBase38Characters = 0;
     while (base38CharactersNumber > 0)
     {
@@ -131,7 +133,7 @@ CHIP_ERROR base38Decode(std::string base38, std::vector<uint8_t> & result)
         for (int i = (base38CharactersInChunk - 1); i >= 0; i--)
         {
             uint8_t v      = 0;
-            CHIP_ERROR err = decodeChar(base38[static_cast<uint8_t>(decodedBase38Characters + i)], v);
+            CHIP_ERROR err = decodeChar(base38.data()[decodedBase38Characters + i], v);
 
             if (err != CHIP_NO_ERROR)
             {
@@ -145,7 +147,11 @@ CHIP_ERROR base38Decode(std::string base38, std::vector<uint8_t> & result)
 
         for (int i = 0; i < bytesInDecodedChunk; i++)
         {
-            result.push_back(static_cast<uint8_t>(value));
+            if (out_idx >= out_buf.size())
+            {
+                return CHIP_ERROR_BUFFER_TOO_SMALL;
+            }
+            out_buf.data()[out_idx++] = static_cast<uint8_t>(value);
             value >>= 8;
         }
 
@@ -155,7 +161,54 @@ CHIP_ERROR base38Decode(std::string base38, std::vector<uint8_t> & result)
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
     }
+
+    out_buf.reduce_size(out_idx);
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR base38Decode(std::string base38, std::vector<uint8_t> & result)
+{
+    result.clear();
+    result.resize(base38DecodedLength(base38.length()));
+
+    MutableByteSpan out_buf(result.data(), result.size());
+    CHIP_ERROR err = base38Decode(CharSpan(base38.data(), base38.length()), out_buf);
+    if (err != CHIP_NO_ERROR)
+    {
+        result.clear();
+        return err;
+    }
+
+    result.resize(out_buf.size());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR base38Validate(const CharSpan & base38)
+{
+    // Each 5-character group decodes independently into at most 3 bytes, so a
+    // fixed chunk buffer is enough to validate arbitrarily long input without
+    // allocating.
+    constexpr size_t kCharactersPerChunk = kBase38CharactersNeededInNBytesChunk[2];
+
+    size_t offset    = 0;
+    size_t remaining = base38.size();
+    while (remaining > 0)
+    {
+        size_t charactersInChunk = (remaining >= kCharactersPerChunk) ? kCharactersPerChunk : remaining;
+        uint8_t chunk[3];
+        MutableByteSpan chunkSpan(chunk);
+        ReturnErrorOnFailure(base38Decode(base38.SubSpan(offset, charactersInChunk), chunkSpan));
+        offset += charactersInChunk;
+        remaining -= charactersInChunk;
+    }
+    return CHIP_NO_ERROR;
+}
+
+size_t base38DecodedLength(size_t num_chars)
+{
+    // Each full group of 5 characters decodes to 3 bytes; a remainder of 4
+    // characters decodes to 2 bytes and a remainder of 2 characters to 1 byte.
+    return (num_chars / 5) * 3 + (num_chars % 5) / 2;
+}
+
 } // namespace chip
@@ -19,11 +19,25 @@
 
 #include "Base38.h"
 
+#include <lib/support/Span.h>
+
 #include <string>
 #include <vector>
 
 namespace chip {
 
+// Decodes into the caller-provided buffer without allocating; on success
+// out_buf is reduced to the number of bytes actually decoded.
+CHIP_ERROR base38Decode(const CharSpan & base38, MutableByteSpan & out_buf);
+
 CHIP_ERROR base38Decode(std::string base38, std::vector<uint8_t> & out);
 
+// Checks that the given string is a well-formed base38 encoding without
+// keeping the decoded output; usable for cheap screening of scanned payloads.
+CHIP_ERROR base38Validate(const CharSpan & base38);
+
+// returns the number of bytes a base38 string of the given character count
+// decodes to (an upper bound for lengths that are not valid encodings)
+size_t base38DecodedLength(size_t num_chars);
+
 } // namespace chip
@@ -33,7 +33,7 @@
 
 namespace chip {
 
-CHIP_ERROR ManualSetupPayloadParser::CheckDecimalStringValidity(std::string decimalString,
+CHIP_ERROR ManualSetupPayloadParser::CheckDecimalStringValidity(const std::string & decimalString,
                                                                 std::string & decimalStringWithoutCheckDigit)
 {
     if (decimalString.length() < 2)
@@ -41,14 +41,16 @@ CHIP_ERROR ManualSetupPayloadParser::CheckDecimalStringValidity(std::string deci
         ChipLogError(SetupPayload, "Failed decoding base10. Input was empty. %zu", decimalString.length());
         return CHIP_ERROR_INVALID_STRING_LENGTH;
     }
-    std::string repWithoutCheckChar = decimalString.substr(0, decimalString.length() - 1);
-    char checkChar                  = decimalString.back();
 
-    if (!Verhoeff10::ValidateCheckChar(checkChar, repWithoutCheckChar.c_str()))
+    // Validate in place: the payload is simply the string minus its final
+    // (check) character, so no intermediate copy is needed to run the check.
+    char checkChar = decimalString.back();
+
+    if (!Verhoeff10::ValidateCheckChar(checkChar, decimalString.c_str(), decimalString.length() - 1))
     {
         return CHIP_ERROR_INTEGRITY_CHECK_FAILED;
     }
-    decimalStringWithoutCheckDigit = repWithoutCheckChar;
+    decimalStringWithoutCheckDigit = decimalString.substr(0, decimalString.length() - 1);
     return CHIP_NO_ERROR;
 }
 
@@ -91,9 +93,23 @@ CHIP_ERROR ManualSetupPayloadParser::ReadDigitsFromDecimalString(const std::stri
         return CHIP_ERROR_INVALID_STRING_LENGTH;
     }
 
-    std::string decimalSubstring = decimalString.substr(index, numberOfCharsToRead);
+    // Parse the digits in place rather than copying them into a substring
+    // first.
+    uint32_t number = 0;
+    for (size_t i = index; i < index + numberOfCharsToRead; i++)
+    {
+        char c = decimalString[i];
+        if (!isdigit(c))
+        {
+            ChipLogError(SetupPayload, "Failed decoding base10. Character was invalid %c", c);
+            return CHIP_ERROR_INVALID_INTEGER_VALUE;
+        }
+        number *= 10;
+        number += static_cast<uint32_t>(c - '0');
+    }
     index += numberOfCharsToRead;
-    return ToNumber(decimalSubstring, dest);
+    dest = number;
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR ManualSetupPayloadParser::populatePayload(SetupPayload & outPayload)
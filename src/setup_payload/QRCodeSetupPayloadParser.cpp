@@ -41,7 +41,7 @@
 namespace chip {
 
 // Populate numberOfBits into dest from buf starting at startIndex
-static CHIP_ERROR readBits(std::vector<uint8_t> buf, size_t & index, uint64_t & dest, size_t numberOfBitsToRead)
+static CHIP_ERROR readBits(ByteSpan buf, size_t & index, uint64_t & dest, size_t numberOfBitsToRead)
 {
     dest = 0;
     if (index + numberOfBitsToRead > buf.size() * 8 || numberOfBitsToRead > sizeof(uint64_t) * 8)
@@ -54,7 +54,7 @@ static CHIP_ERROR readBits(std::vector<uint8_t> buf, size_t & index, uint64_t &
     size_t currentIndex = index;
     for (size_t bitsRead = 0; bitsRead < numberOfBitsToRead; bitsRead++)
     {
-        if (buf[currentIndex / 8] & (1 << (currentIndex % 8)))
+        if (buf.data()[currentIndex / 8] & (1 << (currentIndex % 8)))
         {
             dest |= (1 << bitsRead);
         }
@@ -261,7 +261,7 @@ CHIP_ERROR QRCodeSetupPayloadParser::parseTLVFields(SetupPayload & outPayload, u
     return err;
 }
 
-CHIP_ERROR QRCodeSetupPayloadParser::populateTLV(SetupPayload & outPayload, const std::vector<uint8_t> & buf, size_t & index)
+CHIP_ERROR QRCodeSetupPayloadParser::populateTLV(SetupPayload & outPayload, ByteSpan buf, size_t & index)
 {
     size_t bitsLeftToRead = (buf.size() * 8) - index;
     size_t tlvBytesLength = (bitsLeftToRead + 7) / 8; // ceil(bitsLeftToRead/8)
@@ -323,14 +323,18 @@ std::string QRCodeSetupPayloadParser::ExtractPayload(std::string inString)
 
 CHIP_ERROR QRCodeSetupPayloadParser::populatePayload(SetupPayload & outPayload)
 {
-    std::vector<uint8_t> buf;
     size_t indexToReadFrom = 0;
     uint64_t dest;
 
     std::string payload = ExtractPayload(mBase38Representation);
     VerifyOrReturnError(payload.length() != 0, CHIP_ERROR_INVALID_ARGUMENT);
 
-    ReturnErrorOnFailure(base38Decode(payload, buf));
+    Platform::ScopedMemoryBuffer<uint8_t> decodeBuf;
+    decodeBuf.Alloc(base38DecodedLength(payload.length()));
+    ReturnErrorCodeIf(!decodeBuf, CHIP_ERROR_NO_MEMORY);
+
+    MutableByteSpan buf(decodeBuf.Get(), base38DecodedLength(payload.length()));
+    ReturnErrorOnFailure(base38Decode(CharSpan(payload.data(), payload.length()), buf));
 
     ReturnErrorOnFailure(readBits(buf, indexToReadFrom, dest, kVersionFieldLengthInBits));
     static_assert(kVersionFieldLengthInBits <= 8, "Won't fit in uint8_t");
@@ -27,6 +27,7 @@
 
 #include <lib/core/CHIPError.h>
 #include <lib/core/CHIPTLV.h>
+#include <lib/support/Span.h>
 
 #include <string>
 #include <utility>
@@ -49,7 +50,7 @@ public:
 
 private:
     CHIP_ERROR retrieveOptionalInfos(SetupPayload & outPayload, TLV::ContiguousBufferTLVReader & reader);
-    CHIP_ERROR populateTLV(SetupPayload & outPayload, const std::vector<uint8_t> & buf, size_t & index);
+    CHIP_ERROR populateTLV(SetupPayload & outPayload, ByteSpan buf, size_t & index);
     CHIP_ERROR parseTLVFields(chip::SetupPayload & outPayload, uint8_t * tlvDataStart, size_t tlvDataLengthInBytes);
 };
 
@@ -418,6 +418,31 @@ void TestCheckDecimalStringValidity(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, outReprensation == representationWithoutCheckDigit);
 }
 
+void TestVerhoeffBatchValidation(nlTestSuite * inSuite, void * inContext)
+{
+    std::string valid1 = "10109";
+    valid1 += Verhoeff10::ComputeCheckChar(valid1.c_str());
+
+    std::string valid2 = "64129";
+    valid2 += Verhoeff10::ComputeCheckChar(valid2.c_str());
+
+    // Corrupt a copy of valid1 by bumping its check digit.
+    std::string invalid = valid1;
+    invalid.back()      = static_cast<char>('0' + ((invalid.back() - '0' + 1) % 10));
+
+    const char * strings[] = { valid1.c_str(), valid2.c_str(), invalid.c_str() };
+    const size_t strLens[] = { valid1.length(), valid2.length(), invalid.length() };
+    bool results[3];
+
+    NL_TEST_ASSERT(inSuite, Verhoeff10::ValidateCheckChars(strings, strLens, 3, results) == 2);
+    NL_TEST_ASSERT(inSuite, results[0]);
+    NL_TEST_ASSERT(inSuite, results[1]);
+    NL_TEST_ASSERT(inSuite, !results[2]);
+
+    // Both the lengths and the per-string results are optional.
+    NL_TEST_ASSERT(inSuite, Verhoeff10::ValidateCheckChars(strings, nullptr, 3, nullptr) == 2);
+}
+
 void TestCheckCodeLengthValidity(nlTestSuite * inSuite, void * inContext)
 {
     NL_TEST_ASSERT(inSuite, ManualSetupPayloadParser::CheckCodeLengthValidity("01234567890123456789", true) == CHIP_NO_ERROR);
@@ -532,6 +557,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("Test Short Read Write",                                                TestShortCodeReadWrite),
     NL_TEST_DEF("Test Long Read Write",                                                 TestLongCodeReadWrite),
     NL_TEST_DEF("Check Decimal String Validity",                                        TestCheckDecimalStringValidity),
+    NL_TEST_DEF("Test Verhoeff Batch Validation",                                       TestVerhoeffBatchValidation),
     NL_TEST_DEF("Check QR Code Length Validity",                                        TestCheckCodeLengthValidity),
     NL_TEST_DEF("Test Decimal String to Number",                                        TestDecimalStringToNumber),
     NL_TEST_DEF("Test Short Code Character Lengths",                                    TestShortCodeCharLengths),
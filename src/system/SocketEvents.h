@@ -34,6 +34,19 @@ using SocketEvents = BitFlags<SocketEventFlags>;
 using SocketWatchToken    = intptr_t;
 using SocketWatchCallback = void (*)(SocketEvents events, intptr_t data);
 
+/**
+ *  Dispatch lane for a watched socket. Within one pass of the event loop, ready
+ *  sockets are dispatched in lane order: kHigh first, then kNormal, then
+ *  kBackground. Every ready socket is still serviced on every pass, so lower
+ *  lanes add latency behind higher ones but cannot be starved.
+ */
+enum class SocketWatchPriority : uint8_t
+{
+    kHigh       = 0, /**< Time-critical traffic (e.g. the secure Matter transport). */
+    kNormal     = 1, /**< Default lane for sockets with no declared priority. */
+    kBackground = 2, /**< Chatty, latency-tolerant traffic (e.g. mDNS). */
+};
+
 constexpr int kInvalidFd = -1;
 
 } // namespace System
@@ -140,8 +140,42 @@ public:
      *
      * Although some platforms may choose to return a value that measures the time since boot for the
      * system, applications must *not* rely on this.
+     *
+     * While the event loop is dispatching — between the RefreshCachedMonotonicTimestamp() and
+     * InvalidateCachedMonotonicTimestamp() calls made by the system layer — the value is served
+     * from a per-dispatch-cycle cache instead of reading the platform clock, so the many
+     * timestamp reads on an inbound message path cost one clock read per cycle.  The cached
+     * value can lag the real clock by the length of the dispatch cycle; callers that need the
+     * clock actually re-read should use GetPreciseMonotonicTimestamp().
+     */
+    Timestamp GetMonotonicTimestamp()
+    {
+        return mCachedTimestampValid ? mCachedTimestamp : Timestamp(GetMonotonicMilliseconds64());
+    }
+
+    /**
+     * Returns a monotonic system time, always reading the platform clock.
+     *
+     * Use this instead of GetMonotonicTimestamp() when measuring durations within a single
+     * event-loop dispatch cycle, where the cached value would make the interval read as zero.
      */
-    Timestamp GetMonotonicTimestamp() { return GetMonotonicMilliseconds64(); }
+    Timestamp GetPreciseMonotonicTimestamp() { return GetMonotonicMilliseconds64(); }
+
+    /**
+     * Re-reads the platform clock and serves that value from GetMonotonicTimestamp() until the
+     * next refresh or invalidation.  Called by the event loop once at the start of each dispatch
+     * cycle; the loop must invalidate the cache before blocking for events so that timestamps
+     * taken outside dispatch remain precise.
+     */
+    Timestamp RefreshCachedMonotonicTimestamp()
+    {
+        mCachedTimestamp      = GetMonotonicMilliseconds64();
+        mCachedTimestampValid = true;
+        return mCachedTimestamp;
+    }
+
+    /// Stops serving cached values from GetMonotonicTimestamp().
+    void InvalidateCachedMonotonicTimestamp() { mCachedTimestampValid = false; }
 
     /**
      * Returns a monotonic system time in units of microseconds.
@@ -279,6 +313,10 @@ public:
      *                                      current time.
      */
     virtual CHIP_ERROR SetClock_RealTime(Microseconds64 aNewCurTime) = 0;
+
+private:
+    Timestamp mCachedTimestamp = Timestamp(0);
+    bool mCachedTimestampValid = false;
 };
 
 // Currently we have a single implementation class, ClockImpl, whose members are implemented in build-specific files.
@@ -320,6 +320,55 @@
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 15
 #endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE
+ *
+ *  @brief
+ *      This defines whether (1) or not (0) heap-allocated packet buffers are recycled through a small
+ *      free-list cache segregated by block size, instead of every allocation and release going to the
+ *      platform allocator.
+ *
+ *      Only meaningful when packet buffers are allocated from the heap, i.e. when
+ *      \c CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE is zero (0). The cache trades a bounded amount of
+ *      retained memory for reduced allocator traffic and heap fragmentation under sustained buffer churn.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_DEPTH
+ *
+ *  @brief
+ *      The maximum number of freed packet buffers retained per block size class when
+ *      \c CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE is enabled.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_DEPTH
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_DEPTH 8
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_DEPTH */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_ARENA_SIZE
+ *
+ *  @brief
+ *      Size, in bytes, of a contiguous arena from which heap cache packet buffer blocks are carved
+ *      before falling back to the platform allocator. Zero (0, the default) disables the arena.
+ *
+ *      Requires \c CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE, since arena blocks are recycled
+ *      exclusively through the free-list cache and are never returned to the platform allocator.
+ *      On Linux the arena is mapped with \c MAP_HUGETLB when the system provides hugepages,
+ *      falling back to a normal anonymous mapping marked \c MADV_HUGEPAGE. Keeping the hot buffer
+ *      working set in a few large pages reduces TLB pressure for server builds handling many
+ *      concurrent sessions.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_ARENA_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_ARENA_SIZE 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_ARENA_SIZE */
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_ARENA_SIZE > 0 && !CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE
+#error "CHIP_SYSTEM_CONFIG_PACKETBUFFER_ARENA_SIZE requires CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE"
+#endif
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX
  *
@@ -439,6 +488,65 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_NUM_TIMERS 32
 #endif /* CHIP_SYSTEM_CONFIG_NUM_TIMERS */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+ *
+ *  @brief
+ *      This defines whether (1) or not (0) the System Layer keeps pending timers in a hashed timer
+ *      wheel instead of a time-ordered linked list.  The wheel makes starting and cancelling a timer
+ *      O(1) regardless of the number of pending timers, at the cost of a small fixed bucket array,
+ *      and is intended for configurations that raise CHIP_SYSTEM_CONFIG_NUM_TIMERS well beyond its
+ *      default.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+#define CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL 0
+#endif /* CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TIMER_WHEEL_NUM_BUCKETS
+ *
+ *  @brief
+ *      The number of buckets in the timer wheel when CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL is enabled.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TIMER_WHEEL_NUM_BUCKETS
+#define CHIP_SYSTEM_CONFIG_TIMER_WHEEL_NUM_BUCKETS 64
+#endif /* CHIP_SYSTEM_CONFIG_TIMER_WHEEL_NUM_BUCKETS */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TIMER_WHEEL_BUCKET_WIDTH_MS
+ *
+ *  @brief
+ *      The width, in milliseconds, of each timer wheel bucket when CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+ *      is enabled.  Timers whose expirations fall within the same bucket width hash to the same bucket.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TIMER_WHEEL_BUCKET_WIDTH_MS
+#define CHIP_SYSTEM_CONFIG_TIMER_WHEEL_BUCKET_WIDTH_MS 8
+#endif /* CHIP_SYSTEM_CONFIG_TIMER_WHEEL_BUCKET_WIDTH_MS */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+ *
+ *  @brief
+ *      This defines whether (1) or not (0) lambdas scheduled from foreign threads are posted through
+ *      a bounded lock-free MPSC queue drained by the event loop, with a single coalesced wakeup per
+ *      batch, instead of being funneled through the platform event queue and its lock.  Currently
+ *      supported by the select()-based System::Layer implementation.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+#define CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE 0
+#endif /* CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE_SIZE
+ *
+ *  @brief
+ *      The capacity (a power of two) of the cross-thread work queue when
+ *      CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE is enabled.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE_SIZE
+#define CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE_SIZE 64
+#endif /* CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE_SIZE */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
  *
@@ -450,6 +558,17 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS 0
 #endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_EVENT_LOOP_PROFILING
+ *
+ *  @brief
+ *      This defines whether (1) or not (0) the CHIP System Layer event loop records per-callback-site
+ *      dispatch latency histograms for diagnostic purposes. See EventLoopProfiler.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_EVENT_LOOP_PROFILING
+#define CHIP_SYSTEM_CONFIG_EVENT_LOOP_PROFILING 0
+#endif // CHIP_SYSTEM_CONFIG_EVENT_LOOP_PROFILING
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_TEST
  *
@@ -0,0 +1,94 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *  This file implements the event loop profiler.
+ */
+
+#include <system/SystemEventLoopProfiler.h>
+
+#include <string.h>
+
+namespace chip {
+namespace System {
+
+const uint32_t EventLoopProfiler::kBucketLimitsMicros[EventLoopProfiler::kNumBuckets - 1] = { 100,   300,   1000,  3000,
+                                                                                              10000, 30000, 100000 };
+
+EventLoopProfiler & EventLoopProfiler::Instance()
+{
+    static EventLoopProfiler sInstance;
+    return sInstance;
+}
+
+void EventLoopProfiler::RecordDispatch(void * callback, SiteKind kind, Clock::Microseconds64 duration)
+{
+    Site * site = nullptr;
+
+    for (size_t i = 0; i < mSiteCount; i++)
+    {
+        if (mSites[i].mCallback == callback && mSites[i].mKind == kind)
+        {
+            site = &mSites[i];
+            break;
+        }
+    }
+
+    if (site == nullptr)
+    {
+        if (mSiteCount == kMaxSites)
+        {
+            mDroppedDispatches++;
+            return;
+        }
+        site            = &mSites[mSiteCount++];
+        site->mCallback = callback;
+        site->mKind     = kind;
+    }
+
+    const uint64_t micros  = duration.count();
+    const uint32_t clamped = (micros > UINT32_MAX) ? UINT32_MAX : static_cast<uint32_t>(micros);
+
+    site->mCount++;
+    site->mTotalMicros += micros;
+    if (site->mMaxMicros < clamped)
+    {
+        site->mMaxMicros = clamped;
+    }
+
+    size_t bucket = kNumBuckets - 1;
+    for (size_t i = 0; i < kNumBuckets - 1; i++)
+    {
+        if (clamped < kBucketLimitsMicros[i])
+        {
+            bucket = i;
+            break;
+        }
+    }
+    site->mBuckets[bucket]++;
+}
+
+void EventLoopProfiler::Reset()
+{
+    memset(mSites, 0, sizeof(mSites));
+    mSiteCount         = 0;
+    mDroppedDispatches = 0;
+}
+
+} // namespace System
+} // namespace chip
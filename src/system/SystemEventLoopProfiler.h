@@ -0,0 +1,104 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *  This file declares the event loop profiler, which accumulates per-callback-site
+ *  dispatch latency histograms for callbacks invoked by the CHIP System Layer event loop.
+ */
+
+#pragma once
+
+#include <lib/support/DLLUtil.h>
+#include <system/SystemClock.h>
+#include <system/SystemConfig.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * Accumulates dispatch latency statistics for the callbacks invoked by the event loop.
+ *
+ * Each distinct callback function (a "site") gets a histogram of its observed dispatch
+ * durations along with a running count, total and maximum, making it possible to see
+ * which handler is stalling the loop. Sites are keyed by the callback's address;
+ * symbolize the reported pointers against the binary to attribute time to specific
+ * handlers.
+ *
+ * The profiler is only fed by the event loop when CHIP_SYSTEM_CONFIG_EVENT_LOOP_PROFILING
+ * is enabled. All recording and reporting happens on the event loop thread, so no locking
+ * is used.
+ */
+class DLL_EXPORT EventLoopProfiler
+{
+public:
+    enum class SiteKind : uint8_t
+    {
+        kTimer,  /**< A timer completion callback. */
+        kSocket, /**< A socket watch callback. */
+    };
+
+    static constexpr size_t kMaxSites   = 24;
+    static constexpr size_t kNumBuckets = 8;
+
+    /* Upper bounds (exclusive, in microseconds) of the first kNumBuckets - 1 histogram
+       buckets; the last bucket counts all dispatches at or above the largest bound. */
+    static const uint32_t kBucketLimitsMicros[kNumBuckets - 1];
+
+    struct Site
+    {
+        void * mCallback;
+        SiteKind mKind;
+        uint32_t mCount;
+        uint64_t mTotalMicros;
+        uint32_t mMaxMicros;
+        uint32_t mBuckets[kNumBuckets];
+    };
+
+    /**
+     * Record one dispatched callback. Creates a new site entry for previously unseen
+     * callbacks; once the site table is full, further dispatches from unknown sites are
+     * counted as dropped rather than recorded.
+     */
+    void RecordDispatch(void * callback, SiteKind kind, Clock::Microseconds64 duration);
+
+    /**
+     * Discard all recorded sites and the dropped-dispatch count.
+     */
+    void Reset();
+
+    size_t GetSiteCount() const { return mSiteCount; }
+    const Site & GetSite(size_t index) const { return mSites[index]; }
+
+    /**
+     * Number of dispatches that could not be recorded because the site table was full.
+     */
+    uint32_t GetDroppedDispatches() const { return mDroppedDispatches; }
+
+    static EventLoopProfiler & Instance();
+
+private:
+    Site mSites[kMaxSites]      = {};
+    size_t mSiteCount           = 0;
+    uint32_t mDroppedDispatches = 0;
+};
+
+} // namespace System
+} // namespace chip
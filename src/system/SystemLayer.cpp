@@ -23,7 +23,12 @@ namespace System {
 
 CHIP_ERROR Layer::ScheduleLambdaBridge(LambdaBridge && bridge)
 {
+#if CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+    // With CHIP_SYSTEM_CONFIG_USE_SOCKETS, the layer is always a LayerSocketsLoop.
+    CHIP_ERROR lReturn = static_cast<LayerSocketsLoop *>(this)->PostLambdaBridge(std::move(bridge));
+#else
     CHIP_ERROR lReturn = PlatformEventing::ScheduleLambdaBridge(*this, std::move(bridge));
+#endif
     if (lReturn != CHIP_NO_ERROR)
     {
         ChipLogError(chipSystemLayer, "Failed to queue CHIP System Layer lambda event: %s", ErrorStr(lReturn));
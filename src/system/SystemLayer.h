@@ -201,6 +201,14 @@ public:
      */
     virtual CHIP_ERROR SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data) = 0;
 
+    /**
+     * Assign the associated file descriptor to a dispatch lane (see SocketWatchPriority).
+     *
+     * Sockets default to SocketWatchPriority::kNormal. Implementations that do not order their
+     * dispatch may ignore this hint.
+     */
+    virtual CHIP_ERROR SetWatchPriority(SocketWatchToken token, SocketWatchPriority priority) { return CHIP_NO_ERROR; }
+
     /**
      * Request a callback when the associated file descriptor is readable.
      */
@@ -245,6 +253,14 @@ public:
     virtual void HandleEvents()    = 0;
     virtual void EventLoopEnds()   = 0;
 
+#if CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+    /**
+     * Post a lambda from any thread, to be invoked by the event loop.  The wakeup of the
+     * event loop is coalesced: only the post that finds the queue empty signals it.
+     */
+    virtual CHIP_ERROR PostLambdaBridge(LambdaBridge && bridge) = 0;
+#endif // CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+
 #if CHIP_SYSTEM_CONFIG_USE_DISPATCH
     virtual void SetDispatchQueue(dispatch_queue_t dispatchQueue) = 0;
     virtual dispatch_queue_t GetDispatchQueue()                   = 0;
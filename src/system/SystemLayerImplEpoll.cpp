@@ -0,0 +1,477 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Layer using Linux epoll.
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TimeUtils.h>
+#include <platform/LockTracker.h>
+#include <system/SystemFaultInjection.h>
+#include <system/SystemLayer.h>
+#include <system/SystemLayerImplEpoll.h>
+
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+
+// Choose an approximation of PTHREAD_NULL if pthread.h doesn't define one.
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+#define PTHREAD_NULL 0
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+
+namespace chip {
+namespace System {
+
+constexpr Clock::Seconds64 kDefaultMinSleepPeriod = Clock::Seconds64(60 * 60 * 24 * 30); // Month [sec]
+
+namespace {
+
+uint32_t EpollMaskFromSocketEvents(SocketEvents events)
+{
+    uint32_t mask = 0;
+    if (events.Has(SocketEventFlags::kRead))
+    {
+        mask |= EPOLLIN;
+    }
+    if (events.Has(SocketEventFlags::kWrite))
+    {
+        mask |= EPOLLOUT;
+    }
+    return mask;
+}
+
+} // namespace
+
+CHIP_ERROR LayerImplEpoll::Init()
+{
+    VerifyOrReturnError(mLayerState.SetInitializing(), CHIP_ERROR_INCORRECT_STATE);
+
+    RegisterPOSIXErrorFormatter();
+
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrReturnError(mEpollFd >= 0, CHIP_ERROR_POSIX(errno));
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Create an event to allow an arbitrary thread to wake the thread in the event loop.
+    // The wake event's read descriptor is watched like any other socket.
+    ReturnErrorOnFailure(mWakeEvent.Open(*this));
+
+    VerifyOrReturnError(mLayerState.SetInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::Shutdown()
+{
+    VerifyOrReturnError(mLayerState.SetShuttingDown(), CHIP_ERROR_INCORRECT_STATE);
+
+    mTimerList.Clear();
+    mTimerPool.ReleaseAll();
+
+    mWakeEvent.Close(*this);
+
+    mActiveSocketWatches.clear();
+    mSocketWatches.clear();
+
+    if (mEpollFd >= 0)
+    {
+        close(mEpollFd);
+        mEpollFd = -1;
+    }
+
+    mLayerState.ResetFromShuttingDown(); // Return to uninitialized state to permit re-initialization.
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplEpoll::Signal()
+{
+    /*
+     * Wake up the I/O thread by notifying the wake event.
+     *
+     * If this is being called from within an I/O event callback, then the notification can be skipped,
+     * since the I/O thread is already awake.
+     */
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    if (pthread_equal(mHandleSelectThread, pthread_self()))
+    {
+        return;
+    }
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    CHIP_ERROR status = mWakeEvent.Notify();
+    if (status != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipSystemLayer, "System wake event notify failed: %" CHIP_ERROR_FORMAT, status.Format());
+    }
+}
+
+#if CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+CHIP_ERROR LayerImplEpoll::PostLambdaBridge(LambdaBridge && bridge)
+{
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    bool wasEmpty;
+    VerifyOrReturnError(mCrossThreadWorkQueue.Enqueue(bridge, wasEmpty), CHIP_ERROR_NO_MEMORY);
+
+    // Only the producer that finds the queue empty needs to wake the event loop; posts
+    // racing with a non-empty queue coalesce into the pending wakeup.
+    if (wasEmpty)
+    {
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+
+CHIP_ERROR LayerImplEpoll::StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_TimeoutImmediate, delay = System::Clock::kZero);
+
+    CancelTimer(onComplete, appState);
+
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplEpoll::CancelTimer(TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturn(mLayerState.IsInitialized());
+
+    TimerList::Node * timer = mTimerList.Remove(onComplete, appState);
+    VerifyOrReturn(timer != nullptr);
+
+    mTimerPool.Release(timer);
+    Signal();
+}
+
+CHIP_ERROR LayerImplEpoll::ScheduleWork(TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CancelTimer(onComplete, appState);
+
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::StartWatchingSocket(int fd, SocketWatchToken * tokenOut)
+{
+    for (auto & w : mSocketWatches)
+    {
+        if (w->mFD == fd)
+        {
+            // Duplicate registration is an error.
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    mSocketWatches.push_back(std::make_unique<SocketWatch>());
+    SocketWatch * watch = mSocketWatches.back().get();
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    watch->Clear();
+    watch->mFD = fd;
+
+    *tokenOut = reinterpret_cast<SocketWatchToken>(watch);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mCallback     = callback;
+    watch->mCallbackData = data;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::SetWatchPriority(SocketWatchToken token, SocketWatchPriority priority)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPriority = priority;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kRead);
+    return UpdateInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kWrite);
+    return UpdateInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    watch->mPendingIO.Clear(SocketEventFlags::kRead);
+    return UpdateInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    watch->mPendingIO.Clear(SocketEventFlags::kWrite);
+    return UpdateInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::StopWatchingSocket(SocketWatchToken * tokenInOut)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(*tokenInOut);
+    *tokenInOut         = InvalidSocketWatchToken();
+
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(watch->mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    if (watch->mArmedIO.HasAny() && mEpollFd >= 0)
+    {
+        if (epoll_ctl(mEpollFd, EPOLL_CTL_DEL, watch->mFD, nullptr) != 0)
+        {
+            ChipLogError(chipSystemLayer, "epoll_ctl(DEL) failed: %s", ErrorStr(CHIP_ERROR_POSIX(errno)));
+        }
+    }
+
+    mActiveSocketWatches.remove(watch);
+    mSocketWatches.remove_if([watch](const std::unique_ptr<SocketWatch> & w) { return w.get() == watch; });
+
+    // No Signal() is needed here: unlike select(), epoll_ctl(DEL) takes effect on an
+    // epoll_wait() already in progress.
+
+    return CHIP_NO_ERROR;
+}
+
+/**
+ *  Translate an epoll event mask into socket event flags.
+ *
+ *  Hangup and error conditions are reported as readability, matching select()
+ *  semantics: the client's read attempt observes the error or end-of-stream.
+ */
+SocketEvents LayerImplEpoll::SocketEventsFromEpollMask(uint32_t mask)
+{
+    SocketEvents res;
+
+    if (mask & (EPOLLIN | EPOLLHUP | EPOLLERR))
+        res.Set(SocketEventFlags::kRead);
+    if (mask & EPOLLOUT)
+        res.Set(SocketEventFlags::kWrite);
+    if (mask & EPOLLPRI)
+        res.Set(SocketEventFlags::kExcept);
+
+    return res;
+}
+
+CHIP_ERROR LayerImplEpoll::UpdateInterest(SocketWatch & watch)
+{
+    const uint32_t desired = EpollMaskFromSocketEvents(watch.mPendingIO);
+    const uint32_t armed   = EpollMaskFromSocketEvents(watch.mArmedIO);
+    if (desired == armed)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    // A watch leaves the interest list entirely when no events are wanted, so an
+    // idle descriptor that hangs up cannot spin the event loop.
+    const int op = (armed == 0) ? EPOLL_CTL_ADD : (desired == 0) ? EPOLL_CTL_DEL : EPOLL_CTL_MOD;
+
+    epoll_event event = {};
+    event.events      = desired;
+    event.data.ptr    = &watch;
+    VerifyOrReturnError(epoll_ctl(mEpollFd, op, watch.mFD, &event) == 0, CHIP_ERROR_POSIX(errno));
+
+    watch.mArmedIO = watch.mPendingIO;
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplEpoll::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    const Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    Clock::Timestamp awakenTime        = currentTime + kDefaultMinSleepPeriod;
+
+    TimerList::Node * timer = mTimerList.Earliest();
+    if (timer && timer->AwakenTime() < awakenTime)
+    {
+        awakenTime = timer->AwakenTime();
+    }
+
+    // The interest list is maintained incrementally, so only the timeout needs
+    // to be computed here.
+    const Clock::Timestamp sleepTime = (awakenTime > currentTime) ? (awakenTime - currentTime) : Clock::kZero;
+    const uint64_t sleepMillis       = Clock::Milliseconds64(sleepTime).count();
+    mNextTimeoutMs                   = (sleepMillis > INT_MAX) ? INT_MAX : static_cast<int>(sleepMillis);
+}
+
+void LayerImplEpoll::WaitForEvents()
+{
+    mReadyCount = epoll_wait(mEpollFd, mReadyEvents, kMaxReadyEvents, mNextTimeoutMs);
+}
+
+void LayerImplEpoll::HandleEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    if (mReadyCount < 0)
+    {
+        if (errno != EINTR)
+        {
+            ChipLogError(chipSystemLayer, "epoll_wait failed: %s", ErrorStr(CHIP_ERROR_POSIX(errno)));
+        }
+        mReadyCount = 0;
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // One clock read serves every timestamp taken while dispatching this cycle.
+    SystemClock().RefreshCachedMonotonicTimestamp();
+
+    // Gather ready events into per-watch masks and an active list before dispatching,
+    // so a callback that stops another watch cannot leave a dangling pointer behind.
+    // Each pointer is checked against the watch list: a foreign thread may have stopped
+    // a watch while epoll_wait() was completing, leaving a stale pointer in the batch.
+    for (int i = 0; i < mReadyCount; i++)
+    {
+        SocketWatch * watch = nullptr;
+        for (auto & w : mSocketWatches)
+        {
+            if (w.get() == mReadyEvents[i].data.ptr)
+            {
+                watch = w.get();
+                break;
+            }
+        }
+        if (watch == nullptr)
+        {
+            continue;
+        }
+        if (!watch->mReadyIO.HasAny())
+        {
+            mActiveSocketWatches.push_back(watch);
+        }
+        watch->mReadyIO.SetRaw(watch->mReadyIO.Raw() | SocketEventsFromEpollMask(mReadyEvents[i].events).Raw());
+    }
+    mReadyCount = 0;
+
+#if CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+    // Drain work posted from foreign threads.  The queue must be drained until empty:
+    // producers skip the wakeup when they observe a non-empty queue, counting on the
+    // consumer still being inside this loop to pick the work up.
+    LambdaBridge bridge;
+    while (mCrossThreadWorkQueue.Dequeue(bridge))
+    {
+        bridge();
+    }
+#endif // CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+
+    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
+    // since that could result in infinite handling of new timers blocking any other progress.
+    TimerList expiredTimers = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
+    TimerList::Node * timer = nullptr;
+    while ((timer = expiredTimers.PopEarliest()) != nullptr)
+    {
+        mTimerPool.Invoke(timer);
+    }
+
+    // Dispatch ready sockets one lane at a time, so that time-critical traffic is serviced
+    // ahead of chatty background sockets. Every ready socket is still dispatched on every
+    // pass, so lower lanes are delayed but never starved.
+    for (SocketWatchPriority lane : { SocketWatchPriority::kHigh, SocketWatchPriority::kNormal, SocketWatchPriority::kBackground })
+    {
+        // The active list is rescanned after every dispatch because the callback may
+        // stop any watch, removing it (and invalidating iterators) behind our back.
+        for (;;)
+        {
+            SocketWatch * watch = nullptr;
+            for (auto it = mActiveSocketWatches.begin(); it != mActiveSocketWatches.end(); ++it)
+            {
+                if ((*it)->mPriority == lane)
+                {
+                    watch = *it;
+                    mActiveSocketWatches.erase(it);
+                    break;
+                }
+            }
+            if (watch == nullptr)
+            {
+                break;
+            }
+            SocketEvents events = watch->mReadyIO;
+            watch->mReadyIO.ClearAll();
+            if (events.HasAny() && watch->mCallback != nullptr)
+            {
+                watch->mCallback(events, watch->mCallbackData);
+            }
+        }
+    }
+
+    SystemClock().InvalidateCachedMonotonicTimestamp();
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+void LayerImplEpoll::SocketWatch::Clear()
+{
+    mFD = kInvalidFd;
+    mPendingIO.ClearAll();
+    mArmedIO.ClearAll();
+    mReadyIO.ClearAll();
+    mPriority     = SocketWatchPriority::kNormal;
+    mCallback     = nullptr;
+    mCallbackData = 0;
+}
+
+} // namespace System
+} // namespace chip
@@ -0,0 +1,143 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares an implementation of System::Layer using Linux epoll.
+ */
+
+#pragma once
+
+#include <sys/epoll.h>
+
+#include <list>
+#include <memory>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <atomic>
+#include <pthread.h>
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+#if CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+#include <lib/support/BoundedMPSCQueue.h>
+#endif
+#include <lib/support/ObjectLifeCycle.h>
+#include <system/SystemLayer.h>
+#include <system/SystemTimer.h>
+#include <system/WakeEvent.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * Implementation of LayerSocketsLoop that multiplexes socket readiness through
+ * a persistent epoll interest list instead of select().
+ *
+ * The kernel interest list is updated incrementally as clients request or clear
+ * callbacks, so nothing is rebuilt per loop iteration, and epoll_wait() reports
+ * only the descriptors that are actually ready, making dispatch O(ready) rather
+ * than O(watched).  Watches are heap-allocated, so the number of watched
+ * sockets is bounded only by memory, not by a fixed pool size.
+ */
+class LayerImplEpoll : public LayerSocketsLoop
+{
+public:
+    LayerImplEpoll() = default;
+    ~LayerImplEpoll() { VerifyOrDie(mLayerState.Destroy()); }
+
+    // Layer overrides.
+    CHIP_ERROR Init() override;
+    CHIP_ERROR Shutdown() override;
+    bool IsInitialized() const override { return mLayerState.IsInitialized(); }
+    CHIP_ERROR StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState) override;
+    void CancelTimer(TimerCompleteCallback onComplete, void * appState) override;
+    CHIP_ERROR ScheduleWork(TimerCompleteCallback onComplete, void * appState) override;
+
+    // LayerSocket overrides.
+    CHIP_ERROR StartWatchingSocket(int fd, SocketWatchToken * tokenOut) override;
+    CHIP_ERROR SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data) override;
+    CHIP_ERROR SetWatchPriority(SocketWatchToken token, SocketWatchPriority priority) override;
+    CHIP_ERROR RequestCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR RequestCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR StopWatchingSocket(SocketWatchToken * tokenInOut) override;
+    SocketWatchToken InvalidSocketWatchToken() override { return reinterpret_cast<SocketWatchToken>(nullptr); }
+
+    // LayerSocketLoop overrides.
+    void Signal() override;
+#if CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+    CHIP_ERROR PostLambdaBridge(LambdaBridge && bridge) override;
+#endif
+    void EventLoopBegins() override {}
+    void PrepareEvents() override;
+    void WaitForEvents() override;
+    void HandleEvents() override;
+    void EventLoopEnds() override {}
+
+protected:
+    static SocketEvents SocketEventsFromEpollMask(uint32_t mask);
+
+    // The most descriptors one epoll_wait() call reports.  A smaller batch only
+    // means another wait cycle, not lost events: epoll is level-triggered here.
+    static constexpr int kMaxReadyEvents = 16;
+
+    struct SocketWatch
+    {
+        void Clear();
+        int mFD;
+        SocketEvents mPendingIO; ///< Events the client wants callbacks for.
+        SocketEvents mArmedIO;   ///< Events currently in the kernel interest list.
+        SocketEvents mReadyIO;   ///< Events reported by epoll_wait(), pending dispatch.
+        SocketWatchPriority mPriority;
+        SocketWatchCallback mCallback;
+        intptr_t mCallbackData;
+    };
+
+    // Reconcile the kernel interest list with mPendingIO for one watch.
+    CHIP_ERROR UpdateInterest(SocketWatch & watch);
+
+    // Watches are heap-allocated; tokens are stable pointers into this list.
+    std::list<std::unique_ptr<SocketWatch>> mSocketWatches;
+    // Watches with ready events awaiting dispatch.  StopWatchingSocket() removes
+    // its watch from here, so a callback can safely stop any watch.
+    std::list<SocketWatch *> mActiveSocketWatches;
+
+    TimerPool<TimerList::Node> mTimerPool;
+    TimerQueue mTimerList;
+
+    int mEpollFd = -1;
+    epoll_event mReadyEvents[kMaxReadyEvents];
+    int mReadyCount    = 0;
+    int mNextTimeoutMs = 0;
+
+    ObjectLifeCycle mLayerState;
+    WakeEvent mWakeEvent;
+
+#if CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+    BoundedMPSCQueue<LambdaBridge, CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE_SIZE> mCrossThreadWorkQueue;
+#endif
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    std::atomic<pthread_t> mHandleSelectThread;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+};
+
+using LayerImpl = LayerImplEpoll;
+
+} // namespace System
+} // namespace chip
@@ -408,6 +408,9 @@ void LayerImplLibevent::HandleEvents()
     mHandleSelectThread = pthread_self();
 #endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
 
+    // One clock read serves every timestamp taken while dispatching this cycle.
+    SystemClock().RefreshCachedMonotonicTimestamp();
+
     while (!mActiveSocketWatches.empty())
     {
         SocketWatch * const watch = mActiveSocketWatches.front();
@@ -418,6 +421,8 @@ void LayerImplLibevent::HandleEvents()
         }
     }
 
+    SystemClock().InvalidateCachedMonotonicTimestamp();
+
 #if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
     mHandleSelectThread = PTHREAD_NULL;
 #endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
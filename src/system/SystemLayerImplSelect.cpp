@@ -28,6 +28,10 @@
 #include <system/SystemLayer.h>
 #include <system/SystemLayerImplSelect.h>
 
+#if CHIP_SYSTEM_CONFIG_EVENT_LOOP_PROFILING
+#include <system/SystemEventLoopProfiler.h>
+#endif // CHIP_SYSTEM_CONFIG_EVENT_LOOP_PROFILING
+
 #include <errno.h>
 
 // Choose an approximation of PTHREAD_NULL if pthread.h doesn't define one.
@@ -116,6 +120,24 @@ void LayerImplSelect::Signal()
     }
 }
 
+#if CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+CHIP_ERROR LayerImplSelect::PostLambdaBridge(LambdaBridge && bridge)
+{
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    bool wasEmpty;
+    VerifyOrReturnError(mCrossThreadWorkQueue.Enqueue(bridge, wasEmpty), CHIP_ERROR_NO_MEMORY);
+
+    // Only the producer that finds the queue empty needs to wake the event loop; posts
+    // racing with a non-empty queue coalesce into the pending wakeup.
+    if (wasEmpty)
+    {
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+
 CHIP_ERROR LayerImplSelect::StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
 {
     VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
@@ -243,6 +265,15 @@ CHIP_ERROR LayerImplSelect::SetCallback(SocketWatchToken token, SocketWatchCallb
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR LayerImplSelect::SetWatchPriority(SocketWatchToken token, SocketWatchPriority priority)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPriority = priority;
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR LayerImplSelect::RequestCallbackOnPendingRead(SocketWatchToken token)
 {
     SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
@@ -383,26 +414,63 @@ void LayerImplSelect::HandleEvents()
     mHandleSelectThread = pthread_self();
 #endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
 
+    // One clock read serves every timestamp taken while dispatching this cycle.
+    SystemClock().RefreshCachedMonotonicTimestamp();
+
+#if CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+    // Drain work posted from foreign threads.  The queue must be drained until empty:
+    // producers skip the wakeup when they observe a non-empty queue, counting on the
+    // consumer still being inside this loop to pick the work up.
+    LambdaBridge bridge;
+    while (mCrossThreadWorkQueue.Dequeue(bridge))
+    {
+        bridge();
+    }
+#endif // CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+
     // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
     // since that could result in infinite handling of new timers blocking any other progress.
     TimerList expiredTimers = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
     TimerList::Node * timer = nullptr;
     while ((timer = expiredTimers.PopEarliest()) != nullptr)
     {
+#if CHIP_SYSTEM_CONFIG_EVENT_LOOP_PROFILING
+        // Capture the callback address before Invoke() releases the timer node.
+        void * const dispatchSite                 = reinterpret_cast<void *>(timer->GetCallback().GetOnComplete());
+        const Clock::Microseconds64 dispatchStart = SystemClock().GetMonotonicMicroseconds64();
+#endif // CHIP_SYSTEM_CONFIG_EVENT_LOOP_PROFILING
         mTimerPool.Invoke(timer);
+#if CHIP_SYSTEM_CONFIG_EVENT_LOOP_PROFILING
+        EventLoopProfiler::Instance().RecordDispatch(dispatchSite, EventLoopProfiler::SiteKind::kTimer,
+                                                     SystemClock().GetMonotonicMicroseconds64() - dispatchStart);
+#endif // CHIP_SYSTEM_CONFIG_EVENT_LOOP_PROFILING
     }
 
-    for (auto & w : mSocketWatchPool)
-    {
-        if (w.mFD != kInvalidFd)
+    // Dispatch ready sockets one lane at a time, so that time-critical traffic is serviced
+    // ahead of chatty background sockets. Every ready socket is still dispatched on every
+    // pass, so lower lanes are delayed but never starved.
+    for (SocketWatchPriority lane : { SocketWatchPriority::kHigh, SocketWatchPriority::kNormal, SocketWatchPriority::kBackground })
+        for (auto & w : mSocketWatchPool)
         {
-            SocketEvents events = SocketEventsFromFDs(w.mFD, mSelected.mReadSet, mSelected.mWriteSet, mSelected.mErrorSet);
-            if (events.HasAny() && w.mCallback != nullptr)
+            if (w.mFD != kInvalidFd && w.mPriority == lane)
             {
-                w.mCallback(events, w.mCallbackData);
+                SocketEvents events = SocketEventsFromFDs(w.mFD, mSelected.mReadSet, mSelected.mWriteSet, mSelected.mErrorSet);
+                if (events.HasAny() && w.mCallback != nullptr)
+                {
+#if CHIP_SYSTEM_CONFIG_EVENT_LOOP_PROFILING
+                    const Clock::Microseconds64 dispatchStart = SystemClock().GetMonotonicMicroseconds64();
+#endif // CHIP_SYSTEM_CONFIG_EVENT_LOOP_PROFILING
+                    w.mCallback(events, w.mCallbackData);
+#if CHIP_SYSTEM_CONFIG_EVENT_LOOP_PROFILING
+                    EventLoopProfiler::Instance().RecordDispatch(reinterpret_cast<void *>(w.mCallback),
+                                                                 EventLoopProfiler::SiteKind::kSocket,
+                                                                 SystemClock().GetMonotonicMicroseconds64() - dispatchStart);
+#endif // CHIP_SYSTEM_CONFIG_EVENT_LOOP_PROFILING
+                }
             }
         }
-    }
+
+    SystemClock().InvalidateCachedMonotonicTimestamp();
 
 #if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
     mHandleSelectThread = PTHREAD_NULL;
@@ -421,6 +489,7 @@ void LayerImplSelect::SocketWatch::Clear()
 {
     mFD = kInvalidFd;
     mPendingIO.ClearAll();
+    mPriority     = SocketWatchPriority::kNormal;
     mCallback     = nullptr;
     mCallbackData = 0;
 }
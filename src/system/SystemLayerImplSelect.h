@@ -29,6 +29,9 @@
 #include <pthread.h>
 #endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
 
+#if CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+#include <lib/support/BoundedMPSCQueue.h>
+#endif
 #include <lib/support/ObjectLifeCycle.h>
 #include <system/SystemLayer.h>
 #include <system/SystemTimer.h>
@@ -54,6 +57,7 @@ public:
     // LayerSocket overrides.
     CHIP_ERROR StartWatchingSocket(int fd, SocketWatchToken * tokenOut) override;
     CHIP_ERROR SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data) override;
+    CHIP_ERROR SetWatchPriority(SocketWatchToken token, SocketWatchPriority priority) override;
     CHIP_ERROR RequestCallbackOnPendingRead(SocketWatchToken token) override;
     CHIP_ERROR RequestCallbackOnPendingWrite(SocketWatchToken token) override;
     CHIP_ERROR ClearCallbackOnPendingRead(SocketWatchToken token) override;
@@ -63,6 +67,9 @@ public:
 
     // LayerSocketLoop overrides.
     void Signal() override;
+#if CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+    CHIP_ERROR PostLambdaBridge(LambdaBridge && bridge) override;
+#endif
     void EventLoopBegins() override {}
     void PrepareEvents() override;
     void WaitForEvents() override;
@@ -86,13 +93,14 @@ protected:
         void Clear();
         int mFD;
         SocketEvents mPendingIO;
+        SocketWatchPriority mPriority;
         SocketWatchCallback mCallback;
         intptr_t mCallbackData;
     };
     SocketWatch mSocketWatchPool[kSocketWatchMax];
 
     TimerPool<TimerList::Node> mTimerPool;
-    TimerList mTimerList;
+    TimerQueue mTimerList;
     timeval mNextTimeout;
 
     // Members for select loop
@@ -111,6 +119,10 @@ protected:
     ObjectLifeCycle mLayerState;
     WakeEvent mWakeEvent;
 
+#if CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+    BoundedMPSCQueue<LambdaBridge, CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE_SIZE> mCrossThreadWorkQueue;
+#endif
+
 #if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
     std::atomic<pthread_t> mHandleSelectThread;
 #endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
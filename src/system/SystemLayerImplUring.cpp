@@ -0,0 +1,496 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Layer using Linux io_uring.
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TimeUtils.h>
+#include <platform/LockTracker.h>
+#include <system/SystemFaultInjection.h>
+#include <system/SystemLayer.h>
+#include <system/SystemLayerImplUring.h>
+
+#include <errno.h>
+#include <poll.h>
+
+// Choose an approximation of PTHREAD_NULL if pthread.h doesn't define one.
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+#define PTHREAD_NULL 0
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+
+namespace chip {
+namespace System {
+
+constexpr Clock::Seconds64 kDefaultMinSleepPeriod = Clock::Seconds64(60 * 60 * 24 * 30); // Month [sec]
+
+namespace {
+
+unsigned PollMaskFromSocketEvents(SocketEvents events)
+{
+    unsigned mask = 0;
+    if (events.Has(SocketEventFlags::kRead))
+    {
+        mask |= POLLIN;
+    }
+    if (events.Has(SocketEventFlags::kWrite))
+    {
+        mask |= POLLOUT;
+    }
+    return mask;
+}
+
+} // namespace
+
+CHIP_ERROR LayerImplUring::Init()
+{
+    VerifyOrReturnError(mLayerState.SetInitializing(), CHIP_ERROR_INCORRECT_STATE);
+
+    RegisterPOSIXErrorFormatter();
+
+    for (auto & w : mSocketWatchPool)
+    {
+        w.Clear();
+    }
+
+    const int ret = io_uring_queue_init(kQueueDepth, &mRing, 0);
+    VerifyOrReturnError(ret >= 0, CHIP_ERROR_POSIX(-ret));
+    mRingInitialized = true;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Create an event to allow an arbitrary thread to wake the thread in the event loop.
+    // The wake event's read descriptor is watched like any other socket.
+    ReturnErrorOnFailure(mWakeEvent.Open(*this));
+
+    VerifyOrReturnError(mLayerState.SetInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplUring::Shutdown()
+{
+    VerifyOrReturnError(mLayerState.SetShuttingDown(), CHIP_ERROR_INCORRECT_STATE);
+
+    mTimerList.Clear();
+    mTimerPool.ReleaseAll();
+
+    mWakeEvent.Close(*this);
+
+    if (mRingInitialized)
+    {
+        io_uring_queue_exit(&mRing);
+        mRingInitialized = false;
+    }
+
+    mLayerState.ResetFromShuttingDown(); // Return to uninitialized state to permit re-initialization.
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplUring::Signal()
+{
+    /*
+     * Wake up the I/O thread by notifying the wake event.
+     *
+     * If this is being called from within an I/O event callback, then the notification can be skipped,
+     * since the I/O thread is already awake.
+     */
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    if (pthread_equal(mHandleSelectThread, pthread_self()))
+    {
+        return;
+    }
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    CHIP_ERROR status = mWakeEvent.Notify();
+    if (status != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipSystemLayer, "System wake event notify failed: %" CHIP_ERROR_FORMAT, status.Format());
+    }
+}
+
+#if CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+CHIP_ERROR LayerImplUring::PostLambdaBridge(LambdaBridge && bridge)
+{
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    bool wasEmpty;
+    VerifyOrReturnError(mCrossThreadWorkQueue.Enqueue(bridge, wasEmpty), CHIP_ERROR_NO_MEMORY);
+
+    // Only the producer that finds the queue empty needs to wake the event loop; posts
+    // racing with a non-empty queue coalesce into the pending wakeup.
+    if (wasEmpty)
+    {
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+
+CHIP_ERROR LayerImplUring::StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_TimeoutImmediate, delay = System::Clock::kZero);
+
+    CancelTimer(onComplete, appState);
+
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplUring::CancelTimer(TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturn(mLayerState.IsInitialized());
+
+    TimerList::Node * timer = mTimerList.Remove(onComplete, appState);
+    VerifyOrReturn(timer != nullptr);
+
+    mTimerPool.Release(timer);
+    Signal();
+}
+
+CHIP_ERROR LayerImplUring::ScheduleWork(TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CancelTimer(onComplete, appState);
+
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplUring::StartWatchingSocket(int fd, SocketWatchToken * tokenOut)
+{
+    // Find a free slot.
+    SocketWatch * watch = nullptr;
+    for (auto & w : mSocketWatchPool)
+    {
+        if (w.mFD == fd)
+        {
+            // Duplicate registration is an error.
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+        else if ((w.mFD == kInvalidFd) && (watch == nullptr))
+        {
+            watch = &w;
+        }
+    }
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_ENDPOINT_POOL_FULL);
+
+    watch->mFD = fd;
+
+    *tokenOut = reinterpret_cast<SocketWatchToken>(watch);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplUring::SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mCallback     = callback;
+    watch->mCallbackData = data;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplUring::SetWatchPriority(SocketWatchToken token, SocketWatchPriority priority)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPriority = priority;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplUring::RequestCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kRead);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplUring::RequestCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kWrite);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplUring::ClearCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    watch->mPendingIO.Clear(SocketEventFlags::kRead);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplUring::ClearCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    watch->mPendingIO.Clear(SocketEventFlags::kWrite);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplUring::StopWatchingSocket(SocketWatchToken * tokenInOut)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(*tokenInOut);
+    *tokenInOut         = InvalidSocketWatchToken();
+
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(watch->mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    if (watch->mArmedIO.HasAny())
+    {
+        io_uring_sqe * sqe = GetSubmissionEntry();
+        if (sqe != nullptr)
+        {
+            io_uring_prep_poll_remove(sqe, watch);
+            io_uring_sqe_set_data(sqe, nullptr);
+            io_uring_submit(&mRing);
+        }
+    }
+
+    watch->Clear();
+
+    // Wake the thread waiting for completions so that it stops watching the socket.
+    Signal();
+
+    return CHIP_NO_ERROR;
+}
+
+/**
+ *  Translate the result mask of a completed poll operation into socket event flags.
+ *
+ *  Hangup and error conditions are reported as readability, matching select()
+ *  semantics: the client's read attempt observes the error or end-of-stream.
+ */
+SocketEvents LayerImplUring::SocketEventsFromPollResult(int pollResult)
+{
+    SocketEvents res;
+    const unsigned mask = static_cast<unsigned>(pollResult);
+
+    if (mask & (POLLIN | POLLHUP | POLLERR))
+        res.Set(SocketEventFlags::kRead);
+    if (mask & POLLOUT)
+        res.Set(SocketEventFlags::kWrite);
+    if (mask & POLLPRI)
+        res.Set(SocketEventFlags::kExcept);
+
+    return res;
+}
+
+io_uring_sqe * LayerImplUring::GetSubmissionEntry()
+{
+    io_uring_sqe * sqe = io_uring_get_sqe(&mRing);
+    if (sqe == nullptr)
+    {
+        // The submission queue is full; flush it to the kernel and retry once.
+        io_uring_submit(&mRing);
+        sqe = io_uring_get_sqe(&mRing);
+    }
+    if (sqe == nullptr)
+    {
+        ChipLogError(chipSystemLayer, "io_uring submission queue exhausted");
+    }
+    return sqe;
+}
+
+void LayerImplUring::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    const Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    Clock::Timestamp awakenTime        = currentTime + kDefaultMinSleepPeriod;
+
+    TimerList::Node * timer = mTimerList.Earliest();
+    if (timer && timer->AwakenTime() < awakenTime)
+    {
+        awakenTime = timer->AwakenTime();
+    }
+
+    const Clock::Timestamp sleepTime = (awakenTime > currentTime) ? (awakenTime - currentTime) : Clock::kZero;
+    const uint64_t sleepMillis       = Clock::Milliseconds64(sleepTime).count();
+    mNextTimeout.tv_sec              = static_cast<int64_t>(sleepMillis / kMillisecondsPerSecond);
+    mNextTimeout.tv_nsec = static_cast<int64_t>((sleepMillis % kMillisecondsPerSecond) * kNanosecondsPerMillisecond);
+
+    // Reconcile the kernel's poll registrations with the events the clients are
+    // interested in.  All changes are queued here and handed to the kernel in a
+    // single batched submission.
+    bool needsSubmit = false;
+    for (auto & w : mSocketWatchPool)
+    {
+        if (w.mFD == kInvalidFd)
+        {
+            continue;
+        }
+
+        if (w.mArmedIO.Raw() == w.mPendingIO.Raw())
+        {
+            continue;
+        }
+
+        if (w.mArmedIO.HasAny())
+        {
+            io_uring_sqe * sqe = GetSubmissionEntry();
+            VerifyOrReturn(sqe != nullptr);
+            io_uring_prep_poll_remove(sqe, &w);
+            io_uring_sqe_set_data(sqe, nullptr);
+            w.mArmedIO.ClearAll();
+            needsSubmit = true;
+        }
+
+        if (w.mPendingIO.HasAny())
+        {
+            io_uring_sqe * sqe = GetSubmissionEntry();
+            VerifyOrReturn(sqe != nullptr);
+            io_uring_prep_poll_add(sqe, w.mFD, PollMaskFromSocketEvents(w.mPendingIO));
+            io_uring_sqe_set_data(sqe, &w);
+            w.mArmedIO  = w.mPendingIO;
+            needsSubmit = true;
+        }
+    }
+
+    if (needsSubmit)
+    {
+        const int ret = io_uring_submit(&mRing);
+        if (ret < 0)
+        {
+            ChipLogError(chipSystemLayer, "io_uring submit failed: %s", ErrorStr(CHIP_ERROR_POSIX(-ret)));
+        }
+    }
+}
+
+void LayerImplUring::WaitForEvents()
+{
+    io_uring_cqe * cqe = nullptr;
+    const int ret      = io_uring_wait_cqe_timeout(&mRing, &cqe, &mNextTimeout);
+    if (ret < 0 && ret != -ETIME && ret != -EINTR)
+    {
+        ChipLogError(chipSystemLayer, "io_uring wait failed: %s", ErrorStr(CHIP_ERROR_POSIX(-ret)));
+    }
+}
+
+void LayerImplUring::HandleEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // One clock read serves every timestamp taken while dispatching this cycle.
+    SystemClock().RefreshCachedMonotonicTimestamp();
+
+    // Drain the completion ring.  Completions are gathered into per-watch ready
+    // masks first, so a watch that completed several times is dispatched once.
+    io_uring_cqe * cqe = nullptr;
+    while (io_uring_peek_cqe(&mRing, &cqe) == 0)
+    {
+        SocketWatch * watch = static_cast<SocketWatch *>(io_uring_cqe_get_data(cqe));
+        if (watch != nullptr)
+        {
+            // The poll operation is one-shot: whether it completed with events or
+            // was cancelled, it is no longer registered with the kernel.
+            watch->mArmedIO.ClearAll();
+            if (cqe->res > 0 && watch->mFD != kInvalidFd)
+            {
+                watch->mReadyIO.SetRaw(watch->mReadyIO.Raw() | SocketEventsFromPollResult(cqe->res).Raw());
+            }
+        }
+        io_uring_cqe_seen(&mRing, cqe);
+    }
+
+#if CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+    // Drain work posted from foreign threads.  The queue must be drained until empty:
+    // producers skip the wakeup when they observe a non-empty queue, counting on the
+    // consumer still being inside this loop to pick the work up.
+    LambdaBridge bridge;
+    while (mCrossThreadWorkQueue.Dequeue(bridge))
+    {
+        bridge();
+    }
+#endif // CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+
+    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
+    // since that could result in infinite handling of new timers blocking any other progress.
+    TimerList expiredTimers = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
+    TimerList::Node * timer = nullptr;
+    while ((timer = expiredTimers.PopEarliest()) != nullptr)
+    {
+        mTimerPool.Invoke(timer);
+    }
+
+    // Dispatch ready sockets one lane at a time, so that time-critical traffic is serviced
+    // ahead of chatty background sockets. Every ready socket is still dispatched on every
+    // pass, so lower lanes are delayed but never starved.
+    for (SocketWatchPriority lane : { SocketWatchPriority::kHigh, SocketWatchPriority::kNormal, SocketWatchPriority::kBackground })
+        for (auto & w : mSocketWatchPool)
+        {
+            if (w.mFD != kInvalidFd && w.mPriority == lane && w.mReadyIO.HasAny())
+            {
+                SocketEvents events = w.mReadyIO;
+                w.mReadyIO.ClearAll();
+                if (w.mCallback != nullptr)
+                {
+                    w.mCallback(events, w.mCallbackData);
+                }
+            }
+        }
+
+    SystemClock().InvalidateCachedMonotonicTimestamp();
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+void LayerImplUring::SocketWatch::Clear()
+{
+    mFD = kInvalidFd;
+    mPendingIO.ClearAll();
+    mArmedIO.ClearAll();
+    mReadyIO.ClearAll();
+    mPriority     = SocketWatchPriority::kNormal;
+    mCallback     = nullptr;
+    mCallbackData = 0;
+}
+
+} // namespace System
+} // namespace chip
@@ -0,0 +1,137 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares an implementation of System::Layer using Linux io_uring.
+ */
+
+#pragma once
+
+#include <liburing.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <atomic>
+#include <pthread.h>
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+#if CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+#include <lib/support/BoundedMPSCQueue.h>
+#endif
+#include <lib/support/ObjectLifeCycle.h>
+#include <system/SystemLayer.h>
+#include <system/SystemTimer.h>
+#include <system/WakeEvent.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * Implementation of LayerSocketsLoop that multiplexes socket readiness through
+ * io_uring poll operations instead of select().
+ *
+ * All poll registrations accumulated during PrepareEvents() are submitted to the
+ * kernel in a single batched io_uring_submit() call, and completions are drained
+ * from the shared completion ring without further syscalls, so the per-wakeup
+ * cost no longer grows with the number of watched sockets.  The wake event is an
+ * ordinary watched descriptor and needs no special handling here.
+ */
+class LayerImplUring : public LayerSocketsLoop
+{
+public:
+    LayerImplUring() = default;
+    ~LayerImplUring() { VerifyOrDie(mLayerState.Destroy()); }
+
+    // Layer overrides.
+    CHIP_ERROR Init() override;
+    CHIP_ERROR Shutdown() override;
+    bool IsInitialized() const override { return mLayerState.IsInitialized(); }
+    CHIP_ERROR StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState) override;
+    void CancelTimer(TimerCompleteCallback onComplete, void * appState) override;
+    CHIP_ERROR ScheduleWork(TimerCompleteCallback onComplete, void * appState) override;
+
+    // LayerSocket overrides.
+    CHIP_ERROR StartWatchingSocket(int fd, SocketWatchToken * tokenOut) override;
+    CHIP_ERROR SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data) override;
+    CHIP_ERROR SetWatchPriority(SocketWatchToken token, SocketWatchPriority priority) override;
+    CHIP_ERROR RequestCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR RequestCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR StopWatchingSocket(SocketWatchToken * tokenInOut) override;
+    SocketWatchToken InvalidSocketWatchToken() override { return reinterpret_cast<SocketWatchToken>(nullptr); }
+
+    // LayerSocketLoop overrides.
+    void Signal() override;
+#if CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+    CHIP_ERROR PostLambdaBridge(LambdaBridge && bridge) override;
+#endif
+    void EventLoopBegins() override {}
+    void PrepareEvents() override;
+    void WaitForEvents() override;
+    void HandleEvents() override;
+    void EventLoopEnds() override {}
+
+protected:
+    static SocketEvents SocketEventsFromPollResult(int pollResult);
+
+    static constexpr int kSocketWatchMax = (INET_CONFIG_ENABLE_TCP_ENDPOINT ? INET_CONFIG_NUM_TCP_ENDPOINTS : 0) +
+        (INET_CONFIG_ENABLE_UDP_ENDPOINT ? INET_CONFIG_NUM_UDP_ENDPOINTS : 0);
+
+    // One poll-add plus one poll-remove per watch can be outstanding at a time.
+    // The kernel rounds this up to a power of two.
+    static constexpr unsigned kQueueDepth = 2 * static_cast<unsigned>(kSocketWatchMax) + 2;
+
+    struct SocketWatch
+    {
+        void Clear();
+        int mFD;
+        SocketEvents mPendingIO; ///< Events the client wants callbacks for.
+        SocketEvents mArmedIO;   ///< Events currently registered with the kernel.
+        SocketEvents mReadyIO;   ///< Events reported by completions, pending dispatch.
+        SocketWatchPriority mPriority;
+        SocketWatchCallback mCallback;
+        intptr_t mCallbackData;
+    };
+    SocketWatch mSocketWatchPool[kSocketWatchMax];
+
+    // Obtain a submission queue entry, flushing the queue if it is full.
+    io_uring_sqe * GetSubmissionEntry();
+
+    TimerPool<TimerList::Node> mTimerPool;
+    TimerQueue mTimerList;
+    __kernel_timespec mNextTimeout;
+
+    io_uring mRing;
+    bool mRingInitialized = false;
+
+    ObjectLifeCycle mLayerState;
+    WakeEvent mWakeEvent;
+
+#if CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE
+    BoundedMPSCQueue<LambdaBridge, CHIP_SYSTEM_CONFIG_CROSS_THREAD_WORK_QUEUE_SIZE> mCrossThreadWorkQueue;
+#endif
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    std::atomic<pthread_t> mHandleSelectThread;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+};
+
+using LayerImpl = LayerImplUring;
+
+} // namespace System
+} // namespace chip
@@ -41,6 +41,7 @@
 
 #include <stdint.h>
 
+#include <cstddef>
 #include <limits.h>
 #include <stddef.h>
 #include <stdlib.h>
@@ -56,6 +57,10 @@
 #include <lib/support/CHIPMem.h>
 #endif
 
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_ARENA_SIZE > 0 && defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 namespace chip {
 namespace System {
 
@@ -161,6 +166,238 @@ void PacketBufferHandle::InternalRightSize()
     mBuffer = newBuffer;
 }
 
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE
+//
+// Free-list cache of heap-allocated PacketBuffer objects, segregated by block size.
+//
+
+constexpr uint16_t PacketBuffer::kHeapCacheBlockSizes[];
+uint16_t PacketBuffer::sHeapCacheDepths[PacketBuffer::kHeapCacheSizeClassCount];
+
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+static Mutex sHeapCacheMutex;
+
+#define LOCK_HEAP_CACHE()                                                                                                          \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        sHeapCacheMutex.Lock();                                                                                                    \
+    } while (0)
+#define UNLOCK_HEAP_CACHE()                                                                                                        \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        sHeapCacheMutex.Unlock();                                                                                                  \
+    } while (0)
+#else // CHIP_SYSTEM_CONFIG_NO_LOCKING
+#define LOCK_HEAP_CACHE()                                                                                                          \
+    do                                                                                                                             \
+    {                                                                                                                              \
+    } while (0)
+#define UNLOCK_HEAP_CACHE()                                                                                                        \
+    do                                                                                                                             \
+    {                                                                                                                              \
+    } while (0)
+#endif // CHIP_SYSTEM_CONFIG_NO_LOCKING
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_ARENA_SIZE > 0
+//
+// Contiguous arena backing for heap cache blocks.
+//
+// Cache misses carve blocks from a single preallocated region instead of the general heap, so the
+// hot buffer working set stays contiguous in a handful of (ideally huge) pages instead of being
+// scattered by the allocator. Arena blocks are recycled exclusively through the free-list cache
+// and are never returned to the platform allocator; once the arena is exhausted, further misses
+// fall back to the heap as before.
+//
+// All access is serialized by the heap cache lock.
+
+static uint8_t * sArenaBase   = nullptr;
+static size_t sArenaOffset    = 0;
+static bool sArenaInitialized = false;
+
+// Reserve the arena on first use. On Linux this asks for an explicit hugepage mapping first and
+// falls back to a normal anonymous mapping marked MADV_HUGEPAGE, so transparent hugepages can
+// still back it; elsewhere the region comes from the platform allocator and only provides
+// contiguity. Failure leaves the arena disabled and every allocation on the heap path.
+static void ArenaInit()
+{
+    sArenaInitialized = true;
+
+#if defined(__linux__)
+    void * lBase = mmap(nullptr, CHIP_SYSTEM_CONFIG_PACKETBUFFER_ARENA_SIZE, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (lBase == MAP_FAILED)
+    {
+        lBase = mmap(nullptr, CHIP_SYSTEM_CONFIG_PACKETBUFFER_ARENA_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1,
+                     0);
+#ifdef MADV_HUGEPAGE
+        if (lBase != MAP_FAILED)
+        {
+            madvise(lBase, CHIP_SYSTEM_CONFIG_PACKETBUFFER_ARENA_SIZE, MADV_HUGEPAGE);
+        }
+#endif
+    }
+    if (lBase == MAP_FAILED)
+    {
+        ChipLogError(chipSystemLayer, "PacketBuffer: arena mapping failed, using heap");
+        return;
+    }
+    sArenaBase = static_cast<uint8_t *>(lBase);
+#else  // defined(__linux__)
+    sArenaBase = static_cast<uint8_t *>(chip::Platform::MemoryAlloc(CHIP_SYSTEM_CONFIG_PACKETBUFFER_ARENA_SIZE));
+    if (sArenaBase == nullptr)
+    {
+        ChipLogError(chipSystemLayer, "PacketBuffer: arena allocation failed, using heap");
+    }
+#endif // defined(__linux__)
+}
+
+// Carve a block from the arena, or return nullptr when the arena is disabled or exhausted.
+static PacketBuffer * ArenaAlloc(size_t aBlockSize)
+{
+    if (!sArenaInitialized)
+    {
+        ArenaInit();
+    }
+    VerifyOrReturnError(sArenaBase != nullptr, nullptr);
+
+    // Keep successive blocks aligned for the PacketBuffer structure.
+    constexpr size_t kArenaBlockAlignment = alignof(std::max_align_t);
+    const size_t lAlignedSize             = (aBlockSize + (kArenaBlockAlignment - 1)) & ~(kArenaBlockAlignment - 1);
+
+    VerifyOrReturnError(lAlignedSize <= CHIP_SYSTEM_CONFIG_PACKETBUFFER_ARENA_SIZE - sArenaOffset, nullptr);
+
+    PacketBuffer * lPacket = reinterpret_cast<PacketBuffer *>(sArenaBase + sArenaOffset);
+    sArenaOffset += lAlignedSize;
+    return lPacket;
+}
+
+// Whether the given block was carved from the arena, and so must not reach the platform allocator.
+static bool ArenaContains(const PacketBuffer * aPacket)
+{
+    const uint8_t * lAddress = reinterpret_cast<const uint8_t *>(aPacket);
+    return sArenaBase != nullptr && lAddress >= sArenaBase && lAddress < sArenaBase + CHIP_SYSTEM_CONFIG_PACKETBUFFER_ARENA_SIZE;
+}
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_ARENA_SIZE > 0
+
+// Initializes the cache lock during static initialization of the free list heads; the nullptr
+// return leaves every class empty. This mirrors BuildFreeList() for the pooled store.
+PacketBuffer * PacketBuffer::InitHeapCache()
+{
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    Mutex::Init(sHeapCacheMutex);
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+
+    return nullptr;
+}
+
+PacketBuffer * PacketBuffer::sHeapCacheFreeLists[PacketBuffer::kHeapCacheSizeClassCount] = { PacketBuffer::InitHeapCache() };
+
+/**
+ * Allocate a packet buffer block, taking it from the free-list cache when possible.
+ *
+ *  The request is rounded up to the smallest size class that fits, so that the block can be
+ *  recycled through the cache when it is freed. `alloc_size` is set to the class payload size;
+ *  callers receive at least as much space as they asked for.
+ *
+ *  @param[in] aBlockSize - the required block size, including the buffer structure. Must not
+ *                          exceed the largest size class; `New()` guarantees this.
+ *
+ *  @return the allocated buffer, or \c nullptr on allocation failure.
+ */
+PacketBuffer * PacketBuffer::HeapCacheAlloc(size_t aBlockSize)
+{
+    size_t lClass = 0;
+    while (static_cast<size_t>(kHeapCacheBlockSizes[lClass]) < aBlockSize)
+    {
+        lClass++;
+    }
+
+    LOCK_HEAP_CACHE();
+
+    PacketBuffer * lPacket = sHeapCacheFreeLists[lClass];
+    if (lPacket != nullptr)
+    {
+        sHeapCacheFreeLists[lClass] = lPacket->ChainedBuffer();
+        sHeapCacheDepths[lClass]--;
+    }
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_ARENA_SIZE > 0
+    if (lPacket == nullptr)
+    {
+        lPacket = ArenaAlloc(kHeapCacheBlockSizes[lClass]);
+    }
+#endif
+
+    UNLOCK_HEAP_CACHE();
+
+    if (lPacket == nullptr)
+    {
+        lPacket = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(kHeapCacheBlockSizes[lClass]));
+        if (lPacket == nullptr)
+        {
+            return nullptr;
+        }
+    }
+
+    lPacket->alloc_size = static_cast<uint16_t>(kHeapCacheBlockSizes[lClass] - kStructureSize);
+    return lPacket;
+}
+
+/**
+ * Return a freed packet buffer block to the free-list cache.
+ *
+ *  @param[in] aPacket    - the buffer to recycle; must already be cleared and unreferenced.
+ *  @param[in] aAllocSize - the buffer's payload allocation size, captured before `Clear()`.
+ *
+ *  @return \c true if the buffer was retained by the cache; \c false if the caller must release
+ *          it to the heap, either because its block size does not exactly match a size class
+ *          (e.g. it was reallocated by `RightSize()`) or because the class is already full.
+ */
+bool PacketBuffer::HeapCacheFree(PacketBuffer * aPacket, uint16_t aAllocSize)
+{
+    const size_t lBlockSize = static_cast<size_t>(aAllocSize) + kStructureSize;
+    size_t lClass           = 0;
+    while (lClass < kHeapCacheSizeClassCount && static_cast<size_t>(kHeapCacheBlockSizes[lClass]) != lBlockSize)
+    {
+        lClass++;
+    }
+    if (lClass == kHeapCacheSizeClassCount)
+    {
+        return false;
+    }
+
+    bool lCached = false;
+
+    LOCK_HEAP_CACHE();
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_ARENA_SIZE > 0
+    // Arena blocks must never reach the platform allocator: recycle them
+    // through the cache regardless of the depth cap. The list growth is
+    // bounded by the arena size.
+    if (ArenaContains(aPacket))
+    {
+        aPacket->next               = sHeapCacheFreeLists[lClass];
+        sHeapCacheFreeLists[lClass] = aPacket;
+        sHeapCacheDepths[lClass]++;
+        UNLOCK_HEAP_CACHE();
+        return true;
+    }
+#endif
+
+    if (sHeapCacheDepths[lClass] < CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_DEPTH)
+    {
+        aPacket->next               = sHeapCacheFreeLists[lClass];
+        sHeapCacheFreeLists[lClass] = aPacket;
+        sHeapCacheDepths[lClass]++;
+        lCached = true;
+    }
+
+    UNLOCK_HEAP_CACHE();
+
+    return lCached;
+}
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE
+
 #elif CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_LWIP_CUSTOM
 
 void PacketBufferHandle::InternalRightSize()
@@ -484,7 +721,11 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
 
 #elif CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
 
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE
+    lPacket = PacketBuffer::HeapCacheAlloc(lBlockSize);
+#else
     lPacket = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(lBlockSize));
+#endif
     SYSTEM_STATS_INCREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
 
 #else
@@ -501,7 +742,8 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
     lPacket->len = lPacket->tot_len = 0;
     lPacket->next                   = nullptr;
     lPacket->ref                    = 1;
-#if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
+#if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP && !CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE
+    // With the heap cache, HeapCacheAlloc() has already set alloc_size to the size class capacity.
     lPacket->alloc_size = static_cast<uint16_t>(lAllocSize);
 #endif
 
@@ -565,13 +807,23 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
             SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
 #if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
             ::chip::Platform::MemoryDebugCheckPointer(aPacket, aPacket->alloc_size + kStructureSize);
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE
+            const uint16_t lFreedAllocSize = aPacket->alloc_size;
+#endif
 #endif
             aPacket->Clear();
 #if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_POOL
             aPacket->next = sFreeList;
             sFreeList     = aPacket;
 #elif CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE
+            if (!HeapCacheFree(aPacket, lFreedAllocSize))
+            {
+                chip::Platform::MemoryFree(aPacket);
+            }
+#else
             chip::Platform::MemoryFree(aPacket);
+#endif
 #endif // CHIP_SYSTEM_PACKETBUFFER_STORE
             aPacket       = lNextPacket;
         }
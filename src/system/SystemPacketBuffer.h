@@ -407,6 +407,20 @@ private:
     static PacketBuffer * BuildFreeList();
 #endif // CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_POOL || defined(DOXYGEN)
 
+#if (CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP) && CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE
+    // Number of block size classes in the heap free-list cache.
+    static constexpr size_t kHeapCacheSizeClassCount = 3;
+    // Block sizes (buffer structure plus payload) served by the heap free-list cache, in ascending
+    // order. The last class must admit the largest allocation `New()` accepts.
+    static constexpr uint16_t kHeapCacheBlockSizes[kHeapCacheSizeClassCount] = { kStructureSize + 128, kStructureSize + 640,
+                                                                                 kStructureSize + kMaxSizeWithoutReserve };
+    static PacketBuffer * sHeapCacheFreeLists[kHeapCacheSizeClassCount];
+    static uint16_t sHeapCacheDepths[kHeapCacheSizeClassCount];
+    static PacketBuffer * InitHeapCache();
+    static PacketBuffer * HeapCacheAlloc(size_t aBlockSize);
+    static bool HeapCacheFree(PacketBuffer * aPacket, uint16_t aAllocSize);
+#endif // (CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP) && CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE
+
 #if CHIP_SYSTEM_PACKETBUFFER_HAS_CHECK
     static void InternalCheck(const PacketBuffer * buffer);
 #endif
@@ -747,6 +761,83 @@ inline PacketBufferHandle PacketBuffer::Last()
     return PacketBufferHandle::Hold(p);
 }
 
+/**
+ * Suggests right-sized packet buffer allocations from the sizes a call site
+ * actually ended up using.
+ *
+ *  Many encode paths allocate a worst-case buffer (full SDU or MTU) for
+ *  messages that are typically a small fraction of that size.  An estimator
+ *  placed at such a call site tracks a moving average of the final encoded
+ *  sizes and suggests an allocation with headroom on top of that average, so
+ *  the common case allocates what it needs instead of the maximum.
+ *
+ *  A suggestion is only a guess: the caller must handle the encode running out
+ *  of space by reporting ReportUndersized() and retrying with its worst-case
+ *  size.  After an undersized guess, suggestions return the worst case again
+ *  for a while before re-engaging, so a workload the average misjudges does
+ *  not pay the retry cost repeatedly.
+ */
+class PacketBufferSizeEstimator
+{
+public:
+    /// Granularity that suggestions are rounded up to, so consecutive nearby
+    /// sizes map to the same allocation request.
+    static constexpr uint16_t kSizeGranularity = 64;
+
+    /// Headroom is average / kHeadroomDivisor (50%), absorbing normal
+    /// message-to-message variation without a retry.
+    static constexpr uint16_t kHeadroomDivisor = 2;
+
+    /// Number of suggestions that return the worst-case size after an
+    /// undersized guess, before right-sizing re-engages.
+    static constexpr uint16_t kUndersizedBackoffCount = 8;
+
+    /**
+     * Returns the suggested allocation size for the next message: the tracked
+     * average plus headroom, rounded up to kSizeGranularity and clamped to
+     * aMaxSize.  Returns aMaxSize until enough sizes have been reported or
+     * while backing off after an undersized guess.
+     */
+    uint16_t SuggestedSize(uint16_t aMaxSize)
+    {
+        if (mAverageSize == 0)
+        {
+            return aMaxSize;
+        }
+        if (mBackoff > 0)
+        {
+            mBackoff--;
+            return aMaxSize;
+        }
+        uint32_t suggestion = static_cast<uint32_t>(mAverageSize) + (mAverageSize / kHeadroomDivisor) + (kSizeGranularity - 1);
+        suggestion -= suggestion % kSizeGranularity;
+        return (suggestion < aMaxSize) ? static_cast<uint16_t>(suggestion) : aMaxSize;
+    }
+
+    /// Report the final encoded size of a successfully built message.
+    void ReportFinalSize(size_t aFinalSize)
+    {
+        const uint16_t size = (aFinalSize > UINT16_MAX) ? UINT16_MAX : static_cast<uint16_t>(aFinalSize);
+        if (mAverageSize == 0)
+        {
+            mAverageSize = size;
+        }
+        else
+        {
+            // Exponentially weighted moving average with alpha = 1/4.
+            mAverageSize = static_cast<uint16_t>(mAverageSize - (mAverageSize / 4) + (size / 4));
+        }
+    }
+
+    /// Report that a suggested size was too small and the encode had to be
+    /// retried with the worst-case size.
+    void ReportUndersized() { mBackoff = kUndersizedBackoffCount; }
+
+private:
+    uint16_t mAverageSize = 0; ///< 0 until the first size is reported
+    uint16_t mBackoff     = 0;
+};
+
 } // namespace System
 
 namespace Encoding {
@@ -0,0 +1,104 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *      This file implements chip::System::PrecisionTimer.
+ */
+
+#include <system/SystemPrecisionTimer.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace System {
+
+CHIP_ERROR PrecisionTimer::Start(Layer & systemLayer, Clock::Timeout period, TimerCompleteCallback onTick, void * appState)
+{
+    VerifyOrReturnError(onTick != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(period.count() > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Stop();
+
+    mSystemLayer  = &systemLayer;
+    mPeriod       = period;
+    mOnTick       = onTick;
+    mAppState     = appState;
+    mNextTickTime = SystemClock().GetMonotonicTimestamp() + period;
+    mMissedTicks  = 0;
+    mRunning      = true;
+    mGeneration++;
+
+    CHIP_ERROR err = mSystemLayer->StartTimer(period, HandleTick, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        mRunning = false;
+    }
+    return err;
+}
+
+void PrecisionTimer::Stop()
+{
+    VerifyOrReturn(mRunning);
+    mRunning = false;
+    mGeneration++;
+    mSystemLayer->CancelTimer(HandleTick, this);
+}
+
+void PrecisionTimer::HandleTick(Layer * systemLayer, void * appState)
+{
+    PrecisionTimer * timer    = static_cast<PrecisionTimer *>(appState);
+    const uint32_t generation = timer->mGeneration;
+
+    timer->mOnTick(systemLayer, timer->mAppState);
+
+    // The callback may have stopped or restarted the timer; reschedule only if this
+    // schedule is still the live one.
+    if (timer->mRunning && timer->mGeneration == generation)
+    {
+        timer->ScheduleNextTick();
+    }
+}
+
+CHIP_ERROR PrecisionTimer::ScheduleNextTick()
+{
+    const Clock::Timestamp now = SystemClock().GetMonotonicTimestamp();
+
+    // Advance along the fixed schedule rather than from `now`, so dispatch latency of
+    // this tick does not push back every subsequent tick.
+    mNextTickTime = mNextTickTime + mPeriod;
+    if (now >= mNextTickTime)
+    {
+        // The loop fell behind by at least a whole period: skip the elapsed deadlines
+        // (counting them) instead of firing a burst of catch-up ticks.
+        const uint64_t missed = (now - mNextTickTime).count() / mPeriod.count() + 1;
+        mMissedTicks += static_cast<uint32_t>(missed);
+        mNextTickTime = mNextTickTime + Clock::Milliseconds64(missed * mPeriod.count());
+    }
+
+    CHIP_ERROR err = mSystemLayer->StartTimer(std::chrono::duration_cast<Clock::Timeout>(mNextTickTime - now), HandleTick, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipSystemLayer, "PrecisionTimer failed to reschedule: %" CHIP_ERROR_FORMAT, err.Format());
+        mRunning = false;
+    }
+    return err;
+}
+
+} // namespace System
+} // namespace chip
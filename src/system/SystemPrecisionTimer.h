@@ -0,0 +1,105 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *      This file defines chip::System::PrecisionTimer, a drift-compensated periodic
+ *      timer for time-critical work such as cluster transition effects.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * A drift-compensated periodic timer built on System::Layer one-shot timers.
+ *
+ * A periodic effect that re-arms itself from its own callback with Layer::StartTimer()
+ * schedules each tick relative to the time the previous callback happened to run, so
+ * every tick's dispatch latency is added to the schedule and the error accumulates for
+ * the life of the effect. PrecisionTimer instead derives every deadline from a fixed
+ * schedule anchored when the timer is started: a tick dispatched late shortens the
+ * delay to the next one, so the long-run tick rate matches the requested period even
+ * when the event loop is busy.
+ *
+ * Deadlines are computed from SystemClock()'s monotonic timestamps (CLOCK_MONOTONIC on
+ * POSIX) and expired timers are dispatched by the event loop ahead of socket events,
+ * so a tick never waits behind network I/O that became ready in the same wakeup.
+ *
+ * If the event loop falls behind by one or more whole periods, the intervening ticks
+ * are skipped rather than fired back to back; the number of skipped ticks is available
+ * from GetMissedTicks() so callers animating an effect can jump to the correct frame.
+ *
+ * Not thread-safe: all methods must be called from the CHIP event loop thread.
+ */
+class PrecisionTimer
+{
+public:
+    PrecisionTimer() = default;
+    ~PrecisionTimer() { Stop(); }
+
+    /**
+     * Start ticking every @a period, invoking @a onTick with @a appState.
+     *
+     * The first tick fires one period after this call. If the timer is already
+     * running it is stopped and restarted on the new schedule.
+     *
+     * @retval CHIP_ERROR_INVALID_ARGUMENT  if @a onTick is null or @a period is zero.
+     * @retval other                        errors from Layer::StartTimer().
+     */
+    CHIP_ERROR Start(Layer & systemLayer, Clock::Timeout period, TimerCompleteCallback onTick, void * appState);
+
+    /**
+     * Stop ticking. It is not an error to stop a timer that is not running.
+     * May be called from within the tick callback to end a periodic effect.
+     */
+    void Stop();
+
+    /**
+     * Test whether the timer is currently running.
+     */
+    bool IsRunning() const { return mRunning; }
+
+    /**
+     * Return the number of ticks skipped since Start() because the event loop fell
+     * behind the schedule by one or more whole periods.
+     */
+    uint32_t GetMissedTicks() const { return mMissedTicks; }
+
+private:
+    static void HandleTick(Layer * systemLayer, void * appState);
+    CHIP_ERROR ScheduleNextTick();
+
+    Layer * mSystemLayer          = nullptr;
+    Clock::Timeout mPeriod        = Clock::kZero;
+    TimerCompleteCallback mOnTick = nullptr;
+    void * mAppState              = nullptr;
+    Clock::Timestamp mNextTickTime{ 0 };
+    uint32_t mMissedTicks = 0;
+    // Distinguishes the current Start() from an earlier one whose tick is being
+    // dispatched, so a callback that restarts the timer is not double-scheduled.
+    uint32_t mGeneration = 0;
+    bool mRunning        = false;
+};
+
+} // namespace System
+} // namespace chip
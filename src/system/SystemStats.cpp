@@ -30,6 +30,8 @@
 
 #include <lib/support/SafeInt.h>
 
+#include <inttypes.h>
+#include <stdio.h>
 #include <string.h>
 
 namespace chip {
@@ -85,6 +87,96 @@ void UpdateSnapshot(Snapshot & aSnapshot)
     SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS();
 }
 
+static constexpr size_t kMaxMetricsEmitters = 8;
+static MetricsEmitter sMetricsEmitters[kMaxMetricsEmitters];
+
+CHIP_ERROR RegisterMetricsEmitter(MetricsEmitter emitter)
+{
+    for (size_t i = 0; i < kMaxMetricsEmitters; i++)
+    {
+        if (sMetricsEmitters[i] == emitter)
+        {
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    for (size_t i = 0; i < kMaxMetricsEmitters; i++)
+    {
+        if (sMetricsEmitters[i] == nullptr)
+        {
+            sMetricsEmitters[i] = emitter;
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    return CHIP_ERROR_NO_MEMORY;
+}
+
+size_t WriteMetricType(char * buffer, size_t bufferSize, const char * name, const char * type)
+{
+    int written = snprintf(buffer, bufferSize, "# TYPE %s %s\n", name, type);
+
+    if (written < 0 || static_cast<size_t>(written) >= bufferSize)
+    {
+        return 0;
+    }
+    return static_cast<size_t>(written);
+}
+
+size_t WriteMetricLine(char * buffer, size_t bufferSize, const char * name, const char * labelKey, const char * labelValue,
+                       uint64_t value)
+{
+    int written;
+
+    if (labelKey != nullptr)
+    {
+        written = snprintf(buffer, bufferSize, "%s{%s=\"%s\"} %" PRIu64 "\n", name, labelKey, labelValue, value);
+    }
+    else
+    {
+        written = snprintf(buffer, bufferSize, "%s %" PRIu64 "\n", name, value);
+    }
+
+    if (written < 0 || static_cast<size_t>(written) >= bufferSize)
+    {
+        return 0;
+    }
+    return static_cast<size_t>(written);
+}
+
+size_t WriteMetrics(char * buffer, size_t bufferSize)
+{
+    Snapshot snapshot;
+    size_t used = 0;
+
+    UpdateSnapshot(snapshot);
+
+    used += WriteMetricType(buffer + used, bufferSize - used, "chip_resources_in_use", "gauge");
+    for (int i = 0; i < kNumEntries; i++)
+    {
+        count_t inUse = snapshot.mResourcesInUse[i];
+        used += WriteMetricLine(buffer + used, bufferSize - used, "chip_resources_in_use", "resource", sStatsStrings[i],
+                                (inUse > 0) ? static_cast<uint64_t>(inUse) : 0);
+    }
+
+    used += WriteMetricType(buffer + used, bufferSize - used, "chip_resources_watermark", "gauge");
+    for (int i = 0; i < kNumEntries; i++)
+    {
+        used += WriteMetricLine(buffer + used, bufferSize - used, "chip_resources_watermark", "resource", sStatsStrings[i],
+                                static_cast<uint64_t>(snapshot.mHighWatermarks[i]));
+    }
+
+    for (size_t i = 0; i < kMaxMetricsEmitters; i++)
+    {
+        if (sMetricsEmitters[i] != nullptr)
+        {
+            used += sMetricsEmitters[i](buffer + used, bufferSize - used);
+        }
+    }
+
+    return used;
+}
+
 bool Difference(Snapshot & result, Snapshot & after, Snapshot & before)
 {
     int i;
@@ -32,6 +32,7 @@
 // Include configuration headers
 #include <inet/InetConfig.h>
 #include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
 
 // Include dependent headers
 #include <lib/support/DLLUtil.h>
@@ -44,6 +45,7 @@
 #include <lwip/stats.h>
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace chip {
@@ -99,6 +101,46 @@ void UpdateLwipPbufCounts(void);
 typedef const char * Label;
 const Label * GetStrings();
 
+/**
+ *  A function that writes the metrics owned by one layer into @a buffer in the
+ *  Prometheus text exposition format and returns the number of bytes written
+ *  (without a null terminator).  Registered with RegisterMetricsEmitter() and
+ *  invoked from WriteMetrics().
+ */
+typedef size_t (*MetricsEmitter)(char * buffer, size_t bufferSize);
+
+/**
+ *  Register an emitter to be included in WriteMetrics() output.  Registering an
+ *  already-registered emitter is a no-op, so layers may register from Init()
+ *  paths that can run more than once.
+ *
+ *  @retval #CHIP_ERROR_NO_MEMORY  The emitter table is full.
+ */
+CHIP_ERROR RegisterMetricsEmitter(MetricsEmitter emitter);
+
+/**
+ *  Format a metric type comment ("# TYPE name type\n").  Returns the bytes
+ *  written, or 0 if the line did not fit in @a buffer.
+ */
+size_t WriteMetricType(char * buffer, size_t bufferSize, const char * name, const char * type);
+
+/**
+ *  Format one metric sample line ("name{labelKey=\"labelValue\"} value\n", or
+ *  "name value\n" when @a labelKey is nullptr).  Returns the bytes written, or
+ *  0 if the line did not fit in @a buffer.
+ */
+size_t WriteMetricLine(char * buffer, size_t bufferSize, const char * name, const char * labelKey, const char * labelValue,
+                       uint64_t value);
+
+/**
+ *  Write the resource gauges and high watermarks, followed by the output of all
+ *  registered emitters, into @a buffer in the Prometheus text exposition
+ *  format, for the application to serve from a pull-based metrics endpoint.
+ *  Samples that do not fit are dropped.  Returns the bytes written (without a
+ *  null terminator).
+ */
+size_t WriteMetrics(char * buffer, size_t bufferSize);
+
 } // namespace Stats
 } // namespace System
 } // namespace chip
@@ -160,5 +160,125 @@ TimerList TimerList::ExtractEarlier(Clock::Timestamp t)
     return out;
 }
 
+TimerWheel::Node * TimerWheel::Add(Node * add)
+{
+    const size_t bucket = BucketOf(add->AwakenTime());
+
+    add->mNextTimer  = mBuckets[bucket];
+    mBuckets[bucket] = add;
+
+    if (mEarliestTimer == nullptr || (add->AwakenTime() < mEarliestTimer->AwakenTime()))
+    {
+        mEarliestTimer = add;
+    }
+
+    return mEarliestTimer;
+}
+
+TimerWheel::Node * TimerWheel::Unlink(size_t bucket, Node * remove)
+{
+    Node ** lPrev = &mBuckets[bucket];
+    for (Node * lTimer = *lPrev; lTimer != nullptr; lPrev = &lTimer->mNextTimer, lTimer = *lPrev)
+    {
+        if (lTimer == remove)
+        {
+            *lPrev             = lTimer->mNextTimer;
+            lTimer->mNextTimer = nullptr;
+            return lTimer;
+        }
+    }
+    return nullptr;
+}
+
+TimerWheel::Node * TimerWheel::Remove(Node * remove)
+{
+    if (remove != nullptr && Unlink(BucketOf(remove->AwakenTime()), remove) != nullptr && remove == mEarliestTimer)
+    {
+        RecomputeEarliest();
+    }
+    return mEarliestTimer;
+}
+
+TimerWheel::Node * TimerWheel::Remove(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    for (Node *& bucket : mBuckets)
+    {
+        Node ** lPrev = &bucket;
+        for (Node * lTimer = *lPrev; lTimer != nullptr; lPrev = &lTimer->mNextTimer, lTimer = *lPrev)
+        {
+            if (lTimer->GetCallback().GetOnComplete() == aOnComplete && lTimer->GetCallback().GetAppState() == aAppState)
+            {
+                *lPrev             = lTimer->mNextTimer;
+                lTimer->mNextTimer = nullptr;
+                if (lTimer == mEarliestTimer)
+                {
+                    RecomputeEarliest();
+                }
+                return lTimer;
+            }
+        }
+    }
+    return nullptr;
+}
+
+TimerWheel::Node * TimerWheel::PopEarliest()
+{
+    Node * earliest = mEarliestTimer;
+    if (earliest != nullptr)
+    {
+        Unlink(BucketOf(earliest->AwakenTime()), earliest);
+        RecomputeEarliest();
+    }
+    return earliest;
+}
+
+TimerWheel::Node * TimerWheel::PopIfEarlier(Clock::Timestamp t)
+{
+    if (mEarliestTimer == nullptr || !(mEarliestTimer->AwakenTime() < t))
+    {
+        return nullptr;
+    }
+    return PopEarliest();
+}
+
+TimerList TimerWheel::ExtractEarlier(Clock::Timestamp t)
+{
+    TimerList out;
+    Node * timer;
+
+    // Popping in expiration order means each TimerList::Add() appends at the tail,
+    // preserving the ordering the callers of ExtractEarlier() expect.
+    while ((timer = PopIfEarlier(t)) != nullptr)
+    {
+        out.Add(timer);
+    }
+
+    return out;
+}
+
+void TimerWheel::Clear()
+{
+    for (Node *& bucket : mBuckets)
+    {
+        bucket = nullptr;
+    }
+    mEarliestTimer = nullptr;
+}
+
+void TimerWheel::RecomputeEarliest()
+{
+    mEarliestTimer = nullptr;
+    for (Node * bucket : mBuckets)
+    {
+        for (Node * lTimer = bucket; lTimer != nullptr; lTimer = lTimer->mNextTimer)
+        {
+            if (mEarliestTimer == nullptr || (lTimer->AwakenTime() < mEarliestTimer->AwakenTime()))
+            {
+                mEarliestTimer = lTimer;
+            }
+        }
+    }
+}
+
 } // namespace System
 } // namespace chip
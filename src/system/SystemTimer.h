@@ -177,6 +177,102 @@ private:
     Node * mEarliestTimer;
 };
 
+/**
+ * Hashed wheel of `Timer`s, hashed by expiration time.
+ *
+ * Provides the same interface as TimerList, but timers live in unsorted per-bucket lists so that
+ * Add() and Remove() do not walk the full set of pending timers.  A cached earliest-timer pointer
+ * keeps Earliest()/PopIfEarlier() O(1); the cache is recomputed only when the earliest timer itself
+ * is removed.
+ */
+class TimerWheel
+{
+public:
+    using Node = TimerList::Node;
+
+    TimerWheel() : mEarliestTimer(nullptr) {}
+
+    /**
+     * Add a timer to the wheel.
+     *
+     * @return  The new earliest timer. If this is the newly added timer, that implies it is earlier
+     *          than any existing timer.
+     */
+    Node * Add(Node * timer);
+
+    /**
+     * Remove the given timer from the wheel, if present. It is not an error for the timer not to be present.
+     *
+     * @return  The new earliest timer, or nullptr if the wheel is empty.
+     */
+    Node * Remove(Node * remove);
+
+    /**
+     * Remove the first timer with the given properties, if present. It is not an error for no such timer to be present.
+     *
+     * @return  The removed timer, or nullptr if the wheel contains no matching timer.
+     */
+    Node * Remove(TimerCompleteCallback onComplete, void * appState);
+
+    /**
+     * Remove and return the earliest timer in the wheel.
+     *
+     * @return  The earliest timer, or nullptr if the wheel is empty.
+     */
+    Node * PopEarliest();
+
+    /**
+     * Remove and return the earliest timer in the wheel, provided it expires earlier than the given time @a t.
+     *
+     * @return  The earliest timer expiring before @a t, or nullptr if there is no such timer.
+     */
+    Node * PopIfEarlier(Clock::Timestamp t);
+
+    /**
+     * Get the earliest timer in the wheel.
+     *
+     * @return  The earliest timer, or nullptr if there are no timers.
+     */
+    Node * Earliest() const { return mEarliestTimer; }
+
+    /**
+     * Test whether there are any timers.
+     */
+    bool Empty() const { return mEarliestTimer == nullptr; }
+
+    /**
+     * Remove and return all timers that expire before the given time @a t, ordered by expiration time.
+     */
+    TimerList ExtractEarlier(Clock::Timestamp t);
+
+    /**
+     * Remove all timers.
+     */
+    void Clear();
+
+private:
+    static size_t BucketOf(Clock::Timestamp t)
+    {
+        return static_cast<size_t>((t.count() / CHIP_SYSTEM_CONFIG_TIMER_WHEEL_BUCKET_WIDTH_MS) %
+                                   CHIP_SYSTEM_CONFIG_TIMER_WHEEL_NUM_BUCKETS);
+    }
+    Node * Unlink(size_t bucket, Node * remove);
+    void RecomputeEarliest();
+
+    Node * mBuckets[CHIP_SYSTEM_CONFIG_TIMER_WHEEL_NUM_BUCKETS] = { nullptr };
+    Node * mEarliestTimer;
+};
+
+/**
+ * The timer container used by the System::Layer implementations, selected by
+ * CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL.
+ */
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+using TimerQueue = TimerWheel;
+#else
+using TimerQueue = TimerList;
+#endif
+
 /**
  * ObjectPool wrapper that keeps System Timer statistics.
  */
@@ -67,8 +67,34 @@ CHIP_ERROR TLVPacketBufferBackingStore::OnInit(chip::TLV::TLVWriter & writer, ui
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TLVPacketBufferBackingStore::ResyncCurrentBuffer(const uint8_t * bufStart)
+{
+    auto contains = [bufStart](const PacketBufferHandle & buffer) {
+        return buffer->Start() <= bufStart && bufStart <= buffer->Start() + buffer->MaxDataLength();
+    };
+
+    if (!mCurrentBuffer.IsNull() && contains(mCurrentBuffer))
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    // The writer was restored from a checkpoint taken while an earlier buffer in
+    // the chain was current; walk the chain to find that buffer again.  Buffers
+    // already appended past it are kept and reused as the writer re-advances.
+    PacketBufferHandle buffer = mHeadBuffer.Retain();
+    while (!buffer.IsNull() && !contains(buffer))
+    {
+        buffer.Advance();
+    }
+    VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_INCORRECT_STATE);
+    mCurrentBuffer = std::move(buffer);
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR TLVPacketBufferBackingStore::FinalizeBuffer(chip::TLV::TLVWriter & writer, uint8_t * bufStart, uint32_t dataLen)
 {
+    ReturnErrorOnFailure(ResyncCurrentBuffer(bufStart));
+
     uint8_t * endPtr = bufStart + dataLen;
 
     intptr_t length = endPtr - mCurrentBuffer->Start();
@@ -76,7 +102,17 @@ CHIP_ERROR TLVPacketBufferBackingStore::FinalizeBuffer(chip::TLV::TLVWriter & wr
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-    mCurrentBuffer->SetDataLength(static_cast<uint16_t>(length));
+    mCurrentBuffer->SetDataLength(static_cast<uint16_t>(length), mHeadBuffer);
+
+    // Any buffers past the current one hold no finalized data (they can exist
+    // after a writer rollback); make sure they contribute nothing to the chain.
+    PacketBufferHandle tail = mCurrentBuffer.Retain();
+    tail.Advance();
+    while (!tail.IsNull())
+    {
+        tail->SetDataLength(0, mHeadBuffer);
+        tail.Advance();
+    }
 
     return CHIP_NO_ERROR;
 }
@@ -91,7 +127,7 @@ CHIP_ERROR TLVPacketBufferBackingStore::GetNewBuffer(chip::TLV::TLVWriter & writ
     mCurrentBuffer.Advance();
     if (mCurrentBuffer.IsNull())
     {
-        mCurrentBuffer = PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+        mCurrentBuffer = PacketBufferHandle::New(mChainedBufferSize, 0);
         if (mCurrentBuffer.IsNull())
         {
             return CHIP_ERROR_NO_MEMORY;
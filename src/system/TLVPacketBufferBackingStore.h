@@ -52,14 +52,20 @@ public:
      *                       If true, advance to the next buffer in the chain once all data or space
      *                       in the current buffer has been consumed; a write will allocate new
      *                       packet buffers if necessary.
+     * @param[in]    chainedBufferSize
+     *                       The allocation size of each packet buffer a write appends to the chain.
+     *                       Defaults to the largest allocatable buffer; a smaller fixed segment size
+     *                       lets an encoding grow on demand without worst-case allocations.
      *
      * @note This must take place before initializing a TLV class with this backing store.
      */
-    void Init(chip::System::PacketBufferHandle && buffer, bool useChainedBuffers = false)
+    void Init(chip::System::PacketBufferHandle && buffer, bool useChainedBuffers = false,
+              uint16_t chainedBufferSize = chip::System::PacketBuffer::kMaxSizeWithoutReserve)
     {
         mHeadBuffer        = std::move(buffer);
         mCurrentBuffer     = mHeadBuffer.Retain();
         mUseChainedBuffers = useChainedBuffers;
+        mChainedBufferSize = chainedBufferSize;
     }
     void Adopt(chip::System::PacketBufferHandle && buffer) { Init(std::move(buffer), mUseChainedBuffers); }
 
@@ -82,9 +88,15 @@ public:
     CHIP_ERROR FinalizeBuffer(chip::TLV::TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override;
 
 protected:
+    // Point mCurrentBuffer back at the chain buffer containing bufStart, to
+    // resynchronize after the writer has been restored from a checkpoint taken
+    // before the current buffer was entered.
+    CHIP_ERROR ResyncCurrentBuffer(const uint8_t * bufStart);
+
     chip::System::PacketBufferHandle mHeadBuffer;
     chip::System::PacketBufferHandle mCurrentBuffer;
     bool mUseChainedBuffers;
+    uint16_t mChainedBufferSize = chip::System::PacketBuffer::kMaxSizeWithoutReserve;
 };
 
 class DLL_EXPORT PacketBufferTLVReader : public TLV::ContiguousBufferTLVReader
@@ -118,11 +130,17 @@ public:
      *                       If true, advance to the next buffer in the chain once all space
      *                       in the current buffer has been consumed. Once all existing buffers
      *                       have been used, new PacketBuffers will be allocated as necessary.
+     * @param[in]    maxLen  Upper bound on the total encoding length, spanning all buffers in
+     *                       the chain.
+     * @param[in]    chainedBufferSize
+     *                       The allocation size of each PacketBuffer appended to the chain when
+     *                       useChainedBuffers is set.
      */
-    void Init(chip::System::PacketBufferHandle && buffer, bool useChainedBuffers = false)
+    void Init(chip::System::PacketBufferHandle && buffer, bool useChainedBuffers = false, uint32_t maxLen = UINT32_MAX,
+              uint16_t chainedBufferSize = chip::System::PacketBuffer::kMaxSizeWithoutReserve)
     {
-        mBackingStore.Init(std::move(buffer), useChainedBuffers);
-        chip::TLV::TLVWriter::Init(mBackingStore);
+        mBackingStore.Init(std::move(buffer), useChainedBuffers, chainedBufferSize);
+        chip::TLV::TLVWriter::Init(mBackingStore, maxLen);
     }
     /**
      * Finish the writing of a TLV encoding and release ownership of the underlying PacketBuffer.
@@ -101,6 +101,34 @@ void TestMockClock(nlTestSuite * inSuite, void * inContext)
     Clock::Internal::SetSystemClockForTesting(savedRealClock);
 }
 
+void TestCachedTimestamp(nlTestSuite * inSuite, void * inContext)
+{
+    Clock::Internal::MockClock clock;
+
+    Clock::ClockBase * savedRealClock = &SystemClock();
+    Clock::Internal::SetSystemClockForTesting(&clock);
+
+    constexpr Clock::Milliseconds64 k1234 = Clock::Milliseconds64(1234);
+    constexpr Clock::Milliseconds64 k5678 = Clock::Milliseconds64(5678);
+
+    // With no cache active, reads go straight to the clock.
+    clock.SetMonotonic(k1234);
+    NL_TEST_ASSERT(inSuite, SystemClock().GetMonotonicTimestamp() == k1234);
+
+    // Once refreshed, the cached value is served even after the clock advances,
+    // while the precise API still reads the clock.
+    NL_TEST_ASSERT(inSuite, SystemClock().RefreshCachedMonotonicTimestamp() == k1234);
+    clock.SetMonotonic(k5678);
+    NL_TEST_ASSERT(inSuite, SystemClock().GetMonotonicTimestamp() == k1234);
+    NL_TEST_ASSERT(inSuite, SystemClock().GetPreciseMonotonicTimestamp() == k5678);
+
+    // Invalidation returns reads to the clock.
+    SystemClock().InvalidateCachedMonotonicTimestamp();
+    NL_TEST_ASSERT(inSuite, SystemClock().GetMonotonicTimestamp() == k5678);
+
+    Clock::Internal::SetSystemClockForTesting(savedRealClock);
+}
+
 } // namespace
 
 /**
@@ -111,6 +139,7 @@ static const nlTest sTests[] =
 {
     NL_TEST_DEF("TestRealClock", TestRealClock),
     NL_TEST_DEF("TestMockClock", TestMockClock),
+    NL_TEST_DEF("TestCachedTimestamp", TestCachedTimestamp),
     NL_TEST_SENTINEL()
 };
 // clang-format on
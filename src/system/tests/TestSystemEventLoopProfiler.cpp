@@ -0,0 +1,128 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the event loop profiler.
+ */
+
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+#include <system/SystemEventLoopProfiler.h>
+
+using namespace chip::System;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+void TestRecordDispatch(nlTestSuite * inSuite, void * inContext)
+{
+    EventLoopProfiler profiler;
+    int siteA = 0;
+    int siteB = 0;
+
+    NL_TEST_ASSERT(inSuite, profiler.GetSiteCount() == 0);
+
+    // Two dispatches of the same callback accumulate into one site.
+    profiler.RecordDispatch(&siteA, EventLoopProfiler::SiteKind::kTimer, 50_us64);
+    profiler.RecordDispatch(&siteA, EventLoopProfiler::SiteKind::kTimer, 150_us64);
+    NL_TEST_ASSERT(inSuite, profiler.GetSiteCount() == 1);
+
+    const EventLoopProfiler::Site & site = profiler.GetSite(0);
+    NL_TEST_ASSERT(inSuite, site.mCallback == &siteA);
+    NL_TEST_ASSERT(inSuite, site.mKind == EventLoopProfiler::SiteKind::kTimer);
+    NL_TEST_ASSERT(inSuite, site.mCount == 2);
+    NL_TEST_ASSERT(inSuite, site.mTotalMicros == 200);
+    NL_TEST_ASSERT(inSuite, site.mMaxMicros == 150);
+
+    // 50us lands in the first bucket (<100us), 150us in the second (<300us).
+    NL_TEST_ASSERT(inSuite, site.mBuckets[0] == 1);
+    NL_TEST_ASSERT(inSuite, site.mBuckets[1] == 1);
+
+    // A different callback gets its own site.
+    profiler.RecordDispatch(&siteB, EventLoopProfiler::SiteKind::kSocket, 5_us64);
+    NL_TEST_ASSERT(inSuite, profiler.GetSiteCount() == 2);
+    NL_TEST_ASSERT(inSuite, profiler.GetSite(1).mCallback == &siteB);
+    NL_TEST_ASSERT(inSuite, profiler.GetSite(1).mKind == EventLoopProfiler::SiteKind::kSocket);
+}
+
+void TestBucketLimits(nlTestSuite * inSuite, void * inContext)
+{
+    EventLoopProfiler profiler;
+    int site = 0;
+
+    // A dispatch slower than the largest bucket limit lands in the overflow bucket.
+    profiler.RecordDispatch(&site, EventLoopProfiler::SiteKind::kTimer, 500000_us64);
+    NL_TEST_ASSERT(inSuite, profiler.GetSite(0).mBuckets[EventLoopProfiler::kNumBuckets - 1] == 1);
+
+    // A dispatch exactly at a bucket limit lands in the next bucket (limits are exclusive).
+    profiler.RecordDispatch(&site, EventLoopProfiler::SiteKind::kTimer, 100_us64);
+    NL_TEST_ASSERT(inSuite, profiler.GetSite(0).mBuckets[1] == 1);
+}
+
+void TestSiteTableFull(nlTestSuite * inSuite, void * inContext)
+{
+    EventLoopProfiler profiler;
+    int sites[EventLoopProfiler::kMaxSites + 1];
+
+    for (size_t i = 0; i < EventLoopProfiler::kMaxSites; i++)
+    {
+        profiler.RecordDispatch(&sites[i], EventLoopProfiler::SiteKind::kTimer, 10_us64);
+    }
+    NL_TEST_ASSERT(inSuite, profiler.GetSiteCount() == EventLoopProfiler::kMaxSites);
+    NL_TEST_ASSERT(inSuite, profiler.GetDroppedDispatches() == 0);
+
+    // An unknown site no longer fits and is counted as dropped ...
+    profiler.RecordDispatch(&sites[EventLoopProfiler::kMaxSites], EventLoopProfiler::SiteKind::kTimer, 10_us64);
+    NL_TEST_ASSERT(inSuite, profiler.GetSiteCount() == EventLoopProfiler::kMaxSites);
+    NL_TEST_ASSERT(inSuite, profiler.GetDroppedDispatches() == 1);
+
+    // ... while known sites continue to be recorded.
+    profiler.RecordDispatch(&sites[0], EventLoopProfiler::SiteKind::kTimer, 10_us64);
+    NL_TEST_ASSERT(inSuite, profiler.GetSite(0).mCount == 2);
+    NL_TEST_ASSERT(inSuite, profiler.GetDroppedDispatches() == 1);
+}
+
+void TestReset(nlTestSuite * inSuite, void * inContext)
+{
+    EventLoopProfiler profiler;
+    int site = 0;
+
+    profiler.RecordDispatch(&site, EventLoopProfiler::SiteKind::kTimer, 10_us64);
+    NL_TEST_ASSERT(inSuite, profiler.GetSiteCount() == 1);
+
+    profiler.Reset();
+    NL_TEST_ASSERT(inSuite, profiler.GetSiteCount() == 0);
+    NL_TEST_ASSERT(inSuite, profiler.GetDroppedDispatches() == 0);
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("TestRecordDispatch", TestRecordDispatch),
+                          NL_TEST_DEF("TestBucketLimits", TestBucketLimits),
+                          NL_TEST_DEF("TestSiteTableFull", TestSiteTableFull), NL_TEST_DEF("TestReset", TestReset),
+                          NL_TEST_SENTINEL() };
+
+} // namespace
+
+int TestSystemEventLoopProfiler(void)
+{
+    nlTestSuite theSuite = { "EventLoopProfiler", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSystemEventLoopProfiler)
@@ -58,6 +58,7 @@
 using ::chip::Encoding::PacketBufferWriter;
 using ::chip::System::PacketBuffer;
 using ::chip::System::PacketBufferHandle;
+using ::chip::System::PacketBufferSizeEstimator;
 
 #if !CHIP_SYSTEM_CONFIG_USE_LWIP
 using ::chip::System::pbuf;
@@ -132,6 +133,7 @@ public:
     static void CheckHandleRightSize(nlTestSuite * inSuite, void * inContext);
     static void CheckHandleCloneData(nlTestSuite * inSuite, void * inContext);
     static void CheckPacketBufferWriter(nlTestSuite * inSuite, void * inContext);
+    static void CheckSizeEstimator(nlTestSuite * inSuite, void * inContext);
     static void CheckBuildFreeList(nlTestSuite * inSuite, void * inContext);
 
     static void PrintHandle(const char * tag, const PacketBuffer * buffer)
@@ -1962,6 +1964,47 @@ void PacketBufferTest::CheckPacketBufferWriter(nlTestSuite * inSuite, void * inC
     NL_TEST_ASSERT(inSuite, memcmp(yayBuffer->Start(), kPayload, sizeof kPayload) == 0);
 }
 
+void PacketBufferTest::CheckSizeEstimator(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint16_t kMaxSize = 1280;
+
+    PacketBufferSizeEstimator estimator;
+
+    // Without data, the worst case is suggested.
+    NL_TEST_ASSERT(inSuite, estimator.SuggestedSize(kMaxSize) == kMaxSize);
+
+    // After seeing small messages, suggestions are right-sized: average plus
+    // headroom, rounded up to the size granularity.
+    for (int i = 0; i < 16; i++)
+    {
+        estimator.ReportFinalSize(80);
+    }
+    const uint16_t suggestion = estimator.SuggestedSize(kMaxSize);
+    NL_TEST_ASSERT(inSuite, suggestion < kMaxSize);
+    NL_TEST_ASSERT(inSuite, suggestion >= 80);
+    NL_TEST_ASSERT(inSuite, suggestion % PacketBufferSizeEstimator::kSizeGranularity == 0);
+
+    // Suggestions never exceed the caller's maximum, even for large averages.
+    for (int i = 0; i < 16; i++)
+    {
+        estimator.ReportFinalSize(kMaxSize);
+    }
+    NL_TEST_ASSERT(inSuite, estimator.SuggestedSize(kMaxSize) == kMaxSize);
+
+    // An undersized guess backs suggestions off to the worst case for a while.
+    for (int i = 0; i < 16; i++)
+    {
+        estimator.ReportFinalSize(80);
+    }
+    NL_TEST_ASSERT(inSuite, estimator.SuggestedSize(kMaxSize) < kMaxSize);
+    estimator.ReportUndersized();
+    for (int i = 0; i < PacketBufferSizeEstimator::kUndersizedBackoffCount; i++)
+    {
+        NL_TEST_ASSERT(inSuite, estimator.SuggestedSize(kMaxSize) == kMaxSize);
+    }
+    NL_TEST_ASSERT(inSuite, estimator.SuggestedSize(kMaxSize) < kMaxSize);
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
@@ -2002,6 +2045,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("PacketBuffer::HandleRightSize",        PacketBufferTest::CheckHandleRightSize),
     NL_TEST_DEF("PacketBuffer::HandleCloneData",        PacketBufferTest::CheckHandleCloneData),
     NL_TEST_DEF("PacketBuffer::PacketBufferWriter",     PacketBufferTest::CheckPacketBufferWriter),
+    NL_TEST_DEF("PacketBuffer::SizeEstimator",          PacketBufferTest::CheckSizeEstimator),
 
     NL_TEST_SENTINEL()
 };
@@ -0,0 +1,127 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the statistics metrics
+ *      export interfaces.
+ *
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <lib/support/UnitTestRegistration.h>
+#include <system/SystemStats.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::System;
+
+static void CheckMetricLineFormat(nlTestSuite * inSuite, void * inContext)
+{
+    char buffer[128];
+    size_t written;
+
+    written = Stats::WriteMetricLine(buffer, sizeof(buffer), "chip_test_metric", "resource", "Timers", 42);
+    NL_TEST_ASSERT(inSuite, written == strlen(buffer));
+    NL_TEST_ASSERT(inSuite, strcmp(buffer, "chip_test_metric{resource=\"Timers\"} 42\n") == 0);
+
+    written = Stats::WriteMetricLine(buffer, sizeof(buffer), "chip_test_metric", nullptr, nullptr, 7);
+    NL_TEST_ASSERT(inSuite, written == strlen(buffer));
+    NL_TEST_ASSERT(inSuite, strcmp(buffer, "chip_test_metric 7\n") == 0);
+
+    written = Stats::WriteMetricType(buffer, sizeof(buffer), "chip_test_metric", "counter");
+    NL_TEST_ASSERT(inSuite, written == strlen(buffer));
+    NL_TEST_ASSERT(inSuite, strcmp(buffer, "# TYPE chip_test_metric counter\n") == 0);
+
+    // A line that does not fit is dropped rather than truncated.
+    written = Stats::WriteMetricLine(buffer, 10, "chip_test_metric", nullptr, nullptr, 7);
+    NL_TEST_ASSERT(inSuite, written == 0);
+}
+
+static size_t TestEmitter(char * buffer, size_t bufferSize)
+{
+    return Stats::WriteMetricLine(buffer, bufferSize, "chip_test_emitter_metric", nullptr, nullptr, 99);
+}
+
+static void CheckWriteMetrics(nlTestSuite * inSuite, void * inContext)
+{
+    char buffer[2048];
+    size_t written;
+
+    // Registering the same emitter twice keeps a single entry.
+    NL_TEST_ASSERT(inSuite, Stats::RegisterMetricsEmitter(TestEmitter) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, Stats::RegisterMetricsEmitter(TestEmitter) == CHIP_NO_ERROR);
+
+    written = Stats::WriteMetrics(buffer, sizeof(buffer));
+    NL_TEST_ASSERT(inSuite, written == strlen(buffer));
+    NL_TEST_ASSERT(inSuite, strstr(buffer, "# TYPE chip_resources_in_use gauge\n") != nullptr);
+    NL_TEST_ASSERT(inSuite, strstr(buffer, "# TYPE chip_resources_watermark gauge\n") != nullptr);
+
+    // Every resource label appears in both metric families.
+    const Stats::Label * labels = Stats::GetStrings();
+    for (int i = 0; i < Stats::kNumEntries; i++)
+    {
+        char sample[128];
+        snprintf(sample, sizeof(sample), "chip_resources_in_use{resource=\"%s\"}", labels[i]);
+        NL_TEST_ASSERT(inSuite, strstr(buffer, sample) != nullptr);
+        snprintf(sample, sizeof(sample), "chip_resources_watermark{resource=\"%s\"}", labels[i]);
+        NL_TEST_ASSERT(inSuite, strstr(buffer, sample) != nullptr);
+    }
+
+    // The registered emitter contributes exactly one sample.
+    const char * emitted = strstr(buffer, "chip_test_emitter_metric 99\n");
+    NL_TEST_ASSERT(inSuite, emitted != nullptr);
+    NL_TEST_ASSERT(inSuite, strstr(emitted + 1, "chip_test_emitter_metric") == nullptr);
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+
+// clang-format off
+static const nlTest sTests[] =
+{
+    NL_TEST_DEF("MetricLineFormat", CheckMetricLineFormat),
+    NL_TEST_DEF("WriteMetrics", CheckWriteMetrics),
+
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int TestSystemStats(void)
+{
+    // clang-format off
+    nlTestSuite theSuite =
+	{
+        "System-Stats-Metrics",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    // Run test suit againt one context.
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSystemStats)
@@ -35,6 +35,7 @@
 #include <nlunit-test.h>
 #include <system/SystemError.h>
 #include <system/SystemLayerImpl.h>
+#include <system/SystemPrecisionTimer.h>
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
 #include <lwip/init.h>
@@ -256,6 +257,75 @@ void CheckOrder(nlTestSuite * inSuite, void * aContext)
     Clock::Internal::SetSystemClockForTesting(savedClock);
 }
 
+void CheckPrecisionTimer(nlTestSuite * inSuite, void * aContext)
+{
+    if (!LayerEvents<LayerImpl>::HasServiceEvents())
+        return;
+
+    TestContext & testContext = *static_cast<TestContext *>(aContext);
+    Layer & systemLayer       = *testContext.mLayer;
+    nlTestSuite * const suite = testContext.mTestSuite;
+
+    struct TestState
+    {
+        int count = 0;
+        static void Tick(Layer * layer, void * state) { ++static_cast<TestState *>(state)->count; }
+        static void Nop(Layer * layer, void * state) {}
+    };
+    TestState testState;
+
+    Clock::ClockBase * const savedClock = &SystemClock();
+    Clock::Internal::MockClock mockClock;
+    Clock::Internal::SetSystemClockForTesting(&mockClock);
+
+    using namespace Clock::Literals;
+    PrecisionTimer timer;
+    NL_TEST_ASSERT(suite, !timer.IsRunning());
+    NL_TEST_ASSERT(suite, timer.Start(systemLayer, 0_ms, TestState::Tick, &testState) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(suite, timer.Start(systemLayer, 100_ms, nullptr, &testState) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    NL_TEST_ASSERT(suite, timer.Start(systemLayer, 100_ms, TestState::Tick, &testState) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(suite, timer.IsRunning());
+
+    // First tick fires one period after Start().
+    mockClock.AdvanceMonotonic(100_ms);
+    LayerEvents<LayerImpl>::ServiceEvents(systemLayer);
+    NL_TEST_ASSERT(suite, testState.count == 1);
+
+    // A tick dispatched 50ms late must not push back the schedule: the next deadline
+    // stays at +300ms from Start(), not 100ms after the late dispatch.
+    mockClock.AdvanceMonotonic(150_ms);
+    LayerEvents<LayerImpl>::ServiceEvents(systemLayer);
+    NL_TEST_ASSERT(suite, testState.count == 2);
+
+    mockClock.AdvanceMonotonic(50_ms);
+    LayerEvents<LayerImpl>::ServiceEvents(systemLayer);
+    NL_TEST_ASSERT(suite, testState.count == 3);
+    NL_TEST_ASSERT(suite, timer.GetMissedTicks() == 0);
+
+    // Falling behind by whole periods skips the elapsed deadlines (counting them)
+    // instead of firing a burst of catch-up ticks.
+    mockClock.AdvanceMonotonic(1000_ms);
+    LayerEvents<LayerImpl>::ServiceEvents(systemLayer);
+    NL_TEST_ASSERT(suite, testState.count == 4);
+    NL_TEST_ASSERT(suite, timer.GetMissedTicks() == 9);
+
+    mockClock.AdvanceMonotonic(100_ms);
+    LayerEvents<LayerImpl>::ServiceEvents(systemLayer);
+    NL_TEST_ASSERT(suite, testState.count == 5);
+
+    // After Stop() no further ticks fire. The zero-delay sentinel timer keeps
+    // ServiceEvents() from blocking on an empty timer list.
+    timer.Stop();
+    NL_TEST_ASSERT(suite, !timer.IsRunning());
+    mockClock.AdvanceMonotonic(200_ms);
+    systemLayer.StartTimer(0_ms, TestState::Nop, &testState);
+    LayerEvents<LayerImpl>::ServiceEvents(systemLayer);
+    NL_TEST_ASSERT(suite, testState.count == 5);
+
+    Clock::Internal::SetSystemClockForTesting(savedClock);
+}
+
 // Test the implementation helper classes TimerPool, TimerList, and TimerData.
 namespace chip {
 namespace System {
@@ -263,6 +333,7 @@ class TestTimer
 {
 public:
     static void CheckTimerPool(nlTestSuite * inSuite, void * aContext);
+    static void CheckTimerWheel(nlTestSuite * inSuite, void * aContext);
 };
 } // namespace System
 } // namespace chip
@@ -404,6 +475,107 @@ void chip::System::TestTimer::CheckTimerPool(nlTestSuite * inSuite, void * aCont
     NL_TEST_ASSERT(suite, SYSTEM_STATS_TEST_HIGH_WATER_MARK(Stats::kSystemLayer_NumTimers, 4));
 }
 
+void chip::System::TestTimer::CheckTimerWheel(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & testContext = *static_cast<TestContext *>(aContext);
+    Layer & systemLayer       = *testContext.mLayer;
+    nlTestSuite * const suite = testContext.mTestSuite;
+
+    using Timer = TimerWheel::Node;
+    struct TestState
+    {
+        int count = 0;
+        static void Increment(Layer * layer, void * state) { ++static_cast<TestState *>(state)->count; }
+        static void Reset(Layer * layer, void * state) { static_cast<TestState *>(state)->count = 0; }
+    };
+    TestState testState;
+
+    using namespace Clock::Literals;
+    struct
+    {
+        Clock::Timestamp awakenTime;
+        TimerCompleteCallback onComplete;
+        Timer * timer;
+    } testTimer[] = {
+        { 111_ms, TestState::Increment }, // 0
+        { 100_ms, TestState::Increment }, // 1
+        { 202_ms, TestState::Reset },     // 2
+        // Chosen to share a bucket with timer 1 under the default wheel geometry
+        // (CHIP_SYSTEM_CONFIG_TIMER_WHEEL_NUM_BUCKETS * CHIP_SYSTEM_CONFIG_TIMER_WHEEL_BUCKET_WIDTH_MS
+        // milliseconds later), to exercise collision handling.
+        { 612_ms, TestState::Increment }, // 3
+    };
+
+    TimerPool<Timer> pool;
+    for (auto & timer : testTimer)
+    {
+        timer.timer = pool.Create(systemLayer, timer.awakenTime, timer.onComplete, &testState);
+        NL_TEST_ASSERT(suite, timer.timer != nullptr);
+    }
+
+    TimerWheel wheel;
+    NL_TEST_ASSERT(suite, wheel.Remove(nullptr) == nullptr);
+    NL_TEST_ASSERT(suite, wheel.Remove(nullptr, nullptr) == nullptr);
+    NL_TEST_ASSERT(suite, wheel.PopEarliest() == nullptr);
+    NL_TEST_ASSERT(suite, wheel.PopIfEarlier(500_ms) == nullptr);
+    NL_TEST_ASSERT(suite, wheel.Earliest() == nullptr);
+    NL_TEST_ASSERT(suite, wheel.Empty());
+
+    Timer * earliest = wheel.Add(testTimer[0].timer); // wheel: {} → {0} returns: 0
+    NL_TEST_ASSERT(suite, earliest == testTimer[0].timer);
+    NL_TEST_ASSERT(suite, wheel.PopIfEarlier(10_ms) == nullptr);
+    NL_TEST_ASSERT(suite, wheel.Earliest() == testTimer[0].timer);
+    NL_TEST_ASSERT(suite, !wheel.Empty());
+
+    earliest = wheel.Add(testTimer[1].timer); // wheel: {0} → {0 1} returns: 1
+    NL_TEST_ASSERT(suite, earliest == testTimer[1].timer);
+    NL_TEST_ASSERT(suite, wheel.Earliest() == testTimer[1].timer);
+
+    earliest = wheel.Add(testTimer[2].timer); // wheel: {0 1} → {0 1 2} returns: 1
+    NL_TEST_ASSERT(suite, earliest == testTimer[1].timer);
+
+    earliest = wheel.Add(testTimer[3].timer); // wheel: {0 1 2} → {0 1 2 3} returns: 1
+    NL_TEST_ASSERT(suite, earliest == testTimer[1].timer);
+
+    earliest = wheel.Remove(earliest); // wheel: {0 1 2 3} → {0 2 3} returns: 0
+    NL_TEST_ASSERT(suite, earliest == testTimer[0].timer);
+    NL_TEST_ASSERT(suite, wheel.Earliest() == testTimer[0].timer);
+
+    earliest = wheel.Remove(TestState::Reset, &testState); // wheel: {0 2 3} → {0 3} returns: 2
+    NL_TEST_ASSERT(suite, earliest == testTimer[2].timer);
+    NL_TEST_ASSERT(suite, wheel.Earliest() == testTimer[0].timer);
+
+    earliest = wheel.PopEarliest(); // wheel: {0 3} → {3} returns: 0
+    NL_TEST_ASSERT(suite, earliest == testTimer[0].timer);
+    NL_TEST_ASSERT(suite, wheel.Earliest() == testTimer[3].timer);
+
+    earliest = wheel.PopIfEarlier(10_ms); // wheel: {3} → {3} returns: nullptr
+    NL_TEST_ASSERT(suite, earliest == nullptr);
+
+    earliest = wheel.PopIfEarlier(700_ms); // wheel: {3} → {} returns: 3
+    NL_TEST_ASSERT(suite, earliest == testTimer[3].timer);
+    NL_TEST_ASSERT(suite, wheel.Empty());
+
+    earliest = wheel.Add(testTimer[3].timer); // wheel: {} → {3} returns: 3
+    wheel.Clear();                            // wheel: {3} → {}
+    NL_TEST_ASSERT(suite, earliest == testTimer[3].timer);
+    NL_TEST_ASSERT(suite, wheel.Empty());
+
+    for (auto & timer : testTimer)
+    {
+        wheel.Add(timer.timer);
+    }
+    TimerList early = wheel.ExtractEarlier(200_ms); // wheel: {0 1 2 3} → {2 3} returns: (1 0)
+    NL_TEST_ASSERT(suite, wheel.PopEarliest() == testTimer[2].timer);
+    NL_TEST_ASSERT(suite, wheel.PopEarliest() == testTimer[3].timer);
+    NL_TEST_ASSERT(suite, wheel.PopEarliest() == nullptr);
+    NL_TEST_ASSERT(suite, early.PopEarliest() == testTimer[1].timer);
+    NL_TEST_ASSERT(suite, early.PopEarliest() == testTimer[0].timer);
+    NL_TEST_ASSERT(suite, early.PopEarliest() == nullptr);
+
+    pool.ReleaseAll();
+}
+
 // Test Suite
 
 /**
@@ -415,7 +587,9 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Timer::TestOverflow",             CheckOverflow),
     NL_TEST_DEF("Timer::TestTimerStarvation",      CheckStarvation),
     NL_TEST_DEF("Timer::TestTimerOrder",           CheckOrder),
+    NL_TEST_DEF("Timer::TestPrecisionTimer",       CheckPrecisionTimer),
     NL_TEST_DEF("Timer::TestTimerPool",            chip::System::TestTimer::CheckTimerPool),
+    NL_TEST_DEF("Timer::TestTimerWheel",           chip::System::TestTimer::CheckTimerWheel),
     NL_TEST_SENTINEL()
 };
 // clang-format on
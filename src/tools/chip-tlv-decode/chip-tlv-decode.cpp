@@ -0,0 +1,356 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Offline decoder for TLV capture ring files written by
+ *      chip::TLV::Debug::Capture. Renders each captured record as an indented
+ *      element tree, annotating cluster ids found in Interaction Model path
+ *      positions with their names. Can also pretty-print a bare TLV blob.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <lib/core/CHIPTLV.h>
+#include <lib/core/CHIPTLVCapture.h>
+#include <lib/core/CHIPTLVDebug.hpp>
+#include <lib/core/CHIPTLVUtilities.hpp>
+
+using namespace chip;
+using namespace chip::TLV;
+
+namespace {
+
+struct ClusterName
+{
+    uint32_t mId;
+    const char * mName;
+};
+
+// Best-effort name table for the standard clusters; ids outside the table are
+// rendered numerically. Kept local so the tool does not depend on a particular
+// application's generated code.
+const ClusterName kClusterNames[] = {
+    { 0x0003, "Identify" },
+    { 0x0004, "Groups" },
+    { 0x0005, "Scenes" },
+    { 0x0006, "On/Off" },
+    { 0x0008, "Level Control" },
+    { 0x001D, "Descriptor" },
+    { 0x001E, "Binding" },
+    { 0x001F, "Access Control" },
+    { 0x0028, "Basic Information" },
+    { 0x0029, "OTA Software Update Provider" },
+    { 0x002A, "OTA Software Update Requestor" },
+    { 0x0030, "General Commissioning" },
+    { 0x0031, "Network Commissioning" },
+    { 0x0032, "Diagnostic Logs" },
+    { 0x0033, "General Diagnostics" },
+    { 0x0034, "Software Diagnostics" },
+    { 0x0035, "Thread Network Diagnostics" },
+    { 0x0036, "WiFi Network Diagnostics" },
+    { 0x0037, "Ethernet Network Diagnostics" },
+    { 0x003C, "Administrator Commissioning" },
+    { 0x003E, "Operational Credentials" },
+    { 0x003F, "Group Key Management" },
+    { 0x0040, "Fixed Label" },
+    { 0x0045, "Boolean State" },
+    { 0x0101, "Door Lock" },
+    { 0x0102, "Window Covering" },
+    { 0x0200, "Pump Configuration and Control" },
+    { 0x0201, "Thermostat" },
+    { 0x0300, "Color Control" },
+    { 0x0402, "Temperature Measurement" },
+    { 0x0405, "Relative Humidity Measurement" },
+    { 0x0406, "Occupancy Sensing" },
+};
+
+const char * LookupClusterName(uint64_t id)
+{
+    for (const auto & entry : kClusterNames)
+    {
+        if (entry.mId == id)
+        {
+            return entry.mName;
+        }
+    }
+    return nullptr;
+}
+
+CHIP_ERROR RenderElement(const TLVReader & aReader, size_t aDepth, void * aContext)
+{
+    TLVReader reader;
+    reader.Init(aReader);
+
+    for (size_t i = 0; i < aDepth; i++)
+    {
+        printf("  ");
+    }
+
+    const Tag tag           = reader.GetTag();
+    bool clusterIdPosition = false;
+    if (IsContextTag(tag))
+    {
+        const uint32_t tagNum = TagNumFromTag(tag);
+        printf("[%" PRIu32 "] ", tagNum);
+        // In AttributePathIB (tag 3) and CommandPathIB (tag 1), these context
+        // tags carry the cluster id; annotation elsewhere is suppressed.
+        clusterIdPosition = (tagNum == 1 || tagNum == 3);
+    }
+    else if (IsProfileTag(tag))
+    {
+        printf("[0x%" PRIx32 ":0x%" PRIx32 "] ", ProfileIdFromTag(tag), TagNumFromTag(tag));
+    }
+    else
+    {
+        printf("[anon] ");
+    }
+
+    const TLVType type = reader.GetType();
+    printf("%s", Debug::DecodeType(type));
+
+    switch (type)
+    {
+    case kTLVType_SignedInteger: {
+        int64_t value;
+        ReturnErrorOnFailure(reader.Get(value));
+        printf(" = %" PRIi64, value);
+        break;
+    }
+    case kTLVType_UnsignedInteger: {
+        uint64_t value;
+        ReturnErrorOnFailure(reader.Get(value));
+        printf(" = %" PRIu64 " (0x%" PRIx64 ")", value, value);
+        if (clusterIdPosition)
+        {
+            const char * name = LookupClusterName(value);
+            if (name != nullptr)
+            {
+                printf(" <%s>", name);
+            }
+        }
+        break;
+    }
+    case kTLVType_Boolean: {
+        bool value;
+        ReturnErrorOnFailure(reader.Get(value));
+        printf(" = %s", value ? "true" : "false");
+        break;
+    }
+    case kTLVType_FloatingPointNumber: {
+        double value;
+        ReturnErrorOnFailure(reader.Get(value));
+        printf(" = %lf", value);
+        break;
+    }
+    case kTLVType_UTF8String: {
+        const uint8_t * data;
+        ReturnErrorOnFailure(reader.GetDataPtr(data));
+        printf(" = \"%-.*s\"", static_cast<int>(reader.GetLength()), data);
+        break;
+    }
+    case kTLVType_ByteString:
+        printf(" (%" PRIu32 " bytes)", reader.GetLength());
+        break;
+    default:
+        break;
+    }
+
+    printf("\n");
+    return CHIP_NO_ERROR;
+}
+
+int DecodePayload(const uint8_t * data, uint32_t size)
+{
+    TLVReader reader;
+    reader.Init(data, size);
+
+    CHIP_ERROR err = Utilities::Iterate(reader, RenderElement, nullptr);
+    // Iterate reports end-of-input as CHIP_END_OF_TLV.
+    if (err != CHIP_NO_ERROR && err != CHIP_END_OF_TLV)
+    {
+        printf("  !! decode error: %s\n", ErrorStr(err));
+        return 1;
+    }
+    return 0;
+}
+
+int DecodeCaptureFile(const uint8_t * fileData, size_t fileSize)
+{
+    using Capture = Debug::Capture;
+
+    if (fileSize < sizeof(Capture::FileHeader))
+    {
+        fprintf(stderr, "File too small to be a capture file\n");
+        return EXIT_FAILURE;
+    }
+
+    Capture::FileHeader header;
+    memcpy(&header, fileData, sizeof(header));
+
+    if (header.mMagic != Capture::kMagic || header.mVersion != Capture::kVersion)
+    {
+        fprintf(stderr, "Not a TLV capture file (bad magic or version)\n");
+        return EXIT_FAILURE;
+    }
+    if (fileSize < sizeof(header) + header.mCapacity)
+    {
+        fprintf(stderr, "Capture file truncated (header claims %" PRIu32 " ring bytes)\n", header.mCapacity);
+        return EXIT_FAILURE;
+    }
+
+    const uint8_t * ring = fileData + sizeof(header);
+
+    // Linearize the ring into chronological order: oldest byte first.
+    uint8_t * linear = static_cast<uint8_t *>(malloc(header.mCapacity));
+    if (linear == nullptr)
+    {
+        fprintf(stderr, "Out of memory\n");
+        return EXIT_FAILURE;
+    }
+
+    uint32_t linearSize;
+    if (header.mWrapped != 0)
+    {
+        memcpy(linear, ring + header.mWriteOffset, header.mCapacity - header.mWriteOffset);
+        memcpy(linear + header.mCapacity - header.mWriteOffset, ring, header.mWriteOffset);
+        linearSize = header.mCapacity;
+    }
+    else
+    {
+        memcpy(linear, ring, header.mWriteOffset);
+        linearSize = header.mWriteOffset;
+    }
+
+    if (header.mDropped != 0)
+    {
+        printf("note: %" PRIu32 " record(s) exceeded the ring size and were dropped at capture time\n", header.mDropped);
+    }
+
+    int failures     = 0;
+    unsigned records = 0;
+    uint32_t offset  = 0;
+    bool synced      = (header.mWrapped == 0);
+
+    while (linearSize - offset >= sizeof(Capture::RecordHeader))
+    {
+        Capture::RecordHeader record;
+        memcpy(&record, linear + offset, sizeof(record));
+
+        if (record.mSync != Capture::kRecordSync || record.mSize > linearSize - offset - sizeof(record))
+        {
+            if (synced)
+            {
+                // A bad record after a good one means the remainder was partially overwritten.
+                break;
+            }
+            // After a wrap the start of the linearized buffer is the tail of an
+            // overwritten record; slide forward until the first sync word.
+            offset++;
+            continue;
+        }
+
+        synced = true;
+        offset += static_cast<uint32_t>(sizeof(record));
+
+        printf("=== record %u  t=%" PRIu64 "us  context=0x%04x  %" PRIu32 " bytes ===\n", records, record.mTimestampMicros,
+               record.mContext, record.mSize);
+        failures += DecodePayload(linear + offset, record.mSize);
+
+        offset += record.mSize;
+        records++;
+    }
+
+    printf("%u record(s) decoded\n", records);
+    free(linear);
+    return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    bool rawMode     = false;
+    const char * path = nullptr;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--raw") == 0)
+        {
+            rawMode = true;
+        }
+        else if (path == nullptr)
+        {
+            path = argv[i];
+        }
+        else
+        {
+            path = nullptr;
+            break;
+        }
+    }
+
+    if (path == nullptr)
+    {
+        fprintf(stderr, "Usage: chip-tlv-decode [--raw] <capture-file>\n");
+        fprintf(stderr, "  --raw   treat the file as a bare TLV blob instead of a capture ring\n");
+        return EXIT_FAILURE;
+    }
+
+    FILE * file = fopen(path, "rb");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "Unable to open %s\n", path);
+        return EXIT_FAILURE;
+    }
+
+    fseek(file, 0, SEEK_END);
+    const long fileLength = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (fileLength <= 0)
+    {
+        fprintf(stderr, "Empty file\n");
+        fclose(file);
+        return EXIT_FAILURE;
+    }
+
+    uint8_t * fileData = static_cast<uint8_t *>(malloc(static_cast<size_t>(fileLength)));
+    if (fileData == nullptr || fread(fileData, 1, static_cast<size_t>(fileLength), file) != static_cast<size_t>(fileLength))
+    {
+        fprintf(stderr, "Unable to read %s\n", path);
+        free(fileData);
+        fclose(file);
+        return EXIT_FAILURE;
+    }
+    fclose(file);
+
+    int status;
+    if (rawMode)
+    {
+        status = DecodePayload(fileData, static_cast<uint32_t>(fileLength));
+    }
+    else
+    {
+        status = DecodeCaptureFile(fileData, static_cast<size_t>(fileLength));
+    }
+
+    free(fileData);
+    return status;
+}
@@ -46,6 +46,9 @@ constexpr uint8_t SEKeysInfo[] = { 0x53, 0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x4
 /* Session Resumption Key Info */
 constexpr uint8_t RSEKeysInfo[] = { 0x53, 0x69, 0x67, 0x6d, 0x61, 0x31, 0x5f, 0x52, 0x65, 0x73, 0x75, 0x6d, 0x65 };
 
+/* Session Rekey Key Info */
+constexpr uint8_t RekeyKeysInfo[] = { 0x53, 0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x52, 0x65, 0x6b, 0x65, 0x79 };
+
 } // namespace
 
 using namespace Crypto;
@@ -60,10 +63,99 @@ CryptoContext::CryptoContext() : mKeyAvailable(false) {}
 
 CryptoContext::~CryptoContext()
 {
+    ReleaseCipherContexts();
+    for (auto & key : mKeys)
+    {
+        ClearSecretData(key, sizeof(CryptoKey));
+    }
+    ClearSecretData(&mNextKeys[0][0], sizeof(mNextKeys));
+    ClearSecretData(&mPrevKeys[0][0], sizeof(mPrevKeys));
+}
+
+CryptoContext::CryptoContext(const CryptoContext & other) :
+    mSessionRole(other.mSessionRole), mKeyAvailable(other.mKeyAvailable), mNextKeyAvailable(other.mNextKeyAvailable),
+    mPrevKeyAvailable(other.mPrevKeyAvailable)
+{
+    memcpy(mKeys, other.mKeys, sizeof(mKeys));
+    memcpy(mNextKeys, other.mNextKeys, sizeof(mNextKeys));
+    memcpy(mPrevKeys, other.mPrevKeys, sizeof(mPrevKeys));
+    if (other.mCipherContextsInitialized)
+    {
+        // Cipher contexts are backend state and cannot be copied; rebuild them
+        // from the copied keys.  On failure Encrypt()/Decrypt() fall back to
+        // the raw-key primitives.
+        InitCipherContexts();
+    }
+}
+
+CryptoContext & CryptoContext::operator=(const CryptoContext & other)
+{
+    if (this == &other)
+    {
+        return *this;
+    }
+
+    ReleaseCipherContexts();
+
+    mSessionRole      = other.mSessionRole;
+    mKeyAvailable     = other.mKeyAvailable;
+    mNextKeyAvailable = other.mNextKeyAvailable;
+    mPrevKeyAvailable = other.mPrevKeyAvailable;
+    memcpy(mKeys, other.mKeys, sizeof(mKeys));
+    memcpy(mNextKeys, other.mNextKeys, sizeof(mNextKeys));
+    memcpy(mPrevKeys, other.mPrevKeys, sizeof(mPrevKeys));
+    if (other.mCipherContextsInitialized)
+    {
+        InitCipherContexts();
+    }
+
+    return *this;
+}
+
+void CryptoContext::Reset()
+{
+    ReleaseCipherContexts();
     for (auto & key : mKeys)
     {
         ClearSecretData(key, sizeof(CryptoKey));
     }
+    ClearSecretData(&mNextKeys[0][0], sizeof(mNextKeys));
+    ClearSecretData(&mPrevKeys[0][0], sizeof(mPrevKeys));
+    mKeyAvailable     = false;
+    mNextKeyAvailable = false;
+    mPrevKeyAvailable = false;
+}
+
+CHIP_ERROR CryptoContext::InitCipherContexts()
+{
+    // Messages we transmit are encrypted with the I2R key when we initiated the
+    // session and the R2I key otherwise; received messages use the other key.
+    const KeyUsage encryptUsage = (mSessionRole == SessionRole::kInitiator) ? kI2RKey : kR2IKey;
+    const KeyUsage decryptUsage = (mSessionRole == SessionRole::kInitiator) ? kR2IKey : kI2RKey;
+
+    ReturnErrorOnFailure(AES_CCM_context_init(mKeys[encryptUsage], Crypto::kAES_CCM128_Key_Length, mEncryptContext));
+
+    CHIP_ERROR err = AES_CCM_context_init(mKeys[decryptUsage], Crypto::kAES_CCM128_Key_Length, mDecryptContext);
+    if (err != CHIP_NO_ERROR)
+    {
+        AES_CCM_context_release(mEncryptContext);
+        return err;
+    }
+
+    mCipherContextsInitialized = true;
+    return CHIP_NO_ERROR;
+}
+
+void CryptoContext::ReleaseCipherContexts()
+{
+    if (!mCipherContextsInitialized)
+    {
+        return;
+    }
+
+    AES_CCM_context_release(mEncryptContext);
+    AES_CCM_context_release(mDecryptContext);
+    mCipherContextsInitialized = false;
 }
 
 CHIP_ERROR CryptoContext::InitFromSecret(const ByteSpan & secret, const ByteSpan & salt, SessionInfoType infoType, SessionRole role)
@@ -114,7 +206,7 @@ CHIP_ERROR CryptoContext::InitFromSecret(const ByteSpan & secret, const ByteSpan
     mKeyAvailable = true;
     mSessionRole  = role;
 
-    return CHIP_NO_ERROR;
+    return InitCipherContexts();
 }
 
 CHIP_ERROR CryptoContext::InitFromKeyPair(const Crypto::P256Keypair & local_keypair,
@@ -130,6 +222,78 @@ CHIP_ERROR CryptoContext::InitFromKeyPair(const Crypto::P256Keypair & local_keyp
     return InitFromSecret(ByteSpan(secret, secret.Length()), salt, infoType, role);
 }
 
+CHIP_ERROR CryptoContext::PrepareRekey(const ByteSpan & salt)
+{
+    HKDF_sha_crypto mHKDF;
+    VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mNextKeyAvailable == false, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError((salt.size() == 0) || (salt.data() != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The epoch retired by the previous rotation stops being accepted once a
+    // new rotation starts.
+    ClearSecretData(&mPrevKeys[0][0], sizeof(mPrevKeys));
+    mPrevKeyAvailable = false;
+
+    // The next epoch's keys are derived from the current keys, which are
+    // themselves derived from the session secret, so a rotation never exposes
+    // material that would recover an earlier epoch.
+    ReturnErrorOnFailure(mHKDF.HKDF_SHA256(&mKeys[0][0], sizeof(mKeys), salt.data(), salt.size(), RekeyKeysInfo,
+                                           sizeof(RekeyKeysInfo), &mNextKeys[0][0], sizeof(mNextKeys)));
+
+    mNextKeyAvailable = true;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CryptoContext::CommitRekey()
+{
+    VerifyOrReturnError(mNextKeyAvailable, CHIP_ERROR_INCORRECT_STATE);
+
+    ReleaseCipherContexts();
+
+    memcpy(mPrevKeys, mKeys, sizeof(mKeys));
+    mPrevKeyAvailable = true;
+
+    memcpy(mKeys, mNextKeys, sizeof(mKeys));
+    ClearSecretData(&mNextKeys[0][0], sizeof(mNextKeys));
+    mNextKeyAvailable = false;
+
+    return InitCipherContexts();
+}
+
+CHIP_ERROR CryptoContext::ExportKeyMaterial(MutableByteSpan & out) const
+{
+    static_assert(kSerializedKeyMaterialSize == 1 + sizeof(mKeys), "key material blob layout out of sync with key table");
+
+    VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(out.size() >= kSerializedKeyMaterialSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    Encoding::LittleEndian::BufferWriter writer(out.data(), out.size());
+    writer.Put8(static_cast<uint8_t>(mSessionRole));
+    writer.Put(&mKeys[0][0], sizeof(mKeys));
+    VerifyOrReturnError(writer.Fit(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    out.reduce_size(writer.Needed());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CryptoContext::ImportKeyMaterial(const ByteSpan & in)
+{
+    VerifyOrReturnError(mKeyAvailable == false, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(in.size() == kSerializedKeyMaterialSize, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const uint8_t role = in.data()[0];
+    VerifyOrReturnError(role == static_cast<uint8_t>(SessionRole::kInitiator) ||
+                            role == static_cast<uint8_t>(SessionRole::kResponder),
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    memcpy(mKeys, in.data() + 1, sizeof(mKeys));
+    mSessionRole  = static_cast<SessionRole>(role);
+    mKeyAvailable = true;
+
+    return InitCipherContexts();
+}
+
 CHIP_ERROR CryptoContext::GetIV(const PacketHeader & header, uint8_t * iv, size_t len)
 {
 
@@ -181,18 +345,25 @@ CHIP_ERROR CryptoContext::Encrypt(const uint8_t * input, size_t input_length, ui
     ReturnErrorOnFailure(GetIV(header, IV, sizeof(IV)));
     ReturnErrorOnFailure(GetAdditionalAuthData(header, AAD, aadLen));
 
-    KeyUsage usage = kR2IKey;
-
-    // Message is encrypted before sending. If the secure session was created by session
-    // initiator, we'll use I2R key to encrypt the message that's being transmittted.
-    // Otherwise, we'll use R2I key, as the responder is sending the message.
-    if (mSessionRole == SessionRole::kInitiator)
+    if (mCipherContextsInitialized)
     {
-        usage = kI2RKey;
+        ReturnErrorOnFailure(AES_CCM_encrypt(mEncryptContext, input, input_length, AAD, aadLen, IV, sizeof(IV), output, tag, taglen));
+    }
+    else
+    {
+        KeyUsage usage = kR2IKey;
+
+        // Message is encrypted before sending. If the secure session was created by session
+        // initiator, we'll use I2R key to encrypt the message that's being transmittted.
+        // Otherwise, we'll use R2I key, as the responder is sending the message.
+        if (mSessionRole == SessionRole::kInitiator)
+        {
+            usage = kI2RKey;
+        }
+
+        ReturnErrorOnFailure(AES_CCM_encrypt(input, input_length, AAD, aadLen, mKeys[usage], Crypto::kAES_CCM128_Key_Length, IV,
+                                             sizeof(IV), output, tag, taglen));
     }
-
-    ReturnErrorOnFailure(AES_CCM_encrypt(input, input_length, AAD, aadLen, mKeys[usage], Crypto::kAES_CCM128_Key_Length, IV,
-                                         sizeof(IV), output, tag, taglen));
 
     mac.SetTag(&header, tag, taglen);
 
@@ -216,6 +387,41 @@ CHIP_ERROR CryptoContext::Decrypt(const uint8_t * input, size_t input_length, ui
     ReturnErrorOnFailure(GetIV(header, IV, sizeof(IV)));
     ReturnErrorOnFailure(GetAdditionalAuthData(header, AAD, aadLen));
 
+    CHIP_ERROR err;
+    if (mCipherContextsInitialized)
+    {
+        err = AES_CCM_decrypt(mDecryptContext, input, input_length, AAD, aadLen, tag, taglen, IV, sizeof(IV), output);
+    }
+    else
+    {
+        err = DecryptWithKeys(mKeys, input, input_length, output, AAD, aadLen, IV, tag, taglen);
+    }
+
+    if (err == CHIP_NO_ERROR)
+    {
+        return err;
+    }
+
+    // During an in-place key rotation the peer may be one epoch ahead of us
+    // (it committed keys we only prepared) or one epoch behind (it has not yet
+    // committed keys we already did).  Accept both epochs so the switchover
+    // does not drop in-flight traffic.
+    if (mNextKeyAvailable && (DecryptWithKeys(mNextKeys, input, input_length, output, AAD, aadLen, IV, tag, taglen) == CHIP_NO_ERROR))
+    {
+        return CHIP_NO_ERROR;
+    }
+    if (mPrevKeyAvailable && (DecryptWithKeys(mPrevKeys, input, input_length, output, AAD, aadLen, IV, tag, taglen) == CHIP_NO_ERROR))
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    return err;
+}
+
+CHIP_ERROR CryptoContext::DecryptWithKeys(const CryptoKey * keys, const uint8_t * input, size_t input_length, uint8_t * output,
+                                          const uint8_t * aad, uint16_t aadLen, const uint8_t * iv, const uint8_t * tag,
+                                          size_t taglen) const
+{
     KeyUsage usage = kI2RKey;
 
     // Message is decrypted on receive. If the secure session was created by session
@@ -226,8 +432,8 @@ CHIP_ERROR CryptoContext::Decrypt(const uint8_t * input, size_t input_length, ui
         usage = kR2IKey;
     }
 
-    return AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mKeys[usage], Crypto::kAES_CCM128_Key_Length, IV,
-                           sizeof(IV), output);
+    return AES_CCM_decrypt(input, input_length, aad, aadLen, tag, taglen, keys[usage], Crypto::kAES_CCM128_Key_Length, iv,
+                           kAESCCMIVLen, output);
 }
 
 } // namespace chip
@@ -37,10 +37,15 @@ class DLL_EXPORT CryptoContext
 public:
     CryptoContext();
     ~CryptoContext();
-    CryptoContext(CryptoContext &&)      = default;
-    CryptoContext(const CryptoContext &) = default;
-    CryptoContext & operator=(const CryptoContext &) = default;
-    CryptoContext & operator=(CryptoContext &&) = default;
+    CryptoContext(const CryptoContext & other);
+    CryptoContext & operator=(const CryptoContext & other);
+
+    /**
+     * @brief
+     *   Clear the derived keys and any backend cipher state, returning the
+     *   context to its freshly constructed state so it can be initialized again.
+     */
+    void Reset();
 
     /**
      *    Whether the current node initiated the session, or it is responded to a session request.
@@ -85,6 +90,31 @@ public:
      */
     CHIP_ERROR InitFromSecret(const ByteSpan & secret, const ByteSpan & salt, SessionInfoType infoType, SessionRole role);
 
+    /**
+     * @brief
+     *   Derive the next epoch's session keys from the current keys and the
+     *   provided salt, without changing the keys used for encryption.  The
+     *   prepared keys are immediately accepted for decryption, so a peer that
+     *   has already committed the rotation remains understandable before
+     *   CommitRekey() is called locally.
+     *
+     * @param salt               The salt exchanged by the re-key protocol
+     * @return CHIP_ERROR_INCORRECT_STATE if no keys have been derived yet, or
+     *         a prepared rotation is already pending.
+     */
+    CHIP_ERROR PrepareRekey(const ByteSpan & salt);
+
+    /**
+     * @brief
+     *   Switch encryption over to the keys prepared by PrepareRekey().  The
+     *   outgoing epoch's keys remain accepted for decryption until the next
+     *   rotation starts, so messages encrypted before the peer switched over
+     *   still decrypt.
+     *
+     * @return CHIP_ERROR_INCORRECT_STATE if no rotation has been prepared.
+     */
+    CHIP_ERROR CommitRekey();
+
     /**
      * @brief
      *   Encrypt the input data using keys established in the secure channel
@@ -116,6 +146,32 @@ public:
 
     ByteSpan GetAttestationChallenge() const { return ByteSpan(mKeys[kAttestationChallengeKey], Crypto::kAES_CCM128_Key_Length); }
 
+    /**
+     * Size in bytes of the blob produced by ExportKeyMaterial(): the session role
+     * followed by the I2R, R2I and attestation challenge keys.
+     */
+    static constexpr size_t kSerializedKeyMaterialSize = 1 + 3 * Crypto::kAES_CCM128_Key_Length;
+
+    /**
+     * @brief
+     *   Export the derived session keys and session role as an opaque blob, so that
+     *   an established session can be re-created on another node (e.g. a standby
+     *   controller) without renegotiating.  The blob contains raw key material;
+     *   protecting it (wrapping, secure transport) before it leaves the process is
+     *   the caller's responsibility.
+     *
+     * @param out  On success, reduced to the kSerializedKeyMaterialSize bytes written.
+     * @return CHIP_ERROR_INCORRECT_STATE if no keys have been derived yet.
+     */
+    CHIP_ERROR ExportKeyMaterial(MutableByteSpan & out) const;
+
+    /**
+     * @brief
+     *   Initialize this context from a blob produced by ExportKeyMaterial() on an
+     *   established session.  Fails if this context already holds keys.
+     */
+    CHIP_ERROR ImportKeyMaterial(const ByteSpan & in);
+
     /**
      * @brief
      *   Memory overhead of encrypting data. The overhead is independent of size of
@@ -141,6 +197,31 @@ private:
     bool mKeyAvailable;
     CryptoKey mKeys[KeyUsage::kNumCryptoKeys];
 
+    // In-place key rotation state.  mNextKeys holds keys prepared by
+    // PrepareRekey() that are not yet used for encryption; mPrevKeys holds the
+    // keys retired by the last CommitRekey().  Both key sets are accepted for
+    // decryption while their flag is set, bridging the window where the two
+    // peers of a session are one epoch apart.
+    bool mNextKeyAvailable = false;
+    bool mPrevKeyAvailable = false;
+    CryptoKey mNextKeys[KeyUsage::kNumCryptoKeys];
+    CryptoKey mPrevKeys[KeyUsage::kNumCryptoKeys];
+
+    // Reusable cipher contexts prepared once at key derivation, so crypto
+    // backends can keep an expanded key schedule or a hardware engine binding
+    // across messages instead of re-scheduling the raw key per message.  Only
+    // valid while mCipherContextsInitialized is true; when preparation fails,
+    // Encrypt()/Decrypt() fall back to the raw-key primitives.
+    bool mCipherContextsInitialized = false;
+    mutable Crypto::AesCcmContext mEncryptContext; // keyed for the direction we transmit
+    mutable Crypto::AesCcmContext mDecryptContext; // keyed for the direction we receive
+
+    CHIP_ERROR InitCipherContexts();
+    void ReleaseCipherContexts();
+
+    CHIP_ERROR DecryptWithKeys(const CryptoKey * keys, const uint8_t * input, size_t input_length, uint8_t * output,
+                               const uint8_t * aad, uint16_t aadLen, const uint8_t * iv, const uint8_t * tag, size_t taglen) const;
+
     static CHIP_ERROR GetIV(const PacketHeader & header, uint8_t * iv, size_t len);
 
     // Use unencrypted header as additional authenticated data (AAD) during encryption and decryption.
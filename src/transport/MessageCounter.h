@@ -82,6 +82,13 @@ public:
     uint32_t Value() override { return persisted.GetValue(); }
     CHIP_ERROR Advance() override { return persisted.Advance(); }
 
+    /**
+     * Top up the persisted counter reservation if it is running low.  Called
+     * off the message send path so that Advance() never has to wait on a
+     * storage write.
+     */
+    CHIP_ERROR EnsureReservation() { return persisted.ReserveIfNeeded(); }
+
 private:
 #if CONFIG_DEVICE_LAYER
     PersistedCounter persisted;
@@ -97,6 +104,7 @@ private:
             ++mValue;
             return CHIP_NO_ERROR;
         }
+        CHIP_ERROR ReserveIfNeeded() { return CHIP_NO_ERROR; }
 
     private:
         uint32_t mValue;
@@ -125,6 +133,13 @@ public:
         return CHIP_NO_ERROR;
     }
 
+    /**
+     * Replace the current counter value.  Used when restoring a replicated session,
+     * where the serialized value has already been rounded past anything the original
+     * session may have sent, so the restored side never reuses a counter.
+     */
+    void SetValue(uint32_t value) { mValue = value; }
+
 private:
     uint32_t mValue;
 };
@@ -144,7 +144,9 @@ protected:
     CHIP_ERROR HandleStatusReport(System::PacketBufferHandle && msg, bool successExpected)
     {
         Protocols::SecureChannel::StatusReport report;
-        CHIP_ERROR err = report.Parse(std::move(msg));
+        // Handshake status reports carry only the fixed fields read here, so parse the
+        // message in place instead of consuming (and potentially copying) the buffer.
+        CHIP_ERROR err = report.ParseBorrowed(msg);
         ReturnErrorOnFailure(err);
         VerifyOrReturnError(report.GetProtocolId() == Protocols::SecureChannel::Id.ToFullyQualifiedSpecForm(),
                             CHIP_ERROR_INVALID_ARGUMENT);
@@ -201,6 +201,8 @@ private:
          *  |[n]|  ...   |[0]|
          */
         uint32_t mMaxCounter; // The most recent counter we have seen
+        // std::bitset shifts and tests operate a machine word at a time, so
+        // the window stays cheap to maintain even at large configured sizes.
         std::bitset<CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE> mWindow;
     };
 
@@ -31,6 +31,14 @@
 
 #include "transport/TraceMessage.h"
 
+#if CHIP_CONFIG_SESSION_STATS
+#include <transport/SessionStats.h>
+#endif
+
+#if CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE || CHIP_CONFIG_SESSION_STATS
+#include <system/SystemClock.h>
+#endif
+
 namespace chip {
 
 using System::PacketBuffer;
@@ -42,9 +50,24 @@ CHIP_ERROR Encrypt(Transport::SecureSession * state, PayloadHeader & payloadHead
                    System::PacketBufferHandle & msgBuf, MessageCounter & counter)
 {
     VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrReturnError(!msgBuf->HasChainedBuffer(), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
     VerifyOrReturnError(msgBuf->TotalLength() <= kMaxAppMessageLen, CHIP_ERROR_MESSAGE_TOO_LONG);
 
+    if (msgBuf->HasChainedBuffer())
+    {
+        // The AEAD primitives in the crypto layer are one-shot and operate on
+        // contiguous memory, so a chained message (e.g. a large report carried
+        // over TCP) is consolidated here, once and exactly sized, instead of
+        // requiring every caller to compact before sending.  The new buffer
+        // keeps the default header reserve so the payload and packet headers
+        // can still be prepended, and leaves room for the MIC tag at the end.
+        uint16_t totalLen       = msgBuf->TotalLength();
+        PacketBufferHandle flat = PacketBufferHandle::New(static_cast<size_t>(totalLen) + kMaxTagLen);
+        VerifyOrReturnError(!flat.IsNull(), CHIP_ERROR_NO_MEMORY);
+        ReturnErrorOnFailure(msgBuf->Read(flat->Start(), totalLen));
+        flat->SetDataLength(totalLen);
+        msgBuf = std::move(flat);
+    }
+
     uint32_t messageCounter = counter.Value();
 
     static_assert(std::is_same<decltype(msgBuf->TotalLength()), uint16_t>::value,
@@ -64,9 +87,25 @@ CHIP_ERROR Encrypt(Transport::SecureSession * state, PayloadHeader & payloadHead
 
     CHIP_TRACE_MESSAGE(payloadHeader, packetHeader, data, totalLen);
 
+#if CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE || CHIP_CONFIG_SESSION_STATS
+    const System::Clock::Microseconds64 encryptStart = System::SystemClock().GetMonotonicMicroseconds64();
+#endif
+
     MessageAuthenticationCode mac;
     ReturnErrorOnFailure(state->EncryptBeforeSend(data, totalLen, data, packetHeader, mac));
 
+#if CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE || CHIP_CONFIG_SESSION_STATS
+    const uint64_t encryptMicros = (System::SystemClock().GetMonotonicMicroseconds64() - encryptStart).count();
+#endif
+#if CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE
+    trace::RecordMessageTrace(trace::MessageDirection::kOutbound, payloadHeader, packetHeader, totalLen,
+                              static_cast<uint32_t>(encryptMicros));
+#endif
+#if CHIP_CONFIG_SESSION_STATS
+    state->GetStats().AddEncrypt(totalLen, encryptMicros);
+    Transport::GlobalSessionStats().AddEncrypt(totalLen, encryptMicros);
+#endif
+
     uint16_t taglen = 0;
     ReturnErrorOnFailure(mac.Encode(packetHeader, &data[totalLen], msgBuf->AvailableDataLength(), &taglen));
 
@@ -107,9 +146,29 @@ CHIP_ERROR Decrypt(Transport::SecureSession * state, PayloadHeader & payloadHead
     msg->SetDataLength(len);
 
     uint8_t * plainText = msg->Start();
+
+#if CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE || CHIP_CONFIG_SESSION_STATS
+    const System::Clock::Microseconds64 decryptStart = System::SystemClock().GetMonotonicMicroseconds64();
+#endif
+
     ReturnErrorOnFailure(state->DecryptOnReceive(data, len, plainText, packetHeader, mac));
 
+#if CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE || CHIP_CONFIG_SESSION_STATS
+    const System::Clock::Microseconds64 decryptEnd = System::SystemClock().GetMonotonicMicroseconds64();
+#endif
+#if CHIP_CONFIG_SESSION_STATS
+    state->GetStats().AddDecrypt(len, (decryptEnd - decryptStart).count());
+    Transport::GlobalSessionStats().AddDecrypt(len, (decryptEnd - decryptStart).count());
+#endif
+
     ReturnErrorOnFailure(payloadHeader.DecodeAndConsume(msg));
+
+#if CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE
+    // Recorded after the payload header decode so the entry carries the
+    // exchange and protocol of the message just decrypted.
+    trace::RecordMessageTrace(trace::MessageDirection::kInbound, payloadHeader, packetHeader, len,
+                              static_cast<uint32_t>((decryptEnd - decryptStart).count()));
+#endif
     return CHIP_NO_ERROR;
 }
 
@@ -25,7 +25,9 @@
 #include <credentials/CHIPCert.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <transport/CryptoContext.h>
+#include <transport/SessionDelegate.h>
 #include <transport/SessionMessageCounter.h>
+#include <transport/SessionStats.h>
 #include <transport/raw/Base.h>
 #include <transport/raw/MessageHeader.h>
 #include <transport/raw/PeerAddress.h>
@@ -88,6 +90,9 @@ public:
 
     const ReliableMessageProtocolConfig & GetMRPConfig() const { return mMRPConfig; }
 
+    PeerRttEstimator & GetRttEstimator() { return mRttEstimator; }
+    const PeerRttEstimator & GetRttEstimator() const { return mRttEstimator; }
+
     uint16_t GetLocalSessionId() const { return mLocalSessionId; }
     uint16_t GetPeerSessionId() const { return mPeerSessionId; }
     FabricIndex GetFabricIndex() const { return mFabric; }
@@ -95,6 +100,14 @@ public:
     System::Clock::Timestamp GetLastActivityTime() const { return mLastActivityTime; }
     void MarkActive() { mLastActivityTime = System::SystemClock().GetMonotonicTimestamp(); }
 
+    /**
+     * Pinned sessions are never selected for eviction when the session table is full.
+     * Used to protect sessions carrying long-lived work, such as active subscriptions,
+     * from being recycled to make room for new peers.
+     */
+    bool IsPinned() const { return mPinned; }
+    void SetPinned(bool pinned) { mPinned = pinned; }
+
     CryptoContext & GetCryptoContext() { return mCryptoContext; }
 
     CHIP_ERROR EncryptBeforeSend(const uint8_t * input, size_t input_length, uint8_t * output, PacketHeader & header,
@@ -111,6 +124,50 @@ public:
 
     SessionMessageCounter & GetSessionMessageCounter() { return mSessionMessageCounter; }
 
+    /// Register a delegate to be notified when specifically this session is
+    /// released.  The delegate must not currently be registered with any session.
+    void AddHolder(SessionReleaseDelegate & holder)
+    {
+        holder.mNextHolder = mFirstHolder;
+        mFirstHolder       = &holder;
+    }
+
+    /// Unregister a previously registered delegate.  Unknown delegates are ignored.
+    void RemoveHolder(SessionReleaseDelegate & holder)
+    {
+        SessionReleaseDelegate ** link = &mFirstHolder;
+        while (*link != nullptr)
+        {
+            if (*link == &holder)
+            {
+                *link              = holder.mNextHolder;
+                holder.mNextHolder = nullptr;
+                return;
+            }
+            link = &(*link)->mNextHolder;
+        }
+    }
+
+    /**
+     * Notify and unregister every registered holder of this session.  Holders are
+     * popped from the live list one at a time, so a holder releasing itself (or
+     * other holders of this session) from within its callback is safe.
+     */
+    void NotifyHoldersOfRelease(const SessionHandle & sessionHandle)
+    {
+        while (mFirstHolder != nullptr)
+        {
+            SessionReleaseDelegate * holder = mFirstHolder;
+            mFirstHolder                    = holder->mNextHolder;
+            holder->mNextHolder             = nullptr;
+            holder->OnSessionReleased(sessionHandle);
+        }
+    }
+
+#if CHIP_CONFIG_SESSION_STATS
+    SessionStatCounters & GetStats() { return mStats; }
+#endif
+
 private:
     const Type mSecureSessionType;
     const NodeId mPeerNodeId;
@@ -121,9 +178,15 @@ private:
 
     PeerAddress mPeerAddress;
     System::Clock::Timestamp mLastActivityTime;
+    bool mPinned = false;
     ReliableMessageProtocolConfig mMRPConfig;
+    PeerRttEstimator mRttEstimator;
     CryptoContext mCryptoContext;
     SessionMessageCounter mSessionMessageCounter;
+    SessionReleaseDelegate * mFirstHolder = nullptr;
+#if CHIP_CONFIG_SESSION_STATS
+    SessionStatCounters mStats;
+#endif
 };
 
 } // namespace Transport
@@ -64,10 +64,20 @@ public:
                                            CATValues peerCATs, uint16_t peerSessionId, FabricIndex fabric,
                                            const ReliableMessageProtocolConfig & config)
     {
-        return mEntries.CreateObject(secureSessionType, localSessionId, peerNodeId, peerCATs, peerSessionId, fabric, config);
+        SecureSession * session =
+            mEntries.CreateObject(secureSessionType, localSessionId, peerNodeId, peerCATs, peerSessionId, fabric, config);
+        if (session != nullptr)
+        {
+            AddToLookupTable(session);
+        }
+        return session;
     }
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session)
+    {
+        RemoveFromLookupTable(session);
+        mEntries.ReleaseObject(session);
+    }
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -85,16 +95,14 @@ public:
     CHECK_RETURN_VALUE
     SecureSession * FindSecureSessionByLocalKey(uint16_t localSessionId)
     {
-        SecureSession * result = nullptr;
-        mEntries.ForEachActiveObject([&](auto session) {
-            if (session->GetLocalSessionId() == localSessionId)
+        for (size_t slot = LookupSlot(localSessionId); mLookupTable[slot] != nullptr; slot = NextSlot(slot))
+        {
+            if (mLookupTable[slot]->GetLocalSessionId() == localSessionId)
             {
-                result = session;
-                return Loop::Break;
+                return mLookupTable[slot];
             }
-            return Loop::Continue;
-        });
-        return result;
+        }
+        return nullptr;
     }
 
     /**
@@ -116,8 +124,85 @@ public:
         });
     }
 
+    /**
+     * Returns the least recently active session that is not pinned, or nullptr if
+     * every active session is pinned (or the table is empty).
+     *
+     * Intended for use by the session manager when the pool is exhausted: evicting
+     * the returned session lets a controller that tracks more peers than it has
+     * session slots keep reaching new devices instead of failing allocation.
+     */
+    CHECK_RETURN_VALUE
+    SecureSession * FindLeastRecentlyUsedSession()
+    {
+        SecureSession * candidate = nullptr;
+        mEntries.ForEachActiveObject([&](auto session) {
+            if (!session->IsPinned() &&
+                (candidate == nullptr || session->GetLastActivityTime() < candidate->GetLastActivityTime()))
+            {
+                candidate = session;
+            }
+            return Loop::Continue;
+        });
+        return candidate;
+    }
+
 private:
+    static constexpr size_t NextPowerOfTwo(size_t value, size_t candidate = 1)
+    {
+        return (candidate >= value) ? candidate : NextPowerOfTwo(value, candidate * 2);
+    }
+
+    // Open-addressing hash index over the pool, keyed by local session ID, so that the
+    // per-message FindSecureSessionByLocalKey() does not degrade into an O(pool size)
+    // scan when the session pool is configured large.  Kept at most half full so linear
+    // probe chains stay short and insertion always terminates.
+    static constexpr size_t kLookupTableSize = NextPowerOfTwo(kMaxSessionCount * 2);
+    static constexpr size_t kLookupTableMask = kLookupTableSize - 1;
+
+    static size_t LookupSlot(uint16_t localSessionId)
+    {
+        // Knuth multiplicative hash, folded into the table size.
+        return (static_cast<size_t>(localSessionId) * 2654435761u) & kLookupTableMask;
+    }
+
+    static size_t NextSlot(size_t slot) { return (slot + 1) & kLookupTableMask; }
+
+    void AddToLookupTable(SecureSession * session)
+    {
+        size_t slot = LookupSlot(session->GetLocalSessionId());
+        while (mLookupTable[slot] != nullptr)
+        {
+            slot = NextSlot(slot);
+        }
+        mLookupTable[slot] = session;
+    }
+
+    void RemoveFromLookupTable(SecureSession * session)
+    {
+        size_t slot = LookupSlot(session->GetLocalSessionId());
+        while (mLookupTable[slot] != session)
+        {
+            if (mLookupTable[slot] == nullptr)
+            {
+                return;
+            }
+            slot = NextSlot(slot);
+        }
+        mLookupTable[slot] = nullptr;
+
+        // Re-insert the remainder of the probe chain so entries displaced by the
+        // removed session remain reachable.
+        for (slot = NextSlot(slot); mLookupTable[slot] != nullptr; slot = NextSlot(slot))
+        {
+            SecureSession * displaced = mLookupTable[slot];
+            mLookupTable[slot]        = nullptr;
+            AddToLookupTable(displaced);
+        }
+    }
+
     BitMapObjectPool<SecureSession, kMaxSessionCount> mEntries;
+    SecureSession * mLookupTable[kLookupTableSize] = { nullptr };
 };
 
 } // namespace Transport
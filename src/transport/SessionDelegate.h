@@ -20,6 +20,10 @@
 
 namespace chip {
 
+namespace Transport {
+class SecureSession;
+} // namespace Transport
+
 class DLL_EXPORT SessionReleaseDelegate
 {
 public:
@@ -32,6 +36,14 @@ public:
      * @param session   The handle to the secure session
      */
     virtual void OnSessionReleased(const SessionHandle & session) = 0;
+
+private:
+    // Intrusive link used by Transport::SecureSession to keep the list of
+    // delegates holding a reference to specifically that session, so release
+    // only notifies the holders of the affected session.  A delegate can be
+    // registered with at most one session at a time.
+    friend class Transport::SecureSession;
+    SessionReleaseDelegate * mNextHolder = nullptr;
 };
 
 class DLL_EXPORT SessionRecoveryDelegate
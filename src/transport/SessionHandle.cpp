@@ -86,6 +86,38 @@ const ReliableMessageProtocolConfig & SessionHandle::GetMRPConfig(SessionManager
     }
 }
 
+void SessionHandle::AddRttSample(SessionManager * sessionManager, System::Clock::Milliseconds32 rtt) const
+{
+    if (IsSecure())
+    {
+        SecureSession * secureSession = sessionManager->GetSecureSession(*this);
+        if (secureSession != nullptr)
+        {
+            secureSession->GetRttEstimator().AddSample(rtt);
+        }
+    }
+    else
+    {
+        GetUnauthenticatedSession()->GetRttEstimator().AddSample(rtt);
+    }
+}
+
+System::Clock::Milliseconds32 SessionHandle::GetAdaptiveRetransTimeout(SessionManager * sessionManager,
+                                                                       System::Clock::Milliseconds32 fallback) const
+{
+    if (IsSecure())
+    {
+        SecureSession * secureSession = sessionManager->GetSecureSession(*this);
+        if (secureSession == nullptr)
+        {
+            return fallback;
+        }
+        return secureSession->GetRttEstimator().GetRetransTimeout(fallback);
+    }
+
+    return GetUnauthenticatedSession()->GetRttEstimator().GetRetransTimeout(fallback);
+}
+
 void SessionHandle::SetMRPConfig(SessionManager * sessionManager, const ReliableMessageProtocolConfig & config)
 {
     if (IsSecure())
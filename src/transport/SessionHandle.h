@@ -86,6 +86,14 @@ public:
     const ReliableMessageProtocolConfig & GetMRPConfig(SessionManager * sessionManager) const;
     void SetMRPConfig(SessionManager * sessionManager, const ReliableMessageProtocolConfig & config);
 
+    // Record an MRP round-trip time measurement on the underlying session, if it still exists.
+    void AddRttSample(SessionManager * sessionManager, System::Clock::Milliseconds32 rtt) const;
+
+    // Retransmission timeout adapted to the session's measured round-trip time; returns
+    // @a fallback until the session has recorded an RTT sample.
+    System::Clock::Milliseconds32 GetAdaptiveRetransTimeout(SessionManager * sessionManager,
+                                                            System::Clock::Milliseconds32 fallback) const;
+
     Transport::UnauthenticatedSessionHandle GetUnauthenticatedSession() const { return mUnauthenticatedSessionHandle.Value(); }
 
 private:
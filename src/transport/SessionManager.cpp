@@ -32,6 +32,8 @@
 #include <app/util/basic-types.h>
 #include <credentials/GroupDataProvider.h>
 #include <lib/core/CHIPKeyIds.h>
+#include <lib/support/BufferReader.h>
+#include <lib/support/BufferWriter.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/logging/CHIPLogging.h>
@@ -39,6 +41,7 @@
 #include <protocols/secure_channel/Constants.h>
 #include <transport/PairingSession.h>
 #include <transport/SecureMessageCodec.h>
+#include <transport/SessionStats.h>
 #include <transport/TransportMgr.h>
 
 #include <inttypes.h>
@@ -88,6 +91,8 @@ CHIP_ERROR SessionManager::Init(System::Layer * systemLayer, TransportMgrBase *
 
     mTransportMgr->SetSessionManager(this);
 
+    (void) System::Stats::RegisterMetricsEmitter(Transport::WriteSessionStatsMetrics);
+
     return CHIP_NO_ERROR;
 }
 
@@ -95,15 +100,31 @@ void SessionManager::Shutdown()
 {
     CancelExpiryTimer();
 
+#if CHIP_CONFIG_GROUP_SEND_INTER_PACKET_GAP_MS > 0
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(SessionManager::HandleGroupSendTimer, this);
+    }
+    for (size_t i = 0; i < CHIP_CONFIG_GROUP_SEND_QUEUE_SIZE; i++)
+    {
+        mGroupSendQueue[i].datagram = nullptr;
+    }
+    mGroupSendQueueHead       = 0;
+    mGroupSendQueueCount      = 0;
+    mGroupSendBurstRemaining  = CHIP_CONFIG_GROUP_SEND_BURST_SIZE;
+    mGroupSendTimerArmed      = false;
+#endif // CHIP_CONFIG_GROUP_SEND_INTER_PACKET_GAP_MS > 0
+
     mSessionReleaseDelegates.ReleaseAll();
     mSessionRecoveryDelegates.ReleaseAll();
 
     mMessageCounterManager = nullptr;
 
-    mState        = State::kNotReady;
-    mSystemLayer  = nullptr;
-    mTransportMgr = nullptr;
-    mCB           = nullptr;
+    mState                      = State::kNotReady;
+    mSystemLayer                = nullptr;
+    mTransportMgr               = nullptr;
+    mCB                         = nullptr;
+    mSessionReplicationDelegate = nullptr;
 }
 
 CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, PayloadHeader & payloadHeader,
@@ -115,6 +136,19 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
         packetHeader.SetSecureSessionControlMsg(true);
     }
 
+    // Reserve headroom for both headers in one step, so the per-header
+    // EncodeBeforeData() calls below write in place without moving the payload.
+    // Buffers allocated with PacketBufferHandle::New()'s default header reserve
+    // already have this much headroom (enforced in MessageHeader.cpp) and take
+    // the no-copy path here; an exactly-sized buffer pays at most one payload
+    // move instead of one per header.  If even the worst-case reserve does not
+    // fit, fall through: the per-header encodes reserve the exact (possibly
+    // smaller) sizes they need and fail only if those do not fit either.
+    if (!message->EnsureReservedSize(static_cast<uint16_t>(PacketHeader::kMaxEncodeSizeBytes + PayloadHeader::kMaxEncodeSizeBytes)))
+    {
+        ChipLogDetail(Inet, "Tight message buffer: header encode may move the payload");
+    }
+
 #if CHIP_PROGRESS_LOGGING
     NodeId destination;
     FabricIndex fabricIndex;
@@ -153,6 +187,15 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
             MessageCounter & counter = GetSendCounterForPacket(payloadHeader, *session);
             ReturnErrorOnFailure(SecureMessageCodec::Encrypt(session, payloadHeader, packetHeader, message, counter));
 
+            // Incremental replication: refresh the session's record each time its
+            // local counter crosses a stride boundary, so a standby's copy is never
+            // more than kSessionRecordCounterStride messages stale.
+            if (mSessionReplicationDelegate != nullptr && !IsControlMessage(payloadHeader) &&
+                counter.Value() % kSessionRecordCounterStride == 0)
+            {
+                NotifySessionRecordUpdated(*session);
+            }
+
 #if CHIP_PROGRESS_LOGGING
             destination = session->GetPeerNodeId();
             fabricIndex = session->GetFabricIndex();
@@ -257,7 +300,14 @@ CHIP_ERROR SessionManager::SendPreparedMessage(const SessionHandle & sessionHand
 
     if (mTransportMgr != nullptr)
     {
-        return mTransportMgr->SendMessage(*destination, std::move(msgBuf));
+        CHIP_ERROR err = mTransportMgr->SendMessage(*destination, std::move(msgBuf));
+
+        // With the message on the wire, top up the global encrypted counter's
+        // persisted reservation if it is running low, so that no future send
+        // has to wait on the storage write at an epoch boundary.
+        LogErrorOnFailure(mGlobalEncryptedMessageCounter.EnsureReservation());
+
+        return err;
     }
     else
     {
@@ -301,6 +351,136 @@ void SessionManager::ExpireAllPairingsForFabric(FabricIndex fabric)
     });
 }
 
+CHIP_ERROR SessionManager::SendGroupMessage(FabricIndex fabricIndex, NodeId sourceNodeId, const GroupId * groups,
+                                            size_t groupCount, PayloadHeader & payloadHeader, System::PacketBufferHandle && message)
+{
+    VerifyOrReturnError(mState == State::kInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mTransportMgr != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(groups != nullptr && groupCount > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!message.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!message->HasChainedBuffer(), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+
+    // The payload is identical for every group, so encode the payload header into it
+    // exactly once.  Once #11911 lands this is also where a single encryption pass per
+    // group key belongs, ahead of the per-group packet headers below.
+    ReturnErrorOnFailure(payloadHeader.EncodeBeforeData(message));
+
+    CHIP_ERROR firstError = CHIP_NO_ERROR;
+    for (size_t i = 0; i < groupCount; i++)
+    {
+        PacketHeader packetHeader;
+        packetHeader.SetDestinationGroupId(groups[i]);
+        packetHeader.SetFlags(Header::SecFlagValues::kPrivacyFlag);
+        packetHeader.SetSessionType(Header::SessionType::kGroupSession);
+        packetHeader.SetSourceNodeId(sourceNodeId);
+        VerifyOrReturnError(packetHeader.IsValidGroupMsg(), CHIP_ERROR_INTERNAL);
+
+        // Only the packet header differs between groups, so each datagram is a copy of
+        // the shared payload with its own header prepended.
+        System::PacketBufferHandle datagram = message.CloneData();
+        VerifyOrReturnError(!datagram.IsNull(), CHIP_ERROR_NO_MEMORY);
+        ReturnErrorOnFailure(packetHeader.EncodeBeforeData(datagram));
+
+        Transport::PeerAddress multicastAddress = Transport::PeerAddress::Multicast(fabricIndex, groups[i]);
+#if CHIP_CONFIG_GROUP_SEND_INTER_PACKET_GAP_MS > 0
+        CHIP_ERROR err = SendOrQueueGroupDatagram(multicastAddress, std::move(datagram));
+#else
+        CHIP_ERROR err = mTransportMgr->SendMessage(multicastAddress, std::move(datagram));
+#endif
+        if (err != CHIP_NO_ERROR && firstError == CHIP_NO_ERROR)
+        {
+            firstError = err;
+        }
+    }
+
+    return firstError;
+}
+
+#if CHIP_CONFIG_GROUP_SEND_INTER_PACKET_GAP_MS > 0
+
+CHIP_ERROR SessionManager::SendOrQueueGroupDatagram(const Transport::PeerAddress & destination,
+                                                    System::PacketBufferHandle && datagram)
+{
+    // Within the burst budget and with nothing queued ahead, send directly.
+    // Ordering across a fan-out is preserved because queued datagrams always
+    // drain before a direct send is allowed again.
+    if (mGroupSendQueueCount == 0 && mGroupSendBurstRemaining > 0)
+    {
+        mGroupSendBurstRemaining--;
+        // The timer doubles as the budget refill: if it fires with an empty
+        // queue, the sender has been idle for one gap interval.
+        ArmGroupSendTimer();
+        return mTransportMgr->SendMessage(destination, std::move(datagram));
+    }
+
+    VerifyOrReturnError(mGroupSendQueueCount < CHIP_CONFIG_GROUP_SEND_QUEUE_SIZE, CHIP_ERROR_SENDING_BLOCKED);
+
+    size_t tail                       = (mGroupSendQueueHead + mGroupSendQueueCount) % CHIP_CONFIG_GROUP_SEND_QUEUE_SIZE;
+    mGroupSendQueue[tail].destination = destination;
+    mGroupSendQueue[tail].datagram    = std::move(datagram);
+    mGroupSendQueueCount++;
+
+    ArmGroupSendTimer();
+    return CHIP_NO_ERROR;
+}
+
+void SessionManager::ArmGroupSendTimer()
+{
+    if (mGroupSendTimerArmed || mSystemLayer == nullptr)
+    {
+        return;
+    }
+
+    CHIP_ERROR err = mSystemLayer->StartTimer(System::Clock::Milliseconds32(CHIP_CONFIG_GROUP_SEND_INTER_PACKET_GAP_MS),
+                                              SessionManager::HandleGroupSendTimer, this);
+    if (err == CHIP_NO_ERROR)
+    {
+        mGroupSendTimerArmed = true;
+    }
+    else
+    {
+        // Without a timer the queue would never drain; fall back to sending
+        // the backlog immediately rather than dropping it.
+        ChipLogError(Inet, "Failed to arm group send pacing timer: %" CHIP_ERROR_FORMAT, err.Format());
+        while (mGroupSendQueueCount > 0)
+        {
+            PendingGroupDatagram & entry = mGroupSendQueue[mGroupSendQueueHead];
+            mTransportMgr->SendMessage(entry.destination, std::move(entry.datagram));
+            mGroupSendQueueHead = (mGroupSendQueueHead + 1) % CHIP_CONFIG_GROUP_SEND_QUEUE_SIZE;
+            mGroupSendQueueCount--;
+        }
+    }
+}
+
+void SessionManager::HandleGroupSendTimer(System::Layer * systemLayer, void * context)
+{
+    SessionManager * mgr      = static_cast<SessionManager *>(context);
+    mgr->mGroupSendTimerArmed = false;
+
+    if (mgr->mGroupSendQueueCount == 0)
+    {
+        // Idle for one full gap interval; restore the burst budget.
+        mgr->mGroupSendBurstRemaining = CHIP_CONFIG_GROUP_SEND_BURST_SIZE;
+        return;
+    }
+
+    PendingGroupDatagram & entry        = mgr->mGroupSendQueue[mgr->mGroupSendQueueHead];
+    Transport::PeerAddress destination  = entry.destination;
+    System::PacketBufferHandle datagram = std::move(entry.datagram);
+    mgr->mGroupSendQueueHead            = (mgr->mGroupSendQueueHead + 1) % CHIP_CONFIG_GROUP_SEND_QUEUE_SIZE;
+    mgr->mGroupSendQueueCount--;
+
+    CHIP_ERROR err = mgr->mTransportMgr->SendMessage(destination, std::move(datagram));
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Paced group send failed: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    mgr->ArmGroupSendTimer();
+}
+
+#endif // CHIP_CONFIG_GROUP_SEND_INTER_PACKET_GAP_MS > 0
+
 CHIP_ERROR SessionManager::NewPairing(SessionHolder & sessionHolder, const Optional<Transport::PeerAddress> & peerAddr,
                                       NodeId peerNodeId, PairingSession * pairing, CryptoContext::SessionRole direction,
                                       FabricIndex fabric)
@@ -320,6 +500,22 @@ CHIP_ERROR SessionManager::NewPairing(SessionHolder & sessionHolder, const Optio
                   peerSessionId);
     session = mSecureSessions.CreateNewSecureSession(pairing->GetSecureSessionType(), localSessionId, peerNodeId,
                                                      pairing->GetPeerCATs(), peerSessionId, fabric, pairing->GetMRPConfig());
+    if (session == nullptr)
+    {
+        // The pool is exhausted.  Rather than failing the new pairing, recycle the
+        // least recently active session that is not pinned, so a controller tracking
+        // more peers than it has session slots can still reach new devices.
+        SecureSession * evicted = mSecureSessions.FindLeastRecentlyUsedSession();
+        if (evicted != nullptr)
+        {
+            ChipLogProgress(Inet, "Session pool full; evicting least recently active session with local key %d",
+                            evicted->GetLocalSessionId());
+            HandleConnectionExpired(*evicted);
+            mSecureSessions.ReleaseSession(evicted);
+            session = mSecureSessions.CreateNewSecureSession(pairing->GetSecureSessionType(), localSessionId, peerNodeId,
+                                                             pairing->GetPeerCATs(), peerSessionId, fabric, pairing->GetMRPConfig());
+        }
+    }
     ReturnErrorCodeIf(session == nullptr, CHIP_ERROR_NO_MEMORY);
 
     if (peerAddr.HasValue() && peerAddr.Value().GetIPAddress() != Inet::IPAddress::Any)
@@ -342,6 +538,8 @@ CHIP_ERROR SessionManager::NewPairing(SessionHolder & sessionHolder, const Optio
     session->GetSessionMessageCounter().GetPeerMessageCounter().SetCounter(pairing->GetPeerCounter());
     sessionHolder.Grab(SessionHandle(session->GetPeerNodeId(), session->GetLocalSessionId(), session->GetPeerSessionId(), fabric));
 
+    NotifySessionRecordUpdated(*session);
+
     return CHIP_NO_ERROR;
 }
 
@@ -416,6 +614,148 @@ void SessionManager::RefreshSessionOperationalData(const SessionHandle & session
     });
 }
 
+CHIP_ERROR SessionManager::WriteSessionRecord(SecureSession & session, MutableByteSpan & record)
+{
+    VerifyOrReturnError(record.size() >= kSessionRecordSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    uint8_t keyMaterial[CryptoContext::kSerializedKeyMaterialSize];
+    MutableByteSpan keySpan(keyMaterial);
+    ReturnErrorOnFailure(session.GetCryptoContext().ExportKeyMaterial(keySpan));
+
+    Encoding::LittleEndian::BufferWriter writer(record.data(), record.size());
+    writer.Put8(kSessionRecordVersion);
+    writer.Put8(static_cast<uint8_t>(session.GetSecureSessionType()));
+    writer.Put8(session.GetFabricIndex());
+    writer.Put16(session.GetLocalSessionId());
+    writer.Put16(session.GetPeerSessionId());
+    writer.Put64(session.GetPeerNodeId());
+
+    const CATValues peerCATs = session.GetPeerCATs();
+    writer.Put8(static_cast<uint8_t>(CATValues::size()));
+    for (auto cat : peerCATs.values)
+    {
+        writer.Put32(cat);
+    }
+
+    writer.Put32(session.GetMRPConfig().mIdleRetransTimeout.count());
+    writer.Put32(session.GetMRPConfig().mActiveRetransTimeout.count());
+
+    // The local counter is rounded up a full stride so a session restored from
+    // this record never reuses a counter value this side may have sent after
+    // the record was taken.
+    writer.Put32(session.GetSessionMessageCounter().GetLocalMessageCounter().Value() + kSessionRecordCounterStride);
+    writer.Put32(session.GetSessionMessageCounter().GetPeerMessageCounter().GetCounter());
+
+    writer.Put(keyMaterial, sizeof(keyMaterial));
+    Crypto::ClearSecretData(keyMaterial, sizeof(keyMaterial));
+
+    VerifyOrReturnError(writer.Fit(), CHIP_ERROR_BUFFER_TOO_SMALL);
+    record.reduce_size(writer.Needed());
+    return CHIP_NO_ERROR;
+}
+
+void SessionManager::NotifySessionRecordUpdated(SecureSession & session)
+{
+    VerifyOrReturn(mSessionReplicationDelegate != nullptr);
+
+    uint8_t buffer[kSessionRecordSize];
+    MutableByteSpan record(buffer);
+    CHIP_ERROR err = WriteSessionRecord(session, record);
+    if (err == CHIP_NO_ERROR)
+    {
+        mSessionReplicationDelegate->OnSessionRecordUpdated(ByteSpan(record.data(), record.size()));
+    }
+    else
+    {
+        ChipLogError(Inet, "Failed to serialize session record for replication: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+    Crypto::ClearSecretData(buffer, sizeof(buffer));
+}
+
+CHIP_ERROR SessionManager::SerializeSessionRecord(const SessionHandle & sessionHandle, MutableByteSpan & record)
+{
+    SecureSession * session = GetSecureSession(sessionHandle);
+    VerifyOrReturnError(session != nullptr, CHIP_ERROR_NOT_CONNECTED);
+    return WriteSessionRecord(*session, record);
+}
+
+CHIP_ERROR SessionManager::ReplicateAllSessions()
+{
+    VerifyOrReturnError(mSessionReplicationDelegate != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    mSecureSessions.ForEachSession([&](auto session) {
+        NotifySessionRecordUpdated(*session);
+        return Loop::Continue;
+    });
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SessionManager::InjectSessionRecord(const ByteSpan & record)
+{
+    VerifyOrReturnError(mState == State::kInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(record.size() == kSessionRecordSize, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Encoding::LittleEndian::Reader reader(record.data(), record.size());
+    uint8_t version, sessionType, fabricIndex, catCount;
+    uint16_t localSessionId, peerSessionId;
+    uint64_t peerNodeId;
+    ReturnErrorOnFailure(reader.Read8(&version)
+                             .Read8(&sessionType)
+                             .Read8(&fabricIndex)
+                             .Read16(&localSessionId)
+                             .Read16(&peerSessionId)
+                             .Read64(&peerNodeId)
+                             .Read8(&catCount)
+                             .StatusCode());
+    VerifyOrReturnError(version == kSessionRecordVersion, CHIP_ERROR_VERSION_MISMATCH);
+    VerifyOrReturnError(sessionType == static_cast<uint8_t>(SecureSession::Type::kPASE) ||
+                            sessionType == static_cast<uint8_t>(SecureSession::Type::kCASE),
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    // The CAT capacity is build-configuration dependent; active and standby must
+    // run the same build for records to be interchangeable.
+    VerifyOrReturnError(catCount == CATValues::size(), CHIP_ERROR_VERSION_MISMATCH);
+
+    CATValues peerCATs;
+    for (size_t i = 0; i < CATValues::size(); i++)
+    {
+        reader.Read32(&peerCATs.values[i]);
+    }
+
+    uint32_t idleRetransMs, activeRetransMs, localCounter, peerCounter;
+    ReturnErrorOnFailure(
+        reader.Read32(&idleRetransMs).Read32(&activeRetransMs).Read32(&localCounter).Read32(&peerCounter).StatusCode());
+
+    const ByteSpan keyMaterial(record.data() + record.size() - CryptoContext::kSerializedKeyMaterialSize,
+                               CryptoContext::kSerializedKeyMaterialSize);
+
+    // Replace any stale session with the same local session ID, as NewPairing does.
+    SecureSession * session = mSecureSessions.FindSecureSessionByLocalKey(localSessionId);
+    if (session != nullptr)
+    {
+        HandleConnectionExpired(*session);
+        mSecureSessions.ReleaseSession(session);
+    }
+
+    session = mSecureSessions.CreateNewSecureSession(
+        static_cast<SecureSession::Type>(sessionType), localSessionId, peerNodeId, peerCATs, peerSessionId, fabricIndex,
+        ReliableMessageProtocolConfig(System::Clock::Milliseconds32(idleRetransMs), System::Clock::Milliseconds32(activeRetransMs)));
+    VerifyOrReturnError(session != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    CHIP_ERROR err = session->GetCryptoContext().ImportKeyMaterial(keyMaterial);
+    if (err != CHIP_NO_ERROR)
+    {
+        mSecureSessions.ReleaseSession(session);
+        return err;
+    }
+
+    session->GetSessionMessageCounter().GetLocalMessageCounter().SetValue(localCounter);
+    session->GetSessionMessageCounter().GetPeerMessageCounter().SetCounter(peerCounter);
+
+    ChipLogDetail(Inet, "Installed replicated secure session for device 0x" ChipLogFormatX64 ", key %d",
+                  ChipLogValueX64(peerNodeId), localSessionId);
+    return CHIP_NO_ERROR;
+}
+
 void SessionManager::MessageDispatch(const PacketHeader & packetHeader, const Transport::PeerAddress & peerAddress,
                                      System::PacketBufferHandle && msg)
 {
@@ -487,6 +827,10 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & packetHea
     if (SecureMessageCodec::Decrypt(session, payloadHeader, packetHeader, msg) != CHIP_NO_ERROR)
     {
         ChipLogError(Inet, "Secure transport received message, but failed to decode/authenticate it, discarding");
+#if CHIP_CONFIG_SESSION_STATS
+        session->GetStats().mDecryptFailures++;
+        Transport::GlobalSessionStats().mDecryptFailures++;
+#endif
         return;
     }
 
@@ -495,10 +839,18 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & packetHea
     {
         isDuplicate = SessionMessageDelegate::DuplicateMessage::Yes;
         err         = CHIP_NO_ERROR;
+#if CHIP_CONFIG_SESSION_STATS
+        session->GetStats().mDuplicateMessages++;
+        Transport::GlobalSessionStats().mDuplicateMessages++;
+#endif
     }
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Inet, "Message counter verify failed, err = %" CHIP_ERROR_FORMAT, err.Format());
+#if CHIP_CONFIG_SESSION_STATS
+        session->GetStats().mCounterWindowDrops++;
+        Transport::GlobalSessionStats().mCounterWindowDrops++;
+#endif
         return;
     }
 
@@ -542,7 +894,7 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & packetHeade
     PayloadHeader payloadHeader;
     SessionMessageDelegate::DuplicateMessage isDuplicate = SessionMessageDelegate::DuplicateMessage::No;
     FabricIndex fabricIndex = 0; // TODO : remove initialization once GroupDataProvider->Decrypt is implemented
-    // Credentials::GroupDataProvider * groups = Credentials::GetGroupDataProvider();
+    Credentials::GroupDataProvider * groups = Credentials::GetGroupDataProvider();
 
     if (msg.IsNull())
     {
@@ -557,6 +909,15 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & packetHeade
         return;
     }
 
+    // A group message can only be addressed to us if its session ID matches one of
+    // the installed operational group keys; drop mismatches before any key work.
+    if ((groups != nullptr) && !groups->IsGroupSessionId(packetHeader.GetSessionId()))
+    {
+        ChipLogDetail(Inet, "Ignoring group message with unknown group session ID 0x%04x",
+                      static_cast<unsigned>(packetHeader.GetSessionId()));
+        return;
+    }
+
     // Trial decryption with GroupDataProvider. TODO: Implement the GroupDataProvider Class
     // TODO retrieve also the fabricIndex with the GroupDataProvider.
     // VerifyOrExit(CHIP_NO_ERROR == groups->DecryptMessage(packetHeader, payloadHeader, msg),
@@ -606,18 +967,28 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & packetHeade
     }
 }
 
-void SessionManager::HandleConnectionExpired(const Transport::SecureSession & session)
+void SessionManager::HandleConnectionExpired(Transport::SecureSession & session)
 {
     ChipLogDetail(Inet, "Marking old secure session for device 0x" ChipLogFormatX64 " as expired",
                   ChipLogValueX64(session.GetPeerNodeId()));
 
     SessionHandle sessionHandle(session.GetPeerNodeId(), session.GetLocalSessionId(), session.GetPeerSessionId(),
                                 session.GetFabricIndex());
+
+    // Holders registered against this specific session (e.g. exchanges) first ...
+    session.NotifyHoldersOfRelease(sessionHandle);
+
+    // ... then delegates interested in every session release.
     mSessionReleaseDelegates.ForEachActiveObject([&](std::reference_wrapper<SessionReleaseDelegate> * cb) {
         cb->get().OnSessionReleased(sessionHandle);
         return Loop::Continue;
     });
 
+    if (mSessionReplicationDelegate != nullptr)
+    {
+        mSessionReplicationDelegate->OnSessionRetired(session.GetLocalSessionId());
+    }
+
     mTransportMgr->Disconnect(session.GetPeerAddress());
 }
 
@@ -629,7 +1000,7 @@ void SessionManager::ExpiryTimerCallback(System::Layer * layer, void * param)
     // the #ifdef should be removed after that.
     mgr->mSecureSessions.ExpireInactiveSessions(
         System::SystemClock().GetMonotonicTimestamp(), System::Clock::Milliseconds32(CHIP_PEER_CONNECTION_TIMEOUT_MS),
-        [this](const Transport::SecureSession & state1) { HandleConnectionExpired(state1); });
+        [this](Transport::SecureSession & state1) { HandleConnectionExpired(state1); });
 #endif
     mgr->ScheduleExpiryTimer(); // re-schedule the oneshot timer
 }
@@ -28,7 +28,9 @@
 #include <utility>
 
 #include <inet/IPAddress.h>
+#include <lib/core/CASEAuthTag.h>
 #include <lib/core/CHIPCore.h>
+#include <lib/support/CodeLayoutAnnotations.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
@@ -40,6 +42,7 @@
 #include <transport/SessionHandle.h>
 #include <transport/SessionHolder.h>
 #include <transport/SessionMessageDelegate.h>
+#include <transport/SessionReplicationDelegate.h>
 #include <transport/TransportMgr.h>
 #include <transport/UnauthenticatedSessionTable.h>
 #include <transport/raw/Base.h>
@@ -143,6 +146,20 @@ public:
      */
     CHIP_ERROR SendPreparedMessage(const SessionHandle & session, const EncryptedPacketBufferHandle & preparedMessage);
 
+    /**
+     * @brief
+     *   Fan a single group payload out to several multicast groups on the same fabric.
+     *
+     * @details
+     *   The payload header is encoded into the shared payload exactly once; each group
+     *   only gets its own packet header and multicast destination, instead of running
+     *   the whole message preparation per group.  Sending to one group failing does not
+     *   stop the remaining groups from being attempted; the first error encountered is
+     *   returned once all groups have been tried.
+     */
+    CHIP_ERROR SendGroupMessage(FabricIndex fabricIndex, NodeId sourceNodeId, const GroupId * groups, size_t groupCount,
+                                PayloadHeader & payloadHeader, System::PacketBufferHandle && message);
+
     Transport::SecureSession * GetSecureSession(const SessionHandle & session);
 
     /// @brief Set the delegate for handling incoming messages. There can be only one message delegate (probably the
@@ -174,10 +191,99 @@ public:
         });
     }
 
+    /**
+     * @brief Register a delegate to be notified when specifically the given session is
+     *   released.  Unlike RegisterReleaseDelegate, release notification walks only the
+     *   holders of the affected session, so mass session eviction stays linear in the
+     *   holders of the sessions actually going away.  No-op for handles that do not
+     *   refer to a live secure session.
+     */
+    void AddSessionHolder(const SessionHandle & session, SessionReleaseDelegate & holder)
+    {
+        Transport::SecureSession * secureSession = GetSecureSession(session);
+        if (secureSession != nullptr)
+        {
+            secureSession->AddHolder(holder);
+        }
+    }
+
+    void RemoveSessionHolder(const SessionHandle & session, SessionReleaseDelegate & holder)
+    {
+        Transport::SecureSession * secureSession = GetSecureSession(session);
+        if (secureSession != nullptr)
+        {
+            secureSession->RemoveHolder(holder);
+        }
+    }
+
     void RegisterRecoveryDelegate(SessionRecoveryDelegate & cb);
     void UnregisterRecoveryDelegate(SessionRecoveryDelegate & cb);
     void RefreshSessionOperationalData(const SessionHandle & sessionHandle);
 
+    /**
+     * Serialized session record layout version.  Bumped whenever the record
+     * format below changes; InjectSessionRecord() rejects other versions.
+     */
+    static constexpr uint8_t kSessionRecordVersion = 1;
+
+    /**
+     * Local message counters are serialized rounded up by this stride, and a
+     * session's record is re-emitted each time the local counter crosses a stride
+     * boundary.  A record is therefore never more than one stride stale, and a
+     * session restored from it never reuses a counter value the original side
+     * already sent.
+     */
+    static constexpr uint32_t kSessionRecordCounterStride = 1024;
+
+    /**
+     * Size of a serialized session record: version, session type, fabric index,
+     * local and peer session IDs, peer node ID, peer CATs (count plus values),
+     * MRP intervals, local and peer message counters, and the key material blob.
+     */
+    static constexpr size_t kSessionRecordSize = 3 * sizeof(uint8_t) + 2 * sizeof(uint16_t) + sizeof(uint64_t) + sizeof(uint8_t) +
+        sizeof(CASEAuthTag) * kMaxSubjectCATAttributeCount + 4 * sizeof(uint32_t) + CryptoContext::kSerializedKeyMaterialSize;
+
+    /**
+     * @brief
+     *   Register a delegate that receives a compact serialized record for every
+     *   secure session when it is established and periodically as its message
+     *   counters advance, plus a notification when a session goes away.  Intended
+     *   for active/standby controller deployments: the application streams the
+     *   records to the standby, which installs them with InjectSessionRecord(), so
+     *   failover takes over established sessions instead of renegotiating every
+     *   fabric.  Records contain raw session keys; wrapping them before they leave
+     *   the process is the application's responsibility.  Pass nullptr to
+     *   unregister.
+     */
+    void SetSessionReplicationDelegate(SessionReplicationDelegate * delegate) { mSessionReplicationDelegate = delegate; }
+
+    SessionReplicationDelegate * GetSessionReplicationDelegate() const { return mSessionReplicationDelegate; }
+
+    /**
+     * @brief
+     *   Serialize the state of an established secure session into @a record, which
+     *   must hold at least kSessionRecordSize bytes and is reduced to the bytes
+     *   written.
+     */
+    CHIP_ERROR SerializeSessionRecord(const SessionHandle & session, MutableByteSpan & record);
+
+    /**
+     * @brief
+     *   Re-emit a record for every live secure session through the replication
+     *   delegate, e.g. when a standby (re)attaches and needs a full snapshot.
+     */
+    CHIP_ERROR ReplicateAllSessions();
+
+    /**
+     * @brief
+     *   Install a secure session from a record produced by SerializeSessionRecord()
+     *   on another node running the same build.  The session is usable without any
+     *   renegotiation; its peer address is learned from the first inbound packet
+     *   (or set by address resolution), since addresses are deployment-local and
+     *   not part of the record.
+     */
+    CHIP_ERROR InjectSessionRecord(const ByteSpan & record);
+
     /**
      * @brief
      *   Establish a new pairing with a peer node
@@ -227,7 +333,7 @@ public:
      * @param source    the source address of the package
      * @param msgBuf    the buffer containing a full CHIP message (except for the optional length field).
      */
-    void OnMessageReceived(const Transport::PeerAddress & source, System::PacketBufferHandle && msgBuf) override;
+    CHIP_HOT void OnMessageReceived(const Transport::PeerAddress & source, System::PacketBufferHandle && msgBuf) override;
 
     Optional<SessionHandle> CreateUnauthenticatedSession(const Transport::PeerAddress & peerAddress,
                                                          const ReliableMessageProtocolConfig & config)
@@ -262,12 +368,38 @@ private:
         kPayloadIsUnencrypted,
     };
 
+#if CHIP_CONFIG_GROUP_SEND_INTER_PACKET_GAP_MS > 0
+    /**
+     * Paced group fan-out.  Group datagrams within the burst budget are sent
+     * immediately; once the budget is exhausted (or while earlier datagrams
+     * are still queued) they are queued and drained one per gap interval off
+     * a SystemLayer timer, so large fan-outs do not overflow access point
+     * queues.  The budget refills after one idle gap interval.
+     */
+    struct PendingGroupDatagram
+    {
+        Transport::PeerAddress destination;
+        System::PacketBufferHandle datagram;
+    };
+
+    CHIP_ERROR SendOrQueueGroupDatagram(const Transport::PeerAddress & destination, System::PacketBufferHandle && datagram);
+    void ArmGroupSendTimer();
+    static void HandleGroupSendTimer(System::Layer * systemLayer, void * context);
+
+    PendingGroupDatagram mGroupSendQueue[CHIP_CONFIG_GROUP_SEND_QUEUE_SIZE];
+    size_t mGroupSendQueueHead       = 0;
+    size_t mGroupSendQueueCount      = 0;
+    uint8_t mGroupSendBurstRemaining = CHIP_CONFIG_GROUP_SEND_BURST_SIZE;
+    bool mGroupSendTimerArmed        = false;
+#endif // CHIP_CONFIG_GROUP_SEND_INTER_PACKET_GAP_MS > 0
+
     System::Layer * mSystemLayer = nullptr;
     Transport::UnauthenticatedSessionTable<CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE> mUnauthenticatedSessions;
     Transport::SecureSessionTable<CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE> mSecureSessions; // < Active connections to other peers
     State mState;                                                                         // < Initialization state of the object
 
-    SessionMessageDelegate * mCB = nullptr;
+    SessionMessageDelegate * mCB                             = nullptr;
+    SessionReplicationDelegate * mSessionReplicationDelegate = nullptr;
 
     // TODO: This is a temporary solution to release sessions, in the near future, SessionReleaseDelegate will be
     //       directly associated with the every SessionHolder. Then the callback function is called on over the handle
@@ -293,15 +425,21 @@ private:
     /**
      * Called when a specific connection expires.
      */
-    void HandleConnectionExpired(const Transport::SecureSession & state);
+    void HandleConnectionExpired(Transport::SecureSession & state);
 
     /**
      * Callback for timer expiry check
      */
     static void ExpiryTimerCallback(System::Layer * layer, void * param);
 
-    void SecureUnicastMessageDispatch(const PacketHeader & packetHeader, const Transport::PeerAddress & peerAddress,
-                                      System::PacketBufferHandle && msg);
+    /** Serialize @a session into @a record (see SerializeSessionRecord()). */
+    CHIP_ERROR WriteSessionRecord(Transport::SecureSession & session, MutableByteSpan & record);
+
+    /** Emit a record for @a session through the replication delegate, if one is registered. */
+    void NotifySessionRecordUpdated(Transport::SecureSession & session);
+
+    CHIP_HOT void SecureUnicastMessageDispatch(const PacketHeader & packetHeader, const Transport::PeerAddress & peerAddress,
+                                               System::PacketBufferHandle && msg);
 
     void SecureGroupMessageDispatch(const PacketHeader & packetHeader, const Transport::PeerAddress & peerAddress,
                                     System::PacketBufferHandle && msg);
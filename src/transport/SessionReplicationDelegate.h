@@ -0,0 +1,61 @@
+/*
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/support/DLLUtil.h>
+#include <lib/support/Span.h>
+
+namespace chip {
+
+/**
+ * @brief
+ *   Receives compactly serialized secure session records from the SessionManager,
+ *   so an application can stream session state to a standby node.  The standby
+ *   installs the records with SessionManager::InjectSessionRecord(), making
+ *   failover take over established sessions instead of renegotiating them.
+ *
+ *   Records contain raw session key material.  The application is responsible
+ *   for protecting a record (wrapping the keys, securing the replication
+ *   channel) before it leaves the process.
+ */
+class DLL_EXPORT SessionReplicationDelegate
+{
+public:
+    virtual ~SessionReplicationDelegate() {}
+
+    /**
+     * @brief
+     *   Called with a serialized record when a secure session is established, and
+     *   again each time the session's record is refreshed (see
+     *   SessionManager::kSessionRecordCounterStride).  The record is only valid
+     *   for the duration of the call; copy it if it must be kept.
+     *
+     * @param record   The serialized session record
+     */
+    virtual void OnSessionRecordUpdated(const ByteSpan & record) = 0;
+
+    /**
+     * @brief
+     *   Called when a previously replicated session goes away, so the standby's
+     *   copy can be discarded.
+     *
+     * @param localSessionId   The local session ID carried in the session's records
+     */
+    virtual void OnSessionRetired(uint16_t localSessionId) = 0;
+};
+
+} // namespace chip
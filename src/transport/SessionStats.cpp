@@ -0,0 +1,63 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <transport/SessionStats.h>
+
+#include <system/SystemStats.h>
+
+namespace chip {
+namespace Transport {
+
+SessionStatCounters & GlobalSessionStats()
+{
+    static SessionStatCounters sGlobalSessionStats;
+    return sGlobalSessionStats;
+}
+
+size_t WriteSessionStatsMetrics(char * buffer, size_t bufferSize)
+{
+    const SessionStatCounters & stats = GlobalSessionStats();
+    size_t used                       = 0;
+
+    const struct
+    {
+        const char * name;
+        uint64_t value;
+    } counters[] = {
+        { "chip_session_encrypted_messages_total", stats.mEncryptedMessages },
+        { "chip_session_encrypted_bytes_total", stats.mEncryptedBytes },
+        { "chip_session_encrypt_micros_total", stats.mEncryptMicros },
+        { "chip_session_decrypted_messages_total", stats.mDecryptedMessages },
+        { "chip_session_decrypted_bytes_total", stats.mDecryptedBytes },
+        { "chip_session_decrypt_micros_total", stats.mDecryptMicros },
+        { "chip_session_decrypt_failures_total", stats.mDecryptFailures },
+        { "chip_session_counter_window_drops_total", stats.mCounterWindowDrops },
+        { "chip_session_duplicate_messages_total", stats.mDuplicateMessages },
+    };
+
+    for (const auto & counter : counters)
+    {
+        used += System::Stats::WriteMetricType(buffer + used, bufferSize - used, counter.name, "counter");
+        used += System::Stats::WriteMetricLine(buffer + used, bufferSize - used, counter.name, nullptr, nullptr, counter.value);
+    }
+
+    return used;
+}
+
+} // namespace Transport
+} // namespace chip
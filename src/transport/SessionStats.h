@@ -0,0 +1,83 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Transport {
+
+/**
+ * Cumulative counters over the secure-message hot path.
+ *
+ * A global instance aggregates across all sessions and, when
+ * CHIP_CONFIG_SESSION_STATS is enabled, each SecureSession carries its own
+ * copy, so CPU spent on crypto under load can be attributed to a peer without
+ * an external profiler. All updates happen on the CHIP event loop thread, so
+ * the counters need neither atomics nor padding; an update costs a few
+ * additions on top of the crypto work being measured.
+ */
+struct SessionStatCounters
+{
+    uint64_t mEncryptedMessages = 0;
+    uint64_t mEncryptedBytes    = 0;
+    uint64_t mEncryptMicros     = 0; /**< Time spent encrypting payloads. */
+    uint64_t mDecryptedMessages = 0;
+    uint64_t mDecryptedBytes    = 0;
+    uint64_t mDecryptMicros     = 0; /**< Time spent decrypting payloads. */
+
+    uint64_t mDecryptFailures    = 0; /**< Messages dropped for MIC or framing failures. */
+    uint64_t mCounterWindowDrops = 0; /**< Messages dropped by replay-window verification. */
+    uint64_t mDuplicateMessages  = 0; /**< Retransmissions detected inside the counter window. */
+
+    void AddEncrypt(uint16_t payloadBytes, uint64_t micros)
+    {
+        mEncryptedMessages++;
+        mEncryptedBytes += payloadBytes;
+        mEncryptMicros += micros;
+    }
+
+    void AddDecrypt(uint16_t payloadBytes, uint64_t micros)
+    {
+        mDecryptedMessages++;
+        mDecryptedBytes += payloadBytes;
+        mDecryptMicros += micros;
+    }
+
+    void Reset() { *this = SessionStatCounters(); }
+};
+
+/**
+ * Counters aggregated across all secure sessions since boot (or the last
+ * reset via the `session-stats` shell command).
+ */
+SessionStatCounters & GlobalSessionStats();
+
+/**
+ * Writes the global session counters in the Prometheus text exposition format
+ * (see System::Stats::WriteMetrics()).  Registered as a metrics emitter by
+ * SessionManager::Init().
+ */
+size_t WriteSessionStatsMetrics(char * buffer, size_t bufferSize);
+
+} // namespace Transport
+} // namespace chip
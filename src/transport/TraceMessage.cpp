@@ -0,0 +1,96 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the runtime message trace ring buffer used by
+ *      the secure message codec for latency attribution.
+ *
+ */
+
+#include <transport/TraceMessage.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace trace {
+
+void MessageTraceBuffer::Record(const MessageTraceEntry & entry)
+{
+    mEntries[mTotalRecorded % kCapacity] = entry;
+    mTotalRecorded++;
+}
+
+void MessageTraceBuffer::Clear()
+{
+    mTotalRecorded = 0;
+}
+
+size_t MessageTraceBuffer::GetEntryCount() const
+{
+    return (mTotalRecorded < kCapacity) ? mTotalRecorded : kCapacity;
+}
+
+const MessageTraceEntry & MessageTraceBuffer::GetEntry(size_t index) const
+{
+    // When the buffer has wrapped, the oldest retained entry is the one the
+    // next Record() would overwrite.
+    size_t oldest = (mTotalRecorded < kCapacity) ? 0 : mTotalRecorded % kCapacity;
+    return mEntries[(oldest + index) % kCapacity];
+}
+
+void MessageTraceBuffer::SerializeEntry(const MessageTraceEntry & entry, uint8_t (&buffer)[kBinaryEntrySize])
+{
+    uint8_t * p = buffer;
+    Encoding::LittleEndian::Write64(p, entry.mTimestampMicros);
+    Encoding::LittleEndian::Write32(p, entry.mDurationMicros);
+    Encoding::LittleEndian::Write32(p, entry.mMessageCounter);
+    Encoding::LittleEndian::Write16(p, entry.mPayloadSize);
+    Encoding::LittleEndian::Write16(p, entry.mExchangeId);
+    Encoding::LittleEndian::Write16(p, entry.mProtocolId);
+    Encoding::LittleEndian::Write16(p, entry.mSessionId);
+    Encoding::Write8(p, entry.mMessageType);
+    Encoding::Write8(p, static_cast<uint8_t>(entry.mDirection));
+}
+
+MessageTraceBuffer & MessageTraceBuffer::Instance()
+{
+    static MessageTraceBuffer sInstance;
+    return sInstance;
+}
+
+void RecordMessageTrace(MessageDirection direction, const PayloadHeader & payloadHeader, const PacketHeader & packetHeader,
+                        uint16_t payloadSize, uint32_t durationMicros)
+{
+    MessageTraceEntry entry;
+    entry.mTimestampMicros = System::SystemClock().GetMonotonicMicroseconds64().count();
+    entry.mDurationMicros  = durationMicros;
+    entry.mMessageCounter  = packetHeader.GetMessageCounter();
+    entry.mPayloadSize     = payloadSize;
+    entry.mExchangeId      = payloadHeader.GetExchangeID();
+    entry.mProtocolId      = payloadHeader.GetProtocolID().GetProtocolId();
+    entry.mSessionId       = packetHeader.GetSessionId();
+    entry.mMessageType     = payloadHeader.GetMessageType();
+    entry.mDirection       = direction;
+
+    MessageTraceBuffer::Instance().Record(entry);
+}
+
+} // namespace trace
+} // namespace chip
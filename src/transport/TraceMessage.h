@@ -19,8 +19,12 @@
 #pragma once
 
 #include <core/CHIPBuildConfig.h>
+#include <lib/core/CHIPConfig.h>
 #include <transport/raw/MessageHeader.h>
 
+#include <stddef.h>
+#include <stdint.h>
+
 #if CHIP_CONFIG_TRANSPORT_TRACE_ENABLED
 #include "pw_trace/trace.h"
 
@@ -52,5 +56,81 @@ struct TraceSecureMessageData
     size_t packetSize;
 };
 
+enum class MessageDirection : uint8_t
+{
+    kOutbound = 0,
+    kInbound  = 1,
+};
+
+/**
+ * One recorded message, captured as it passes through the secure message codec.
+ */
+struct MessageTraceEntry
+{
+    uint64_t mTimestampMicros; /**< Monotonic time at which the message passed the codec. */
+    uint32_t mDurationMicros;  /**< Time spent encrypting or decrypting the message payload. */
+    uint32_t mMessageCounter;  /**< Message counter from the packet header. */
+    uint16_t mPayloadSize;     /**< Size of the (plaintext) message payload in bytes. */
+    uint16_t mExchangeId;      /**< Exchange the message belongs to. */
+    uint16_t mProtocolId;      /**< Protocol id from the payload header. */
+    uint16_t mSessionId;       /**< Session id from the packet header. */
+    uint8_t mMessageType;      /**< Protocol opcode from the payload header. */
+    MessageDirection mDirection;
+};
+
+/**
+ * Fixed-capacity ring buffer of recently transported messages.
+ *
+ * The secure message codec feeds the buffer when CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE is
+ * enabled; once full, new entries overwrite the oldest ones. Recording and reading both
+ * happen on the CHIP event loop thread, so no synchronization is needed and a record costs
+ * little more than one array store.
+ *
+ * Entries can be serialized into a fixed-size little-endian binary record for export (see
+ * scripts/tools/decode_message_trace.py for the decoder).
+ */
+class MessageTraceBuffer
+{
+public:
+    static constexpr size_t kCapacity             = CHIP_CONFIG_TRANSPORT_MESSAGE_TRACE_SIZE;
+    static constexpr size_t kBinaryEntrySize      = 26;
+    static constexpr uint8_t kBinaryFormatVersion = 1;
+
+    void Record(const MessageTraceEntry & entry);
+    void Clear();
+
+    /**
+     * Number of entries currently held; at most kCapacity.
+     */
+    size_t GetEntryCount() const;
+
+    /**
+     * Total number of entries recorded since the last Clear(), including overwritten ones.
+     */
+    uint32_t GetTotalRecorded() const { return mTotalRecorded; }
+
+    /**
+     * Return an entry by age: index 0 is the oldest entry still held.
+     */
+    const MessageTraceEntry & GetEntry(size_t index) const;
+
+    /**
+     * Serialize an entry into its little-endian binary record form.
+     */
+    static void SerializeEntry(const MessageTraceEntry & entry, uint8_t (&buffer)[kBinaryEntrySize]);
+
+    static MessageTraceBuffer & Instance();
+
+private:
+    MessageTraceEntry mEntries[kCapacity] = {};
+    uint32_t mTotalRecorded               = 0;
+};
+
+/**
+ * Capture a message into the global trace buffer; used by the codec trace hooks.
+ */
+void RecordMessageTrace(MessageDirection direction, const PayloadHeader & payloadHeader, const PacketHeader & packetHeader,
+                        uint16_t payloadSize, uint32_t durationMicros);
+
 } // namespace trace
 } // namespace chip
@@ -20,13 +20,78 @@
 #include <transport/TransportMgr.h>
 #include <transport/raw/Base.h>
 
+#if CHIP_CONFIG_TRANSPORT_RX_QUEUE
+#include <platform/CHIPDeviceLayer.h>
+#endif
+
 namespace chip {
 
 CHIP_ERROR TransportMgrBase::SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle && msgBuf)
 {
+#if CHIP_CONFIG_TRANSPORT_SEND_BATCH_SIZE > 0
+    if (mSendBatchDepth > 0)
+    {
+        if (mSendBatchCount == CHIP_CONFIG_TRANSPORT_SEND_BATCH_SIZE)
+        {
+            ReturnErrorOnFailure(FlushSendBatch());
+        }
+
+        mSendBatch[mSendBatchCount].mPeerAddress = address;
+        mSendBatch[mSendBatchCount].mMsgBuf      = std::move(msgBuf);
+        mSendBatchCount++;
+        return CHIP_NO_ERROR;
+    }
+#endif
     return mTransport->SendMessage(address, std::move(msgBuf));
 }
 
+CHIP_ERROR TransportMgrBase::SendMessageNow(const Transport::PeerAddress & address, System::PacketBufferHandle && msgBuf)
+{
+    return mTransport->SendMessage(address, std::move(msgBuf));
+}
+
+void TransportMgrBase::BeginSendBatch()
+{
+#if CHIP_CONFIG_TRANSPORT_SEND_BATCH_SIZE > 0
+    mSendBatchDepth++;
+#endif
+}
+
+CHIP_ERROR TransportMgrBase::EndSendBatch()
+{
+#if CHIP_CONFIG_TRANSPORT_SEND_BATCH_SIZE > 0
+    VerifyOrReturnError(mSendBatchDepth > 0, CHIP_ERROR_INCORRECT_STATE);
+
+    mSendBatchDepth--;
+    if (mSendBatchDepth == 0)
+    {
+        return FlushSendBatch();
+    }
+#endif
+    return CHIP_NO_ERROR;
+}
+
+#if CHIP_CONFIG_TRANSPORT_SEND_BATCH_SIZE > 0
+CHIP_ERROR TransportMgrBase::FlushSendBatch()
+{
+    VerifyOrReturnError(mSendBatchCount > 0, CHIP_NO_ERROR);
+
+    const size_t count = mSendBatchCount;
+    mSendBatchCount    = 0;
+
+    CHIP_ERROR err = mTransport->SendMessages(mSendBatch, count);
+
+    // The transport consumes the buffers; drop any handle a failed send left
+    // behind so the slots are empty for the next window.
+    for (size_t i = 0; i < count; i++)
+    {
+        mSendBatch[i].mMsgBuf = nullptr;
+    }
+
+    return err;
+}
+#endif // CHIP_CONFIG_TRANSPORT_SEND_BATCH_SIZE > 0
+
 void TransportMgrBase::Disconnect(const Transport::PeerAddress & address)
 {
     mTransport->Disconnect(address);
@@ -46,6 +111,15 @@ CHIP_ERROR TransportMgrBase::Init(Transport::Base * transport)
 
 void TransportMgrBase::Close()
 {
+#if CHIP_CONFIG_TRANSPORT_SEND_BATCH_SIZE > 0
+    // Messages still gathered in an open send batch window are dropped.
+    for (size_t i = 0; i < mSendBatchCount; i++)
+    {
+        mSendBatch[i].mMsgBuf = nullptr;
+    }
+    mSendBatchCount = 0;
+    mSendBatchDepth = 0;
+#endif
     mSessionManager = nullptr;
     mTransport      = nullptr;
 }
@@ -78,4 +152,41 @@ void TransportMgrBase::HandleMessageReceived(const Transport::PeerAddress & peer
     }
 }
 
+#if CHIP_CONFIG_TRANSPORT_RX_QUEUE
+void TransportMgrBase::HandleMessageReceivedFromThread(const Transport::PeerAddress & peerAddress,
+                                                       System::PacketBufferHandle && msg)
+{
+    QueuedMessage entry;
+    entry.mPeerAddress = peerAddress;
+    entry.mMsg         = std::move(msg).UnsafeRelease();
+
+    bool wasEmpty = false;
+    if (!mRxQueue.Enqueue(entry, wasEmpty))
+    {
+        // Reclaim the buffer; a full queue means the event loop is already
+        // saturated, so this behaves like a full socket receive buffer.
+        static_cast<void>(System::PacketBufferHandle::Adopt(entry.mMsg));
+        ChipLogError(Inet, "Transport RX queue full, message dropped");
+        return;
+    }
+
+    // Only the enqueue that makes the queue non-empty needs to wake the event
+    // loop; the drain below runs until the queue is empty again.
+    if (wasEmpty)
+    {
+        DeviceLayer::PlatformMgr().ScheduleWork(DrainReceiveQueue, reinterpret_cast<intptr_t>(this));
+    }
+}
+
+void TransportMgrBase::DrainReceiveQueue(intptr_t arg)
+{
+    TransportMgrBase * mgr = reinterpret_cast<TransportMgrBase *>(arg);
+    QueuedMessage entry;
+    while (mgr->mRxQueue.Dequeue(entry))
+    {
+        mgr->HandleMessageReceived(entry.mPeerAddress, System::PacketBufferHandle::Adopt(entry.mMsg));
+    }
+}
+#endif // CHIP_CONFIG_TRANSPORT_RX_QUEUE
+
 } // namespace chip
@@ -16,12 +16,17 @@
 
 #pragma once
 
+#include <lib/core/CHIPConfig.h>
 #include <lib/support/CodeUtils.h>
 #include <system/SystemPacketBuffer.h>
 #include <transport/raw/Base.h>
 #include <transport/raw/MessageHeader.h>
 #include <transport/raw/PeerAddress.h>
 
+#if CHIP_CONFIG_TRANSPORT_RX_QUEUE
+#include <lib/support/BoundedMPSCQueue.h>
+#endif
+
 namespace chip {
 
 namespace Transport {
@@ -37,6 +42,30 @@ public:
 
     CHIP_ERROR SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle && msgBuf);
 
+    /**
+     * Send a message immediately, bypassing any open send batch window. Meant
+     * for latency-critical single sends (e.g. acknowledgements) that should
+     * not wait for the rest of a fan-out burst.
+     */
+    CHIP_ERROR SendMessageNow(const Transport::PeerAddress & address, System::PacketBufferHandle && msgBuf);
+
+    /**
+     * Open a send batch window. While a window is open, messages passed to
+     * SendMessage are gathered and handed to the transport as one batch when
+     * the outermost window is closed with EndSendBatch, letting transports
+     * with a batched send path issue one system call for a whole fan-out
+     * burst. Windows nest; both calls are no-ops when
+     * CHIP_CONFIG_TRANSPORT_SEND_BATCH_SIZE is 0.
+     */
+    void BeginSendBatch();
+
+    /**
+     * Close the current send batch window, flushing any gathered messages
+     * when this closes the outermost window. Returns the first send error, if
+     * any; the remaining messages are still attempted.
+     */
+    CHIP_ERROR EndSendBatch();
+
     void Close();
 
     void Disconnect(const Transport::PeerAddress & address);
@@ -47,7 +76,38 @@ public:
 
     void HandleMessageReceived(const Transport::PeerAddress & peerAddress, System::PacketBufferHandle && msg) override;
 
+#if CHIP_CONFIG_TRANSPORT_RX_QUEUE
+    /**
+     * Hand a received message to the CHIP event loop from a dedicated
+     * transport RX thread. Safe to call from any thread: the message goes
+     * through a lock-free queue and is decrypted and dispatched on the event
+     * loop, the only thread allowed to touch session state and CryptoContext.
+     * Messages arriving while the queue is full are dropped.
+     */
+    void HandleMessageReceivedFromThread(const Transport::PeerAddress & peerAddress, System::PacketBufferHandle && msg);
+#endif
+
 private:
+#if CHIP_CONFIG_TRANSPORT_RX_QUEUE
+    struct QueuedMessage
+    {
+        Transport::PeerAddress mPeerAddress;
+        System::PacketBuffer * mMsg; // ownership passes through the queue
+    };
+
+    static void DrainReceiveQueue(intptr_t arg);
+
+    BoundedMPSCQueue<QueuedMessage, CHIP_CONFIG_TRANSPORT_RX_QUEUE_SIZE> mRxQueue;
+#endif
+
+#if CHIP_CONFIG_TRANSPORT_SEND_BATCH_SIZE > 0
+    CHIP_ERROR FlushSendBatch();
+
+    Transport::BatchedMessage mSendBatch[CHIP_CONFIG_TRANSPORT_SEND_BATCH_SIZE];
+    size_t mSendBatchCount       = 0;
+    unsigned int mSendBatchDepth = 0;
+#endif
+
     TransportMgrDelegate * mSessionManager = nullptr;
     Transport::Base * mTransport           = nullptr;
 };
@@ -66,12 +66,15 @@ public:
 
     const ReliableMessageProtocolConfig & GetMRPConfig() const { return mMRPConfig; }
 
+    PeerRttEstimator & GetRttEstimator() { return mRttEstimator; }
+
     PeerMessageCounter & GetPeerMessageCounter() { return mPeerMessageCounter; }
 
 private:
     const PeerAddress mPeerAddress;
     System::Clock::Timestamp mLastActivityTime;
     ReliableMessageProtocolConfig mMRPConfig;
+    PeerRttEstimator mRttEstimator;
     PeerMessageCounter mPeerMessageCounter;
 };
 
@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <utility>
+
 #include <inet/IPAddress.h>
 #include <inet/UDPEndPoint.h>
 #include <lib/core/CHIPError.h>
@@ -40,6 +42,16 @@ public:
     virtual void HandleMessageReceived(const Transport::PeerAddress & peerAddress, System::PacketBufferHandle && msg) = 0;
 };
 
+/**
+ * A single (destination, payload) entry within a batch handed to
+ * Base::SendMessages.
+ */
+struct BatchedMessage
+{
+    PeerAddress mPeerAddress;
+    System::PacketBufferHandle mMsgBuf;
+};
+
 /**
  * Transport class base, defining common methods among transports (message
  * packing by encoding and decoding headers) and generic message transport
@@ -65,6 +77,29 @@ public:
      */
     virtual CHIP_ERROR SendMessage(const PeerAddress & address, System::PacketBufferHandle && msgBuf) = 0;
 
+    /**
+     * @brief Send several messages gathered during one send batch window.
+     *
+     * Every message buffer is consumed, whether its send succeeds or not, and
+     * the first failure is returned after the remaining messages have been
+     * attempted. The default implementation sends the messages one at a time
+     * and is correct for any transport; transports that can hand multiple
+     * datagrams to the network stack in a single operation override it.
+     */
+    virtual CHIP_ERROR SendMessages(BatchedMessage * messages, size_t messageCount)
+    {
+        CHIP_ERROR err = CHIP_NO_ERROR;
+        for (size_t i = 0; i < messageCount; i++)
+        {
+            CHIP_ERROR sendErr = SendMessage(messages[i].mPeerAddress, std::move(messages[i].mMsgBuf));
+            if (err == CHIP_NO_ERROR)
+            {
+                err = sendErr;
+            }
+        }
+        return err;
+    }
+
     /**
      * Determine if this transport can SendMessage to the specified peer address.
      *
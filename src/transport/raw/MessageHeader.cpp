@@ -89,6 +89,17 @@ constexpr int kVersionShift = 4;
 
 } // namespace
 
+static_assert(PacketHeader::kMaxEncodeSizeBytes == kFixedUnencryptedHeaderSizeBytes + 2 * kNodeIdSizeBytes,
+              "PacketHeader::kMaxEncodeSizeBytes is out of sync with the field sizes");
+static_assert(PayloadHeader::kMaxEncodeSizeBytes == kEncryptedHeaderSizeBytes + kVendorIdSizeBytes + kAckMessageCounterSizeBytes,
+              "PayloadHeader::kMaxEncodeSizeBytes is out of sync with the field sizes");
+
+// Buffers allocated with the default header reserve must be able to take both
+// headers in place: EncodeBeforeData() on such a buffer never moves the payload.
+static_assert(System::PacketBuffer::kDefaultHeaderReserve >=
+                  PacketHeader::kMaxEncodeSizeBytes + PayloadHeader::kMaxEncodeSizeBytes,
+              "Default PacketBuffer header reserve cannot hold the largest message headers");
+
 uint16_t PacketHeader::EncodeSizeBytes() const
 {
     size_t size = kFixedUnencryptedHeaderSizeBytes;
@@ -311,6 +311,14 @@ public:
         return *this;
     }
 
+    /**
+     * The encoded size of a packet header with every optional field present:
+     * the fixed fields plus source and destination node ids.  A buffer with
+     * this much headroom can have any packet header prepended without moving
+     * its payload.
+     */
+    static constexpr uint16_t kMaxEncodeSizeBytes = 8 + 8 + 8;
+
     /**
      * A call to `Encode` will require at least this many bytes on the current
      * object to be successful.
@@ -539,6 +547,12 @@ public:
      */
     bool NeedsAck() const { return mExchangeFlags.Has(Header::ExFlagValues::kExchangeFlag_NeedsAck); }
 
+    /**
+     * The encoded size of a payload header with every optional field present:
+     * the fixed fields plus the vendor id and the acknowledged message counter.
+     */
+    static constexpr uint16_t kMaxEncodeSizeBytes = 6 + 2 + 4;
+
     /**
      * A call to `Encode` will require at least this many bytes on the current
      * object to be successful.
@@ -190,7 +190,24 @@ CHIP_ERROR TCPBase::SendMessage(const Transport::PeerAddress & address, System::
 
     if (connection != nullptr)
     {
-        return connection->mEndPoint->Send(std::move(msgBuf));
+        const uint32_t pendingSendLength = connection->mEndPoint->PendingSendLength();
+
+        // Backpressure: refuse to queue past the per-connection watermark so a
+        // stalled peer cannot exhaust the shared packet buffer pool. The error
+        // propagates to the SessionManager, whose callers may retry later.
+        if (pendingSendLength + msgBuf->DataLength() > CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK_BYTES)
+        {
+            ChipLogProgress(Inet, "TCP send queue watermark reached (%" PRIu32 " bytes pending); blocking send",
+                            pendingSendLength);
+            return CHIP_ERROR_SENDING_BLOCKED;
+        }
+
+        // Nagle-style coalescing: when unsent bytes are already queued, append
+        // small messages without an immediate push so that they go out in the
+        // same segment once the socket drains (sending is already scheduled for
+        // the queued data).
+        const bool push = (pendingSendLength == 0) || (msgBuf->DataLength() > CHIP_CONFIG_TCP_COALESCE_THRESHOLD_BYTES);
+        return connection->mEndPoint->Send(std::move(msgBuf), push);
     }
     else
     {
@@ -206,12 +223,28 @@ CHIP_ERROR TCPBase::SendAfterConnect(const PeerAddress & addr, System::PacketBuf
     // Iterate through the ENTIRE array. If a pending packet for
     // the address already exists, this means a connection is pending and
     // does NOT need to be re-established.
+    CHIP_ERROR pendingError = CHIP_NO_ERROR;
     mPendingPackets.ForEachActiveObject([&](PendingPacket * pending) {
         if (pending->mPeerAddress == addr)
         {
             // same destination exists.
             alreadyConnecting = true;
-            pending->mPacketBuffer->AddToEnd(std::move(msg));
+
+            if (pending->mPacketBuffer.IsNull())
+            {
+                // Data-less marker left by Connect(); attach the first data to it.
+                pending->mPacketBuffer = std::move(msg);
+            }
+            // The same watermark that bounds established connections also bounds
+            // data buffered while the connection attempt is in flight.
+            else if (pending->mPacketBuffer->TotalLength() + msg->DataLength() > CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK_BYTES)
+            {
+                pendingError = CHIP_ERROR_SENDING_BLOCKED;
+            }
+            else
+            {
+                pending->mPacketBuffer->AddToEnd(std::move(msg));
+            }
             return Loop::Break;
         }
         return Loop::Continue;
@@ -220,20 +253,31 @@ CHIP_ERROR TCPBase::SendAfterConnect(const PeerAddress & addr, System::PacketBuf
     // If already connecting, buffer was just enqueued for more sending
     if (alreadyConnecting)
     {
-        return CHIP_NO_ERROR;
+        return pendingError;
     }
 
     // Ensures sufficient active connections size exist
     VerifyOrReturnError(mUsedEndPointCount < mActiveConnectionsSize, CHIP_ERROR_NO_MEMORY);
 
     Inet::TCPEndPoint * endPoint = nullptr;
+    ReturnErrorOnFailure(StartConnect(addr, &endPoint));
+
+    // enqueue the packet once the connection succeeds
+    if (mPendingPackets.CreateObject(addr, std::move(msg)) == nullptr)
+    {
+        endPoint->Free();
+        return CHIP_ERROR_NO_MEMORY;
+    }
+    mUsedEndPointCount++;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TCPBase::StartConnect(const PeerAddress & addr, Inet::TCPEndPoint ** outEndPoint)
+{
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
+    Inet::TCPEndPoint * endPoint = nullptr;
     ReturnErrorOnFailure(mListenSocket->GetEndPointManager().NewEndPoint(&endPoint));
-    auto EndPointDeletor = [](Inet::TCPEndPoint * e) { e->Free(); };
-    std::unique_ptr<Inet::TCPEndPoint, decltype(EndPointDeletor)> endPointHolder(endPoint, EndPointDeletor);
-#else
-    return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif
 
     endPoint->mAppState            = reinterpret_cast<void *>(this);
     endPoint->OnDataReceived       = OnTcpReceive;
@@ -243,15 +287,59 @@ CHIP_ERROR TCPBase::SendAfterConnect(const PeerAddress & addr, System::PacketBuf
     endPoint->OnAcceptError        = OnAcceptError;
     endPoint->OnPeerClose          = OnPeerClosed;
 
-    ReturnErrorOnFailure(endPoint->Connect(addr.GetIPAddress(), addr.GetPort(), addr.GetInterface()));
-
-    // enqueue the packet once the connection succeeds
-    VerifyOrReturnError(mPendingPackets.CreateObject(addr, std::move(msg)) != nullptr, CHIP_ERROR_NO_MEMORY);
-    mUsedEndPointCount++;
+    CHIP_ERROR err = endPoint->Connect(addr.GetIPAddress(), addr.GetPort(), addr.GetInterface());
+    if (err != CHIP_NO_ERROR)
+    {
+        endPoint->Free();
+        return err;
+    }
 
-#if INET_CONFIG_ENABLE_TCP_ENDPOINT
-    endPointHolder.release();
+    *outEndPoint = endPoint;
+    return CHIP_NO_ERROR;
+#else
+    return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
 #endif
+}
+
+CHIP_ERROR TCPBase::Connect(const PeerAddress & address)
+{
+    VerifyOrReturnError(address.GetTransportType() == Type::kTcp, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mState == State::kInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+    if (FindActiveConnection(address) != nullptr)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    // An in-flight connection attempt is tracked by its pending entry.
+    bool alreadyConnecting = false;
+    mPendingPackets.ForEachActiveObject([&](PendingPacket * pending) {
+        if (pending->mPeerAddress == address)
+        {
+            alreadyConnecting = true;
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+    if (alreadyConnecting)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    VerifyOrReturnError(mUsedEndPointCount < mActiveConnectionsSize, CHIP_ERROR_NO_MEMORY);
+
+    Inet::TCPEndPoint * endPoint = nullptr;
+    ReturnErrorOnFailure(StartConnect(address, &endPoint));
+
+    // A data-less pending entry marks the attempt, so concurrent Connect() and
+    // SendMessage() calls attach to it instead of racing a second connection;
+    // OnConnectionComplete() consumes the marker.
+    if (mPendingPackets.CreateObject(address, System::PacketBufferHandle()) == nullptr)
+    {
+        endPoint->Free();
+        return CHIP_ERROR_NO_MEMORY;
+    }
+    mUsedEndPointCount++;
 
     return CHIP_NO_ERROR;
 }
@@ -372,7 +460,9 @@ void TCPBase::OnConnectionComplete(Inet::TCPEndPoint * endPoint, CHIP_ERROR inet
             System::PacketBufferHandle buffer = std::move(pending->mPacketBuffer);
             tcp->mPendingPackets.ReleaseObject(pending);
 
-            if ((inetErr == CHIP_NO_ERROR) && (err == CHIP_NO_ERROR))
+            // Data-less entries are markers left by Connect(); there is nothing
+            // to send for them.
+            if (!buffer.IsNull() && (inetErr == CHIP_NO_ERROR) && (err == CHIP_NO_ERROR))
             {
                 err = endPoint->Send(std::move(buffer));
             }
@@ -402,6 +492,18 @@ void TCPBase::OnConnectionComplete(Inet::TCPEndPoint * endPoint, CHIP_ERROR inet
     }
     else
     {
+#if CHIP_CONFIG_TCP_KEEPALIVE_INTERVAL_SECS > 0
+        // Probe idle connections so a vanished peer is detected within a few
+        // keep-alive intervals instead of stalling the next send.  Failure to
+        // arm keep-alive is not fatal to the connection.
+        CHIP_ERROR keepAliveErr =
+            endPoint->EnableKeepAlive(CHIP_CONFIG_TCP_KEEPALIVE_INTERVAL_SECS, CHIP_CONFIG_TCP_KEEPALIVE_TIMEOUT_COUNT);
+        if (keepAliveErr != CHIP_NO_ERROR)
+        {
+            ChipLogProgress(Inet, "Failed to enable TCP keep-alive: %s", ErrorStr(keepAliveErr));
+        }
+#endif
+
         bool connectionStored = false;
         for (size_t i = 0; i < tcp->mActiveConnectionsSize; i++)
         {
@@ -464,6 +566,17 @@ void TCPBase::OnConnectionReceived(Inet::TCPEndPoint * listenEndPoint, Inet::TCP
         endPoint->OnConnectionReceived = OnConnectionReceived;
         endPoint->OnAcceptError        = OnAcceptError;
         endPoint->OnPeerClose          = OnPeerClosed;
+
+#if CHIP_CONFIG_TCP_KEEPALIVE_INTERVAL_SECS > 0
+        // Accepted connections get the same fast failure detection as the ones
+        // we initiate.
+        CHIP_ERROR keepAliveErr =
+            endPoint->EnableKeepAlive(CHIP_CONFIG_TCP_KEEPALIVE_INTERVAL_SECS, CHIP_CONFIG_TCP_KEEPALIVE_TIMEOUT_COUNT);
+        if (keepAliveErr != CHIP_NO_ERROR)
+        {
+            ChipLogProgress(Inet, "Failed to enable TCP keep-alive: %s", ErrorStr(keepAliveErr));
+        }
+#endif
     }
     else
     {
@@ -82,6 +82,9 @@ private:
 
 /**
  * Packets scheduled for sending once a connection has been established.
+ *
+ * An entry with a null packet buffer marks a connection attempt started by
+ * TCPBase::Connect() that has no data queued for it yet.
  */
 struct PendingPacket
 {
@@ -160,6 +163,18 @@ public:
 
     CHIP_ERROR SendMessage(const PeerAddress & address, System::PacketBufferHandle && msgBuf) override;
 
+    /**
+     * Pre-establish a connection to the given peer, so that later SendMessage()
+     * calls do not pay connect latency on their first message.
+     *
+     * The connection is set up with the same callbacks and keep-alive
+     * configuration as connections established on demand, and counts against
+     * the same connection table.  Completion is asynchronous; data sent before
+     * the connection completes is queued behind the attempt.  A no-op if a
+     * connection (or connection attempt) to the peer already exists.
+     */
+    CHIP_ERROR Connect(const PeerAddress & address);
+
     void Disconnect(const PeerAddress & address) override;
 
     bool CanSendToPeer(const PeerAddress & address) override
@@ -201,6 +216,14 @@ private:
      */
     CHIP_ERROR SendAfterConnect(const PeerAddress & addr, System::PacketBufferHandle && msg);
 
+    /**
+     * Allocate an endpoint, attach the transport's callbacks and start a
+     * connection to the given peer.  On success the endpoint, still
+     * connecting, is returned through outEndPoint; completion is reported to
+     * OnConnectionComplete().
+     */
+    CHIP_ERROR StartConnect(const PeerAddress & addr, Inet::TCPEndPoint ** outEndPoint);
+
     /**
      * Process a single received buffer from the specified peer address.
      *
@@ -86,6 +86,11 @@ public:
         return SendMessageImpl<0>(address, std::move(msgBuf));
     }
 
+    CHIP_ERROR SendMessages(BatchedMessage * messages, size_t messageCount) override
+    {
+        return SendMessagesImpl<0>(messages, messageCount);
+    }
+
     CHIP_ERROR MulticastGroupJoinLeave(const Transport::PeerAddress & address, bool join) override
     {
         return MulticastGroupJoinLeaveImpl<0>(address, join);
@@ -208,6 +213,61 @@ private:
         return CHIP_ERROR_NO_MESSAGE_HANDLER;
     }
 
+    /**
+     * Recursive batched-send implementation iterating through transport members.
+     *
+     * Contiguous runs of messages accepted by the transport at index N are handed
+     * to it as one batch, so a fan-out burst over a single transport keeps its
+     * batching benefit; runs it cannot send are forwarded to index N + 1.
+     *
+     * @tparam N the index of the underlying transport to offer the messages to.
+     *
+     * @param messages the batch entries to send.
+     * @param messageCount the number of entries in the batch.
+     */
+    template <size_t N, typename std::enable_if<(N < sizeof...(TransportTypes))>::type * = nullptr>
+    CHIP_ERROR SendMessagesImpl(BatchedMessage * messages, size_t messageCount)
+    {
+        Base * base    = &std::get<N>(mTransports);
+        CHIP_ERROR err = CHIP_NO_ERROR;
+
+        size_t runStart = 0;
+        while (runStart < messageCount)
+        {
+            const bool accepted = base->CanSendToPeer(messages[runStart].mPeerAddress);
+
+            size_t runEnd = runStart + 1;
+            while (runEnd < messageCount && base->CanSendToPeer(messages[runEnd].mPeerAddress) == accepted)
+            {
+                runEnd++;
+            }
+
+            CHIP_ERROR sendErr = accepted ? base->SendMessages(messages + runStart, runEnd - runStart)
+                                          : SendMessagesImpl<N + 1>(messages + runStart, runEnd - runStart);
+            if (err == CHIP_NO_ERROR)
+            {
+                err = sendErr;
+            }
+
+            runStart = runEnd;
+        }
+
+        return err;
+    }
+
+    /**
+     * SendMessagesImpl when N is out of range. Always returns an error code.
+     */
+    template <size_t N, typename std::enable_if<(N >= sizeof...(TransportTypes))>::type * = nullptr>
+    CHIP_ERROR SendMessagesImpl(BatchedMessage * messages, size_t messageCount)
+    {
+        for (size_t i = 0; i < messageCount; i++)
+        {
+            messages[i].mMsgBuf = nullptr;
+        }
+        return CHIP_ERROR_NO_MESSAGE_HANDLER;
+    }
+
     /**
      * Recursive GroupJoinLeave implementation iterating through transport members.
      *
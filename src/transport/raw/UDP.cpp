@@ -57,6 +57,11 @@ CHIP_ERROR UDP::Init(UdpListenParameters & params)
     err = mUDPEndPoint->Listen(OnUdpReceive, nullptr /*onReceiveError*/, this);
     SuccessOrExit(err);
 
+    // Matter traffic is time-critical relative to other sockets on the event loop (e.g. mDNS),
+    // so dispatch it on the high-priority lane.
+    err = mUDPEndPoint->SetSocketWatchPriority(System::SocketWatchPriority::kHigh);
+    SuccessOrExit(err);
+
     mUDPEndpointType = params.GetAddressType();
 
     mState = State::kInitialized;
@@ -111,6 +116,57 @@ CHIP_ERROR UDP::SendMessage(const Transport::PeerAddress & address, System::Pack
     return mUDPEndPoint->SendMsg(&addrInfo, std::move(msgBuf));
 }
 
+CHIP_ERROR UDP::SendMessages(BatchedMessage * messages, size_t messageCount)
+{
+    VerifyOrReturnError(mState == State::kInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mUDPEndPoint != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    size_t consumed = 0;
+    while (consumed < messageCount)
+    {
+        // The endpoint takes parallel arrays; translate the batch in chunks to
+        // keep the stack usage bounded.
+        constexpr size_t kMaxChunkSize = 16;
+        Inet::IPPacketInfo pktInfos[kMaxChunkSize];
+        System::PacketBufferHandle buffers[kMaxChunkSize];
+
+        size_t chunkSize = 0;
+        while (consumed < messageCount && chunkSize < kMaxChunkSize)
+        {
+            BatchedMessage & message = messages[consumed++];
+            if (message.mPeerAddress.GetTransportType() != Type::kUdp)
+            {
+                message.mMsgBuf = nullptr;
+                if (err == CHIP_NO_ERROR)
+                {
+                    err = CHIP_ERROR_INVALID_ARGUMENT;
+                }
+                continue;
+            }
+
+            pktInfos[chunkSize].Clear();
+            pktInfos[chunkSize].DestAddress = message.mPeerAddress.GetIPAddress();
+            pktInfos[chunkSize].DestPort    = message.mPeerAddress.GetPort();
+            pktInfos[chunkSize].Interface   = message.mPeerAddress.GetInterface();
+            buffers[chunkSize]              = std::move(message.mMsgBuf);
+            chunkSize++;
+        }
+
+        if (chunkSize != 0)
+        {
+            CHIP_ERROR sendErr = mUDPEndPoint->SendMsgs(pktInfos, buffers, chunkSize);
+            if (err == CHIP_NO_ERROR)
+            {
+                err = sendErr;
+            }
+        }
+    }
+
+    return err;
+}
+
 void UDP::OnUdpReceive(Inet::UDPEndPoint * endPoint, System::PacketBufferHandle && buffer, const Inet::IPPacketInfo * pktInfo)
 {
     CHIP_ERROR err          = CHIP_NO_ERROR;
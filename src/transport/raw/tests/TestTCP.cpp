@@ -210,6 +210,48 @@ void CheckMessageTest6(nlTestSuite * inSuite, void * inContext)
     CheckMessageTest(inSuite, inContext, addr);
 }
 
+/////////////////////////// Pre-connect test
+
+void CheckPreConnectTest(nlTestSuite * inSuite, void * inContext, const IPAddress & addr)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    TCPImpl tcp;
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(inSuite, ctx);
+    gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr);
+
+    // Establish the connection ahead of any message traffic.
+    CHIP_ERROR err = tcp.Connect(Transport::PeerAddress::TCP(addr));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    ctx.DriveIOUntil(chip::System::Clock::Seconds16(5), [&tcp]() { return tcp.HasActiveConnections(); });
+    NL_TEST_ASSERT(inSuite, tcp.HasActiveConnections());
+
+    // Connecting to a peer we are already connected to is a no-op.
+    err = tcp.Connect(Transport::PeerAddress::TCP(addr));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // Messages ride the pre-established connection.
+    gMockTransportMgrDelegate.SingleMessageTest(tcp, addr);
+    gMockTransportMgrDelegate.FinalizeMessageTest(tcp, addr);
+}
+
+#if INET_CONFIG_ENABLE_IPV4
+void CheckPreConnectTest4(nlTestSuite * inSuite, void * inContext)
+{
+    IPAddress addr;
+    IPAddress::FromString("127.0.0.1", addr);
+    CheckPreConnectTest(inSuite, inContext, addr);
+}
+#endif // INET_CONFIG_ENABLE_IPV4
+
+void CheckPreConnectTest6(nlTestSuite * inSuite, void * inContext)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CheckPreConnectTest(inSuite, inContext, addr);
+}
+
 // Generates a packet buffer or a chain of packet buffers for a single message.
 struct TestData
 {
@@ -441,10 +483,12 @@ static const nlTest sTests[] =
 #if INET_CONFIG_ENABLE_IPV4
     NL_TEST_DEF("Simple Init Test IPV4",        CheckSimpleInitTest4),
     NL_TEST_DEF("Message Self Test IPV4",       CheckMessageTest4),
+    NL_TEST_DEF("Pre-connect Test IPV4",        CheckPreConnectTest4),
 #endif
 
     NL_TEST_DEF("Simple Init Test IPV6",        CheckSimpleInitTest6),
     NL_TEST_DEF("Message Self Test IPV6",       CheckMessageTest6),
+    NL_TEST_DEF("Pre-connect Test IPV6",        CheckPreConnectTest6),
     NL_TEST_DEF("ProcessReceivedBuffer Test",   chip::Transport::TCPTest::CheckProcessReceivedBuffer),
 
     NL_TEST_SENTINEL()
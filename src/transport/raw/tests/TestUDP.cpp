@@ -147,6 +147,79 @@ void CheckMessageTest(nlTestSuite * inSuite, void * inContext, const IPAddress &
     NL_TEST_ASSERT(inSuite, ReceiveHandlerCallCount == 1);
 }
 
+void CheckBatchedMessageTest(nlTestSuite * inSuite, void * inContext, const IPAddress & addr)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    constexpr int kBatchSize = 5;
+    uint16_t payload_len     = sizeof(PAYLOAD);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    Transport::UDP udp;
+
+    err = udp.Init(Transport::UdpListenParameters(ctx.GetUDPEndPointManager()).SetAddressType(addr.Type()).SetListenPort(0));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(inSuite);
+    TransportMgrBase gTransportMgrBase;
+    gTransportMgrBase.SetSessionManager(&gMockTransportMgrDelegate);
+    gTransportMgrBase.Init(&udp);
+
+    ReceiveHandlerCallCount = 0;
+
+    PacketHeader header;
+    header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageCounter(kMessageCounter);
+
+    Transport::BatchedMessage messages[kBatchSize];
+    for (int i = 0; i < kBatchSize; i++)
+    {
+        chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, payload_len);
+        NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+
+        err = header.EncodeBeforeData(buffer);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        messages[i].mPeerAddress = Transport::PeerAddress::UDP(addr, udp.GetBoundPort());
+        messages[i].mMsgBuf      = std::move(buffer);
+    }
+
+    // The whole batch should be sent and every buffer consumed.
+    err = udp.SendMessages(messages, kBatchSize);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    for (int i = 0; i < kBatchSize; i++)
+    {
+        NL_TEST_ASSERT(inSuite, messages[i].mMsgBuf.IsNull());
+    }
+
+    ctx.DriveIOUntil(chip::System::Clock::Seconds16(1), []() { return ReceiveHandlerCallCount == kBatchSize; });
+
+    NL_TEST_ASSERT(inSuite, ReceiveHandlerCallCount == kBatchSize);
+
+    // Sends inside a batch window are delivered no later than EndSendBatch,
+    // whether or not batching is configured in.
+    ReceiveHandlerCallCount = 0;
+
+    gTransportMgrBase.BeginSendBatch();
+    for (int i = 0; i < kBatchSize; i++)
+    {
+        chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, payload_len);
+        NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+
+        err = header.EncodeBeforeData(buffer);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        err = gTransportMgrBase.SendMessage(Transport::PeerAddress::UDP(addr, udp.GetBoundPort()), std::move(buffer));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+    err = gTransportMgrBase.EndSendBatch();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    ctx.DriveIOUntil(chip::System::Clock::Seconds16(1), []() { return ReceiveHandlerCallCount == kBatchSize; });
+
+    NL_TEST_ASSERT(inSuite, ReceiveHandlerCallCount == kBatchSize);
+}
+
 void CheckMessageTest4(nlTestSuite * inSuite, void * inContext)
 {
     IPAddress addr;
@@ -161,6 +234,22 @@ void CheckMessageTest6(nlTestSuite * inSuite, void * inContext)
     CheckMessageTest(inSuite, inContext, addr);
 }
 
+#if INET_CONFIG_ENABLE_IPV4
+void CheckBatchedMessageTest4(nlTestSuite * inSuite, void * inContext)
+{
+    IPAddress addr;
+    IPAddress::FromString("127.0.0.1", addr);
+    CheckBatchedMessageTest(inSuite, inContext, addr);
+}
+#endif
+
+void CheckBatchedMessageTest6(nlTestSuite * inSuite, void * inContext)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CheckBatchedMessageTest(inSuite, inContext, addr);
+}
+
 // Test Suite
 
 /**
@@ -172,10 +261,12 @@ static const nlTest sTests[] =
 #if INET_CONFIG_ENABLE_IPV4
     NL_TEST_DEF("Simple Init Test IPV4",   CheckSimpleInitTest4),
     NL_TEST_DEF("Message Self Test IPV4",  CheckMessageTest4),
+    NL_TEST_DEF("Batched Message Self Test IPV4",  CheckBatchedMessageTest4),
 #endif
 
     NL_TEST_DEF("Simple Init Test IPV6",   CheckSimpleInitTest6),
     NL_TEST_DEF("Message Self Test IPV6",  CheckMessageTest6),
+    NL_TEST_DEF("Batched Message Self Test IPV6",  CheckBatchedMessageTest6),
 
     NL_TEST_SENTINEL()
 };
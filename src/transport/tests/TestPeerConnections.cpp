@@ -142,6 +142,56 @@ void TestFindByKeyId(nlTestSuite * inSuite, void * inContext)
     System::Clock::Internal::SetSystemClockForTesting(realClock);
 }
 
+void TestFindLeastRecentlyUsedSession(nlTestSuite * inSuite, void * inContext)
+{
+    SecureSession * statePtr;
+    SecureSessionTable<2> connections;
+    MockClock clock;
+    System::Clock::ClockBase * realClock = &System::SystemClock();
+    System::Clock::Internal::SetSystemClockForTesting(&clock);
+
+    // An empty table has no eviction candidate.
+    NL_TEST_ASSERT(inSuite, connections.FindLeastRecentlyUsedSession() == nullptr);
+
+    // Node ID 1, peer key 1, local key 2
+    clock.SetMonotonicTimestamp(100_ms64);
+    statePtr = connections.CreateNewSecureSession(kPeer1SessionType, 2, kPeer1NodeId, kPeer1CATs, 1, 0 /* fabricIndex */,
+                                                  gDefaultMRPConfig);
+    NL_TEST_ASSERT(inSuite, statePtr != nullptr);
+
+    // Node ID 2, peer key 3, local key 4
+    clock.SetMonotonicTimestamp(200_ms64);
+    statePtr = connections.CreateNewSecureSession(kPeer2SessionType, 4, kPeer2NodeId, kPeer2CATs, 3, 0 /* fabricIndex */,
+                                                  gDefaultMRPConfig);
+    NL_TEST_ASSERT(inSuite, statePtr != nullptr);
+
+    // Peer 1 has been idle the longest.
+    statePtr = connections.FindLeastRecentlyUsedSession();
+    NL_TEST_ASSERT(inSuite, statePtr != nullptr && statePtr->GetPeerNodeId() == kPeer1NodeId);
+
+    // Activity on peer 1 moves the candidate to peer 2.
+    clock.SetMonotonicTimestamp(300_ms64);
+    statePtr->MarkActive();
+    statePtr = connections.FindLeastRecentlyUsedSession();
+    NL_TEST_ASSERT(inSuite, statePtr != nullptr && statePtr->GetPeerNodeId() == kPeer2NodeId);
+
+    // Pinning peer 2 moves the candidate back to peer 1 despite being more recently active.
+    statePtr->SetPinned(true);
+    statePtr = connections.FindLeastRecentlyUsedSession();
+    NL_TEST_ASSERT(inSuite, statePtr != nullptr && statePtr->GetPeerNodeId() == kPeer1NodeId);
+
+    // With every session pinned there is no candidate.
+    statePtr->SetPinned(true);
+    NL_TEST_ASSERT(inSuite, connections.FindLeastRecentlyUsedSession() == nullptr);
+
+    // Unpinning makes the session evictable again.
+    statePtr->SetPinned(false);
+    statePtr = connections.FindLeastRecentlyUsedSession();
+    NL_TEST_ASSERT(inSuite, statePtr != nullptr && statePtr->GetPeerNodeId() == kPeer1NodeId);
+
+    System::Clock::Internal::SetSystemClockForTesting(realClock);
+}
+
 struct ExpiredCallInfo
 {
     int callCount                   = 0;
@@ -256,6 +306,7 @@ static const nlTest sTests[] =
 {
     NL_TEST_DEF("BasicFunctionality", TestBasicFunctionality),
     NL_TEST_DEF("FindByKeyId", TestFindByKeyId),
+    NL_TEST_DEF("FindLeastRecentlyUsedSession", TestFindLeastRecentlyUsedSession),
     NL_TEST_DEF("ExpireConnections", TestExpireConnections),
     NL_TEST_SENTINEL()
 };
@@ -0,0 +1,157 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the PeerMessageCounter replay window.
+ */
+
+#include <nlunit-test.h>
+
+#include <lib/core/CHIPCore.h>
+#include <transport/PeerMessageCounter.h>
+
+#include <lib/support/UnitTestRegistration.h>
+
+using namespace chip;
+
+namespace {
+
+void AcceptAndCommit(nlTestSuite * inSuite, Transport::PeerMessageCounter & counter, uint32_t value)
+{
+    NL_TEST_ASSERT(inSuite, counter.Verify(value) == CHIP_NO_ERROR);
+    counter.Commit(value);
+}
+
+void TestDuplicateDetection(nlTestSuite * inSuite, void * inContext)
+{
+    Transport::PeerMessageCounter counter;
+    counter.SetCounter(1000);
+
+    AcceptAndCommit(inSuite, counter, 1001);
+    AcceptAndCommit(inSuite, counter, 1002);
+
+    NL_TEST_ASSERT(inSuite, counter.Verify(1001) == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+    NL_TEST_ASSERT(inSuite, counter.Verify(1002) == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+    NL_TEST_ASSERT(inSuite, counter.Verify(1003) == CHIP_NO_ERROR);
+}
+
+void TestReorderedMessagesWithinWindow(nlTestSuite * inSuite, void * inContext)
+{
+    Transport::PeerMessageCounter counter;
+    counter.SetCounter(1000);
+
+    // A burst arrives with the newest message first; everything within the
+    // window must still be accepted exactly once.
+    AcceptAndCommit(inSuite, counter, 1000 + CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE);
+
+    for (uint32_t value = 1000 + CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE - 1; value > 1000; value--)
+    {
+        AcceptAndCommit(inSuite, counter, value);
+        NL_TEST_ASSERT(inSuite, counter.Verify(value) == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+    }
+}
+
+void TestOutOfWindowRejected(nlTestSuite * inSuite, void * inContext)
+{
+    Transport::PeerMessageCounter counter;
+    counter.SetCounter(10000);
+
+    // Exactly window-size behind the max counter is out of range.
+    NL_TEST_ASSERT(inSuite,
+                   counter.Verify(10000 - CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE) ==
+                       CHIP_ERROR_MESSAGE_COUNTER_OUT_OF_WINDOW);
+    // One closer is the oldest acceptable slot.
+    NL_TEST_ASSERT(inSuite, counter.Verify(10000 - CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE + 1) == CHIP_NO_ERROR);
+}
+
+void TestWindowSlidesOnAdvance(nlTestSuite * inSuite, void * inContext)
+{
+    Transport::PeerMessageCounter counter;
+    counter.SetCounter(1000);
+
+    AcceptAndCommit(inSuite, counter, 1001);
+
+    // A jump smaller than the window shifts history: 1001 stays marked as
+    // received, older untracked values remain acceptable.
+    AcceptAndCommit(inSuite, counter, 1001 + CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE / 2);
+    NL_TEST_ASSERT(inSuite, counter.Verify(1001) == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+    NL_TEST_ASSERT(inSuite, counter.Verify(1002) == CHIP_NO_ERROR);
+
+    // A jump of at least the window size clears all history.
+    uint32_t farAhead = counter.GetCounter() + CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE;
+    AcceptAndCommit(inSuite, counter, farAhead);
+    NL_TEST_ASSERT(inSuite, counter.Verify(farAhead) == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+    NL_TEST_ASSERT(inSuite, counter.Verify(farAhead - 1) == CHIP_NO_ERROR);
+}
+
+void TestVerifyOrTrustFirstResync(nlTestSuite * inSuite, void * inContext)
+{
+    Transport::PeerMessageCounter counter;
+
+    // Unsynchronized counters trust the first value seen.
+    NL_TEST_ASSERT(inSuite, counter.VerifyOrTrustFirst(5000) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counter.GetCounter() == 5000);
+
+    // An out-of-window value is treated as a peer reset and re-trusted.
+    NL_TEST_ASSERT(inSuite, counter.VerifyOrTrustFirst(1) == CHIP_NO_ERROR);
+    counter.Commit(1);
+    NL_TEST_ASSERT(inSuite, counter.GetCounter() == 1);
+    NL_TEST_ASSERT(inSuite, counter.VerifyOrTrustFirst(1) == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+}
+
+} // namespace
+
+// Test Suite
+
+/**
+ *  Test Suite that lists all the test functions.
+ */
+// clang-format off
+static const nlTest sTests[] =
+{
+    NL_TEST_DEF("Test duplicate detection",              TestDuplicateDetection),
+    NL_TEST_DEF("Test reordered messages within window", TestReorderedMessagesWithinWindow),
+    NL_TEST_DEF("Test out of window rejected",           TestOutOfWindowRejected),
+    NL_TEST_DEF("Test window slides on advance",         TestWindowSlidesOnAdvance),
+    NL_TEST_DEF("Test VerifyOrTrustFirst resync",        TestVerifyOrTrustFirstResync),
+
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+/**
+ *  Main
+ */
+int TestPeerMessageCounter()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "Transport-PeerMessageCounter",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestPeerMessageCounter)
@@ -159,6 +159,130 @@ void SecureChannelDecryptTest(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, memcmp(plain_text, output, sizeof(plain_text)) == 0);
 }
 
+void SecureChannelExportImportTest(nlTestSuite * inSuite, void * inContext)
+{
+    CryptoContext channel;
+    const uint8_t plain_text[] = { 0x86, 0x74, 0x64, 0xe5, 0x0b, 0xd4, 0x0d, 0x90, 0xe1, 0x17, 0xa3, 0x2d, 0x4b, 0xd4, 0xe1, 0xe6 };
+    uint8_t encrypted[128];
+    PacketHeader packetHeader;
+    MessageAuthenticationCode mac;
+
+    packetHeader.SetSessionId(1);
+
+    uint8_t blob[CryptoContext::kSerializedKeyMaterialSize];
+    MutableByteSpan keyMaterial(blob);
+
+    // Export requires derived keys
+    NL_TEST_ASSERT(inSuite, channel.ExportKeyMaterial(keyMaterial) == CHIP_ERROR_INCORRECT_STATE);
+
+    P256Keypair keypair;
+    NL_TEST_ASSERT(inSuite, keypair.Initialize() == CHIP_NO_ERROR);
+
+    P256Keypair keypair2;
+    NL_TEST_ASSERT(inSuite, keypair2.Initialize() == CHIP_NO_ERROR);
+
+    const char * salt = "Test Salt";
+    NL_TEST_ASSERT(inSuite,
+                   channel.InitFromKeyPair(keypair, keypair2.Pubkey(), ByteSpan((const uint8_t *) salt, sizeof(salt)),
+                                           CryptoContext::SessionInfoType::kSessionEstablishment,
+                                           CryptoContext::SessionRole::kInitiator) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, channel.Encrypt(plain_text, sizeof(plain_text), encrypted, packetHeader, mac) == CHIP_NO_ERROR);
+
+    // A too-small output buffer is rejected
+    MutableByteSpan tooSmall(blob, CryptoContext::kSerializedKeyMaterialSize - 1);
+    NL_TEST_ASSERT(inSuite, channel.ExportKeyMaterial(tooSmall) == CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    NL_TEST_ASSERT(inSuite, channel.ExportKeyMaterial(keyMaterial) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, keyMaterial.size() == CryptoContext::kSerializedKeyMaterialSize);
+
+    // A channel restored from the blob carries the same keys, role and attestation
+    // challenge, so it can decrypt what the original channel's peer would decrypt.
+    CryptoContext restored;
+    NL_TEST_ASSERT(inSuite, restored.ImportKeyMaterial(ByteSpan(keyMaterial.data(), keyMaterial.size() - 1)) ==
+                       CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, restored.ImportKeyMaterial(keyMaterial) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, restored.ImportKeyMaterial(keyMaterial) == CHIP_ERROR_INCORRECT_STATE);
+
+    NL_TEST_ASSERT(inSuite,
+                   restored.GetAttestationChallenge().data_equal(channel.GetAttestationChallenge()));
+
+    uint8_t reencrypted[128];
+    MessageAuthenticationCode mac2;
+    NL_TEST_ASSERT(inSuite, restored.Encrypt(plain_text, sizeof(plain_text), reencrypted, packetHeader, mac2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(encrypted, reencrypted, sizeof(plain_text)) == 0);
+}
+
+void SecureChannelRekeyTest(nlTestSuite * inSuite, void * inContext)
+{
+    CryptoContext initiator;
+    CryptoContext responder;
+    const uint8_t plain_text[] = { 0x86, 0x74, 0x64, 0xe5, 0x0b, 0xd4, 0x0d, 0x90, 0xe1, 0x17, 0xa3, 0x2d, 0x4b, 0xd4, 0xe1, 0xe6 };
+    uint8_t encrypted[128];
+    uint8_t output[128];
+    PacketHeader packetHeader;
+
+    packetHeader.SetSessionId(1);
+
+    const uint8_t rekeySalt[] = { 0x52, 0x65, 0x6b, 0x65, 0x79, 0x20, 0x53, 0x61, 0x6c, 0x74 };
+
+    // Rotation requires derived keys
+    NL_TEST_ASSERT(inSuite, initiator.PrepareRekey(ByteSpan(rekeySalt)) == CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(inSuite, initiator.CommitRekey() == CHIP_ERROR_INCORRECT_STATE);
+
+    P256Keypair keypair;
+    NL_TEST_ASSERT(inSuite, keypair.Initialize() == CHIP_NO_ERROR);
+
+    P256Keypair keypair2;
+    NL_TEST_ASSERT(inSuite, keypair2.Initialize() == CHIP_NO_ERROR);
+
+    const char * salt = "Test Salt";
+    NL_TEST_ASSERT(inSuite,
+                   initiator.InitFromKeyPair(keypair, keypair2.Pubkey(), ByteSpan((const uint8_t *) salt, sizeof(salt)),
+                                             CryptoContext::SessionInfoType::kSessionEstablishment,
+                                             CryptoContext::SessionRole::kInitiator) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   responder.InitFromKeyPair(keypair2, keypair.Pubkey(), ByteSpan((const uint8_t *) salt, sizeof(salt)),
+                                             CryptoContext::SessionInfoType::kSessionEstablishment,
+                                             CryptoContext::SessionRole::kResponder) == CHIP_NO_ERROR);
+
+    // The initiator prepares the next epoch; encryption stays on the current
+    // epoch, so the responder still understands it.
+    MessageAuthenticationCode mac;
+    NL_TEST_ASSERT(inSuite, initiator.PrepareRekey(ByteSpan(rekeySalt)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, initiator.PrepareRekey(ByteSpan(rekeySalt)) == CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(inSuite, initiator.Encrypt(plain_text, sizeof(plain_text), encrypted, packetHeader, mac) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, responder.Decrypt(encrypted, sizeof(plain_text), output, packetHeader, mac) == CHIP_NO_ERROR);
+
+    // The responder prepares and commits; its new-epoch traffic decrypts on
+    // the initiator through the prepared keys, before the initiator commits.
+    MessageAuthenticationCode mac2;
+    NL_TEST_ASSERT(inSuite, responder.PrepareRekey(ByteSpan(rekeySalt)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, responder.CommitRekey() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, responder.Encrypt(plain_text, sizeof(plain_text), encrypted, packetHeader, mac2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, initiator.Decrypt(encrypted, sizeof(plain_text), output, packetHeader, mac2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(plain_text, output, sizeof(plain_text)) == 0);
+
+    // The responder still accepts the initiator's old-epoch traffic.
+    MessageAuthenticationCode mac3;
+    NL_TEST_ASSERT(inSuite, initiator.Encrypt(plain_text, sizeof(plain_text), encrypted, packetHeader, mac3) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, responder.Decrypt(encrypted, sizeof(plain_text), output, packetHeader, mac3) == CHIP_NO_ERROR);
+
+    // After the initiator commits, both peers are on the new epoch.
+    MessageAuthenticationCode mac4;
+    NL_TEST_ASSERT(inSuite, initiator.CommitRekey() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, initiator.Encrypt(plain_text, sizeof(plain_text), encrypted, packetHeader, mac4) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, responder.Decrypt(encrypted, sizeof(plain_text), output, packetHeader, mac4) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(plain_text, output, sizeof(plain_text)) == 0);
+
+    // A context that never rotated does not understand new-epoch traffic.
+    CryptoContext stale;
+    NL_TEST_ASSERT(inSuite,
+                   stale.InitFromKeyPair(keypair2, keypair.Pubkey(), ByteSpan((const uint8_t *) salt, sizeof(salt)),
+                                         CryptoContext::SessionInfoType::kSessionEstablishment,
+                                         CryptoContext::SessionRole::kResponder) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, stale.Decrypt(encrypted, sizeof(plain_text), output, packetHeader, mac4) != CHIP_NO_ERROR);
+}
+
 // Test Suite
 
 /**
@@ -170,6 +294,8 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Init",    SecureChannelInitTest),
     NL_TEST_DEF("Encrypt", SecureChannelEncryptTest),
     NL_TEST_DEF("Decrypt", SecureChannelDecryptTest),
+    NL_TEST_DEF("ExportImport", SecureChannelExportImportTest),
+    NL_TEST_DEF("Rekey",   SecureChannelRekeyTest),
 
     NL_TEST_SENTINEL()
 };
@@ -97,6 +97,26 @@ public:
     bool LargeMessageSent = false;
 };
 
+class GroupSessMgrCallback : public SessionMessageDelegate
+{
+public:
+    void OnMessageReceived(const PacketHeader & header, const PayloadHeader & payloadHeader, const SessionHandle & session,
+                           const Transport::PeerAddress & source, DuplicateMessage isDuplicate,
+                           System::PacketBufferHandle && msgBuf) override
+    {
+        NL_TEST_ASSERT(mSuite, session.IsGroupSession());
+        NL_TEST_ASSERT(mSuite, session.GetPeerNodeId() == kSourceNodeId);
+
+        int compare = memcmp(msgBuf->Start(), PAYLOAD, msgBuf->DataLength());
+        NL_TEST_ASSERT(mSuite, compare == 0);
+
+        ReceiveHandlerCallCount++;
+    }
+
+    nlTestSuite * mSuite        = nullptr;
+    int ReceiveHandlerCallCount = 0;
+};
+
 void CheckSimpleInitTest(nlTestSuite * inSuite, void * inContext)
 {
     TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
@@ -469,6 +489,52 @@ void StaleConnectionDropTest(nlTestSuite * inSuite, void * inContext)
     sessionManager.Shutdown();
 }
 
+void GroupMessageFanOutTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    uint16_t payload_len = sizeof(PAYLOAD);
+
+    GroupSessMgrCallback callback;
+    callback.mSuite = inSuite;
+
+    chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, payload_len);
+    NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+
+    TransportMgr<LoopbackTransport> transportMgr;
+    SessionManager sessionManager;
+    secure_channel::MessageCounterManager gMessageCounterManager;
+
+    CHIP_ERROR err = transportMgr.Init("LOOPBACK");
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = sessionManager.Init(&ctx.GetSystemLayer(), &transportMgr, &gMessageCounterManager);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    sessionManager.SetMessageDelegate(&callback);
+
+    PayloadHeader payloadHeader;
+
+    // Set the exchange ID for this header.
+    payloadHeader.SetExchangeID(0);
+
+    // Set the protocol ID and message type for this header.
+    payloadHeader.SetMessageType(chip::Protocols::Echo::MsgType::EchoRequest);
+
+    payloadHeader.SetInitiator(true);
+
+    const GroupId groups[] = { 0x0101, 0x0102, 0x0103 };
+
+    err = sessionManager.SendGroupMessage(1, kSourceNodeId, groups, ArraySize(groups), payloadHeader, std::move(buffer));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // The loopback transport reflects each datagram back synchronously, so every
+    // group should have produced exactly one delivery.
+    NL_TEST_ASSERT(inSuite, callback.ReceiveHandlerCallCount == 3);
+
+    sessionManager.Shutdown();
+}
+
 // Test Suite
 
 /**
@@ -482,6 +548,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("Send Encrypted Packet Test",     SendEncryptedPacketTest),
     NL_TEST_DEF("Send Bad Encrypted Packet Test", SendBadEncryptedPacketTest),
     NL_TEST_DEF("Drop stale connection Test",     StaleConnectionDropTest),
+    NL_TEST_DEF("Group Message Fan-Out Test",     GroupMessageFanOutTest),
 
     NL_TEST_SENTINEL()
 };
@@ -0,0 +1,155 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the message trace ring buffer.
+ */
+
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+#include <transport/TraceMessage.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::trace;
+
+namespace {
+
+MessageTraceEntry MakeEntry(uint32_t counter)
+{
+    MessageTraceEntry entry = {};
+    entry.mTimestampMicros  = 1000 + counter;
+    entry.mDurationMicros   = 42;
+    entry.mMessageCounter   = counter;
+    entry.mPayloadSize      = 100;
+    entry.mExchangeId       = 7;
+    entry.mProtocolId       = 1;
+    entry.mSessionId        = 3;
+    entry.mMessageType      = 5;
+    entry.mDirection        = MessageDirection::kOutbound;
+    return entry;
+}
+
+void TestRecordAndRetrieve(nlTestSuite * inSuite, void * inContext)
+{
+    MessageTraceBuffer buffer;
+
+    NL_TEST_ASSERT(inSuite, buffer.GetEntryCount() == 0);
+    NL_TEST_ASSERT(inSuite, buffer.GetTotalRecorded() == 0);
+
+    buffer.Record(MakeEntry(1));
+    buffer.Record(MakeEntry(2));
+
+    NL_TEST_ASSERT(inSuite, buffer.GetEntryCount() == 2);
+    NL_TEST_ASSERT(inSuite, buffer.GetTotalRecorded() == 2);
+
+    // Entries come back oldest first.
+    NL_TEST_ASSERT(inSuite, buffer.GetEntry(0).mMessageCounter == 1);
+    NL_TEST_ASSERT(inSuite, buffer.GetEntry(1).mMessageCounter == 2);
+}
+
+void TestWrapAround(nlTestSuite * inSuite, void * inContext)
+{
+    MessageTraceBuffer buffer;
+
+    // Overfill the buffer by two entries; the two oldest are overwritten.
+    for (uint32_t i = 0; i < MessageTraceBuffer::kCapacity + 2; i++)
+    {
+        buffer.Record(MakeEntry(i));
+    }
+
+    NL_TEST_ASSERT(inSuite, buffer.GetEntryCount() == MessageTraceBuffer::kCapacity);
+    NL_TEST_ASSERT(inSuite, buffer.GetTotalRecorded() == MessageTraceBuffer::kCapacity + 2);
+    NL_TEST_ASSERT(inSuite, buffer.GetEntry(0).mMessageCounter == 2);
+    NL_TEST_ASSERT(inSuite, buffer.GetEntry(MessageTraceBuffer::kCapacity - 1).mMessageCounter == MessageTraceBuffer::kCapacity + 1);
+}
+
+void TestClear(nlTestSuite * inSuite, void * inContext)
+{
+    MessageTraceBuffer buffer;
+
+    buffer.Record(MakeEntry(1));
+    buffer.Clear();
+
+    NL_TEST_ASSERT(inSuite, buffer.GetEntryCount() == 0);
+    NL_TEST_ASSERT(inSuite, buffer.GetTotalRecorded() == 0);
+}
+
+void TestSerializeEntry(nlTestSuite * inSuite, void * inContext)
+{
+    MessageTraceEntry entry = {};
+    entry.mTimestampMicros  = 0x0102030405060708;
+    entry.mDurationMicros   = 0x11121314;
+    entry.mMessageCounter   = 0x21222324;
+    entry.mPayloadSize      = 0x3132;
+    entry.mExchangeId       = 0x4142;
+    entry.mProtocolId       = 0x5152;
+    entry.mSessionId        = 0x6162;
+    entry.mMessageType      = 0x71;
+    entry.mDirection        = MessageDirection::kInbound;
+
+    const uint8_t expected[MessageTraceBuffer::kBinaryEntrySize] = {
+        0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, // timestamp, little-endian
+        0x14, 0x13, 0x12, 0x11,                         // duration
+        0x24, 0x23, 0x22, 0x21,                         // message counter
+        0x32, 0x31,                                     // payload size
+        0x42, 0x41,                                     // exchange id
+        0x52, 0x51,                                     // protocol id
+        0x62, 0x61,                                     // session id
+        0x71,                                           // message type
+        0x01,                                           // direction (inbound)
+    };
+
+    uint8_t buffer[MessageTraceBuffer::kBinaryEntrySize];
+    MessageTraceBuffer::SerializeEntry(entry, buffer);
+    NL_TEST_ASSERT(inSuite, memcmp(buffer, expected, sizeof(expected)) == 0);
+}
+
+// Test Suite
+
+/**
+ *  Test Suite that lists all the test functions.
+ */
+// clang-format off
+static const nlTest sTests[] =
+{
+    NL_TEST_DEF("Record and retrieve", TestRecordAndRetrieve),
+    NL_TEST_DEF("Wrap around",         TestWrapAround),
+    NL_TEST_DEF("Clear",               TestClear),
+    NL_TEST_DEF("Serialize entry",     TestSerializeEntry),
+
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+/**
+ *  Main
+ */
+int TestTraceMessage()
+{
+    nlTestSuite theSuite = { "Test-CHIP-TraceMessage", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestTraceMessage)
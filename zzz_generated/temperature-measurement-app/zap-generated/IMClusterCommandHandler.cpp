@@ -25,10 +25,12 @@
 #include <app-common/zap-generated/cluster-objects.h>
 #include <app-common/zap-generated/ids/Clusters.h>
 #include <app-common/zap-generated/ids/Commands.h>
+#include <app/CommandDispatchTable.h>
 #include <app/CommandHandler.h>
 #include <app/InteractionModelEngine.h>
 #include <app/util/util.h>
 #include <lib/core/CHIPSafeCasts.h>
+#include <lib/support/CodeUtils.h>
 #include <lib/support/TypeTraits.h>
 
 // Currently we need some work to keep compatible with ember lib.
@@ -43,55 +45,55 @@ namespace Clusters {
 
 namespace AdministratorCommissioning {
 
-void DispatchServerCommand(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+void HandleOpenBasicCommissioningWindow(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath,
+                                        TLV::TLVReader & aDataTlv)
 {
-    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
-    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
-    // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError = CHIP_NO_ERROR;
     bool wasHandled     = false;
+    Commands::OpenBasicCommissioningWindow::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
     {
-        switch (aCommandPath.mCommandId)
-        {
-        case Commands::OpenBasicCommissioningWindow::Id: {
-            Commands::OpenBasicCommissioningWindow::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled = emberAfAdministratorCommissioningClusterOpenBasicCommissioningWindowCallback(
-                    apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        case Commands::OpenCommissioningWindow::Id: {
-            Commands::OpenCommissioningWindow::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled = emberAfAdministratorCommissioningClusterOpenCommissioningWindowCallback(apCommandObj, aCommandPath,
-                                                                                                     commandData);
-            }
-            break;
-        }
-        case Commands::RevokeCommissioning::Id: {
-            Commands::RevokeCommissioning::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled =
-                    emberAfAdministratorCommissioningClusterRevokeCommissioningCallback(apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command " ChipLogFormatMEI " for cluster " ChipLogFormatMEI,
-                         ChipLogValueMEI(aCommandPath.mCommandId), ChipLogValueMEI(aCommandPath.mClusterId));
-            return;
-        }
-        }
+        wasHandled =
+            emberAfAdministratorCommissioningClusterOpenBasicCommissioningWindowCallback(apCommandObj, aCommandPath, commandData);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || !wasHandled)
+    {
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::InvalidCommand);
+        ChipLogProgress(Zcl, "Failed to dispatch command, TLVError=%" CHIP_ERROR_FORMAT, TLVError.Format());
+    }
+}
+
+void HandleOpenCommissioningWindow(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath,
+                                   TLV::TLVReader & aDataTlv)
+{
+    CHIP_ERROR TLVError = CHIP_NO_ERROR;
+    bool wasHandled     = false;
+    Commands::OpenCommissioningWindow::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
+    {
+        wasHandled =
+            emberAfAdministratorCommissioningClusterOpenCommissioningWindowCallback(apCommandObj, aCommandPath, commandData);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || !wasHandled)
+    {
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::InvalidCommand);
+        ChipLogProgress(Zcl, "Failed to dispatch command, TLVError=%" CHIP_ERROR_FORMAT, TLVError.Format());
+    }
+}
+
+void HandleRevokeCommissioning(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+{
+    CHIP_ERROR TLVError = CHIP_NO_ERROR;
+    bool wasHandled     = false;
+    Commands::RevokeCommissioning::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
+    {
+        wasHandled = emberAfAdministratorCommissioningClusterRevokeCommissioningCallback(apCommandObj, aCommandPath, commandData);
     }
 
     if (CHIP_NO_ERROR != TLVError || !wasHandled)
@@ -105,34 +107,15 @@ void DispatchServerCommand(CommandHandler * apCommandObj, const ConcreteCommandP
 
 namespace DiagnosticLogs {
 
-void DispatchServerCommand(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+void HandleRetrieveLogsRequest(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
 {
-    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
-    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
-    // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError = CHIP_NO_ERROR;
     bool wasHandled     = false;
+    Commands::RetrieveLogsRequest::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
     {
-        switch (aCommandPath.mCommandId)
-        {
-        case Commands::RetrieveLogsRequest::Id: {
-            Commands::RetrieveLogsRequest::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled = emberAfDiagnosticLogsClusterRetrieveLogsRequestCallback(apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command " ChipLogFormatMEI " for cluster " ChipLogFormatMEI,
-                         ChipLogValueMEI(aCommandPath.mCommandId), ChipLogValueMEI(aCommandPath.mClusterId));
-            return;
-        }
-        }
+        wasHandled = emberAfDiagnosticLogsClusterRetrieveLogsRequestCallback(apCommandObj, aCommandPath, commandData);
     }
 
     if (CHIP_NO_ERROR != TLVError || !wasHandled)
@@ -146,53 +129,51 @@ void DispatchServerCommand(CommandHandler * apCommandObj, const ConcreteCommandP
 
 namespace GeneralCommissioning {
 
-void DispatchServerCommand(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+void HandleArmFailSafe(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+{
+    CHIP_ERROR TLVError = CHIP_NO_ERROR;
+    bool wasHandled     = false;
+    Commands::ArmFailSafe::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
+    {
+        wasHandled = emberAfGeneralCommissioningClusterArmFailSafeCallback(apCommandObj, aCommandPath, commandData);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || !wasHandled)
+    {
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::InvalidCommand);
+        ChipLogProgress(Zcl, "Failed to dispatch command, TLVError=%" CHIP_ERROR_FORMAT, TLVError.Format());
+    }
+}
+
+void HandleCommissioningComplete(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+{
+    CHIP_ERROR TLVError = CHIP_NO_ERROR;
+    bool wasHandled     = false;
+    Commands::CommissioningComplete::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
+    {
+        wasHandled = emberAfGeneralCommissioningClusterCommissioningCompleteCallback(apCommandObj, aCommandPath, commandData);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || !wasHandled)
+    {
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::InvalidCommand);
+        ChipLogProgress(Zcl, "Failed to dispatch command, TLVError=%" CHIP_ERROR_FORMAT, TLVError.Format());
+    }
+}
+
+void HandleSetRegulatoryConfig(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
 {
-    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
-    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
-    // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError = CHIP_NO_ERROR;
     bool wasHandled     = false;
+    Commands::SetRegulatoryConfig::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
     {
-        switch (aCommandPath.mCommandId)
-        {
-        case Commands::ArmFailSafe::Id: {
-            Commands::ArmFailSafe::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled = emberAfGeneralCommissioningClusterArmFailSafeCallback(apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        case Commands::CommissioningComplete::Id: {
-            Commands::CommissioningComplete::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled =
-                    emberAfGeneralCommissioningClusterCommissioningCompleteCallback(apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        case Commands::SetRegulatoryConfig::Id: {
-            Commands::SetRegulatoryConfig::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled = emberAfGeneralCommissioningClusterSetRegulatoryConfigCallback(apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command " ChipLogFormatMEI " for cluster " ChipLogFormatMEI,
-                         ChipLogValueMEI(aCommandPath.mCommandId), ChipLogValueMEI(aCommandPath.mClusterId));
-            return;
-        }
-        }
+        wasHandled = emberAfGeneralCommissioningClusterSetRegulatoryConfigCallback(apCommandObj, aCommandPath, commandData);
     }
 
     if (CHIP_NO_ERROR != TLVError || !wasHandled)
@@ -206,71 +187,87 @@ void DispatchServerCommand(CommandHandler * apCommandObj, const ConcreteCommandP
 
 namespace NetworkCommissioning {
 
-void DispatchServerCommand(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+void HandleAddOrUpdateWiFiNetwork(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
 {
-    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
-    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
-    // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError = CHIP_NO_ERROR;
     bool wasHandled     = false;
+    Commands::AddOrUpdateWiFiNetwork::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
     {
-        switch (aCommandPath.mCommandId)
-        {
-        case Commands::AddOrUpdateWiFiNetwork::Id: {
-            Commands::AddOrUpdateWiFiNetwork::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled =
-                    emberAfNetworkCommissioningClusterAddOrUpdateWiFiNetworkCallback(apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        case Commands::ConnectNetwork::Id: {
-            Commands::ConnectNetwork::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled = emberAfNetworkCommissioningClusterConnectNetworkCallback(apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        case Commands::RemoveNetwork::Id: {
-            Commands::RemoveNetwork::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled = emberAfNetworkCommissioningClusterRemoveNetworkCallback(apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        case Commands::ReorderNetwork::Id: {
-            Commands::ReorderNetwork::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled = emberAfNetworkCommissioningClusterReorderNetworkCallback(apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        case Commands::ScanNetworks::Id: {
-            Commands::ScanNetworks::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled = emberAfNetworkCommissioningClusterScanNetworksCallback(apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command " ChipLogFormatMEI " for cluster " ChipLogFormatMEI,
-                         ChipLogValueMEI(aCommandPath.mCommandId), ChipLogValueMEI(aCommandPath.mClusterId));
-            return;
-        }
-        }
+        wasHandled = emberAfNetworkCommissioningClusterAddOrUpdateWiFiNetworkCallback(apCommandObj, aCommandPath, commandData);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || !wasHandled)
+    {
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::InvalidCommand);
+        ChipLogProgress(Zcl, "Failed to dispatch command, TLVError=%" CHIP_ERROR_FORMAT, TLVError.Format());
+    }
+}
+
+void HandleConnectNetwork(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+{
+    CHIP_ERROR TLVError = CHIP_NO_ERROR;
+    bool wasHandled     = false;
+    Commands::ConnectNetwork::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
+    {
+        wasHandled = emberAfNetworkCommissioningClusterConnectNetworkCallback(apCommandObj, aCommandPath, commandData);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || !wasHandled)
+    {
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::InvalidCommand);
+        ChipLogProgress(Zcl, "Failed to dispatch command, TLVError=%" CHIP_ERROR_FORMAT, TLVError.Format());
+    }
+}
+
+void HandleRemoveNetwork(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+{
+    CHIP_ERROR TLVError = CHIP_NO_ERROR;
+    bool wasHandled     = false;
+    Commands::RemoveNetwork::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
+    {
+        wasHandled = emberAfNetworkCommissioningClusterRemoveNetworkCallback(apCommandObj, aCommandPath, commandData);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || !wasHandled)
+    {
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::InvalidCommand);
+        ChipLogProgress(Zcl, "Failed to dispatch command, TLVError=%" CHIP_ERROR_FORMAT, TLVError.Format());
+    }
+}
+
+void HandleReorderNetwork(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+{
+    CHIP_ERROR TLVError = CHIP_NO_ERROR;
+    bool wasHandled     = false;
+    Commands::ReorderNetwork::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
+    {
+        wasHandled = emberAfNetworkCommissioningClusterReorderNetworkCallback(apCommandObj, aCommandPath, commandData);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || !wasHandled)
+    {
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::InvalidCommand);
+        ChipLogProgress(Zcl, "Failed to dispatch command, TLVError=%" CHIP_ERROR_FORMAT, TLVError.Format());
+    }
+}
+
+void HandleScanNetworks(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+{
+    CHIP_ERROR TLVError = CHIP_NO_ERROR;
+    bool wasHandled     = false;
+    Commands::ScanNetworks::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
+    {
+        wasHandled = emberAfNetworkCommissioningClusterScanNetworksCallback(apCommandObj, aCommandPath, commandData);
     }
 
     if (CHIP_NO_ERROR != TLVError || !wasHandled)
@@ -284,110 +281,164 @@ void DispatchServerCommand(CommandHandler * apCommandObj, const ConcreteCommandP
 
 namespace OperationalCredentials {
 
-void DispatchServerCommand(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+void HandleAddNOC(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
 {
-    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
-    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
-    // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError = CHIP_NO_ERROR;
     bool wasHandled     = false;
+    Commands::AddNOC::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
     {
-        switch (aCommandPath.mCommandId)
-        {
-        case Commands::AddNOC::Id: {
-            Commands::AddNOC::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled = emberAfOperationalCredentialsClusterAddNOCCallback(apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        case Commands::AddTrustedRootCertificate::Id: {
-            Commands::AddTrustedRootCertificate::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled =
-                    emberAfOperationalCredentialsClusterAddTrustedRootCertificateCallback(apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        case Commands::AttestationRequest::Id: {
-            Commands::AttestationRequest::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled =
-                    emberAfOperationalCredentialsClusterAttestationRequestCallback(apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        case Commands::CertificateChainRequest::Id: {
-            Commands::CertificateChainRequest::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled =
-                    emberAfOperationalCredentialsClusterCertificateChainRequestCallback(apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        case Commands::OpCSRRequest::Id: {
-            Commands::OpCSRRequest::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled = emberAfOperationalCredentialsClusterOpCSRRequestCallback(apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        case Commands::RemoveFabric::Id: {
-            Commands::RemoveFabric::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled = emberAfOperationalCredentialsClusterRemoveFabricCallback(apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        case Commands::RemoveTrustedRootCertificate::Id: {
-            Commands::RemoveTrustedRootCertificate::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled = emberAfOperationalCredentialsClusterRemoveTrustedRootCertificateCallback(apCommandObj, aCommandPath,
-                                                                                                      commandData);
-            }
-            break;
-        }
-        case Commands::UpdateFabricLabel::Id: {
-            Commands::UpdateFabricLabel::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled = emberAfOperationalCredentialsClusterUpdateFabricLabelCallback(apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        case Commands::UpdateNOC::Id: {
-            Commands::UpdateNOC::DecodableType commandData;
-            TLVError = DataModel::Decode(aDataTlv, commandData);
-            if (TLVError == CHIP_NO_ERROR)
-            {
-                wasHandled = emberAfOperationalCredentialsClusterUpdateNOCCallback(apCommandObj, aCommandPath, commandData);
-            }
-            break;
-        }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command " ChipLogFormatMEI " for cluster " ChipLogFormatMEI,
-                         ChipLogValueMEI(aCommandPath.mCommandId), ChipLogValueMEI(aCommandPath.mClusterId));
-            return;
-        }
-        }
+        wasHandled = emberAfOperationalCredentialsClusterAddNOCCallback(apCommandObj, aCommandPath, commandData);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || !wasHandled)
+    {
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::InvalidCommand);
+        ChipLogProgress(Zcl, "Failed to dispatch command, TLVError=%" CHIP_ERROR_FORMAT, TLVError.Format());
+    }
+}
+
+void HandleAddTrustedRootCertificate(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath,
+                                     TLV::TLVReader & aDataTlv)
+{
+    CHIP_ERROR TLVError = CHIP_NO_ERROR;
+    bool wasHandled     = false;
+    Commands::AddTrustedRootCertificate::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
+    {
+        wasHandled =
+            emberAfOperationalCredentialsClusterAddTrustedRootCertificateCallback(apCommandObj, aCommandPath, commandData);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || !wasHandled)
+    {
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::InvalidCommand);
+        ChipLogProgress(Zcl, "Failed to dispatch command, TLVError=%" CHIP_ERROR_FORMAT, TLVError.Format());
+    }
+}
+
+void HandleAttestationRequest(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+{
+    CHIP_ERROR TLVError = CHIP_NO_ERROR;
+    bool wasHandled     = false;
+    Commands::AttestationRequest::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
+    {
+        wasHandled = emberAfOperationalCredentialsClusterAttestationRequestCallback(apCommandObj, aCommandPath, commandData);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || !wasHandled)
+    {
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::InvalidCommand);
+        ChipLogProgress(Zcl, "Failed to dispatch command, TLVError=%" CHIP_ERROR_FORMAT, TLVError.Format());
+    }
+}
+
+void HandleCertificateChainRequest(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath,
+                                   TLV::TLVReader & aDataTlv)
+{
+    CHIP_ERROR TLVError = CHIP_NO_ERROR;
+    bool wasHandled     = false;
+    Commands::CertificateChainRequest::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
+    {
+        wasHandled = emberAfOperationalCredentialsClusterCertificateChainRequestCallback(apCommandObj, aCommandPath, commandData);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || !wasHandled)
+    {
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::InvalidCommand);
+        ChipLogProgress(Zcl, "Failed to dispatch command, TLVError=%" CHIP_ERROR_FORMAT, TLVError.Format());
+    }
+}
+
+void HandleOpCSRRequest(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+{
+    CHIP_ERROR TLVError = CHIP_NO_ERROR;
+    bool wasHandled     = false;
+    Commands::OpCSRRequest::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
+    {
+        wasHandled = emberAfOperationalCredentialsClusterOpCSRRequestCallback(apCommandObj, aCommandPath, commandData);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || !wasHandled)
+    {
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::InvalidCommand);
+        ChipLogProgress(Zcl, "Failed to dispatch command, TLVError=%" CHIP_ERROR_FORMAT, TLVError.Format());
+    }
+}
+
+void HandleRemoveFabric(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+{
+    CHIP_ERROR TLVError = CHIP_NO_ERROR;
+    bool wasHandled     = false;
+    Commands::RemoveFabric::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
+    {
+        wasHandled = emberAfOperationalCredentialsClusterRemoveFabricCallback(apCommandObj, aCommandPath, commandData);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || !wasHandled)
+    {
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::InvalidCommand);
+        ChipLogProgress(Zcl, "Failed to dispatch command, TLVError=%" CHIP_ERROR_FORMAT, TLVError.Format());
+    }
+}
+
+void HandleRemoveTrustedRootCertificate(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath,
+                                        TLV::TLVReader & aDataTlv)
+{
+    CHIP_ERROR TLVError = CHIP_NO_ERROR;
+    bool wasHandled     = false;
+    Commands::RemoveTrustedRootCertificate::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
+    {
+        wasHandled =
+            emberAfOperationalCredentialsClusterRemoveTrustedRootCertificateCallback(apCommandObj, aCommandPath, commandData);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || !wasHandled)
+    {
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::InvalidCommand);
+        ChipLogProgress(Zcl, "Failed to dispatch command, TLVError=%" CHIP_ERROR_FORMAT, TLVError.Format());
+    }
+}
+
+void HandleUpdateFabricLabel(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+{
+    CHIP_ERROR TLVError = CHIP_NO_ERROR;
+    bool wasHandled     = false;
+    Commands::UpdateFabricLabel::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
+    {
+        wasHandled = emberAfOperationalCredentialsClusterUpdateFabricLabelCallback(apCommandObj, aCommandPath, commandData);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || !wasHandled)
+    {
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::InvalidCommand);
+        ChipLogProgress(Zcl, "Failed to dispatch command, TLVError=%" CHIP_ERROR_FORMAT, TLVError.Format());
+    }
+}
+
+void HandleUpdateNOC(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
+{
+    CHIP_ERROR TLVError = CHIP_NO_ERROR;
+    bool wasHandled     = false;
+    Commands::UpdateNOC::DecodableType commandData;
+    TLVError = DataModel::Decode(aDataTlv, commandData);
+    if (TLVError == CHIP_NO_ERROR)
+    {
+        wasHandled = emberAfOperationalCredentialsClusterUpdateNOCCallback(apCommandObj, aCommandPath, commandData);
     }
 
     if (CHIP_NO_ERROR != TLVError || !wasHandled)
@@ -401,31 +452,98 @@ void DispatchServerCommand(CommandHandler * apCommandObj, const ConcreteCommandP
 
 } // namespace Clusters
 
+namespace {
+
+// A flat (cluster id, command id) -> handler table for all enabled server commands. The
+// entries are emitted in template order; the table sorts itself by key on first dispatch.
+CommandDispatchTable::Entry sServerCommandDispatchEntries[] = {
+    { CommandDispatchTable::MakeKey(Clusters::AdministratorCommissioning::Id,
+                                    Clusters::AdministratorCommissioning::Commands::OpenBasicCommissioningWindow::Id),
+      Clusters::AdministratorCommissioning::HandleOpenBasicCommissioningWindow },
+    { CommandDispatchTable::MakeKey(Clusters::AdministratorCommissioning::Id,
+                                    Clusters::AdministratorCommissioning::Commands::OpenCommissioningWindow::Id),
+      Clusters::AdministratorCommissioning::HandleOpenCommissioningWindow },
+    { CommandDispatchTable::MakeKey(Clusters::AdministratorCommissioning::Id,
+                                    Clusters::AdministratorCommissioning::Commands::RevokeCommissioning::Id),
+      Clusters::AdministratorCommissioning::HandleRevokeCommissioning },
+    { CommandDispatchTable::MakeKey(Clusters::DiagnosticLogs::Id, Clusters::DiagnosticLogs::Commands::RetrieveLogsRequest::Id),
+      Clusters::DiagnosticLogs::HandleRetrieveLogsRequest },
+    { CommandDispatchTable::MakeKey(Clusters::GeneralCommissioning::Id, Clusters::GeneralCommissioning::Commands::ArmFailSafe::Id),
+      Clusters::GeneralCommissioning::HandleArmFailSafe },
+    { CommandDispatchTable::MakeKey(Clusters::GeneralCommissioning::Id,
+                                    Clusters::GeneralCommissioning::Commands::CommissioningComplete::Id),
+      Clusters::GeneralCommissioning::HandleCommissioningComplete },
+    { CommandDispatchTable::MakeKey(Clusters::GeneralCommissioning::Id,
+                                    Clusters::GeneralCommissioning::Commands::SetRegulatoryConfig::Id),
+      Clusters::GeneralCommissioning::HandleSetRegulatoryConfig },
+    { CommandDispatchTable::MakeKey(Clusters::NetworkCommissioning::Id,
+                                    Clusters::NetworkCommissioning::Commands::AddOrUpdateWiFiNetwork::Id),
+      Clusters::NetworkCommissioning::HandleAddOrUpdateWiFiNetwork },
+    { CommandDispatchTable::MakeKey(Clusters::NetworkCommissioning::Id,
+                                    Clusters::NetworkCommissioning::Commands::ConnectNetwork::Id),
+      Clusters::NetworkCommissioning::HandleConnectNetwork },
+    { CommandDispatchTable::MakeKey(Clusters::NetworkCommissioning::Id,
+                                    Clusters::NetworkCommissioning::Commands::RemoveNetwork::Id),
+      Clusters::NetworkCommissioning::HandleRemoveNetwork },
+    { CommandDispatchTable::MakeKey(Clusters::NetworkCommissioning::Id,
+                                    Clusters::NetworkCommissioning::Commands::ReorderNetwork::Id),
+      Clusters::NetworkCommissioning::HandleReorderNetwork },
+    { CommandDispatchTable::MakeKey(Clusters::NetworkCommissioning::Id,
+                                    Clusters::NetworkCommissioning::Commands::ScanNetworks::Id),
+      Clusters::NetworkCommissioning::HandleScanNetworks },
+    { CommandDispatchTable::MakeKey(Clusters::OperationalCredentials::Id, Clusters::OperationalCredentials::Commands::AddNOC::Id),
+      Clusters::OperationalCredentials::HandleAddNOC },
+    { CommandDispatchTable::MakeKey(Clusters::OperationalCredentials::Id,
+                                    Clusters::OperationalCredentials::Commands::AddTrustedRootCertificate::Id),
+      Clusters::OperationalCredentials::HandleAddTrustedRootCertificate },
+    { CommandDispatchTable::MakeKey(Clusters::OperationalCredentials::Id,
+                                    Clusters::OperationalCredentials::Commands::AttestationRequest::Id),
+      Clusters::OperationalCredentials::HandleAttestationRequest },
+    { CommandDispatchTable::MakeKey(Clusters::OperationalCredentials::Id,
+                                    Clusters::OperationalCredentials::Commands::CertificateChainRequest::Id),
+      Clusters::OperationalCredentials::HandleCertificateChainRequest },
+    { CommandDispatchTable::MakeKey(Clusters::OperationalCredentials::Id,
+                                    Clusters::OperationalCredentials::Commands::OpCSRRequest::Id),
+      Clusters::OperationalCredentials::HandleOpCSRRequest },
+    { CommandDispatchTable::MakeKey(Clusters::OperationalCredentials::Id,
+                                    Clusters::OperationalCredentials::Commands::RemoveFabric::Id),
+      Clusters::OperationalCredentials::HandleRemoveFabric },
+    { CommandDispatchTable::MakeKey(Clusters::OperationalCredentials::Id,
+                                    Clusters::OperationalCredentials::Commands::RemoveTrustedRootCertificate::Id),
+      Clusters::OperationalCredentials::HandleRemoveTrustedRootCertificate },
+    { CommandDispatchTable::MakeKey(Clusters::OperationalCredentials::Id,
+                                    Clusters::OperationalCredentials::Commands::UpdateFabricLabel::Id),
+      Clusters::OperationalCredentials::HandleUpdateFabricLabel },
+    { CommandDispatchTable::MakeKey(Clusters::OperationalCredentials::Id,
+                                    Clusters::OperationalCredentials::Commands::UpdateNOC::Id),
+      Clusters::OperationalCredentials::HandleUpdateNOC },
+};
+
+CommandDispatchTable sServerCommandDispatchTable(sServerCommandDispatchEntries, ArraySize(sServerCommandDispatchEntries));
+
+} // namespace
+
 void DispatchSingleClusterCommand(const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aReader, CommandHandler * apCommandObj)
 {
     Compatibility::SetupEmberAfCommandHandler(apCommandObj, aCommandPath);
 
-    switch (aCommandPath.mClusterId)
+    CommandDispatchTable::CommandHandlerFunction handler =
+        sServerCommandDispatchTable.FindHandler(aCommandPath.mClusterId, aCommandPath.mCommandId);
+    if (handler != nullptr)
+    {
+        handler(apCommandObj, aCommandPath, aReader);
+    }
+    else if (sServerCommandDispatchTable.HasCluster(aCommandPath.mClusterId))
+    {
+        // Recognized cluster, unrecognized command ID; error status will apply.
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::UnsupportedCommand);
+        ChipLogError(Zcl, "Unknown command " ChipLogFormatMEI " for cluster " ChipLogFormatMEI,
+                     ChipLogValueMEI(aCommandPath.mCommandId), ChipLogValueMEI(aCommandPath.mClusterId));
+    }
+    else
     {
-    case Clusters::AdministratorCommissioning::Id:
-        Clusters::AdministratorCommissioning::DispatchServerCommand(apCommandObj, aCommandPath, aReader);
-        break;
-    case Clusters::DiagnosticLogs::Id:
-        Clusters::DiagnosticLogs::DispatchServerCommand(apCommandObj, aCommandPath, aReader);
-        break;
-    case Clusters::GeneralCommissioning::Id:
-        Clusters::GeneralCommissioning::DispatchServerCommand(apCommandObj, aCommandPath, aReader);
-        break;
-    case Clusters::NetworkCommissioning::Id:
-        Clusters::NetworkCommissioning::DispatchServerCommand(apCommandObj, aCommandPath, aReader);
-        break;
-    case Clusters::OperationalCredentials::Id:
-        Clusters::OperationalCredentials::DispatchServerCommand(apCommandObj, aCommandPath, aReader);
-        break;
-    default:
         ChipLogError(Zcl, "Unknown cluster " ChipLogFormatMEI, ChipLogValueMEI(aCommandPath.mClusterId));
         apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::UnsupportedCluster);
-        break;
     }
 
     Compatibility::ResetEmberAfObjects();